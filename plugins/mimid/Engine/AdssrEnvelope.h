@@ -24,6 +24,7 @@
 	==============================================================================
  */
 #pragma once
+#include <math.h>
 #include "Voice.h"
 class AdssrEnvelope
 {
@@ -93,6 +94,121 @@ private:
 	{
 		sustain_asymptote = sustain - (!adsrMode * sustain_delta);
 	}
+
+	// Number of samples for a distance to decrease geometrically from
+	// from to to, by a factor (1 - coef) each sample. Infinite if it
+	// never gets there.
+	static inline float geometricLength(float from, float to, float coef)
+	{
+		if (coef >= 1.0f)
+			return 0;
+		float ratio = to / from;
+		if (!(ratio > 0.0f && ratio < INFINITY))
+			return INFINITY;
+		return logf(ratio) / log1pf(-coef);
+	}
+	// Approximate number of samples until the current segment ends,
+	// calculated in closed form. Linear segments move by a constant
+	// amount each sample, and exponential ones approach their
+	// asymptote geometrically.
+	inline float segmentLength()
+	{
+		switch (state)
+		{
+		case ATK:
+			if (linear)
+				return (1.0f - Value) / coef_atk_lin;
+			return geometricLength(1.3f - Value, 0.3f, coef_atk);
+		case HLD:
+			return (1.0f - HValue) / coef_hld_lin;
+		case DEC:
+			if (linear)
+				return (Value - sustain) * dir / coef_dec_lin;
+			return geometricLength(Value - sustain_asymptote,
+					       sustain - sustain_asymptote, coef_dec);
+		case SUS:
+			return INFINITY;
+		case SUST:
+			if (linear)
+				return (Value - 20e-6f) / coef_sust_lin;
+			return geometricLength(Value, 20e-6f, coef_sust);
+		case REL:
+			if (linear)
+				return (Value - 20e-6f) / coef_rel_lin;
+			return geometricLength(Value, 20e-6f, coef_rel);
+		default:
+			return 0;
+		}
+	}
+	// Run the current segment for len samples to out, the same way
+	// as processSample(), but without checking for the end of the
+	// segment. Since all segments are monotonic, if the last sample
+	// hasn't reached the end, none of them have, and we're done.
+	// Otherwise, the state is left unchanged and false is returned.
+	inline bool processRun(float *out, int len)
+	{
+		float v = Value;
+		switch (state)
+		{
+		case ATK:
+			if (linear)
+				for (int i = 0; i < len; i++)
+					out[i] = v += coef_atk_lin;
+			else
+				for (int i = 0; i < len; i++)
+					out[i] = v += (1.3f - v) * coef_atk;
+			if (v > 1.0f)
+				return false;
+			break;
+		case HLD: {
+			float h = HValue;
+			for (int i = 0; i < len; i++)
+				h += coef_hld_lin;
+			if (!(h < 1.0f))
+				return false;
+			HValue = h;
+		}
+			[[fallthrough]];
+		case SUS:
+			for (int i = 0; i < len; i++)
+				out[i] = v;
+			break;
+		case DEC:
+			if (linear)
+				for (int i = 0; i < len; i++)
+					out[i] = v -= coef_dec_lin * dir;
+			else
+				for (int i = 0; i < len; i++)
+					out[i] = v -= (v - sustain_asymptote) * coef_dec;
+			if ((v - sustain) * dir < 0)
+				return false;
+			break;
+		case SUST:
+			if (linear)
+				for (int i = 0; i < len; i++)
+					out[i] = v -= coef_sust_lin;
+			else
+				for (int i = 0; i < len; i++)
+					out[i] = v -= v * coef_sust + dc;
+			if (v < 20e-6)
+				return false;
+			break;
+		case REL:
+			if (linear)
+				for (int i = 0; i < len; i++)
+					out[i] = v -= coef_rel_lin;
+			else
+				for (int i = 0; i < len; i++)
+					out[i] = v -= v * coef_rel + dc;
+			if (v < 20e-6)
+				return false;
+			break;
+		default:
+			return false;
+		}
+		Value = v;
+		return true;
+	}
 public:
 	float unused1; // TODO: remove
 	float unused2; // TODO: remove
@@ -273,4 +389,43 @@ public:
 		}
 		return Value;
 	}
+	// Generate n samples to out, exactly as n calls to processSample()
+	// would. Instead of checking for the end of the current segment
+	// each sample, the number of samples left in it is calculated,
+	// and the segment run up to that point, only handling the
+	// transition to the next state sample by sample.
+	// Returns the number of samples generated before the envelope
+	// ended (i.e. n if it is still active at the end), after which
+	// the output is all zeroes.
+	inline int processBlock(float *out, int n)
+	{
+		int i = 0;
+		while (i < n) {
+			if (state == OFF) {
+				Value = 0;
+				for (int j = i; j < n; j++)
+					out[j] = 0;
+				return i;
+			}
+			int left = n - i;
+			float length = segmentLength();
+			if (length >= left) {
+				// Segment continues past end of block
+				if (processRun(out + i, left))
+					break;
+			} else if (length >= 2) {
+				// The length is approximate, so stop just
+				// short of the end.
+				int run = (int)length - 1;
+				if (processRun(out + i, run))
+					i += run;
+			}
+			// Run up to and including the transition
+			int prev = state;
+			do {
+				out[i++] = processSample();
+			} while (i < n && state == prev);
+		}
+		return n;
+	}
 };
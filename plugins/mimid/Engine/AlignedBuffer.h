@@ -0,0 +1,67 @@
+/*
+	==============================================================================
+	This file is part of the MiMi-d synthesizer.
+
+	Copyright 2026 Ricard Wanderlof
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+#pragma once
+#include <vector>
+#include <stdint.h>
+
+// Float buffer with its start aligned to a cache line, which is also
+// sufficient for any SIMD access.
+// Only intended to be resized outside of the audio thread.
+class AlignedBuffer
+{
+private:
+	static const size_t alignment = 64; // bytes
+	std::vector<float> storage;
+	float *data;
+	size_t length;
+
+public:
+	AlignedBuffer()
+	{
+		data = NULL;
+		length = 0;
+	}
+	~AlignedBuffer()
+	{
+	}
+	void resize(size_t newLength)
+	{
+		// Allocate enough extra to be able to move the start
+		// up to the next alignment boundary.
+		storage.assign(newLength + alignment / sizeof(float), 0.0f);
+		uintptr_t addr = (uintptr_t)storage.data();
+		addr = (addr + alignment - 1) & ~(uintptr_t)(alignment - 1);
+		data = (float *)addr;
+		length = newLength;
+	}
+	inline size_t size() const
+	{
+		return length;
+	}
+	inline float *get()
+	{
+		return data;
+	}
+	inline float &operator[](size_t index)
+	{
+		return data[index];
+	}
+};
@@ -23,25 +23,196 @@
 	==============================================================================
  */
 #pragma once
+#include <string.h>
 #include "SynthEngine.h"
 #include "BlepData.h"
+#include "Simd.h"
+
+// Buffer for mixing in BLEPs and BLAMPs with the trivial waveform.
+//
+// Each BLEP/BLAMP covers the n = 2 * Samples samples following the
+// current one, with tap k landing k samples ahead for k >= 1, and tap
+// 0, which comes last, n samples ahead.
+// Rather than a ring buffer of n samples, which requires wrapping the
+// index for every tap, we use a buffer twice that length, the current
+// sample moving from the bottom half towards the top. Thus the n
+// samples ahead are always contiguous, and taps can be mixed in a
+// vector at a time. Once the current sample reaches the top half, the
+// samples ahead are moved down to the bottom half, which only happens
+// once every n samples.
+//
+// The oscillators don't mix in the BLEPs and BLAMPs as they go along.
+// Instead, their discontinuities are recorded in an event list, along
+// with the trivial samples, and everything is applied in one pass by
+// getSamples() at the end of each batch of up to MaxBatch samples.
+// Stretches of samples without any events are then just a vector add
+// and a copy, and the waveform generation, which is mostly
+// comparisons and branches, doesn't have to wait for the mixing.
+// Since the events and samples are applied in the order they were
+// recorded, the result is exactly the same as mixing them in
+// directly.
+//
+// Several oscillators can also be mixed into one buffer, when their
+// individual outputs aren't needed, by merging their buffers into it
+// with mergeInto(). Their samples and events are then scaled and
+// recorded in the target buffer, optionally delayed by MaxDelay
+// samples, and the target is advanced with nextSample().
+// A buffer which doesn't get any samples still returns the remainder
+// of what has already been mixed in, so switching back and forth
+// is seamless.
 
 class Antialias
 {
-	float buffer[Samples * 2];
-	const int n, nmask;
-	float const *blepPTR;
-	float const *blampPTR;
-	int bpos;
+public:
+	static const int MaxBatch = 64;
+	static const int MaxDelay = Samples - 1;
+private:
+	static const int n = Samples * 2;
+	// There are usually only a handful of events per batch; when the
+	// list fills up, what has been recorded so far is applied early.
+	static const int MaxEvents = 32;
+	struct Event {
+		int time; // samples recorded before the event
+		int delay;
+		const BlepType *table; // row in table, interpolated with the next
+		float f1, frac1; // interpolation weights, including scale
+	};
+	// Room for delayed samples and events above the top half
+	float buffer[n * 2 + MaxDelay];
+	BlepType const *blepPTR;
+	BlepType const *blampPTR;
+	float blepTableScale, blampTableScale;
+	int bpos; // current sample, i.e. the one last read
+	// Samples ahead of bpos at the start of the batch which may be
+	// non-zero
+	int tail;
+	Event events[MaxEvents];
+	int eventCount;
+	// Trivial samples recorded, without and with delay, and the
+	// number of them, and of those, resolved so far. Samples which
+	// haven't been recorded are zero, for merged buffers to add to.
+	float samples[MaxBatch];
+	float delayedSamples[MaxBatch];
+	bool delayed;
+	int sampleCount, resolvedCount;
+	float output[MaxBatch];
+	// Buffer merged into, if any
+	Antialias *target;
+	float targetGain;
+	int targetDelay;
+
+	// Move the samples ahead down to the bottom half of the
+	// buffer, and clear the top half.
+	inline void shiftDown()
+	{
+		memmove(buffer + 1, buffer + n + 1, (n + MaxDelay - 1) * sizeof(float));
+		memset(buffer + n + MaxDelay, 0, n * sizeof(float));
+		bpos = 0;
+	}
+	// Record one of the tables, to be interpolated between the phases
+	// on either side of offset, and scaled by scale (and the scale
+	// factor of the table itself).
+	inline void addEvent(const BlepType *table, float tableScale, float offset, float scale, int delay)
+	{
+		if (eventCount == MaxEvents)
+			resolve();
+		scale *= tableScale;
+		int lpIn = (int)(B_OVERSAMPLING * offset);
+		float frac = offset * B_OVERSAMPLING - lpIn;
+		Event &e = events[eventCount++];
+		e.time = sampleCount;
+		e.delay = delay;
+		e.table = table + lpIn * Blepsize;
+		e.frac1 = frac * scale;
+		e.f1 = (1.0f - frac) * scale;
+		if (tail < sampleCount + n + delay)
+			tail = sampleCount + n + delay;
+	}
+	inline void addEvent(const BlepType *table, float tableScale, float offset, float scale)
+	{
+		if (target)
+			target->addEvent(table, tableScale, offset, scale * targetGain, targetDelay);
+		else
+			addEvent(table, tableScale, offset, scale, 0);
+	}
+	// Mix in an event at the current sample.
+	inline void mixIn(const Event &e)
+	{
+		const BlepType *t0 = e.table;
+		const BlepType *t1 = t0 + Blepsize;
+		float f1 = e.f1, frac1 = e.frac1;
+		float *dst = buffer + bpos + e.delay;
+		int i = 1;
+		for (; i + SIMD_LANES <= n; i += SIMD_LANES) {
+			vfloat mixvalue = vload(t0 + i) * f1 + vload(t1 + i) * frac1;
+			vstore(dst + i, vload(dst + i) + mixvalue);
+		}
+		for (; i < n; i++)
+			dst[i] += t0[i] * f1 + t1[i] * frac1;
+		dst[n] += t0[0] * f1 + t1[0] * frac1;
+	}
+	// Add recorded samples t .. t + count - 1 to the buffer, from
+	// the current sample on, clearing them for the next batch.
+	inline void putSamples(float *src, int t, int count, int delay)
+	{
+		float *dst = buffer + bpos + Samples + delay;
+		for (int i = 0; i < count; i++) {
+			dst[i] += src[t + i];
+			src[t + i] = 0;
+		}
+	}
+	// Apply the events and samples recorded since the last time.
+	// Each sample goes in the middle of the BLEP, Samples ahead, and
+	// the sample then read is the one after the current one; the
+	// events preceding a sample are mixed in before it.
+	inline void resolve()
+	{
+		const Event *e = events, *end = events + eventCount;
+		int t = resolvedCount;
+		for (;;) {
+			while (e < end && e->time == t)
+				mixIn(*e++);
+			if (t == sampleCount)
+				break;
+			int next = e < end ? e->time : sampleCount;
+			while (t < next) {
+				int chunk = n - bpos;
+				if (chunk > next - t)
+					chunk = next - t;
+				// Samples put later land after the ones read
+				// earlier, so we can do all puts first.
+				putSamples(samples, t, chunk, 0);
+				if (delayed)
+					putSamples(delayedSamples, t, chunk, MaxDelay);
+				memcpy(output + t, buffer + bpos + 1, chunk * sizeof(float));
+				bpos += chunk;
+				t += chunk;
+				if (bpos == n)
+					shiftDown();
+			}
+		}
+		eventCount = 0;
+		resolvedCount = sampleCount;
+	}
 
 public:
-	Antialias(): n(Samples * 2), nmask(Samples * 2 - 1)
+	Antialias()
 	{
 		bpos = 0;
-		for (int i = 0; i < n; i++)
+		for (int i = 0; i < n * 2 + MaxDelay; i++)
 			buffer[i] = 0;
+		for (int i = 0; i < MaxBatch; i++)
+			samples[i] = delayedSamples[i] = 0;
 		blepPTR = blep;
 		blampPTR = blamp;
+		blepTableScale = blepScale;
+		blampTableScale = blampScale;
+		eventCount = sampleCount = resolvedCount = 0;
+		tail = 0;
+		delayed = false;
+		target = NULL;
+		targetGain = 1;
+		targetDelay = 0;
 	}
 	~Antialias()
 	{
@@ -50,58 +221,78 @@ public:
 	{
 		blepPTR = blepd2;
 		blampPTR = blampd2;
+		blepTableScale = blepd2Scale;
+		blampTableScale = blampd2Scale;
 	}
 	inline void removeDecimation()
 	{
 		blepPTR = blep;
 		blampPTR = blamp;
+		blepTableScale = blepScale;
+		blampTableScale = blampScale;
+	}
+	// Record samples and events in mergeTarget instead, scaled by
+	// gain and delayed by delay samples (0 or MaxDelay), or, with
+	// NULL, in this buffer again. Only between batches.
+	inline void mergeInto(Antialias *mergeTarget, float gain, int delay)
+	{
+		target = mergeTarget;
+		targetGain = gain;
+		targetDelay = delay;
 	}
 	inline void mixInBlampCenter(float offset, float scale)
 	{
-		int lpIn = (int)(B_OVERSAMPLING * offset);
-		float frac = offset * B_OVERSAMPLING - lpIn;
-		float frac1 = frac * scale;
-		float f1 = (1.0f - frac) * scale;
-		lpIn *= Blepsize;
-		for (int i = bpos; i < bpos + n; i++) {
-			float mixvalue = blampPTR[lpIn] * f1 + blampPTR[lpIn + Blepsize] * frac1;
-			buffer[i & nmask] += mixvalue;
-			lpIn++;
-		}
+		addEvent(blampPTR, blampTableScale, offset, scale);
 	}
-	inline void mixInImpulseCenter(float offset, float scale) 
+	inline void mixInImpulseCenter(float offset, float scale)
 	{
-		int lpIn = (int)(B_OVERSAMPLING * offset);
-		float frac = offset * B_OVERSAMPLING - lpIn;
-		float frac1 = frac * scale;
-		float f1 = (1.0f - frac) * scale;
-		lpIn *= Blepsize;
-		for (int i = bpos; i < bpos + n; i++) {
-			float mixvalue = blepPTR[lpIn] * f1 + blepPTR[lpIn + Blepsize] * frac1;
-			buffer[i & nmask] += mixvalue;
-			lpIn++;
-		}
+		addEvent(blepPTR, blepTableScale, offset, scale);
 	}
-	// Put new sample in buffer, to be fetched later, with potential
-	// blep/blamp, when getNextSample() is called.
-	// Instead of subtracting Samples to get to the middle of the
-	// buffer, and then masking with size-1 to keep the
-	// offset inside the buffer, we can just XOR the offset with
-	// Samples (which corresponds to subtracting (or adding, for
-	// that matter) half the buffer size and discarding the carry),
-	// since the buffer is 2 * Samples long.
+	// Put new trivial sample, to be fetched, with potential
+	// blep/blamp, by getSamples().
+	// At most MaxBatch samples can be put between calls to
+	// getSamples().
 	inline void putSample(float sample)
 	{
-		 buffer[bpos ^ Samples] += sample;
+		if (target) {
+			target->addSample(sample * targetGain, targetDelay);
+			return;
+		}
+		samples[sampleCount++] = sample;
+	}
+	// Add a sample from a merged buffer to the current sample.
+	inline void addSample(float sample, int delay)
+	{
+		if (delay) {
+			delayedSamples[sampleCount] += sample;
+			delayed = true;
+		} else
+			samples[sampleCount] += sample;
+	}
+	// Advance to the next sample, when merged buffers are adding
+	// to the current one.
+	inline void nextSample()
+	{
+		sampleCount++;
 	}
-	// Get next sample from buffer
-	// Note: Also advances the buffer pointer to next position
-	inline float getNextSample()
+	// Get the next count samples, once all events have been mixed in.
+	// These are the samples put since the last call, or if none were,
+	// what remains in the buffer. They remain valid until the next
+	// call.
+	inline const float *getSamples(int count)
 	{
-		bpos = (bpos + 1) & nmask;
-		float value = buffer[bpos];
-		buffer[bpos] = 0.0f; // clear buffer as data is fetched
+		static const float zeros[MaxBatch] = {};
 
-		return value;
+		if (!sampleCount) {
+			if (tail <= 0 && !eventCount)
+				return zeros;
+			sampleCount = count;
+		} else if (tail < sampleCount + Samples + MaxDelay)
+			tail = sampleCount + Samples + MaxDelay;
+		resolve();
+		tail -= sampleCount;
+		sampleCount = resolvedCount = 0;
+		delayed = false;
+		return output;
 	}
 };
@@ -36,6 +36,15 @@ const float dc = 1e-18;
 const float ln2 = 0.69314718056f;
 const float mult = ln2 / 12.0;
 
+// Force inlining of functions which have only been split out to
+// structure the code, so that the split doesn't cost anything in
+// the audio loop.
+#ifdef __GNUC__
+#define forceinline inline __attribute__((always_inline))
+#else
+#define forceinline inline
+#endif
+
 // Replacements for Juce library functions
 
 #if 0 // Use alternate implementation to correctly round negative numbers
@@ -61,6 +70,15 @@ inline int roundToInt(float val)
 }
 #endif
 
+// Check for Inf or NaN by looking at the exponent directly, since
+// std::isfinite() is optimized away when compiling with -ffast-math.
+inline bool isfinitef(float val)
+{
+	union { float f; uint32_t i; } u;
+	u.f = val;
+	return (u.i & 0x7f800000) != 0x7f800000;
+}
+
 inline float minf(const float a, const float b) noexcept
 {
 	return (a < b) ? a : b;
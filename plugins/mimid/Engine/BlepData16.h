@@ -0,0 +1,8594 @@
+// BLEP and BLAMP tables for Samples = 16, generated by Utils/blepnew.c.
+// See BlepData.h.
+
+// blep table: 2080 entries
+const float blep[] = {
+	3.239520e-18f,
+	1.371423e-05f,
+	-1.019683e-04f,
+	2.552405e-04f,
+	-5.475735e-04f,
+	9.985183e-04f,
+	-1.713736e-03f,
+	2.747855e-03f,
+	-4.249273e-03f,
+	6.333798e-03f,
+	-9.254147e-03f,
+	1.333135e-02f,
+	-1.927269e-02f,
+	2.855073e-02f,
+	-4.545458e-02f,
+	8.786753e-02f,
+	5.000000e-01f,
+	-8.786750e-02f,
+	4.545456e-02f,
+	-2.855074e-02f,
+	1.927269e-02f,
+	-1.333129e-02f,
+	9.254217e-03f,
+	-6.333828e-03f,
+	4.249275e-03f,
+	-2.747893e-03f,
+	1.713812e-03f,
+	-9.984970e-04f,
+	5.475879e-04f,
+	-2.552271e-04f,
+	1.019835e-04f,
+	-1.370907e-05f,
+
+	6.369915e-12f,
+	1.368467e-05f,
+	-1.018386e-04f,
+	2.549090e-04f,
+	-5.468909e-04f,
+	9.972695e-04f,
+	-1.711619e-03f,
+	2.744461e-03f,
+	-4.244054e-03f,
+	6.326018e-03f,
+	-9.242799e-03f,
+	1.331498e-02f,
+	-1.924895e-02f,
+	2.851526e-02f,
+	-4.539681e-02f,
+	8.774547e-02f,
+	4.843783e-01f,
+	-8.774936e-02f,
+	4.539782e-02f,
+	-2.851570e-02f,
+	1.924926e-02f,
+	-1.331508e-02f,
+	9.243011e-03f,
+	-6.326079e-03f,
+	4.244149e-03f,
+	-2.744555e-03f,
+	1.711726e-03f,
+	-9.973049e-04f,
+	5.469322e-04f,
+	-2.548695e-04f,
+	1.018643e-04f,
+	-1.370907e-05f,
+
+	6.437058e-11f,
+	1.359414e-05f,
+	-1.014451e-04f,
+	2.539068e-04f,
+	-5.448308e-04f,
+	9.935042e-04f,
+	-1.705243e-03f,
+	2.734241e-03f,
+	-4.228340e-03f,
+	6.302603e-03f,
+	-9.208652e-03f,
+	1.326571e-02f,
+	-1.917751e-02f,
+	2.840843e-02f,
+	-4.522262e-02f,
+	8.737548e-02f,
+	4.687693e-01f,
+	-8.739877e-02f,
+	4.522866e-02f,
+	-2.841127e-02f,
+	1.917922e-02f,
+	-1.326680e-02f,
+	9.209514e-03f,
+	-6.303191e-03f,
+	4.228771e-03f,
+	-2.734542e-03f,
+	1.705468e-03f,
+	-9.936094e-04f,
+	5.449653e-04f,
+	-2.539158e-04f,
+	1.015067e-04f,
+	-1.358986e-05f,
+
+	2.903320e-10f,
+	1.343898e-05f,
+	-1.007798e-04f,
+	2.522196e-04f,
+	-5.413700e-04f,
+	9.871871e-04f,
+	-1.694556e-03f,
+	2.717124e-03f,
+	-4.202035e-03f,
+	6.263420e-03f,
+	-9.151524e-03f,
+	1.318328e-02f,
+	-1.905798e-02f,
+	2.822957e-02f,
+	-4.493034e-02f,
+	8.675022e-02f,
+	4.531856e-01f,
+	-8.682370e-02f,
+	4.494947e-02f,
+	-2.823853e-02f,
+	1.906329e-02f,
+	-1.318681e-02f,
+	9.154081e-03f,
+	-6.265163e-03f,
+	4.203320e-03f,
+	-2.717972e-03f,
+	1.695216e-03f,
+	-9.875298e-04f,
+	5.416870e-04f,
+	-2.523661e-04f,
+	1.009107e-04f,
+	-1.347065e-05f,
+
+	8.765287e-10f,
+	1.321558e-05f,
+	-9.983495e-05f,
+	2.498344e-04f,
+	-5.364888e-04f,
+	9.782895e-04f,
+	-1.679517e-03f,
+	2.693054e-03f,
+	-4.165067e-03f,
+	6.208374e-03f,
+	-9.071289e-03f,
+	1.306752e-02f,
+	-1.889006e-02f,
+	2.797810e-02f,
+	-4.451857e-02f,
+	8.586251e-02f,
+	4.376398e-01f,
+	-8.603263e-02f,
+	4.456282e-02f,
+	-2.799881e-02f,
+	1.890236e-02f,
+	-1.307559e-02f,
+	9.077072e-03f,
+	-6.212473e-03f,
+	4.168034e-03f,
+	-2.695084e-03f,
+	1.680970e-03f,
+	-9.791851e-04f,
+	5.371571e-04f,
+	-2.502203e-04f,
+	1.000762e-04f,
+	-1.323223e-05f,
+
+	2.091686e-09f,
+	1.292044e-05f,
+	-9.860352e-05f,
+	2.467399e-04f,
+	-5.301705e-04f,
+	9.667881e-04f,
+	-1.660096e-03f,
+	2.661994e-03f,
+	-4.117389e-03f,
+	6.137409e-03f,
+	-8.967876e-03f,
+	1.291832e-02f,
+	-1.867359e-02f,
+	2.765367e-02f,
+	-4.398613e-02f,
+	8.470547e-02f,
+	4.221444e-01f,
+	-8.503389e-02f,
+	4.407150e-02f,
+	-2.769363e-02f,
+	1.869732e-02f,
+	-1.293397e-02f,
+	8.978963e-03f,
+	-6.145358e-03f,
+	4.123092e-03f,
+	-2.665997e-03f,
+	1.662910e-03f,
+	-9.685755e-04f,
+	5.313754e-04f,
+	-2.473593e-04f,
+	9.900331e-05f,
+	-1.299381e-05f,
+
+	4.277924e-09f,
+	1.255018e-05f,
+	-9.707915e-05f,
+	2.429266e-04f,
+	-5.224018e-04f,
+	9.526666e-04f,
+	-1.636274e-03f,
+	2.623921e-03f,
+	-4.058979e-03f,
+	6.050506e-03f,
+	-8.841271e-03f,
+	1.273567e-02f,
+	-1.840851e-02f,
+	2.725606e-02f,
+	-4.333215e-02f,
+	8.327252e-02f,
+	4.067121e-01f,
+	-8.383608e-02f,
+	4.347837e-02f,
+	-2.732456e-02f,
+	1.844913e-02f,
+	-1.276255e-02f,
+	8.860230e-03f,
+	-6.064057e-03f,
+	4.068673e-03f,
+	-2.630711e-03f,
+	1.641035e-03f,
+	-9.558201e-04f,
+	5.244613e-04f,
+	-2.441406e-04f,
+	9.775162e-05f,
+	-1.275539e-05f,
+
+	7.849166e-09f,
+	1.210152e-05f,
+	-9.525608e-05f,
+	2.383864e-04f,
+	-5.131732e-04f,
+	9.359143e-04f,
+	-1.608041e-03f,
+	2.578833e-03f,
+	-3.989844e-03f,
+	5.947688e-03f,
+	-8.691514e-03f,
+	1.251963e-02f,
+	-1.809490e-02f,
+	2.678525e-02f,
+	-4.255597e-02f,
+	8.155733e-02f,
+	3.913550e-01f,
+	-8.244777e-02f,
+	4.278672e-02f,
+	-2.689338e-02f,
+	1.815897e-02f,
+	-1.256204e-02f,
+	8.721352e-03f,
+	-5.969048e-03f,
+	4.005134e-03f,
+	-2.589583e-03f,
+	1.615524e-03f,
+	-9.407997e-04f,
+	5.163550e-04f,
+	-2.402067e-04f,
+	9.632111e-05f,
+	-1.251698e-05f,
+
+	1.328717e-08f,
+	1.157134e-05f,
+	-9.312930e-05f,
+	2.331132e-04f,
+	-5.024789e-04f,
+	9.165279e-04f,
+	-1.575400e-03f,
+	2.526743e-03f,
+	-3.910016e-03f,
+	5.829014e-03f,
+	-8.518705e-03f,
+	1.227035e-02f,
+	-1.773293e-02f,
+	2.624137e-02f,
+	-4.165725e-02f,
+	7.955389e-02f,
+	3.760855e-01f,
+	-8.087802e-02f,
+	4.199976e-02f,
+	-2.640176e-02f,
+	1.782799e-02f,
+	-1.233339e-02f,
+	8.562982e-03f,
+	-5.860686e-03f,
+	3.932714e-03f,
+	-2.542734e-03f,
+	1.586497e-03f,
+	-9.238720e-04f,
+	5.072355e-04f,
+	-2.359152e-04f,
+	9.465218e-05f,
+	-1.215935e-05f,
+
+	2.113675e-08f,
+	1.095669e-05f,
+	-9.069452e-05f,
+	2.271028e-04f,
+	-4.903163e-04f,
+	8.945101e-04f,
+	-1.538365e-03f,
+	2.467681e-03f,
+	-3.819555e-03f,
+	5.694586e-03f,
+	-8.323003e-03f,
+	1.198805e-02f,
+	-1.732291e-02f,
+	2.562477e-02f,
+	-4.063592e-02f,
+	7.725655e-02f,
+	3.609158e-01f,
+	-7.913578e-02f,
+	4.112107e-02f,
+	-2.585196e-02f,
+	1.745749e-02f,
+	-1.207733e-02f,
+	8.385658e-03f,
+	-5.739450e-03f,
+	3.851712e-03f,
+	-2.490401e-03f,
+	1.554072e-03f,
+	-9.049177e-04f,
+	4.969835e-04f,
+	-2.310276e-04f,
+	9.286404e-05f,
+	-1.180172e-05f,
+
+	3.200497e-08f,
+	1.025481e-05f,
+	-8.794825e-05f,
+	2.203527e-04f,
+	-4.766868e-04f,
+	8.698707e-04f,
+	-1.496960e-03f,
+	2.401698e-03f,
+	-3.718547e-03f,
+	5.544544e-03f,
+	-8.104622e-03f,
+	1.167305e-02f,
+	-1.686526e-02f,
+	2.493592e-02f,
+	-3.949216e-02f,
+	7.465991e-02f,
+	3.458579e-01f,
+	-7.722998e-02f,
+	4.015422e-02f,
+	-2.524590e-02f,
+	1.704890e-02f,
+	-1.179481e-02f,
+	8.190036e-03f,
+	-5.605698e-03f,
+	3.762424e-03f,
+	-2.432704e-03f,
+	1.518369e-03f,
+	-8.840561e-04f,
+	4.857779e-04f,
+	-2.257824e-04f,
+	9.089708e-05f,
+	-1.144409e-05f,
+
+	4.655460e-08f,
+	9.463115e-06f,
+	-8.488781e-05f,
+	2.128624e-04f,
+	-4.615959e-04f,
+	8.426263e-04f,
+	-1.451221e-03f,
+	2.328861e-03f,
+	-3.607107e-03f,
+	5.379071e-03f,
+	-7.863839e-03f,
+	1.132575e-02f,
+	-1.636053e-02f,
+	2.417553e-02f,
+	-3.822650e-02f,
+	7.175899e-02f,
+	3.309235e-01f,
+	-7.516992e-02f,
+	3.910309e-02f,
+	-2.458572e-02f,
+	1.660353e-02f,
+	-1.148689e-02f,
+	7.976890e-03f,
+	-5.460024e-03f,
+	3.665149e-03f,
+	-2.369881e-03f,
+	1.479566e-03f,
+	-8.614063e-04f,
+	4.736185e-04f,
+	-2.199411e-04f,
+	8.881092e-05f,
+	-1.108646e-05f,
+
+	6.549886e-08f,
+	8.579284e-06f,
+	-8.151137e-05f,
+	2.046336e-04f,
+	-4.450528e-04f,
+	8.128004e-04f,
+	-1.401196e-03f,
+	2.249254e-03f,
+	-3.485376e-03f,
+	5.198388e-03f,
+	-7.600983e-03f,
+	1.094662e-02f,
+	-1.580939e-02f,
+	2.334446e-02f,
+	-3.683970e-02f,
+	6.854910e-02f,
+	3.161244e-01f,
+	-7.296467e-02f,
+	3.797150e-02f,
+	-2.387393e-02f,
+	1.612294e-02f,
+	-1.115453e-02f,
+	7.746816e-03f,
+	-5.302906e-03f,
+	3.560245e-03f,
+	-2.302170e-03f,
+	1.437724e-03f,
+	-8.370876e-04f,
+	4.605651e-04f,
+	-2.138615e-04f,
+	8.654594e-05f,
+	-1.060963e-05f,
+
+	8.959341e-08f,
+	7.601210e-06f,
+	-7.781796e-05f,
+	1.956697e-04f,
+	-4.270707e-04f,
+	7.804235e-04f,
+	-1.346943e-03f,
+	2.162981e-03f,
+	-3.353522e-03f,
+	5.002757e-03f,
+	-7.316446e-03f,
+	1.053623e-02f,
+	-1.521263e-02f,
+	2.244375e-02f,
+	-3.533286e-02f,
+	6.502596e-02f,
+	3.014719e-01f,
+	-7.062352e-02f,
+	3.676367e-02f,
+	-2.311277e-02f,
+	1.560873e-02f,
+	-1.079893e-02f,
+	7.500648e-03f,
+	-5.134702e-03f,
+	3.448129e-03f,
+	-2.229810e-03f,
+	1.393080e-03f,
+	-8.111000e-04f,
+	4.466176e-04f,
+	-2.073050e-04f,
+	8.416176e-05f,
+	-1.025200e-05f,
+
+	1.196319e-07f,
+	6.527056e-06f,
+	-7.380754e-05f,
+	1.859764e-04f,
+	-4.076667e-04f,
+	7.455333e-04f,
+	-1.288534e-03f,
+	2.070164e-03f,
+	-3.211743e-03f,
+	4.792480e-03f,
+	-7.010677e-03f,
+	1.009522e-02f,
+	-1.457115e-02f,
+	2.147463e-02f,
+	-3.370737e-02f,
+	6.118565e-02f,
+	2.869774e-01f,
+	-6.815577e-02f,
+	3.548360e-02f,
+	-2.230465e-02f,
+	1.506251e-02f,
+	-1.042104e-02f,
+	7.239163e-03f,
+	-4.956126e-03f,
+	3.329158e-03f,
+	-2.153039e-03f,
+	1.345754e-03f,
+	-7.835627e-04f,
+	4.318953e-04f,
+	-2.003908e-04f,
+	8.165836e-05f,
+	-9.775162e-06f,
+
+	1.564420e-07f,
+	5.355262e-06f,
+	-6.948099e-05f,
+	1.755615e-04f,
+	-3.868621e-04f,
+	7.081743e-04f,
+	-1.226050e-03f,
+	1.970942e-03f,
+	-3.060261e-03f,
+	4.567901e-03f,
+	-6.684182e-03f,
+	9.624333e-03f,
+	-1.388597e-02f,
+	2.043852e-02f,
+	-3.196491e-02f,
+	5.702461e-02f,
+	2.726517e-01f,
+	-6.557071e-02f,
+	3.413558e-02f,
+	-2.145231e-02f,
+	1.448596e-02f,
+	-1.002216e-02f,
+	6.963134e-03f,
+	-4.767776e-03f,
+	3.203571e-03f,
+	-2.072215e-03f,
+	1.295924e-03f,
+	-7.545948e-04f,
+	4.164577e-04f,
+	-1.932383e-04f,
+	7.909536e-05f,
+	-9.298325e-06f,
+
+	2.008762e-07f,
+	4.084562e-06f,
+	-6.484013e-05f,
+	1.644349e-04f,
+	-3.646823e-04f,
+	6.683981e-04f,
+	-1.159585e-03f,
+	1.865473e-03f,
+	-2.899326e-03f,
+	4.329398e-03f,
+	-6.337524e-03f,
+	9.124367e-03f,
+	-1.315827e-02f,
+	1.933700e-02f,
+	-3.010748e-02f,
+	5.253971e-02f,
+	2.585058e-01f,
+	-6.287766e-02f,
+	3.272396e-02f,
+	-2.055824e-02f,
+	1.388085e-02f,
+	-9.603500e-03f,
+	6.673455e-03f,
+	-4.570007e-03f,
+	3.071904e-03f,
+	-1.987457e-03f,
+	1.243711e-03f,
+	-7.243156e-04f,
+	4.003048e-04f,
+	-1.857281e-04f,
+	7.635355e-05f,
+	-8.821487e-06f,
+
+	2.538019e-07f,
+	2.714004e-06f,
+	-5.988781e-05f,
+	1.526086e-04f,
+	-3.411567e-04f,
+	6.262636e-04f,
+	-1.089245e-03f,
+	1.753932e-03f,
+	-2.729217e-03f,
+	4.077394e-03f,
+	-5.971322e-03f,
+	8.596216e-03f,
+	-1.238928e-02f,
+	1.817186e-02f,
+	-2.813736e-02f,
+	4.772818e-02f,
+	2.445500e-01f,
+	-6.008589e-02f,
+	3.125322e-02f,
+	-1.962543e-02f,
+	1.324904e-02f,
+	-9.166241e-03f,
+	6.370902e-03f,
+	-4.363656e-03f,
+	2.934515e-03f,
+	-1.899004e-03f,
+	1.189291e-03f,
+	-6.928444e-04f,
+	3.835559e-04f,
+	-1.778603e-04f,
+	7.361174e-05f,
+	-8.463860e-06f,
+
+	3.160992e-07f,
+	1.242961e-06f,
+	-5.462782e-05f,
+	1.400968e-04f,
+	-3.163186e-04f,
+	5.818366e-04f,
+	-1.015146e-03f,
+	1.636512e-03f,
+	-2.550235e-03f,
+	3.812347e-03f,
+	-5.586250e-03f,
+	8.040853e-03f,
+	-1.158040e-02f,
+	1.694503e-02f,
+	-2.605717e-02f,
+	4.258770e-02f,
+	2.307947e-01f,
+	-5.720460e-02f,
+	2.972782e-02f,
+	-1.865613e-02f,
+	1.259232e-02f,
+	-8.711696e-03f,
+	6.056488e-03f,
+	-4.149199e-03f,
+	2.791762e-03f,
+	-1.807213e-03f,
+	1.132905e-03f,
+	-6.601810e-04f,
+	3.662109e-04f,
+	-1.698732e-04f,
+	7.075071e-05f,
+	-7.987022e-06f,
+
+	3.886443e-07f,
+	-3.288437e-07f,
+	-4.906502e-05f,
+	1.269159e-04f,
+	-2.902056e-04f,
+	5.351896e-04f,
+	-9.374166e-04f,
+	1.513423e-03f,
+	-2.362711e-03f,
+	3.534754e-03f,
+	-5.183036e-03f,
+	7.459324e-03f,
+	-1.073312e-02f,
+	1.565866e-02f,
+	-2.386982e-02f,
+	3.711634e-02f,
+	2.172497e-01f,
+	-5.424309e-02f,
+	2.815235e-02f,
+	-1.765358e-02f,
+	1.191252e-02f,
+	-8.241177e-03f,
+	5.731046e-03f,
+	-3.927350e-03f,
+	2.644181e-03f,
+	-1.712322e-03f,
+	1.074612e-03f,
+	-6.264448e-04f,
+	3.483295e-04f,
+	-1.616478e-04f,
+	6.788969e-05f,
+	-7.510185e-06f,
+
+	4.723078e-07f,
+	-2.001328e-06f,
+	-4.320524e-05f,
+	1.130844e-04f,
+	-2.628593e-04f,
+	4.864023e-04f,
+	-8.561945e-04f,
+	1.384892e-03f,
+	-2.167000e-03f,
+	3.245149e-03f,
+	-4.762464e-03f,
+	6.852756e-03f,
+	-9.849051e-03f,
+	1.431503e-02f,
+	-2.157851e-02f,
+	3.131259e-02f,
+	2.039246e-01f,
+	-5.121040e-02f,
+	2.653128e-02f,
+	-1.662040e-02f,
+	1.121163e-02f,
+	-7.755876e-03f,
+	5.395472e-03f,
+	-3.698587e-03f,
+	2.492130e-03f,
+	-1.614690e-03f,
+	1.014650e-03f,
+	-5.918741e-04f,
+	3.300309e-04f,
+	-1.531839e-04f,
+	6.490946e-05f,
+	-7.033348e-06f,
+
+	5.679478e-07f,
+	-3.774041e-06f,
+	-3.705541e-05f,
+	9.862323e-05f,
+	-2.343253e-04f,
+	4.355611e-04f,
+	-7.716300e-04f,
+	1.251164e-03f,
+	-1.963480e-03f,
+	2.944101e-03f,
+	-4.325364e-03f,
+	6.222347e-03f,
+	-8.929903e-03f,
+	1.291662e-02f,
+	-1.918678e-02f,
+	2.517537e-02f,
+	1.908288e-01f,
+	-4.811561e-02f,
+	2.486938e-02f,
+	-1.555955e-02f,
+	1.049155e-02f,
+	-7.257342e-03f,
+	5.050719e-03f,
+	-3.463626e-03f,
+	2.336025e-03f,
+	-1.514435e-03f,
+	9.532571e-04f,
+	-5.564690e-04f,
+	3.112555e-04f,
+	-1.446009e-04f,
+	6.192923e-05f,
+	-6.675720e-06f,
+
+	6.763945e-07f,
+	-5.646143e-06f,
+	-3.062348e-05f,
+	8.355515e-05f,
+	-2.046531e-04f,
+	3.827592e-04f,
+	-6.838836e-04f,
+	1.112499e-03f,
+	-1.752555e-03f,
+	2.632215e-03f,
+	-3.872621e-03f,
+	5.569368e-03f,
+	-7.977499e-03f,
+	1.146607e-02f,
+	-1.669843e-02f,
+	1.870404e-02f,
+	1.779712e-01f,
+	-4.496777e-02f,
+	2.317131e-02f,
+	-1.447392e-02f,
+	9.754360e-03f,
+	-6.747007e-03f,
+	4.697740e-03f,
+	-3.223300e-03f,
+	2.176285e-03f,
+	-1.412034e-03f,
+	8.904338e-04f,
+	-5.202293e-04f,
+	2.921820e-04f,
+	-1.358986e-04f,
+	5.894899e-05f,
+	-6.198883e-06f,
+
+	7.984452e-07f,
+	-7.616395e-06f,
+	-2.391845e-05f,
+	6.790531e-05f,
+	-1.738961e-04f,
+	3.280960e-04f,
+	-5.931262e-04f,
+	9.691728e-04f,
+	-1.534654e-03f,
+	2.310131e-03f,
+	-3.405168e-03f,
+	4.895160e-03f,
+	-6.993767e-03f,
+	9.966169e-03f,
+	-1.411759e-02f,
+	1.189840e-02f,
+	1.653605e-01f,
+	-4.177558e-02f,
+	2.144158e-02f,
+	-1.336646e-02f,
+	9.001851e-03f,
+	-6.225824e-03f,
+	4.337549e-03f,
+	-2.977967e-03f,
+	2.013445e-03f,
+	-1.307607e-03f,
+	8.265376e-04f,
+	-4.833937e-04f,
+	2.728105e-04f,
+	-1.269579e-04f,
+	5.590916e-05f,
+	-5.722046e-06f,
+
+	9.348541e-07f,
+	-9.683151e-06f,
+	-1.695041e-05f,
+	5.170093e-05f,
+	-1.421117e-04f,
+	2.716779e-04f,
+	-4.995389e-04f,
+	8.214777e-04f,
+	-1.310225e-03f,
+	1.978518e-03f,
+	-2.923983e-03f,
+	4.201132e-03f,
+	-5.980730e-03f,
+	8.419888e-03f,
+	-1.144869e-02f,
+	4.758664e-03f,
+	1.530049e-01f,
+	-3.854799e-02f,
+	1.968503e-02f,
+	-1.224029e-02f,
+	8.236170e-03f,
+	-5.695462e-03f,
+	3.970981e-03f,
+	-2.728462e-03f,
+	1.847863e-03f,
+	-1.201510e-03f,
+	7.616282e-04f,
+	-4.460812e-04f,
+	2.532005e-04f,
+	-1.181364e-04f,
+	5.286932e-05f,
+	-5.364418e-06f,
+
+	1.086325e-06f,
+	-1.184434e-05f,
+	-9.730472e-06f,
+	3.497135e-05f,
+	-1.093609e-04f,
+	2.136169e-04f,
+	-4.033126e-04f,
+	6.697202e-04f,
+	-1.079740e-03f,
+	1.638082e-03f,
+	-2.430090e-03f,
+	3.488758e-03f,
+	-4.940511e-03f,
+	6.830337e-03f,
+	-8.696442e-03f,
+	-2.714483e-03f,
+	1.409123e-01f,
+	-3.529334e-02f,
+	1.790619e-02f,
+	-1.109815e-02f,
+	7.459283e-03f,
+	-5.157351e-03f,
+	3.599107e-03f,
+	-2.475381e-03f,
+	1.680017e-03f,
+	-1.093984e-03f,
+	6.959438e-04f,
+	-4.084110e-04f,
+	2.333522e-04f,
+	-1.090765e-04f,
+	4.982948e-05f,
+	-5.006790e-06f,
+
+	1.253499e-06f,
+	-1.409748e-05f,
+	-2.270838e-06f,
+	1.774799e-05f,
+	-7.570842e-05f,
+	1.540316e-04f,
+	-3.046477e-04f,
+	5.142210e-04f,
+	-8.436934e-04f,
+	1.289554e-03f,
+	-1.924557e-03f,
+	2.759571e-03f,
+	-3.875322e-03f,
+	5.200781e-03f,
+	-5.865842e-03f,
+	-1.051993e-02f,
+	1.290903e-01f,
+	-3.202045e-02f,
+	1.610982e-02f,
+	-9.943008e-03f,
+	6.673157e-03f,
+	-4.612803e-03f,
+	3.222883e-03f,
+	-2.219319e-03f,
+	1.510262e-03f,
+	-9.853840e-04f,
+	6.296039e-04f,
+	-3.703833e-04f,
+	2.134442e-04f,
+	-1.001358e-04f,
+	4.684925e-05f,
+	-4.529953e-06f,
+
+	1.436951e-06f,
+	-1.643963e-05f,
+	5.415272e-06f,
+	6.430653e-08f,
+	-4.122265e-05f,
+	9.304621e-05f,
+	-2.037537e-04f,
+	3.553151e-04f,
+	-6.025967e-04f,
+	9.336979e-04f,
+	-1.408492e-03f,
+	2.015168e-03f,
+	-2.787467e-03f,
+	3.534626e-03f,
+	-2.962185e-03f,
+	-1.865610e-02f,
+	1.175460e-01f,
+	-2.873731e-02f,
+	1.430041e-02f,
+	-8.777976e-03f,
+	5.879939e-03f,
+	-4.063249e-03f,
+	2.843201e-03f,
+	-1.961112e-03f,
+	1.339197e-03f,
+	-8.759499e-04f,
+	5.628467e-04f,
+	-3.321171e-04f,
+	1.934171e-04f,
+	-9.107590e-05f,
+	4.380941e-05f,
+	-4.172325e-06f,
+
+	1.637172e-06f,
+	-1.886744e-05f,
+	1.331359e-05f,
+	-1.804425e-05f,
+	-5.975352e-06f,
+	3.079056e-05f,
+	-1.008489e-04f,
+	1.933500e-04f,
+	-3.569824e-04f,
+	5.713021e-04f,
+	-8.830409e-04f,
+	1.257198e-03f,
+	-1.679329e-03f,
+	1.835418e-03f,
+	8.961480e-06f,
+	-2.712099e-02f,
+	1.062862e-01f,
+	-2.545214e-02f,
+	1.248258e-02f,
+	-7.605910e-03f,
+	5.081475e-03f,
+	-3.509998e-03f,
+	2.461076e-03f,
+	-1.701355e-03f,
+	1.167119e-03f,
+	-7.660389e-04f,
+	4.957914e-04f,
+	-2.937317e-04f,
+	1.733899e-04f,
+	-8.201599e-05f,
+	4.082918e-05f,
+	-3.814697e-06f,
+
+	1.854572e-06f,
+	-2.137708e-05f,
+	2.140882e-05f,
+	-3.654029e-05f,
+	2.995838e-05f,
+	-3.260008e-05f,
+	3.840135e-06f,
+	2.868580e-05f,
+	-1.074001e-04f,
+	2.031813e-04f,
+	-3.493881e-04f,
+	4.873621e-04f,
+	-5.533748e-04f,
+	1.068321e-04f,
+	3.041753e-03f,
+	-3.591214e-02f,
+	9.531713e-02f,
+	-2.217293e-02f,
+	1.066089e-02f,
+	-6.429911e-03f,
+	4.279852e-03f,
+	-2.954602e-03f,
+	2.077401e-03f,
+	-1.440644e-03f,
+	9.945035e-04f,
+	-6.557703e-04f,
+	4.286170e-04f,
+	-2.553463e-04f,
+	1.533628e-04f,
+	-7.307529e-05f,
+	3.790855e-05f,
+	-3.457069e-06f,
+
+	2.089465e-06f,
+	-2.396428e-05f,
+	2.968467e-05f,
+	-5.538454e-05f,
+	6.650022e-05f,
+	-9.698531e-05f,
+	1.100789e-04f,
+	-1.383057e-04f,
+	1.455836e-04f,
+	-1.698260e-04f,
+	1.912502e-04f,
+	-2.925875e-04f,
+	5.878590e-04f,
+	-1.647328e-03f,
+	6.130077e-03f,
+	-4.502666e-02f,
+	8.464479e-02f,
+	-1.890755e-02f,
+	8.839786e-03f,
+	-5.252481e-03f,
+	3.477037e-03f,
+	-2.398252e-03f,
+	1.693249e-03f,
+	-1.179695e-03f,
+	8.217692e-04f,
+	-5.456209e-04f,
+	3.615618e-04f,
+	-2.170801e-04f,
+	1.334548e-04f,
+	-6.425381e-05f,
+	3.504753e-05f,
+	-3.218651e-06f,
+
+	2.342058e-06f,
+	-2.662436e-05f,
+	3.812385e-05f,
+	-7.453591e-05f,
+	1.035688e-04f,
+	-1.622199e-04f,
+	2.176257e-04f,
+	-3.072420e-04f,
+	4.013866e-04f,
+	-5.468592e-04f,
+	7.376259e-04f,
+	-1.080855e-03f,
+	1.741765e-03f,
+	-3.423144e-03f,
+	9.267565e-03f,
+	-5.446118e-02f,
+	7.427472e-02f,
+	-1.566327e-02f,
+	7.023573e-03f,
+	-4.076838e-03f,
+	2.674997e-03f,
+	-1.842380e-03f,
+	1.309514e-03f,
+	-9.189844e-04f,
+	6.493926e-04f,
+	-4.355907e-04f,
+	2.946854e-04f,
+	-1.789331e-04f,
+	1.136065e-04f,
+	-5.543232e-05f,
+	3.218651e-05f,
+	-2.861023e-06f,
+
+	2.612450e-06f,
+	-2.935213e-05f,
+	4.670812e-05f,
+	-9.395158e-05f,
+	1.410798e-04f,
+	-2.281539e-04f,
+	3.262317e-04f,
+	-4.777306e-04f,
+	6.594124e-04f,
+	-9.270375e-04f,
+	1.288463e-03f,
+	-1.875603e-03f,
+	2.905672e-03f,
+	-5.216585e-03f,
+	1.244759e-02f,
+	-6.421193e-02f,
+	6.421196e-02f,
+	-1.244760e-02f,
+	5.216599e-03f,
+	-2.905607e-03f,
+	1.875639e-03f,
+	-1.288414e-03f,
+	9.270906e-04f,
+	-6.593466e-04f,
+	4.777908e-04f,
+	-3.261566e-04f,
+	2.281666e-04f,
+	-1.410246e-04f,
+	9.399652e-05f,
+	-4.673004e-05f,
+	2.938509e-05f,
+	-2.622604e-06f,
+
+	2.900623e-06f,
+	-3.214199e-05f,
+	5.541828e-05f,
+	-1.135870e-04f,
+	1.789462e-04f,
+	-2.946334e-04f,
+	4.356419e-04f,
+	-6.493696e-04f,
+	9.190518e-04f,
+	-1.309462e-03f,
+	1.842458e-03f,
+	-2.674958e-03f,
+	4.076854e-03f,
+	-7.023519e-03f,
+	1.566329e-02f,
+	-7.427467e-02f,
+	5.446124e-02f,
+	-9.267449e-03f,
+	3.423214e-03f,
+	-1.741767e-03f,
+	1.080871e-03f,
+	-7.375479e-04f,
+	5.468726e-04f,
+	-4.013777e-04f,
+	3.072619e-04f,
+	-2.175570e-04f,
+	1.622438e-04f,
+	-1.035929e-04f,
+	7.456541e-05f,
+	-3.814697e-05f,
+	2.664328e-05f,
+	-2.264977e-06f,
+
+	3.206425e-06f,
+	-3.498790e-05f,
+	6.423426e-05f,
+	-1.333962e-04f,
+	2.170785e-04f,
+	-3.615002e-04f,
+	5.455953e-04f,
+	-8.217490e-04f,
+	1.179684e-03f,
+	-1.693218e-03f,
+	2.398288e-03f,
+	-3.477011e-03f,
+	5.252528e-03f,
+	-8.839717e-03f,
+	1.890755e-02f,
+	-8.464476e-02f,
+	4.502666e-02f,
+	-6.130099e-03f,
+	1.647353e-03f,
+	-5.878210e-04f,
+	2.925992e-04f,
+	-1.912117e-04f,
+	1.698732e-04f,
+	-1.455545e-04f,
+	1.383424e-04f,
+	-1.100302e-04f,
+	9.703636e-05f,
+	-6.651878e-05f,
+	5.543232e-05f,
+	-2.968311e-05f,
+	2.402067e-05f,
+	-2.026558e-06f,
+
+	3.529573e-06f,
+	-3.788336e-05f,
+	7.313511e-05f,
+	-1.533316e-04f,
+	2.553847e-04f,
+	-4.285929e-04f,
+	6.558261e-04f,
+	-9.944516e-04f,
+	1.440677e-03f,
+	-2.077376e-03f,
+	2.954608e-03f,
+	-4.279828e-03f,
+	6.429872e-03f,
+	-1.066087e-02f,
+	2.217305e-02f,
+	-9.531708e-02f,
+	3.591222e-02f,
+	-3.041744e-03f,
+	-1.068115e-04f,
+	5.534291e-04f,
+	-4.873276e-04f,
+	3.494024e-04f,
+	-2.031326e-04f,
+	1.074076e-04f,
+	-2.861023e-05f,
+	-3.814697e-06f,
+	3.266335e-05f,
+	-2.992153e-05f,
+	3.659725e-05f,
+	-2.133846e-05f,
+	2.139807e-05f,
+	-1.788139e-06f,
+
+	3.869653e-06f,
+	-4.082146e-05f,
+	8.209904e-05f,
+	-1.733442e-04f,
+	2.937707e-04f,
+	-4.957465e-04f,
+	7.660633e-04f,
+	-1.167053e-03f,
+	1.701391e-03f,
+	-2.460995e-03f,
+	3.510056e-03f,
+	-5.081446e-03f,
+	7.606018e-03f,
+	-1.248258e-02f,
+	2.545225e-02f,
+	-1.062861e-01f,
+	2.712101e-02f,
+	-8.940697e-06f,
+	-1.835346e-03f,
+	1.679361e-03f,
+	-1.257181e-03f,
+	8.831024e-04f,
+	-5.712509e-04f,
+	3.570318e-04f,
+	-1.933575e-04f,
+	1.009107e-04f,
+	-3.075600e-05f,
+	5.960464e-06f,
+	1.806021e-05f,
+	-1.323223e-05f,
+	1.889467e-05f,
+	-1.549721e-06f,
+
+	4.226101e-06f,
+	-4.379483e-05f,
+	9.110347e-05f,
+	-1.933837e-04f,
+	3.321405e-04f,
+	-5.627935e-04f,
+	8.760325e-04f,
+	-1.339125e-03f,
+	1.961179e-03f,
+	-2.843125e-03f,
+	4.063257e-03f,
+	-5.879886e-03f,
+	8.778068e-03f,
+	-1.430039e-02f,
+	2.873738e-02f,
+	-1.175460e-01f,
+	1.865613e-02f,
+	2.962232e-03f,
+	-3.534675e-03f,
+	2.787530e-03f,
+	-2.015114e-03f,
+	1.408517e-03f,
+	-9.336472e-04f,
+	6.026626e-04f,
+	-3.552437e-04f,
+	2.037883e-04f,
+	-9.298325e-05f,
+	4.124641e-05f,
+	0.000000e+00f,
+	-5.364418e-06f,
+	1.645088e-05f,
+	-1.430511e-06f,
+
+	4.598206e-06f,
+	-4.679573e-05f,
+	1.001251e-04f,
+	-2.133988e-04f,
+	3.703961e-04f,
+	-6.295636e-04f,
+	9.854554e-04f,
+	-1.510232e-03f,
+	2.219388e-03f,
+	-3.222806e-03f,
+	4.612829e-03f,
+	-6.673152e-03f,
+	9.943098e-03f,
+	-1.610978e-02f,
+	3.202050e-02f,
+	-1.290903e-01f,
+	1.051992e-02f,
+	5.865872e-03f,
+	-5.200744e-03f,
+	3.875315e-03f,
+	-2.759576e-03f,
+	1.924634e-03f,
+	-1.289487e-03f,
+	8.437634e-04f,
+	-5.141497e-04f,
+	3.046989e-04f,
+	-1.540184e-04f,
+	7.575750e-05f,
+	-1.776218e-05f,
+	2.264977e-06f,
+	1.412630e-05f,
+	-1.192093e-06f,
+
+	4.985100e-06f,
+	-4.981598e-05f,
+	1.091399e-04f,
+	-2.333370e-04f,
+	4.084383e-04f,
+	-6.958846e-04f,
+	1.094051e-03f,
+	-1.679939e-03f,
+	2.475360e-03f,
+	-3.599075e-03f,
+	5.157377e-03f,
+	-7.459238e-03f,
+	1.109816e-02f,
+	-1.790618e-02f,
+	3.529349e-02f,
+	-1.409123e-01f,
+	2.714515e-03f,
+	8.696496e-03f,
+	-6.830335e-03f,
+	4.940510e-03f,
+	-3.488779e-03f,
+	2.430141e-03f,
+	-1.638055e-03f,
+	1.079798e-03f,
+	-6.697178e-04f,
+	4.033446e-04f,
+	-2.136230e-04f,
+	1.093745e-04f,
+	-3.492832e-05f,
+	9.775162e-06f,
+	1.186132e-05f,
+	-1.072884e-06f,
+
+	5.385753e-06f,
+	-5.284703e-05f,
+	1.181233e-04f,
+	-2.531448e-04f,
+	4.461663e-04f,
+	-7.615827e-04f,
+	1.201538e-03f,
+	-1.847806e-03f,
+	2.728437e-03f,
+	-3.970966e-03f,
+	5.695507e-03f,
+	-8.236132e-03f,
+	1.224030e-02f,
+	-1.968499e-02f,
+	3.854803e-02f,
+	-1.530049e-01f,
+	-4.758716e-03f,
+	1.144868e-02f,
+	-8.419752e-03f,
+	5.980730e-03f,
+	-4.201174e-03f,
+	2.924025e-03f,
+	-1.978517e-03f,
+	1.310289e-03f,
+	-8.214712e-04f,
+	4.996061e-04f,
+	-2.716780e-04f,
+	1.421571e-04f,
+	-5.161762e-05f,
+	1.698732e-05f,
+	9.715557e-06f,
+	-9.536743e-07f,
+
+	5.798986e-06f,
+	-5.587997e-05f,
+	1.270499e-04f,
+	-2.727681e-04f,
+	4.834786e-04f,
+	-8.264827e-04f,
+	1.307630e-03f,
+	-2.013391e-03f,
+	2.977956e-03f,
+	-4.337511e-03f,
+	6.225824e-03f,
+	-9.001819e-03f,
+	1.336655e-02f,
+	-2.144156e-02f,
+	4.177567e-02f,
+	-1.653605e-01f,
+	-1.189840e-02f,
+	1.411766e-02f,
+	-9.966135e-03f,
+	6.993830e-03f,
+	-4.895210e-03f,
+	3.405213e-03f,
+	-2.310157e-03f,
+	1.534700e-03f,
+	-9.691715e-04f,
+	5.931854e-04f,
+	-3.280640e-04f,
+	1.739264e-04f,
+	-6.783009e-05f,
+	2.396107e-05f,
+	7.629395e-06f,
+	-7.152557e-07f,
+
+	6.223451e-06f,
+	-5.890552e-05f,
+	1.358940e-04f,
+	-2.921517e-04f,
+	5.202725e-04f,
+	-8.904086e-04f,
+	1.412044e-03f,
+	-2.176254e-03f,
+	3.223258e-03f,
+	-4.697745e-03f,
+	6.746934e-03f,
+	-9.754293e-03f,
+	1.447395e-02f,
+	-2.317124e-02f,
+	4.496780e-02f,
+	-1.779712e-01f,
+	-1.870406e-02f,
+	1.669848e-02f,
+	-1.146603e-02f,
+	7.977545e-03f,
+	-5.569339e-03f,
+	3.872633e-03f,
+	-2.632260e-03f,
+	1.752615e-03f,
+	-1.112461e-03f,
+	6.839037e-04f,
+	-3.827810e-04f,
+	2.046824e-04f,
+	-8.356571e-05f,
+	3.063679e-05f,
+	5.722046e-06f,
+	-5.960464e-07f,
+
+	6.657637e-06f,
+	-6.191406e-05f,
+	1.446294e-04f,
+	-3.112403e-04f,
+	5.564451e-04f,
+	-9.531841e-04f,
+	1.514495e-03f,
+	-2.335955e-03f,
+	3.463684e-03f,
+	-5.050707e-03f,
+	7.257451e-03f,
+	-1.049155e-02f,
+	1.555954e-02f,
+	-2.486936e-02f,
+	4.811568e-02f,
+	-1.908288e-01f,
+	-2.517533e-02f,
+	1.918679e-02f,
+	-1.291656e-02f,
+	8.929968e-03f,
+	-6.222367e-03f,
+	4.325390e-03f,
+	-2.944112e-03f,
+	1.963556e-03f,
+	-1.251101e-03f,
+	7.716417e-04f,
+	-4.354715e-04f,
+	2.343655e-04f,
+	-9.858608e-05f,
+	3.707409e-05f,
+	3.814697e-06f,
+	-4.768372e-07f,
+
+	7.099864e-06f,
+	-6.489567e-05f,
+	1.532294e-04f,
+	-3.299779e-04f,
+	5.918930e-04f,
+	-1.014633e-03f,
+	1.614698e-03f,
+	-2.492056e-03f,
+	3.698581e-03f,
+	-5.395443e-03f,
+	7.756001e-03f,
+	-1.121161e-02f,
+	1.662038e-02f,
+	-2.653126e-02f,
+	5.121044e-02f,
+	-2.039246e-01f,
+	-3.131258e-02f,
+	2.157855e-02f,
+	-1.431501e-02f,
+	9.849131e-03f,
+	-6.852627e-03f,
+	4.762471e-03f,
+	-3.245115e-03f,
+	2.167046e-03f,
+	-1.384854e-03f,
+	8.562207e-04f,
+	-4.863739e-04f,
+	2.629161e-04f,
+	-1.130104e-04f,
+	4.321337e-05f,
+	2.026558e-06f,
+	-4.768372e-07f,
+
+	7.548293e-06f,
+	-6.784013e-05f,
+	1.616669e-04f,
+	-3.483084e-04f,
+	6.265126e-04f,
+	-1.074579e-03f,
+	1.712372e-03f,
+	-2.644122e-03f,
+	3.927300e-03f,
+	-5.731007e-03f,
+	8.241222e-03f,
+	-1.191249e-02f,
+	1.765356e-02f,
+	-2.815228e-02f,
+	5.424313e-02f,
+	-2.172496e-01f,
+	-3.711629e-02f,
+	2.386987e-02f,
+	-1.565862e-02f,
+	1.073313e-02f,
+	-7.459283e-03f,
+	5.183041e-03f,
+	-3.534794e-03f,
+	2.362788e-03f,
+	-1.513362e-03f,
+	9.374619e-04f,
+	-5.351305e-04f,
+	2.902150e-04f,
+	-1.268387e-04f,
+	4.911423e-05f,
+	3.576279e-07f,
+	-3.576279e-07f,
+
+	8.000920e-06f,
+	-7.073695e-05f,
+	1.699148e-04f,
+	-3.661753e-04f,
+	6.602011e-04f,
+	-1.132848e-03f,
+	1.807236e-03f,
+	-2.791722e-03f,
+	4.149199e-03f,
+	-6.056465e-03f,
+	8.711768e-03f,
+	-1.259226e-02f,
+	1.865618e-02f,
+	-2.972778e-02f,
+	5.720466e-02f,
+	-2.307947e-01f,
+	-4.258764e-02f,
+	2.605718e-02f,
+	-1.694500e-02f,
+	1.158041e-02f,
+	-8.040786e-03f,
+	5.586267e-03f,
+	-3.812313e-03f,
+	2.550304e-03f,
+	-1.636505e-03f,
+	1.015186e-03f,
+	-5.818605e-04f,
+	3.163815e-04f,
+	-1.400709e-04f,
+	5.465746e-05f,
+	-1.192093e-06f,
+	-2.384186e-07f,
+
+	8.455577e-06f,
+	-7.357541e-05f,
+	1.779456e-04f,
+	-3.835224e-04f,
+	6.928555e-04f,
+	-1.189267e-03f,
+	1.899013e-03f,
+	-2.934432e-03f,
+	4.363648e-03f,
+	-6.370898e-03f,
+	9.166314e-03f,
+	-1.324901e-02f,
+	1.962538e-02f,
+	-3.125319e-02f,
+	6.008592e-02f,
+	-2.445500e-01f,
+	-4.772818e-02f,
+	2.813739e-02f,
+	-1.817191e-02f,
+	1.238930e-02f,
+	-8.596182e-03f,
+	5.971372e-03f,
+	-4.077435e-03f,
+	2.729297e-03f,
+	-1.753926e-03f,
+	1.089275e-03f,
+	-6.262064e-04f,
+	3.411770e-04f,
+	-1.525879e-04f,
+	5.990267e-05f,
+	-2.622604e-06f,
+	-2.384186e-07f,
+
+	8.909934e-06f,
+	-7.634455e-05f,
+	1.857316e-04f,
+	-4.002935e-04f,
+	7.243743e-04f,
+	-1.243664e-03f,
+	1.987429e-03f,
+	-3.071832e-03f,
+	4.570025e-03f,
+	-6.673403e-03f,
+	9.603563e-03f,
+	-1.388084e-02f,
+	2.055838e-02f,
+	-3.272393e-02f,
+	6.287770e-02f,
+	-2.585058e-01f,
+	-5.253971e-02f,
+	3.010756e-02f,
+	-1.933706e-02f,
+	1.315832e-02f,
+	-9.124279e-03f,
+	6.337583e-03f,
+	-4.329443e-03f,
+	2.899408e-03f,
+	-1.865506e-03f,
+	1.159608e-03f,
+	-6.684065e-04f,
+	3.647208e-04f,
+	-1.643896e-04f,
+	6.484985e-05f,
+	-4.053116e-06f,
+	-1.192093e-07f,
+
+	9.361510e-06f,
+	-7.903325e-05f,
+	1.932452e-04f,
+	-4.164328e-04f,
+	7.546564e-04f,
+	-1.295869e-03f,
+	2.072216e-03f,
+	-3.203512e-03f,
+	4.767720e-03f,
+	-6.963094e-03f,
+	1.002224e-02f,
+	-1.448592e-02f,
+	2.145240e-02f,
+	-3.413552e-02f,
+	6.557074e-02f,
+	-2.726517e-01f,
+	-5.702460e-02f,
+	3.196490e-02f,
+	-2.043855e-02f,
+	1.388603e-02f,
+	-9.624243e-03f,
+	6.684244e-03f,
+	-4.567862e-03f,
+	3.060341e-03f,
+	-1.970887e-03f,
+	1.226068e-03f,
+	-7.081032e-04f,
+	3.868937e-04f,
+	-1.754761e-04f,
+	6.949902e-05f,
+	-5.364418e-06f,
+	-1.192093e-07f,
+
+	9.807670e-06f,
+	-8.163023e-05f,
+	2.004588e-04f,
+	-4.318848e-04f,
+	7.836026e-04f,
+	-1.345717e-03f,
+	2.153111e-03f,
+	-3.329071e-03f,
+	4.956138e-03f,
+	-7.239109e-03f,
+	1.042110e-02f,
+	-1.506244e-02f,
+	2.230475e-02f,
+	-3.548354e-02f,
+	6.815578e-02f,
+	-2.869773e-01f,
+	-6.118572e-02f,
+	3.370738e-02f,
+	-2.147460e-02f,
+	1.457119e-02f,
+	-1.009512e-02f,
+	7.010698e-03f,
+	-4.792452e-03f,
+	3.211796e-03f,
+	-2.070189e-03f,
+	1.288593e-03f,
+	-7.455349e-04f,
+	4.076958e-04f,
+	-1.859665e-04f,
+	7.385015e-05f,
+	-6.437302e-06f,
+	-1.192093e-07f,
+
+	1.024564e-05f,
+	-8.412409e-05f,
+	2.073448e-04f,
+	-4.465950e-04f,
+	8.111151e-04f,
+	-1.393045e-03f,
+	2.229854e-03f,
+	-3.448114e-03f,
+	5.134701e-03f,
+	-7.500608e-03f,
+	1.079894e-02f,
+	-1.560867e-02f,
+	2.311279e-02f,
+	-3.676362e-02f,
+	7.062352e-02f,
+	-3.014719e-01f,
+	-6.502593e-02f,
+	3.533292e-02f,
+	-2.244365e-02f,
+	1.521266e-02f,
+	-1.053619e-02f,
+	7.316470e-03f,
+	-5.002737e-03f,
+	3.353596e-03f,
+	-2.162933e-03f,
+	1.347005e-03f,
+	-7.803440e-04f,
+	4.271269e-04f,
+	-1.956224e-04f,
+	7.784367e-05f,
+	-7.510185e-06f,
+	0.000000e+00f,
+
+	1.067249e-05f,
+	-8.650334e-05f,
+	2.138759e-04f,
+	-4.605093e-04f,
+	8.370978e-04f,
+	-1.437694e-03f,
+	2.302196e-03f,
+	-3.560263e-03f,
+	5.302846e-03f,
+	-7.746777e-03f,
+	1.115460e-02f,
+	-1.612289e-02f,
+	2.387397e-02f,
+	-3.797151e-02f,
+	7.296465e-02f,
+	-3.161243e-01f,
+	-6.854904e-02f,
+	3.683978e-02f,
+	-2.334440e-02f,
+	1.580942e-02f,
+	-1.094651e-02f,
+	7.601023e-03f,
+	-5.198359e-03f,
+	3.485382e-03f,
+	-2.249241e-03f,
+	1.401246e-03f,
+	-8.127689e-04f,
+	4.450679e-04f,
+	-2.045631e-04f,
+	8.153915e-05f,
+	-8.583069e-06f,
+	0.000000e+00f,
+
+	1.108518e-05f,
+	-8.875640e-05f,
+	2.200251e-04f,
+	-4.735749e-04f,
+	8.614572e-04f,
+	-1.479508e-03f,
+	2.369893e-03f,
+	-3.665147e-03f,
+	5.460029e-03f,
+	-7.976831e-03f,
+	1.148693e-02f,
+	-1.660348e-02f,
+	2.458582e-02f,
+	-3.910305e-02f,
+	7.516990e-02f,
+	-3.309234e-01f,
+	-7.175899e-02f,
+	3.822649e-02f,
+	-2.417552e-02f,
+	1.636058e-02f,
+	-1.132572e-02f,
+	7.863879e-03f,
+	-5.379081e-03f,
+	3.607094e-03f,
+	-2.328873e-03f,
+	1.451254e-03f,
+	-8.425713e-04f,
+	4.616380e-04f,
+	-2.127886e-04f,
+	8.493662e-05f,
+	-9.417534e-06f,
+	0.000000e+00f,
+
+	1.148054e-05f,
+	-9.087173e-05f,
+	2.257657e-04f,
+	-4.857398e-04f,
+	8.841021e-04f,
+	-1.518338e-03f,
+	2.432708e-03f,
+	-3.762412e-03f,
+	5.605729e-03f,
+	-8.190016e-03f,
+	1.179486e-02f,
+	-1.704885e-02f,
+	2.524593e-02f,
+	-4.015419e-02f,
+	7.723001e-02f,
+	-3.458578e-01f,
+	-7.465994e-02f,
+	3.949219e-02f,
+	-2.493584e-02f,
+	1.686531e-02f,
+	-1.167297e-02f,
+	8.104682e-03f,
+	-5.544543e-03f,
+	3.718555e-03f,
+	-2.401710e-03f,
+	1.497030e-03f,
+	-8.698702e-04f,
+	4.767179e-04f,
+	-2.202988e-04f,
+	8.797646e-05f,
+	-1.025200e-05f,
+	0.000000e+00f,
+
+	1.185527e-05f,
+	-9.283778e-05f,
+	2.310713e-04f,
+	-4.969536e-04f,
+	9.049440e-04f,
+	-1.554039e-03f,
+	2.490417e-03f,
+	-3.851715e-03f,
+	5.739445e-03f,
+	-8.385612e-03f,
+	1.207736e-02f,
+	-1.745750e-02f,
+	2.585200e-02f,
+	-4.112101e-02f,
+	7.913579e-02f,
+	-3.609158e-01f,
+	-7.725644e-02f,
+	4.063594e-02f,
+	-2.562475e-02f,
+	1.732290e-02f,
+	-1.198804e-02f,
+	8.323073e-03f,
+	-5.694628e-03f,
+	3.819585e-03f,
+	-2.467632e-03f,
+	1.538396e-03f,
+	-8.944273e-04f,
+	4.903674e-04f,
+	-2.270937e-04f,
+	9.071827e-05f,
+	-1.096725e-05f,
+	0.000000e+00f,
+
+	1.220597e-05f,
+	-9.464304e-05f,
+	2.359162e-04f,
+	-5.071670e-04f,
+	9.238975e-04f,
+	-1.586471e-03f,
+	2.542802e-03f,
+	-3.932732e-03f,
+	5.860699e-03f,
+	-8.562927e-03f,
+	1.233342e-02f,
+	-1.782799e-02f,
+	2.640185e-02f,
+	-4.199971e-02f,
+	8.087808e-02f,
+	-3.760855e-01f,
+	-7.955384e-02f,
+	4.165727e-02f,
+	-2.624130e-02f,
+	1.773292e-02f,
+	-1.227033e-02f,
+	8.518755e-03f,
+	-5.828977e-03f,
+	3.910005e-03f,
+	-2.526760e-03f,
+	1.575470e-03f,
+	-9.164810e-04f,
+	5.025268e-04f,
+	-2.330542e-04f,
+	9.316206e-05f,
+	-1.156330e-05f,
+	0.000000e+00f,
+
+	1.252917e-05f,
+	-9.627614e-05f,
+	2.402752e-04f,
+	-5.163327e-04f,
+	9.408806e-04f,
+	-1.615502e-03f,
+	2.589655e-03f,
+	-4.005152e-03f,
+	5.969040e-03f,
+	-8.721316e-03f,
+	1.256214e-02f,
+	-1.815895e-02f,
+	2.689337e-02f,
+	-4.278665e-02f,
+	8.244782e-02f,
+	-3.913549e-01f,
+	-8.155727e-02f,
+	4.255605e-02f,
+	-2.678525e-02f,
+	1.809490e-02f,
+	-1.251960e-02f,
+	8.691549e-03f,
+	-5.947709e-03f,
+	3.989875e-03f,
+	-2.578855e-03f,
+	1.608074e-03f,
+	-9.359121e-04f,
+	5.131960e-04f,
+	-2.382994e-04f,
+	9.530783e-05f,
+	-1.204014e-05f,
+	0.000000e+00f,
+
+	1.282129e-05f,
+	-9.772580e-05f,
+	2.441240e-04f,
+	-5.244049e-04f,
+	9.558149e-04f,
+	-1.641003e-03f,
+	2.630782e-03f,
+	-4.068684e-03f,
+	6.064043e-03f,
+	-8.860164e-03f,
+	1.276262e-02f,
+	-1.844912e-02f,
+	2.732460e-02f,
+	-4.347834e-02f,
+	8.383604e-02f,
+	-4.067120e-01f,
+	-8.327246e-02f,
+	4.333222e-02f,
+	-2.725601e-02f,
+	1.840854e-02f,
+	-1.273561e-02f,
+	8.841336e-03f,
+	-6.050467e-03f,
+	4.059017e-03f,
+	-2.623916e-03f,
+	1.636326e-03f,
+	-9.526014e-04f,
+	5.224347e-04f,
+	-2.429485e-04f,
+	9.709597e-05f,
+	-1.251698e-05f,
+	0.000000e+00f,
+
+	1.307869e-05f,
+	-9.898093e-05f,
+	2.474388e-04f,
+	-5.313397e-04f,
+	9.686257e-04f,
+	-1.662856e-03f,
+	2.665998e-03f,
+	-4.123054e-03f,
+	6.145310e-03f,
+	-8.978905e-03f,
+	1.293405e-02f,
+	-1.869729e-02f,
+	2.769367e-02f,
+	-4.407144e-02f,
+	8.503391e-02f,
+	-4.221444e-01f,
+	-8.470547e-02f,
+	4.398620e-02f,
+	-2.765357e-02f,
+	1.867360e-02f,
+	-1.291823e-02f,
+	8.967936e-03f,
+	-6.137371e-03f,
+	4.117370e-03f,
+	-2.661943e-03f,
+	1.660168e-03f,
+	-9.667873e-04f,
+	5.301833e-04f,
+	-2.467632e-04f,
+	9.864569e-05f,
+	-1.287460e-05f,
+	0.000000e+00f,
+
+	1.329766e-05f,
+	-1.000307e-04f,
+	2.501969e-04f,
+	-5.370954e-04f,
+	9.792425e-04f,
+	-1.680948e-03f,
+	2.695131e-03f,
+	-4.168006e-03f,
+	6.212472e-03f,
+	-9.077011e-03f,
+	1.307567e-02f,
+	-1.890235e-02f,
+	2.799885e-02f,
+	-4.456281e-02f,
+	8.603267e-02f,
+	-4.376397e-01f,
+	-8.586252e-02f,
+	4.451865e-02f,
+	-2.797806e-02f,
+	1.889008e-02f,
+	-1.306748e-02f,
+	9.071350e-03f,
+	-6.208420e-03f,
+	4.165053e-03f,
+	-2.693057e-03f,
+	1.679540e-03f,
+	-9.782314e-04f,
+	5.365014e-04f,
+	-2.497435e-04f,
+	9.989738e-05f,
+	-1.323223e-05f,
+	0.000000e+00f,
+
+	1.347448e-05f,
+	-1.008644e-04f,
+	2.523763e-04f,
+	-5.416324e-04f,
+	9.875991e-04f,
+	-1.695174e-03f,
+	2.718022e-03f,
+	-4.203306e-03f,
+	6.265192e-03f,
+	-9.153998e-03f,
+	1.318681e-02f,
+	-1.906329e-02f,
+	2.823854e-02f,
+	-4.494947e-02f,
+	8.682375e-02f,
+	-4.531856e-01f,
+	-8.675027e-02f,
+	4.493034e-02f,
+	-2.822959e-02f,
+	1.905799e-02f,
+	-1.318324e-02f,
+	9.151578e-03f,
+	-6.263494e-03f,
+	4.202068e-03f,
+	-2.717137e-03f,
+	1.694620e-03f,
+	-9.871721e-04f,
+	5.413890e-04f,
+	-2.521276e-04f,
+	1.007915e-04f,
+	-1.335144e-05f,
+	0.000000e+00f,
+
+	1.360537e-05f,
+	-1.014719e-04f,
+	2.539564e-04f,
+	-5.449138e-04f,
+	9.936342e-04f,
+	-1.705439e-03f,
+	2.734525e-03f,
+	-4.228741e-03f,
+	6.303162e-03f,
+	-9.209435e-03f,
+	1.326682e-02f,
+	-1.917919e-02f,
+	2.841127e-02f,
+	-4.522866e-02f,
+	8.739872e-02f,
+	-4.687693e-01f,
+	-8.737552e-02f,
+	4.522264e-02f,
+	-2.840841e-02f,
+	1.917756e-02f,
+	-1.326561e-02f,
+	9.208679e-03f,
+	-6.302595e-03f,
+	4.228354e-03f,
+	-2.734184e-03f,
+	1.705289e-03f,
+	-9.934902e-04f,
+	5.448461e-04f,
+	-2.539158e-04f,
+	1.015067e-04f,
+	-1.358986e-05f,
+	0.000000e+00f,
+
+	1.368655e-05f,
+	-1.018430e-04f,
+	2.549172e-04f,
+	-5.469047e-04f,
+	9.972911e-04f,
+	-1.711652e-03f,
+	2.744508e-03f,
+	-4.244120e-03f,
+	6.326111e-03f,
+	-9.242930e-03f,
+	1.331517e-02f,
+	-1.924923e-02f,
+	2.851573e-02f,
+	-4.539782e-02f,
+	8.774933e-02f,
+	-4.843783e-01f,
+	-8.774543e-02f,
+	4.539680e-02f,
+	-2.851522e-02f,
+	1.924896e-02f,
+	-1.331496e-02f,
+	9.242833e-03f,
+	-6.326079e-03f,
+	4.244089e-03f,
+	-2.744436e-03f,
+	1.711667e-03f,
+	-9.971857e-04f,
+	5.469322e-04f,
+	-2.548695e-04f,
+	1.018643e-04f,
+	-1.370907e-05f,
+	0.000000e+00f,
+
+	1.371423e-05f,
+	-1.019683e-04f,
+	2.552405e-04f,
+	-5.475735e-04f,
+	9.985183e-04f,
+	-1.713736e-03f,
+	2.747855e-03f,
+	-4.249273e-03f,
+	6.333798e-03f,
+	-9.254147e-03f,
+	1.333135e-02f,
+	-1.927269e-02f,
+	2.855073e-02f,
+	-4.545458e-02f,
+	8.786753e-02f,
+	-5.000000e-01f,
+	-8.786750e-02f,
+	4.545456e-02f,
+	-2.855074e-02f,
+	1.927269e-02f,
+	-1.333129e-02f,
+	9.254217e-03f,
+	-6.333828e-03f,
+	4.249275e-03f,
+	-2.747893e-03f,
+	1.713812e-03f,
+	-9.984970e-04f,
+	5.475879e-04f,
+	-2.552271e-04f,
+	1.019835e-04f,
+	-1.370907e-05f,
+	0.000000e+00f
+};
+
+// blepd2 table: 2080 entries
+const float blepd2[] = {
+	1.619670e-18f,
+	2.157152e-05f,
+	1.169118e-04f,
+	-2.884141e-04f,
+	-1.016751e-03f,
+	6.628190e-04f,
+	3.188456e-03f,
+	-1.572480e-03f,
+	-8.173740e-03f,
+	3.007648e-03f,
+	1.782132e-02f,
+	-5.940095e-03f,
+	-3.696484e-02f,
+	1.362984e-02f,
+	8.311049e-02f,
+	-6.573872e-02f,
+	5.000000e-01f,
+	6.573874e-02f,
+	-8.311057e-02f,
+	-1.362991e-02f,
+	3.696483e-02f,
+	5.940139e-03f,
+	-1.782131e-02f,
+	-3.007650e-03f,
+	8.173704e-03f,
+	1.572430e-03f,
+	-3.188491e-03f,
+	-6.629229e-04f,
+	1.016736e-03f,
+	2.884269e-04f,
+	-1.169443e-04f,
+	-2.157688e-05f,
+
+	3.185738e-12f,
+	2.275689e-05f,
+	1.168470e-04f,
+	-3.018404e-04f,
+	-1.016410e-03f,
+	7.134899e-04f,
+	3.187397e-03f,
+	-1.710286e-03f,
+	-8.171130e-03f,
+	3.323744e-03f,
+	1.781564e-02f,
+	-6.605500e-03f,
+	-3.695297e-02f,
+	1.507066e-02f,
+	8.308160e-02f,
+	-7.067324e-02f,
+	4.921885e-01f,
+	6.088310e-02f,
+	-8.308208e-02f,
+	-1.219857e-02f,
+	3.695309e-02f,
+	5.278468e-03f,
+	-1.781571e-02f,
+	-2.693415e-03f,
+	8.171141e-03f,
+	1.435637e-03f,
+	-3.187418e-03f,
+	-6.126165e-04f,
+	1.016438e-03f,
+	2.751350e-04f,
+	-1.168251e-04f,
+	-2.038479e-05f,
+
+	3.221653e-11f,
+	2.398035e-05f,
+	1.166501e-04f,
+	-3.154284e-04f,
+	-1.015379e-03f,
+	7.645761e-04f,
+	3.184207e-03f,
+	-1.848979e-03f,
+	-8.163267e-03f,
+	3.641563e-03f,
+	1.779855e-02f,
+	-7.274317e-03f,
+	-3.691722e-02f,
+	1.652035e-02f,
+	8.299442e-02f,
+	-7.568614e-02f,
+	4.843785e-01f,
+	5.610687e-02f,
+	-8.299744e-02f,
+	-1.077783e-02f,
+	3.691804e-02f,
+	4.621029e-03f,
+	-1.779890e-02f,
+	-2.381444e-03f,
+	8.163452e-03f,
+	1.299858e-03f,
+	-3.184319e-03f,
+	-5.629063e-04f,
+	1.015425e-03f,
+	2.620816e-04f,
+	-1.167059e-04f,
+	-1.931190e-05f,
+
+	1.454588e-10f,
+	2.524179e-05f,
+	1.163167e-04f,
+	-3.291712e-04f,
+	-1.013645e-03f,
+	8.160491e-04f,
+	3.178852e-03f,
+	-1.988479e-03f,
+	-8.150087e-03f,
+	3.960921e-03f,
+	1.776993e-02f,
+	-7.946159e-03f,
+	-3.685733e-02f,
+	1.797809e-02f,
+	8.284799e-02f,
+	-8.077685e-02f,
+	4.765718e-01f,
+	5.141056e-02f,
+	-8.285761e-02f,
+	-9.368300e-03f,
+	3.685999e-02f,
+	3.968120e-03f,
+	-1.777112e-02f,
+	-2.071500e-03f,
+	8.150697e-03f,
+	1.165152e-03f,
+	-3.179193e-03f,
+	-5.136728e-04f,
+	1.013756e-03f,
+	2.492070e-04f,
+	-1.163483e-04f,
+	-1.823902e-05f,
+
+	4.397739e-10f,
+	2.654103e-05f,
+	1.158424e-04f,
+	-3.430615e-04f,
+	-1.011195e-03f,
+	8.678794e-04f,
+	3.171303e-03f,
+	-2.128706e-03f,
+	-8.131531e-03f,
+	4.281629e-03f,
+	1.772966e-02f,
+	-8.620631e-03f,
+	-3.677304e-02f,
+	1.944310e-02f,
+	8.264130e-02f,
+	-8.594477e-02f,
+	4.687699e-01f,
+	4.679453e-02f,
+	-8.266354e-02f,
+	-7.970572e-03f,
+	3.677922e-02f,
+	3.320098e-03f,
+	-1.773250e-02f,
+	-1.764059e-03f,
+	8.132994e-03f,
+	1.031697e-03f,
+	-3.172040e-03f,
+	-4.649162e-04f,
+	1.011491e-03f,
+	2.364516e-04f,
+	-1.159906e-04f,
+	-1.716614e-05f,
+
+	1.051358e-09f,
+	2.787780e-05f,
+	1.152229e-04f,
+	-3.570916e-04f,
+	-1.008016e-03f,
+	9.200370e-04f,
+	3.161532e-03f,
+	-2.269576e-03f,
+	-8.107541e-03f,
+	4.603496e-03f,
+	1.767763e-02f,
+	-9.297334e-03f,
+	-3.666413e-02f,
+	2.091452e-02f,
+	8.237340e-02f,
+	-9.118929e-02f,
+	4.609746e-01f,
+	4.225934e-02f,
+	-8.241630e-02f,
+	-6.585360e-03f,
+	3.667599e-02f,
+	2.677321e-03f,
+	-1.768315e-02f,
+	-1.459241e-03f,
+	8.110344e-03f,
+	8.994341e-04f,
+	-3.162861e-03f,
+	-4.166365e-04f,
+	1.008570e-03f,
+	2.239347e-04f,
+	-1.153946e-04f,
+	-1.621246e-05f,
+
+	2.155025e-09f,
+	2.925179e-05f,
+	1.144535e-04f,
+	-3.712537e-04f,
+	-1.004095e-03f,
+	9.724909e-04f,
+	3.149509e-03f,
+	-2.411004e-03f,
+	-8.078063e-03f,
+	4.926328e-03f,
+	1.761373e-02f,
+	-9.975861e-03f,
+	-3.653035e-02f,
+	2.239153e-02f,
+	8.204335e-02f,
+	-9.650976e-02f,
+	4.531875e-01f,
+	3.780526e-02f,
+	-8.211684e-02f,
+	-5.213618e-03f,
+	3.655076e-02f,
+	2.040148e-03f,
+	-1.762319e-02f,
+	-1.157165e-03f,
+	8.082926e-03f,
+	7.685423e-04f,
+	-3.151894e-03f,
+	-3.690720e-04f,
+	1.005113e-03f,
+	2.115965e-04f,
+	-1.147985e-04f,
+	-1.525879e-05f,
+
+	3.964459e-09f,
+	3.066257e-05f,
+	1.135301e-04f,
+	-3.855395e-04f,
+	-9.994205e-04f,
+	1.025210e-03f,
+	3.135209e-03f,
+	-2.552905e-03f,
+	-8.043045e-03f,
+	5.249927e-03f,
+	1.753788e-02f,
+	-1.065580e-02f,
+	-3.637150e-02f,
+	2.387326e-02f,
+	8.165020e-02f,
+	-1.019055e-01f,
+	4.454100e-01f,
+	3.343266e-02f,
+	-8.176649e-02f,
+	-3.855705e-03f,
+	3.640378e-02f,
+	1.408935e-03f,
+	-1.755285e-02f,
+	-8.580685e-04f,
+	8.050740e-03f,
+	6.390214e-04f,
+	-3.138900e-03f,
+	-3.219843e-04f,
+	1.001000e-03f,
+	1.994967e-04f,
+	-1.140833e-04f,
+	-1.430511e-05f,
+
+	6.731490e-09f,
+	3.210968e-05f,
+	1.124482e-04f,
+	-3.999405e-04f,
+	-9.939804e-04f,
+	1.078161e-03f,
+	3.118605e-03f,
+	-2.695189e-03f,
+	-8.002439e-03f,
+	5.574093e-03f,
+	1.744997e-02f,
+	-1.133674e-02f,
+	-3.618737e-02f,
+	2.535884e-02f,
+	8.119304e-02f,
+	-1.073758e-01f,
+	4.376439e-01f,
+	2.914184e-02f,
+	-8.136630e-02f,
+	-2.512574e-03f,
+	3.623545e-02f,
+	7.839203e-04f,
+	-1.747227e-02f,
+	-5.620718e-04f,
+	8.013904e-03f,
+	5.110502e-04f,
+	-3.124237e-03f,
+	-2.756119e-04f,
+	9.963512e-04f,
+	1.875758e-04f,
+	-1.132488e-04f,
+	-1.347065e-05f,
+
+	1.074516e-08f,
+	3.359255e-05f,
+	1.112036e-04f,
+	-4.144480e-04f,
+	-9.877633e-04f,
+	1.131311e-03f,
+	3.099674e-03f,
+	-2.837768e-03f,
+	-7.956197e-03f,
+	5.898623e-03f,
+	1.734994e-02f,
+	-1.201825e-02f,
+	-3.597778e-02f,
+	2.684739e-02f,
+	8.067096e-02f,
+	-1.129200e-01f,
+	4.298909e-01f,
+	2.493328e-02f,
+	-8.091712e-02f,
+	-1.184583e-03f,
+	3.604609e-02f,
+	1.655221e-04f,
+	-1.738179e-02f,
+	-2.691746e-04f,
+	7.972479e-03f,
+	3.845096e-04f,
+	-3.107548e-03f,
+	-2.298355e-04f,
+	9.911060e-04f,
+	1.758933e-04f,
+	-1.122952e-04f,
+	-1.263618e-05f,
+
+	1.633306e-08f,
+	3.511054e-05f,
+	1.097920e-04f,
+	-4.290529e-04f,
+	-9.807578e-04f,
+	1.184627e-03f,
+	3.078392e-03f,
+	-2.980551e-03f,
+	-7.904279e-03f,
+	6.223311e-03f,
+	1.723769e-02f,
+	-1.269991e-02f,
+	-3.574255e-02f,
+	2.833800e-02f,
+	8.008306e-02f,
+	-1.185372e-01f,
+	4.221524e-01f,
+	2.080703e-02f,
+	-8.042014e-02f,
+	1.273155e-04f,
+	3.583604e-02f,
+	-4.459620e-04f,
+	-1.728117e-02f,
+	2.026558e-05f,
+	7.926583e-03f,
+	2.595782e-04f,
+	-3.089190e-03f,
+	-1.846552e-04f,
+	9.853840e-04f,
+	1.643896e-04f,
+	-1.113415e-04f,
+	-1.180172e-05f,
+
+	2.385991e-08f,
+	3.666294e-05f,
+	1.082092e-04f,
+	-4.437457e-04f,
+	-9.729532e-04f,
+	1.238074e-03f,
+	3.054736e-03f,
+	-3.123446e-03f,
+	-7.846646e-03f,
+	6.547949e-03f,
+	1.711316e-02f,
+	-1.338128e-02f,
+	-3.548152e-02f,
+	2.982976e-02f,
+	7.942850e-02f,
+	-1.242267e-01f,
+	4.144300e-01f,
+	1.676345e-02f,
+	-7.987666e-02f,
+	1.422763e-03f,
+	3.560567e-02f,
+	-1.050234e-03f,
+	-1.717103e-02f,
+	3.061891e-04f,
+	7.876337e-03f,
+	1.363158e-04f,
+	-3.069162e-03f,
+	-1.403093e-04f,
+	9.790659e-04f,
+	1.531243e-04f,
+	-1.101494e-04f,
+	-1.096725e-05f,
+
+	3.372702e-08f,
+	3.824893e-05f,
+	1.064511e-04f,
+	-4.585169e-04f,
+	-9.643392e-04f,
+	1.291617e-03f,
+	3.028688e-03f,
+	-3.266360e-03f,
+	-7.783261e-03f,
+	6.872326e-03f,
+	1.697630e-02f,
+	-1.406193e-02f,
+	-3.519455e-02f,
+	3.132175e-02f,
+	7.870640e-02f,
+	-1.299877e-01f,
+	4.067255e-01f,
+	1.280278e-02f,
+	-7.928741e-02f,
+	2.701044e-03f,
+	3.535551e-02f,
+	-1.646996e-03f,
+	-1.705122e-02f,
+	5.884171e-04f,
+	7.821739e-03f,
+	1.466274e-05f,
+	-3.047347e-03f,
+	-9.655952e-05f,
+	9.722710e-04f,
+	1.420975e-04f,
+	-1.090765e-04f,
+	-1.025200e-05f,
+
+	4.637046e-08f,
+	3.986764e-05f,
+	1.045136e-04f,
+	-4.733566e-04f,
+	-9.549060e-04f,
+	1.345220e-03f,
+	3.000228e-03f,
+	-3.409198e-03f,
+	-7.714093e-03f,
+	7.196230e-03f,
+	1.682703e-02f,
+	-1.474141e-02f,
+	-3.488149e-02f,
+	3.281301e-02f,
+	7.791593e-02f,
+	-1.358194e-01f,
+	3.990403e-01f,
+	8.925080e-03f,
+	-7.865381e-02f,
+	3.961623e-03f,
+	3.508574e-02f,
+	-2.236009e-03f,
+	-1.692200e-02f,
+	8.668900e-04f,
+	7.762909e-03f,
+	-1.051426e-04f,
+	-3.023982e-03f,
+	-5.352497e-05f,
+	9.649396e-04f,
+	1.312494e-04f,
+	-1.077652e-04f,
+	-9.536743e-06f,
+
+	6.226129e-08f,
+	4.151809e-05f,
+	1.023926e-04f,
+	-4.882544e-04f,
+	-9.446439e-04f,
+	1.398848e-03f,
+	2.969338e-03f,
+	-3.551865e-03f,
+	-7.639111e-03f,
+	7.519444e-03f,
+	1.666532e-02f,
+	-1.541928e-02f,
+	-3.454224e-02f,
+	3.430261e-02f,
+	7.705627e-02f,
+	-1.417208e-01f,
+	3.913760e-01f,
+	5.130649e-03f,
+	-7.797694e-02f,
+	5.203903e-03f,
+	3.479683e-02f,
+	-2.816916e-03f,
+	-1.678371e-02f,
+	1.141429e-03f,
+	7.699907e-03f,
+	-2.230406e-04f,
+	-2.998948e-03f,
+	-1.120567e-05f,
+	9.571910e-04f,
+	1.206398e-04f,
+	-1.064539e-04f,
+	-8.940697e-06f,
+
+	8.190624e-08f,
+	4.319922e-05f,
+	1.000842e-04f,
+	-5.031999e-04f,
+	-9.335442e-04f,
+	1.452461e-03f,
+	2.936001e-03f,
+	-3.694262e-03f,
+	-7.558292e-03f,
+	7.841753e-03f,
+	1.649113e-02f,
+	-1.609509e-02f,
+	-3.417668e-02f,
+	3.578957e-02f,
+	7.612661e-02f,
+	-1.476911e-01f,
+	3.837343e-01f,
+	1.419544e-03f,
+	-7.725763e-02f,
+	6.427407e-03f,
+	3.448927e-02f,
+	-3.389478e-03f,
+	-1.663649e-02f,
+	1.411915e-03f,
+	7.632911e-03f,
+	-3.392696e-04f,
+	-2.972364e-03f,
+	3.039837e-05f,
+	9.489655e-04f,
+	1.103282e-04f,
+	-1.050234e-04f,
+	-8.225441e-06f,
+
+	1.058457e-07f,
+	4.490988e-05f,
+	9.758458e-05f,
+	-5.181824e-04f,
+	-9.215981e-04f,
+	1.506024e-03f,
+	2.900203e-03f,
+	-3.836291e-03f,
+	-7.471613e-03f,
+	8.162936e-03f,
+	1.630442e-02f,
+	-1.676838e-02f,
+	-3.378474e-02f,
+	3.727291e-02f,
+	7.512619e-02f,
+	-1.537294e-01f,
+	3.761167e-01f,
+	-2.208233e-03f,
+	-7.649732e-02f,
+	7.631600e-03f,
+	3.416342e-02f,
+	-3.953457e-03f,
+	-1.648045e-02f,
+	1.678169e-03f,
+	7.562041e-03f,
+	-4.534721e-04f,
+	-2.944231e-03f,
+	7.116795e-05f,
+	9.402633e-04f,
+	1.001954e-04f,
+	-1.035929e-04f,
+	-7.629395e-06f,
+
+	1.346515e-07f,
+	4.664884e-05f,
+	9.488994e-05f,
+	-5.331907e-04f,
+	-9.087975e-04f,
+	1.559498e-03f,
+	2.861931e-03f,
+	-3.977854e-03f,
+	-7.379055e-03f,
+	8.482771e-03f,
+	1.610517e-02f,
+	-1.743869e-02f,
+	-3.336633e-02f,
+	3.875165e-02f,
+	7.405424e-02f,
+	-1.598347e-01f,
+	3.685246e-01f,
+	-5.752325e-03f,
+	-7.569718e-02f,
+	8.815885e-03f,
+	3.381962e-02f,
+	-4.508495e-03f,
+	-1.631582e-02f,
+	1.940131e-03f,
+	7.487237e-03f,
+	-5.656481e-04f,
+	-2.914667e-03f,
+	1.111627e-04f,
+	9.311438e-04f,
+	9.030104e-05f,
+	-1.021624e-04f,
+	-7.033348e-06f,
+
+	1.689290e-07f,
+	4.841478e-05f,
+	9.199658e-05f,
+	-5.482137e-04f,
+	-8.951350e-04f,
+	1.612844e-03f,
+	2.821172e-03f,
+	-4.118850e-03f,
+	-7.280606e-03f,
+	8.801037e-03f,
+	1.589336e-02f,
+	-1.810557e-02f,
+	-3.292140e-02f,
+	4.022479e-02f,
+	7.291000e-02f,
+	-1.660060e-01f,
+	3.609598e-01f,
+	-9.213090e-03f,
+	-7.485819e-02f,
+	9.979963e-03f,
+	3.345841e-02f,
+	-5.054355e-03f,
+	-1.614285e-02f,
+	2.197742e-03f,
+	7.408738e-03f,
+	-6.759167e-04f,
+	-2.883554e-03f,
+	1.503825e-04f,
+	9.216070e-04f,
+	8.064508e-05f,
+	-1.006126e-04f,
+	-6.556511e-06f,
+
+	2.093113e-07f,
+	5.020628e-05f,
+	8.890090e-05f,
+	-5.632396e-04f,
+	-8.806036e-04f,
+	1.666023e-03f,
+	2.777917e-03f,
+	-4.259177e-03f,
+	-7.176253e-03f,
+	9.117509e-03f,
+	1.566898e-02f,
+	-1.876855e-02f,
+	-3.244991e-02f,
+	4.169131e-02f,
+	7.169278e-02f,
+	-1.722424e-01f,
+	3.534237e-01f,
+	-1.259017e-02f,
+	-7.398152e-02f,
+	1.112318e-02f,
+	3.308010e-02f,
+	-5.590916e-03f,
+	-1.596177e-02f,
+	2.450705e-03f,
+	7.326603e-03f,
+	-7.840395e-04f,
+	-2.851129e-03f,
+	1.888275e-04f,
+	9.116530e-04f,
+	7.122755e-05f,
+	-9.894371e-05f,
+	-5.960464e-06f,
+
+	2.564618e-07f,
+	5.202184e-05f,
+	8.559941e-05f,
+	-5.782567e-04f,
+	-8.651965e-04f,
+	1.718994e-03f,
+	2.732157e-03f,
+	-4.398733e-03f,
+	-7.065989e-03f,
+	9.431961e-03f,
+	1.543203e-02f,
+	-1.942716e-02f,
+	-3.195183e-02f,
+	4.315019e-02f,
+	7.040184e-02f,
+	-1.785428e-01f,
+	3.459177e-01f,
+	-1.588368e-02f,
+	-7.306826e-02f,
+	1.224518e-02f,
+	3.268528e-02f,
+	-6.117821e-03f,
+	-1.577270e-02f,
+	2.699077e-03f,
+	7.240951e-03f,
+	-8.900166e-04f,
+	-2.817392e-03f,
+	2.264380e-04f,
+	9.013414e-04f,
+	6.210804e-05f,
+	-9.727478e-05f,
+	-5.483627e-06f,
+
+	3.110738e-07f,
+	5.385984e-05f,
+	8.208873e-05f,
+	-5.932528e-04f,
+	-8.489080e-04f,
+	1.771718e-03f,
+	2.683884e-03f,
+	-4.537415e-03f,
+	-6.949811e-03f,
+	9.744165e-03f,
+	1.518252e-02f,
+	-2.008093e-02f,
+	-3.142714e-02f,
+	4.460040e-02f,
+	6.903653e-02f,
+	-1.849062e-01f,
+	3.384435e-01f,
+	-1.909387e-02f,
+	-7.211959e-02f,
+	1.334548e-02f,
+	3.227425e-02f,
+	-6.634831e-03f,
+	-1.557589e-02f,
+	2.942741e-03f,
+	7.151842e-03f,
+	-9.939671e-04f,
+	-2.782345e-03f,
+	2.632141e-04f,
+	8.906126e-04f,
+	5.316734e-05f,
+	-9.560585e-05f,
+	-5.125999e-06f,
+
+	3.738660e-07f,
+	5.571862e-05f,
+	7.836559e-05f,
+	-6.082157e-04f,
+	-8.317325e-04f,
+	1.824153e-03f,
+	2.633093e-03f,
+	-4.675120e-03f,
+	-6.827721e-03f,
+	1.005389e-02f,
+	1.492045e-02f,
+	-2.072939e-02f,
+	-3.087586e-02f,
+	4.604090e-02f,
+	6.759617e-02f,
+	-1.913315e-01f,
+	3.310025e-01f,
+	-2.222049e-02f,
+	-7.113671e-02f,
+	1.442367e-02f,
+	3.184748e-02f,
+	-7.141948e-03f,
+	-1.537168e-02f,
+	3.181517e-03f,
+	7.059395e-03f,
+	-1.095772e-03f,
+	-2.745986e-03f,
+	2.991557e-04f,
+	8.795857e-04f,
+	4.446507e-05f,
+	-9.381771e-05f,
+	-4.649162e-06f,
+
+	4.455827e-07f,
+	5.759637e-05f,
+	7.442685e-05f,
+	-6.231329e-04f,
+	-8.136652e-04f,
+	1.876258e-03f,
+	2.579781e-03f,
+	-4.811741e-03f,
+	-6.699723e-03f,
+	1.036091e-02f,
+	1.464587e-02f,
+	-2.137206e-02f,
+	-3.029800e-02f,
+	4.747063e-02f,
+	6.608013e-02f,
+	-1.978177e-01f,
+	3.235962e-01f,
+	-2.526391e-02f,
+	-7.012081e-02f,
+	1.547939e-02f,
+	3.140551e-02f,
+	-7.638693e-03f,
+	-1.516008e-02f,
+	3.415346e-03f,
+	6.963730e-03f,
+	-1.195312e-03f,
+	-2.708435e-03f,
+	3.342032e-04f,
+	8.682013e-04f,
+	3.600121e-05f,
+	-9.202957e-05f,
+	-4.291534e-06f,
+
+	5.269923e-07f,
+	5.949123e-05f,
+	7.026945e-05f,
+	-6.379913e-04f,
+	-7.947020e-04f,
+	1.927992e-03f,
+	2.523945e-03f,
+	-4.947175e-03f,
+	-6.565826e-03f,
+	1.066500e-02f,
+	1.435879e-02f,
+	-2.200848e-02f,
+	-2.969361e-02f,
+	4.888854e-02f,
+	6.448780e-02f,
+	-2.043636e-01f,
+	3.162261e-01f,
+	-2.822423e-02f,
+	-6.907272e-02f,
+	1.651227e-02f,
+	3.094870e-02f,
+	-8.125067e-03f,
+	-1.494145e-02f,
+	3.644228e-03f,
+	6.864965e-03f,
+	-1.292586e-03f,
+	-2.669811e-03f,
+	3.684163e-04f,
+	8.564591e-04f,
+	2.789497e-05f,
+	-9.024143e-05f,
+	-3.814697e-06f,
+
+	6.188858e-07f,
+	6.140124e-05f,
+	6.589054e-05f,
+	-6.527781e-04f,
+	-7.748390e-04f,
+	1.979311e-03f,
+	2.465585e-03f,
+	-5.081315e-03f,
+	-6.426041e-03f,
+	1.096591e-02f,
+	1.405925e-02f,
+	-2.263816e-02f,
+	-2.906274e-02f,
+	5.029355e-02f,
+	6.281858e-02f,
+	-2.109680e-01f,
+	3.088936e-01f,
+	-3.110135e-02f,
+	-6.799412e-02f,
+	1.752192e-02f,
+	3.047758e-02f,
+	-8.600712e-03f,
+	-1.471591e-02f,
+	3.867924e-03f,
+	6.763160e-03f,
+	-1.387596e-03f,
+	-2.629995e-03f,
+	4.017949e-04f,
+	8.444786e-04f,
+	1.990795e-05f,
+	-8.845329e-05f,
+	-3.457069e-06f,
+
+	7.220755e-07f,
+	6.332430e-05f,
+	6.128734e-05f,
+	-6.674799e-04f,
+	-7.540731e-04f,
+	2.030175e-03f,
+	2.404703e-03f,
+	-5.214054e-03f,
+	-6.280387e-03f,
+	1.126343e-02f,
+	1.374731e-02f,
+	-2.326062e-02f,
+	-2.840545e-02f,
+	5.168458e-02f,
+	6.107190e-02f,
+	-2.176299e-01f,
+	3.016003e-01f,
+	-3.389573e-02f,
+	-6.688571e-02f,
+	1.850808e-02f,
+	2.999252e-02f,
+	-9.065628e-03f,
+	-1.448369e-02f,
+	4.086494e-03f,
+	6.658435e-03f,
+	-1.480341e-03f,
+	-2.589107e-03f,
+	4.342794e-04f,
+	8.321404e-04f,
+	1.227856e-05f,
+	-8.654594e-05f,
+	-3.218651e-06f,
+
+	8.373934e-07f,
+	6.525829e-05f,
+	5.645724e-05f,
+	-6.820834e-04f,
+	-7.324021e-04f,
+	2.080539e-03f,
+	2.341301e-03f,
+	-5.345285e-03f,
+	-6.128883e-03f,
+	1.155732e-02f,
+	1.342301e-02f,
+	-2.387539e-02f,
+	-2.772185e-02f,
+	5.306056e-02f,
+	5.924723e-02f,
+	-2.243480e-01f,
+	2.943474e-01f,
+	-3.660738e-02f,
+	-6.574869e-02f,
+	1.947027e-02f,
+	2.949405e-02f,
+	-9.519577e-03f,
+	-1.424503e-02f,
+	4.299700e-03f,
+	6.550908e-03f,
+	-1.570702e-03f,
+	-2.547145e-03f,
+	4.658699e-04f,
+	8.195639e-04f,
+	4.768372e-06f,
+	-8.463860e-05f,
+	-2.861023e-06f,
+
+	9.656874e-07f,
+	6.720095e-05f,
+	5.139777e-05f,
+	-6.965747e-04f,
+	-7.098241e-04f,
+	2.130360e-03f,
+	2.275385e-03f,
+	-5.474902e-03f,
+	-5.971555e-03f,
+	1.184733e-02f,
+	1.308644e-02f,
+	-2.448198e-02f,
+	-2.701204e-02f,
+	5.442039e-02f,
+	5.734402e-02f,
+	-2.311212e-01f,
+	2.871364e-01f,
+	-3.923690e-02f,
+	-6.458437e-02f,
+	2.040833e-02f,
+	2.898270e-02f,
+	-9.962320e-03f,
+	-1.400030e-02f,
+	4.507661e-03f,
+	6.440699e-03f,
+	-1.658797e-03f,
+	-2.504110e-03f,
+	4.965663e-04f,
+	8.067489e-04f,
+	-2.384186e-06f,
+	-8.273125e-05f,
+	-2.622604e-06f,
+
+	1.107824e-06f,
+	6.914994e-05f,
+	4.610663e-05f,
+	-7.109399e-04f,
+	-6.863380e-04f,
+	2.179594e-03f,
+	2.206962e-03f,
+	-5.602796e-03f,
+	-5.808432e-03f,
+	1.213325e-02f,
+	1.273765e-02f,
+	-2.507991e-02f,
+	-2.627613e-02f,
+	5.576296e-02f,
+	5.536178e-02f,
+	-2.379481e-01f,
+	2.799687e-01f,
+	-4.178405e-02f,
+	-6.339383e-02f,
+	2.132195e-02f,
+	2.845877e-02f,
+	-1.039374e-02f,
+	-1.374960e-02f,
+	4.710138e-03f,
+	6.327927e-03f,
+	-1.744390e-03f,
+	-2.460241e-03f,
+	5.263090e-04f,
+	7.936358e-04f,
+	-9.417534e-06f,
+	-8.082390e-05f,
+	-2.264977e-06f,
+
+	1.264685e-06f,
+	7.110281e-05f,
+	4.058166e-05f,
+	-7.251651e-04f,
+	-6.619433e-04f,
+	2.228199e-03f,
+	2.136040e-03f,
+	-5.728859e-03f,
+	-5.639548e-03f,
+	1.241484e-02f,
+	1.237674e-02f,
+	-2.566870e-02f,
+	-2.551428e-02f,
+	5.708718e-02f,
+	5.330006e-02f,
+	-2.448276e-01f,
+	2.728457e-01f,
+	-4.424953e-02f,
+	-6.217813e-02f,
+	2.221084e-02f,
+	2.792287e-02f,
+	-1.081371e-02f,
+	-1.349330e-02f,
+	4.907191e-03f,
+	6.212592e-03f,
+	-1.827598e-03f,
+	-2.415419e-03f,
+	5.552769e-04f,
+	7.803440e-04f,
+	-1.609325e-05f,
+	-7.891655e-05f,
+	-2.026558e-06f,
+
+	1.437162e-06f,
+	7.305706e-05f,
+	3.482089e-05f,
+	-7.392359e-04f,
+	-6.366402e-04f,
+	2.276128e-03f,
+	2.062629e-03f,
+	-5.852982e-03f,
+	-5.464939e-03f,
+	1.269186e-02f,
+	1.200379e-02f,
+	-2.624788e-02f,
+	-2.472663e-02f,
+	5.839193e-02f,
+	5.115838e-02f,
+	-2.517585e-01f,
+	2.657688e-01f,
+	-4.663360e-02f,
+	-6.093860e-02f,
+	2.307469e-02f,
+	2.737540e-02f,
+	-1.122224e-02f,
+	-1.323128e-02f,
+	5.098760e-03f,
+	6.094933e-03f,
+	-1.908422e-03f,
+	-2.369881e-03f,
+	5.832911e-04f,
+	7.668138e-04f,
+	-2.264977e-05f,
+	-7.700920e-05f,
+	-1.788139e-06f,
+
+	1.626160e-06f,
+	7.501005e-05f,
+	2.882250e-05f,
+	-7.531379e-04f,
+	-6.104296e-04f,
+	2.323339e-03f,
+	1.986742e-03f,
+	-5.975059e-03f,
+	-5.284648e-03f,
+	1.296409e-02f,
+	1.161890e-02f,
+	-2.681695e-02f,
+	-2.391337e-02f,
+	5.967610e-02f,
+	4.893633e-02f,
+	-2.587393e-01f,
+	2.587394e-01f,
+	-4.893625e-02f,
+	-5.967605e-02f,
+	2.391338e-02f,
+	2.681696e-02f,
+	-1.161897e-02f,
+	-1.296413e-02f,
+	5.284607e-03f,
+	5.975068e-03f,
+	-1.986742e-03f,
+	-2.323389e-03f,
+	6.104112e-04f,
+	7.531047e-04f,
+	-2.884865e-05f,
+	-7.498264e-05f,
+	-1.668930e-06f,
+
+	1.832593e-06f,
+	7.695908e-05f,
+	2.258486e-05f,
+	-7.668564e-04f,
+	-5.833131e-04f,
+	2.369787e-03f,
+	1.908393e-03f,
+	-6.094979e-03f,
+	-5.098721e-03f,
+	1.323128e-02f,
+	1.122219e-02f,
+	-2.737544e-02f,
+	-2.307470e-02f,
+	6.093856e-02f,
+	4.663351e-02f,
+	-2.657689e-01f,
+	2.517585e-01f,
+	-5.115831e-02f,
+	-5.839193e-02f,
+	2.472663e-02f,
+	2.624792e-02f,
+	-1.200378e-02f,
+	-1.269186e-02f,
+	5.464911e-03f,
+	5.852997e-03f,
+	-2.062678e-03f,
+	-2.276182e-03f,
+	6.366372e-04f,
+	7.392168e-04f,
+	-3.480911e-05f,
+	-7.307529e-05f,
+	-1.430511e-06f,
+
+	2.057377e-06f,
+	7.890136e-05f,
+	1.610654e-05f,
+	-7.803766e-04f,
+	-5.552928e-04f,
+	2.415426e-03f,
+	1.827599e-03f,
+	-6.212635e-03f,
+	-4.907209e-03f,
+	1.349321e-02f,
+	1.081377e-02f,
+	-2.792288e-02f,
+	-2.221081e-02f,
+	6.217818e-02f,
+	4.424955e-02f,
+	-2.728458e-01f,
+	2.448276e-01f,
+	-5.330002e-02f,
+	-5.708718e-02f,
+	2.551425e-02f,
+	2.566868e-02f,
+	-1.237667e-02f,
+	-1.241481e-02f,
+	5.639553e-03f,
+	5.728841e-03f,
+	-2.136111e-03f,
+	-2.228260e-03f,
+	6.619096e-04f,
+	7.251501e-04f,
+	-4.065037e-05f,
+	-7.116795e-05f,
+	-1.311302e-06f,
+
+	2.301435e-06f,
+	8.083399e-05f,
+	9.386258e-06f,
+	-7.936836e-04f,
+	-5.263721e-04f,
+	2.460211e-03f,
+	1.744377e-03f,
+	-6.327918e-03f,
+	-4.710167e-03f,
+	1.374965e-02f,
+	1.039376e-02f,
+	-2.845878e-02f,
+	-2.132195e-02f,
+	6.339383e-02f,
+	4.178409e-02f,
+	-2.799688e-01f,
+	2.379481e-01f,
+	-5.536187e-02f,
+	-5.576301e-02f,
+	2.627611e-02f,
+	2.507991e-02f,
+	-1.273763e-02f,
+	-1.213324e-02f,
+	5.808413e-03f,
+	5.602777e-03f,
+	-2.207041e-03f,
+	-2.179623e-03f,
+	6.862879e-04f,
+	7.109046e-04f,
+	-4.613400e-05f,
+	-6.914139e-05f,
+	-1.072884e-06f,
+
+	2.565696e-06f,
+	8.275401e-05f,
+	2.422962e-06f,
+	-8.067623e-04f,
+	-4.965544e-04f,
+	2.504098e-03f,
+	1.658747e-03f,
+	-6.440720e-03f,
+	-4.507652e-03f,
+	1.400036e-02f,
+	9.962313e-03f,
+	-2.898267e-02f,
+	-2.040835e-02f,
+	6.458439e-02f,
+	3.923682e-02f,
+	-2.871364e-01f,
+	2.311212e-01f,
+	-5.734408e-02f,
+	-5.442035e-02f,
+	2.701205e-02f,
+	2.448195e-02f,
+	-1.308644e-02f,
+	-1.184738e-02f,
+	5.971551e-03f,
+	5.474865e-03f,
+	-2.275467e-03f,
+	-2.130389e-03f,
+	7.097721e-04f,
+	6.965399e-04f,
+	-5.137920e-05f,
+	-6.723404e-05f,
+	-9.536743e-07f,
+
+	2.851090e-06f,
+	8.465834e-05f,
+	-4.784214e-06f,
+	-8.195976e-04f,
+	-4.658444e-04f,
+	2.547042e-03f,
+	1.570732e-03f,
+	-6.550934e-03f,
+	-4.299730e-03f,
+	1.424511e-02f,
+	9.519557e-03f,
+	-2.949408e-02f,
+	-1.947030e-02f,
+	6.574871e-02f,
+	3.660745e-02f,
+	-2.943474e-01f,
+	2.243480e-01f,
+	-5.924726e-02f,
+	-5.306053e-02f,
+	2.772182e-02f,
+	2.387536e-02f,
+	-1.342309e-02f,
+	-1.155734e-02f,
+	6.128848e-03f,
+	5.345285e-03f,
+	-2.341390e-03f,
+	-2.080560e-03f,
+	7.323623e-04f,
+	6.820560e-04f,
+	-5.650520e-05f,
+	-6.532669e-05f,
+	-8.344650e-07f,
+
+	3.158544e-06f,
+	8.654385e-05f,
+	-1.223593e-05f,
+	-8.321739e-04f,
+	-4.342471e-04f,
+	2.588998e-03f,
+	1.480356e-03f,
+	-6.658450e-03f,
+	-4.086467e-03f,
+	1.448369e-02f,
+	9.065652e-03f,
+	-2.999254e-02f,
+	-1.850806e-02f,
+	6.688564e-02f,
+	3.389569e-02f,
+	-3.016003e-01f,
+	2.176298e-01f,
+	-6.107199e-02f,
+	-5.168462e-02f,
+	2.840543e-02f,
+	2.326065e-02f,
+	-1.374722e-02f,
+	-1.126349e-02f,
+	6.280363e-03f,
+	5.214036e-03f,
+	-2.404690e-03f,
+	-2.030253e-03f,
+	7.540584e-04f,
+	6.674528e-04f,
+	-6.127357e-05f,
+	-6.330013e-05f,
+	-7.152557e-07f,
+
+	3.488977e-06f,
+	8.840729e-05f,
+	-1.993262e-05f,
+	-8.444760e-04f,
+	-4.017687e-04f,
+	2.629919e-03f,
+	1.387644e-03f,
+	-6.763163e-03f,
+	-3.867937e-03f,
+	1.471586e-02f,
+	8.600758e-03f,
+	-3.047758e-02f,
+	-1.752196e-02f,
+	6.799406e-02f,
+	3.110133e-02f,
+	-3.088937e-01f,
+	2.109680e-01f,
+	-6.281865e-02f,
+	-5.029356e-02f,
+	2.906269e-02f,
+	2.263814e-02f,
+	-1.405919e-02f,
+	-1.096594e-02f,
+	6.426036e-03f,
+	5.081356e-03f,
+	-2.465606e-03f,
+	-1.979351e-03f,
+	7.748008e-04f,
+	6.527305e-04f,
+	-6.592274e-05f,
+	-6.139278e-05f,
+	-5.960464e-07f,
+
+	3.843303e-06f,
+	9.024536e-05f,
+	-2.787454e-05f,
+	-8.564882e-04f,
+	-3.684158e-04f,
+	2.669761e-03f,
+	1.292624e-03f,
+	-6.864965e-03f,
+	-3.644215e-03f,
+	1.494139e-02f,
+	8.125048e-03f,
+	-3.094872e-02f,
+	-1.651229e-02f,
+	6.907281e-02f,
+	2.822413e-02f,
+	-3.162261e-01f,
+	2.043636e-01f,
+	-6.448781e-02f,
+	-4.888844e-02f,
+	2.969360e-02f,
+	2.200848e-02f,
+	-1.435876e-02f,
+	-1.066494e-02f,
+	6.565809e-03f,
+	4.947186e-03f,
+	-2.524018e-03f,
+	-1.927972e-03f,
+	7.947087e-04f,
+	6.379485e-04f,
+	-7.033348e-05f,
+	-5.948544e-05f,
+	-5.960464e-07f,
+
+	4.222436e-06f,
+	9.205466e-05f,
+	-3.606169e-05f,
+	-8.681949e-04f,
+	-3.341961e-04f,
+	2.708479e-03f,
+	1.195326e-03f,
+	-6.963751e-03f,
+	-3.415383e-03f,
+	1.516007e-02f,
+	7.638700e-03f,
+	-3.140552e-02f,
+	-1.547941e-02f,
+	7.012075e-02f,
+	2.526391e-02f,
+	-3.235962e-01f,
+	1.978177e-01f,
+	-6.608009e-02f,
+	-4.747057e-02f,
+	3.029799e-02f,
+	2.137208e-02f,
+	-1.464581e-02f,
+	-1.036084e-02f,
+	6.699741e-03f,
+	4.811764e-03f,
+	-2.579808e-03f,
+	-1.876235e-03f,
+	8.136630e-04f,
+	6.231070e-04f,
+	-7.438660e-05f,
+	-5.757809e-05f,
+	-4.768372e-07f,
+
+	4.627272e-06f,
+	9.383172e-05f,
+	-4.449385e-05f,
+	-8.795803e-04f,
+	-2.991177e-04f,
+	2.746028e-03f,
+	1.095782e-03f,
+	-7.059414e-03f,
+	-3.181526e-03f,
+	1.537166e-02f,
+	7.141904e-03f,
+	-3.184751e-02f,
+	-1.442367e-02f,
+	7.113673e-02f,
+	2.222052e-02f,
+	-3.310025e-01f,
+	1.913315e-01f,
+	-6.759620e-02f,
+	-4.604089e-02f,
+	3.087580e-02f,
+	2.072942e-02f,
+	-1.492047e-02f,
+	-1.005387e-02f,
+	6.827712e-03f,
+	4.675090e-03f,
+	-2.633095e-03f,
+	-1.824141e-03f,
+	8.317232e-04f,
+	6.082058e-04f,
+	-7.832050e-05f,
+	-5.578995e-05f,
+	-3.576279e-07f,
+
+	5.058698e-06f,
+	9.557300e-05f,
+	-5.317058e-05f,
+	-8.906288e-04f,
+	-2.631898e-04f,
+	2.782363e-03f,
+	9.940268e-04f,
+	-7.151850e-03f,
+	-2.942733e-03f,
+	1.557596e-02f,
+	6.634858e-03f,
+	-3.227424e-02f,
+	-1.334546e-02f,
+	7.211961e-02f,
+	1.909383e-02f,
+	-3.384435e-01f,
+	1.849062e-01f,
+	-6.903648e-02f,
+	-4.460049e-02f,
+	3.142715e-02f,
+	2.008092e-02f,
+	-1.518250e-02f,
+	-9.744167e-03f,
+	6.949842e-03f,
+	4.537404e-03f,
+	-2.683997e-03f,
+	-1.771688e-03f,
+	8.488894e-04f,
+	5.932450e-04f,
+	-8.213520e-05f,
+	-5.388260e-05f,
+	-3.576279e-07f,
+
+	5.517584e-06f,
+	9.727487e-05f,
+	-6.209120e-05f,
+	-9.013244e-04f,
+	-2.264222e-04f,
+	2.817438e-03f,
+	8.900951e-04f,
+	-7.240955e-03f,
+	-2.699099e-03f,
+	1.577274e-02f,
+	6.117766e-03f,
+	-3.268526e-02f,
+	-1.224515e-02f,
+	7.306824e-02f,
+	1.588372e-02f,
+	-3.459177e-01f,
+	1.785428e-01f,
+	-7.040191e-02f,
+	-4.315019e-02f,
+	3.195179e-02f,
+	1.942718e-02f,
+	-1.543212e-02f,
+	-9.431958e-03f,
+	7.065952e-03f,
+	4.398704e-03f,
+	-2.732158e-03f,
+	-1.718998e-03f,
+	8.651614e-04f,
+	5.782247e-04f,
+	-8.559227e-05f,
+	-5.197525e-05f,
+	-2.384186e-07f,
+
+	6.004784e-06f,
+	9.893363e-05f,
+	-7.125478e-05f,
+	-9.116511e-04f,
+	-1.888257e-04f,
+	2.851211e-03f,
+	7.840253e-04f,
+	-7.326625e-03f,
+	-2.450722e-03f,
+	1.596179e-02f,
+	5.590844e-03f,
+	-3.308013e-02f,
+	-1.112318e-02f,
+	7.398148e-02f,
+	1.259014e-02f,
+	-3.534236e-01f,
+	1.722424e-01f,
+	-7.169282e-02f,
+	-4.169130e-02f,
+	3.244990e-02f,
+	1.876855e-02f,
+	-1.566899e-02f,
+	-9.117484e-03f,
+	7.176220e-03f,
+	4.259169e-03f,
+	-2.777815e-03f,
+	-1.666069e-03f,
+	8.805990e-04f,
+	5.632043e-04f,
+	-8.893013e-05f,
+	-5.018711e-05f,
+	-2.384186e-07f,
+
+	6.521137e-06f,
+	1.005455e-04f,
+	-8.066017e-05f,
+	-9.215932e-04f,
+	-1.504118e-04f,
+	2.883635e-03f,
+	6.758572e-04f,
+	-7.408758e-03f,
+	-2.197705e-03f,
+	1.614289e-02f,
+	5.054317e-03f,
+	-3.345839e-02f,
+	-9.979959e-03f,
+	7.485817e-02f,
+	9.213022e-03f,
+	-3.609598e-01f,
+	1.660060e-01f,
+	-7.290995e-02f,
+	-4.022479e-02f,
+	3.292137e-02f,
+	1.810557e-02f,
+	-1.589334e-02f,
+	-8.800983e-03f,
+	7.280588e-03f,
+	4.118860e-03f,
+	-2.821088e-03f,
+	-1.612782e-03f,
+	8.951426e-04f,
+	5.481839e-04f,
+	-9.202957e-05f,
+	-4.839897e-05f,
+	-1.192093e-07f,
+
+	7.067451e-06f,
+	1.021067e-04f,
+	-9.030596e-05f,
+	-9.311347e-04f,
+	-1.111927e-04f,
+	2.914667e-03f,
+	5.656330e-04f,
+	-7.487254e-03f,
+	-1.940155e-03f,
+	1.631584e-02f,
+	4.508416e-03f,
+	-3.381962e-02f,
+	-8.815948e-03f,
+	7.569721e-02f,
+	5.752360e-03f,
+	-3.685246e-01f,
+	1.598346e-01f,
+	-7.405424e-02f,
+	-3.875172e-02f,
+	3.336632e-02f,
+	1.743865e-02f,
+	-1.610518e-02f,
+	-8.482695e-03f,
+	7.379055e-03f,
+	3.977835e-03f,
+	-2.861857e-03f,
+	-1.559496e-03f,
+	9.087920e-04f,
+	5.331635e-04f,
+	-9.489059e-05f,
+	-4.661083e-05f,
+	-1.192093e-07f,
+
+	7.644513e-06f,
+	1.036133e-04f,
+	-1.001905e-04f,
+	-9.402594e-04f,
+	-7.118154e-05f,
+	2.944263e-03f,
+	4.533964e-04f,
+	-7.562011e-03f,
+	-1.678183e-03f,
+	1.648043e-02f,
+	3.953383e-03f,
+	-3.416340e-02f,
+	-7.631614e-03f,
+	7.649741e-02f,
+	2.208161e-03f,
+	-3.761167e-01f,
+	1.537294e-01f,
+	-7.512617e-02f,
+	-3.727293e-02f,
+	3.378469e-02f,
+	1.676840e-02f,
+	-1.630437e-02f,
+	-8.162975e-03f,
+	7.471621e-03f,
+	3.836274e-03f,
+	-2.900124e-03f,
+	-1.505971e-03f,
+	9.216070e-04f,
+	5.182028e-04f,
+	-9.763241e-05f,
+	-4.494190e-05f,
+	-1.192093e-07f,
+
+	8.253084e-06f,
+	1.050614e-04f,
+	-1.103118e-04f,
+	-9.489518e-04f,
+	-3.039229e-05f,
+	2.972380e-03f,
+	3.391936e-04f,
+	-7.632932e-03f,
+	-1.411905e-03f,
+	1.663646e-02f,
+	3.389467e-03f,
+	-3.448929e-02f,
+	-6.427442e-03f,
+	7.725767e-02f,
+	-1.419533e-03f,
+	-3.837343e-01f,
+	1.476911e-01f,
+	-7.612669e-02f,
+	-3.578949e-02f,
+	3.417671e-02f,
+	1.609510e-02f,
+	-1.649117e-02f,
+	-7.841825e-03f,
+	7.558286e-03f,
+	3.694236e-03f,
+	-2.936006e-03f,
+	-1.452446e-03f,
+	9.335279e-04f,
+	5.032420e-04f,
+	-1.001358e-04f,
+	-4.315376e-05f,
+	-1.192093e-07f,
+
+	8.893898e-06f,
+	1.064468e-04f,
+	-1.206677e-04f,
+	-9.571955e-04f,
+	1.116031e-05f,
+	2.998974e-03f,
+	2.230724e-04f,
+	-7.699918e-03f,
+	-1.141442e-03f,
+	1.678371e-02f,
+	2.816927e-03f,
+	-3.479686e-02f,
+	-5.203937e-03f,
+	7.797684e-02f,
+	-5.130656e-03f,
+	-3.913760e-01f,
+	1.417208e-01f,
+	-7.705629e-02f,
+	-3.430259e-02f,
+	3.454220e-02f,
+	1.541924e-02f,
+	-1.666534e-02f,
+	-7.519484e-03f,
+	7.639110e-03f,
+	3.551841e-03f,
+	-2.969265e-03f,
+	-1.398802e-03f,
+	9.446144e-04f,
+	4.882813e-04f,
+	-1.024008e-04f,
+	-4.148483e-05f,
+	-1.192093e-07f,
+
+	9.567653e-06f,
+	1.077657e-04f,
+	-1.312558e-04f,
+	-9.649748e-04f,
+	5.346067e-05f,
+	3.024003e-03f,
+	1.050830e-04f,
+	-7.762874e-03f,
+	-8.669160e-04f,
+	1.692200e-02f,
+	2.236029e-03f,
+	-3.508573e-02f,
+	-3.961621e-03f,
+	7.865380e-02f,
+	-8.925108e-03f,
+	-3.990403e-01f,
+	1.358194e-01f,
+	-7.791603e-02f,
+	-3.281295e-02f,
+	3.488147e-02f,
+	1.474142e-02f,
+	-1.682711e-02f,
+	-7.196188e-03f,
+	7.714093e-03f,
+	3.409147e-03f,
+	-3.000140e-03f,
+	-1.345158e-03f,
+	9.549260e-04f,
+	4.733801e-04f,
+	-1.045465e-04f,
+	-3.993511e-05f,
+	0.000000e+00f,
+
+	1.027502e-05f,
+	1.090137e-04f,
+	-1.420733e-04f,
+	-9.722738e-04f,
+	9.649240e-05f,
+	3.047425e-03f,
+	-1.472269e-05f,
+	-7.821703e-03f,
+	-5.884565e-04f,
+	1.705114e-02f,
+	1.647047e-03f,
+	-3.535548e-02f,
+	-2.701037e-03f,
+	7.928742e-02f,
+	-1.280277e-02f,
+	-4.067255e-01f,
+	1.299878e-01f,
+	-7.870638e-02f,
+	-3.132176e-02f,
+	3.519458e-02f,
+	1.406193e-02f,
+	-1.697636e-02f,
+	-6.872296e-03f,
+	7.783294e-03f,
+	3.266394e-03f,
+	-3.028631e-03f,
+	-1.291633e-03f,
+	9.643435e-04f,
+	4.585385e-04f,
+	-1.064539e-04f,
+	-3.826618e-05f,
+	0.000000e+00f,
+
+	1.101663e-05f,
+	1.101868e-04f,
+	-1.531173e-04f,
+	-9.790767e-04f,
+	1.402383e-04f,
+	3.069197e-03f,
+	-1.362908e-04f,
+	-7.876316e-03f,
+	-3.061958e-04f,
+	1.717092e-02f,
+	1.050266e-03f,
+	-3.560571e-02f,
+	-1.422742e-03f,
+	7.987659e-02f,
+	-1.676347e-02f,
+	-4.144301e-01f,
+	1.242267e-01f,
+	-7.942855e-02f,
+	-2.982974e-02f,
+	3.548151e-02f,
+	1.338130e-02f,
+	-1.711321e-02f,
+	-6.547928e-03f,
+	7.846653e-03f,
+	3.123462e-03f,
+	-3.054738e-03f,
+	-1.237988e-03f,
+	9.729266e-04f,
+	4.437566e-04f,
+	-1.082420e-04f,
+	-3.671646e-05f,
+	0.000000e+00f,
+
+	1.179308e-05f,
+	1.112808e-04f,
+	-1.643846e-04f,
+	-9.853678e-04f,
+	1.846802e-04f,
+	3.089278e-03f,
+	-2.595653e-04f,
+	-7.926617e-03f,
+	-2.027045e-05f,
+	1.728117e-02f,
+	4.459769e-04f,
+	-3.583604e-02f,
+	-1.273141e-04f,
+	8.042020e-02f,
+	-2.080704e-02f,
+	-4.221524e-01f,
+	1.185372e-01f,
+	-8.008301e-02f,
+	-2.833807e-02f,
+	3.574252e-02f,
+	1.269990e-02f,
+	-1.723778e-02f,
+	-6.223321e-03f,
+	7.904232e-03f,
+	2.980530e-03f,
+	-3.078341e-03f,
+	-1.184583e-03f,
+	9.807348e-04f,
+	4.290938e-04f,
+	-1.097918e-04f,
+	-3.516674e-05f,
+	0.000000e+00f,
+
+	1.260491e-05f,
+	1.122913e-04f,
+	-1.758714e-04f,
+	-9.911316e-04f,
+	2.297993e-04f,
+	3.107628e-03f,
+	-3.844883e-04f,
+	-7.972518e-03f,
+	2.691790e-04f,
+	1.738171e-02f,
+	-1.655210e-04f,
+	-3.604608e-02f,
+	1.184653e-03f,
+	8.091713e-02f,
+	-2.493326e-02f,
+	-4.298909e-01f,
+	1.129200e-01f,
+	-8.067095e-02f,
+	-2.684736e-02f,
+	3.597778e-02f,
+	1.201826e-02f,
+	-1.734996e-02f,
+	-5.898714e-03f,
+	7.956147e-03f,
+	2.837777e-03f,
+	-3.099680e-03f,
+	-1.131296e-03f,
+	9.877682e-04f,
+	4.144907e-04f,
+	-1.112223e-04f,
+	-3.361702e-05f,
+	0.000000e+00f,
+
+	1.345263e-05f,
+	1.132140e-04f,
+	-1.875742e-04f,
+	-9.963523e-04f,
+	2.755758e-04f,
+	3.124206e-03f,
+	-5.110001e-04f,
+	-8.013930e-03f,
+	5.620078e-04f,
+	1.747235e-02f,
+	-7.839202e-04f,
+	-3.623546e-02f,
+	2.512547e-03f,
+	8.136629e-02f,
+	-2.914189e-02f,
+	-4.376440e-01f,
+	1.073758e-01f,
+	-8.119309e-02f,
+	-2.535880e-02f,
+	3.618735e-02f,
+	1.133674e-02f,
+	-1.744998e-02f,
+	-5.574107e-03f,
+	8.002400e-03f,
+	2.695203e-03f,
+	-3.118634e-03f,
+	-1.078129e-03f,
+	9.939671e-04f,
+	3.999472e-04f,
+	-1.124144e-04f,
+	-3.206730e-05f,
+	0.000000e+00f,
+
+	1.433671e-05f,
+	1.140447e-04f,
+	-1.994887e-04f,
+	-1.001015e-03f,
+	3.219893e-04f,
+	3.138973e-03f,
+	-6.390389e-04f,
+	-8.050769e-03f,
+	8.580672e-04f,
+	1.755291e-02f,
+	-1.408905e-03f,
+	-3.640382e-02f,
+	3.855737e-03f,
+	8.176658e-02f,
+	-3.343265e-02f,
+	-4.454100e-01f,
+	1.019055e-01f,
+	-8.165026e-02f,
+	-2.387321e-02f,
+	3.637147e-02f,
+	1.065576e-02f,
+	-1.753783e-02f,
+	-5.249977e-03f,
+	8.042991e-03f,
+	2.552867e-03f,
+	-3.135204e-03f,
+	-1.025200e-03f,
+	9.993911e-04f,
+	3.855824e-04f,
+	-1.134872e-04f,
+	-3.063679e-05f,
+	0.000000e+00f,
+
+	1.525757e-05f,
+	1.147790e-04f,
+	-2.116105e-04f,
+	-1.005103e-03f,
+	3.690184e-04f,
+	3.151890e-03f,
+	-7.685409e-04f,
+	-8.082949e-03f,
+	1.157205e-03f,
+	1.762324e-02f,
+	-2.040152e-03f,
+	-3.655079e-02f,
+	5.213577e-03f,
+	8.211693e-02f,
+	-3.780524e-02f,
+	-4.531875e-01f,
+	9.650975e-02f,
+	-8.204329e-02f,
+	-2.239156e-02f,
+	3.653032e-02f,
+	9.975851e-03f,
+	-1.761365e-02f,
+	-4.926324e-03f,
+	8.078039e-03f,
+	2.410948e-03f,
+	-3.149509e-03f,
+	-9.723902e-04f,
+	1.004100e-03f,
+	3.712773e-04f,
+	-1.144409e-04f,
+	-2.920628e-05f,
+	0.000000e+00f,
+
+	1.621556e-05f,
+	1.154124e-04f,
+	-2.239350e-04f,
+	-1.008603e-03f,
+	4.166407e-04f,
+	3.162918e-03f,
+	-8.994406e-04f,
+	-8.110387e-03f,
+	1.459264e-03f,
+	1.768317e-02f,
+	-2.677331e-03f,
+	-3.667603e-02f,
+	6.585402e-03f,
+	8.241626e-02f,
+	-4.225933e-02f,
+	-4.609746e-01f,
+	9.118927e-02f,
+	-8.237338e-02f,
+	-2.091455e-02f,
+	3.666413e-02f,
+	9.297311e-03f,
+	-1.767755e-02f,
+	-4.603505e-03f,
+	8.107543e-03f,
+	2.269566e-03f,
+	-3.161550e-03f,
+	-9.199381e-04f,
+	1.008034e-03f,
+	3.570914e-04f,
+	-1.152754e-04f,
+	-2.789497e-05f,
+	0.000000e+00f,
+
+	1.721100e-05f,
+	1.159406e-04f,
+	-2.364573e-04f,
+	-1.011499e-03f,
+	4.648334e-04f,
+	3.172021e-03f,
+	-1.031671e-03f,
+	-8.133005e-03f,
+	1.764085e-03f,
+	1.773253e-02f,
+	-3.320103e-03f,
+	-3.677921e-02f,
+	7.970529e-03f,
+	8.266348e-02f,
+	-4.679457e-02f,
+	-4.687699e-01f,
+	8.594477e-02f,
+	-8.264124e-02f,
+	-1.944304e-02f,
+	3.677303e-02f,
+	8.620620e-03f,
+	-1.772964e-02f,
+	-4.281640e-03f,
+	8.131504e-03f,
+	2.128720e-03f,
+	-3.171325e-03f,
+	-8.678436e-04f,
+	1.011193e-03f,
+	3.430843e-04f,
+	-1.158714e-04f,
+	-2.658367e-05f,
+	0.000000e+00f,
+
+	1.824415e-05f,
+	1.163591e-04f,
+	-2.491720e-04f,
+	-1.013776e-03f,
+	5.135727e-04f,
+	3.179162e-03f,
+	-1.165162e-03f,
+	-8.150723e-03f,
+	2.071504e-03f,
+	1.777117e-02f,
+	-3.968121e-03f,
+	-3.685999e-02f,
+	9.368260e-03f,
+	8.285757e-02f,
+	-5.141056e-02f,
+	-4.765718e-01f,
+	8.077681e-02f,
+	-8.284795e-02f,
+	-1.797807e-02f,
+	3.685731e-02f,
+	7.946134e-03f,
+	-1.776993e-02f,
+	-3.960967e-03f,
+	8.150041e-03f,
+	1.988471e-03f,
+	-3.178835e-03f,
+	-8.161068e-04f,
+	1.013637e-03f,
+	3.291965e-04f,
+	-1.163483e-04f,
+	-2.527237e-05f,
+	0.000000e+00f,
+
+	1.931520e-05f,
+	1.166634e-04f,
+	-2.620737e-04f,
+	-1.015420e-03f,
+	5.628338e-04f,
+	3.184305e-03f,
+	-1.299842e-03f,
+	-8.163468e-03f,
+	2.381352e-03f,
+	1.779895e-02f,
+	-4.621034e-03f,
+	-3.691806e-02f,
+	1.077788e-02f,
+	8.299746e-02f,
+	-5.610688e-02f,
+	-4.843785e-01f,
+	7.568616e-02f,
+	-8.299446e-02f,
+	-1.652038e-02f,
+	3.691721e-02f,
+	7.274330e-03f,
+	-1.779854e-02f,
+	-3.641605e-03f,
+	8.163273e-03f,
+	1.848996e-03f,
+	-3.184199e-03f,
+	-7.646084e-04f,
+	1.015365e-03f,
+	3.154278e-04f,
+	-1.167059e-04f,
+	-2.396107e-05f,
+	0.000000e+00f,
+
+	2.042429e-05f,
+	1.168492e-04f,
+	-2.751564e-04f,
+	-1.016417e-03f,
+	6.125913e-04f,
+	3.187414e-03f,
+	-1.435640e-03f,
+	-8.171163e-03f,
+	2.693458e-03f,
+	1.781571e-02f,
+	-5.278481e-03f,
+	-3.695311e-02f,
+	1.219865e-02f,
+	8.308210e-02f,
+	-6.088309e-02f,
+	-4.921884e-01f,
+	7.067323e-02f,
+	-8.308160e-02f,
+	-1.507068e-02f,
+	3.695297e-02f,
+	6.605506e-03f,
+	-1.781559e-02f,
+	-3.323674e-03f,
+	8.171082e-03f,
+	1.710296e-03f,
+	-3.187418e-03f,
+	-7.135868e-04f,
+	1.016378e-03f,
+	3.018379e-04f,
+	-1.168251e-04f,
+	-2.276897e-05f,
+	0.000000e+00f,
+
+	2.157152e-05f,
+	1.169118e-04f,
+	-2.884141e-04f,
+	-1.016751e-03f,
+	6.628190e-04f,
+	3.188456e-03f,
+	-1.572480e-03f,
+	-8.173740e-03f,
+	3.007648e-03f,
+	1.782132e-02f,
+	-5.940095e-03f,
+	-3.696484e-02f,
+	1.362984e-02f,
+	8.311049e-02f,
+	-6.573872e-02f,
+	-5.000000e-01f,
+	6.573874e-02f,
+	-8.311057e-02f,
+	-1.362991e-02f,
+	3.696483e-02f,
+	5.940139e-03f,
+	-1.782131e-02f,
+	-3.007650e-03f,
+	8.173704e-03f,
+	1.572430e-03f,
+	-3.188491e-03f,
+	-6.629229e-04f,
+	1.016736e-03f,
+	2.884269e-04f,
+	-1.169443e-04f,
+	-2.157688e-05f,
+	0.000000e+00f
+};
+
+// blamp table: 2080 entries
+const float blamp[] = {
+	1.580000e-21f,
+	2.899826e-07f,
+	-1.986054e-06f,
+	1.827841e-06f,
+	-5.605325e-06f,
+	5.735851e-06f,
+	-1.239543e-05f,
+	1.370167e-05f,
+	-2.432149e-05f,
+	2.834301e-05f,
+	-4.554200e-05f,
+	5.741840e-05f,
+	-9.254071e-05f,
+	1.408367e-04f,
+	-2.816393e-04f,
+	7.553766e-04f,
+	-6.359896e-03f,
+	7.553697e-04f,
+	-2.816468e-04f,
+	1.408309e-04f,
+	-9.256601e-05f,
+	5.739927e-05f,
+	-4.559755e-05f,
+	2.831221e-05f,
+	-2.437830e-05f,
+	1.364946e-05f,
+	-1.245737e-05f,
+	5.722046e-06f,
+	-5.722046e-06f,
+	1.728535e-06f,
+	-2.086163e-06f,
+	1.788139e-07f,
+
+	3.110314e-15f,
+	3.033610e-07f,
+	-2.085569e-06f,
+	2.076938e-06f,
+	-6.139731e-06f,
+	6.710357e-06f,
+	-1.406797e-05f,
+	1.638347e-05f,
+	-2.846862e-05f,
+	3.452456e-05f,
+	-5.457371e-05f,
+	7.042931e-05f,
+	-1.113501e-04f,
+	1.687009e-04f,
+	-3.260003e-04f,
+	8.411251e-04f,
+	-5.879242e-03f,
+	6.696209e-04f,
+	-2.372861e-04f,
+	1.129508e-04f,
+	-7.376075e-05f,
+	4.437566e-05f,
+	-3.656745e-05f,
+	2.211332e-05f,
+	-2.020597e-05f,
+	1.096725e-05f,
+	-1.078844e-05f,
+	4.708767e-06f,
+	-5.185604e-06f,
+	1.490116e-06f,
+	-1.966953e-06f,
+	1.788139e-07f,
+
+	3.765157e-14f,
+	3.166807e-07f,
+	-2.184829e-06f,
+	2.325383e-06f,
+	-6.672798e-06f,
+	7.682414e-06f,
+	-1.573636e-05f,
+	1.905861e-05f,
+	-3.260554e-05f,
+	4.069088e-05f,
+	-6.358321e-05f,
+	8.340816e-05f,
+	-1.301130e-04f,
+	1.964957e-04f,
+	-3.702481e-04f,
+	9.266334e-04f,
+	-5.413839e-03f,
+	5.840957e-04f,
+	-1.930445e-04f,
+	8.514524e-05f,
+	-5.498528e-05f,
+	3.141165e-05f,
+	-2.753735e-05f,
+	1.594424e-05f,
+	-1.609325e-05f,
+	8.285046e-06f,
+	-9.119511e-06f,
+	3.755093e-06f,
+	-4.649162e-06f,
+	1.251698e-06f,
+	-1.907349e-06f,
+	1.788139e-07f,
+
+	2.108462e-13f,
+	3.298805e-07f,
+	-2.283571e-06f,
+	2.572515e-06f,
+	-7.203170e-06f,
+	8.649548e-06f,
+	-1.739642e-05f,
+	2.172041e-05f,
+	-3.672193e-05f,
+	4.682664e-05f,
+	-7.254814e-05f,
+	9.632271e-05f,
+	-1.487827e-04f,
+	2.241510e-04f,
+	-4.142681e-04f,
+	1.011656e-03f,
+	-4.963665e-03f,
+	4.990324e-04f,
+	-1.490116e-04f,
+	5.748868e-05f,
+	-3.632903e-05f,
+	1.847744e-05f,
+	-1.856685e-05f,
+	9.804964e-06f,
+	-1.198053e-05f,
+	5.662441e-06f,
+	-7.450581e-06f,
+	2.801418e-06f,
+	-4.112720e-06f,
+	1.013279e-06f,
+	-1.788139e-06f,
+	1.788139e-07f,
+
+	7.806025e-13f,
+	3.428954e-07f,
+	-2.381528e-06f,
+	2.817659e-06f,
+	-7.729468e-06f,
+	9.609254e-06f,
+	-1.904392e-05f,
+	2.436210e-05f,
+	-4.080743e-05f,
+	5.291638e-05f,
+	-8.144600e-05f,
+	1.091405e-04f,
+	-1.673120e-04f,
+	2.515961e-04f,
+	-4.579443e-04f,
+	1.095939e-03f,
+	-4.528692e-03f,
+	4.146248e-04f,
+	-1.052916e-04f,
+	3.002584e-05f,
+	-1.779199e-05f,
+	5.662441e-06f,
+	-9.685755e-06f,
+	3.725290e-06f,
+	-7.867813e-06f,
+	2.980232e-06f,
+	-5.781651e-06f,
+	1.847744e-06f,
+	-3.576279e-06f,
+	7.748604e-07f,
+	-1.668930e-06f,
+	1.192093e-07f,
+
+	2.229926e-12f,
+	3.556571e-07f,
+	-2.478421e-06f,
+	3.060127e-06f,
+	-8.250298e-06f,
+	1.055900e-05f,
+	-2.067458e-05f,
+	2.697687e-05f,
+	-4.485160e-05f,
+	5.894460e-05f,
+	-9.025419e-05f,
+	1.218289e-04f,
+	-1.856537e-04f,
+	2.787601e-04f,
+	-5.011595e-04f,
+	1.179224e-03f,
+	-4.108875e-03f,
+	3.310964e-04f,
+	-6.201863e-05f,
+	2.831221e-06f,
+	5.662441e-07f,
+	-7.033348e-06f,
+	-8.642673e-07f,
+	-2.324581e-06f,
+	-3.814697e-06f,
+	3.576279e-07f,
+	-4.172325e-06f,
+	8.940697e-07f,
+	-3.039837e-06f,
+	4.768372e-07f,
+	-1.609325e-06f,
+	1.192093e-07f,
+
+	5.340088e-12f,
+	3.680940e-07f,
+	-2.573970e-06f,
+	3.299222e-06f,
+	-8.764249e-06f,
+	1.149623e-05f,
+	-2.228414e-05f,
+	2.955789e-05f,
+	-4.884397e-05f,
+	6.489573e-05f,
+	-9.895006e-05f,
+	1.343552e-04f,
+	-2.037601e-04f,
+	3.055715e-04f,
+	-5.437954e-04f,
+	1.261245e-03f,
+	-3.704160e-03f,
+	2.486408e-04f,
+	-1.926720e-05f,
+	-2.402067e-05f,
+	1.871586e-05f,
+	-1.958013e-05f,
+	7.838011e-06f,
+	-8.285046e-06f,
+	1.788139e-07f,
+	-2.205372e-06f,
+	-2.563000e-06f,
+	-5.960464e-08f,
+	-2.563000e-06f,
+	2.384186e-07f,
+	-1.490116e-06f,
+	1.192093e-07f,
+
+	1.126152e-11f,
+	3.801310e-07f,
+	-2.667883e-06f,
+	3.534238e-06f,
+	-9.269901e-06f,
+	1.241839e-05f,
+	-2.386828e-05f,
+	3.209829e-05f,
+	-5.277406e-05f,
+	7.075422e-05f,
+	-1.075110e-04f,
+	1.466869e-04f,
+	-2.215841e-04f,
+	3.319588e-04f,
+	-5.857330e-04f,
+	1.341728e-03f,
+	-3.314479e-03f,
+	1.674518e-04f,
+	2.284348e-05f,
+	-5.050004e-05f,
+	3.659725e-05f,
+	-3.194809e-05f,
+	1.642108e-05f,
+	-1.415610e-05f,
+	4.112720e-06f,
+	-4.768372e-06f,
+	-9.536743e-07f,
+	-1.013279e-06f,
+	-2.026558e-06f,
+	-0.000000e+00f,
+	-1.370907e-06f,
+	1.192093e-07f,
+
+	2.158200e-11f,
+	3.916900e-07f,
+	-2.759868e-06f,
+	3.764462e-06f,
+	-9.765825e-06f,
+	1.332291e-05f,
+	-2.542269e-05f,
+	3.459125e-05f,
+	-5.663141e-05f,
+	7.650456e-05f,
+	-1.159144e-04f,
+	1.587914e-04f,
+	-2.390781e-04f,
+	3.578507e-04f,
+	-6.268527e-04f,
+	1.420396e-03f,
+	-2.939752e-03f,
+	8.770078e-05f,
+	6.425381e-05f,
+	-7.651746e-05f,
+	5.415082e-05f,
+	-4.410744e-05f,
+	2.488494e-05f,
+	-1.993775e-05f,
+	7.987022e-06f,
+	-7.271767e-06f,
+	5.960464e-07f,
+	-1.907349e-06f,
+	-1.549721e-06f,
+	-1.788139e-07f,
+	-1.311302e-06f,
+	1.192093e-07f,
+
+	3.839055e-11f,
+	4.026900e-07f,
+	-2.849626e-06f,
+	3.989177e-06f,
+	-1.025059e-05f,
+	1.420720e-05f,
+	-2.694309e-05f,
+	3.702993e-05f,
+	-6.040561e-05f,
+	8.213132e-05f,
+	-1.241379e-04f,
+	1.706363e-04f,
+	-2.561952e-04f,
+	3.831760e-04f,
+	-6.670349e-04f,
+	1.496964e-03f,
+	-2.579888e-03f,
+	9.566545e-06f,
+	1.048297e-04f,
+	-1.020432e-04f,
+	7.140636e-05f,
+	-5.602837e-05f,
+	3.314018e-05f,
+	-2.560019e-05f,
+	1.180172e-05f,
+	-9.715557e-06f,
+	2.145767e-06f,
+	-2.801418e-06f,
+	-1.013279e-06f,
+	-4.172325e-07f,
+	-1.192093e-06f,
+	5.960464e-08f,
+
+	6.433866e-11f,
+	4.130472e-07f,
+	-2.936854e-06f,
+	4.207661e-06f,
+	-1.072276e-05f,
+	1.506871e-05f,
+	-2.842518e-05f,
+	3.940756e-05f,
+	-6.408633e-05f,
+	8.761918e-05f,
+	-1.321592e-04f,
+	1.821896e-04f,
+	-2.728887e-04f,
+	4.078638e-04f,
+	-7.061600e-04f,
+	1.571142e-03f,
+	-2.234785e-03f,
+	-6.677955e-05f,
+	1.445264e-04f,
+	-1.269877e-04f,
+	8.824468e-05f,
+	-6.768107e-05f,
+	4.124641e-05f,
+	-3.114343e-05f,
+	1.549721e-05f,
+	-1.209974e-05f,
+	3.635883e-06f,
+	-3.695488e-06f,
+	-5.364418e-07f,
+	-6.556511e-07f,
+	-1.132488e-06f,
+	5.960464e-08f,
+
+	1.026978e-10f,
+	4.226750e-07f,
+	-3.021247e-06f,
+	4.419192e-06f,
+	-1.118090e-05f,
+	1.590490e-05f,
+	-2.986472e-05f,
+	4.171741e-05f,
+	-6.766331e-05f,
+	9.295299e-05f,
+	-1.399563e-04f,
+	1.934195e-04f,
+	-2.891122e-04f,
+	4.318441e-04f,
+	-7.441086e-04f,
+	1.642635e-03f,
+	-1.904326e-03f,
+	-1.411960e-04f,
+	1.832247e-04f,
+	-1.513213e-04f,
+	1.046658e-04f,
+	-7.903576e-05f,
+	4.914403e-05f,
+	-3.653765e-05f,
+	1.913309e-05f,
+	-1.448393e-05f,
+	5.125999e-06f,
+	-4.529953e-06f,
+	-1.192093e-07f,
+	-8.940697e-07f,
+	-1.013279e-06f,
+	5.960464e-08f,
+
+	1.574114e-10f,
+	4.314848e-07f,
+	-3.102497e-06f,
+	4.623048e-06f,
+	-1.162360e-05f,
+	1.671321e-05f,
+	-3.125750e-05f,
+	4.395281e-05f,
+	-7.112644e-05f,
+	9.811776e-05f,
+	-1.475075e-04f,
+	2.042947e-04f,
+	-3.048202e-04f,
+	4.550472e-04f,
+	-7.807620e-04f,
+	1.711145e-03f,
+	-1.588384e-03f,
+	-2.135262e-04f,
+	2.208501e-04f,
+	-1.749843e-04f,
+	1.206696e-04f,
+	-9.009242e-05f,
+	5.680323e-05f,
+	-4.178286e-05f,
+	2.264977e-05f,
+	-1.674891e-05f,
+	6.556511e-06f,
+	-5.364418e-06f,
+	3.576279e-07f,
+	-1.072884e-06f,
+	-9.536743e-07f,
+	5.960464e-08f,
+
+	2.331401e-10f,
+	4.393854e-07f,
+	-3.180294e-06f,
+	4.818508e-06f,
+	-1.204945e-05f,
+	1.749115e-05f,
+	-3.259937e-05f,
+	4.610723e-05f,
+	-7.446574e-05f,
+	1.030988e-04f,
+	-1.547914e-04f,
+	2.147843e-04f,
+	-3.199677e-04f,
+	4.774047e-04f,
+	-8.160025e-04f,
+	1.776367e-03f,
+	-1.286823e-03f,
+	-2.836362e-04f,
+	2.573431e-04f,
+	-1.979321e-04f,
+	1.361370e-04f,
+	-1.008213e-04f,
+	6.425381e-05f,
+	-4.687905e-05f,
+	2.610683e-05f,
+	-1.895428e-05f,
+	7.927418e-06f,
+	-6.139278e-06f,
+	8.344650e-07f,
+	-1.311302e-06f,
+	-8.344650e-07f,
+	5.960464e-08f,
+
+	3.353009e-10f,
+	4.462840e-07f,
+	-3.254330e-06f,
+	5.004859e-06f,
+	-1.245703e-05f,
+	1.823625e-05f,
+	-3.388622e-05f,
+	4.817419e-05f,
+	-7.767144e-05f,
+	1.078816e-04f,
+	-1.617871e-04f,
+	2.248583e-04f,
+	-3.345105e-04f,
+	4.988492e-04f,
+	-8.497136e-04f,
+	1.837994e-03f,
+	-9.994945e-04f,
+	-3.513992e-04f,
+	2.926290e-04f,
+	-2.201051e-04f,
+	1.511276e-04f,
+	-1.111925e-04f,
+	7.146597e-05f,
+	-5.182624e-05f,
+	2.938509e-05f,
+	-2.110004e-05f,
+	9.238720e-06f,
+	-6.914139e-06f,
+	1.251698e-06f,
+	-1.490116e-06f,
+	-7.748604e-07f,
+	5.960464e-08f,
+
+	4.701026e-10f,
+	4.520859e-07f,
+	-3.324295e-06f,
+	5.181391e-06f,
+	-1.284499e-05f,
+	1.894606e-05f,
+	-3.511405e-05f,
+	5.014739e-05f,
+	-8.073394e-05f,
+	1.124521e-04f,
+	-1.684740e-04f,
+	2.344870e-04f,
+	-3.484056e-04f,
+	5.193146e-04f,
+	-8.817801e-04f,
+	1.895714e-03f,
+	-7.262379e-04f,
+	-4.166961e-04f,
+	3.266186e-04f,
+	-2.414733e-04f,
+	1.655519e-04f,
+	-1.211762e-04f,
+	7.838011e-05f,
+	-5.656481e-05f,
+	3.260374e-05f,
+	-2.318621e-05f,
+	1.055002e-05f,
+	-7.688999e-06f,
+	1.668930e-06f,
+	-1.668930e-06f,
+	-7.152557e-07f,
+	-0.000000e+00f,
+
+	6.445743e-10f,
+	4.566952e-07f,
+	-3.389882e-06f,
+	5.347405e-06f,
+	-1.321195e-05f,
+	1.961822e-05f,
+	-3.627891e-05f,
+	5.202064e-05f,
+	-8.364389e-05f,
+	1.167965e-04f,
+	-1.748323e-04f,
+	2.436416e-04f,
+	-3.616108e-04f,
+	5.387363e-04f,
+	-9.120889e-04f,
+	1.949212e-03f,
+	-4.668832e-04f,
+	-4.794151e-04f,
+	3.592670e-04f,
+	-2.619773e-04f,
+	1.794100e-04f,
+	-1.307428e-04f,
+	8.505583e-05f,
+	-6.112456e-05f,
+	3.564358e-05f,
+	-2.515316e-05f,
+	1.180172e-05f,
+	-8.404255e-06f,
+	2.026558e-06f,
+	-1.847744e-06f,
+	-6.556511e-07f,
+	-0.000000e+00f,
+
+	8.665851e-10f,
+	4.600148e-07f,
+	-3.450784e-06f,
+	5.502211e-06f,
+	-1.355660e-05f,
+	2.025038e-05f,
+	-3.737697e-05f,
+	5.378793e-05f,
+	-8.639220e-05f,
+	1.209014e-04f,
+	-1.808424e-04f,
+	2.522943e-04f,
+	-3.740852e-04f,
+	5.570512e-04f,
+	-9.405288e-04f,
+	1.998171e-03f,
+	-2.212506e-04f,
+	-5.394593e-04f,
+	3.904998e-04f,
+	-2.816021e-04f,
+	1.926422e-04f,
+	-1.399219e-04f,
+	9.140372e-05f,
+	-6.547570e-05f,
+	3.856421e-05f,
+	-2.706051e-05f,
+	1.299381e-05f,
+	-9.119511e-06f,
+	2.443790e-06f,
+	-2.026558e-06f,
+	-5.364418e-07f,
+	-0.000000e+00f,
+
+	1.144857e-09f,
+	4.619469e-07f,
+	-3.506700e-06f,
+	5.645134e-06f,
+	-1.387763e-05f,
+	2.084027e-05f,
+	-3.840451e-05f,
+	5.544342e-05f,
+	-8.897006e-05f,
+	1.247538e-04f,
+	-1.864858e-04f,
+	2.604178e-04f,
+	-3.857891e-04f,
+	5.741981e-04f,
+	-9.669909e-04f,
+	2.042270e-03f,
+	1.084991e-05f,
+	-5.967319e-04f,
+	4.202724e-04f,
+	-3.002882e-04f,
+	2.052784e-04f,
+	-1.486540e-04f,
+	9.748340e-05f,
+	-6.964803e-05f,
+	4.136562e-05f,
+	-2.884865e-05f,
+	1.412630e-05f,
+	-9.775162e-06f,
+	2.801418e-06f,
+	-2.205372e-06f,
+	-4.768372e-07f,
+	-0.000000e+00f,
+
+	1.488970e-09f,
+	4.623933e-07f,
+	-3.557331e-06f,
+	5.775511e-06f,
+	-1.417379e-05f,
+	2.138569e-05f,
+	-3.935790e-05f,
+	5.698147e-05f,
+	-9.136897e-05f,
+	1.283412e-04f,
+	-1.917442e-04f,
+	2.679863e-04f,
+	-3.966844e-04f,
+	5.901178e-04f,
+	-9.913694e-04f,
+	2.081188e-03f,
+	2.296232e-04f,
+	-6.511435e-04f,
+	4.485399e-04f,
+	-3.180206e-04f,
+	2.172291e-04f,
+	-1.569092e-04f,
+	1.032352e-04f,
+	-7.358193e-05f,
+	4.404783e-05f,
+	-3.057718e-05f,
+	1.519918e-05f,
+	-1.037121e-05f,
+	3.159046e-06f,
+	-2.384186e-06f,
+	-4.172325e-07f,
+	-0.000000e+00f,
+
+	1.909357e-09f,
+	4.612555e-07f,
+	-3.602385e-06f,
+	5.892699e-06f,
+	-1.444384e-05f,
+	2.188452e-05f,
+	-4.023369e-05f,
+	5.839666e-05f,
+	-9.358074e-05f,
+	1.316517e-04f,
+	-1.966004e-04f,
+	2.749746e-04f,
+	-4.067343e-04f,
+	6.047534e-04f,
+	-1.013561e-03f,
+	2.114601e-03f,
+	4.352741e-04f,
+	-7.026345e-04f,
+	4.752427e-04f,
+	-3.347546e-04f,
+	2.285242e-04f,
+	-1.647174e-04f,
+	1.086891e-04f,
+	-7.730722e-05f,
+	4.655123e-05f,
+	-3.218651e-05f,
+	1.621246e-05f,
+	-1.096725e-05f,
+	3.457069e-06f,
+	-2.503395e-06f,
+	-3.576279e-07f,
+	-0.000000e+00f,
+
+	2.417294e-09f,
+	4.584355e-07f,
+	-3.641574e-06f,
+	5.996072e-06f,
+	-1.468660e-05f,
+	2.233469e-05f,
+	-4.102853e-05f,
+	5.968380e-05f,
+	-9.559758e-05f,
+	1.346738e-04f,
+	-2.010379e-04f,
+	2.813589e-04f,
+	-4.159037e-04f,
+	6.180501e-04f,
+	-1.033466e-03f,
+	2.142183e-03f,
+	6.280243e-04f,
+	-7.511377e-04f,
+	5.003363e-04f,
+	-3.504753e-04f,
+	2.391338e-04f,
+	-1.720488e-04f,
+	1.137853e-04f,
+	-8.079410e-05f,
+	4.887581e-05f,
+	-3.373623e-05f,
+	1.716614e-05f,
+	-1.156330e-05f,
+	3.814697e-06f,
+	-2.682209e-06f,
+	-2.980232e-07f,
+	-0.000000e+00f,
+
+	3.024884e-09f,
+	4.538358e-07f,
+	-3.674621e-06f,
+	6.085026e-06f,
+	-1.490095e-05f,
+	2.273427e-05f,
+	-4.173923e-05f,
+	6.083793e-05f,
+	-9.741205e-05f,
+	1.373967e-04f,
+	-2.050408e-04f,
+	2.871166e-04f,
+	-4.241593e-04f,
+	6.299557e-04f,
+	-1.050988e-03f,
+	2.163609e-03f,
+	8.081030e-04f,
+	-7.965863e-04f,
+	5.237907e-04f,
+	-3.651381e-04f,
+	2.489984e-04f,
+	-1.789033e-04f,
+	1.185238e-04f,
+	-8.407235e-05f,
+	5.108118e-05f,
+	-3.516674e-05f,
+	1.806021e-05f,
+	-1.209974e-05f,
+	4.112720e-06f,
+	-2.801418e-06f,
+	-2.384186e-07f,
+	-0.000000e+00f,
+
+	3.745020e-09f,
+	4.473600e-07f,
+	-3.701253e-06f,
+	6.158982e-06f,
+	-1.508579e-05f,
+	2.308136e-05f,
+	-4.236277e-05f,
+	6.185437e-05f,
+	-9.901713e-05f,
+	1.398099e-04f,
+	-2.085944e-04f,
+	2.922262e-04f,
+	-4.314695e-04f,
+	6.404207e-04f,
+	-1.066035e-03f,
+	2.178551e-03f,
+	9.757448e-04f,
+	-8.389428e-04f,
+	5.455762e-04f,
+	-3.787279e-04f,
+	2.581775e-04f,
+	-1.852214e-04f,
+	1.229346e-04f,
+	-8.708239e-05f,
+	5.316734e-05f,
+	-3.647804e-05f,
+	1.889467e-05f,
+	-1.257658e-05f,
+	4.351139e-06f,
+	-2.920628e-06f,
+	-1.788139e-07f,
+	-5.960464e-08f,
+
+	4.591358e-09f,
+	4.389129e-07f,
+	-3.721208e-06f,
+	6.217383e-06f,
+	-1.524009e-05f,
+	2.337422e-05f,
+	-4.289630e-05f,
+	6.272872e-05f,
+	-1.004062e-04f,
+	1.419040e-04f,
+	-2.116848e-04f,
+	2.966678e-04f,
+	-4.378047e-04f,
+	6.493983e-04f,
+	-1.078518e-03f,
+	2.186684e-03f,
+	1.131197e-03f,
+	-8.781627e-04f,
+	5.656630e-04f,
+	-3.912300e-04f,
+	2.665818e-04f,
+	-1.910627e-04f,
+	1.270175e-04f,
+	-8.988380e-05f,
+	5.501509e-05f,
+	-3.772974e-05f,
+	1.966953e-05f,
+	-1.299381e-05f,
+	4.589558e-06f,
+	-3.039837e-06f,
+	-1.192093e-07f,
+	-5.960464e-08f,
+
+	5.578261e-09f,
+	4.284014e-07f,
+	-3.734236e-06f,
+	6.259704e-06f,
+	-1.536288e-05f,
+	2.361118e-05f,
+	-4.333714e-05f,
+	6.345684e-05f,
+	-1.015732e-04f,
+	1.436699e-04f,
+	-2.142991e-04f,
+	3.004226e-04f,
+	-4.431373e-04f,
+	6.568446e-04f,
+	-1.088355e-03f,
+	2.187683e-03f,
+	1.274711e-03f,
+	-9.142160e-04f,
+	5.840212e-04f,
+	-4.026294e-04f,
+	2.742410e-04f,
+	-1.963377e-04f,
+	1.307130e-04f,
+	-9.241700e-05f,
+	5.674362e-05f,
+	-3.880262e-05f,
+	2.038479e-05f,
+	-1.341105e-05f,
+	4.827976e-06f,
+	-3.159046e-06f,
+	-5.960464e-08f,
+	-5.960464e-08f,
+
+	6.720754e-09f,
+	4.157345e-07f,
+	-3.740096e-06f,
+	6.285445e-06f,
+	-1.545324e-05f,
+	2.379070e-05f,
+	-4.368282e-05f,
+	6.403493e-05f,
+	-1.025124e-04f,
+	1.450994e-04f,
+	-2.164254e-04f,
+	3.034736e-04f,
+	-4.474419e-04f,
+	6.627192e-04f,
+	-1.095465e-03f,
+	2.181220e-03f,
+	1.406547e-03f,
+	-9.470880e-04f,
+	6.006211e-04f,
+	-4.128963e-04f,
+	2.811551e-04f,
+	-2.011359e-04f,
+	1.340210e-04f,
+	-9.471178e-05f,
+	5.829334e-05f,
+	-3.981590e-05f,
+	2.104044e-05f,
+	-1.382828e-05f,
+	5.066395e-06f,
+	-3.278255e-06f,
+	-0.000000e+00f,
+	-5.960464e-08f,
+
+	8.034450e-09f,
+	4.008238e-07f,
+	-3.738561e-06f,
+	6.294143e-06f,
+	-1.551034e-05f,
+	2.391134e-05f,
+	-4.393107e-05f,
+	6.445951e-05f,
+	-1.032186e-04f,
+	1.461850e-04f,
+	-2.180528e-04f,
+	3.058050e-04f,
+	-4.506952e-04f,
+	6.669846e-04f,
+	-1.099776e-03f,
+	2.166974e-03f,
+	1.526974e-03f,
+	-9.767562e-04f,
+	6.154776e-04f,
+	-4.220456e-04f,
+	2.872646e-04f,
+	-2.053678e-04f,
+	1.370013e-04f,
+	-9.676814e-05f,
+	5.972385e-05f,
+	-4.076958e-05f,
+	2.163649e-05f,
+	-1.412630e-05f,
+	5.245209e-06f,
+	-3.397465e-06f,
+	-0.000000e+00f,
+	-5.960464e-08f,
+
+	9.535487e-09f,
+	3.835841e-07f,
+	-3.729416e-06f,
+	6.285363e-06f,
+	-1.553338e-05f,
+	2.397181e-05f,
+	-4.407980e-05f,
+	6.472741e-05f,
+	-1.036871e-04f,
+	1.469198e-04f,
+	-2.191718e-04f,
+	3.074028e-04f,
+	-4.528763e-04f,
+	6.696067e-04f,
+	-1.101218e-03f,
+	2.144622e-03f,
+	1.636267e-03f,
+	-1.003213e-03f,
+	6.285608e-04f,
+	-4.300475e-04f,
+	2.926290e-04f,
+	-2.090633e-04f,
+	1.395941e-04f,
+	-9.855628e-05f,
+	6.091595e-05f,
+	-4.154444e-05f,
+	2.211332e-05f,
+	-1.448393e-05f,
+	5.424023e-06f,
+	-3.457069e-06f,
+	5.960464e-08f,
+	-5.960464e-08f,
+
+	1.124044e-08f,
+	3.639334e-07f,
+	-3.712461e-06f,
+	6.258711e-06f,
+	-1.552167e-05f,
+	2.397093e-05f,
+	-4.412717e-05f,
+	6.483583e-05f,
+	-1.039139e-04f,
+	1.472980e-04f,
+	-2.197735e-04f,
+	3.082546e-04f,
+	-4.539665e-04f,
+	6.705550e-04f,
+	-1.099728e-03f,
+	2.113844e-03f,
+	1.734708e-03f,
+	-1.026466e-03f,
+	6.398559e-04f,
+	-4.369020e-04f,
+	2.971888e-04f,
+	-2.122223e-04f,
+	1.417994e-04f,
+	-1.000762e-04f,
+	6.198883e-05f,
+	-4.225969e-05f,
+	2.259016e-05f,
+	-1.472235e-05f,
+	5.602837e-06f,
+	-3.516674e-06f,
+	1.192093e-07f,
+	-5.960464e-08f,
+
+	1.316624e-08f,
+	3.417940e-07f,
+	-3.687513e-06f,
+	6.213826e-06f,
+	-1.547457e-05f,
+	2.390765e-05f,
+	-4.407154e-05f,
+	6.478230e-05f,
+	-1.038952e-04f,
+	1.473143e-04f,
+	-2.198507e-04f,
+	3.083497e-04f,
+	-4.539496e-04f,
+	6.698028e-04f,
+	-1.095250e-03f,
+	2.074323e-03f,
+	1.822578e-03f,
+	-1.046523e-03f,
+	6.493777e-04f,
+	-4.425943e-04f,
+	3.009737e-04f,
+	-2.148151e-04f,
+	1.436472e-04f,
+	-1.013577e-04f,
+	6.288290e-05f,
+	-4.285574e-05f,
+	2.294779e-05f,
+	-1.496077e-05f,
+	5.781651e-06f,
+	-3.576279e-06f,
+	1.192093e-07f,
+	-5.960464e-08f,
+
+	1.533007e-08f,
+	3.170926e-07f,
+	-3.654404e-06f,
+	6.150388e-06f,
+	-1.539153e-05f,
+	2.378109e-05f,
+	-4.391153e-05f,
+	6.456475e-05f,
+	-1.036282e-04f,
+	1.469643e-04f,
+	-2.193972e-04f,
+	3.076791e-04f,
+	-4.528121e-04f,
+	6.673270e-04f,
+	-1.087731e-03f,
+	2.025745e-03f,
+	1.900176e-03f,
+	-1.063414e-03f,
+	6.571263e-04f,
+	-4.471540e-04f,
+	3.039837e-04f,
+	-2.169013e-04f,
+	1.451075e-04f,
+	-1.023710e-04f,
+	6.359816e-05f,
+	-4.333258e-05f,
+	2.330542e-05f,
+	-1.513958e-05f,
+	5.900860e-06f,
+	-3.635883e-06f,
+	1.788139e-07f,
+	-5.960464e-08f,
+
+	1.774926e-08f,
+	2.897603e-07f,
+	-3.612982e-06f,
+	6.068119e-06f,
+	-1.527207e-05f,
+	2.359048e-05f,
+	-4.364597e-05f,
+	6.418147e-05f,
+	-1.031102e-04f,
+	1.462447e-04f,
+	-2.184079e-04f,
+	3.062355e-04f,
+	-4.505429e-04f,
+	6.631084e-04f,
+	-1.077128e-03f,
+	1.967800e-03f,
+	1.967797e-03f,
+	-1.077138e-03f,
+	6.631017e-04f,
+	-4.505664e-04f,
+	3.062189e-04f,
+	-2.184212e-04f,
+	1.462102e-04f,
+	-1.031458e-04f,
+	6.413460e-05f,
+	-4.369020e-05f,
+	2.354383e-05f,
+	-1.531839e-05f,
+	5.960464e-06f,
+	-3.695488e-06f,
+	1.788139e-07f,
+	-5.960464e-08f,
+
+	2.044119e-08f,
+	2.597339e-07f,
+	-3.563116e-06f,
+	5.966781e-06f,
+	-1.511581e-05f,
+	2.333521e-05f,
+	-4.327397e-05f,
+	6.363112e-05f,
+	-1.023395e-04f,
+	1.451526e-04f,
+	-2.168791e-04f,
+	3.040136e-04f,
+	-4.471334e-04f,
+	6.571318e-04f,
+	-1.063402e-03f,
+	1.900179e-03f,
+	2.025742e-03f,
+	-1.087740e-03f,
+	6.673187e-04f,
+	-4.528314e-04f,
+	3.076494e-04f,
+	-2.194047e-04f,
+	1.469254e-04f,
+	-1.036823e-04f,
+	6.455183e-05f,
+	-4.392862e-05f,
+	2.372265e-05f,
+	-1.543760e-05f,
+	6.079674e-06f,
+	-3.755093e-06f,
+	2.384186e-07f,
+	-5.960464e-08f,
+
+	2.342315e-08f,
+	2.269556e-07f,
+	-3.504691e-06f,
+	5.846184e-06f,
+	-1.492244e-05f,
+	2.301483e-05f,
+	-4.279485e-05f,
+	6.291280e-05f,
+	-1.013147e-04f,
+	1.436865e-04f,
+	-2.148084e-04f,
+	3.010097e-04f,
+	-4.425781e-04f,
+	6.493861e-04f,
+	-1.046522e-03f,
+	1.822582e-03f,
+	2.074320e-03f,
+	-1.095265e-03f,
+	6.697923e-04f,
+	-4.539788e-04f,
+	3.083348e-04f,
+	-2.198815e-04f,
+	1.472831e-04f,
+	-1.039505e-04f,
+	6.473064e-05f,
+	-4.410744e-05f,
+	2.384186e-05f,
+	-1.549721e-05f,
+	6.139278e-06f,
+	-3.755093e-06f,
+	2.384186e-07f,
+	-5.960464e-08f,
+
+	2.671221e-08f,
+	1.913739e-07f,
+	-3.437616e-06f,
+	5.706180e-06f,
+	-1.469175e-05f,
+	2.262904e-05f,
+	-4.220822e-05f,
+	6.202599e-05f,
+	-1.000352e-04f,
+	1.418454e-04f,
+	-2.121947e-04f,
+	2.972222e-04f,
+	-4.368738e-04f,
+	6.398643e-04f,
+	-1.026463e-03f,
+	1.734710e-03f,
+	2.113841e-03f,
+	-1.099743e-03f,
+	6.705523e-04f,
+	-4.539937e-04f,
+	3.082454e-04f,
+	-2.197921e-04f,
+	1.472533e-04f,
+	-1.039505e-04f,
+	6.479025e-05f,
+	-4.416704e-05f,
+	2.396107e-05f,
+	-1.555681e-05f,
+	6.139278e-06f,
+	-3.814697e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	3.032512e-08f,
+	1.529438e-07f,
+	-3.361818e-06f,
+	5.546670e-06f,
+	-1.442360e-05f,
+	2.217770e-05f,
+	-4.151393e-05f,
+	6.097057e-05f,
+	-9.850099e-05f,
+	1.396294e-04f,
+	-2.090381e-04f,
+	2.926512e-04f,
+	-4.300203e-04f,
+	6.285638e-04f,
+	-1.003209e-03f,
+	1.636271e-03f,
+	2.144620e-03f,
+	-1.101233e-03f,
+	6.695986e-04f,
+	-4.529059e-04f,
+	3.073812e-04f,
+	-2.191961e-04f,
+	1.468658e-04f,
+	-1.037419e-04f,
+	6.467104e-05f,
+	-4.410744e-05f,
+	2.396107e-05f,
+	-1.555681e-05f,
+	6.198883e-06f,
+	-3.814697e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	3.427812e-08f,
+	1.116273e-07f,
+	-3.277247e-06f,
+	5.367604e-06f,
+	-1.411798e-05f,
+	2.166084e-05f,
+	-4.071213e-05f,
+	5.974685e-05f,
+	-9.671263e-05f,
+	1.370395e-04f,
+	-2.053402e-04f,
+	2.872990e-04f,
+	-4.220203e-04f,
+	6.154862e-04f,
+	-9.767489e-04f,
+	1.526978e-03f,
+	2.166972e-03f,
+	-1.099788e-03f,
+	6.669760e-04f,
+	-4.507154e-04f,
+	3.057718e-04f,
+	-2.180636e-04f,
+	1.461506e-04f,
+	-1.032650e-04f,
+	6.443262e-05f,
+	-4.398823e-05f,
+	2.390146e-05f,
+	-1.555681e-05f,
+	6.198883e-06f,
+	-3.814697e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	3.858687e-08f,
+	6.739359e-08f,
+	-3.183874e-06f,
+	5.168979e-06f,
+	-1.377495e-05f,
+	2.107863e-05f,
+	-3.980320e-05f,
+	5.835556e-05f,
+	-9.467133e-05f,
+	1.340776e-04f,
+	-2.011039e-04f,
+	2.811696e-04f,
+	-4.128791e-04f,
+	6.006375e-04f,
+	-9.470819e-04f,
+	1.406550e-03f,
+	2.181217e-03f,
+	-1.095474e-03f,
+	6.627142e-04f,
+	-4.474670e-04f,
+	3.034472e-04f,
+	-2.164543e-04f,
+	1.450479e-04f,
+	-1.025498e-04f,
+	6.401539e-05f,
+	-4.374981e-05f,
+	2.378225e-05f,
+	-1.549721e-05f,
+	6.198883e-06f,
+	-3.814697e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	4.326622e-08f,
+	2.021991e-08f,
+	-3.081693e-06f,
+	4.950847e-06f,
+	-1.339466e-05f,
+	2.043144e-05f,
+	-3.878781e-05f,
+	5.679786e-05f,
+	-9.237898e-05f,
+	1.307466e-04f,
+	-1.963333e-04f,
+	2.742690e-04f,
+	-4.026050e-04f,
+	5.840281e-04f,
+	-9.142137e-04f,
+	1.274713e-03f,
+	2.187680e-03f,
+	-1.088366e-03f,
+	6.568283e-04f,
+	-4.431605e-04f,
+	3.004074e-04f,
+	-2.143085e-04f,
+	1.436174e-04f,
+	-1.016259e-04f,
+	6.341934e-05f,
+	-4.339218e-05f,
+	2.354383e-05f,
+	-1.537800e-05f,
+	6.139278e-06f,
+	-3.814697e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	4.833011e-08f,
+	-2.990852e-08f,
+	-2.970725e-06f,
+	4.713307e-06f,
+	-1.297737e-05f,
+	1.971979e-05f,
+	-3.766692e-05f,
+	5.507532e-05f,
+	-8.983805e-05f,
+	1.270503e-04f,
+	-1.910340e-04f,
+	2.666053e-04f,
+	-3.912093e-04f,
+	5.656731e-04f,
+	-8.781583e-04f,
+	1.131198e-03f,
+	2.186682e-03f,
+	-1.078531e-03f,
+	6.493926e-04f,
+	-4.378259e-04f,
+	2.966523e-04f,
+	-2.117157e-04f,
+	1.418591e-04f,
+	-1.004636e-04f,
+	6.270409e-05f,
+	-4.291534e-05f,
+	2.336502e-05f,
+	-1.525879e-05f,
+	6.139278e-06f,
+	-3.814697e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	5.379141e-08f,
+	-8.299788e-08f,
+	-2.851011e-06f,
+	4.456514e-06f,
+	-1.252344e-05f,
+	1.894436e-05f,
+	-3.644174e-05f,
+	5.318998e-05f,
+	-8.705173e-05f,
+	1.229934e-04f,
+	-1.852131e-04f,
+	2.581883e-04f,
+	-3.787059e-04f,
+	5.455917e-04f,
+	-8.389378e-04f,
+	9.757464e-04f,
+	2.178550e-03f,
+	-1.066044e-03f,
+	6.404072e-04f,
+	-4.314929e-04f,
+	2.922118e-04f,
+	-2.086163e-04f,
+	1.397729e-04f,
+	-9.906292e-05f,
+	6.181002e-05f,
+	-4.237890e-05f,
+	2.306700e-05f,
+	-1.513958e-05f,
+	6.079674e-06f,
+	-3.814697e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	5.966174e-08f,
+	-1.390455e-07f,
+	-2.722621e-06f,
+	4.180674e-06f,
+	-1.203333e-05f,
+	1.810604e-05f,
+	-3.511378e-05f,
+	5.114425e-05f,
+	-8.402379e-05f,
+	1.185817e-04f,
+	-1.788787e-04f,
+	2.490300e-04f,
+	-3.651119e-04f,
+	5.238081e-04f,
+	-7.965825e-04f,
+	8.081039e-04f,
+	2.163604e-03f,
+	-1.051001e-03f,
+	6.299466e-04f,
+	-4.241765e-04f,
+	2.870858e-04f,
+	-2.050698e-04f,
+	1.373589e-04f,
+	-9.745359e-05f,
+	6.079674e-05f,
+	-4.178286e-05f,
+	2.270937e-05f,
+	-1.496077e-05f,
+	6.020069e-06f,
+	-3.755093e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	6.595133e-08f,
+	-1.980394e-07f,
+	-2.585647e-06f,
+	3.886049e-06f,
+	-1.150759e-05f,
+	1.720585e-05f,
+	-3.368480e-05f,
+	4.894102e-05f,
+	-8.075868e-05f,
+	1.138217e-04f,
+	-1.720406e-04f,
+	2.391444e-04f,
+	-3.504471e-04f,
+	5.003508e-04f,
+	-7.511316e-04f,
+	6.280258e-04f,
+	2.142180e-03f,
+	-1.033477e-03f,
+	6.180406e-04f,
+	-4.159212e-04f,
+	2.813339e-04f,
+	-2.010465e-04f,
+	1.346171e-04f,
+	-9.563565e-05f,
+	5.966425e-05f,
+	-4.106760e-05f,
+	2.229214e-05f,
+	-1.472235e-05f,
+	5.900860e-06f,
+	-3.755093e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	7.266886e-08f,
+	-2.599583e-07f,
+	-2.440208e-06f,
+	3.572954e-06f,
+	-1.094688e-05f,
+	1.624500e-05f,
+	-3.215687e-05f,
+	4.658360e-05f,
+	-7.726149e-05f,
+	1.087210e-04f,
+	-1.647098e-04f,
+	2.285471e-04f,
+	-3.347343e-04f,
+	4.752528e-04f,
+	-7.026325e-04f,
+	4.352751e-04f,
+	2.114598e-03f,
+	-1.013570e-03f,
+	6.047487e-04f,
+	-4.067570e-04f,
+	2.749562e-04f,
+	-1.966059e-04f,
+	1.316071e-04f,
+	-9.363890e-05f,
+	5.835295e-05f,
+	-4.029274e-05f,
+	2.187490e-05f,
+	-1.448393e-05f,
+	5.781651e-06f,
+	-3.695488e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	7.982128e-08f,
+	-3.247707e-07f,
+	-2.286450e-06f,
+	3.241759e-06f,
+	-1.035195e-05f,
+	1.522487e-05f,
+	-3.053233e-05f,
+	4.407570e-05f,
+	-7.353791e-05f,
+	1.032882e-04f,
+	-1.568987e-04f,
+	2.172561e-04f,
+	-3.179989e-04f,
+	4.485519e-04f,
+	-6.511415e-04f,
+	2.296236e-04f,
+	2.081186e-03f,
+	-9.913817e-04f,
+	5.901009e-04f,
+	-3.967136e-04f,
+	2.679527e-04f,
+	-1.917481e-04f,
+	1.282990e-04f,
+	-9.140372e-05f,
+	5.692244e-05f,
+	-3.939867e-05f,
+	2.133846e-05f,
+	-1.418591e-05f,
+	5.662441e-06f,
+	-3.635883e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	8.741367e-08f,
+	-3.924353e-07f,
+	-2.124545e-06f,
+	2.892891e-06f,
+	-9.723673e-06f,
+	1.414703e-05f,
+	-2.881377e-05f,
+	4.142147e-05f,
+	-6.959431e-05f,
+	9.753257e-05f,
+	-1.486208e-04f,
+	2.052909e-04f,
+	-3.002696e-04f,
+	4.202901e-04f,
+	-5.967236e-04f,
+	1.085194e-05f,
+	2.042267e-03f,
+	-9.670034e-04f,
+	5.741864e-04f,
+	-3.858060e-04f,
+	2.603829e-04f,
+	-1.865029e-04f,
+	1.247227e-04f,
+	-8.901954e-05f,
+	5.537271e-05f,
+	-3.844500e-05f,
+	2.080202e-05f,
+	-1.388788e-05f,
+	5.543232e-06f,
+	-3.576279e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	9.544908e-08f,
+	-4.629003e-07f,
+	-1.954691e-06f,
+	2.526827e-06f,
+	-9.063001e-06f,
+	1.301318e-05f,
+	-2.700408e-05f,
+	3.862550e-05f,
+	-6.543764e-05f,
+	9.146451e-05f,
+	-1.398913e-04f,
+	1.926730e-04f,
+	-2.815774e-04f,
+	3.905143e-04f,
+	-5.394528e-04f,
+	-2.212500e-04f,
+	1.998167e-03f,
+	-9.405389e-04f,
+	5.570352e-04f,
+	-3.741086e-04f,
+	2.522767e-04f,
+	-1.808703e-04f,
+	1.208484e-04f,
+	-8.642673e-05f,
+	5.376339e-05f,
+	-3.743172e-05f,
+	2.020597e-05f,
+	-1.358986e-05f,
+	5.424023e-06f,
+	-3.516674e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	1.039283e-07f,
+	-5.361034e-07f,
+	-1.777114e-06f,
+	2.144104e-06f,
+	-8.370994e-06f,
+	1.182523e-05f,
+	-2.510640e-05f,
+	3.569276e-05f,
+	-6.107550e-05f,
+	8.509523e-05f,
+	-1.307263e-04f,
+	1.794260e-04f,
+	-2.619564e-04f,
+	3.592754e-04f,
+	-4.794120e-04f,
+	-4.668827e-04f,
+	1.949210e-03f,
+	-9.121001e-04f,
+	5.387217e-04f,
+	-3.616363e-04f,
+	2.436340e-04f,
+	-1.748502e-04f,
+	1.167655e-04f,
+	-8.368492e-05f,
+	5.197525e-05f,
+	-3.629923e-05f,
+	1.960993e-05f,
+	-1.323223e-05f,
+	5.245209e-06f,
+	-3.457069e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	1.128499e-07f,
+	-6.119715e-07f,
+	-1.592067e-06f,
+	1.745312e-06f,
+	-7.648811e-06f,
+	1.058522e-05f,
+	-2.312415e-05f,
+	3.262862e-05f,
+	-5.651606e-05f,
+	7.843678e-05f,
+	-1.211434e-04f,
+	1.655751e-04f,
+	-2.414434e-04f,
+	3.266292e-04f,
+	-4.166930e-04f,
+	-7.262369e-04f,
+	1.895711e-03f,
+	-8.817911e-04f,
+	5.193055e-04f,
+	-3.484339e-04f,
+	2.344549e-04f,
+	-1.685023e-04f,
+	1.124144e-04f,
+	-8.076429e-05f,
+	5.012751e-05f,
+	-3.516674e-05f,
+	1.889467e-05f,
+	-1.287460e-05f,
+	5.066395e-06f,
+	-3.397465e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	1.222099e-07f,
+	-6.904204e-07f,
+	-1.399828e-06f,
+	1.331094e-06f,
+	-6.897708e-06f,
+	9.295385e-06f,
+	-2.106100e-05f,
+	2.943888e-05f,
+	-5.176808e-05f,
+	7.150211e-05f,
+	-1.111613e-04f,
+	1.511472e-04f,
+	-2.200776e-04f,
+	2.926355e-04f,
+	-3.513969e-04f,
+	-9.994933e-04f,
+	1.837987e-03f,
+	-8.497238e-04f,
+	4.988462e-04f,
+	-3.345311e-04f,
+	2.248287e-04f,
+	-1.617968e-04f,
+	1.078248e-04f,
+	-7.772446e-05f,
+	4.816055e-05f,
+	-3.391504e-05f,
+	1.817942e-05f,
+	-1.251698e-05f,
+	4.887581e-06f,
+	-3.337860e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	1.320015e-07f,
+	-7.713552e-07f,
+	-1.200706e-06f,
+	9.021492e-07f,
+	-6.119037e-06f,
+	7.958100e-06f,
+	-1.892088e-05f,
+	2.612971e-05f,
+	-4.684091e-05f,
+	6.430499e-05f,
+	-1.008000e-04f,
+	1.361710e-04f,
+	-1.979010e-04f,
+	2.573586e-04f,
+	-2.836335e-04f,
+	-1.286822e-03f,
+	1.776360e-03f,
+	-8.160174e-04f,
+	4.773885e-04f,
+	-3.199875e-04f,
+	2.147555e-04f,
+	-1.548231e-04f,
+	1.030564e-04f,
+	-7.450581e-05f,
+	4.607439e-05f,
+	-3.266335e-05f,
+	1.746416e-05f,
+	-1.209974e-05f,
+	4.708767e-06f,
+	-3.278255e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	1.422155e-07f,
+	-8.546694e-07f,
+	-9.950314e-07f,
+	4.592271e-07f,
+	-5.314245e-06f,
+	6.575903e-06f,
+	-1.670797e-05f,
+	2.270765e-05f,
+	-4.174445e-05f,
+	5.685997e-05f,
+	-9.008046e-05f,
+	1.206771e-04f,
+	-1.749583e-04f,
+	2.208668e-04f,
+	-2.135221e-04f,
+	-1.588383e-03f,
+	1.711138e-03f,
+	-7.807761e-04f,
+	4.550368e-04f,
+	-3.048480e-04f,
+	2.042651e-04f,
+	-1.475215e-04f,
+	9.807944e-05f,
+	-7.116795e-05f,
+	4.392862e-05f,
+	-3.129244e-05f,
+	1.668930e-05f,
+	-1.168251e-05f,
+	4.529953e-06f,
+	-3.218651e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	1.528393e-07f,
+	-9.402455e-07f,
+	-7.831657e-07f,
+	3.131211e-09f,
+	-4.484873e-06f,
+	5.151487e-06f,
+	-1.442668e-05f,
+	1.917962e-05f,
+	-3.648914e-05f,
+	4.918243e-05f,
+	-7.902503e-05f,
+	1.046975e-04f,
+	-1.512962e-04f,
+	1.832328e-04f,
+	-1.411908e-04f,
+	-1.904324e-03f,
+	1.642630e-03f,
+	-7.441193e-04f,
+	4.318357e-04f,
+	-2.891272e-04f,
+	1.933873e-04f,
+	-1.399815e-04f,
+	9.289384e-05f,
+	-6.771088e-05f,
+	4.166365e-05f,
+	-2.992153e-05f,
+	1.585484e-05f,
+	-1.120567e-05f,
+	4.351139e-06f,
+	-3.099442e-06f,
+	3.576279e-07f,
+	-5.960464e-08f,
+
+	1.638577e-07f,
+	-1.027954e-06f,
+	-5.654944e-07f,
+	-4.652842e-07f,
+	-3.632549e-06f,
+	3.687695e-06f,
+	-1.208166e-05f,
+	1.555288e-05f,
+	-3.108594e-05f,
+	4.128846e-05f,
+	-6.765696e-05f,
+	8.826565e-05f,
+	-1.269643e-04f,
+	1.445329e-04f,
+	-6.677673e-05f,
+	-2.234784e-03f,
+	1.571134e-03f,
+	-7.061735e-04f,
+	4.078597e-04f,
+	-2.729148e-04f,
+	1.821816e-04f,
+	-1.321733e-04f,
+	8.755922e-05f,
+	-6.413460e-05f,
+	3.933907e-05f,
+	-2.849102e-05f,
+	1.502037e-05f,
+	-1.072884e-05f,
+	4.112720e-06f,
+	-3.039837e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	1.752522e-07f,
+	-1.117656e-06f,
+	-3.424294e-07f,
+	-9.451151e-07f,
+	-2.758991e-06f,
+	2.187511e-06f,
+	-9.677785e-06f,
+	1.183505e-05f,
+	-2.554630e-05f,
+	3.319489e-05f,
+	-5.600060e-05f,
+	7.141684e-05f,
+	-1.020142e-04f,
+	1.048478e-04f,
+	9.573766e-06f,
+	-2.579888e-03f,
+	1.496956e-03f,
+	-6.670430e-04f,
+	3.831685e-04f,
+	-2.562106e-04f,
+	1.706183e-04f,
+	-1.241565e-04f,
+	8.207560e-05f,
+	-6.043911e-05f,
+	3.701448e-05f,
+	-2.700090e-05f,
+	1.418591e-05f,
+	-1.031160e-05f,
+	3.874302e-06f,
+	-2.920628e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	1.870009e-07f,
+	-1.209200e-06f,
+	-1.144082e-07f,
+	-1.435408e-06f,
+	-1.866002e-06f,
+	6.540580e-07f,
+	-7.220158e-06f,
+	8.034044e-06f,
+	-1.988217e-05f,
+	2.491923e-05f,
+	-4.408128e-05f,
+	5.418760e-05f,
+	-7.649960e-05f,
+	6.426145e-05f,
+	8.770554e-05f,
+	-2.939752e-03f,
+	1.420390e-03f,
+	-6.268620e-04f,
+	3.578365e-04f,
+	-2.391040e-04f,
+	1.587570e-04f,
+	-1.159310e-04f,
+	7.647276e-05f,
+	-5.668402e-05f,
+	3.457069e-05f,
+	-2.545118e-05f,
+	1.329184e-05f,
+	-9.775162e-06f,
+	3.695488e-06f,
+	-2.861023e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	1.990786e-07f,
+	-1.302422e-06f,
+	1.181072e-07f,
+	-1.935164e-06f,
+	-9.554656e-07f,
+	-9.094055e-07f,
+	-4.714075e-06f,
+	4.158124e-06f,
+	-1.410593e-05f,
+	1.647966e-05f,
+	-3.192524e-05f,
+	3.661585e-05f,
+	-5.047654e-05f,
+	2.286186e-05f,
+	1.674545e-04f,
+	-3.314479e-03f,
+	1.341723e-03f,
+	-5.857423e-04f,
+	3.319532e-04f,
+	-2.216101e-04f,
+	1.466572e-04f,
+	-1.075268e-04f,
+	7.072091e-05f,
+	-5.280972e-05f,
+	3.206730e-05f,
+	-2.390146e-05f,
+	1.239777e-05f,
+	-9.298325e-06f,
+	3.457069e-06f,
+	-2.741814e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	2.114567e-07f,
+	-1.397150e-06f,
+	3.546303e-07f,
+	-2.443337e-06f,
+	-2.934460e-08f,
+	-2.499496e-06f,
+	-2.165033e-06f,
+	2.158205e-07f,
+	-8.230396e-06f,
+	7.894953e-06f,
+	-1.955963e-05f,
+	1.874081e-05f,
+	-2.400292e-05f,
+	-1.925972e-05f,
+	2.486478e-04f,
+	-3.704160e-03f,
+	1.261238e-03f,
+	-5.438104e-04f,
+	3.055632e-04f,
+	-2.037883e-04f,
+	1.343489e-04f,
+	-9.897351e-05f,
+	6.484985e-05f,
+	-4.887581e-05f,
+	2.950430e-05f,
+	-2.235174e-05f,
+	1.144409e-05f,
+	-8.821487e-06f,
+	3.218651e-06f,
+	-2.682209e-06f,
+	2.980232e-07f,
+	-5.960464e-08f,
+
+	2.241032e-07f,
+	-1.493198e-06f,
+	5.946512e-07f,
+	-2.958837e-06f,
+	9.103238e-07f,
+	-4.112709e-06f,
+	4.212855e-07f,
+	-3.784052e-06f,
+	-2.268797e-06f,
+	-8.155310e-07f,
+	-7.012435e-06f,
+	6.029191e-07f,
+	2.861472e-06f,
+	-6.200864e-05f,
+	3.311039e-04f,
+	-4.108875e-03f,
+	1.179218e-03f,
+	-5.011708e-04f,
+	2.787560e-04f,
+	-1.856685e-04f,
+	1.218021e-04f,
+	-9.027123e-05f,
+	5.888939e-05f,
+	-4.488230e-05f,
+	2.694130e-05f,
+	-2.074242e-05f,
+	1.055002e-05f,
+	-8.285046e-06f,
+	2.980232e-06f,
+	-2.563000e-06f,
+	2.384186e-07f,
+	-5.960464e-08f,
+
+	2.369823e-07f,
+	-1.590372e-06f,
+	8.376375e-07f,
+	-3.480534e-06f,
+	1.861431e-06f,
+	-5.745426e-06f,
+	3.039025e-06f,
+	-7.832421e-06f,
+	3.765277e-06f,
+	-9.631897e-06f,
+	5.687625e-06f,
+	-1.775628e-05f,
+	3.005509e-05f,
+	-1.052871e-04f,
+	4.146325e-04f,
+	-4.528692e-03f,
+	1.095932e-03f,
+	-4.579574e-04f,
+	2.515912e-04f,
+	-1.673400e-04f,
+	1.091063e-04f,
+	-8.144975e-05f,
+	5.286932e-05f,
+	-4.085898e-05f,
+	2.431870e-05f,
+	-1.907349e-05f,
+	9.596348e-06f,
+	-7.748604e-06f,
+	2.741814e-06f,
+	-2.443790e-06f,
+	2.384186e-07f,
+	-5.960464e-08f,
+
+	2.500546e-07f,
+	-1.688465e-06f,
+	1.083035e-06f,
+	-4.007257e-06f,
+	2.821803e-06f,
+	-7.393924e-06f,
+	5.682166e-06f,
+	-1.191998e-05f,
+	9.857887e-06f,
+	-1.853376e-05f,
+	1.851110e-05f,
+	-3.629419e-05f,
+	5.751475e-05f,
+	-1.489943e-04f,
+	4.990351e-04f,
+	-4.963665e-03f,
+	1.011651e-03f,
+	-4.142821e-04f,
+	2.241433e-04f,
+	-1.488030e-04f,
+	9.629130e-05f,
+	-7.256866e-05f,
+	4.678965e-05f,
+	-3.677607e-05f,
+	2.169609e-05f,
+	-1.746416e-05f,
+	8.583069e-06f,
+	-7.212162e-06f,
+	2.503395e-06f,
+	-2.384186e-06f,
+	2.384186e-07f,
+	-5.960464e-08f,
+
+	2.632772e-07f,
+	-1.787262e-06f,
+	1.330267e-06f,
+	-4.537797e-06f,
+	3.789203e-06f,
+	-9.054379e-06f,
+	8.344544e-06f,
+	-1.603719e-05f,
+	1.599478e-05f,
+	-2.750028e-05f,
+	3.142792e-05f,
+	-5.496729e-05f,
+	8.517579e-05f,
+	-1.930266e-04f,
+	5.841046e-04f,
+	-5.413838e-03f,
+	9.266287e-04f,
+	-3.702566e-04f,
+	1.964867e-04f,
+	-1.301318e-04f,
+	8.338690e-05f,
+	-6.359816e-05f,
+	4.065037e-05f,
+	-3.266335e-05f,
+	1.901388e-05f,
+	-1.579523e-05f,
+	7.629395e-06f,
+	-6.735325e-06f,
+	2.205372e-06f,
+	-2.264977e-06f,
+	2.384186e-07f,
+	-5.960464e-08f,
+
+	2.766033e-07f,
+	-1.886537e-06f,
+	1.578741e-06f,
+	-5.070911e-06f,
+	4.761334e-06f,
+	-1.072288e-05f,
+	1.101985e-05f,
+	-2.017433e-05f,
+	2.216142e-05f,
+	-3.651022e-05f,
+	4.440740e-05f,
+	-7.373116e-05f,
+	1.129722e-04f,
+	-2.372778e-04f,
+	6.696261e-04f,
+	-5.879242e-03f,
+	8.411184e-04f,
+	-3.260151e-04f,
+	1.686960e-04f,
+	-1.113713e-04f,
+	7.042289e-05f,
+	-5.459785e-05f,
+	3.448129e-05f,
+	-2.852082e-05f,
+	1.633167e-05f,
+	-1.412630e-05f,
+	6.675720e-06f,
+	-6.198883e-06f,
+	1.966953e-06f,
+	-2.205372e-06f,
+	2.384186e-07f,
+	-5.960464e-08f,
+
+	2.899826e-07f,
+	-1.986054e-06f,
+	1.827841e-06f,
+	-5.605325e-06f,
+	5.735851e-06f,
+	-1.239543e-05f,
+	1.370167e-05f,
+	-2.432149e-05f,
+	2.834301e-05f,
+	-4.554200e-05f,
+	5.741840e-05f,
+	-9.254071e-05f,
+	1.408367e-04f,
+	-2.816393e-04f,
+	7.553766e-04f,
+	-6.359896e-03f,
+	7.553697e-04f,
+	-2.816468e-04f,
+	1.408309e-04f,
+	-9.256601e-05f,
+	5.739927e-05f,
+	-4.559755e-05f,
+	2.831221e-05f,
+	-2.437830e-05f,
+	1.364946e-05f,
+	-1.245737e-05f,
+	5.722046e-06f,
+	-5.722046e-06f,
+	1.728535e-06f,
+	-2.086163e-06f,
+	1.788139e-07f,
+	-0.000000e+00f
+};
+
+// blampd2 table: 2080 entries
+const float blampd2[] = {
+	7.900000e-22f,
+	2.908324e-07f,
+	4.889252e-06f,
+	4.236896e-06f,
+	-4.079191e-05f,
+	-6.965782e-05f,
+	6.731477e-05f,
+	1.662422e-04f,
+	-1.842099e-04f,
+	-4.566706e-04f,
+	3.002172e-04f,
+	9.049284e-04f,
+	-6.588697e-04f,
+	-1.891847e-03f,
+	1.603820e-03f,
+	3.814235e-03f,
+	-1.286662e-02f,
+	3.814235e-03f,
+	1.603819e-03f,
+	-1.891851e-03f,
+	-6.588697e-04f,
+	9.049177e-04f,
+	3.002286e-04f,
+	-4.566610e-04f,
+	-1.842380e-04f,
+	1.662374e-04f,
+	6.729364e-05f,
+	-6.967783e-05f,
+	-4.076958e-05f,
+	4.231930e-06f,
+	4.887581e-06f,
+	2.980232e-07f,
+
+	1.555538e-15f,
+	3.124771e-07f,
+	5.003392e-06f,
+	3.948686e-06f,
+	-4.178466e-05f,
+	-6.898579e-05f,
+	7.042798e-05f,
+	1.646392e-04f,
+	-1.921908e-04f,
+	-4.535791e-04f,
+	3.176180e-04f,
+	8.988026e-04f,
+	-6.949624e-04f,
+	-1.877834e-03f,
+	1.684968e-03f,
+	3.747628e-03f,
+	-1.238215e-02f,
+	3.876060e-03f,
+	1.522668e-03f,
+	-1.904458e-03f,
+	-6.227791e-04f,
+	9.104013e-04f,
+	2.828240e-04f,
+	-4.594624e-04f,
+	-1.762509e-04f,
+	1.677275e-04f,
+	6.419420e-05f,
+	-7.027388e-05f,
+	-3.981590e-05f,
+	4.529953e-06f,
+	4.768372e-06f,
+	2.384186e-07f,
+
+	1.884180e-14f,
+	3.352980e-07f,
+	5.117404e-06f,
+	3.647285e-06f,
+	-4.277674e-05f,
+	-6.826408e-05f,
+	7.353912e-05f,
+	1.629013e-04f,
+	-2.001666e-04f,
+	-4.501781e-04f,
+	3.350078e-04f,
+	8.920254e-04f,
+	-7.310318e-04f,
+	-1.862408e-03f,
+	1.766060e-03f,
+	3.676163e-03f,
+	-1.190531e-02f,
+	3.933184e-03f,
+	1.441583e-03f,
+	-1.915678e-03f,
+	-5.867183e-04f,
+	9.152293e-04f,
+	2.654195e-04f,
+	-4.619360e-04f,
+	-1.682639e-04f,
+	1.690388e-04f,
+	6.109476e-05f,
+	-7.086992e-05f,
+	-3.880262e-05f,
+	4.768372e-06f,
+	4.649162e-06f,
+	2.384186e-07f,
+
+	1.055974e-13f,
+	3.593323e-07f,
+	5.231158e-06f,
+	3.332539e-06f,
+	-4.376748e-05f,
+	-6.749229e-05f,
+	7.664608e-05f,
+	1.610276e-04f,
+	-2.081321e-04f,
+	-4.464659e-04f,
+	3.523752e-04f,
+	8.845935e-04f,
+	-7.670546e-04f,
+	-1.845563e-03f,
+	1.847038e-03f,
+	3.599765e-03f,
+	-1.143610e-02f,
+	3.985684e-03f,
+	1.360595e-03f,
+	-1.925513e-03f,
+	-5.506873e-04f,
+	9.194314e-04f,
+	2.480447e-04f,
+	-4.641116e-04f,
+	-1.602769e-04f,
+	1.702309e-04f,
+	5.799532e-05f,
+	-7.140636e-05f,
+	-3.784895e-05f,
+	5.006790e-06f,
+	4.529953e-06f,
+	2.384186e-07f,
+
+	3.913555e-13f,
+	3.846168e-07f,
+	5.344516e-06f,
+	3.004300e-06f,
+	-4.475617e-05f,
+	-6.667006e-05f,
+	7.974674e-05f,
+	1.590172e-04f,
+	-2.160821e-04f,
+	-4.424412e-04f,
+	3.697090e-04f,
+	8.765042e-04f,
+	-8.030069e-04f,
+	-1.827291e-03f,
+	1.927843e-03f,
+	3.518358e-03f,
+	-1.097451e-02f,
+	4.033636e-03f,
+	1.279771e-03f,
+	-1.933977e-03f,
+	-5.147159e-04f,
+	9.229779e-04f,
+	2.307296e-04f,
+	-4.659891e-04f,
+	-1.523495e-04f,
+	1.713037e-04f,
+	5.489588e-05f,
+	-7.188320e-05f,
+	-3.683567e-05f,
+	5.245209e-06f,
+	4.410744e-06f,
+	2.384186e-07f,
+
+	1.119447e-12f,
+	4.111886e-07f,
+	5.457341e-06f,
+	2.662429e-06f,
+	-4.574211e-05f,
+	-6.579705e-05f,
+	8.283895e-05f,
+	1.568696e-04f,
+	-2.240114e-04f,
+	-4.381028e-04f,
+	3.869977e-04f,
+	8.677552e-04f,
+	-8.388649e-04f,
+	-1.807585e-03f,
+	2.008417e-03f,
+	3.431867e-03f,
+	-1.052053e-02f,
+	4.077122e-03f,
+	1.199171e-03f,
+	-1.941085e-03f,
+	-4.788637e-04f,
+	9.259284e-04f,
+	2.134144e-04f,
+	-4.675686e-04f,
+	-1.444221e-04f,
+	1.722574e-04f,
+	5.179644e-05f,
+	-7.230043e-05f,
+	-3.582239e-05f,
+	5.483627e-06f,
+	4.291534e-06f,
+	1.788139e-07f,
+
+	2.685064e-12f,
+	4.390838e-07f,
+	5.569488e-06f,
+	2.306791e-06f,
+	-4.672459e-05f,
+	-6.487297e-05f,
+	8.592051e-05f,
+	1.545842e-04f,
+	-2.319145e-04f,
+	-4.334496e-04f,
+	4.042299e-04f,
+	8.583445e-04f,
+	-8.746043e-04f,
+	-1.786440e-03f,
+	2.088698e-03f,
+	3.340217e-03f,
+	-1.007416e-02f,
+	4.116215e-03f,
+	1.118824e-03f,
+	-1.946852e-03f,
+	-4.431009e-04f,
+	9.282231e-04f,
+	1.961887e-04f,
+	-4.688203e-04f,
+	-1.364946e-04f,
+	1.730919e-04f,
+	4.869699e-05f,
+	-7.265806e-05f,
+	-3.486872e-05f,
+	5.722046e-06f,
+	4.231930e-06f,
+	1.788139e-07f,
+
+	5.673093e-12f,
+	4.683389e-07f,
+	5.680808e-06f,
+	1.937264e-06f,
+	-4.770287e-05f,
+	-6.389753e-05f,
+	8.898922e-05f,
+	1.521604e-04f,
+	-2.397861e-04f,
+	-4.284807e-04f,
+	4.213937e-04f,
+	8.482704e-04f,
+	-9.102009e-04f,
+	-1.763850e-03f,
+	2.168627e-03f,
+	3.243334e-03f,
+	-9.635393e-03f,
+	4.150994e-03f,
+	1.038805e-03f,
+	-1.951277e-03f,
+	-4.074872e-04f,
+	9.298921e-04f,
+	1.790226e-04f,
+	-4.698038e-04f,
+	-1.286268e-04f,
+	1.737475e-04f,
+	4.565716e-05f,
+	-7.301569e-05f,
+	-3.385544e-05f,
+	5.900860e-06f,
+	4.112720e-06f,
+	1.788139e-07f,
+
+	1.089572e-11f,
+	4.989894e-07f,
+	5.791149e-06f,
+	1.553728e-06f,
+	-4.867621e-05f,
+	-6.287049e-05f,
+	9.204284e-05f,
+	1.495979e-04f,
+	-2.476208e-04f,
+	-4.231955e-04f,
+	4.384776e-04f,
+	8.375319e-04f,
+	-9.456301e-04f,
+	-1.739810e-03f,
+	2.248140e-03f,
+	3.141146e-03f,
+	-9.204214e-03f,
+	4.181549e-03f,
+	9.591579e-04f,
+	-1.954392e-03f,
+	-3.720224e-04f,
+	9.309649e-04f,
+	1.619160e-04f,
+	-4.705191e-04f,
+	-1.207590e-04f,
+	1.743436e-04f,
+	4.255772e-05f,
+	-7.331371e-05f,
+	-3.290176e-05f,
+	6.079674e-06f,
+	3.993511e-06f,
+	1.788139e-07f,
+
+	1.942924e-11f,
+	5.310706e-07f,
+	5.900354e-06f,
+	1.156078e-06f,
+	-4.964386e-05f,
+	-6.179164e-05f,
+	9.507911e-05f,
+	1.468962e-04f,
+	-2.554131e-04f,
+	-4.175936e-04f,
+	4.554698e-04f,
+	8.261281e-04f,
+	-9.808670e-04f,
+	-1.714319e-03f,
+	2.327175e-03f,
+	3.033580e-03f,
+	-8.780614e-03f,
+	4.207954e-03f,
+	8.799136e-04f,
+	-1.956195e-03f,
+	-3.367066e-04f,
+	9.314418e-04f,
+	1.448989e-04f,
+	-4.709065e-04f,
+	-1.129508e-04f,
+	1.747608e-04f,
+	3.951788e-05f,
+	-7.355213e-05f,
+	-3.194809e-05f,
+	6.258488e-06f,
+	3.874302e-06f,
+	1.192093e-07f,
+
+	3.265103e-11f,
+	5.646170e-07f,
+	6.008262e-06f,
+	7.442121e-07f,
+	-5.060505e-05f,
+	-6.066082e-05f,
+	9.809574e-05f,
+	1.440552e-04f,
+	-2.631575e-04f,
+	-4.116747e-04f,
+	4.723583e-04f,
+	8.140586e-04f,
+	-1.015887e-03f,
+	-1.687373e-03f,
+	2.405669e-03f,
+	2.920564e-03f,
+	-8.364577e-03f,
+	4.230291e-03f,
+	8.011311e-04f,
+	-1.956716e-03f,
+	-3.016293e-04f,
+	9.312928e-04f,
+	1.279712e-04f,
+	-4.710257e-04f,
+	-1.052022e-04f,
+	1.750588e-04f,
+	3.647804e-05f,
+	-7.373095e-05f,
+	-3.099442e-05f,
+	6.437302e-06f,
+	3.755093e-06f,
+	1.192093e-07f,
+
+	5.227650e-11f,
+	5.996627e-07f,
+	6.114708e-06f,
+	3.180409e-07f,
+	-5.155901e-05f,
+	-5.947786e-05f,
+	1.010904e-04f,
+	1.410748e-04f,
+	-2.708484e-04f,
+	-4.054387e-04f,
+	4.891311e-04f,
+	8.013237e-04f,
+	-1.050664e-03f,
+	-1.658971e-03f,
+	2.483555e-03f,
+	2.802027e-03f,
+	-7.956089e-03f,
+	4.248634e-03f,
+	7.228702e-04f,
+	-1.955956e-03f,
+	-2.667308e-04f,
+	9.305775e-04f,
+	1.111329e-04f,
+	-4.708767e-04f,
+	-9.751320e-05f,
+	1.752973e-04f,
+	3.349781e-05f,
+	-7.390976e-05f,
+	-3.004074e-05f,
+	6.556511e-06f,
+	3.635883e-06f,
+	1.192093e-07f,
+
+	8.039512e-11f,
+	6.362407e-07f,
+	6.219523e-06f,
+	-1.225170e-07f,
+	-5.250495e-05f,
+	-5.824266e-05f,
+	1.040609e-04f,
+	1.379547e-04f,
+	-2.784802e-04f,
+	-3.988859e-04f,
+	5.057764e-04f,
+	7.879237e-04f,
+	-1.085174e-03f,
+	-1.629112e-03f,
+	2.560769e-03f,
+	2.677898e-03f,
+	-7.555135e-03f,
+	4.263073e-03f,
+	6.451458e-04f,
+	-1.953945e-03f,
+	-2.321005e-04f,
+	9.292662e-04f,
+	9.444356e-05f,
+	-4.704297e-04f,
+	-8.982420e-05f,
+	1.753569e-04f,
+	3.051758e-05f,
+	-7.402897e-05f,
+	-2.908707e-05f,
+	6.735325e-06f,
+	3.516674e-06f,
+	1.192093e-07f,
+
+	1.195052e-10f,
+	6.743836e-07f,
+	6.322532e-06f,
+	-5.775334e-07f,
+	-5.344208e-05f,
+	-5.695514e-05f,
+	1.070047e-04f,
+	1.346952e-04f,
+	-2.860472e-04f,
+	-3.920165e-04f,
+	5.222819e-04f,
+	7.738596e-04f,
+	-1.119391e-03f,
+	-1.597796e-03f,
+	2.637245e-03f,
+	2.548110e-03f,
+	-7.161694e-03f,
+	4.273683e-03f,
+	5.680323e-04f,
+	-1.950681e-03f,
+	-1.977086e-04f,
+	9.273589e-04f,
+	7.784367e-05f,
+	-4.697442e-04f,
+	-8.219481e-05f,
+	1.752973e-04f,
+	2.753735e-05f,
+	-7.408857e-05f,
+	-2.813339e-05f,
+	6.854534e-06f,
+	3.457069e-06f,
+	1.192093e-07f,
+
+	1.725481e-10f,
+	7.141227e-07f,
+	6.423561e-06f,
+	-1.047070e-06f,
+	-5.436960e-05f,
+	-5.561526e-05f,
+	1.099195e-04f,
+	1.312962e-04f,
+	-2.935439e-04f,
+	-3.848311e-04f,
+	5.386356e-04f,
+	7.591327e-04f,
+	-1.153289e-03f,
+	-1.565025e-03f,
+	2.712915e-03f,
+	2.412592e-03f,
+	-6.775748e-03f,
+	4.280545e-03f,
+	4.915446e-04f,
+	-1.946211e-03f,
+	-1.635849e-04f,
+	9.248853e-04f,
+	6.139278e-05f,
+	-4.687607e-04f,
+	-7.468462e-05f,
+	1.751184e-04f,
+	2.461672e-05f,
+	-7.414818e-05f,
+	-2.717972e-05f,
+	6.973743e-06f,
+	3.337860e-06f,
+	5.960464e-08f,
+
+	2.429424e-10f,
+	7.554885e-07f,
+	6.522427e-06f,
+	-1.531179e-06f,
+	-5.528668e-05f,
+	-5.422302e-05f,
+	1.128030e-04f,
+	1.277581e-04f,
+	-3.009645e-04f,
+	-3.773305e-04f,
+	5.548253e-04f,
+	7.437448e-04f,
+	-1.186843e-03f,
+	-1.530800e-03f,
+	2.787711e-03f,
+	2.271278e-03f,
+	-6.397277e-03f,
+	4.283741e-03f,
+	4.157424e-04f,
+	-1.940534e-03f,
+	-1.297295e-04f,
+	9.218752e-04f,
+	4.506111e-05f,
+	-4.675090e-04f,
+	-6.717443e-05f,
+	1.748800e-04f,
+	2.169609e-05f,
+	-7.414818e-05f,
+	-2.622604e-05f,
+	7.092953e-06f,
+	3.218651e-06f,
+	5.960464e-08f,
+
+	3.346181e-10f,
+	7.985106e-07f,
+	6.618945e-06f,
+	-2.029900e-06f,
+	-5.619252e-05f,
+	-5.277845e-05f,
+	1.156527e-04f,
+	1.240811e-04f,
+	-3.083033e-04f,
+	-3.695157e-04f,
+	5.708387e-04f,
+	7.276981e-04f,
+	-1.220027e-03f,
+	-1.495125e-03f,
+	2.861565e-03f,
+	2.124100e-03f,
+	-6.026255e-03f,
+	4.283354e-03f,
+	3.406703e-04f,
+	-1.933664e-03f,
+	-9.623170e-05f,
+	9.182692e-04f,
+	2.890825e-05f,
+	-4.659891e-04f,
+	-5.978346e-05f,
+	1.744628e-04f,
+	1.877546e-05f,
+	-7.408857e-05f,
+	-2.533197e-05f,
+	7.212162e-06f,
+	3.159046e-06f,
+	5.960464e-08f,
+
+	4.520484e-10f,
+	8.432170e-07f,
+	6.712926e-06f,
+	-2.543266e-06f,
+	-5.708626e-05f,
+	-5.128161e-05f,
+	1.184662e-04f,
+	1.202656e-04f,
+	-3.155546e-04f,
+	-3.613879e-04f,
+	5.866637e-04f,
+	7.109955e-04f,
+	-1.252816e-03f,
+	-1.458004e-03f,
+	2.934407e-03f,
+	1.970992e-03f,
+	-5.662661e-03f,
+	4.279472e-03f,
+	2.663583e-04f,
+	-1.925632e-03f,
+	-6.303191e-05f,
+	9.141564e-04f,
+	1.287460e-05f,
+	-4.642308e-04f,
+	-5.239248e-05f,
+	1.739860e-04f,
+	1.591444e-05f,
+	-7.396936e-05f,
+	-2.437830e-05f,
+	7.271767e-06f,
+	3.039837e-06f,
+	5.960464e-08f,
+
+	6.002810e-10f,
+	8.896347e-07f,
+	6.804180e-06f,
+	-3.071296e-06f,
+	-5.796709e-05f,
+	-4.973262e-05f,
+	1.212412e-04f,
+	1.163121e-04f,
+	-3.227127e-04f,
+	-3.529486e-04f,
+	6.022880e-04f,
+	6.936399e-04f,
+	-1.285183e-03f,
+	-1.419441e-03f,
+	3.006167e-03f,
+	1.811891e-03f,
+	-5.306467e-03f,
+	4.272163e-03f,
+	1.928508e-04f,
+	-1.916453e-03f,
+	-3.015995e-05f,
+	9.094775e-04f,
+	-2.950430e-06f,
+	-4.622042e-04f,
+	-4.512072e-05f,
+	1.733899e-04f,
+	1.311302e-05f,
+	-7.385015e-05f,
+	-2.348423e-05f,
+	7.390976e-06f,
+	2.920628e-06f,
+	5.960464e-08f,
+
+	7.849686e-10f,
+	9.377896e-07f,
+	6.892508e-06f,
+	-3.613997e-06f,
+	-5.883415e-05f,
+	-4.813161e-05f,
+	1.239751e-04f,
+	1.122213e-04f,
+	-3.297717e-04f,
+	-3.441992e-04f,
+	6.176993e-04f,
+	6.756349e-04f,
+	-1.317103e-03f,
+	-1.379443e-03f,
+	3.076774e-03f,
+	1.646730e-03f,
+	-4.957648e-03f,
+	4.261516e-03f,
+	1.201779e-04f,
+	-1.906157e-03f,
+	2.324581e-06f,
+	9.042919e-04f,
+	-1.862645e-05f,
+	-4.599392e-04f,
+	-3.796816e-05f,
+	1.726747e-04f,
+	1.031160e-05f,
+	-7.367134e-05f,
+	-2.259016e-05f,
+	7.450581e-06f,
+	2.861023e-06f,
+	5.960464e-08f,
+
+	1.012397e-09f,
+	9.877057e-07f,
+	6.977713e-06f,
+	-4.171369e-06f,
+	-5.968659e-05f,
+	-4.647877e-05f,
+	1.266656e-04f,
+	1.079938e-04f,
+	-3.367259e-04f,
+	-3.351419e-04f,
+	6.328853e-04f,
+	6.569847e-04f,
+	-1.348549e-03f,
+	-1.338016e-03f,
+	3.146156e-03f,
+	1.475448e-03f,
+	-4.616171e-03f,
+	4.247613e-03f,
+	4.836917e-05f,
+	-1.894742e-03f,
+	3.442168e-05f,
+	8.985698e-04f,
+	-3.412366e-05f,
+	-4.574358e-04f,
+	-3.081560e-05f,
+	1.718402e-04f,
+	7.569790e-06f,
+	-7.349253e-05f,
+	-2.169609e-05f,
+	7.510185e-06f,
+	2.741814e-06f,
+	5.960464e-08f,
+
+	1.289514e-09f,
+	1.039406e-06f,
+	7.059592e-06f,
+	-4.743395e-06f,
+	-6.052355e-05f,
+	-4.477432e-05f,
+	1.293101e-04f,
+	1.036304e-04f,
+	-3.435696e-04f,
+	-3.257786e-04f,
+	6.478339e-04f,
+	6.376937e-04f,
+	-1.379496e-03f,
+	-1.295169e-03f,
+	3.214241e-03f,
+	1.297983e-03f,
+	-4.282011e-03f,
+	4.230537e-03f,
+	-2.251565e-05f,
+	-1.882255e-03f,
+	6.616116e-05f,
+	8.923411e-04f,
+	-4.944205e-05f,
+	-4.546642e-04f,
+	-2.378225e-05f,
+	1.709461e-04f,
+	4.827976e-06f,
+	-7.325411e-05f,
+	-2.086163e-05f,
+	7.569790e-06f,
+	2.622604e-06f,
+	5.960464e-08f,
+
+	1.623957e-09f,
+	1.092911e-06f,
+	7.137940e-06f,
+	-5.330049e-06f,
+	-6.134418e-05f,
+	-4.301852e-05f,
+	1.319063e-04f,
+	9.913211e-05f,
+	-3.502969e-04f,
+	-3.161115e-04f,
+	6.625326e-04f,
+	6.177668e-04f,
+	-1.409917e-03f,
+	-1.250911e-03f,
+	3.280957e-03f,
+	1.114273e-03f,
+	-3.955133e-03f,
+	4.210360e-03f,
+	-9.247661e-05f,
+	-1.868695e-03f,
+	9.745359e-05f,
+	8.856058e-04f,
+	-6.455183e-05f,
+	-4.516840e-04f,
+	-1.686811e-05f,
+	1.699328e-04f,
+	2.086163e-06f,
+	-7.295609e-05f,
+	-1.996756e-05f,
+	7.629395e-06f,
+	2.563000e-06f,
+	5.960464e-08f,
+
+	2.024079e-09f,
+	1.148240e-06f,
+	7.212545e-06f,
+	-5.931294e-06f,
+	-6.214760e-05f,
+	-4.121168e-05f,
+	1.344516e-04f,
+	9.449985e-05f,
+	-3.569021e-04f,
+	-3.061434e-04f,
+	6.769692e-04f,
+	5.972094e-04f,
+	-1.439787e-03f,
+	-1.205251e-03f,
+	3.346228e-03f,
+	9.242590e-04f,
+	-3.635505e-03f,
+	4.187174e-03f,
+	-1.614392e-04f,
+	-1.854092e-03f,
+	1.283288e-04f,
+	8.783937e-04f,
+	-7.945299e-05f,
+	-4.484653e-04f,
+	-1.001358e-05f,
+	1.688004e-04f,
+	-5.364418e-07f,
+	-7.265806e-05f,
+	-1.913309e-05f,
+	7.629395e-06f,
+	2.443790e-06f,
+	-0.000000e+00f,
+
+	2.498969e-09f,
+	1.205412e-06f,
+	7.283198e-06f,
+	-6.547077e-06f,
+	-6.293293e-05f,
+	-3.935414e-05f,
+	1.369437e-04f,
+	8.973476e-05f,
+	-3.633794e-04f,
+	-2.958768e-04f,
+	6.911317e-04f,
+	5.760275e-04f,
+	-1.469080e-03f,
+	-1.158201e-03f,
+	3.409982e-03f,
+	7.278814e-04f,
+	-3.323091e-03f,
+	4.161060e-03f,
+	-2.294183e-04f,
+	-1.838461e-03f,
+	1.587868e-04f,
+	8.707047e-04f,
+	-9.414554e-05f,
+	-4.450083e-04f,
+	-3.278255e-06f,
+	1.675487e-04f,
+	-3.159046e-06f,
+	-7.230043e-05f,
+	-1.829863e-05f,
+	7.688999e-06f,
+	2.384186e-06f,
+	-0.000000e+00f,
+
+	3.058479e-09f,
+	1.264442e-06f,
+	7.349682e-06f,
+	-7.177336e-06f,
+	-6.369931e-05f,
+	-3.744628e-05f,
+	1.393800e-04f,
+	8.483804e-05f,
+	-3.697231e-04f,
+	-2.853148e-04f,
+	7.050076e-04f,
+	5.542274e-04f,
+	-1.497769e-03f,
+	-1.109772e-03f,
+	3.472143e-03f,
+	5.250828e-04f,
+	-3.017858e-03f,
+	4.132092e-03f,
+	-2.963394e-04f,
+	-1.821846e-03f,
+	1.887679e-04f,
+	8.625388e-04f,
+	-1.086295e-04f,
+	-4.413426e-04f,
+	3.397465e-06f,
+	1.662374e-04f,
+	-5.781651e-06f,
+	-7.194281e-05f,
+	-1.746416e-05f,
+	7.688999e-06f,
+	2.264977e-06f,
+	-0.000000e+00f,
+
+	3.713246e-09f,
+	1.325343e-06f,
+	7.411781e-06f,
+	-7.821993e-06f,
+	-6.444585e-05f,
+	-3.548852e-05f,
+	1.417580e-04f,
+	7.981100e-05f,
+	-3.759274e-04f,
+	-2.744607e-04f,
+	7.185851e-04f,
+	5.318159e-04f,
+	-1.525830e-03f,
+	-1.059978e-03f,
+	3.532637e-03f,
+	3.158064e-04f,
+	-2.719766e-03f,
+	4.100353e-03f,
+	-3.622025e-04f,
+	-1.804262e-03f,
+	2.183020e-04f,
+	8.538961e-04f,
+	-1.229048e-04f,
+	-4.374683e-04f,
+	9.953976e-06f,
+	1.648664e-04f,
+	-8.344650e-06f,
+	-7.152557e-05f,
+	-1.662970e-05f,
+	7.748604e-06f,
+	2.205372e-06f,
+	-0.000000e+00f,
+
+	4.474705e-09f,
+	1.388127e-06f,
+	7.469273e-06f,
+	-8.480959e-06f,
+	-6.517167e-05f,
+	-3.348133e-05f,
+	1.440754e-04f,
+	7.465507e-05f,
+	-3.819866e-04f,
+	-2.633177e-04f,
+	7.318518e-04f,
+	5.088002e-04f,
+	-1.553236e-03f,
+	-1.008833e-03f,
+	3.591386e-03f,
+	9.999688e-05f,
+	-2.428776e-03f,
+	4.065931e-03f,
+	-4.269630e-04f,
+	-1.785710e-03f,
+	2.473593e-04f,
+	8.448362e-04f,
+	-1.369119e-04f,
+	-4.333556e-04f,
+	1.639128e-05f,
+	1.633763e-04f,
+	-1.084805e-05f,
+	-7.110834e-05f,
+	-1.585484e-05f,
+	7.748604e-06f,
+	2.086163e-06f,
+	-0.000000e+00f,
+
+	5.355116e-09f,
+	1.452805e-06f,
+	7.521936e-06f,
+	-9.154132e-06f,
+	-6.587588e-05f,
+	-3.142523e-05f,
+	1.463297e-04f,
+	6.937178e-05f,
+	-3.878950e-04f,
+	-2.518897e-04f,
+	7.447959e-04f,
+	4.851882e-04f,
+	-1.579962e-03f,
+	-9.563518e-04f,
+	3.648316e-03f,
+	-1.224002e-04f,
+	-2.144847e-03f,
+	4.028894e-03f,
+	-4.906058e-04f,
+	-1.766235e-03f,
+	2.759099e-04f,
+	8.352995e-04f,
+	-1.507103e-04f,
+	-4.290640e-04f,
+	2.270937e-05f,
+	1.617670e-04f,
+	-1.329184e-05f,
+	-7.063150e-05f,
+	-1.502037e-05f,
+	7.748604e-06f,
+	2.026558e-06f,
+	-0.000000e+00f,
+
+	6.367573e-09f,
+	1.519382e-06f,
+	7.569546e-06f,
+	-9.841395e-06f,
+	-6.655760e-05f,
+	-2.932076e-05f,
+	1.485183e-04f,
+	6.396275e-05f,
+	-3.936470e-04f,
+	-2.401804e-04f,
+	7.574054e-04f,
+	4.609881e-04f,
+	-1.605981e-03f,
+	-9.025513e-04f,
+	3.703348e-03f,
+	-3.514379e-04f,
+	-1.867941e-03f,
+	3.989331e-03f,
+	-5.530864e-04f,
+	-1.745865e-03f,
+	3.039539e-04f,
+	8.253753e-04f,
+	-1.642704e-04f,
+	-4.245639e-04f,
+	2.896786e-05f,
+	1.601577e-04f,
+	-1.573563e-05f,
+	-7.015467e-05f,
+	-1.424551e-05f,
+	7.748604e-06f,
+	1.966953e-06f,
+	-0.000000e+00f,
+
+	7.526025e-09f,
+	1.587865e-06f,
+	7.611874e-06f,
+	-1.054262e-05f,
+	-6.721594e-05f,
+	-2.716852e-05f,
+	1.506389e-04f,
+	5.842971e-05f,
+	-3.992368e-04f,
+	-2.281940e-04f,
+	7.696682e-04f,
+	4.362085e-04f,
+	-1.631269e-03f,
+	-8.474487e-04f,
+	3.756405e-03f,
+	-5.871683e-04f,
+	-1.598012e-03f,
+	3.947325e-03f,
+	-6.144047e-04f,
+	-1.724601e-03f,
+	3.314912e-04f,
+	8.150041e-04f,
+	-1.775622e-04f,
+	-4.198551e-04f,
+	3.510714e-05f,
+	1.583695e-04f,
+	-1.811981e-05f,
+	-6.961823e-05f,
+	-1.347065e-05f,
+	7.748604e-06f,
+	1.847744e-06f,
+	-0.000000e+00f,
+
+	8.845286e-09f,
+	1.658256e-06f,
+	7.648692e-06f,
+	-1.125766e-05f,
+	-6.785001e-05f,
+	-2.496914e-05f,
+	1.526891e-04f,
+	5.277452e-05f,
+	-4.046589e-04f,
+	-2.159349e-04f,
+	7.815728e-04f,
+	4.108586e-04f,
+	-1.655801e-03f,
+	-7.910624e-04f,
+	3.807410e-03f,
+	-8.296419e-04f,
+	-1.335017e-03f,
+	3.902949e-03f,
+	-6.745160e-04f,
+	-1.702502e-03f,
+	3.584921e-04f,
+	8.042455e-04f,
+	-1.906157e-04f,
+	-4.149675e-04f,
+	4.112720e-05f,
+	1.565814e-04f,
+	-2.044439e-05f,
+	-6.902218e-05f,
+	-1.275539e-05f,
+	7.688999e-06f,
+	1.788139e-06f,
+	-0.000000e+00f,
+
+	1.034105e-08f,
+	1.730554e-06f,
+	7.679768e-06f,
+	-1.198636e-05f,
+	-6.845893e-05f,
+	-2.272331e-05f,
+	1.546663e-04f,
+	4.699911e-05f,
+	-4.099077e-04f,
+	-2.034076e-04f,
+	7.931073e-04f,
+	3.849480e-04f,
+	-1.679551e-03f,
+	-7.334120e-04f,
+	3.856285e-03f,
+	-1.078908e-03f,
+	-1.078907e-03f,
+	3.856286e-03f,
+	-7.334203e-04f,
+	-1.679555e-03f,
+	3.849566e-04f,
+	7.930994e-04f,
+	-2.034009e-04f,
+	-4.099011e-04f,
+	4.696846e-05f,
+	1.546741e-04f,
+	-2.270937e-05f,
+	-6.848574e-05f,
+	-1.198053e-05f,
+	7.688999e-06f,
+	1.728535e-06f,
+	-0.000000e+00f,
+
+	1.202989e-08f,
+	1.804758e-06f,
+	7.704869e-06f,
+	-1.272854e-05f,
+	-6.904182e-05f,
+	-2.043174e-05f,
+	1.565682e-04f,
+	4.110553e-05f,
+	-4.149778e-04f,
+	-1.906169e-04f,
+	8.042602e-04f,
+	3.584869e-04f,
+	-1.702495e-03f,
+	-6.745181e-04f,
+	3.902950e-03f,
+	-1.335016e-03f,
+	-8.296408e-04f,
+	3.807411e-03f,
+	-7.910579e-04f,
+	-1.655802e-03f,
+	4.108548e-04f,
+	7.815659e-04f,
+	-2.159476e-04f,
+	-4.046559e-04f,
+	5.275011e-05f,
+	1.527071e-04f,
+	-2.497435e-05f,
+	-6.783009e-05f,
+	-1.126528e-05f,
+	7.629395e-06f,
+	1.668930e-06f,
+	-0.000000e+00f,
+
+	1.392929e-08f,
+	1.880861e-06f,
+	7.723761e-06f,
+	-1.348403e-05f,
+	-6.959778e-05f,
+	-1.809521e-05f,
+	1.583924e-04f,
+	3.509596e-05f,
+	-4.198634e-04f,
+	-1.775678e-04f,
+	8.150199e-04f,
+	3.314858e-04f,
+	-1.724607e-03f,
+	-6.144025e-04f,
+	3.947326e-03f,
+	-1.598011e-03f,
+	-5.871691e-04f,
+	3.756404e-03f,
+	-8.474439e-04f,
+	-1.631275e-03f,
+	4.362166e-04f,
+	7.696748e-04f,
+	-2.281964e-04f,
+	-3.992319e-04f,
+	5.841255e-05f,
+	1.506209e-04f,
+	-2.717972e-05f,
+	-6.723404e-05f,
+	-1.055002e-05f,
+	7.629395e-06f,
+	1.609325e-06f,
+	-0.000000e+00f,
+
+	1.605762e-08f,
+	1.958857e-06f,
+	7.736209e-06f,
+	-1.425261e-05f,
+	-7.012593e-05f,
+	-1.571453e-05f,
+	1.601366e-04f,
+	2.897264e-05f,
+	-4.245594e-04f,
+	-1.642656e-04f,
+	8.253751e-04f,
+	3.039557e-04f,
+	-1.745863e-03f,
+	-5.530881e-04f,
+	3.989335e-03f,
+	-1.867940e-03f,
+	-3.514364e-04f,
+	3.703348e-03f,
+	-9.025484e-04f,
+	-1.605988e-03f,
+	4.609823e-04f,
+	7.573962e-04f,
+	-2.401769e-04f,
+	-3.936589e-04f,
+	6.395578e-05f,
+	1.485348e-04f,
+	-2.932549e-05f,
+	-6.657839e-05f,
+	-9.834766e-06f,
+	7.569790e-06f,
+	1.490116e-06f,
+	-0.000000e+00f,
+
+	1.843415e-08f,
+	2.038734e-06f,
+	7.741975e-06f,
+	-1.503408e-05f,
+	-7.062541e-05f,
+	-1.329055e-05f,
+	1.617982e-04f,
+	2.273795e-05f,
+	-4.290603e-04f,
+	-1.507158e-04f,
+	8.353146e-04f,
+	2.759081e-04f,
+	-1.766239e-03f,
+	-4.905987e-04f,
+	4.028896e-03f,
+	-2.144847e-03f,
+	-1.224019e-04f,
+	3.648318e-03f,
+	-9.563565e-04f,
+	-1.579955e-03f,
+	4.851818e-04f,
+	7.447898e-04f,
+	-2.518892e-04f,
+	-3.879070e-04f,
+	6.937981e-05f,
+	1.463294e-04f,
+	-3.141165e-05f,
+	-6.586313e-05f,
+	-9.179115e-06f,
+	7.510185e-06f,
+	1.430511e-06f,
+	-0.000000e+00f,
+
+	2.107906e-08f,
+	2.120478e-06f,
+	7.740822e-06f,
+	-1.582820e-05f,
+	-7.109533e-05f,
+	-1.082417e-05f,
+	1.633751e-04f,
+	1.639437e-05f,
+	-4.333608e-04f,
+	-1.369241e-04f,
+	8.448273e-04f,
+	2.473550e-04f,
+	-1.785711e-03f,
+	-4.269595e-04f,
+	4.065929e-03f,
+	-2.428775e-03f,
+	9.999797e-05f,
+	3.591388e-03f,
+	-1.008838e-03f,
+	-1.553237e-03f,
+	5.087852e-04f,
+	7.318556e-04f,
+	-2.633333e-04f,
+	-3.819764e-04f,
+	7.462502e-05f,
+	1.440644e-04f,
+	-3.349781e-05f,
+	-6.514788e-05f,
+	-8.463860e-06f,
+	7.450581e-06f,
+	1.370907e-06f,
+	-0.000000e+00f,
+
+	2.401345e-08f,
+	2.204073e-06f,
+	7.732511e-06f,
+	-1.663473e-05f,
+	-7.153483e-05f,
+	-8.316342e-06f,
+	1.648649e-04f,
+	9.944477e-06f,
+	-4.374556e-04f,
+	-1.228964e-04f,
+	8.539021e-04f,
+	2.183088e-04f,
+	-1.804255e-03f,
+	-3.621966e-04f,
+	4.100354e-03f,
+	-2.719765e-03f,
+	3.158078e-04f,
+	3.532633e-03f,
+	-1.059979e-03f,
+	-1.525834e-03f,
+	5.318224e-04f,
+	7.185936e-04f,
+	-2.744496e-04f,
+	-3.759265e-04f,
+	7.981062e-05f,
+	1.417398e-04f,
+	-3.546476e-05f,
+	-6.443262e-05f,
+	-7.808208e-06f,
+	7.390976e-06f,
+	1.311302e-06f,
+	-0.000000e+00f,
+
+	2.725931e-08f,
+	2.289499e-06f,
+	7.716804e-06f,
+	-1.745340e-05f,
+	-7.194304e-05f,
+	-5.768043e-06f,
+	1.662653e-04f,
+	3.390955e-06f,
+	-4.413396e-04f,
+	-1.086388e-04f,
+	8.625283e-04f,
+	1.887823e-04f,
+	-1.821848e-03f,
+	-2.963374e-04f,
+	4.132092e-03f,
+	-3.017858e-03f,
+	5.250834e-04f,
+	3.472142e-03f,
+	-1.109779e-03f,
+	-1.497775e-03f,
+	5.542338e-04f,
+	7.050037e-04f,
+	-2.853274e-04f,
+	-3.697276e-04f,
+	8.481741e-05f,
+	1.393557e-04f,
+	-3.743172e-05f,
+	-6.371737e-05f,
+	-7.152557e-06f,
+	7.331371e-06f,
+	1.251698e-06f,
+	-0.000000e+00f,
+
+	3.083953e-08f,
+	2.376731e-06f,
+	7.693461e-06f,
+	-1.828395e-05f,
+	-7.231910e-05f,
+	-3.180309e-06f,
+	1.675740e-04f,
+	-3.263405e-06f,
+	-4.450077e-04f,
+	-9.415769e-05f,
+	8.706952e-04f,
+	1.587890e-04f,
+	-1.838466e-03f,
+	-2.294102e-04f,
+	4.161059e-03f,
+	-3.323092e-03f,
+	7.278807e-04f,
+	3.409982e-03f,
+	-1.158208e-03f,
+	-1.469076e-03f,
+	5.760193e-04f,
+	6.911159e-04f,
+	-2.958775e-04f,
+	-3.633797e-04f,
+	8.970499e-05f,
+	1.369119e-04f,
+	-3.933907e-05f,
+	-6.294250e-05f,
+	-6.556511e-06f,
+	7.271767e-06f,
+	1.192093e-06f,
+	-0.000000e+00f,
+
+	3.477788e-08f,
+	2.465745e-06f,
+	7.662242e-06f,
+	-1.912608e-05f,
+	-7.266218e-05f,
+	-5.542149e-07f,
+	1.687889e-04f,
+	-1.001571e-05f,
+	-4.484547e-04f,
+	-7.945971e-05f,
+	8.783923e-04f,
+	1.283426e-04f,
+	-1.854087e-03f,
+	-1.614446e-04f,
+	4.187176e-03f,
+	-3.635505e-03f,
+	9.242594e-04f,
+	3.346227e-03f,
+	-1.205251e-03f,
+	-1.439795e-03f,
+	5.972087e-04f,
+	6.769598e-04f,
+	-3.061593e-04f,
+	-3.569126e-04f,
+	9.447336e-05f,
+	1.344681e-04f,
+	-4.118681e-05f,
+	-6.216764e-05f,
+	-5.960464e-06f,
+	7.212162e-06f,
+	1.132488e-06f,
+	-0.000000e+00f,
+
+	3.909902e-08f,
+	2.556510e-06f,
+	7.622908e-06f,
+	-1.997949e-05f,
+	-7.297142e-05f,
+	2.109119e-06f,
+	1.699076e-04f,
+	-1.686296e-05f,
+	-4.516759e-04f,
+	-6.455164e-05f,
+	8.856094e-04f,
+	9.745736e-05f,
+	-1.868688e-03f,
+	-9.247124e-05f,
+	4.210362e-03f,
+	-3.955133e-03f,
+	1.114272e-03f,
+	3.280953e-03f,
+	-1.250908e-03f,
+	-1.409918e-03f,
+	6.177723e-04f,
+	6.625354e-04f,
+	-3.161132e-04f,
+	-3.502965e-04f,
+	9.912252e-05f,
+	1.319051e-04f,
+	-4.303455e-05f,
+	-6.133318e-05f,
+	-5.364418e-06f,
+	7.152557e-06f,
+	1.072884e-06f,
+	-0.000000e+00f,
+
+	4.382850e-08f,
+	2.648993e-06f,
+	7.575220e-06f,
+	-2.084385e-05f,
+	-7.324597e-05f,
+	4.808528e-06f,
+	1.709280e-04f,
+	-2.380205e-05f,
+	-4.546662e-04f,
+	-4.944050e-05f,
+	8.923364e-04f,
+	6.614791e-05f,
+	-1.882247e-03f,
+	-2.252185e-05f,
+	4.230535e-03f,
+	-4.282011e-03f,
+	1.297984e-03f,
+	3.214240e-03f,
+	-1.295164e-03f,
+	-1.379490e-03f,
+	6.376803e-04f,
+	6.478429e-04f,
+	-3.257692e-04f,
+	-3.435612e-04f,
+	1.036525e-04f,
+	1.292825e-04f,
+	-4.476309e-05f,
+	-6.049871e-05f,
+	-4.768372e-06f,
+	7.033348e-06f,
+	1.013279e-06f,
+	-0.000000e+00f,
+
+	4.899270e-08f,
+	2.743157e-06f,
+	7.518940e-06f,
+	-2.171883e-05f,
+	-7.348505e-05f,
+	7.542806e-06f,
+	1.718480e-04f,
+	-3.082979e-05f,
+	-4.574210e-04f,
+	-3.413351e-05f,
+	8.985632e-04f,
+	3.442939e-05f,
+	-1.894743e-03f,
+	4.837065e-05f,
+	4.247614e-03f,
+	-4.616172e-03f,
+	1.475450e-03f,
+	3.146157e-03f,
+	-1.338020e-03f,
+	-1.348555e-03f,
+	6.569922e-04f,
+	6.328821e-04f,
+	-3.351569e-04f,
+	-3.367364e-04f,
+	1.080036e-04f,
+	1.266599e-04f,
+	-4.649162e-05f,
+	-5.966425e-05f,
+	-4.172325e-06f,
+	6.973743e-06f,
+	9.536743e-07f,
+	-0.000000e+00f,
+
+	5.461886e-08f,
+	2.838962e-06f,
+	7.453830e-06f,
+	-2.260407e-05f,
+	-7.368781e-05f,
+	1.031070e-05f,
+	1.726654e-04f,
+	-3.794286e-05f,
+	-4.599356e-04f,
+	-1.863814e-05f,
+	9.042803e-04f,
+	2.317386e-06f,
+	-1.906153e-03f,
+	1.201723e-04f,
+	4.261517e-03f,
+	-4.957647e-03f,
+	1.646731e-03f,
+	3.076777e-03f,
+	-1.379445e-03f,
+	-1.317099e-03f,
+	6.756186e-04f,
+	6.176829e-04f,
+	-3.441870e-04f,
+	-3.297627e-04f,
+	1.122355e-04f,
+	1.239777e-04f,
+	-4.816055e-05f,
+	-5.882978e-05f,
+	-3.635883e-06f,
+	6.914139e-06f,
+	9.536743e-07f,
+	-0.000000e+00f,
+
+	6.073503e-08f,
+	2.936363e-06f,
+	7.379653e-06f,
+	-2.349921e-05f,
+	-7.385344e-05f,
+	1.311092e-05f,
+	1.733782e-04f,
+	-4.513787e-05f,
+	-4.622053e-04f,
+	-2.962022e-06f,
+	9.094781e-04f,
+	-3.017213e-05f,
+	-1.916457e-03f,
+	1.928479e-04f,
+	4.272163e-03f,
+	-5.306467e-03f,
+	1.811892e-03f,
+	3.006168e-03f,
+	-1.419440e-03f,
+	-1.285180e-03f,
+	6.936491e-04f,
+	6.022751e-04f,
+	-3.529489e-04f,
+	-3.227293e-04f,
+	1.162887e-04f,
+	1.212358e-04f,
+	-4.971027e-05f,
+	-5.799532e-05f,
+	-3.099442e-06f,
+	6.794930e-06f,
+	8.940697e-07f,
+	-0.000000e+00f,
+
+	6.737008e-08f,
+	3.035315e-06f,
+	7.296173e-06f,
+	-2.440386e-05f,
+	-7.398118e-05f,
+	1.594212e-05f,
+	1.739844e-04f,
+	-5.241132e-05f,
+	-4.642258e-04f,
+	1.288697e-05f,
+	9.141474e-04f,
+	-6.302272e-05f,
+	-1.925635e-03f,
+	2.663613e-04f,
+	4.279471e-03f,
+	-5.662661e-03f,
+	1.970991e-03f,
+	2.934404e-03f,
+	-1.458004e-03f,
+	-1.252815e-03f,
+	7.109940e-04f,
+	5.866587e-04f,
+	-3.613830e-04f,
+	-3.155470e-04f,
+	1.202822e-04f,
+	1.184344e-04f,
+	-5.125999e-05f,
+	-5.710125e-05f,
+	-2.563000e-06f,
+	6.735325e-06f,
+	8.344650e-07f,
+	-0.000000e+00f,
+
+	7.455365e-08f,
+	3.135764e-06f,
+	7.203158e-06f,
+	-2.531763e-05f,
+	-7.407023e-05f,
+	1.880293e-05f,
+	1.744820e-04f,
+	-5.975959e-05f,
+	-4.659925e-04f,
+	2.890078e-05f,
+	9.182792e-04f,
+	-9.621755e-05f,
+	-1.933666e-03f,
+	3.406750e-04f,
+	4.283357e-03f,
+	-6.026255e-03f,
+	2.124101e-03f,
+	2.861567e-03f,
+	-1.495123e-03f,
+	-1.220033e-03f,
+	7.276833e-04f,
+	5.708337e-04f,
+	-3.695190e-04f,
+	-3.083050e-04f,
+	1.240969e-04f,
+	1.156330e-04f,
+	-5.280972e-05f,
+	-5.620718e-05f,
+	-2.026558e-06f,
+	6.616116e-06f,
+	7.748604e-07f,
+	-0.000000e+00f,
+
+	8.231616e-08f,
+	3.237656e-06f,
+	7.100373e-06f,
+	-2.624009e-05f,
+	-7.411983e-05f,
+	2.169191e-05f,
+	1.748690e-04f,
+	-6.717900e-05f,
+	-4.675014e-04f,
+	4.507113e-05f,
+	9.218645e-04f,
+	-1.297394e-04f,
+	-1.940531e-03f,
+	4.157508e-04f,
+	4.283743e-03f,
+	-6.397276e-03f,
+	2.271276e-03f,
+	2.787709e-03f,
+	-1.530796e-03f,
+	-1.186848e-03f,
+	7.437468e-04f,
+	5.548298e-04f,
+	-3.773272e-04f,
+	-3.009737e-04f,
+	1.277328e-04f,
+	1.127720e-04f,
+	-5.424023e-05f,
+	-5.531311e-05f,
+	-1.549721e-06f,
+	6.496906e-06f,
+	7.748604e-07f,
+	-0.000000e+00f,
+
+	9.068871e-08f,
+	3.340931e-06f,
+	6.987590e-06f,
+	-2.717083e-05f,
+	-7.412922e-05f,
+	2.460761e-05f,
+	1.751435e-04f,
+	-7.466574e-05f,
+	-4.687481e-04f,
+	6.138958e-05f,
+	9.248950e-04f,
+	-1.635705e-04f,
+	-1.946210e-03f,
+	4.915489e-04f,
+	4.280544e-03f,
+	-6.775748e-03f,
+	2.412591e-03f,
+	2.712913e-03f,
+	-1.565024e-03f,
+	-1.153290e-03f,
+	7.591248e-04f,
+	5.386472e-04f,
+	-3.848374e-04f,
+	-2.935529e-04f,
+	1.313090e-04f,
+	1.099110e-04f,
+	-5.561113e-05f,
+	-5.435944e-05f,
+	-1.072884e-06f,
+	6.437302e-06f,
+	7.152557e-07f,
+	-0.000000e+00f,
+
+	9.970314e-08f,
+	3.445527e-06f,
+	6.864581e-06f,
+	-2.810939e-05f,
+	-7.409767e-05f,
+	2.754852e-05f,
+	1.753038e-04f,
+	-8.221593e-05f,
+	-4.697288e-04f,
+	7.784744e-05f,
+	9.273623e-04f,
+	-1.976929e-04f,
+	-1.950686e-03f,
+	5.680287e-04f,
+	4.273681e-03f,
+	-7.161694e-03f,
+	2.548110e-03f,
+	2.637245e-03f,
+	-1.597792e-03f,
+	-1.119390e-03f,
+	7.738471e-04f,
+	5.222857e-04f,
+	-3.920197e-04f,
+	-2.860427e-04f,
+	1.347065e-04f,
+	1.069903e-04f,
+	-5.698204e-05f,
+	-5.346537e-05f,
+	-5.960464e-07f,
+	6.318092e-06f,
+	6.556511e-07f,
+	-0.000000e+00f,
+
+	1.093919e-07f,
+	3.551377e-06f,
+	6.731119e-06f,
+	-2.905531e-05f,
+	-7.402445e-05f,
+	3.051309e-05f,
+	1.753479e-04f,
+	-8.982559e-05f,
+	-4.704394e-04f,
+	9.443589e-05f,
+	9.292583e-04f,
+	-2.320880e-04f,
+	-1.953939e-03f,
+	6.451484e-04f,
+	4.263072e-03f,
+	-7.555134e-03f,
+	2.677899e-03f,
+	2.560772e-03f,
+	-1.629114e-03f,
+	-1.085177e-03f,
+	7.879138e-04f,
+	5.057752e-04f,
+	-3.988743e-04f,
+	-2.784729e-04f,
+	1.379251e-04f,
+	1.040697e-04f,
+	-5.823374e-05f,
+	-5.251169e-05f,
+	-1.192093e-07f,
+	6.198883e-06f,
+	6.556511e-07f,
+	-0.000000e+00f,
+
+	1.197883e-07f,
+	3.658408e-06f,
+	6.586983e-06f,
+	-3.000812e-05f,
+	-7.390886e-05f,
+	3.349972e-05f,
+	1.752742e-04f,
+	-9.749064e-05f,
+	-4.708763e-04f,
+	1.111459e-04f,
+	9.305754e-04f,
+	-2.667370e-04f,
+	-1.955952e-03f,
+	7.228652e-04f,
+	4.248635e-03f,
+	-7.956089e-03f,
+	2.802026e-03f,
+	2.483554e-03f,
+	-1.658976e-03f,
+	-1.050666e-03f,
+	8.013248e-04f,
+	4.891157e-04f,
+	-4.054308e-04f,
+	-2.708435e-04f,
+	1.410842e-04f,
+	1.010895e-04f,
+	-5.948544e-05f,
+	-5.155802e-05f,
+	2.980232e-07f,
+	6.139278e-06f,
+	5.960464e-07f,
+	-0.000000e+00f,
+
+	1.309258e-07f,
+	3.766547e-06f,
+	6.431953e-06f,
+	-3.096732e-05f,
+	-7.375021e-05f,
+	3.650678e-05f,
+	1.750809e-04f,
+	-1.052069e-04f,
+	-4.710357e-04f,
+	1.279682e-04f,
+	9.313059e-04f,
+	-3.016207e-04f,
+	-1.956709e-03f,
+	8.011351e-04f,
+	4.230290e-03f,
+	-8.364576e-03f,
+	2.920564e-03f,
+	2.405666e-03f,
+	-1.687378e-03f,
+	-1.015887e-03f,
+	8.140504e-04f,
+	4.723668e-04f,
+	-4.116893e-04f,
+	-2.631545e-04f,
+	1.440644e-04f,
+	9.810925e-05f,
+	-6.067753e-05f,
+	-5.060434e-05f,
+	7.152557e-07f,
+	6.020069e-06f,
+	5.364418e-07f,
+	-0.000000e+00f,
+
+	1.428389e-07f,
+	3.875713e-06f,
+	6.265812e-06f,
+	-3.193241e-05f,
+	-7.354782e-05f,
+	3.953262e-05f,
+	1.747664e-04f,
+	-1.129702e-04f,
+	-4.709141e-04f,
+	1.448934e-04f,
+	9.314429e-04f,
+	-3.367194e-04f,
+	-1.956193e-03f,
+	8.799131e-04f,
+	4.207956e-03f,
+	-8.780613e-03f,
+	3.033578e-03f,
+	2.327174e-03f,
+	-1.714319e-03f,
+	-9.808689e-04f,
+	8.261204e-04f,
+	4.554689e-04f,
+	-4.175901e-04f,
+	-2.554059e-04f,
+	1.468658e-04f,
+	9.506941e-05f,
+	-6.181002e-05f,
+	-4.965067e-05f,
+	1.132488e-06f,
+	5.900860e-06f,
+	5.364418e-07f,
+	-0.000000e+00f,
+
+	1.555623e-07f,
+	3.985823e-06f,
+	6.088349e-06f,
+	-3.290286e-05f,
+	-7.330106e-05f,
+	4.257550e-05f,
+	1.743292e-04f,
+	-1.207760e-04f,
+	-4.705083e-04f,
+	1.619120e-04f,
+	9.309793e-04f,
+	-3.720131e-04f,
+	-1.954388e-03f,
+	9.591531e-04f,
+	4.181552e-03f,
+	-9.204214e-03f,
+	3.141146e-03f,
+	2.248138e-03f,
+	-1.739815e-03f,
+	-9.456277e-04f,
+	8.375347e-04f,
+	4.384816e-04f,
+	-4.231930e-04f,
+	-2.476275e-04f,
+	1.496077e-04f,
+	9.202957e-05f,
+	-6.288290e-05f,
+	-4.869699e-05f,
+	1.549721e-06f,
+	5.781651e-06f,
+	4.768372e-07f,
+	-0.000000e+00f,
+
+	1.691313e-07f,
+	4.096789e-06f,
+	5.899353e-06f,
+	-3.387814e-05f,
+	-7.300928e-05f,
+	4.563370e-05f,
+	1.737676e-04f,
+	-1.286201e-04f,
+	-4.698149e-04f,
+	1.790142e-04f,
+	9.299086e-04f,
+	-4.074815e-04f,
+	-1.951278e-03f,
+	1.038808e-03f,
+	4.150998e-03f,
+	-9.635393e-03f,
+	3.243335e-03f,
+	2.168626e-03f,
+	-1.763850e-03f,
+	-9.102076e-04f,
+	8.482635e-04f,
+	4.214048e-04f,
+	-4.284680e-04f,
+	-2.397895e-04f,
+	1.521707e-04f,
+	8.898973e-05f,
+	-6.389618e-05f,
+	-4.768372e-05f,
+	1.907349e-06f,
+	5.662441e-06f,
+	4.768372e-07f,
+	-0.000000e+00f,
+
+	1.835816e-07f,
+	4.208519e-06f,
+	5.698621e-06f,
+	-3.485768e-05f,
+	-7.267187e-05f,
+	4.870541e-05f,
+	1.730803e-04f,
+	-1.364979e-04f,
+	-4.688308e-04f,
+	1.961900e-04f,
+	9.282245e-04f,
+	-4.431038e-04f,
+	-1.946850e-03f,
+	1.118829e-03f,
+	4.116214e-03f,
+	-1.007416e-02f,
+	3.340218e-03f,
+	2.088696e-03f,
+	-1.786441e-03f,
+	-8.746088e-04f,
+	8.583367e-04f,
+	4.042387e-04f,
+	-4.334450e-04f,
+	-2.319217e-04f,
+	1.545548e-04f,
+	8.589029e-05f,
+	-6.484985e-05f,
+	-4.673004e-05f,
+	2.324581e-06f,
+	5.543232e-06f,
+	4.172325e-07f,
+	-0.000000e+00f,
+
+	1.989494e-07f,
+	4.320917e-06f,
+	5.485952e-06f,
+	-3.584094e-05f,
+	-7.228825e-05f,
+	5.178881e-05f,
+	1.722659e-04f,
+	-1.444048e-04f,
+	-4.675533e-04f,
+	2.134295e-04f,
+	9.259210e-04f,
+	-4.788591e-04f,
+	-1.941089e-03f,
+	1.199167e-03f,
+	4.077120e-03f,
+	-1.052053e-02f,
+	3.431868e-03f,
+	2.008416e-03f,
+	-1.807585e-03f,
+	-8.388609e-04f,
+	8.677542e-04f,
+	3.869832e-04f,
+	-4.380941e-04f,
+	-2.240241e-04f,
+	1.568794e-04f,
+	8.285046e-05f,
+	-6.580353e-05f,
+	-4.571676e-05f,
+	2.682209e-06f,
+	5.424023e-06f,
+	4.172325e-07f,
+	-0.000000e+00f,
+
+	2.152710e-07f,
+	4.433883e-06f,
+	5.261152e-06f,
+	-3.682732e-05f,
+	-7.185784e-05f,
+	5.488204e-05f,
+	1.713229e-04f,
+	-1.523362e-04f,
+	-4.659794e-04f,
+	2.307223e-04f,
+	9.229926e-04f,
+	-5.147259e-04f,
+	-1.933981e-03f,
+	1.279773e-03f,
+	4.033636e-03f,
+	-1.097451e-02f,
+	3.518358e-03f,
+	1.927845e-03f,
+	-1.827285e-03f,
+	-8.030087e-04f,
+	8.765161e-04f,
+	3.696978e-04f,
+	-4.424453e-04f,
+	-2.160966e-04f,
+	1.590252e-04f,
+	7.975101e-05f,
+	-6.669760e-05f,
+	-4.476309e-05f,
+	2.980232e-06f,
+	5.364418e-06f,
+	3.576279e-07f,
+	-0.000000e+00f,
+
+	2.325830e-07f,
+	4.547310e-06f,
+	5.024028e-06f,
+	-3.781622e-05f,
+	-7.138011e-05f,
+	5.798320e-05f,
+	1.702503e-04f,
+	-1.602872e-04f,
+	-4.641065e-04f,
+	2.480581e-04f,
+	9.194339e-04f,
+	-5.506826e-04f,
+	-1.925515e-03f,
+	1.360594e-03f,
+	3.985685e-03f,
+	-1.143610e-02f,
+	3.599763e-03f,
+	1.847036e-03f,
+	-1.845568e-03f,
+	-7.670522e-04f,
+	8.845925e-04f,
+	3.523827e-04f,
+	-4.464686e-04f,
+	-2.081394e-04f,
+	1.610518e-04f,
+	7.665157e-05f,
+	-6.747246e-05f,
+	-4.374981e-05f,
+	3.337860e-06f,
+	5.245209e-06f,
+	3.576279e-07f,
+	-0.000000e+00f,
+
+	2.509226e-07f,
+	4.661091e-06f,
+	4.774396e-06f,
+	-3.880704e-05f,
+	-7.085451e-05f,
+	6.109037e-05f,
+	1.690467e-04f,
+	-1.682531e-04f,
+	-4.619323e-04f,
+	2.654264e-04f,
+	9.152400e-04f,
+	-5.867070e-04f,
+	-1.915678e-03f,
+	1.441578e-03f,
+	3.933186e-03f,
+	-1.190531e-02f,
+	3.676161e-03f,
+	1.766056e-03f,
+	-1.862407e-03f,
+	-7.310361e-04f,
+	8.920133e-04f,
+	3.350079e-04f,
+	-4.501939e-04f,
+	-2.001822e-04f,
+	1.628995e-04f,
+	7.355213e-05f,
+	-6.824732e-05f,
+	-4.279613e-05f,
+	3.635883e-06f,
+	5.125999e-06f,
+	3.576279e-07f,
+	-0.000000e+00f,
+
+	2.703266e-07f,
+	4.775111e-06f,
+	4.512077e-06f,
+	-3.979915e-05f,
+	-7.028058e-05f,
+	6.420156e-05f,
+	1.677110e-04f,
+	-1.762290e-04f,
+	-4.594543e-04f,
+	2.828163e-04f,
+	9.104062e-04f,
+	-6.227769e-04f,
+	-1.904459e-03f,
+	1.522671e-03f,
+	3.876062e-03f,
+	-1.238215e-02f,
+	3.747627e-03f,
+	1.684964e-03f,
+	-1.877829e-03f,
+	-6.949604e-04f,
+	8.988082e-04f,
+	3.176033e-04f,
+	-4.535913e-04f,
+	-1.921952e-04f,
+	1.646280e-04f,
+	7.045269e-05f,
+	-6.896257e-05f,
+	-4.178286e-05f,
+	3.933907e-06f,
+	5.006790e-06f,
+	2.980232e-07f,
+	-0.000000e+00f,
+
+	2.908324e-07f,
+	4.889252e-06f,
+	4.236896e-06f,
+	-4.079191e-05f,
+	-6.965782e-05f,
+	6.731477e-05f,
+	1.662422e-04f,
+	-1.842099e-04f,
+	-4.566706e-04f,
+	3.002172e-04f,
+	9.049284e-04f,
+	-6.588697e-04f,
+	-1.891847e-03f,
+	1.603820e-03f,
+	3.814235e-03f,
+	-1.286662e-02f,
+	3.814235e-03f,
+	1.603819e-03f,
+	-1.891851e-03f,
+	-6.588697e-04f,
+	9.049177e-04f,
+	3.002286e-04f,
+	-4.566610e-04f,
+	-1.842380e-04f,
+	1.662374e-04f,
+	6.729364e-05f,
+	-6.967783e-05f,
+	-4.076958e-05f,
+	4.231930e-06f,
+	4.887581e-06f,
+	2.980232e-07f,
+	-0.000000e+00f
+};
@@ -0,0 +1,282 @@
+// BLEP and BLAMP tables for Samples = 16, quantized to 16 bits, generated by Utils/blepnew.c.
+// See BlepData.h.
+
+// blep table: 2080 entries, times blepScale
+const float blepScale = 1.525925e-05f;
+const int16_t blep[] = {
+	0, 1, -7, 17, -36, 65, -112, 180, -278, 415, -606, 874, -1263, 1871, -2979, 5758, 32767, -5758, 2979, -1871, 1263, -874, 606, -415, 278, -180, 112, -65, 36, -17, 7, -1,
+	0, 1, -7, 17, -36, 65, -112, 180, -278, 415, -606, 873, -1261, 1869, -2975, 5750, 31743, -5751, 2975, -1869, 1261, -873, 606, -415, 278, -180, 112, -65, 36, -17, 7, -1,
+	0, 1, -7, 17, -36, 65, -112, 179, -277, 413, -603, 869, -1257, 1862, -2964, 5726, 30720, -5728, 2964, -1862, 1257, -869, 604, -413, 277, -179, 112, -65, 36, -17, 7, -1,
+	0, 1, -7, 17, -35, 65, -111, 178, -275, 410, -600, 864, -1249, 1850, -2944, 5685, 29699, -5690, 2946, -1851, 1249, -864, 600, -411, 275, -178, 111, -65, 35, -17, 7, -1,
+	0, 1, -7, 16, -35, 64, -110, 176, -273, 407, -594, 856, -1238, 1834, -2917, 5627, 28680, -5638, 2920, -1835, 1239, -857, 595, -407, 273, -177, 110, -64, 35, -16, 7, -1,
+	0, 1, -6, 16, -35, 63, -109, 174, -270, 402, -588, 847, -1224, 1812, -2883, 5551, 27665, -5573, 2888, -1815, 1225, -848, 588, -403, 270, -175, 109, -63, 35, -16, 6, -1,
+	0, 1, -6, 16, -34, 62, -107, 172, -266, 397, -579, 835, -1206, 1786, -2840, 5457, 26653, -5494, 2849, -1791, 1209, -836, 581, -397, 267, -172, 108, -63, 34, -16, 6, -1,
+	0, 1, -6, 16, -34, 61, -105, 169, -261, 390, -570, 820, -1186, 1755, -2789, 5345, 25647, -5403, 2804, -1762, 1190, -823, 572, -391, 262, -170, 106, -62, 34, -16, 6, -1,
+	0, 1, -6, 15, -33, 60, -103, 166, -256, 382, -558, 804, -1162, 1720, -2730, 5213, 24646, -5300, 2752, -1730, 1168, -808, 561, -384, 258, -167, 104, -61, 33, -15, 6, -1,
+	0, 1, -6, 15, -32, 59, -101, 162, -250, 373, -545, 786, -1135, 1679, -2663, 5063, 23652, -5186, 2695, -1694, 1144, -791, 550, -376, 252, -163, 102, -59, 33, -15, 6, -1,
+	0, 1, -6, 14, -31, 57, -98, 157, -244, 363, -531, 765, -1105, 1634, -2588, 4893, 22665, -5061, 2631, -1654, 1117, -773, 537, -367, 247, -159, 100, -58, 32, -15, 6, -1,
+	0, 1, -6, 14, -30, 55, -95, 153, -236, 353, -515, 742, -1072, 1584, -2505, 4703, 21687, -4926, 2563, -1611, 1088, -753, 523, -358, 240, -155, 97, -56, 31, -14, 6, -1,
+	0, 1, -5, 13, -29, 53, -92, 147, -228, 341, -498, 717, -1036, 1530, -2414, 4492, 20717, -4782, 2488, -1565, 1057, -731, 508, -348, 233, -151, 94, -55, 30, -14, 6, -1,
+	0, 0, -5, 13, -28, 51, -88, 142, -220, 328, -479, 690, -997, 1471, -2316, 4261, 19757, -4628, 2409, -1515, 1023, -708, 492, -336, 226, -146, 91, -53, 29, -14, 6, -1,
+	0, 0, -5, 12, -27, 49, -84, 136, -210, 314, -459, 662, -955, 1407, -2209, 4010, 18807, -4467, 2325, -1462, 987, -683, 474, -325, 218, -141, 88, -51, 28, -13, 5, -1,
+	0, 0, -5, 12, -25, 46, -80, 129, -201, 299, -438, 631, -910, 1339, -2095, 3737, 17868, -4297, 2237, -1406, 949, -657, 456, -312, 210, -136, 85, -49, 27, -13, 5, -1,
+	0, 0, -4, 11, -24, 44, -76, 122, -190, 284, -415, 598, -862, 1267, -1973, 3443, 16941, -4121, 2145, -1347, 910, -629, 437, -299, 201, -130, 82, -47, 26, -12, 5, -1,
+	0, 0, -4, 10, -22, 41, -71, 115, -179, 267, -391, 563, -812, 1191, -1844, 3128, 16026, -3938, 2048, -1286, 868, -601, 418, -286, 192, -124, 78, -45, 25, -12, 5, -1,
+	0, 0, -4, 9, -21, 38, -67, 107, -167, 250, -366, 527, -759, 1110, -1708, 2791, 15125, -3749, 1948, -1223, 825, -571, 397, -272, 183, -118, 74, -43, 24, -11, 5, -1,
+	0, 0, -3, 8, -19, 35, -61, 99, -155, 232, -340, 489, -703, 1026, -1564, 2432, 14237, -3555, 1845, -1157, 781, -540, 376, -257, 173, -112, 70, -41, 23, -11, 4, 0,
+	0, 0, -3, 7, -17, 32, -56, 91, -142, 213, -312, 449, -645, 938, -1414, 2052, 13364, -3356, 1739, -1089, 735, -508, 354, -242, 163, -106, 66, -39, 22, -10, 4, 0,
+	0, 0, -2, 6, -15, 29, -51, 82, -129, 193, -283, 408, -585, 846, -1257, 1650, 12506, -3153, 1630, -1020, 688, -476, 331, -227, 153, -99, 62, -36, 20, -9, 4, 0,
+	0, 0, -2, 5, -13, 25, -45, 73, -115, 172, -254, 365, -523, 751, -1094, 1226, 11663, -2947, 1519, -949, 639, -442, 308, -211, 143, -93, 58, -34, 19, -9, 4, 0,
+	0, 0, -2, 4, -11, 22, -39, 64, -101, 151, -223, 321, -458, 653, -925, 780, 10837, -2738, 1405, -876, 590, -408, 284, -195, 132, -86, 54, -32, 18, -8, 4, 0,
+	0, -1, -1, 3, -9, 18, -33, 54, -86, 130, -192, 275, -392, 552, -750, 312, 10027, -2526, 1290, -802, 540, -373, 260, -179, 121, -79, 50, -29, 17, -8, 3, 0,
+	0, -1, -1, 2, -7, 14, -26, 44, -71, 107, -159, 229, -324, 448, -570, -178, 9235, -2313, 1173, -727, 489, -338, 236, -162, 110, -72, 46, -27, 15, -7, 3, 0,
+	0, -1, 0, 1, -5, 10, -20, 34, -55, 85, -126, 181, -254, 341, -384, -689, 8460, -2098, 1056, -652, 437, -302, 211, -145, 99, -65, 41, -24, 14, -7, 3, 0,
+	0, -1, 0, 0, -3, 6, -13, 23, -39, 61, -92, 132, -183, 232, -194, -1223, 7703, -1883, 937, -575, 385, -266, 186, -129, 88, -57, 37, -22, 13, -6, 3, 0,
+	0, -1, 1, -1, 0, 2, -7, 13, -23, 37, -58, 82, -110, 120, 1, -1777, 6965, -1668, 818, -498, 333, -230, 161, -111, 76, -50, 32, -19, 11, -5, 3, 0,
+	0, -1, 1, -2, 2, -2, 0, 2, -7, 13, -23, 32, -36, 7, 199, -2353, 6247, -1453, 699, -421, 280, -194, 136, -94, 65, -43, 28, -17, 10, -5, 2, 0,
+	0, -2, 2, -4, 4, -6, 7, -9, 10, -11, 13, -19, 39, -108, 402, -2951, 5547, -1239, 579, -344, 228, -157, 111, -77, 54, -36, 24, -14, 9, -4, 2, 0,
+	0, -2, 2, -5, 7, -11, 14, -20, 26, -36, 48, -71, 114, -224, 607, -3569, 4868, -1026, 460, -267, 175, -121, 86, -60, 43, -29, 19, -12, 7, -4, 2, 0,
+	0, -2, 3, -6, 9, -15, 21, -31, 43, -61, 84, -123, 190, -342, 816, -4208, 4208, -816, 342, -190, 123, -84, 61, -43, 31, -21, 15, -9, 6, -3, 2, 0,
+	0, -2, 4, -7, 12, -19, 29, -43, 60, -86, 121, -175, 267, -460, 1026, -4868, 3569, -607, 224, -114, 71, -48, 36, -26, 20, -14, 11, -7, 5, -2, 2, 0,
+	0, -2, 4, -9, 14, -24, 36, -54, 77, -111, 157, -228, 344, -579, 1239, -5547, 2951, -402, 108, -39, 19, -13, 11, -10, 9, -7, 6, -4, 4, -2, 2, 0,
+	0, -2, 5, -10, 17, -28, 43, -65, 94, -136, 194, -280, 421, -699, 1453, -6247, 2353, -199, -7, 36, -32, 23, -13, 7, -2, 0, 2, -2, 2, -1, 1, 0,
+	0, -3, 5, -11, 19, -32, 50, -76, 111, -161, 230, -333, 498, -818, 1668, -6965, 1777, -1, -120, 110, -82, 58, -37, 23, -13, 7, -2, 0, 1, -1, 1, 0,
+	0, -3, 6, -13, 22, -37, 57, -88, 129, -186, 266, -385, 575, -937, 1883, -7703, 1223, 194, -232, 183, -132, 92, -61, 39, -23, 13, -6, 3, 0, 0, 1, 0,
+	0, -3, 7, -14, 24, -41, 65, -99, 145, -211, 302, -437, 652, -1056, 2098, -8460, 689, 384, -341, 254, -181, 126, -85, 55, -34, 20, -10, 5, -1, 0, 1, 0,
+	0, -3, 7, -15, 27, -46, 72, -110, 162, -236, 338, -489, 727, -1173, 2313, -9235, 178, 570, -448, 324, -229, 159, -107, 71, -44, 26, -14, 7, -2, 1, 1, 0,
+	0, -3, 8, -17, 29, -50, 79, -121, 179, -260, 373, -540, 802, -1290, 2526, -10027, -312, 750, -552, 392, -275, 192, -130, 86, -54, 33, -18, 9, -3, 1, 1, 0,
+	0, -4, 8, -18, 32, -54, 86, -132, 195, -284, 408, -590, 876, -1405, 2738, -10837, -780, 925, -653, 458, -321, 223, -151, 101, -64, 39, -22, 11, -4, 2, 0, 0,
+	0, -4, 9, -19, 34, -58, 93, -143, 211, -308, 442, -639, 949, -1519, 2947, -11663, -1226, 1094, -751, 523, -365, 254, -172, 115, -73, 45, -25, 13, -5, 2, 0, 0,
+	0, -4, 9, -20, 36, -62, 99, -153, 227, -331, 476, -688, 1020, -1630, 3153, -12506, -1650, 1257, -846, 585, -408, 283, -193, 129, -82, 51, -29, 15, -6, 2, 0, 0,
+	0, -4, 10, -22, 39, -66, 106, -163, 242, -354, 508, -735, 1089, -1739, 3356, -13364, -2052, 1414, -938, 645, -449, 312, -213, 142, -91, 56, -32, 17, -7, 3, 0, 0,
+	0, -4, 11, -23, 41, -70, 112, -173, 257, -376, 540, -781, 1157, -1845, 3555, -14237, -2432, 1564, -1026, 703, -489, 340, -232, 155, -99, 61, -35, 19, -8, 3, 0, 0,
+	1, -5, 11, -24, 43, -74, 118, -183, 272, -397, 571, -825, 1223, -1948, 3749, -15125, -2791, 1708, -1110, 759, -527, 366, -250, 167, -107, 67, -38, 21, -9, 4, 0, 0,
+	1, -5, 12, -25, 45, -78, 124, -192, 286, -418, 601, -868, 1286, -2048, 3938, -16026, -3128, 1844, -1191, 812, -563, 391, -267, 179, -115, 71, -41, 22, -10, 4, 0, 0,
+	1, -5, 12, -26, 47, -82, 130, -201, 299, -437, 629, -910, 1347, -2145, 4121, -16941, -3443, 1973, -1267, 862, -598, 415, -284, 190, -122, 76, -44, 24, -11, 4, 0, 0,
+	1, -5, 13, -27, 49, -85, 136, -210, 312, -456, 657, -949, 1406, -2237, 4297, -17868, -3737, 2095, -1339, 910, -631, 438, -299, 201, -129, 80, -46, 25, -12, 5, 0, 0,
+	1, -5, 13, -28, 51, -88, 141, -218, 325, -474, 683, -987, 1462, -2325, 4467, -18807, -4010, 2209, -1407, 955, -662, 459, -314, 210, -136, 84, -49, 27, -12, 5, 0, 0,
+	1, -6, 14, -29, 53, -91, 146, -226, 336, -492, 708, -1023, 1515, -2409, 4628, -19757, -4261, 2316, -1471, 997, -690, 479, -328, 220, -142, 88, -51, 28, -13, 5, 0, 0,
+	1, -6, 14, -30, 55, -94, 151, -233, 348, -508, 731, -1057, 1565, -2488, 4782, -20717, -4492, 2414, -1530, 1036, -717, 498, -341, 228, -147, 92, -53, 29, -13, 5, -1, 0,
+	1, -6, 14, -31, 56, -97, 155, -240, 358, -523, 753, -1088, 1611, -2563, 4926, -21687, -4703, 2505, -1584, 1072, -742, 515, -353, 236, -153, 95, -55, 30, -14, 6, -1, 0,
+	1, -6, 15, -32, 58, -100, 159, -247, 367, -537, 773, -1117, 1654, -2631, 5061, -22665, -4893, 2588, -1634, 1105, -765, 531, -363, 244, -157, 98, -57, 31, -14, 6, -1, 0,
+	1, -6, 15, -33, 59, -102, 163, -252, 376, -550, 791, -1144, 1694, -2695, 5186, -23652, -5063, 2663, -1679, 1135, -786, 545, -373, 250, -162, 101, -59, 32, -15, 6, -1, 0,
+	1, -6, 15, -33, 61, -104, 167, -258, 384, -561, 808, -1168, 1730, -2752, 5300, -24646, -5213, 2730, -1720, 1162, -804, 558, -382, 256, -166, 103, -60, 33, -15, 6, -1, 0,
+	1, -6, 16, -34, 62, -106, 170, -262, 391, -572, 823, -1190, 1762, -2804, 5403, -25647, -5345, 2789, -1755, 1186, -820, 570, -390, 261, -169, 105, -61, 34, -16, 6, -1, 0,
+	1, -6, 16, -34, 63, -108, 172, -267, 397, -581, 836, -1209, 1791, -2849, 5494, -26653, -5457, 2840, -1786, 1206, -835, 579, -397, 266, -172, 107, -62, 34, -16, 6, -1, 0,
+	1, -6, 16, -35, 63, -109, 175, -270, 403, -588, 848, -1225, 1815, -2888, 5573, -27665, -5551, 2883, -1812, 1224, -847, 588, -402, 270, -174, 109, -63, 35, -16, 6, -1, 0,
+	1, -7, 16, -35, 64, -110, 177, -273, 407, -595, 857, -1239, 1835, -2920, 5638, -28680, -5627, 2917, -1834, 1238, -856, 594, -407, 273, -176, 110, -64, 35, -16, 7, -1, 0,
+	1, -7, 17, -35, 65, -111, 178, -275, 411, -600, 864, -1249, 1851, -2946, 5690, -29699, -5685, 2944, -1850, 1249, -864, 600, -410, 275, -178, 111, -65, 35, -17, 7, -1, 0,
+	1, -7, 17, -36, 65, -112, 179, -277, 413, -604, 869, -1257, 1862, -2964, 5728, -30720, -5726, 2964, -1862, 1257, -869, 603, -413, 277, -179, 112, -65, 36, -17, 7, -1, 0,
+	1, -7, 17, -36, 65, -112, 180, -278, 415, -606, 873, -1261, 1869, -2975, 5751, -31743, -5750, 2975, -1869, 1261, -873, 606, -415, 278, -180, 112, -65, 36, -17, 7, -1, 0,
+	1, -7, 17, -36, 65, -112, 180, -278, 415, -606, 874, -1263, 1871, -2979, 5758, -32767, -5758, 2979, -1871, 1263, -874, 606, -415, 278, -180, 112, -65, 36, -17, 7, -1, 0
+};
+
+// blepd2 table: 2080 entries, times blepd2Scale
+const float blepd2Scale = 1.525925e-05f;
+const int16_t blepd2[] = {
+	0, 1, 8, -19, -67, 43, 209, -103, -536, 197, 1168, -389, -2422, 893, 5447, -4308, 32767, 4308, -5447, -893, 2422, 389, -1168, -197, 536, 103, -209, -43, 67, 19, -8, -1,
+	0, 1, 8, -20, -67, 47, 209, -112, -535, 218, 1168, -433, -2422, 988, 5445, -4632, 32255, 3990, -5445, -799, 2422, 346, -1168, -177, 535, 94, -209, -40, 67, 18, -8, -1,
+	0, 2, 8, -21, -67, 50, 209, -121, -535, 239, 1166, -477, -2419, 1083, 5439, -4960, 31743, 3677, -5439, -706, 2419, 303, -1166, -156, 535, 85, -209, -37, 67, 17, -8, -1,
+	0, 2, 8, -22, -66, 53, 208, -130, -534, 260, 1165, -521, -2415, 1178, 5429, -5294, 31232, 3369, -5430, -614, 2416, 260, -1165, -136, 534, 76, -208, -34, 66, 16, -8, -1,
+	0, 2, 8, -22, -66, 57, 208, -140, -533, 281, 1162, -565, -2410, 1274, 5416, -5632, 30720, 3067, -5417, -522, 2410, 218, -1162, -116, 533, 68, -208, -30, 66, 15, -8, -1,
+	0, 2, 8, -23, -66, 60, 207, -149, -531, 302, 1158, -609, -2403, 1371, 5398, -5976, 30210, 2769, -5401, -432, 2404, 175, -1159, -96, 532, 59, -207, -27, 66, 15, -8, -1,
+	0, 2, 8, -24, -66, 64, 206, -158, -529, 323, 1154, -654, -2394, 1467, 5377, -6325, 29699, 2478, -5381, -342, 2395, 134, -1155, -76, 530, 50, -207, -24, 66, 14, -8, -1,
+	0, 2, 7, -25, -65, 67, 205, -167, -527, 344, 1149, -698, -2384, 1565, 5351, -6678, 29190, 2191, -5358, -253, 2386, 92, -1150, -56, 528, 42, -206, -21, 66, 13, -7, -1,
+	0, 2, 7, -26, -65, 71, 204, -177, -524, 365, 1144, -743, -2372, 1662, 5321, -7037, 28681, 1910, -5332, -165, 2375, 51, -1145, -37, 525, 33, -205, -18, 65, 12, -7, -1,
+	0, 2, 7, -27, -65, 74, 203, -186, -521, 387, 1137, -788, -2358, 1759, 5287, -7400, 28172, 1634, -5303, -78, 2362, 11, -1139, -18, 522, 25, -204, -15, 65, 12, -7, -1,
+	0, 2, 7, -28, -64, 78, 202, -195, -518, 408, 1130, -832, -2342, 1857, 5248, -7768, 27665, 1364, -5270, 8, 2348, -29, -1133, 1, 519, 17, -202, -12, 65, 11, -7, -1,
+	0, 2, 7, -29, -64, 81, 200, -205, -514, 429, 1121, -877, -2325, 1955, 5205, -8141, 27159, 1099, -5235, 93, 2333, -69, -1125, 20, 516, 9, -201, -9, 64, 10, -7, -1,
+	0, 3, 7, -30, -63, 85, 198, -214, -510, 450, 1113, -922, -2306, 2053, 5158, -8519, 26654, 839, -5196, 177, 2317, -108, -1117, 39, 513, 1, -200, -6, 64, 9, -7, -1,
+	0, 3, 7, -31, -63, 88, 197, -223, -506, 472, 1103, -966, -2286, 2150, 5106, -8901, 26151, 585, -5154, 260, 2299, -147, -1109, 57, 509, -7, -198, -4, 63, 9, -7, -1,
+	0, 3, 7, -32, -62, 92, 195, -233, -501, 493, 1092, -1010, -2264, 2248, 5050, -9288, 25648, 336, -5110, 341, 2280, -185, -1100, 75, 505, -15, -197, -1, 63, 8, -7, -1,
+	0, 3, 7, -33, -61, 95, 192, -242, -495, 514, 1081, -1055, -2240, 2345, 4989, -9679, 25148, 93, -5063, 421, 2260, -222, -1090, 93, 500, -22, -195, 2, 62, 7, -7, -1,
+	0, 3, 6, -34, -60, 99, 190, -251, -490, 535, 1068, -1099, -2214, 2443, 4923, -10075, 24648, -145, -5013, 500, 2239, -259, -1080, 110, 496, -30, -193, 5, 62, 7, -7, -1,
+	0, 3, 6, -35, -60, 102, 188, -261, -484, 556, 1055, -1143, -2187, 2540, 4853, -10475, 24151, -377, -4961, 578, 2216, -295, -1069, 127, 491, -37, -191, 7, 61, 6, -7, 0,
+	0, 3, 6, -36, -59, 106, 185, -270, -477, 577, 1042, -1187, -2157, 2636, 4778, -10879, 23655, -604, -4906, 654, 2193, -331, -1058, 144, 486, -44, -189, 10, 60, 5, -7, 0,
+	0, 3, 6, -37, -58, 109, 182, -279, -470, 598, 1027, -1230, -2127, 2732, 4698, -11288, 23161, -825, -4848, 729, 2168, -366, -1046, 161, 480, -51, -187, 12, 60, 5, -6, 0,
+	0, 3, 6, -38, -57, 113, 179, -288, -463, 618, 1011, -1273, -2094, 2828, 4614, -11701, 22669, -1041, -4788, 802, 2142, -401, -1034, 177, 475, -58, -185, 15, 59, 4, -6, 0,
+	0, 4, 5, -39, -56, 116, 176, -297, -455, 639, 995, -1316, -2060, 2923, 4524, -12118, 22180, -1251, -4726, 875, 2115, -435, -1021, 193, 469, -65, -182, 17, 58, 3, -6, 0,
+	0, 4, 5, -40, -55, 120, 173, -306, -447, 659, 978, -1358, -2023, 3017, 4430, -12539, 21692, -1456, -4662, 945, 2087, -468, -1007, 208, 463, -72, -180, 20, 58, 3, -6, 0,
+	0, 4, 5, -41, -53, 123, 169, -315, -439, 679, 960, -1401, -1986, 3111, 4330, -12964, 21207, -1656, -4595, 1014, 2058, -501, -993, 224, 456, -78, -177, 22, 57, 2, -6, 0,
+	0, 4, 5, -42, -52, 126, 165, -324, -430, 699, 941, -1442, -1946, 3204, 4226, -13393, 20724, -1850, -4527, 1082, 2028, -532, -979, 239, 450, -85, -175, 24, 56, 2, -6, 0,
+	0, 4, 4, -43, -51, 130, 162, -333, -421, 719, 921, -1484, -1905, 3296, 4117, -13826, 20243, -2038, -4456, 1148, 1997, -564, -964, 253, 443, -91, -172, 26, 55, 1, -6, 0,
+	0, 4, 4, -44, -49, 133, 158, -342, -412, 738, 901, -1524, -1862, 3387, 4002, -14262, 19765, -2221, -4383, 1213, 1966, -594, -949, 268, 436, -97, -170, 28, 55, 1, -6, 0,
+	0, 4, 4, -45, -48, 136, 153, -350, -402, 757, 880, -1565, -1817, 3477, 3883, -14702, 19290, -2399, -4309, 1276, 1933, -624, -934, 282, 429, -103, -167, 31, 54, 0, -6, 0,
+	0, 4, 3, -46, -47, 140, 149, -359, -391, 776, 858, -1604, -1770, 3566, 3758, -15146, 18817, -2571, -4232, 1337, 1899, -653, -917, 295, 422, -109, -164, 33, 53, 0, -5, 0,
+	0, 5, 3, -47, -45, 143, 145, -367, -381, 795, 835, -1644, -1722, 3654, 3628, -15594, 18347, -2738, -4154, 1397, 1865, -681, -901, 309, 415, -114, -161, 34, 52, -1, -5, 0,
+	0, 5, 3, -48, -43, 146, 140, -375, -370, 814, 811, -1682, -1672, 3741, 3493, -16045, 17881, -2900, -4075, 1456, 1830, -709, -884, 322, 407, -120, -158, 36, 51, -1, -5, 0,
+	0, 5, 2, -48, -42, 149, 135, -384, -358, 832, 787, -1720, -1620, 3827, 3353, -16499, 17417, -3056, -3994, 1512, 1794, -735, -867, 334, 399, -125, -155, 38, 50, -1, -5, 0,
+	0, 5, 2, -49, -40, 152, 130, -392, -346, 850, 761, -1757, -1567, 3911, 3207, -16956, 16956, -3207, -3911, 1567, 1757, -761, -850, 346, 392, -130, -152, 40, 49, -2, -5, 0,
+	0, 5, 1, -50, -38, 155, 125, -399, -334, 867, 735, -1794, -1512, 3994, 3056, -17417, 16499, -3353, -3827, 1620, 1720, -787, -832, 358, 384, -135, -149, 42, 48, -2, -5, 0,
+	0, 5, 1, -51, -36, 158, 120, -407, -322, 884, 709, -1830, -1456, 4075, 2900, -17881, 16045, -3493, -3741, 1672, 1682, -811, -814, 370, 375, -140, -146, 43, 48, -3, -5, 0,
+	0, 5, 1, -52, -34, 161, 114, -415, -309, 901, 681, -1865, -1397, 4154, 2738, -18347, 15594, -3628, -3654, 1722, 1644, -835, -795, 381, 367, -145, -143, 45, 47, -3, -5, 0,
+	0, 5, 0, -53, -33, 164, 109, -422, -295, 917, 653, -1899, -1337, 4232, 2571, -18817, 15146, -3758, -3566, 1770, 1604, -858, -776, 391, 359, -149, -140, 47, 46, -3, -4, 0,
+	0, 6, 0, -54, -31, 167, 103, -429, -282, 934, 624, -1933, -1276, 4309, 2399, -19290, 14702, -3883, -3477, 1817, 1565, -880, -757, 402, 350, -153, -136, 48, 45, -4, -4, 0,
+	0, 6, -1, -55, -28, 170, 97, -436, -268, 949, 594, -1966, -1213, 4383, 2221, -19765, 14262, -4002, -3387, 1862, 1524, -901, -738, 412, 342, -158, -133, 49, 44, -4, -4, 0,
+	0, 6, -1, -55, -26, 172, 91, -443, -253, 964, 564, -1997, -1148, 4456, 2038, -20243, 13826, -4117, -3296, 1905, 1484, -921, -719, 421, 333, -162, -130, 51, 43, -4, -4, 0,
+	0, 6, -2, -56, -24, 175, 85, -450, -239, 979, 532, -2028, -1082, 4527, 1850, -20724, 13393, -4226, -3204, 1946, 1442, -941, -699, 430, 324, -165, -126, 52, 42, -5, -4, 0,
+	0, 6, -2, -57, -22, 177, 78, -456, -224, 993, 501, -2058, -1014, 4595, 1656, -21207, 12964, -4330, -3111, 1986, 1401, -960, -679, 439, 315, -169, -123, 53, 41, -5, -4, 0,
+	0, 6, -3, -58, -20, 180, 72, -463, -208, 1007, 468, -2087, -945, 4662, 1456, -21692, 12539, -4430, -3017, 2023, 1358, -978, -659, 447, 306, -173, -120, 55, 40, -5, -4, 0,
+	0, 6, -3, -58, -17, 182, 65, -469, -193, 1021, 435, -2115, -875, 4726, 1251, -22180, 12118, -4524, -2923, 2060, 1316, -995, -639, 455, 297, -176, -116, 56, 39, -5, -4, 0,
+	0, 6, -4, -59, -15, 185, 58, -475, -177, 1034, 401, -2142, -802, 4788, 1041, -22669, 11701, -4614, -2828, 2094, 1273, -1011, -618, 463, 288, -179, -113, 57, 38, -6, -3, 0,
+	0, 6, -5, -60, -12, 187, 51, -480, -161, 1046, 366, -2168, -729, 4848, 825, -23161, 11288, -4698, -2732, 2127, 1230, -1027, -598, 470, 279, -182, -109, 58, 37, -6, -3, 0,
+	0, 7, -5, -60, -10, 189, 44, -486, -144, 1058, 331, -2193, -654, 4906, 604, -23655, 10879, -4778, -2636, 2157, 1187, -1042, -577, 477, 270, -185, -106, 59, 36, -6, -3, 0,
+	0, 7, -6, -61, -7, 191, 37, -491, -127, 1069, 295, -2216, -578, 4961, 377, -24151, 10475, -4853, -2540, 2187, 1143, -1055, -556, 484, 261, -188, -102, 60, 35, -6, -3, 0,
+	1, 7, -7, -62, -5, 193, 30, -496, -110, 1080, 259, -2239, -500, 5013, 145, -24648, 10075, -4923, -2443, 2214, 1099, -1068, -535, 490, 251, -190, -99, 60, 34, -6, -3, 0,
+	1, 7, -7, -62, -2, 195, 22, -500, -93, 1090, 222, -2260, -421, 5063, -93, -25148, 9679, -4989, -2345, 2240, 1055, -1081, -514, 495, 242, -192, -95, 61, 33, -7, -3, 0,
+	1, 7, -8, -63, 1, 197, 15, -505, -75, 1100, 185, -2280, -341, 5110, -336, -25648, 9288, -5050, -2248, 2264, 1010, -1092, -493, 501, 233, -195, -92, 62, 32, -7, -3, 0,
+	1, 7, -9, -63, 4, 198, 7, -509, -57, 1109, 147, -2299, -260, 5154, -585, -26151, 8901, -5106, -2150, 2286, 966, -1103, -472, 506, 223, -197, -88, 63, 31, -7, -3, 0,
+	1, 7, -9, -64, 6, 200, -1, -513, -39, 1117, 108, -2317, -177, 5196, -839, -26654, 8519, -5158, -2053, 2306, 922, -1113, -450, 510, 214, -198, -85, 63, 30, -7, -3, 0,
+	1, 7, -10, -64, 9, 201, -9, -516, -20, 1125, 69, -2333, -93, 5235, -1099, -27159, 8141, -5205, -1955, 2325, 877, -1121, -429, 514, 205, -200, -81, 64, 29, -7, -2, 0,
+	1, 7, -11, -65, 12, 202, -17, -519, -1, 1133, 29, -2348, -8, 5270, -1364, -27665, 7768, -5248, -1857, 2342, 832, -1130, -408, 518, 195, -202, -78, 64, 28, -7, -2, 0,
+	1, 7, -12, -65, 15, 204, -25, -522, 18, 1139, -11, -2362, 78, 5303, -1634, -28172, 7400, -5287, -1759, 2358, 788, -1137, -387, 521, 186, -203, -74, 65, 27, -7, -2, 0,
+	1, 7, -12, -65, 18, 205, -33, -525, 37, 1145, -51, -2375, 165, 5332, -1910, -28681, 7037, -5321, -1662, 2372, 743, -1144, -365, 524, 177, -204, -71, 65, 26, -7, -2, 0,
+	1, 7, -13, -66, 21, 206, -42, -528, 56, 1150, -92, -2386, 253, 5358, -2191, -29190, 6678, -5351, -1565, 2384, 698, -1149, -344, 527, 167, -205, -67, 65, 25, -7, -2, 0,
+	1, 8, -14, -66, 24, 207, -50, -530, 76, 1155, -134, -2395, 342, 5381, -2478, -29699, 6325, -5377, -1467, 2394, 654, -1154, -323, 529, 158, -206, -64, 66, 24, -8, -2, 0,
+	1, 8, -15, -66, 27, 207, -59, -532, 96, 1159, -175, -2404, 432, 5401, -2769, -30210, 5976, -5398, -1371, 2403, 609, -1158, -302, 531, 149, -207, -60, 66, 23, -8, -2, 0,
+	1, 8, -15, -66, 30, 208, -68, -533, 116, 1162, -218, -2410, 522, 5417, -3067, -30720, 5632, -5416, -1274, 2410, 565, -1162, -281, 533, 140, -208, -57, 66, 22, -8, -2, 0,
+	1, 8, -16, -66, 34, 208, -76, -534, 136, 1165, -260, -2416, 614, 5430, -3369, -31232, 5294, -5429, -1178, 2415, 521, -1165, -260, 534, 130, -208, -53, 66, 22, -8, -2, 0,
+	1, 8, -17, -67, 37, 209, -85, -535, 156, 1166, -303, -2419, 706, 5439, -3677, -31743, 4960, -5439, -1083, 2419, 477, -1166, -239, 535, 121, -209, -50, 67, 21, -8, -2, 0,
+	1, 8, -18, -67, 40, 209, -94, -535, 177, 1168, -346, -2422, 799, 5445, -3990, -32255, 4632, -5445, -988, 2422, 433, -1168, -218, 535, 112, -209, -47, 67, 20, -8, -1, 0,
+	1, 8, -19, -67, 43, 209, -103, -536, 197, 1168, -389, -2422, 893, 5447, -4308, -32767, 4308, -5447, -893, 2422, 389, -1168, -197, 536, 103, -209, -43, 67, 19, -8, -1, 0
+};
+
+// blamp table: 2080 entries, times blampScale
+const float blampScale = 1.940945e-07f;
+const int16_t blamp[] = {
+	0, 1, -10, 9, -29, 30, -64, 71, -125, 146, -235, 296, -477, 726, -1451, 3892, -32767, 3892, -1451, 726, -477, 296, -235, 146, -125, 71, -64, 30, -29, 9, -10, 1,
+	0, 2, -11, 11, -32, 35, -72, 84, -147, 178, -281, 363, -574, 869, -1680, 4334, -30291, 3450, -1222, 582, -380, 229, -188, 114, -104, 57, -55, 25, -26, 8, -10, 1,
+	0, 2, -11, 12, -34, 40, -81, 98, -168, 210, -328, 430, -670, 1012, -1908, 4774, -27893, 3009, -994, 439, -283, 162, -142, 82, -83, 43, -47, 20, -23, 7, -9, 1,
+	0, 2, -12, 13, -37, 45, -90, 112, -189, 241, -374, 496, -767, 1155, -2134, 5212, -25573, 2571, -768, 296, -187, 95, -95, 51, -61, 29, -38, 15, -21, 6, -9, 1,
+	0, 2, -12, 15, -40, 50, -98, 126, -210, 273, -420, 562, -862, 1296, -2359, 5646, -23332, 2136, -542, 155, -91, 29, -50, 19, -40, 16, -30, 10, -18, 4, -8, 1,
+	0, 2, -13, 16, -43, 54, -107, 139, -231, 304, -465, 628, -957, 1436, -2582, 6076, -21169, 1706, -319, 15, 3, -36, -4, -12, -19, 2, -21, 5, -15, 3, -8, 1,
+	0, 2, -13, 17, -45, 59, -115, 152, -252, 334, -510, 692, -1050, 1574, -2802, 6498, -19084, 1281, -99, -124, 97, -101, 41, -42, 1, -11, -13, 0, -13, 2, -7, 1,
+	0, 2, -14, 18, -48, 64, -123, 165, -272, 365, -554, 756, -1142, 1710, -3018, 6913, -17077, 863, 118, -260, 189, -164, 85, -73, 21, -24, -5, -5, -10, 1, -7, 1,
+	0, 2, -14, 19, -50, 69, -131, 178, -292, 394, -597, 818, -1232, 1844, -3230, 7318, -15146, 452, 331, -394, 279, -227, 128, -102, 41, -37, 3, -10, -7, -1, -6, 1,
+	0, 2, -15, 21, -53, 73, -139, 191, -311, 423, -640, 879, -1320, 1974, -3437, 7713, -13292, 49, 540, -526, 368, -289, 171, -132, 61, -50, 11, -14, -5, -2, -6, 1,
+	0, 2, -15, 22, -55, 78, -146, 203, -330, 451, -681, 939, -1406, 2101, -3638, 8095, -11514, -344, 745, -654, 455, -349, 213, -160, 80, -62, 19, -19, -2, -3, -5, 1,
+	0, 2, -16, 23, -58, 82, -154, 215, -349, 479, -721, 997, -1490, 2225, -3834, 8463, -9811, -727, 944, -779, 539, -407, 253, -188, 99, -74, 27, -23, 0, -4, -5, 1,
+	0, 2, -16, 24, -60, 86, -161, 226, -366, 506, -760, 1053, -1570, 2344, -4023, 8816, -8184, -1100, 1138, -901, 622, -464, 293, -215, 117, -86, 34, -27, 2, -5, -4, 1,
+	0, 2, -16, 25, -62, 90, -168, 238, -384, 531, -798, 1107, -1649, 2460, -4204, 9152, -6630, -1461, 1326, -1020, 702, -519, 331, -241, 135, -97, 41, -32, 5, -6, -4, 1,
+	0, 2, -17, 26, -64, 94, -175, 248, -400, 556, -834, 1158, -1723, 2570, -4378, 9470, -5150, -1810, 1508, -1134, 779, -573, 368, -267, 152, -109, 48, -36, 7, -7, -4, 1,
+	0, 2, -17, 27, -66, 98, -181, 258, -416, 579, -868, 1208, -1795, 2676, -4543, 9767, -3742, -2147, 1683, -1244, 853, -624, 404, -291, 168, -119, 55, -39, 9, -8, -3, 1,
+	0, 2, -17, 28, -68, 101, -187, 268, -431, 602, -901, 1255, -1863, 2776, -4699, 10043, -2405, -2470, 1851, -1350, 924, -674, 438, -315, 184, -129, 61, -43, 11, -9, -3, 1,
+	0, 2, -18, 28, -70, 104, -193, 277, -445, 623, -932, 1300, -1927, 2870, -4846, 10295, -1140, -2779, 2012, -1451, 993, -721, 471, -337, 199, -139, 67, -47, 13, -10, -2, 0,
+	0, 2, -18, 29, -71, 107, -198, 286, -458, 643, -961, 1342, -1988, 2958, -4982, 10522, 56, -3074, 2165, -1547, 1058, -766, 502, -359, 213, -148, 73, -50, 15, -11, -2, 0,
+	0, 2, -18, 30, -73, 110, -203, 294, -471, 661, -988, 1381, -2044, 3040, -5108, 10723, 1183, -3355, 2311, -1638, 1119, -808, 532, -379, 227, -157, 78, -53, 17, -12, -2, 0,
+	0, 2, -19, 30, -74, 113, -207, 301, -482, 678, -1013, 1417, -2096, 3116, -5222, 10895, 2243, -3620, 2449, -1725, 1178, -849, 560, -398, 240, -166, 84, -56, 18, -13, -1, 0,
+	0, 2, -19, 31, -76, 115, -211, 307, -493, 694, -1036, 1450, -2143, 3184, -5325, 11037, 3236, -3870, 2578, -1806, 1232, -886, 586, -416, 252, -174, 89, -59, 20, -13, -1, 0,
+	0, 2, -19, 31, -77, 117, -215, 313, -502, 708, -1056, 1479, -2185, 3246, -5415, 11147, 4163, -4104, 2699, -1881, 1283, -922, 611, -433, 264, -181, 93, -62, 22, -14, -1, 0,
+	0, 2, -19, 32, -78, 119, -218, 319, -510, 720, -1075, 1506, -2223, 3300, -5492, 11224, 5027, -4322, 2811, -1951, 1330, -954, 634, -449, 274, -188, 98, -65, 23, -15, 0, 0,
+	0, 2, -19, 32, -79, 120, -221, 323, -517, 731, -1091, 1528, -2256, 3346, -5557, 11266, 5828, -4524, 2914, -2016, 1374, -984, 655, -463, 284, -194, 102, -67, 24, -15, 0, 0,
+	0, 2, -19, 32, -79, 122, -223, 327, -523, 740, -1104, 1548, -2283, 3384, -5607, 11271, 6567, -4710, 3009, -2074, 1413, -1012, 674, -476, 293, -200, 105, -69, 26, -16, 0, 0,
+	0, 2, -19, 32, -80, 123, -225, 330, -528, 748, -1115, 1564, -2305, 3414, -5644, 11238, 7247, -4879, 3095, -2127, 1449, -1036, 691, -488, 301, -205, 109, -71, 27, -16, 0, 0,
+	0, 2, -19, 32, -80, 123, -226, 332, -532, 753, -1123, 1576, -2322, 3436, -5666, 11165, 7867, -5032, 3171, -2174, 1480, -1058, 706, -498, 308, -210, 112, -73, 28, -17, 1, 0,
+	0, 2, -19, 32, -80, 124, -227, 333, -534, 757, -1129, 1584, -2333, 3450, -5674, 11049, 8430, -5169, 3238, -2216, 1508, -1077, 719, -507, 314, -214, 114, -74, 29, -17, 1, 0,
+	0, 2, -19, 32, -80, 124, -227, 334, -535, 759, -1132, 1588, -2339, 3455, -5666, 10891, 8937, -5288, 3297, -2251, 1531, -1093, 731, -515, 320, -217, 117, -76, 29, -18, 1, 0,
+	0, 2, -19, 32, -80, 123, -227, 334, -535, 759, -1133, 1589, -2339, 3451, -5643, 10687, 9390, -5392, 3346, -2280, 1551, -1107, 740, -522, 324, -220, 119, -77, 30, -18, 1, 0,
+	0, 2, -19, 32, -79, 123, -226, 333, -534, 757, -1130, 1585, -2333, 3438, -5604, 10437, 9790, -5479, 3386, -2304, 1566, -1117, 748, -527, 328, -223, 120, -78, 31, -18, 1, 0,
+	0, 1, -19, 31, -79, 122, -225, 331, -531, 753, -1125, 1578, -2321, 3416, -5550, 10138, 10138, -5550, 3416, -2321, 1578, -1125, 753, -531, 331, -225, 122, -79, 31, -19, 1, 0,
+	0, 1, -18, 31, -78, 120, -223, 328, -527, 748, -1117, 1566, -2304, 3386, -5479, 9790, 10437, -5604, 3438, -2333, 1585, -1130, 757, -534, 333, -226, 123, -79, 32, -19, 2, 0,
+	0, 1, -18, 30, -77, 119, -220, 324, -522, 740, -1107, 1551, -2280, 3346, -5392, 9390, 10687, -5643, 3451, -2339, 1589, -1133, 759, -535, 334, -227, 123, -80, 32, -19, 2, 0,
+	0, 1, -18, 29, -76, 117, -217, 320, -515, 731, -1093, 1531, -2251, 3297, -5288, 8937, 10891, -5666, 3455, -2339, 1588, -1132, 759, -535, 334, -227, 124, -80, 32, -19, 2, 0,
+	0, 1, -17, 29, -74, 114, -214, 314, -507, 719, -1077, 1508, -2216, 3238, -5169, 8430, 11049, -5674, 3450, -2333, 1584, -1129, 757, -534, 333, -227, 124, -80, 32, -19, 2, 0,
+	0, 1, -17, 28, -73, 112, -210, 308, -498, 706, -1058, 1480, -2174, 3171, -5032, 7867, 11165, -5666, 3436, -2322, 1576, -1123, 753, -532, 332, -226, 123, -80, 32, -19, 2, 0,
+	0, 0, -16, 27, -71, 109, -205, 301, -488, 691, -1036, 1449, -2127, 3095, -4879, 7247, 11238, -5644, 3414, -2305, 1564, -1115, 748, -528, 330, -225, 123, -80, 32, -19, 2, 0,
+	0, 0, -16, 26, -69, 105, -200, 293, -476, 674, -1012, 1413, -2074, 3009, -4710, 6567, 11271, -5607, 3384, -2283, 1548, -1104, 740, -523, 327, -223, 122, -79, 32, -19, 2, 0,
+	0, 0, -15, 24, -67, 102, -194, 284, -463, 655, -984, 1374, -2016, 2914, -4524, 5828, 11266, -5557, 3346, -2256, 1528, -1091, 731, -517, 323, -221, 120, -79, 32, -19, 2, 0,
+	0, 0, -15, 23, -65, 98, -188, 274, -449, 634, -954, 1330, -1951, 2811, -4322, 5027, 11224, -5492, 3300, -2223, 1506, -1075, 720, -510, 319, -218, 119, -78, 32, -19, 2, 0,
+	0, -1, -14, 22, -62, 93, -181, 264, -433, 611, -922, 1283, -1881, 2699, -4104, 4163, 11147, -5415, 3246, -2185, 1479, -1056, 708, -502, 313, -215, 117, -77, 31, -19, 2, 0,
+	0, -1, -13, 20, -59, 89, -174, 252, -416, 586, -886, 1232, -1806, 2578, -3870, 3236, 11037, -5325, 3184, -2143, 1450, -1036, 694, -493, 307, -211, 115, -76, 31, -19, 2, 0,
+	0, -1, -13, 18, -56, 84, -166, 240, -398, 560, -849, 1178, -1725, 2449, -3620, 2243, 10895, -5222, 3116, -2096, 1417, -1013, 678, -482, 301, -207, 113, -74, 30, -19, 2, 0,
+	0, -2, -12, 17, -53, 78, -157, 227, -379, 532, -808, 1119, -1638, 2311, -3355, 1183, 10723, -5108, 3040, -2044, 1381, -988, 661, -471, 294, -203, 110, -73, 30, -18, 2, 0,
+	0, -2, -11, 15, -50, 73, -148, 213, -359, 502, -766, 1058, -1547, 2165, -3074, 56, 10522, -4982, 2958, -1988, 1342, -961, 643, -458, 286, -198, 107, -71, 29, -18, 2, 0,
+	0, -2, -10, 13, -47, 67, -139, 199, -337, 471, -721, 993, -1451, 2012, -2779, -1140, 10295, -4846, 2870, -1927, 1300, -932, 623, -445, 277, -193, 104, -70, 28, -18, 2, 0,
+	1, -3, -9, 11, -43, 61, -129, 184, -315, 438, -674, 924, -1350, 1851, -2470, -2405, 10043, -4699, 2776, -1863, 1255, -901, 602, -431, 268, -187, 101, -68, 28, -17, 2, 0,
+	1, -3, -8, 9, -39, 55, -119, 168, -291, 404, -624, 853, -1244, 1683, -2147, -3742, 9767, -4543, 2676, -1795, 1208, -868, 579, -416, 258, -181, 98, -66, 27, -17, 2, 0,
+	1, -4, -7, 7, -36, 48, -109, 152, -267, 368, -573, 779, -1134, 1508, -1810, -5150, 9470, -4378, 2570, -1723, 1158, -834, 556, -400, 248, -175, 94, -64, 26, -17, 2, 0,
+	1, -4, -6, 5, -32, 41, -97, 135, -241, 331, -519, 702, -1020, 1326, -1461, -6630, 9152, -4204, 2460, -1649, 1107, -798, 531, -384, 238, -168, 90, -62, 25, -16, 2, 0,
+	1, -4, -5, 2, -27, 34, -86, 117, -215, 293, -464, 622, -901, 1138, -1100, -8184, 8816, -4023, 2344, -1570, 1053, -760, 506, -366, 226, -161, 86, -60, 24, -16, 2, 0,
+	1, -5, -4, 0, -23, 27, -74, 99, -188, 253, -407, 539, -779, 944, -727, -9811, 8463, -3834, 2225, -1490, 997, -721, 479, -349, 215, -154, 82, -58, 23, -16, 2, 0,
+	1, -5, -3, -2, -19, 19, -62, 80, -160, 213, -349, 455, -654, 745, -344, -11514, 8095, -3638, 2101, -1406, 939, -681, 451, -330, 203, -146, 78, -55, 22, -15, 2, 0,
+	1, -6, -2, -5, -14, 11, -50, 61, -132, 171, -289, 368, -526, 540, 49, -13292, 7713, -3437, 1974, -1320, 879, -640, 423, -311, 191, -139, 73, -53, 21, -15, 2, 0,
+	1, -6, -1, -7, -10, 3, -37, 41, -102, 128, -227, 279, -394, 331, 452, -15146, 7318, -3230, 1844, -1232, 818, -597, 394, -292, 178, -131, 69, -50, 19, -14, 2, 0,
+	1, -7, 1, -10, -5, -5, -24, 21, -73, 85, -164, 189, -260, 118, 863, -17077, 6913, -3018, 1710, -1142, 756, -554, 365, -272, 165, -123, 64, -48, 18, -14, 2, 0,
+	1, -7, 2, -13, 0, -13, -11, 1, -42, 41, -101, 97, -124, -99, 1281, -19084, 6498, -2802, 1574, -1050, 692, -510, 334, -252, 152, -115, 59, -45, 17, -13, 2, 0,
+	1, -8, 3, -15, 5, -21, 2, -19, -12, -4, -36, 3, 15, -319, 1706, -21169, 6076, -2582, 1436, -957, 628, -465, 304, -231, 139, -107, 54, -43, 16, -13, 2, 0,
+	1, -8, 4, -18, 10, -30, 16, -40, 19, -50, 29, -91, 155, -542, 2136, -23332, 5646, -2359, 1296, -862, 562, -420, 273, -210, 126, -98, 50, -40, 15, -12, 2, 0,
+	1, -9, 6, -21, 15, -38, 29, -61, 51, -95, 95, -187, 296, -768, 2571, -25573, 5212, -2134, 1155, -767, 496, -374, 241, -189, 112, -90, 45, -37, 13, -12, 2, 0,
+	1, -9, 7, -23, 20, -47, 43, -83, 82, -142, 162, -283, 439, -994, 3009, -27893, 4774, -1908, 1012, -670, 430, -328, 210, -168, 98, -81, 40, -34, 12, -11, 2, 0,
+	1, -10, 8, -26, 25, -55, 57, -104, 114, -188, 229, -380, 582, -1222, 3450, -30291, 4334, -1680, 869, -574, 363, -281, 178, -147, 84, -72, 35, -32, 11, -11, 2, 0,
+	1, -10, 9, -29, 30, -64, 71, -125, 146, -235, 296, -477, 726, -1451, 3892, -32767, 3892, -1451, 726, -477, 296, -235, 146, -125, 71, -64, 30, -29, 9, -10, 1, 0
+};
+
+// blampd2 table: 2080 entries, times blampd2Scale
+const float blampd2Scale = 3.926700e-07f;
+const int16_t blampd2[] = {
+	0, 1, 12, 11, -104, -177, 171, 423, -469, -1163, 765, 2305, -1678, -4818, 4084, 9714, -32767, 9714, 4084, -4818, -1678, 2305, 765, -1163, -469, 423, 171, -177, -104, 11, 12, 1,
+	0, 1, 13, 10, -106, -176, 179, 419, -489, -1155, 809, 2289, -1770, -4782, 4291, 9544, -31533, 9871, 3878, -4850, -1586, 2319, 720, -1170, -449, 427, 164, -179, -101, 11, 12, 1,
+	0, 1, 13, 9, -109, -174, 187, 415, -510, -1146, 853, 2272, -1862, -4743, 4498, 9362, -30319, 10017, 3671, -4879, -1494, 2331, 676, -1176, -428, 431, 156, -180, -99, 12, 12, 1,
+	0, 1, 13, 8, -111, -172, 195, 410, -530, -1137, 897, 2253, -1953, -4700, 4704, 9167, -29124, 10150, 3465, -4904, -1402, 2341, 632, -1182, -408, 434, 148, -182, -96, 13, 12, 1,
+	0, 1, 14, 8, -114, -170, 203, 405, -550, -1127, 942, 2232, -2045, -4654, 4910, 8960, -27948, 10272, 3259, -4925, -1311, 2351, 588, -1187, -388, 436, 140, -183, -94, 13, 11, 1,
+	0, 1, 14, 7, -116, -168, 211, 399, -570, -1116, 986, 2210, -2136, -4603, 5115, 8740, -26792, 10383, 3054, -4943, -1219, 2358, 544, -1191, -368, 439, 132, -184, -91, 14, 11, 1,
+	0, 1, 14, 6, -119, -165, 219, 394, -591, -1104, 1029, 2186, -2227, -4549, 5319, 8506, -25656, 10483, 2849, -4958, -1128, 2364, 500, -1194, -348, 441, 124, -185, -89, 15, 11, 0,
+	0, 1, 14, 5, -121, -163, 227, 388, -611, -1091, 1073, 2160, -2318, -4492, 5523, 8260, -24538, 10571, 2646, -4969, -1038, 2368, 456, -1196, -328, 443, 116, -186, -86, 15, 10, 0,
+	0, 1, 15, 4, -124, -160, 234, 381, -631, -1078, 1117, 2133, -2408, -4431, 5725, 7999, -23440, 10649, 2443, -4977, -947, 2371, 412, -1198, -308, 444, 108, -187, -84, 16, 10, 0,
+	0, 1, 15, 3, -126, -157, 242, 374, -650, -1063, 1160, 2104, -2498, -4366, 5927, 7726, -22361, 10716, 2241, -4982, -858, 2372, 369, -1199, -288, 445, 101, -187, -81, 16, 10, 0,
+	0, 1, 15, 2, -129, -154, 250, 367, -670, -1048, 1203, 2073, -2587, -4297, 6126, 7438, -21302, 10773, 2040, -4983, -768, 2372, 326, -1200, -268, 446, 93, -188, -79, 16, 10, 0,
+	0, 2, 16, 1, -131, -151, 257, 359, -690, -1033, 1246, 2041, -2676, -4225, 6325, 7136, -20262, 10820, 1841, -4981, -679, 2370, 283, -1199, -248, 446, 85, -188, -76, 17, 9, 0,
+	0, 2, 16, 0, -134, -148, 265, 351, -709, -1016, 1288, 2007, -2764, -4149, 6521, 6820, -19240, 10857, 1643, -4976, -591, 2367, 240, -1198, -229, 447, 78, -189, -74, 17, 9, 0,
+	0, 2, 16, -1, -136, -145, 273, 343, -728, -998, 1330, 1971, -2851, -4069, 6716, 6489, -18238, 10884, 1447, -4968, -503, 2362, 198, -1196, -209, 446, 70, -189, -72, 17, 9, 0,
+	0, 2, 16, -3, -138, -142, 280, 334, -748, -980, 1372, 1933, -2937, -3986, 6909, 6144, -17256, 10901, 1252, -4956, -417, 2355, 156, -1194, -190, 446, 63, -189, -69, 18, 9, 0,
+	0, 2, 17, -4, -141, -138, 287, 325, -766, -961, 1413, 1894, -3022, -3898, 7099, 5784, -16292, 10909, 1059, -4942, -330, 2348, 115, -1191, -171, 445, 55, -189, -67, 18, 8, 0,
+	0, 2, 17, -5, -143, -134, 295, 316, -785, -941, 1454, 1853, -3107, -3808, 7287, 5409, -15347, 10908, 868, -4924, -245, 2339, 74, -1187, -152, 444, 48, -189, -64, 18, 8, 0,
+	0, 2, 17, -6, -145, -131, 302, 306, -804, -920, 1494, 1811, -3191, -3713, 7473, 5019, -14421, 10898, 678, -4904, -160, 2328, 33, -1182, -133, 443, 41, -188, -62, 19, 8, 0,
+	0, 2, 17, -8, -148, -127, 309, 296, -822, -899, 1534, 1766, -3273, -3615, 7656, 4614, -13514, 10880, 491, -4881, -77, 2316, -8, -1177, -115, 442, 33, -188, -60, 19, 7, 0,
+	0, 2, 18, -9, -150, -123, 316, 286, -840, -877, 1573, 1721, -3354, -3513, 7836, 4194, -12625, 10853, 306, -4854, 6, 2303, -47, -1171, -97, 440, 26, -188, -58, 19, 7, 0,
+	0, 3, 18, -11, -152, -118, 323, 275, -858, -853, 1612, 1673, -3434, -3407, 8012, 3757, -11756, 10817, 123, -4825, 88, 2288, -87, -1165, -79, 438, 19, -187, -55, 19, 7, 0,
+	0, 3, 18, -12, -154, -114, 329, 264, -875, -830, 1650, 1624, -3513, -3298, 8186, 3306, -10905, 10774, -57, -4793, 168, 2272, -126, -1158, -61, 435, 12, -187, -53, 19, 7, 0,
+	0, 3, 18, -14, -156, -110, 336, 252, -892, -805, 1687, 1573, -3591, -3186, 8356, 2838, -10072, 10722, -235, -4759, 248, 2255, -164, -1150, -43, 433, 5, -186, -51, 19, 7, 0,
+	0, 3, 18, -15, -158, -105, 342, 241, -909, -780, 1724, 1521, -3667, -3069, 8522, 2354, -9258, 10663, -411, -4722, 327, 2237, -202, -1142, -26, 430, -1, -185, -49, 20, 6, 0,
+	0, 3, 19, -17, -160, -100, 349, 229, -925, -753, 1760, 1467, -3741, -2950, 8684, 1854, -8463, 10597, -584, -4682, 404, 2217, -240, -1133, -8, 427, -8, -184, -47, 20, 6, 0,
+	0, 3, 19, -18, -162, -95, 355, 216, -942, -727, 1795, 1411, -3814, -2826, 8842, 1337, -7685, 10523, -755, -4640, 481, 2197, -277, -1124, 9, 423, -15, -183, -44, 20, 6, 0,
+	0, 3, 19, -20, -164, -90, 361, 203, -957, -699, 1830, 1354, -3886, -2699, 8996, 804, -6926, 10442, -922, -4595, 556, 2175, -313, -1114, 25, 420, -21, -182, -42, 20, 6, 0,
+	0, 4, 19, -22, -166, -85, 367, 190, -973, -671, 1864, 1296, -3956, -2569, 9146, 255, -6185, 10355, -1087, -4548, 630, 2151, -349, -1104, 42, 416, -28, -181, -40, 20, 5, 0,
+	0, 4, 19, -23, -168, -80, 373, 177, -988, -641, 1897, 1236, -4024, -2436, 9291, -312, -5462, 10260, -1249, -4498, 703, 2127, -384, -1093, 58, 412, -34, -180, -38, 20, 5, 0,
+	0, 4, 19, -25, -169, -75, 378, 163, -1002, -612, 1929, 1174, -4090, -2298, 9431, -895, -4757, 10160, -1409, -4446, 774, 2102, -418, -1081, 74, 408, -40, -179, -36, 20, 5, 0,
+	0, 4, 19, -27, -171, -69, 384, 149, -1017, -581, 1960, 1111, -4154, -2158, 9566, -1495, -4070, 10053, -1565, -4392, 844, 2076, -452, -1069, 89, 403, -46, -177, -34, 20, 5, 0,
+	0, 4, 19, -29, -173, -64, 389, 134, -1031, -550, 1990, 1046, -4217, -2015, 9696, -2113, -3400, 9940, -1718, -4336, 913, 2048, -485, -1057, 105, 399, -52, -176, -32, 20, 5, 0,
+	0, 4, 20, -31, -174, -58, 394, 120, -1044, -518, 2020, 980, -4277, -1868, 9821, -2748, -2748, 9821, -1868, -4277, 980, 2020, -518, -1044, 120, 394, -58, -174, -31, 20, 4, 0,
+	0, 5, 20, -32, -176, -52, 399, 105, -1057, -485, 2048, 913, -4336, -1718, 9940, -3400, -2113, 9696, -2015, -4217, 1046, 1990, -550, -1031, 134, 389, -64, -173, -29, 19, 4, 0,
+	0, 5, 20, -34, -177, -46, 403, 89, -1069, -452, 2076, 844, -4392, -1565, 10053, -4070, -1495, 9566, -2158, -4154, 1111, 1960, -581, -1017, 149, 384, -69, -171, -27, 19, 4, 0,
+	0, 5, 20, -36, -179, -40, 408, 74, -1081, -418, 2102, 774, -4446, -1409, 10160, -4757, -895, 9431, -2298, -4090, 1174, 1929, -612, -1002, 163, 378, -75, -169, -25, 19, 4, 0,
+	0, 5, 20, -38, -180, -34, 412, 58, -1093, -384, 2127, 703, -4498, -1249, 10260, -5462, -312, 9291, -2436, -4024, 1236, 1897, -641, -988, 177, 373, -80, -168, -23, 19, 4, 0,
+	0, 5, 20, -40, -181, -28, 416, 42, -1104, -349, 2151, 630, -4548, -1087, 10355, -6185, 255, 9146, -2569, -3956, 1296, 1864, -671, -973, 190, 367, -85, -166, -22, 19, 4, 0,
+	0, 6, 20, -42, -182, -21, 420, 25, -1114, -313, 2175, 556, -4595, -922, 10442, -6926, 804, 8996, -2699, -3886, 1354, 1830, -699, -957, 203, 361, -90, -164, -20, 19, 3, 0,
+	0, 6, 20, -44, -183, -15, 423, 9, -1124, -277, 2197, 481, -4640, -755, 10523, -7685, 1337, 8842, -2826, -3814, 1411, 1795, -727, -942, 216, 355, -95, -162, -18, 19, 3, 0,
+	0, 6, 20, -47, -184, -8, 427, -8, -1133, -240, 2217, 404, -4682, -584, 10597, -8463, 1854, 8684, -2950, -3741, 1467, 1760, -753, -925, 229, 349, -100, -160, -17, 19, 3, 0,
+	0, 6, 20, -49, -185, -1, 430, -26, -1142, -202, 2237, 327, -4722, -411, 10663, -9258, 2354, 8522, -3069, -3667, 1521, 1724, -780, -909, 241, 342, -105, -158, -15, 18, 3, 0,
+	0, 7, 19, -51, -186, 5, 433, -43, -1150, -164, 2255, 248, -4759, -235, 10722, -10072, 2838, 8356, -3186, -3591, 1573, 1687, -805, -892, 252, 336, -110, -156, -14, 18, 3, 0,
+	0, 7, 19, -53, -187, 12, 435, -61, -1158, -126, 2272, 168, -4793, -57, 10774, -10905, 3306, 8186, -3298, -3513, 1624, 1650, -830, -875, 264, 329, -114, -154, -12, 18, 3, 0,
+	0, 7, 19, -55, -187, 19, 438, -79, -1165, -87, 2288, 88, -4825, 123, 10817, -11756, 3757, 8012, -3407, -3434, 1673, 1612, -853, -858, 275, 323, -118, -152, -11, 18, 3, 0,
+	0, 7, 19, -58, -188, 26, 440, -97, -1171, -47, 2303, 6, -4854, 306, 10853, -12625, 4194, 7836, -3513, -3354, 1721, 1573, -877, -840, 286, 316, -123, -150, -9, 18, 2, 0,
+	0, 7, 19, -60, -188, 33, 442, -115, -1177, -8, 2316, -77, -4881, 491, 10880, -13514, 4614, 7656, -3615, -3273, 1766, 1534, -899, -822, 296, 309, -127, -148, -8, 17, 2, 0,
+	0, 8, 19, -62, -188, 41, 443, -133, -1182, 33, 2328, -160, -4904, 678, 10898, -14421, 5019, 7473, -3713, -3191, 1811, 1494, -920, -804, 306, 302, -131, -145, -6, 17, 2, 0,
+	0, 8, 18, -64, -189, 48, 444, -152, -1187, 74, 2339, -245, -4924, 868, 10908, -15347, 5409, 7287, -3808, -3107, 1853, 1454, -941, -785, 316, 295, -134, -143, -5, 17, 2, 0,
+	0, 8, 18, -67, -189, 55, 445, -171, -1191, 115, 2348, -330, -4942, 1059, 10909, -16292, 5784, 7099, -3898, -3022, 1894, 1413, -961, -766, 325, 287, -138, -141, -4, 17, 2, 0,
+	0, 9, 18, -69, -189, 63, 446, -190, -1194, 156, 2355, -417, -4956, 1252, 10901, -17256, 6144, 6909, -3986, -2937, 1933, 1372, -980, -748, 334, 280, -142, -138, -3, 16, 2, 0,
+	0, 9, 17, -72, -189, 70, 446, -209, -1196, 198, 2362, -503, -4968, 1447, 10884, -18238, 6489, 6716, -4069, -2851, 1971, 1330, -998, -728, 343, 273, -145, -136, -1, 16, 2, 0,
+	0, 9, 17, -74, -189, 78, 447, -229, -1198, 240, 2367, -591, -4976, 1643, 10857, -19240, 6820, 6521, -4149, -2764, 2007, 1288, -1016, -709, 351, 265, -148, -134, 0, 16, 2, 0,
+	0, 9, 17, -76, -188, 85, 446, -248, -1199, 283, 2370, -679, -4981, 1841, 10820, -20262, 7136, 6325, -4225, -2676, 2041, 1246, -1033, -690, 359, 257, -151, -131, 1, 16, 2, 0,
+	0, 10, 16, -79, -188, 93, 446, -268, -1200, 326, 2372, -768, -4983, 2040, 10773, -21302, 7438, 6126, -4297, -2587, 2073, 1203, -1048, -670, 367, 250, -154, -129, 2, 15, 1, 0,
+	0, 10, 16, -81, -187, 101, 445, -288, -1199, 369, 2372, -858, -4982, 2241, 10716, -22361, 7726, 5927, -4366, -2498, 2104, 1160, -1063, -650, 374, 242, -157, -126, 3, 15, 1, 0,
+	0, 10, 16, -84, -187, 108, 444, -308, -1198, 412, 2371, -947, -4977, 2443, 10649, -23440, 7999, 5725, -4431, -2408, 2133, 1117, -1078, -631, 381, 234, -160, -124, 4, 15, 1, 0,
+	0, 10, 15, -86, -186, 116, 443, -328, -1196, 456, 2368, -1038, -4969, 2646, 10571, -24538, 8260, 5523, -4492, -2318, 2160, 1073, -1091, -611, 388, 227, -163, -121, 5, 14, 1, 0,
+	0, 11, 15, -89, -185, 124, 441, -348, -1194, 500, 2364, -1128, -4958, 2849, 10483, -25656, 8506, 5319, -4549, -2227, 2186, 1029, -1104, -591, 394, 219, -165, -119, 6, 14, 1, 0,
+	1, 11, 14, -91, -184, 132, 439, -368, -1191, 544, 2358, -1219, -4943, 3054, 10383, -26792, 8740, 5115, -4603, -2136, 2210, 986, -1116, -570, 399, 211, -168, -116, 7, 14, 1, 0,
+	1, 11, 13, -94, -183, 140, 436, -388, -1187, 588, 2351, -1311, -4925, 3259, 10272, -27948, 8960, 4910, -4654, -2045, 2232, 942, -1127, -550, 405, 203, -170, -114, 8, 14, 1, 0,
+	1, 12, 13, -96, -182, 148, 434, -408, -1182, 632, 2341, -1402, -4904, 3465, 10150, -29124, 9167, 4704, -4700, -1953, 2253, 897, -1137, -530, 410, 195, -172, -111, 8, 13, 1, 0,
+	1, 12, 12, -99, -180, 156, 431, -428, -1176, 676, 2331, -1494, -4879, 3671, 10017, -30319, 9362, 4498, -4743, -1862, 2272, 853, -1146, -510, 415, 187, -174, -109, 9, 13, 1, 0,
+	1, 12, 11, -101, -179, 164, 427, -449, -1170, 720, 2319, -1586, -4850, 3878, 9871, -31533, 9544, 4291, -4782, -1770, 2289, 809, -1155, -489, 419, 179, -176, -106, 10, 13, 1, 0,
+	1, 12, 11, -104, -177, 171, 423, -469, -1163, 765, 2305, -1678, -4818, 4084, 9714, -32767, 9714, 4084, -4818, -1678, 2305, 765, -1163, -469, 423, 171, -177, -104, 11, 12, 1, 0
+};
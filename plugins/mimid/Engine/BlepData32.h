@@ -0,0 +1,16914 @@
+// BLEP and BLAMP tables for Samples = 32, generated by Utils/blepnew.c.
+// See BlepData.h.
+
+// blep table: 4160 entries
+const float blep[] = {
+	-4.226402e-36f,
+	1.669981e-06f,
+	-1.170933e-05f,
+	2.669495e-05f,
+	-5.243568e-05f,
+	8.629113e-05f,
+	-1.349124e-04f,
+	1.965502e-04f,
+	-2.787872e-04f,
+	3.808417e-04f,
+	-5.113003e-04f,
+	6.704308e-04f,
+	-8.679364e-04f,
+	1.105305e-03f,
+	-1.393622e-03f,
+	1.736013e-03f,
+	-2.145594e-03f,
+	2.628119e-03f,
+	-3.200240e-03f,
+	3.872626e-03f,
+	-4.668961e-03f,
+	5.610245e-03f,
+	-6.735755e-03f,
+	8.090751e-03f,
+	-9.753644e-03f,
+	1.183570e-02f,
+	-1.453319e-02f,
+	1.818408e-02f,
+	-2.346687e-02f,
+	3.190237e-02f,
+	-4.778276e-02f,
+	8.906884e-02f,
+	5.000000e-01f,
+	-8.906884e-02f,
+	4.778276e-02f,
+	-3.190237e-02f,
+	2.346687e-02f,
+	-1.818408e-02f,
+	1.453319e-02f,
+	-1.183570e-02f,
+	9.753644e-03f,
+	-8.090751e-03f,
+	6.735755e-03f,
+	-5.610245e-03f,
+	4.668961e-03f,
+	-3.872626e-03f,
+	3.200240e-03f,
+	-2.628119e-03f,
+	2.145594e-03f,
+	-1.736013e-03f,
+	1.393622e-03f,
+	-1.105305e-03f,
+	8.679364e-04f,
+	-6.704308e-04f,
+	5.113003e-04f,
+	-3.808417e-04f,
+	2.787872e-04f,
+	-1.965502e-04f,
+	1.349124e-04f,
+	-8.629113e-05f,
+	5.243568e-05f,
+	-2.669495e-05f,
+	1.170933e-05f,
+	-1.669981e-06f,
+
+	8.079417e-13f,
+	1.666444e-06f,
+	-1.169479e-05f,
+	2.666071e-05f,
+	-5.237137e-05f,
+	8.618422e-05f,
+	-1.347476e-04f,
+	1.963091e-04f,
+	-2.784477e-04f,
+	3.803769e-04f,
+	-5.106786e-04f,
+	6.696148e-04f,
+	-8.668824e-04f,
+	1.103962e-03f,
+	-1.391931e-03f,
+	1.733906e-03f,
+	-2.142993e-03f,
+	2.624932e-03f,
+	-3.196362e-03f,
+	3.867932e-03f,
+	-4.663303e-03f,
+	5.603445e-03f,
+	-6.727590e-03f,
+	8.080940e-03f,
+	-9.741810e-03f,
+	1.182133e-02f,
+	-1.451551e-02f,
+	1.816190e-02f,
+	-2.343811e-02f,
+	3.186290e-02f,
+	-4.772222e-02f,
+	8.894535e-02f,
+	4.843782e-01f,
+	-8.894918e-02f,
+	4.772319e-02f,
+	-3.186334e-02f,
+	2.343837e-02f,
+	-1.816207e-02f,
+	1.451563e-02f,
+	-1.182141e-02f,
+	9.741881e-03f,
+	-8.080997e-03f,
+	6.727637e-03f,
+	-5.603483e-03f,
+	4.663336e-03f,
+	-3.867959e-03f,
+	3.196385e-03f,
+	-2.624952e-03f,
+	2.143010e-03f,
+	-1.733920e-03f,
+	1.391943e-03f,
+	-1.103972e-03f,
+	8.668905e-04f,
+	-6.696215e-04f,
+	5.106840e-04f,
+	-3.803813e-04f,
+	2.784511e-04f,
+	-1.963118e-04f,
+	1.347497e-04f,
+	-8.618577e-05f,
+	5.237248e-05f,
+	-2.666147e-05f,
+	1.169526e-05f,
+	-1.666662e-06f,
+
+	8.074803e-12f,
+	1.655620e-06f,
+	-1.165072e-05f,
+	2.655730e-05f,
+	-5.217747e-05f,
+	8.586219e-05f,
+	-1.342517e-04f,
+	1.955840e-04f,
+	-2.774263e-04f,
+	3.789793e-04f,
+	-5.088095e-04f,
+	6.671621e-04f,
+	-8.637147e-04f,
+	1.099926e-03f,
+	-1.386851e-03f,
+	1.727577e-03f,
+	-2.135178e-03f,
+	2.615360e-03f,
+	-3.184713e-03f,
+	3.853834e-03f,
+	-4.646312e-03f,
+	5.583022e-03f,
+	-6.703071e-03f,
+	8.051472e-03f,
+	-9.706267e-03f,
+	1.177814e-02f,
+	-1.446240e-02f,
+	1.809525e-02f,
+	-2.335166e-02f,
+	3.174414e-02f,
+	-4.753976e-02f,
+	8.857119e-02f,
+	4.687689e-01f,
+	-8.859415e-02f,
+	4.754556e-02f,
+	-3.174677e-02f,
+	2.335317e-02f,
+	-1.809625e-02f,
+	1.446311e-02f,
+	-1.177868e-02f,
+	9.706687e-03f,
+	-8.051811e-03f,
+	6.703350e-03f,
+	-5.583255e-03f,
+	4.646507e-03f,
+	-3.853999e-03f,
+	3.184853e-03f,
+	-2.615478e-03f,
+	2.135279e-03f,
+	-1.727661e-03f,
+	1.386922e-03f,
+	-1.099985e-03f,
+	8.637636e-04f,
+	-6.672023e-04f,
+	5.088421e-04f,
+	-3.790055e-04f,
+	2.774470e-04f,
+	-1.956002e-04f,
+	1.342641e-04f,
+	-8.587146e-05f,
+	5.218416e-05f,
+	-2.656187e-05f,
+	1.165353e-05f,
+	-1.656929e-06f,
+
+	3.629953e-11f,
+	1.637083e-06f,
+	-1.157628e-05f,
+	2.638341e-05f,
+	-5.185219e-05f,
+	8.532270e-05f,
+	-1.334218e-04f,
+	1.943710e-04f,
+	-2.757187e-04f,
+	3.766434e-04f,
+	-5.056866e-04f,
+	6.630651e-04f,
+	-8.584245e-04f,
+	1.093188e-03f,
+	-1.378370e-03f,
+	1.717012e-03f,
+	-2.122136e-03f,
+	2.599384e-03f,
+	-3.165274e-03f,
+	3.830309e-03f,
+	-4.617962e-03f,
+	5.548949e-03f,
+	-6.662162e-03f,
+	8.002305e-03f,
+	-9.646959e-03f,
+	1.170608e-02f,
+	-1.437375e-02f,
+	1.798396e-02f,
+	-2.320721e-02f,
+	3.154549e-02f,
+	-4.723381e-02f,
+	8.793905e-02f,
+	4.531848e-01f,
+	-8.801174e-02f,
+	4.725217e-02f,
+	-3.155380e-02f,
+	2.321199e-02f,
+	-1.798710e-02f,
+	1.437599e-02f,
+	-1.170777e-02f,
+	9.648289e-03f,
+	-8.003377e-03f,
+	6.663044e-03f,
+	-5.549685e-03f,
+	4.618580e-03f,
+	-3.830832e-03f,
+	3.165717e-03f,
+	-2.599760e-03f,
+	2.122454e-03f,
+	-1.717280e-03f,
+	1.378594e-03f,
+	-1.093375e-03f,
+	8.585794e-04f,
+	-6.631921e-04f,
+	5.057897e-04f,
+	-3.767262e-04f,
+	2.757843e-04f,
+	-1.944222e-04f,
+	1.334610e-04f,
+	-8.535203e-05f,
+	5.187336e-05f,
+	-2.639787e-05f,
+	1.158516e-05f,
+	-1.641223e-06f,
+
+	1.095387e-10f,
+	1.610417e-06f,
+	-1.147069e-05f,
+	2.613793e-05f,
+	-5.139405e-05f,
+	8.456393e-05f,
+	-1.322555e-04f,
+	1.926676e-04f,
+	-2.733220e-04f,
+	3.733662e-04f,
+	-5.013066e-04f,
+	6.573202e-04f,
+	-8.510082e-04f,
+	1.083744e-03f,
+	-1.366484e-03f,
+	1.702208e-03f,
+	-2.103863e-03f,
+	2.577004e-03f,
+	-3.138046e-03f,
+	3.797361e-03f,
+	-4.578256e-03f,
+	5.501229e-03f,
+	-6.604868e-03f,
+	7.933444e-03f,
+	-9.563887e-03f,
+	1.160513e-02f,
+	-1.424952e-02f,
+	1.782795e-02f,
+	-2.300459e-02f,
+	3.126651e-02f,
+	-4.680307e-02f,
+	8.704189e-02f,
+	4.376383e-01f,
+	-8.721012e-02f,
+	4.684553e-02f,
+	-3.128572e-02f,
+	2.301564e-02f,
+	-1.783521e-02f,
+	1.425471e-02f,
+	-1.160904e-02f,
+	9.566961e-03f,
+	-7.935924e-03f,
+	6.606908e-03f,
+	-5.502929e-03f,
+	4.579686e-03f,
+	-3.798570e-03f,
+	3.139070e-03f,
+	-2.577873e-03f,
+	2.104598e-03f,
+	-1.702827e-03f,
+	1.367004e-03f,
+	-1.084177e-03f,
+	8.513663e-04f,
+	-6.576139e-04f,
+	5.015450e-04f,
+	-3.735575e-04f,
+	2.734736e-04f,
+	-1.927859e-04f,
+	1.323461e-04f,
+	-8.463171e-05f,
+	5.144301e-05f,
+	-2.617136e-05f,
+	1.149121e-05f,
+	-1.619988e-06f,
+
+	2.612320e-10f,
+	1.575218e-06f,
+	-1.133324e-05f,
+	2.581989e-05f,
+	-5.080190e-05f,
+	8.358457e-05f,
+	-1.307516e-04f,
+	1.904726e-04f,
+	-2.702349e-04f,
+	3.691467e-04f,
+	-4.956690e-04f,
+	6.499279e-04f,
+	-8.414672e-04f,
+	1.071596e-03f,
+	-1.351199e-03f,
+	1.683173e-03f,
+	-2.080370e-03f,
+	2.548235e-03f,
+	-3.103047e-03f,
+	3.755012e-03f,
+	-4.527224e-03f,
+	5.439899e-03f,
+	-6.531234e-03f,
+	7.844942e-03f,
+	-9.457112e-03f,
+	1.147535e-02f,
+	-1.408979e-02f,
+	1.762727e-02f,
+	-2.274377e-02f,
+	3.090698e-02f,
+	-4.624652e-02f,
+	8.587294e-02f,
+	4.221419e-01f,
+	-8.619766e-02f,
+	4.632840e-02f,
+	-3.094401e-02f,
+	2.276508e-02f,
+	-1.764127e-02f,
+	1.409979e-02f,
+	-1.148290e-02f,
+	9.463037e-03f,
+	-7.849722e-03f,
+	6.535166e-03f,
+	-5.443178e-03f,
+	4.529981e-03f,
+	-3.757343e-03f,
+	3.105022e-03f,
+	-2.549910e-03f,
+	2.081787e-03f,
+	-1.684367e-03f,
+	1.352201e-03f,
+	-1.072431e-03f,
+	8.421576e-04f,
+	-6.504939e-04f,
+	4.961285e-04f,
+	-3.695156e-04f,
+	2.705272e-04f,
+	-1.907007e-04f,
+	1.309263e-04f,
+	-8.371524e-05f,
+	5.089627e-05f,
+	-2.588433e-05f,
+	1.137279e-05f,
+	-1.593669e-06f,
+
+	5.339506e-10f,
+	1.531097e-06f,
+	-1.116328e-05f,
+	2.542849e-05f,
+	-5.007490e-05f,
+	8.238389e-05f,
+	-1.289095e-04f,
+	1.877857e-04f,
+	-2.664581e-04f,
+	3.639864e-04f,
+	-4.887765e-04f,
+	6.408925e-04f,
+	-8.298085e-04f,
+	1.056755e-03f,
+	-1.332528e-03f,
+	1.659925e-03f,
+	-2.051682e-03f,
+	2.513106e-03f,
+	-3.060315e-03f,
+	3.703310e-03f,
+	-4.464926e-03f,
+	5.365031e-03f,
+	-6.441345e-03f,
+	7.736898e-03f,
+	-9.326750e-03f,
+	1.131688e-02f,
+	-1.389470e-02f,
+	1.738206e-02f,
+	-2.242487e-02f,
+	3.046683e-02f,
+	-4.556339e-02f,
+	8.442572e-02f,
+	4.067080e-01f,
+	-8.498288e-02f,
+	4.570371e-02f,
+	-3.053028e-02f,
+	2.246138e-02f,
+	-1.740605e-02f,
+	1.391183e-02f,
+	-1.132982e-02f,
+	9.336901e-03f,
+	-7.745088e-03f,
+	6.448082e-03f,
+	-5.370647e-03f,
+	4.469649e-03f,
+	-3.707304e-03f,
+	3.063699e-03f,
+	-2.515975e-03f,
+	2.054108e-03f,
+	-1.661970e-03f,
+	1.334244e-03f,
+	-1.058185e-03f,
+	8.309910e-04f,
+	-6.418622e-04f,
+	4.895637e-04f,
+	-3.646183e-04f,
+	2.669588e-04f,
+	-1.881765e-04f,
+	1.292088e-04f,
+	-8.260773e-05f,
+	5.023657e-05f,
+	-2.553889e-05f,
+	1.123104e-05f,
+	-1.562706e-06f,
+
+	9.790716e-10f,
+	1.477681e-06f,
+	-1.096026e-05f,
+	2.496314e-05f,
+	-4.921255e-05f,
+	8.096165e-05f,
+	-1.267295e-04f,
+	1.846082e-04f,
+	-2.619938e-04f,
+	3.578890e-04f,
+	-4.806351e-04f,
+	6.302228e-04f,
+	-8.160437e-04f,
+	1.039236e-03f,
+	-1.310493e-03f,
+	1.632491e-03f,
+	-2.017833e-03f,
+	2.471664e-03f,
+	-3.009907e-03f,
+	3.642326e-03f,
+	-4.391446e-03f,
+	5.276727e-03f,
+	-6.335327e-03f,
+	7.609462e-03f,
+	-9.172977e-03f,
+	1.112993e-02f,
+	-1.366448e-02f,
+	1.709257e-02f,
+	-2.204813e-02f,
+	2.994622e-02f,
+	-4.475320e-02f,
+	8.269403e-02f,
+	3.913490e-01f,
+	-8.357448e-02f,
+	4.497462e-02f,
+	-3.004631e-02f,
+	2.210573e-02f,
+	-1.713042e-02f,
+	1.369149e-02f,
+	-1.115033e-02f,
+	9.188987e-03f,
+	-7.622379e-03f,
+	6.345952e-03f,
+	-5.285586e-03f,
+	4.398896e-03f,
+	-3.648625e-03f,
+	3.015245e-03f,
+	-2.476188e-03f,
+	2.021660e-03f,
+	-1.635718e-03f,
+	1.313199e-03f,
+	-1.041491e-03f,
+	8.179090e-04f,
+	-6.317522e-04f,
+	4.818767e-04f,
+	-3.588857e-04f,
+	2.627835e-04f,
+	-1.852245e-04f,
+	1.272017e-04f,
+	-8.131471e-05f,
+	4.946754e-05f,
+	-2.513727e-05f,
+	1.106714e-05f,
+	-1.527539e-06f,
+
+	1.656377e-09f,
+	1.414616e-06f,
+	-1.072370e-05f,
+	2.442340e-05f,
+	-4.821470e-05f,
+	7.931823e-05f,
+	-1.242128e-04f,
+	1.809422e-04f,
+	-2.568458e-04f,
+	3.508607e-04f,
+	-4.712536e-04f,
+	6.179311e-04f,
+	-8.001902e-04f,
+	1.019063e-03f,
+	-1.285123e-03f,
+	1.600911e-03f,
+	-1.978872e-03f,
+	2.423968e-03f,
+	-2.951899e-03f,
+	3.572152e-03f,
+	-4.306898e-03f,
+	5.175126e-03f,
+	-6.213342e-03f,
+	7.462829e-03f,
+	-8.996024e-03f,
+	1.091476e-02f,
+	-1.339944e-02f,
+	1.675919e-02f,
+	-2.161395e-02f,
+	2.934548e-02f,
+	-4.381576e-02f,
+	8.067200e-02f,
+	3.760769e-01f,
+	-8.198127e-02f,
+	4.414447e-02f,
+	-2.949403e-02f,
+	2.169943e-02f,
+	-1.681534e-02f,
+	1.343953e-02f,
+	-1.094503e-02f,
+	9.019782e-03f,
+	-7.481996e-03f,
+	6.229109e-03f,
+	-5.188270e-03f,
+	4.317953e-03f,
+	-3.581499e-03f,
+	2.959820e-03f,
+	-2.430682e-03f,
+	1.984551e-03f,
+	-1.605698e-03f,
+	1.289138e-03f,
+	-1.022409e-03f,
+	8.029579e-04f,
+	-6.202005e-04f,
+	4.730960e-04f,
+	-3.523396e-04f,
+	2.580176e-04f,
+	-1.818568e-04f,
+	1.249135e-04f,
+	-7.984210e-05f,
+	4.859305e-05f,
+	-2.468178e-05f,
+	1.088230e-05f,
+	-1.488598e-06f,
+
+	2.633581e-09f,
+	1.341568e-06f,
+	-1.045321e-05f,
+	2.380905e-05f,
+	-4.708154e-05f,
+	7.745453e-05f,
+	-1.213614e-04f,
+	1.767914e-04f,
+	-2.510198e-04f,
+	3.429099e-04f,
+	-4.606442e-04f,
+	6.040342e-04f,
+	-7.822704e-04f,
+	9.962653e-04f,
+	-1.256457e-03f,
+	1.565234e-03f,
+	-1.934862e-03f,
+	2.370097e-03f,
+	-2.886386e-03f,
+	3.492906e-03f,
+	-4.211424e-03f,
+	5.060398e-03f,
+	-6.075596e-03f,
+	7.297243e-03f,
+	-8.796182e-03f,
+	1.067172e-02f,
+	-1.310000e-02f,
+	1.638236e-02f,
+	-2.112287e-02f,
+	2.866512e-02f,
+	-4.275116e-02f,
+	7.835405e-02f,
+	3.609039e-01f,
+	-8.021221e-02f,
+	4.321679e-02f,
+	-2.887548e-02f,
+	2.124389e-02f,
+	-1.646186e-02f,
+	1.315676e-02f,
+	-1.071457e-02f,
+	8.829816e-03f,
+	-7.324378e-03f,
+	6.097917e-03f,
+	-5.079005e-03f,
+	4.227074e-03f,
+	-3.506137e-03f,
+	2.897600e-03f,
+	-2.379601e-03f,
+	1.942902e-03f,
+	-1.572010e-03f,
+	1.262140e-03f,
+	-1.001002e-03f,
+	7.861885e-04f,
+	-6.072469e-04f,
+	4.632524e-04f,
+	-3.450036e-04f,
+	2.526788e-04f,
+	-1.780862e-04f,
+	1.223533e-04f,
+	-7.819619e-05f,
+	4.761717e-05f,
+	-2.417485e-05f,
+	1.067773e-05f,
+	-1.446308e-06f,
+
+	3.985792e-09f,
+	1.258228e-06f,
+	-1.014847e-05f,
+	2.312006e-05f,
+	-4.581359e-05f,
+	7.537204e-05f,
+	-1.181782e-04f,
+	1.721607e-04f,
+	-2.445233e-04f,
+	3.340475e-04f,
+	-4.488220e-04f,
+	5.885528e-04f,
+	-7.623119e-04f,
+	9.708786e-04f,
+	-1.224541e-03f,
+	1.525517e-03f,
+	-1.885876e-03f,
+	2.310142e-03f,
+	-2.813482e-03f,
+	3.404724e-03f,
+	-4.105190e-03f,
+	4.932744e-03f,
+	-5.922332e-03f,
+	7.112996e-03f,
+	-8.573798e-03f,
+	1.040122e-02f,
+	-1.276665e-02f,
+	1.596268e-02f,
+	-2.057555e-02f,
+	2.790589e-02f,
+	-4.155978e-02f,
+	7.573499e-02f,
+	3.458419e-01f,
+	-7.827632e-02f,
+	4.219526e-02f,
+	-2.819286e-02f,
+	2.074062e-02f,
+	-1.607112e-02f,
+	1.284407e-02f,
+	-1.045967e-02f,
+	8.619672e-03f,
+	-7.150005e-03f,
+	5.952775e-03f,
+	-4.958123e-03f,
+	4.126535e-03f,
+	-3.422770e-03f,
+	2.828776e-03f,
+	-2.323104e-03f,
+	1.896841e-03f,
+	-1.534760e-03f,
+	1.232293e-03f,
+	-9.773390e-04f,
+	7.676556e-04f,
+	-5.929344e-04f,
+	4.523792e-04f,
+	-3.369030e-04f,
+	2.467860e-04f,
+	-1.739265e-04f,
+	1.195311e-04f,
+	-7.638356e-05f,
+	4.654414e-05f,
+	-2.361896e-05f,
+	1.045469e-05f,
+	-1.401086e-06f,
+
+	5.794897e-09f,
+	1.164309e-06f,
+	-9.809275e-06f,
+	2.235658e-05f,
+	-4.441177e-05f,
+	7.307281e-05f,
+	-1.146669e-04f,
+	1.670559e-04f,
+	-2.373655e-04f,
+	3.242865e-04f,
+	-4.358052e-04f,
+	5.715116e-04f,
+	-7.403475e-04f,
+	9.429460e-04f,
+	-1.189430e-03f,
+	1.481831e-03f,
+	-1.832002e-03f,
+	2.244211e-03f,
+	-2.733318e-03f,
+	3.307769e-03f,
+	-3.988394e-03f,
+	4.792401e-03f,
+	-5.753832e-03f,
+	6.910425e-03f,
+	-8.329277e-03f,
+	1.010375e-02f,
+	-1.239996e-02f,
+	1.550083e-02f,
+	-1.997281e-02f,
+	2.706869e-02f,
+	-4.024232e-02f,
+	7.280990e-02f,
+	3.309026e-01f,
+	-7.618276e-02f,
+	4.108375e-02f,
+	-2.744850e-02f,
+	2.019126e-02f,
+	-1.564433e-02f,
+	1.250240e-02f,
+	-1.018109e-02f,
+	8.389973e-03f,
+	-6.959392e-03f,
+	5.794111e-03f,
+	-4.825979e-03f,
+	4.016635e-03f,
+	-3.331646e-03f,
+	2.753554e-03f,
+	-2.261361e-03f,
+	1.846510e-03f,
+	-1.494060e-03f,
+	1.199687e-03f,
+	-9.514938e-04f,
+	7.474178e-04f,
+	-5.773091e-04f,
+	4.405119e-04f,
+	-3.280646e-04f,
+	2.403592e-04f,
+	-1.693924e-04f,
+	1.164569e-04f,
+	-7.441119e-05f,
+	4.537838e-05f,
+	-2.301670e-05f,
+	1.021446e-05f,
+	-1.353336e-06f,
+
+	8.148894e-09f,
+	1.059555e-06f,
+	-9.435506e-06f,
+	2.151898e-05f,
+	-4.287733e-05f,
+	7.055949e-05f,
+	-1.108322e-04f,
+	1.614845e-04f,
+	-2.295570e-04f,
+	3.136425e-04f,
+	-4.216154e-04f,
+	5.529395e-04f,
+	-7.164152e-04f,
+	9.125167e-04f,
+	-1.151188e-03f,
+	1.434256e-03f,
+	-1.773339e-03f,
+	2.172427e-03f,
+	-2.646046e-03f,
+	3.202224e-03f,
+	-3.861256e-03f,
+	4.639635e-03f,
+	-5.570417e-03f,
+	6.689914e-03f,
+	-8.063077e-03f,
+	9.779858e-03f,
+	-1.200059e-02f,
+	1.499762e-02f,
+	-1.931560e-02f,
+	2.615464e-02f,
+	-3.879975e-02f,
+	6.957429e-02f,
+	3.160977e-01f,
+	-7.394073e-02f,
+	3.988624e-02f,
+	-2.664484e-02f,
+	1.959750e-02f,
+	-1.518277e-02f,
+	1.213277e-02f,
+	-9.879637e-03f,
+	8.141389e-03f,
+	-6.753093e-03f,
+	5.622386e-03f,
+	-4.682959e-03f,
+	3.897693e-03f,
+	-3.233030e-03f,
+	2.672154e-03f,
+	-2.194554e-03f,
+	1.792057e-03f,
+	-1.450034e-03f,
+	1.164421e-03f,
+	-9.235451e-04f,
+	7.255374e-04f,
+	-5.604194e-04f,
+	4.276879e-04f,
+	-3.185171e-04f,
+	2.334196e-04f,
+	-1.644990e-04f,
+	1.131416e-04f,
+	-7.228630e-05f,
+	4.412448e-05f,
+	-2.237070e-05f,
+	9.958294e-06f,
+	-1.303453e-06f,
+
+	1.114116e-08f,
+	9.437365e-07f,
+	-9.027144e-06f,
+	2.060784e-05f,
+	-4.121190e-05f,
+	6.783529e-05f,
+	-1.066793e-04f,
+	1.554549e-04f,
+	-2.211105e-04f,
+	3.021332e-04f,
+	-4.062768e-04f,
+	5.328693e-04f,
+	-6.905582e-04f,
+	8.796465e-04f,
+	-1.109885e-03f,
+	1.382881e-03f,
+	-1.709998e-03f,
+	2.094928e-03f,
+	-2.551834e-03f,
+	3.088294e-03f,
+	-3.724025e-03f,
+	4.474747e-03f,
+	-5.372446e-03f,
+	6.451894e-03f,
+	-7.775713e-03f,
+	9.430157e-03f,
+	-1.156929e-02f,
+	1.445393e-02f,
+	-1.860503e-02f,
+	2.516505e-02f,
+	-3.723337e-02f,
+	6.602398e-02f,
+	3.014385e-01f,
+	-7.155950e-02f,
+	3.860689e-02f,
+	-2.578444e-02f,
+	1.896116e-02f,
+	-1.468782e-02f,
+	1.173625e-02f,
+	-9.556190e-03f,
+	7.874630e-03f,
+	-6.531695e-03f,
+	5.438088e-03f,
+	-4.529469e-03f,
+	3.770048e-03f,
+	-3.127205e-03f,
+	2.584810e-03f,
+	-2.122876e-03f,
+	1.733640e-03f,
+	-1.402809e-03f,
+	1.126599e-03f,
+	-8.935761e-04f,
+	7.020800e-04f,
+	-5.423168e-04f,
+	4.139468e-04f,
+	-3.082902e-04f,
+	2.259893e-04f,
+	-1.592625e-04f,
+	1.095963e-04f,
+	-7.001640e-05f,
+	4.278717e-05f,
+	-2.168365e-05f,
+	9.687486e-06f,
+	-1.251818e-06f,
+
+	1.486965e-08f,
+	8.166580e-07f,
+	-8.584267e-06f,
+	1.962394e-05f,
+	-3.941745e-05f,
+	6.490399e-05f,
+	-1.022148e-04f,
+	1.489769e-04f,
+	-2.120404e-04f,
+	2.897788e-04f,
+	-3.898170e-04f,
+	5.113375e-04f,
+	-6.628245e-04f,
+	8.443975e-04f,
+	-1.065601e-03f,
+	1.327805e-03f,
+	-1.642104e-03f,
+	2.011866e-03f,
+	-2.450869e-03f,
+	2.966207e-03f,
+	-3.576976e-03f,
+	4.298066e-03f,
+	-5.160317e-03f,
+	6.196840e-03f,
+	-7.467756e-03f,
+	9.055334e-03f,
+	-1.110689e-02f,
+	1.387078e-02f,
+	-1.784233e-02f,
+	2.410142e-02f,
+	-3.554478e-02f,
+	6.215518e-02f,
+	2.869362e-01f,
+	-6.904838e-02f,
+	3.724996e-02f,
+	-2.486996e-02f,
+	1.828412e-02f,
+	-1.416091e-02f,
+	1.131398e-02f,
+	-9.211659e-03f,
+	7.590445e-03f,
+	-6.295818e-03f,
+	5.241731e-03f,
+	-4.365937e-03f,
+	3.634058e-03f,
+	-3.014468e-03f,
+	2.491769e-03f,
+	-2.046530e-03f,
+	1.671426e-03f,
+	-1.352522e-03f,
+	1.086331e-03f,
+	-8.616741e-04f,
+	6.771149e-04f,
+	-5.230553e-04f,
+	3.993300e-04f,
+	-2.974152e-04f,
+	2.180915e-04f,
+	-1.536995e-04f,
+	1.058328e-04f,
+	-6.760926e-05f,
+	4.137130e-05f,
+	-2.095830e-05f,
+	9.403318e-06f,
+	-1.198798e-06f,
+
+	1.943608e-08f,
+	6.781563e-07f,
+	-8.107058e-06f,
+	1.856828e-05f,
+	-3.749635e-05f,
+	6.176997e-05f,
+	-9.744584e-05f,
+	1.420614e-04f,
+	-2.023624e-04f,
+	2.766015e-04f,
+	-3.722664e-04f,
+	4.883849e-04f,
+	-6.332672e-04f,
+	8.068380e-04f,
+	-1.018421e-03f,
+	1.269138e-03f,
+	-1.569791e-03f,
+	1.923409e-03f,
+	-2.343356e-03f,
+	2.836211e-03f,
+	-3.420408e-03f,
+	4.109954e-03f,
+	-4.934460e-03f,
+	5.925269e-03f,
+	-7.139827e-03f,
+	8.656139e-03f,
+	-1.061428e-02f,
+	1.324927e-02f,
+	-1.702886e-02f,
+	2.296546e-02f,
+	-3.373589e-02f,
+	5.796450e-02f,
+	2.726017e-01f,
+	-6.641671e-02f,
+	3.581984e-02f,
+	-2.390416e-02f,
+	1.756836e-02f,
+	-1.360353e-02f,
+	1.086714e-02f,
+	-8.847004e-03f,
+	7.289622e-03f,
+	-6.046114e-03f,
+	5.033860e-03f,
+	-4.192817e-03f,
+	3.490099e-03f,
+	-2.895132e-03f,
+	2.393290e-03f,
+	-1.965729e-03f,
+	1.605590e-03f,
+	-1.299314e-03f,
+	1.043730e-03f,
+	-8.279308e-04f,
+	6.507143e-04f,
+	-5.026910e-04f,
+	3.838808e-04f,
+	-2.859248e-04f,
+	2.097502e-04f,
+	-1.478273e-04f,
+	1.018631e-04f,
+	-6.507287e-05f,
+	3.988184e-05f,
+	-2.019744e-05f,
+	9.107074e-06f,
+	-1.144743e-06f,
+
+	2.494499e-08f,
+	5.281040e-07f,
+	-7.595806e-06f,
+	1.744205e-05f,
+	-3.545130e-05f,
+	5.843816e-05f,
+	-9.238035e-05f,
+	1.347208e-04f,
+	-1.920943e-04f,
+	2.626260e-04f,
+	-3.536585e-04f,
+	4.640557e-04f,
+	-6.019443e-04f,
+	7.670425e-04f,
+	-9.684417e-04f,
+	1.206998e-03f,
+	-1.493207e-03f,
+	1.829738e-03f,
+	-2.229515e-03f,
+	2.698575e-03f,
+	-3.254646e-03f,
+	3.910800e-03f,
+	-4.695346e-03f,
+	5.637745e-03f,
+	-6.792600e-03f,
+	8.233382e-03f,
+	-1.009246e-02f,
+	1.259061e-02f,
+	-1.616612e-02f,
+	2.175904e-02f,
+	-3.180890e-02f,
+	5.344892e-02f,
+	2.584458e-01f,
+	-6.367382e-02f,
+	3.432100e-02f,
+	-2.288990e-02f,
+	1.681592e-02f,
+	-1.301726e-02f,
+	1.039696e-02f,
+	-8.463225e-03f,
+	6.972983e-03f,
+	-5.783264e-03f,
+	4.815039e-03f,
+	-4.010580e-03f,
+	3.338565e-03f,
+	-2.769524e-03f,
+	2.289643e-03f,
+	-1.880697e-03f,
+	1.536315e-03f,
+	-1.243334e-03f,
+	9.989172e-04f,
+	-7.924414e-04f,
+	6.229532e-04f,
+	-4.812824e-04f,
+	3.676440e-04f,
+	-2.738526e-04f,
+	2.009903e-04f,
+	-1.416638e-04f,
+	9.769942e-05f,
+	-6.241543e-05f,
+	3.832387e-05f,
+	-1.940387e-05f,
+	8.800032e-06f,
+	-1.089991e-06f,
+
+	3.150284e-08f,
+	3.664112e-07f,
+	-7.050906e-06f,
+	1.624669e-05f,
+	-3.328540e-05f,
+	5.491408e-05f,
+	-8.702726e-05f,
+	1.269682e-04f,
+	-1.812552e-04f,
+	2.478790e-04f,
+	-3.340294e-04f,
+	4.383982e-04f,
+	-5.689185e-04f,
+	7.250916e-04f,
+	-9.157638e-04f,
+	1.141513e-03f,
+	-1.412511e-03f,
+	1.731047e-03f,
+	-2.109585e-03f,
+	2.553587e-03f,
+	-3.080039e-03f,
+	3.701024e-03f,
+	-4.443476e-03f,
+	5.334872e-03f,
+	-6.426803e-03f,
+	7.787941e-03f,
+	-9.542486e-03f,
+	1.189611e-02f,
+	-1.525576e-02f,
+	2.048426e-02f,
+	-2.976634e-02f,
+	4.860583e-02f,
+	2.444790e-01f,
+	-6.082905e-02f,
+	3.275805e-02f,
+	-2.183012e-02f,
+	1.602892e-02f,
+	-1.240371e-02f,
+	9.904741e-03f,
+	-8.061366e-03f,
+	6.641383e-03f,
+	-5.507976e-03f,
+	4.585859e-03f,
+	-3.819718e-03f,
+	3.179864e-03f,
+	-2.637984e-03f,
+	2.181110e-03f,
+	-1.791666e-03f,
+	1.463790e-03f,
+	-1.184736e-03f,
+	9.520156e-04f,
+	-7.553045e-04f,
+	5.939094e-04f,
+	-4.588900e-04f,
+	3.506658e-04f,
+	-2.612337e-04f,
+	1.918376e-04f,
+	-1.352274e-04f,
+	9.335463e-05f,
+	-5.964532e-05f,
+	3.670254e-05f,
+	-1.858044e-05f,
+	8.483460e-06f,
+	-1.034859e-06f,
+
+	3.921705e-08f,
+	1.930273e-07f,
+	-6.472865e-06f,
+	1.498382e-05f,
+	-3.100207e-05f,
+	5.120380e-05f,
+	-8.139626e-05f,
+	1.188184e-04f,
+	-1.698660e-04f,
+	2.323894e-04f,
+	-3.134183e-04f,
+	4.114640e-04f,
+	-5.342571e-04f,
+	6.810715e-04f,
+	-8.604971e-04f,
+	1.072819e-03f,
+	-1.327872e-03f,
+	1.627546e-03f,
+	-1.983821e-03f,
+	2.401555e-03f,
+	-2.896959e-03f,
+	3.481074e-03f,
+	-4.179390e-03f,
+	5.017293e-03f,
+	-6.043208e-03f,
+	7.320751e-03f,
+	-8.965502e-03f,
+	1.116718e-02f,
+	-1.429954e-02f,
+	1.914338e-02f,
+	-2.761106e-02f,
+	4.343304e-02f,
+	2.307113e-01f,
+	-5.789173e-02f,
+	3.113563e-02f,
+	-2.072783e-02f,
+	1.520954e-02f,
+	-1.176455e-02f,
+	9.391802e-03f,
+	-7.642504e-03f,
+	6.295711e-03f,
+	-5.220986e-03f,
+	4.346931e-03f,
+	-3.620740e-03f,
+	3.014422e-03f,
+	-2.500864e-03f,
+	2.067982e-03f,
+	-1.698874e-03f,
+	1.388210e-03f,
+	-1.123679e-03f,
+	9.031536e-04f,
+	-7.166223e-04f,
+	5.636634e-04f,
+	-4.355763e-04f,
+	3.329941e-04f,
+	-2.481037e-04f,
+	1.823182e-04f,
+	-1.285369e-04f,
+	8.884169e-05f,
+	-5.677108e-05f,
+	3.502308e-05f,
+	-1.773001e-05f,
+	8.158611e-06f,
+	-9.796491e-07f,
+
+	4.819492e-08f,
+	7.942363e-09f,
+	-5.862295e-06f,
+	1.365529e-05f,
+	-2.860513e-05f,
+	4.731393e-05f,
+	-7.549787e-05f,
+	1.102868e-04f,
+	-1.579492e-04f,
+	2.161883e-04f,
+	-2.918670e-04f,
+	3.833084e-04f,
+	-4.980320e-04f,
+	6.350743e-04f,
+	-8.027577e-04f,
+	1.001062e-03f,
+	-1.239471e-03f,
+	1.519455e-03f,
+	-1.852492e-03f,
+	2.242808e-03f,
+	-2.705802e-03f,
+	3.251425e-03f,
+	-3.903657e-03f,
+	4.685692e-03f,
+	-5.642639e-03f,
+	6.832804e-03f,
+	-8.362720e-03f,
+	1.040531e-02f,
+	-1.329935e-02f,
+	1.773885e-02f,
+	-2.534620e-02f,
+	3.792875e-02f,
+	2.171528e-01f,
+	-5.487112e-02f,
+	2.945848e-02f,
+	-1.958613e-02f,
+	1.436003e-02f,
+	-1.110151e-02f,
+	8.859517e-03f,
+	-7.207752e-03f,
+	5.936880e-03f,
+	-4.923052e-03f,
+	4.098887e-03f,
+	-3.414173e-03f,
+	2.842676e-03f,
+	-2.358528e-03f,
+	1.950561e-03f,
+	-1.602571e-03f,
+	1.309780e-03f,
+	-1.060327e-03f,
+	8.524631e-04f,
+	-6.764999e-04f,
+	5.322977e-04f,
+	-4.114054e-04f,
+	3.146778e-04f,
+	-2.344995e-04f,
+	1.724593e-04f,
+	-1.216115e-04f,
+	8.417382e-05f,
+	-5.380138e-05f,
+	3.329076e-05f,
+	-1.685542e-05f,
+	7.826724e-06f,
+	-9.246442e-07f,
+
+	5.854269e-08f,
+	-1.888108e-07f,
+	-5.219923e-06f,
+	1.226316e-05f,
+	-2.609872e-05f,
+	4.325166e-05f,
+	-6.934338e-05f,
+	1.013904e-04f,
+	-1.455286e-04f,
+	1.993087e-04f,
+	-2.694200e-04f,
+	3.539903e-04f,
+	-4.603194e-04f,
+	5.871975e-04f,
+	-7.426690e-04f,
+	9.263971e-04f,
+	-1.147498e-03f,
+	1.407009e-03f,
+	-1.715884e-03f,
+	2.077691e-03f,
+	-2.506983e-03f,
+	3.012578e-03f,
+	-3.616877e-03f,
+	4.340793e-03f,
+	-5.225963e-03f,
+	6.325152e-03f,
+	-7.735419e-03f,
+	9.612096e-03f,
+	-1.225720e-02f,
+	1.627330e-02f,
+	-2.297520e-02f,
+	3.209159e-02f,
+	2.038129e-01f,
+	-5.177646e-02f,
+	2.773141e-02f,
+	-1.840816e-02f,
+	1.348267e-02f,
+	-1.041636e-02f,
+	8.309293e-03f,
+	-6.758254e-03f,
+	5.565833e-03f,
+	-4.614955e-03f,
+	3.842376e-03f,
+	-3.200556e-03f,
+	2.665076e-03f,
+	-2.211350e-03f,
+	1.829155e-03f,
+	-1.503009e-03f,
+	1.228705e-03f,
+	-9.948483e-04f,
+	8.000795e-04f,
+	-6.350448e-04f,
+	4.998969e-04f,
+	-3.864429e-04f,
+	2.957671e-04f,
+	-2.204586e-04f,
+	1.622882e-04f,
+	-1.144709e-04f,
+	7.936449e-05f,
+	-5.074500e-05f,
+	3.151091e-05f,
+	-1.595954e-05f,
+	7.489015e-06f,
+	-8.701085e-07f,
+
+	7.036437e-08f,
+	-3.971556e-07f,
+	-4.546588e-06f,
+	1.080970e-05f,
+	-2.348736e-05f,
+	3.902469e-05f,
+	-6.294487e-05f,
+	9.214706e-05f,
+	-1.326297e-04f,
+	1.817856e-04f,
+	-2.461244e-04f,
+	3.235716e-04f,
+	-4.211998e-04f,
+	5.375440e-04f,
+	-6.803608e-04f,
+	8.489851e-04f,
+	-1.052153e-03f,
+	1.290454e-03f,
+	-1.574295e-03f,
+	1.906568e-03f,
+	-2.300942e-03f,
+	2.765059e-03f,
+	-3.319684e-03f,
+	3.983351e-03f,
+	-4.794094e-03f,
+	5.798899e-03f,
+	-7.084951e-03f,
+	8.789206e-03f,
+	-1.117522e-02f,
+	1.474954e-02f,
+	-2.050183e-02f,
+	2.592062e-02f,
+	1.907011e-01f,
+	-4.861691e-02f,
+	2.595924e-02f,
+	-1.719713e-02f,
+	1.257981e-02f,
+	-9.710902e-03f,
+	7.742571e-03f,
+	-6.295184e-03f,
+	5.183536e-03f,
+	-4.297497e-03f,
+	3.578066e-03f,
+	-2.980447e-03f,
+	2.482085e-03f,
+	-2.059713e-03f,
+	1.704081e-03f,
+	-1.400450e-03f,
+	1.145200e-03f,
+	-9.274162e-04f,
+	7.461415e-04f,
+	-5.923673e-04f,
+	4.665477e-04f,
+	-3.607559e-04f,
+	2.763131e-04f,
+	-2.060194e-04f,
+	1.518331e-04f,
+	-1.071349e-04f,
+	7.442733e-05f,
+	-4.761081e-05f,
+	2.968887e-05f,
+	-1.504521e-05f,
+	7.146679e-06f,
+	-8.162871e-07f,
+
+	8.376074e-08f,
+	-6.169699e-07f,
+	-3.843238e-06f,
+	9.297395e-06f,
+	-2.077588e-05f,
+	3.464125e-05f,
+	-5.631519e-05f,
+	8.257564e-05f,
+	-1.192793e-04f,
+	1.636558e-04f,
+	-2.220298e-04f,
+	2.921176e-04f,
+	-3.807576e-04f,
+	4.862216e-04f,
+	-6.159690e-04f,
+	7.689961e-04f,
+	-9.536470e-04f,
+	1.170047e-03f,
+	-1.428041e-03f,
+	1.729817e-03f,
+	-2.088135e-03f,
+	2.509418e-03f,
+	-3.012737e-03f,
+	3.614161e-03f,
+	-4.347986e-03f,
+	5.255201e-03f,
+	-6.412731e-03f,
+	7.938407e-03f,
+	-1.005568e-02f,
+	1.317055e-02f,
+	-1.793016e-02f,
+	1.941532e-02f,
+	1.778262e-01f,
+	-4.540155e-02f,
+	2.414687e-02f,
+	-1.595627e-02f,
+	1.165383e-02f,
+	-8.986983e-03f,
+	7.160824e-03f,
+	-5.819739e-03f,
+	4.790974e-03f,
+	-3.971494e-03f,
+	3.306636e-03f,
+	-2.754413e-03f,
+	2.294175e-03f,
+	-1.904011e-03f,
+	1.575665e-03f,
+	-1.295160e-03f,
+	1.059482e-03f,
+	-8.582064e-04f,
+	6.907904e-04f,
+	-5.485796e-04f,
+	4.323381e-04f,
+	-3.344126e-04f,
+	2.563678e-04f,
+	-1.912206e-04f,
+	1.411223e-04f,
+	-9.962376e-05f,
+	6.937611e-05f,
+	-4.440774e-05f,
+	2.783000e-05f,
+	-1.411527e-05f,
+	6.800882e-06f,
+	-7.634056e-07f,
+
+	9.882822e-08f,
+	-8.480851e-07f,
+	-3.110936e-06f,
+	7.728928e-06f,
+	-1.796948e-05f,
+	3.011006e-05f,
+	-4.946790e-05f,
+	7.269614e-05f,
+	-1.055056e-04f,
+	1.449583e-04f,
+	-1.971881e-04f,
+	2.596967e-04f,
+	-3.390813e-04f,
+	4.333431e-04f,
+	-5.496358e-04f,
+	6.866075e-04f,
+	-8.521985e-04f,
+	1.046057e-03f,
+	-1.277448e-03f,
+	1.547834e-03f,
+	-1.869039e-03f,
+	2.246230e-03f,
+	-2.696724e-03f,
+	3.234050e-03f,
+	-3.888634e-03f,
+	4.695266e-03f,
+	-5.720238e-03f,
+	7.061542e-03f,
+	-8.900918e-03f,
+	1.153948e-02f,
+	-1.526456e-02f,
+	1.257562e-02f,
+	1.651969e-01f,
+	-4.213935e-02f,
+	2.229919e-02f,
+	-1.468887e-02f,
+	1.070715e-02f,
+	-8.246476e-03f,
+	6.565550e-03f,
+	-5.333140e-03f,
+	4.389155e-03f,
+	-3.637783e-03f,
+	3.028783e-03f,
+	-2.523032e-03f,
+	2.101829e-03f,
+	-1.744642e-03f,
+	1.444235e-03f,
+	-1.187411e-03f,
+	9.717722e-04f,
+	-7.873983e-04f,
+	6.341698e-04f,
+	-5.037960e-04f,
+	3.973577e-04f,
+	-3.074824e-04f,
+	2.359839e-04f,
+	-1.761017e-04f,
+	1.301845e-04f,
+	-9.195774e-05f,
+	6.422470e-05f,
+	-4.114475e-05f,
+	2.593965e-05f,
+	-1.317251e-05f,
+	6.452760e-06f,
+	-7.116701e-07f,
+
+	1.156578e-07f,
+	-1.090285e-06f,
+	-2.350857e-06f,
+	6.107191e-06f,
+	-1.507366e-05f,
+	2.544037e-05f,
+	-4.241727e-05f,
+	6.252951e-05f,
+	-9.133828e-05f,
+	1.257334e-04f,
+	-1.716535e-04f,
+	2.263800e-04f,
+	-2.962629e-04f,
+	3.790258e-04f,
+	-4.815091e-04f,
+	6.020034e-04f,
+	-7.480350e-04f,
+	9.187622e-04f,
+	-1.122855e-03f,
+	1.361031e-03f,
+	-1.644151e-03f,
+	1.976088e-03f,
+	-2.372359e-03f,
+	2.843873e-03f,
+	-3.417071e-03f,
+	4.120345e-03f,
+	-5.009009e-03f,
+	6.160529e-03f,
+	-7.713411e-03f,
+	9.859643e-03f,
+	-1.250967e-02f,
+	5.401850e-03f,
+	1.528214e-01f,
+	-3.883919e-02f,
+	2.042112e-02f,
+	-1.339825e-02f,
+	9.742223e-03f,
+	-7.491283e-03f,
+	5.958271e-03f,
+	-4.836628e-03f,
+	3.979101e-03f,
+	-3.297212e-03f,
+	2.745211e-03f,
+	-2.286892e-03f,
+	1.905534e-03f,
+	-1.582012e-03f,
+	1.310127e-03f,
+	-1.077478e-03f,
+	8.822951e-04f,
+	-7.151735e-04f,
+	5.764259e-04f,
+	-4.581321e-04f,
+	3.616973e-04f,
+	-2.800352e-04f,
+	2.152147e-04f,
+	-1.607024e-04f,
+	1.190488e-04f,
+	-8.415739e-05f,
+	5.898705e-05f,
+	-3.783083e-05f,
+	2.402316e-05f,
+	-1.221972e-05f,
+	6.103417e-06f,
+	-6.612669e-07f,
+
+	1.343338e-07f,
+	-1.343305e-06f,
+	-1.564286e-06f,
+	4.435273e-06f,
+	-1.209426e-05f,
+	2.064186e-05f,
+	-3.517827e-05f,
+	5.209761e-05f,
+	-7.680801e-05f,
+	1.060234e-04f,
+	-1.454825e-04f,
+	1.922416e-04f,
+	-2.523980e-04f,
+	3.233915e-04f,
+	-4.117421e-04f,
+	5.153748e-04f,
+	-6.413923e-04f,
+	7.884515e-04f,
+	-9.646129e-04f,
+	1.169832e-03f,
+	-1.413981e-03f,
+	1.699609e-03f,
+	-2.040380e-03f,
+	2.444518e-03f,
+	-2.934367e-03f,
+	3.531736e-03f,
+	-4.280635e-03f,
+	5.237363e-03f,
+	-6.495727e-03f,
+	8.134500e-03f,
+	-9.670472e-03f,
+	-2.105179e-03f,
+	1.407077e-01f,
+	-3.550983e-02f,
+	1.851759e-02f,
+	-1.208774e-02f,
+	8.761508e-03f,
+	-6.723326e-03f,
+	5.340527e-03f,
+	-4.331458e-03f,
+	3.561847e-03f,
+	-2.950639e-03f,
+	2.456639e-03f,
+	-2.046592e-03f,
+	1.705789e-03f,
+	-1.416534e-03f,
+	1.173682e-03f,
+	-9.656398e-04f,
+	7.912784e-04f,
+	-6.417164e-04f,
+	5.177059e-04f,
+	-4.117049e-04f,
+	3.254483e-04f,
+	-2.521420e-04f,
+	1.941141e-04f,
+	-1.450629e-04f,
+	1.077443e-04f,
+	-7.624328e-05f,
+	5.367712e-05f,
+	-3.447494e-05f,
+	2.208583e-05f,
+	-1.125962e-05f,
+	5.753925e-06f,
+	-6.123630e-07f,
+
+	1.549330e-07f,
+	-1.606830e-06f,
+	-7.526197e-07f,
+	2.716459e-06f,
+	-9.037412e-06f,
+	1.572471e-05f,
+	-2.776649e-05f,
+	4.142321e-05f,
+	-6.194687e-05f,
+	8.587196e-05f,
+	-1.187334e-04f,
+	1.573580e-04f,
+	-2.075854e-04f,
+	2.665660e-04f,
+	-3.404930e-04f,
+	4.269187e-04f,
+	-5.325135e-04f,
+	6.554226e-04f,
+	-8.030844e-04f,
+	9.746750e-04f,
+	-1.179058e-03f,
+	1.417424e-03f,
+	-1.701549e-03f,
+	2.036899e-03f,
+	-2.441624e-03f,
+	2.930779e-03f,
+	-3.536765e-03f,
+	4.294106e-03f,
+	-5.250532e-03f,
+	6.367674e-03f,
+	-6.752198e-03f,
+	-9.944241e-03f,
+	1.288633e-01f,
+	-3.215987e-02f,
+	1.659350e-02f,
+	-1.076070e-02f,
+	7.767499e-03f,
+	-5.944544e-03f,
+	4.713872e-03f,
+	-3.818899e-03f,
+	3.138442e-03f,
+	-2.598936e-03f,
+	2.163789e-03f,
+	-1.802732e-03f,
+	1.503094e-03f,
+	-1.248622e-03f,
+	1.035242e-03f,
+	-8.521784e-04f,
+	6.989519e-04f,
+	-5.672125e-04f,
+	4.581588e-04f,
+	-3.646322e-04f,
+	2.887033e-04f,
+	-2.238739e-04f,
+	1.727362e-04f,
+	-1.292233e-04f,
+	9.630022e-05f,
+	-6.823606e-05f,
+	4.830890e-05f,
+	-3.108602e-05f,
+	2.013293e-05f,
+	-1.029490e-05f,
+	5.405312e-06f,
+	-5.651052e-07f,
+
+	1.775235e-07f,
+	-1.880497e-06f,
+	8.263787e-08f,
+	9.542235e-07f,
+	-5.909555e-06f,
+	1.069951e-05f,
+	-2.019816e-05f,
+	3.052994e-05f,
+	-4.678800e-05f,
+	6.532434e-05f,
+	-9.146668e-05f,
+	1.218084e-04f,
+	-1.619271e-04f,
+	2.086789e-04f,
+	-2.679249e-04f,
+	3.368379e-04f,
+	-4.216487e-04f,
+	5.199815e-04f,
+	-6.386414e-04f,
+	7.760103e-04f,
+	-9.399226e-04f,
+	1.130187e-03f,
+	-1.356646e-03f,
+	1.621956e-03f,
+	-1.939974e-03f,
+	2.318850e-03f,
+	-2.779091e-03f,
+	3.332885e-03f,
+	-3.980581e-03f,
+	4.562927e-03f,
+	-3.760379e-03f,
+	-1.811366e-02f,
+	1.172955e-01f,
+	-2.879778e-02f,
+	1.465375e-02f,
+	-9.420462e-03f,
+	6.762696e-03f,
+	-5.156890e-03f,
+	4.079875e-03f,
+	-3.300233e-03f,
+	2.709941e-03f,
+	-2.242980e-03f,
+	1.867391e-03f,
+	-1.555923e-03f,
+	1.297956e-03f,
+	-1.078697e-03f,
+	8.951540e-04f,
+	-7.373779e-04f,
+	6.055470e-04f,
+	-4.918490e-04f,
+	3.979343e-04f,
+	-3.170329e-04f,
+	2.515549e-04f,
+	-1.953025e-04f,
+	1.511352e-04f,
+	-1.132242e-04f,
+	8.474592e-05f,
+	-6.015634e-05f,
+	4.289630e-05f,
+	-2.767298e-05f,
+	1.816965e-05f,
+	-9.328205e-06f,
+	5.058572e-06f,
+	-5.196216e-07f,
+
+	2.021634e-07f,
+	-2.163890e-06f,
+	9.398739e-07f,
+	-8.477746e-07f,
+	-2.717407e-06f,
+	5.577274e-06f,
+	-1.249009e-05f,
+	1.944221e-05f,
+	-3.136562e-05f,
+	4.442718e-05f,
+	-6.374443e-05f,
+	8.567399e-05f,
+	-1.155278e-04f,
+	1.498635e-04f,
+	-1.942050e-04f,
+	2.453405e-04f,
+	-3.090546e-04f,
+	3.824424e-04f,
+	-4.716655e-04f,
+	5.742994e-04f,
+	-6.971316e-04f,
+	8.385646e-04f,
+	-1.006474e-03f,
+	1.200651e-03f,
+	-1.430581e-03f,
+	1.697362e-03f,
+	-2.009354e-03f,
+	2.355887e-03f,
+	-2.688719e-03f,
+	2.724161e-03f,
+	-7.008211e-04f,
+	-2.661132e-02f,
+	1.060108e-01f,
+	-2.543185e-02f,
+	1.270320e-02f,
+	-8.070395e-03f,
+	5.749602e-03f,
+	-4.362321e-03f,
+	3.440108e-03f,
+	-2.776744e-03f,
+	2.277406e-03f,
+	-1.883651e-03f,
+	1.568181e-03f,
+	-1.306776e-03f,
+	1.090882e-03f,
+	-9.071809e-04f,
+	7.537656e-04f,
+	-6.215238e-04f,
+	5.112964e-04f,
+	-4.158137e-04f,
+	3.371827e-04f,
+	-2.690259e-04f,
+	2.140962e-04f,
+	-1.664997e-04f,
+	1.293656e-04f,
+	-9.710577e-05f,
+	7.311068e-05f,
+	-5.202469e-05f,
+	3.745318e-05f,
+	-2.424462e-05f,
+	1.620113e-05f,
+	-8.362098e-06f,
+	4.714654e-06f,
+	-4.760209e-07f,
+
+	2.289002e-07f,
+	-2.456544e-06f,
+	1.817371e-06f,
+	-2.685700e-06f,
+	5.320358e-07f,
+	3.694205e-07f,
+	-4.659635e-06f,
+	8.185177e-06f,
+	-1.571492e-05f,
+	2.322837e-05f,
+	-3.563044e-05f,
+	4.903823e-05f,
+	-6.849485e-05f,
+	9.025601e-05f,
+	-1.195047e-04f,
+	1.526396e-04f,
+	-1.949935e-04f,
+	2.431259e-04f,
+	-3.025467e-04f,
+	3.700134e-04f,
+	-4.512524e-04f,
+	5.432383e-04f,
+	-6.518504e-04f,
+	7.739679e-04f,
+	-9.146296e-04f,
+	1.067759e-03f,
+	-1.229334e-03f,
+	1.365356e-03f,
+	-1.377868e-03f,
+	8.554074e-04f,
+	2.420399e-03f,
+	-3.543467e-02f,
+	9.501588e-02f,
+	-2.207020e-02f,
+	1.074667e-02f,
+	-6.713836e-03f,
+	4.730723e-03f,
+	-3.562799e-03f,
+	2.796149e-03f,
+	-2.249723e-03f,
+	1.841903e-03f,
+	-1.521836e-03f,
+	1.266896e-03f,
+	-1.055904e-03f,
+	8.823845e-04f,
+	-7.344959e-04f,
+	6.114260e-04f,
+	-5.049023e-04f,
+	4.164331e-04f,
+	-3.392949e-04f,
+	2.760547e-04f,
+	-2.207302e-04f,
+	1.764204e-04f,
+	-1.375370e-04f,
+	1.074815e-04f,
+	-8.090842e-05f,
+	6.142362e-05f,
+	-4.386155e-05f,
+	3.199331e-05f,
+	-2.080965e-05f,
+	1.423242e-05f,
+	-7.399095e-06f,
+	4.374464e-06f,
+	-4.343932e-07f,
+
+	2.577693e-07f,
+	-2.757942e-06f,
+	2.713309e-06f,
+	-4.555546e-06f,
+	3.831522e-06f,
+	-4.912274e-06f,
+	3.275336e-06f,
+	-3.215302e-06f,
+	1.279841e-07f,
+	1.777018e-06f,
+	-7.190011e-06f,
+	1.198640e-05f,
+	-2.093803e-05f,
+	2.999593e-05f,
+	-4.399883e-05f,
+	5.895243e-05f,
+	-7.973313e-05f,
+	1.023595e-04f,
+	-1.316826e-04f,
+	1.636329e-04f,
+	-2.028633e-04f,
+	2.449031e-04f,
+	-2.936091e-04f,
+	3.429097e-04f,
+	-3.933323e-04f,
+	4.315150e-04f,
+	-4.408502e-04f,
+	3.635845e-04f,
+	-5.102583e-05f,
+	-1.039181e-03f,
+	5.596943e-03f,
+	-4.458071e-02f,
+	8.431656e-02f,
+	-1.872079e-02f,
+	8.788950e-03f,
+	-5.354110e-03f,
+	3.708557e-03f,
+	-2.760284e-03f,
+	2.149576e-03f,
+	-1.720460e-03f,
+	1.404499e-03f,
+	-1.158420e-03f,
+	9.642729e-04f,
+	-8.039228e-04f,
+	6.729737e-04f,
+	-5.610659e-04f,
+	4.684843e-04f,
+	-3.877997e-04f,
+	3.211899e-04f,
+	-2.624806e-04f,
+	2.147005e-04f,
+	-1.722648e-04f,
+	1.386202e-04f,
+	-1.084859e-04f,
+	8.553710e-05f,
+	-6.467220e-05f,
+	4.971374e-05f,
+	-3.568721e-05f,
+	2.653029e-05f,
+	-1.737668e-05f,
+	1.226848e-05f,
+	-6.441636e-06f,
+	4.038865e-06f,
+	-3.948106e-07f,
+
+	2.887933e-07f,
+	-3.067516e-06f,
+	3.625768e-06f,
+	-6.453142e-06f,
+	7.173558e-06f,
+	-1.025568e-05f,
+	1.129648e-05f,
+	-1.473274e-05f,
+	1.612616e-05f,
+	-1.987673e-05f,
+	2.151020e-05f,
+	-2.539450e-05f,
+	2.703082e-05f,
+	-3.077490e-05f,
+	3.213455e-05f,
+	-3.549993e-05f,
+	3.645426e-05f,
+	-3.952418e-05f,
+	4.052282e-05f,
+	-4.435384e-05f,
+	4.744778e-05f,
+	-5.573504e-05f,
+	6.740230e-05f,
+	-9.150481e-05f,
+	1.320805e-04f,
+	-2.098706e-04f,
+	3.542460e-04f,
+	-6.470886e-04f,
+	1.288745e-03f,
+	-2.955334e-03f,
+	8.822215e-03f,
+	-5.404600e-02f,
+	7.391845e-02f,
+	-1.539133e-02f,
+	6.834737e-03f,
+	-3.994515e-03f,
+	2.685588e-03f,
+	-1.956729e-03f,
+	1.501963e-03f,
+	-1.190245e-03f,
+	9.662586e-04f,
+	-7.942894e-04f,
+	6.610497e-04f,
+	-5.514460e-04f,
+	4.631600e-04f,
+	-3.873135e-04f,
+	3.252892e-04f,
+	-2.705016e-04f,
+	2.257995e-04f,
+	-1.855583e-04f,
+	1.532700e-04f,
+	-1.237482e-04f,
+	1.007882e-04f,
+	-7.941751e-05f,
+	6.358610e-05f,
+	-4.843690e-05f,
+	3.800976e-05f,
+	-2.752176e-05f,
+	2.107756e-05f,
+	-1.395417e-05f,
+	1.031415e-05f,
+	-5.492086e-06f,
+	3.708671e-06f,
+	-3.573275e-07f,
+
+	3.219813e-07f,
+	-3.384649e-06f,
+	4.552730e-06f,
+	-8.374166e-06f,
+	1.055042e-05f,
+	-1.564836e-05f,
+	1.938501e-05f,
+	-2.634009e-05f,
+	3.224191e-05f,
+	-4.168175e-05f,
+	5.040235e-05f,
+	-6.301596e-05f,
+	7.529800e-05f,
+	-9.191225e-05f,
+	1.087146e-04f,
+	-1.304930e-04f,
+	1.532924e-04f,
+	-1.821876e-04f,
+	2.136597e-04f,
+	-2.534517e-04f,
+	2.990851e-04f,
+	-3.579605e-04f,
+	4.303247e-04f,
+	-5.282425e-04f,
+	6.603607e-04f,
+	-8.548767e-04f,
+	1.154074e-03f,
+	-1.664284e-03f,
+	2.638318e-03f,
+	-4.888678e-03f,
+	1.208937e-02f,
+	-6.382668e-02f,
+	6.382668e-02f,
+	-1.208937e-02f,
+	4.888678e-03f,
+	-2.638318e-03f,
+	1.664284e-03f,
+	-1.154074e-03f,
+	8.548767e-04f,
+	-6.603607e-04f,
+	5.282425e-04f,
+	-4.303247e-04f,
+	3.579605e-04f,
+	-2.990851e-04f,
+	2.534517e-04f,
+	-2.136597e-04f,
+	1.821876e-04f,
+	-1.532924e-04f,
+	1.304930e-04f,
+	-1.087146e-04f,
+	9.191225e-05f,
+	-7.529800e-05f,
+	6.301596e-05f,
+	-5.040235e-05f,
+	4.168175e-05f,
+	-3.224191e-05f,
+	2.634009e-05f,
+	-1.938501e-05f,
+	1.564836e-05f,
+	-1.055042e-05f,
+	8.374166e-06f,
+	-4.552730e-06f,
+	3.384649e-06f,
+	-3.219813e-07f,
+
+	3.573275e-07f,
+	-3.708671e-06f,
+	5.492086e-06f,
+	-1.031415e-05f,
+	1.395417e-05f,
+	-2.107756e-05f,
+	2.752176e-05f,
+	-3.800976e-05f,
+	4.843690e-05f,
+	-6.358610e-05f,
+	7.941751e-05f,
+	-1.007882e-04f,
+	1.237482e-04f,
+	-1.532700e-04f,
+	1.855583e-04f,
+	-2.257995e-04f,
+	2.705016e-04f,
+	-3.252892e-04f,
+	3.873135e-04f,
+	-4.631600e-04f,
+	5.514460e-04f,
+	-6.610497e-04f,
+	7.942894e-04f,
+	-9.662586e-04f,
+	1.190245e-03f,
+	-1.501963e-03f,
+	1.956729e-03f,
+	-2.685588e-03f,
+	3.994515e-03f,
+	-6.834737e-03f,
+	1.539133e-02f,
+	-7.391845e-02f,
+	5.404600e-02f,
+	-8.822215e-03f,
+	2.955334e-03f,
+	-1.288745e-03f,
+	6.470886e-04f,
+	-3.542460e-04f,
+	2.098706e-04f,
+	-1.320805e-04f,
+	9.150481e-05f,
+	-6.740230e-05f,
+	5.573504e-05f,
+	-4.744778e-05f,
+	4.435384e-05f,
+	-4.052282e-05f,
+	3.952418e-05f,
+	-3.645426e-05f,
+	3.549993e-05f,
+	-3.213455e-05f,
+	3.077490e-05f,
+	-2.703082e-05f,
+	2.539450e-05f,
+	-2.151020e-05f,
+	1.987673e-05f,
+	-1.612616e-05f,
+	1.473274e-05f,
+	-1.129648e-05f,
+	1.025568e-05f,
+	-7.173558e-06f,
+	6.453142e-06f,
+	-3.625768e-06f,
+	3.067516e-06f,
+	-2.887933e-07f,
+
+	3.948106e-07f,
+	-4.038865e-06f,
+	6.441636e-06f,
+	-1.226848e-05f,
+	1.737668e-05f,
+	-2.653029e-05f,
+	3.568721e-05f,
+	-4.971374e-05f,
+	6.467220e-05f,
+	-8.553710e-05f,
+	1.084859e-04f,
+	-1.386202e-04f,
+	1.722648e-04f,
+	-2.147005e-04f,
+	2.624806e-04f,
+	-3.211899e-04f,
+	3.877997e-04f,
+	-4.684843e-04f,
+	5.610659e-04f,
+	-6.729737e-04f,
+	8.039228e-04f,
+	-9.642729e-04f,
+	1.158420e-03f,
+	-1.404499e-03f,
+	1.720460e-03f,
+	-2.149576e-03f,
+	2.760284e-03f,
+	-3.708557e-03f,
+	5.354110e-03f,
+	-8.788950e-03f,
+	1.872079e-02f,
+	-8.431656e-02f,
+	4.458071e-02f,
+	-5.596943e-03f,
+	1.039181e-03f,
+	5.102583e-05f,
+	-3.635845e-04f,
+	4.408502e-04f,
+	-4.315150e-04f,
+	3.933323e-04f,
+	-3.429097e-04f,
+	2.936091e-04f,
+	-2.449031e-04f,
+	2.028633e-04f,
+	-1.636329e-04f,
+	1.316826e-04f,
+	-1.023595e-04f,
+	7.973313e-05f,
+	-5.895243e-05f,
+	4.399883e-05f,
+	-2.999593e-05f,
+	2.093803e-05f,
+	-1.198640e-05f,
+	7.190011e-06f,
+	-1.777018e-06f,
+	-1.279841e-07f,
+	3.215302e-06f,
+	-3.275336e-06f,
+	4.912274e-06f,
+	-3.831522e-06f,
+	4.555546e-06f,
+	-2.713309e-06f,
+	2.757942e-06f,
+	-2.577693e-07f,
+
+	4.343932e-07f,
+	-4.374464e-06f,
+	7.399095e-06f,
+	-1.423242e-05f,
+	2.080965e-05f,
+	-3.199331e-05f,
+	4.386155e-05f,
+	-6.142362e-05f,
+	8.090842e-05f,
+	-1.074815e-04f,
+	1.375370e-04f,
+	-1.764204e-04f,
+	2.207302e-04f,
+	-2.760547e-04f,
+	3.392949e-04f,
+	-4.164331e-04f,
+	5.049023e-04f,
+	-6.114260e-04f,
+	7.344959e-04f,
+	-8.823845e-04f,
+	1.055904e-03f,
+	-1.266896e-03f,
+	1.521836e-03f,
+	-1.841903e-03f,
+	2.249723e-03f,
+	-2.796149e-03f,
+	3.562799e-03f,
+	-4.730723e-03f,
+	6.713836e-03f,
+	-1.074667e-02f,
+	2.207020e-02f,
+	-9.501588e-02f,
+	3.543467e-02f,
+	-2.420399e-03f,
+	-8.554074e-04f,
+	1.377868e-03f,
+	-1.365356e-03f,
+	1.229334e-03f,
+	-1.067759e-03f,
+	9.146296e-04f,
+	-7.739679e-04f,
+	6.518504e-04f,
+	-5.432383e-04f,
+	4.512524e-04f,
+	-3.700134e-04f,
+	3.025467e-04f,
+	-2.431259e-04f,
+	1.949935e-04f,
+	-1.526396e-04f,
+	1.195047e-04f,
+	-9.025601e-05f,
+	6.849485e-05f,
+	-4.903823e-05f,
+	3.563044e-05f,
+	-2.322837e-05f,
+	1.571492e-05f,
+	-8.185177e-06f,
+	4.659635e-06f,
+	-3.694205e-07f,
+	-5.320358e-07f,
+	2.685700e-06f,
+	-1.817371e-06f,
+	2.456544e-06f,
+	-2.289002e-07f,
+
+	4.760209e-07f,
+	-4.714654e-06f,
+	8.362098e-06f,
+	-1.620113e-05f,
+	2.424462e-05f,
+	-3.745318e-05f,
+	5.202469e-05f,
+	-7.311068e-05f,
+	9.710577e-05f,
+	-1.293656e-04f,
+	1.664997e-04f,
+	-2.140962e-04f,
+	2.690259e-04f,
+	-3.371827e-04f,
+	4.158137e-04f,
+	-5.112964e-04f,
+	6.215238e-04f,
+	-7.537656e-04f,
+	9.071809e-04f,
+	-1.090882e-03f,
+	1.306776e-03f,
+	-1.568181e-03f,
+	1.883651e-03f,
+	-2.277406e-03f,
+	2.776744e-03f,
+	-3.440108e-03f,
+	4.362321e-03f,
+	-5.749602e-03f,
+	8.070395e-03f,
+	-1.270320e-02f,
+	2.543185e-02f,
+	-1.060108e-01f,
+	2.661132e-02f,
+	7.008211e-04f,
+	-2.724161e-03f,
+	2.688719e-03f,
+	-2.355887e-03f,
+	2.009354e-03f,
+	-1.697362e-03f,
+	1.430581e-03f,
+	-1.200651e-03f,
+	1.006474e-03f,
+	-8.385646e-04f,
+	6.971316e-04f,
+	-5.742994e-04f,
+	4.716655e-04f,
+	-3.824424e-04f,
+	3.090546e-04f,
+	-2.453405e-04f,
+	1.942050e-04f,
+	-1.498635e-04f,
+	1.155278e-04f,
+	-8.567399e-05f,
+	6.374443e-05f,
+	-4.442718e-05f,
+	3.136562e-05f,
+	-1.944221e-05f,
+	1.249009e-05f,
+	-5.577274e-06f,
+	2.717407e-06f,
+	8.477746e-07f,
+	-9.398739e-07f,
+	2.163890e-06f,
+	-2.021635e-07f,
+
+	5.196216e-07f,
+	-5.058572e-06f,
+	9.328205e-06f,
+	-1.816965e-05f,
+	2.767298e-05f,
+	-4.289630e-05f,
+	6.015634e-05f,
+	-8.474592e-05f,
+	1.132242e-04f,
+	-1.511352e-04f,
+	1.953025e-04f,
+	-2.515549e-04f,
+	3.170329e-04f,
+	-3.979343e-04f,
+	4.918490e-04f,
+	-6.055470e-04f,
+	7.373779e-04f,
+	-8.951540e-04f,
+	1.078697e-03f,
+	-1.297956e-03f,
+	1.555923e-03f,
+	-1.867391e-03f,
+	2.242980e-03f,
+	-2.709941e-03f,
+	3.300233e-03f,
+	-4.079875e-03f,
+	5.156890e-03f,
+	-6.762696e-03f,
+	9.420462e-03f,
+	-1.465375e-02f,
+	2.879778e-02f,
+	-1.172955e-01f,
+	1.811366e-02f,
+	3.760379e-03f,
+	-4.562927e-03f,
+	3.980581e-03f,
+	-3.332885e-03f,
+	2.779091e-03f,
+	-2.318850e-03f,
+	1.939974e-03f,
+	-1.621956e-03f,
+	1.356646e-03f,
+	-1.130187e-03f,
+	9.399226e-04f,
+	-7.760103e-04f,
+	6.386414e-04f,
+	-5.199815e-04f,
+	4.216487e-04f,
+	-3.368379e-04f,
+	2.679249e-04f,
+	-2.086789e-04f,
+	1.619271e-04f,
+	-1.218084e-04f,
+	9.146668e-05f,
+	-6.532434e-05f,
+	4.678800e-05f,
+	-3.052994e-05f,
+	2.019816e-05f,
+	-1.069951e-05f,
+	5.909555e-06f,
+	-9.542235e-07f,
+	-8.263787e-08f,
+	1.880497e-06f,
+	-1.775235e-07f,
+
+	5.651052e-07f,
+	-5.405312e-06f,
+	1.029490e-05f,
+	-2.013293e-05f,
+	3.108602e-05f,
+	-4.830890e-05f,
+	6.823606e-05f,
+	-9.630022e-05f,
+	1.292233e-04f,
+	-1.727362e-04f,
+	2.238739e-04f,
+	-2.887033e-04f,
+	3.646322e-04f,
+	-4.581588e-04f,
+	5.672125e-04f,
+	-6.989519e-04f,
+	8.521784e-04f,
+	-1.035242e-03f,
+	1.248622e-03f,
+	-1.503094e-03f,
+	1.802732e-03f,
+	-2.163789e-03f,
+	2.598936e-03f,
+	-3.138442e-03f,
+	3.818899e-03f,
+	-4.713872e-03f,
+	5.944544e-03f,
+	-7.767499e-03f,
+	1.076070e-02f,
+	-1.659350e-02f,
+	3.215987e-02f,
+	-1.288633e-01f,
+	9.944241e-03f,
+	6.752198e-03f,
+	-6.367674e-03f,
+	5.250532e-03f,
+	-4.294106e-03f,
+	3.536765e-03f,
+	-2.930779e-03f,
+	2.441624e-03f,
+	-2.036899e-03f,
+	1.701549e-03f,
+	-1.417424e-03f,
+	1.179058e-03f,
+	-9.746750e-04f,
+	8.030844e-04f,
+	-6.554226e-04f,
+	5.325135e-04f,
+	-4.269187e-04f,
+	3.404930e-04f,
+	-2.665660e-04f,
+	2.075854e-04f,
+	-1.573580e-04f,
+	1.187334e-04f,
+	-8.587196e-05f,
+	6.194687e-05f,
+	-4.142321e-05f,
+	2.776649e-05f,
+	-1.572471e-05f,
+	9.037412e-06f,
+	-2.716459e-06f,
+	7.526197e-07f,
+	1.606830e-06f,
+	-1.549330e-07f,
+
+	6.123630e-07f,
+	-5.753925e-06f,
+	1.125962e-05f,
+	-2.208583e-05f,
+	3.447494e-05f,
+	-5.367712e-05f,
+	7.624328e-05f,
+	-1.077443e-04f,
+	1.450629e-04f,
+	-1.941141e-04f,
+	2.521420e-04f,
+	-3.254483e-04f,
+	4.117049e-04f,
+	-5.177059e-04f,
+	6.417164e-04f,
+	-7.912784e-04f,
+	9.656398e-04f,
+	-1.173682e-03f,
+	1.416534e-03f,
+	-1.705789e-03f,
+	2.046592e-03f,
+	-2.456639e-03f,
+	2.950639e-03f,
+	-3.561847e-03f,
+	4.331458e-03f,
+	-5.340527e-03f,
+	6.723326e-03f,
+	-8.761508e-03f,
+	1.208774e-02f,
+	-1.851759e-02f,
+	3.550983e-02f,
+	-1.407077e-01f,
+	2.105179e-03f,
+	9.670472e-03f,
+	-8.134500e-03f,
+	6.495727e-03f,
+	-5.237363e-03f,
+	4.280635e-03f,
+	-3.531736e-03f,
+	2.934367e-03f,
+	-2.444518e-03f,
+	2.040380e-03f,
+	-1.699609e-03f,
+	1.413981e-03f,
+	-1.169832e-03f,
+	9.646129e-04f,
+	-7.884515e-04f,
+	6.413923e-04f,
+	-5.153748e-04f,
+	4.117421e-04f,
+	-3.233915e-04f,
+	2.523980e-04f,
+	-1.922416e-04f,
+	1.454825e-04f,
+	-1.060234e-04f,
+	7.680801e-05f,
+	-5.209761e-05f,
+	3.517827e-05f,
+	-2.064186e-05f,
+	1.209426e-05f,
+	-4.435273e-06f,
+	1.564286e-06f,
+	1.343305e-06f,
+	-1.343338e-07f,
+
+	6.612669e-07f,
+	-6.103418e-06f,
+	1.221972e-05f,
+	-2.402316e-05f,
+	3.783083e-05f,
+	-5.898705e-05f,
+	8.415739e-05f,
+	-1.190488e-04f,
+	1.607024e-04f,
+	-2.152147e-04f,
+	2.800352e-04f,
+	-3.616973e-04f,
+	4.581321e-04f,
+	-5.764259e-04f,
+	7.151735e-04f,
+	-8.822951e-04f,
+	1.077478e-03f,
+	-1.310127e-03f,
+	1.582012e-03f,
+	-1.905534e-03f,
+	2.286892e-03f,
+	-2.745211e-03f,
+	3.297212e-03f,
+	-3.979101e-03f,
+	4.836628e-03f,
+	-5.958271e-03f,
+	7.491283e-03f,
+	-9.742223e-03f,
+	1.339825e-02f,
+	-2.042112e-02f,
+	3.883919e-02f,
+	-1.528214e-01f,
+	-5.401850e-03f,
+	1.250967e-02f,
+	-9.859643e-03f,
+	7.713411e-03f,
+	-6.160529e-03f,
+	5.009009e-03f,
+	-4.120345e-03f,
+	3.417071e-03f,
+	-2.843873e-03f,
+	2.372359e-03f,
+	-1.976088e-03f,
+	1.644151e-03f,
+	-1.361031e-03f,
+	1.122855e-03f,
+	-9.187622e-04f,
+	7.480350e-04f,
+	-6.020034e-04f,
+	4.815091e-04f,
+	-3.790258e-04f,
+	2.962629e-04f,
+	-2.263800e-04f,
+	1.716535e-04f,
+	-1.257334e-04f,
+	9.133828e-05f,
+	-6.252951e-05f,
+	4.241727e-05f,
+	-2.544037e-05f,
+	1.507366e-05f,
+	-6.107191e-06f,
+	2.350857e-06f,
+	1.090285e-06f,
+	-1.156578e-07f,
+
+	7.116701e-07f,
+	-6.452760e-06f,
+	1.317251e-05f,
+	-2.593965e-05f,
+	4.114475e-05f,
+	-6.422470e-05f,
+	9.195774e-05f,
+	-1.301845e-04f,
+	1.761017e-04f,
+	-2.359839e-04f,
+	3.074824e-04f,
+	-3.973577e-04f,
+	5.037960e-04f,
+	-6.341698e-04f,
+	7.873983e-04f,
+	-9.717722e-04f,
+	1.187411e-03f,
+	-1.444235e-03f,
+	1.744642e-03f,
+	-2.101829e-03f,
+	2.523032e-03f,
+	-3.028783e-03f,
+	3.637783e-03f,
+	-4.389155e-03f,
+	5.333140e-03f,
+	-6.565550e-03f,
+	8.246476e-03f,
+	-1.070715e-02f,
+	1.468887e-02f,
+	-2.229919e-02f,
+	4.213935e-02f,
+	-1.651969e-01f,
+	-1.257562e-02f,
+	1.526456e-02f,
+	-1.153948e-02f,
+	8.900918e-03f,
+	-7.061542e-03f,
+	5.720238e-03f,
+	-4.695266e-03f,
+	3.888634e-03f,
+	-3.234050e-03f,
+	2.696724e-03f,
+	-2.246230e-03f,
+	1.869039e-03f,
+	-1.547834e-03f,
+	1.277448e-03f,
+	-1.046057e-03f,
+	8.521985e-04f,
+	-6.866075e-04f,
+	5.496358e-04f,
+	-4.333431e-04f,
+	3.390813e-04f,
+	-2.596967e-04f,
+	1.971881e-04f,
+	-1.449583e-04f,
+	1.055056e-04f,
+	-7.269614e-05f,
+	4.946790e-05f,
+	-3.011006e-05f,
+	1.796948e-05f,
+	-7.728928e-06f,
+	3.110936e-06f,
+	8.480851e-07f,
+	-9.882822e-08f,
+
+	7.634056e-07f,
+	-6.800882e-06f,
+	1.411527e-05f,
+	-2.783000e-05f,
+	4.440774e-05f,
+	-6.937611e-05f,
+	9.962376e-05f,
+	-1.411223e-04f,
+	1.912206e-04f,
+	-2.563678e-04f,
+	3.344126e-04f,
+	-4.323381e-04f,
+	5.485796e-04f,
+	-6.907904e-04f,
+	8.582064e-04f,
+	-1.059482e-03f,
+	1.295160e-03f,
+	-1.575665e-03f,
+	1.904011e-03f,
+	-2.294175e-03f,
+	2.754413e-03f,
+	-3.306636e-03f,
+	3.971494e-03f,
+	-4.790974e-03f,
+	5.819739e-03f,
+	-7.160824e-03f,
+	8.986983e-03f,
+	-1.165383e-02f,
+	1.595627e-02f,
+	-2.414687e-02f,
+	4.540155e-02f,
+	-1.778262e-01f,
+	-1.941532e-02f,
+	1.793016e-02f,
+	-1.317055e-02f,
+	1.005568e-02f,
+	-7.938407e-03f,
+	6.412731e-03f,
+	-5.255201e-03f,
+	4.347986e-03f,
+	-3.614161e-03f,
+	3.012737e-03f,
+	-2.509418e-03f,
+	2.088135e-03f,
+	-1.729817e-03f,
+	1.428041e-03f,
+	-1.170047e-03f,
+	9.536470e-04f,
+	-7.689961e-04f,
+	6.159690e-04f,
+	-4.862216e-04f,
+	3.807576e-04f,
+	-2.921176e-04f,
+	2.220298e-04f,
+	-1.636558e-04f,
+	1.192793e-04f,
+	-8.257564e-05f,
+	5.631519e-05f,
+	-3.464125e-05f,
+	2.077588e-05f,
+	-9.297395e-06f,
+	3.843238e-06f,
+	6.169699e-07f,
+	-8.376075e-08f,
+
+	8.162871e-07f,
+	-7.146679e-06f,
+	1.504521e-05f,
+	-2.968887e-05f,
+	4.761081e-05f,
+	-7.442733e-05f,
+	1.071349e-04f,
+	-1.518331e-04f,
+	2.060194e-04f,
+	-2.763131e-04f,
+	3.607559e-04f,
+	-4.665477e-04f,
+	5.923673e-04f,
+	-7.461415e-04f,
+	9.274162e-04f,
+	-1.145200e-03f,
+	1.400450e-03f,
+	-1.704081e-03f,
+	2.059713e-03f,
+	-2.482085e-03f,
+	2.980447e-03f,
+	-3.578066e-03f,
+	4.297497e-03f,
+	-5.183536e-03f,
+	6.295184e-03f,
+	-7.742571e-03f,
+	9.710902e-03f,
+	-1.257981e-02f,
+	1.719713e-02f,
+	-2.595924e-02f,
+	4.861691e-02f,
+	-1.907011e-01f,
+	-2.592062e-02f,
+	2.050183e-02f,
+	-1.474954e-02f,
+	1.117522e-02f,
+	-8.789206e-03f,
+	7.084951e-03f,
+	-5.798899e-03f,
+	4.794094e-03f,
+	-3.983351e-03f,
+	3.319684e-03f,
+	-2.765059e-03f,
+	2.300942e-03f,
+	-1.906568e-03f,
+	1.574295e-03f,
+	-1.290454e-03f,
+	1.052153e-03f,
+	-8.489851e-04f,
+	6.803608e-04f,
+	-5.375440e-04f,
+	4.211998e-04f,
+	-3.235716e-04f,
+	2.461244e-04f,
+	-1.817856e-04f,
+	1.326297e-04f,
+	-9.214706e-05f,
+	6.294487e-05f,
+	-3.902469e-05f,
+	2.348736e-05f,
+	-1.080970e-05f,
+	4.546588e-06f,
+	3.971556e-07f,
+	-7.036437e-08f,
+
+	8.701085e-07f,
+	-7.489015e-06f,
+	1.595954e-05f,
+	-3.151091e-05f,
+	5.074500e-05f,
+	-7.936449e-05f,
+	1.144709e-04f,
+	-1.622882e-04f,
+	2.204586e-04f,
+	-2.957671e-04f,
+	3.864429e-04f,
+	-4.998969e-04f,
+	6.350448e-04f,
+	-8.000795e-04f,
+	9.948483e-04f,
+	-1.228705e-03f,
+	1.503009e-03f,
+	-1.829155e-03f,
+	2.211350e-03f,
+	-2.665076e-03f,
+	3.200556e-03f,
+	-3.842376e-03f,
+	4.614955e-03f,
+	-5.565833e-03f,
+	6.758254e-03f,
+	-8.309293e-03f,
+	1.041636e-02f,
+	-1.348267e-02f,
+	1.840816e-02f,
+	-2.773141e-02f,
+	5.177646e-02f,
+	-2.038129e-01f,
+	-3.209159e-02f,
+	2.297520e-02f,
+	-1.627330e-02f,
+	1.225720e-02f,
+	-9.612096e-03f,
+	7.735419e-03f,
+	-6.325152e-03f,
+	5.225963e-03f,
+	-4.340793e-03f,
+	3.616877e-03f,
+	-3.012578e-03f,
+	2.506983e-03f,
+	-2.077691e-03f,
+	1.715884e-03f,
+	-1.407009e-03f,
+	1.147498e-03f,
+	-9.263971e-04f,
+	7.426690e-04f,
+	-5.871975e-04f,
+	4.603194e-04f,
+	-3.539903e-04f,
+	2.694200e-04f,
+	-1.993087e-04f,
+	1.455286e-04f,
+	-1.013904e-04f,
+	6.934338e-05f,
+	-4.325166e-05f,
+	2.609872e-05f,
+	-1.226316e-05f,
+	5.219923e-06f,
+	1.888108e-07f,
+	-5.854269e-08f,
+
+	9.246442e-07f,
+	-7.826724e-06f,
+	1.685542e-05f,
+	-3.329076e-05f,
+	5.380138e-05f,
+	-8.417382e-05f,
+	1.216115e-04f,
+	-1.724593e-04f,
+	2.344995e-04f,
+	-3.146778e-04f,
+	4.114054e-04f,
+	-5.322977e-04f,
+	6.764999e-04f,
+	-8.524631e-04f,
+	1.060327e-03f,
+	-1.309780e-03f,
+	1.602571e-03f,
+	-1.950561e-03f,
+	2.358528e-03f,
+	-2.842676e-03f,
+	3.414173e-03f,
+	-4.098887e-03f,
+	4.923052e-03f,
+	-5.936880e-03f,
+	7.207752e-03f,
+	-8.859517e-03f,
+	1.110151e-02f,
+	-1.436003e-02f,
+	1.958613e-02f,
+	-2.945848e-02f,
+	5.487112e-02f,
+	-2.171528e-01f,
+	-3.792875e-02f,
+	2.534620e-02f,
+	-1.773885e-02f,
+	1.329935e-02f,
+	-1.040531e-02f,
+	8.362720e-03f,
+	-6.832804e-03f,
+	5.642639e-03f,
+	-4.685692e-03f,
+	3.903657e-03f,
+	-3.251425e-03f,
+	2.705802e-03f,
+	-2.242808e-03f,
+	1.852492e-03f,
+	-1.519455e-03f,
+	1.239471e-03f,
+	-1.001062e-03f,
+	8.027577e-04f,
+	-6.350743e-04f,
+	4.980320e-04f,
+	-3.833084e-04f,
+	2.918670e-04f,
+	-2.161883e-04f,
+	1.579492e-04f,
+	-1.102868e-04f,
+	7.549787e-05f,
+	-4.731393e-05f,
+	2.860513e-05f,
+	-1.365529e-05f,
+	5.862295e-06f,
+	-7.942367e-09f,
+	-4.819493e-08f,
+
+	9.796491e-07f,
+	-8.158611e-06f,
+	1.773001e-05f,
+	-3.502308e-05f,
+	5.677108e-05f,
+	-8.884169e-05f,
+	1.285369e-04f,
+	-1.823182e-04f,
+	2.481037e-04f,
+	-3.329941e-04f,
+	4.355763e-04f,
+	-5.636634e-04f,
+	7.166223e-04f,
+	-9.031536e-04f,
+	1.123679e-03f,
+	-1.388210e-03f,
+	1.698874e-03f,
+	-2.067982e-03f,
+	2.500864e-03f,
+	-3.014422e-03f,
+	3.620740e-03f,
+	-4.346931e-03f,
+	5.220986e-03f,
+	-6.295711e-03f,
+	7.642504e-03f,
+	-9.391802e-03f,
+	1.176455e-02f,
+	-1.520954e-02f,
+	2.072783e-02f,
+	-3.113563e-02f,
+	5.789173e-02f,
+	-2.307113e-01f,
+	-4.343304e-02f,
+	2.761106e-02f,
+	-1.914338e-02f,
+	1.429954e-02f,
+	-1.116718e-02f,
+	8.965502e-03f,
+	-7.320751e-03f,
+	6.043208e-03f,
+	-5.017293e-03f,
+	4.179390e-03f,
+	-3.481074e-03f,
+	2.896959e-03f,
+	-2.401555e-03f,
+	1.983821e-03f,
+	-1.627546e-03f,
+	1.327872e-03f,
+	-1.072819e-03f,
+	8.604971e-04f,
+	-6.810715e-04f,
+	5.342571e-04f,
+	-4.114640e-04f,
+	3.134183e-04f,
+	-2.323894e-04f,
+	1.698660e-04f,
+	-1.188184e-04f,
+	8.139626e-05f,
+	-5.120380e-05f,
+	3.100207e-05f,
+	-1.498382e-05f,
+	6.472865e-06f,
+	-1.930273e-07f,
+	-3.921705e-08f,
+
+	1.034859e-06f,
+	-8.483460e-06f,
+	1.858044e-05f,
+	-3.670254e-05f,
+	5.964532e-05f,
+	-9.335463e-05f,
+	1.352274e-04f,
+	-1.918376e-04f,
+	2.612337e-04f,
+	-3.506658e-04f,
+	4.588900e-04f,
+	-5.939094e-04f,
+	7.553045e-04f,
+	-9.520156e-04f,
+	1.184736e-03f,
+	-1.463790e-03f,
+	1.791666e-03f,
+	-2.181110e-03f,
+	2.637984e-03f,
+	-3.179864e-03f,
+	3.819718e-03f,
+	-4.585859e-03f,
+	5.507976e-03f,
+	-6.641383e-03f,
+	8.061366e-03f,
+	-9.904741e-03f,
+	1.240371e-02f,
+	-1.602892e-02f,
+	2.183012e-02f,
+	-3.275805e-02f,
+	6.082905e-02f,
+	-2.444790e-01f,
+	-4.860583e-02f,
+	2.976634e-02f,
+	-2.048426e-02f,
+	1.525576e-02f,
+	-1.189611e-02f,
+	9.542486e-03f,
+	-7.787941e-03f,
+	6.426803e-03f,
+	-5.334872e-03f,
+	4.443476e-03f,
+	-3.701024e-03f,
+	3.080039e-03f,
+	-2.553587e-03f,
+	2.109585e-03f,
+	-1.731047e-03f,
+	1.412511e-03f,
+	-1.141513e-03f,
+	9.157638e-04f,
+	-7.250916e-04f,
+	5.689185e-04f,
+	-4.383982e-04f,
+	3.340294e-04f,
+	-2.478790e-04f,
+	1.812552e-04f,
+	-1.269682e-04f,
+	8.702726e-05f,
+	-5.491408e-05f,
+	3.328540e-05f,
+	-1.624669e-05f,
+	7.050906e-06f,
+	-3.664113e-07f,
+	-3.150285e-08f,
+
+	1.089991e-06f,
+	-8.800032e-06f,
+	1.940387e-05f,
+	-3.832387e-05f,
+	6.241543e-05f,
+	-9.769942e-05f,
+	1.416638e-04f,
+	-2.009903e-04f,
+	2.738526e-04f,
+	-3.676440e-04f,
+	4.812824e-04f,
+	-6.229532e-04f,
+	7.924414e-04f,
+	-9.989172e-04f,
+	1.243334e-03f,
+	-1.536315e-03f,
+	1.880697e-03f,
+	-2.289643e-03f,
+	2.769524e-03f,
+	-3.338565e-03f,
+	4.010580e-03f,
+	-4.815039e-03f,
+	5.783264e-03f,
+	-6.972983e-03f,
+	8.463225e-03f,
+	-1.039696e-02f,
+	1.301726e-02f,
+	-1.681592e-02f,
+	2.288990e-02f,
+	-3.432100e-02f,
+	6.367382e-02f,
+	-2.584458e-01f,
+	-5.344892e-02f,
+	3.180890e-02f,
+	-2.175904e-02f,
+	1.616612e-02f,
+	-1.259061e-02f,
+	1.009246e-02f,
+	-8.233382e-03f,
+	6.792600e-03f,
+	-5.637745e-03f,
+	4.695346e-03f,
+	-3.910800e-03f,
+	3.254646e-03f,
+	-2.698575e-03f,
+	2.229515e-03f,
+	-1.829738e-03f,
+	1.493207e-03f,
+	-1.206998e-03f,
+	9.684417e-04f,
+	-7.670425e-04f,
+	6.019443e-04f,
+	-4.640557e-04f,
+	3.536585e-04f,
+	-2.626260e-04f,
+	1.920943e-04f,
+	-1.347208e-04f,
+	9.238035e-05f,
+	-5.843816e-05f,
+	3.545130e-05f,
+	-1.744205e-05f,
+	7.595806e-06f,
+	-5.281040e-07f,
+	-2.494499e-08f,
+
+	1.144743e-06f,
+	-9.107074e-06f,
+	2.019744e-05f,
+	-3.988184e-05f,
+	6.507287e-05f,
+	-1.018631e-04f,
+	1.478273e-04f,
+	-2.097502e-04f,
+	2.859248e-04f,
+	-3.838808e-04f,
+	5.026910e-04f,
+	-6.507143e-04f,
+	8.279308e-04f,
+	-1.043730e-03f,
+	1.299314e-03f,
+	-1.605590e-03f,
+	1.965729e-03f,
+	-2.393290e-03f,
+	2.895132e-03f,
+	-3.490099e-03f,
+	4.192817e-03f,
+	-5.033860e-03f,
+	6.046114e-03f,
+	-7.289622e-03f,
+	8.847004e-03f,
+	-1.086714e-02f,
+	1.360353e-02f,
+	-1.756836e-02f,
+	2.390416e-02f,
+	-3.581984e-02f,
+	6.641671e-02f,
+	-2.726017e-01f,
+	-5.796450e-02f,
+	3.373589e-02f,
+	-2.296546e-02f,
+	1.702886e-02f,
+	-1.324927e-02f,
+	1.061428e-02f,
+	-8.656139e-03f,
+	7.139827e-03f,
+	-5.925269e-03f,
+	4.934460e-03f,
+	-4.109954e-03f,
+	3.420408e-03f,
+	-2.836211e-03f,
+	2.343356e-03f,
+	-1.923409e-03f,
+	1.569791e-03f,
+	-1.269138e-03f,
+	1.018421e-03f,
+	-8.068380e-04f,
+	6.332672e-04f,
+	-4.883849e-04f,
+	3.722664e-04f,
+	-2.766015e-04f,
+	2.023624e-04f,
+	-1.420614e-04f,
+	9.744584e-05f,
+	-6.176997e-05f,
+	3.749635e-05f,
+	-1.856828e-05f,
+	8.107058e-06f,
+	-6.781563e-07f,
+	-1.943608e-08f,
+
+	1.198798e-06f,
+	-9.403318e-06f,
+	2.095830e-05f,
+	-4.137130e-05f,
+	6.760926e-05f,
+	-1.058328e-04f,
+	1.536995e-04f,
+	-2.180915e-04f,
+	2.974152e-04f,
+	-3.993300e-04f,
+	5.230553e-04f,
+	-6.771149e-04f,
+	8.616741e-04f,
+	-1.086331e-03f,
+	1.352522e-03f,
+	-1.671426e-03f,
+	2.046530e-03f,
+	-2.491769e-03f,
+	3.014468e-03f,
+	-3.634058e-03f,
+	4.365937e-03f,
+	-5.241731e-03f,
+	6.295818e-03f,
+	-7.590445e-03f,
+	9.211659e-03f,
+	-1.131398e-02f,
+	1.416091e-02f,
+	-1.828412e-02f,
+	2.486996e-02f,
+	-3.724996e-02f,
+	6.904838e-02f,
+	-2.869362e-01f,
+	-6.215518e-02f,
+	3.554478e-02f,
+	-2.410142e-02f,
+	1.784233e-02f,
+	-1.387078e-02f,
+	1.110689e-02f,
+	-9.055334e-03f,
+	7.467756e-03f,
+	-6.196840e-03f,
+	5.160317e-03f,
+	-4.298066e-03f,
+	3.576976e-03f,
+	-2.966207e-03f,
+	2.450869e-03f,
+	-2.011866e-03f,
+	1.642104e-03f,
+	-1.327805e-03f,
+	1.065601e-03f,
+	-8.443975e-04f,
+	6.628245e-04f,
+	-5.113375e-04f,
+	3.898170e-04f,
+	-2.897788e-04f,
+	2.120404e-04f,
+	-1.489769e-04f,
+	1.022148e-04f,
+	-6.490399e-05f,
+	3.941745e-05f,
+	-1.962394e-05f,
+	8.584267e-06f,
+	-8.166580e-07f,
+	-1.486966e-08f,
+
+	1.251818e-06f,
+	-9.687486e-06f,
+	2.168365e-05f,
+	-4.278717e-05f,
+	7.001640e-05f,
+	-1.095963e-04f,
+	1.592625e-04f,
+	-2.259893e-04f,
+	3.082902e-04f,
+	-4.139468e-04f,
+	5.423168e-04f,
+	-7.020800e-04f,
+	8.935761e-04f,
+	-1.126599e-03f,
+	1.402809e-03f,
+	-1.733640e-03f,
+	2.122876e-03f,
+	-2.584810e-03f,
+	3.127205e-03f,
+	-3.770048e-03f,
+	4.529469e-03f,
+	-5.438088e-03f,
+	6.531695e-03f,
+	-7.874630e-03f,
+	9.556190e-03f,
+	-1.173625e-02f,
+	1.468782e-02f,
+	-1.896116e-02f,
+	2.578444e-02f,
+	-3.860689e-02f,
+	7.155950e-02f,
+	-3.014385e-01f,
+	-6.602398e-02f,
+	3.723337e-02f,
+	-2.516505e-02f,
+	1.860503e-02f,
+	-1.445393e-02f,
+	1.156929e-02f,
+	-9.430157e-03f,
+	7.775713e-03f,
+	-6.451894e-03f,
+	5.372446e-03f,
+	-4.474747e-03f,
+	3.724025e-03f,
+	-3.088294e-03f,
+	2.551834e-03f,
+	-2.094928e-03f,
+	1.709998e-03f,
+	-1.382881e-03f,
+	1.109885e-03f,
+	-8.796465e-04f,
+	6.905582e-04f,
+	-5.328693e-04f,
+	4.062768e-04f,
+	-3.021332e-04f,
+	2.211105e-04f,
+	-1.554549e-04f,
+	1.066793e-04f,
+	-6.783529e-05f,
+	4.121190e-05f,
+	-2.060784e-05f,
+	9.027144e-06f,
+	-9.437366e-07f,
+	-1.114116e-08f,
+
+	1.303453e-06f,
+	-9.958294e-06f,
+	2.237070e-05f,
+	-4.412448e-05f,
+	7.228630e-05f,
+	-1.131416e-04f,
+	1.644990e-04f,
+	-2.334196e-04f,
+	3.185171e-04f,
+	-4.276879e-04f,
+	5.604194e-04f,
+	-7.255374e-04f,
+	9.235451e-04f,
+	-1.164421e-03f,
+	1.450034e-03f,
+	-1.792057e-03f,
+	2.194554e-03f,
+	-2.672154e-03f,
+	3.233030e-03f,
+	-3.897693e-03f,
+	4.682959e-03f,
+	-5.622386e-03f,
+	6.753093e-03f,
+	-8.141389e-03f,
+	9.879637e-03f,
+	-1.213277e-02f,
+	1.518277e-02f,
+	-1.959750e-02f,
+	2.664484e-02f,
+	-3.988624e-02f,
+	7.394073e-02f,
+	-3.160977e-01f,
+	-6.957429e-02f,
+	3.879975e-02f,
+	-2.615464e-02f,
+	1.931560e-02f,
+	-1.499762e-02f,
+	1.200059e-02f,
+	-9.779858e-03f,
+	8.063077e-03f,
+	-6.689914e-03f,
+	5.570417e-03f,
+	-4.639635e-03f,
+	3.861256e-03f,
+	-3.202224e-03f,
+	2.646046e-03f,
+	-2.172427e-03f,
+	1.773339e-03f,
+	-1.434256e-03f,
+	1.151188e-03f,
+	-9.125167e-04f,
+	7.164152e-04f,
+	-5.529395e-04f,
+	4.216154e-04f,
+	-3.136425e-04f,
+	2.295570e-04f,
+	-1.614845e-04f,
+	1.108322e-04f,
+	-7.055949e-05f,
+	4.287733e-05f,
+	-2.151898e-05f,
+	9.435506e-06f,
+	-1.059555e-06f,
+	-8.148898e-09f,
+
+	1.353336e-06f,
+	-1.021446e-05f,
+	2.301670e-05f,
+	-4.537838e-05f,
+	7.441119e-05f,
+	-1.164569e-04f,
+	1.693924e-04f,
+	-2.403592e-04f,
+	3.280646e-04f,
+	-4.405119e-04f,
+	5.773091e-04f,
+	-7.474178e-04f,
+	9.514938e-04f,
+	-1.199687e-03f,
+	1.494060e-03f,
+	-1.846510e-03f,
+	2.261361e-03f,
+	-2.753554e-03f,
+	3.331646e-03f,
+	-4.016635e-03f,
+	4.825979e-03f,
+	-5.794111e-03f,
+	6.959392e-03f,
+	-8.389973e-03f,
+	1.018109e-02f,
+	-1.250240e-02f,
+	1.564433e-02f,
+	-2.019126e-02f,
+	2.744850e-02f,
+	-4.108375e-02f,
+	7.618276e-02f,
+	-3.309026e-01f,
+	-7.280990e-02f,
+	4.024232e-02f,
+	-2.706869e-02f,
+	1.997281e-02f,
+	-1.550083e-02f,
+	1.239996e-02f,
+	-1.010375e-02f,
+	8.329277e-03f,
+	-6.910425e-03f,
+	5.753832e-03f,
+	-4.792401e-03f,
+	3.988394e-03f,
+	-3.307769e-03f,
+	2.733318e-03f,
+	-2.244211e-03f,
+	1.832002e-03f,
+	-1.481831e-03f,
+	1.189430e-03f,
+	-9.429460e-04f,
+	7.403475e-04f,
+	-5.715116e-04f,
+	4.358052e-04f,
+	-3.242865e-04f,
+	2.373655e-04f,
+	-1.670559e-04f,
+	1.146669e-04f,
+	-7.307281e-05f,
+	4.441177e-05f,
+	-2.235658e-05f,
+	9.809275e-06f,
+	-1.164309e-06f,
+	-5.794901e-09f,
+
+	1.401086e-06f,
+	-1.045469e-05f,
+	2.361896e-05f,
+	-4.654414e-05f,
+	7.638356e-05f,
+	-1.195311e-04f,
+	1.739265e-04f,
+	-2.467860e-04f,
+	3.369030e-04f,
+	-4.523792e-04f,
+	5.929344e-04f,
+	-7.676556e-04f,
+	9.773390e-04f,
+	-1.232293e-03f,
+	1.534760e-03f,
+	-1.896841e-03f,
+	2.323104e-03f,
+	-2.828776e-03f,
+	3.422770e-03f,
+	-4.126535e-03f,
+	4.958123e-03f,
+	-5.952775e-03f,
+	7.150005e-03f,
+	-8.619672e-03f,
+	1.045967e-02f,
+	-1.284407e-02f,
+	1.607112e-02f,
+	-2.074062e-02f,
+	2.819286e-02f,
+	-4.219526e-02f,
+	7.827632e-02f,
+	-3.458419e-01f,
+	-7.573499e-02f,
+	4.155978e-02f,
+	-2.790589e-02f,
+	2.057555e-02f,
+	-1.596268e-02f,
+	1.276665e-02f,
+	-1.040122e-02f,
+	8.573798e-03f,
+	-7.112996e-03f,
+	5.922332e-03f,
+	-4.932744e-03f,
+	4.105190e-03f,
+	-3.404724e-03f,
+	2.813482e-03f,
+	-2.310142e-03f,
+	1.885876e-03f,
+	-1.525517e-03f,
+	1.224541e-03f,
+	-9.708786e-04f,
+	7.623119e-04f,
+	-5.885528e-04f,
+	4.488220e-04f,
+	-3.340475e-04f,
+	2.445233e-04f,
+	-1.721607e-04f,
+	1.181782e-04f,
+	-7.537204e-05f,
+	4.581359e-05f,
+	-2.312006e-05f,
+	1.014847e-05f,
+	-1.258228e-06f,
+	-3.985796e-09f,
+
+	1.446308e-06f,
+	-1.067773e-05f,
+	2.417485e-05f,
+	-4.761717e-05f,
+	7.819619e-05f,
+	-1.223533e-04f,
+	1.780862e-04f,
+	-2.526788e-04f,
+	3.450036e-04f,
+	-4.632524e-04f,
+	6.072469e-04f,
+	-7.861885e-04f,
+	1.001002e-03f,
+	-1.262140e-03f,
+	1.572010e-03f,
+	-1.942902e-03f,
+	2.379601e-03f,
+	-2.897600e-03f,
+	3.506137e-03f,
+	-4.227074e-03f,
+	5.079005e-03f,
+	-6.097917e-03f,
+	7.324378e-03f,
+	-8.829816e-03f,
+	1.071457e-02f,
+	-1.315676e-02f,
+	1.646186e-02f,
+	-2.124389e-02f,
+	2.887548e-02f,
+	-4.321679e-02f,
+	8.021221e-02f,
+	-3.609039e-01f,
+	-7.835405e-02f,
+	4.275116e-02f,
+	-2.866512e-02f,
+	2.112287e-02f,
+	-1.638236e-02f,
+	1.310000e-02f,
+	-1.067172e-02f,
+	8.796182e-03f,
+	-7.297243e-03f,
+	6.075596e-03f,
+	-5.060398e-03f,
+	4.211424e-03f,
+	-3.492906e-03f,
+	2.886386e-03f,
+	-2.370097e-03f,
+	1.934862e-03f,
+	-1.565234e-03f,
+	1.256457e-03f,
+	-9.962653e-04f,
+	7.822704e-04f,
+	-6.040342e-04f,
+	4.606442e-04f,
+	-3.429099e-04f,
+	2.510198e-04f,
+	-1.767914e-04f,
+	1.213614e-04f,
+	-7.745453e-05f,
+	4.708154e-05f,
+	-2.380905e-05f,
+	1.045321e-05f,
+	-1.341568e-06f,
+	-2.633586e-09f,
+
+	1.488598e-06f,
+	-1.088230e-05f,
+	2.468178e-05f,
+	-4.859305e-05f,
+	7.984210e-05f,
+	-1.249135e-04f,
+	1.818568e-04f,
+	-2.580176e-04f,
+	3.523396e-04f,
+	-4.730960e-04f,
+	6.202005e-04f,
+	-8.029579e-04f,
+	1.022409e-03f,
+	-1.289138e-03f,
+	1.605698e-03f,
+	-1.984551e-03f,
+	2.430682e-03f,
+	-2.959820e-03f,
+	3.581499e-03f,
+	-4.317953e-03f,
+	5.188270e-03f,
+	-6.229109e-03f,
+	7.481996e-03f,
+	-9.019782e-03f,
+	1.094503e-02f,
+	-1.343953e-02f,
+	1.681534e-02f,
+	-2.169943e-02f,
+	2.949403e-02f,
+	-4.414447e-02f,
+	8.198127e-02f,
+	-3.760769e-01f,
+	-8.067200e-02f,
+	4.381576e-02f,
+	-2.934548e-02f,
+	2.161395e-02f,
+	-1.675919e-02f,
+	1.339944e-02f,
+	-1.091476e-02f,
+	8.996024e-03f,
+	-7.462829e-03f,
+	6.213342e-03f,
+	-5.175126e-03f,
+	4.306898e-03f,
+	-3.572152e-03f,
+	2.951899e-03f,
+	-2.423968e-03f,
+	1.978872e-03f,
+	-1.600911e-03f,
+	1.285123e-03f,
+	-1.019063e-03f,
+	8.001902e-04f,
+	-6.179311e-04f,
+	4.712536e-04f,
+	-3.508607e-04f,
+	2.568458e-04f,
+	-1.809422e-04f,
+	1.242128e-04f,
+	-7.931823e-05f,
+	4.821470e-05f,
+	-2.442340e-05f,
+	1.072370e-05f,
+	-1.414616e-06f,
+	-1.656381e-09f,
+
+	1.527539e-06f,
+	-1.106714e-05f,
+	2.513727e-05f,
+	-4.946754e-05f,
+	8.131471e-05f,
+	-1.272017e-04f,
+	1.852245e-04f,
+	-2.627835e-04f,
+	3.588857e-04f,
+	-4.818767e-04f,
+	6.317522e-04f,
+	-8.179090e-04f,
+	1.041491e-03f,
+	-1.313199e-03f,
+	1.635718e-03f,
+	-2.021660e-03f,
+	2.476188e-03f,
+	-3.015245e-03f,
+	3.648625e-03f,
+	-4.398896e-03f,
+	5.285586e-03f,
+	-6.345952e-03f,
+	7.622379e-03f,
+	-9.188987e-03f,
+	1.115033e-02f,
+	-1.369149e-02f,
+	1.713042e-02f,
+	-2.210573e-02f,
+	3.004631e-02f,
+	-4.497462e-02f,
+	8.357448e-02f,
+	-3.913490e-01f,
+	-8.269403e-02f,
+	4.475320e-02f,
+	-2.994622e-02f,
+	2.204813e-02f,
+	-1.709257e-02f,
+	1.366448e-02f,
+	-1.112993e-02f,
+	9.172977e-03f,
+	-7.609462e-03f,
+	6.335327e-03f,
+	-5.276727e-03f,
+	4.391446e-03f,
+	-3.642326e-03f,
+	3.009907e-03f,
+	-2.471664e-03f,
+	2.017833e-03f,
+	-1.632491e-03f,
+	1.310493e-03f,
+	-1.039236e-03f,
+	8.160437e-04f,
+	-6.302228e-04f,
+	4.806351e-04f,
+	-3.578890e-04f,
+	2.619938e-04f,
+	-1.846082e-04f,
+	1.267295e-04f,
+	-8.096165e-05f,
+	4.921255e-05f,
+	-2.496314e-05f,
+	1.096026e-05f,
+	-1.477681e-06f,
+	-9.790759e-10f,
+
+	1.562706e-06f,
+	-1.123104e-05f,
+	2.553889e-05f,
+	-5.023657e-05f,
+	8.260773e-05f,
+	-1.292088e-04f,
+	1.881765e-04f,
+	-2.669588e-04f,
+	3.646183e-04f,
+	-4.895637e-04f,
+	6.418622e-04f,
+	-8.309910e-04f,
+	1.058185e-03f,
+	-1.334244e-03f,
+	1.661970e-03f,
+	-2.054108e-03f,
+	2.515975e-03f,
+	-3.063699e-03f,
+	3.707304e-03f,
+	-4.469649e-03f,
+	5.370647e-03f,
+	-6.448082e-03f,
+	7.745088e-03f,
+	-9.336901e-03f,
+	1.132982e-02f,
+	-1.391183e-02f,
+	1.740605e-02f,
+	-2.246138e-02f,
+	3.053028e-02f,
+	-4.570371e-02f,
+	8.498288e-02f,
+	-4.067080e-01f,
+	-8.442572e-02f,
+	4.556339e-02f,
+	-3.046683e-02f,
+	2.242487e-02f,
+	-1.738206e-02f,
+	1.389470e-02f,
+	-1.131688e-02f,
+	9.326750e-03f,
+	-7.736898e-03f,
+	6.441345e-03f,
+	-5.365031e-03f,
+	4.464926e-03f,
+	-3.703310e-03f,
+	3.060315e-03f,
+	-2.513106e-03f,
+	2.051682e-03f,
+	-1.659925e-03f,
+	1.332528e-03f,
+	-1.056755e-03f,
+	8.298085e-04f,
+	-6.408925e-04f,
+	4.887765e-04f,
+	-3.639864e-04f,
+	2.664581e-04f,
+	-1.877857e-04f,
+	1.289095e-04f,
+	-8.238389e-05f,
+	5.007490e-05f,
+	-2.542849e-05f,
+	1.116328e-05f,
+	-1.531097e-06f,
+	-5.339551e-10f,
+
+	1.593669e-06f,
+	-1.137279e-05f,
+	2.588433e-05f,
+	-5.089627e-05f,
+	8.371524e-05f,
+	-1.309263e-04f,
+	1.907007e-04f,
+	-2.705272e-04f,
+	3.695156e-04f,
+	-4.961285e-04f,
+	6.504939e-04f,
+	-8.421576e-04f,
+	1.072431e-03f,
+	-1.352201e-03f,
+	1.684367e-03f,
+	-2.081787e-03f,
+	2.549910e-03f,
+	-3.105022e-03f,
+	3.757343e-03f,
+	-4.529981e-03f,
+	5.443178e-03f,
+	-6.535166e-03f,
+	7.849722e-03f,
+	-9.463037e-03f,
+	1.148290e-02f,
+	-1.409979e-02f,
+	1.764127e-02f,
+	-2.276508e-02f,
+	3.094401e-02f,
+	-4.632840e-02f,
+	8.619766e-02f,
+	-4.221419e-01f,
+	-8.587294e-02f,
+	4.624652e-02f,
+	-3.090698e-02f,
+	2.274377e-02f,
+	-1.762727e-02f,
+	1.408979e-02f,
+	-1.147535e-02f,
+	9.457112e-03f,
+	-7.844942e-03f,
+	6.531234e-03f,
+	-5.439899e-03f,
+	4.527224e-03f,
+	-3.755012e-03f,
+	3.103047e-03f,
+	-2.548235e-03f,
+	2.080370e-03f,
+	-1.683173e-03f,
+	1.351199e-03f,
+	-1.071596e-03f,
+	8.414672e-04f,
+	-6.499279e-04f,
+	4.956690e-04f,
+	-3.691467e-04f,
+	2.702349e-04f,
+	-1.904726e-04f,
+	1.307516e-04f,
+	-8.358457e-05f,
+	5.080190e-05f,
+	-2.581989e-05f,
+	1.133324e-05f,
+	-1.575218e-06f,
+	-2.612364e-10f,
+
+	1.619988e-06f,
+	-1.149121e-05f,
+	2.617136e-05f,
+	-5.144301e-05f,
+	8.463171e-05f,
+	-1.323461e-04f,
+	1.927859e-04f,
+	-2.734736e-04f,
+	3.735575e-04f,
+	-5.015450e-04f,
+	6.576139e-04f,
+	-8.513663e-04f,
+	1.084177e-03f,
+	-1.367004e-03f,
+	1.702827e-03f,
+	-2.104598e-03f,
+	2.577873e-03f,
+	-3.139070e-03f,
+	3.798570e-03f,
+	-4.579686e-03f,
+	5.502929e-03f,
+	-6.606908e-03f,
+	7.935924e-03f,
+	-9.566961e-03f,
+	1.160904e-02f,
+	-1.425471e-02f,
+	1.783521e-02f,
+	-2.301564e-02f,
+	3.128572e-02f,
+	-4.684553e-02f,
+	8.721012e-02f,
+	-4.376383e-01f,
+	-8.704189e-02f,
+	4.680307e-02f,
+	-3.126651e-02f,
+	2.300459e-02f,
+	-1.782795e-02f,
+	1.424952e-02f,
+	-1.160513e-02f,
+	9.563887e-03f,
+	-7.933444e-03f,
+	6.604868e-03f,
+	-5.501229e-03f,
+	4.578256e-03f,
+	-3.797361e-03f,
+	3.138046e-03f,
+	-2.577004e-03f,
+	2.103863e-03f,
+	-1.702208e-03f,
+	1.366484e-03f,
+	-1.083744e-03f,
+	8.510082e-04f,
+	-6.573202e-04f,
+	5.013066e-04f,
+	-3.733662e-04f,
+	2.733220e-04f,
+	-1.926676e-04f,
+	1.322555e-04f,
+	-8.456393e-05f,
+	5.139405e-05f,
+	-2.613793e-05f,
+	1.147069e-05f,
+	-1.610417e-06f,
+	-1.095433e-10f,
+
+	1.641223e-06f,
+	-1.158516e-05f,
+	2.639787e-05f,
+	-5.187336e-05f,
+	8.535203e-05f,
+	-1.334610e-04f,
+	1.944222e-04f,
+	-2.757843e-04f,
+	3.767262e-04f,
+	-5.057897e-04f,
+	6.631921e-04f,
+	-8.585794e-04f,
+	1.093375e-03f,
+	-1.378594e-03f,
+	1.717280e-03f,
+	-2.122454e-03f,
+	2.599760e-03f,
+	-3.165717e-03f,
+	3.830832e-03f,
+	-4.618580e-03f,
+	5.549685e-03f,
+	-6.663044e-03f,
+	8.003377e-03f,
+	-9.648289e-03f,
+	1.170777e-02f,
+	-1.437599e-02f,
+	1.798710e-02f,
+	-2.321199e-02f,
+	3.155380e-02f,
+	-4.725217e-02f,
+	8.801174e-02f,
+	-4.531848e-01f,
+	-8.793905e-02f,
+	4.723381e-02f,
+	-3.154549e-02f,
+	2.320721e-02f,
+	-1.798396e-02f,
+	1.437375e-02f,
+	-1.170608e-02f,
+	9.646959e-03f,
+	-8.002305e-03f,
+	6.662162e-03f,
+	-5.548949e-03f,
+	4.617962e-03f,
+	-3.830309e-03f,
+	3.165274e-03f,
+	-2.599384e-03f,
+	2.122136e-03f,
+	-1.717012e-03f,
+	1.378370e-03f,
+	-1.093188e-03f,
+	8.584245e-04f,
+	-6.630651e-04f,
+	5.056866e-04f,
+	-3.766434e-04f,
+	2.757187e-04f,
+	-1.943710e-04f,
+	1.334218e-04f,
+	-8.532270e-05f,
+	5.185219e-05f,
+	-2.638341e-05f,
+	1.157628e-05f,
+	-1.637083e-06f,
+	-3.630385e-11f,
+
+	1.656929e-06f,
+	-1.165353e-05f,
+	2.656187e-05f,
+	-5.218416e-05f,
+	8.587146e-05f,
+	-1.342641e-04f,
+	1.956002e-04f,
+	-2.774470e-04f,
+	3.790055e-04f,
+	-5.088421e-04f,
+	6.672023e-04f,
+	-8.637636e-04f,
+	1.099985e-03f,
+	-1.386922e-03f,
+	1.727661e-03f,
+	-2.135279e-03f,
+	2.615478e-03f,
+	-3.184853e-03f,
+	3.853999e-03f,
+	-4.646507e-03f,
+	5.583255e-03f,
+	-6.703350e-03f,
+	8.051811e-03f,
+	-9.706687e-03f,
+	1.177868e-02f,
+	-1.446311e-02f,
+	1.809625e-02f,
+	-2.335317e-02f,
+	3.174677e-02f,
+	-4.754556e-02f,
+	8.859415e-02f,
+	-4.687689e-01f,
+	-8.857119e-02f,
+	4.753976e-02f,
+	-3.174414e-02f,
+	2.335166e-02f,
+	-1.809525e-02f,
+	1.446240e-02f,
+	-1.177814e-02f,
+	9.706267e-03f,
+	-8.051472e-03f,
+	6.703071e-03f,
+	-5.583022e-03f,
+	4.646312e-03f,
+	-3.853834e-03f,
+	3.184713e-03f,
+	-2.615360e-03f,
+	2.135178e-03f,
+	-1.727577e-03f,
+	1.386851e-03f,
+	-1.099926e-03f,
+	8.637147e-04f,
+	-6.671621e-04f,
+	5.088095e-04f,
+	-3.789793e-04f,
+	2.774263e-04f,
+	-1.955840e-04f,
+	1.342517e-04f,
+	-8.586219e-05f,
+	5.217747e-05f,
+	-2.655730e-05f,
+	1.165072e-05f,
+	-1.655620e-06f,
+	-8.079093e-12f,
+
+	1.666662e-06f,
+	-1.169526e-05f,
+	2.666147e-05f,
+	-5.237248e-05f,
+	8.618577e-05f,
+	-1.347497e-04f,
+	1.963118e-04f,
+	-2.784511e-04f,
+	3.803813e-04f,
+	-5.106840e-04f,
+	6.696215e-04f,
+	-8.668905e-04f,
+	1.103972e-03f,
+	-1.391943e-03f,
+	1.733920e-03f,
+	-2.143010e-03f,
+	2.624952e-03f,
+	-3.196385e-03f,
+	3.867959e-03f,
+	-4.663336e-03f,
+	5.603483e-03f,
+	-6.727637e-03f,
+	8.080997e-03f,
+	-9.741881e-03f,
+	1.182141e-02f,
+	-1.451563e-02f,
+	1.816207e-02f,
+	-2.343837e-02f,
+	3.186334e-02f,
+	-4.772319e-02f,
+	8.894918e-02f,
+	-4.843782e-01f,
+	-8.894535e-02f,
+	4.772222e-02f,
+	-3.186290e-02f,
+	2.343811e-02f,
+	-1.816190e-02f,
+	1.451551e-02f,
+	-1.182133e-02f,
+	9.741810e-03f,
+	-8.080940e-03f,
+	6.727590e-03f,
+	-5.603445e-03f,
+	4.663303e-03f,
+	-3.867932e-03f,
+	3.196362e-03f,
+	-2.624932e-03f,
+	2.142993e-03f,
+	-1.733906e-03f,
+	1.391931e-03f,
+	-1.103962e-03f,
+	8.668824e-04f,
+	-6.696148e-04f,
+	5.106786e-04f,
+	-3.803769e-04f,
+	2.784477e-04f,
+	-1.963091e-04f,
+	1.347476e-04f,
+	-8.618422e-05f,
+	5.237137e-05f,
+	-2.666071e-05f,
+	1.169479e-05f,
+	-1.666444e-06f,
+	-8.124612e-13f,
+
+	1.669981e-06f,
+	-1.170933e-05f,
+	2.669495e-05f,
+	-5.243568e-05f,
+	8.629113e-05f,
+	-1.349124e-04f,
+	1.965502e-04f,
+	-2.787872e-04f,
+	3.808417e-04f,
+	-5.113003e-04f,
+	6.704308e-04f,
+	-8.679364e-04f,
+	1.105305e-03f,
+	-1.393622e-03f,
+	1.736013e-03f,
+	-2.145594e-03f,
+	2.628119e-03f,
+	-3.200240e-03f,
+	3.872626e-03f,
+	-4.668961e-03f,
+	5.610245e-03f,
+	-6.735755e-03f,
+	8.090751e-03f,
+	-9.753644e-03f,
+	1.183570e-02f,
+	-1.453319e-02f,
+	1.818408e-02f,
+	-2.346687e-02f,
+	3.190237e-02f,
+	-4.778276e-02f,
+	8.906884e-02f,
+	-5.000000e-01f,
+	-8.906884e-02f,
+	4.778276e-02f,
+	-3.190237e-02f,
+	2.346687e-02f,
+	-1.818408e-02f,
+	1.453319e-02f,
+	-1.183570e-02f,
+	9.753644e-03f,
+	-8.090751e-03f,
+	6.735755e-03f,
+	-5.610245e-03f,
+	4.668961e-03f,
+	-3.872626e-03f,
+	3.200240e-03f,
+	-2.628119e-03f,
+	2.145594e-03f,
+	-1.736013e-03f,
+	1.393622e-03f,
+	-1.105305e-03f,
+	8.679364e-04f,
+	-6.704308e-04f,
+	5.113003e-04f,
+	-3.808417e-04f,
+	2.787872e-04f,
+	-1.965502e-04f,
+	1.349124e-04f,
+	-8.629113e-05f,
+	5.243568e-05f,
+	-2.669495e-05f,
+	1.170933e-05f,
+	-1.669981e-06f,
+	-4.440892e-15f
+};
+
+// blepd2 table: 4160 entries
+const float blepd2[] = {
+	-2.113185e-36f,
+	2.611419e-06f,
+	1.371797e-05f,
+	-2.934823e-05f,
+	-1.019843e-04f,
+	4.670050e-05f,
+	2.552815e-04f,
+	-9.393820e-05f,
+	-5.476579e-04f,
+	1.410584e-04f,
+	9.986735e-04f,
+	-2.281208e-04f,
+	-1.713998e-03f,
+	3.261826e-04f,
+	2.748275e-03f,
+	-4.776618e-04f,
+	-4.249922e-03f,
+	6.593143e-04f,
+	6.334764e-03f,
+	-9.269017e-04f,
+	-9.255557e-03f,
+	1.288270e-03f,
+	1.333339e-02f,
+	-1.875320e-03f,
+	-1.927564e-02f,
+	2.905226e-03f,
+	2.855514e-02f,
+	-5.215749e-03f,
+	-4.546173e-02f,
+	1.244537e-02f,
+	8.788255e-02f,
+	-6.419244e-02f,
+	5.000000e-01f,
+	6.419244e-02f,
+	-8.788255e-02f,
+	-1.244537e-02f,
+	4.546173e-02f,
+	5.215749e-03f,
+	-2.855514e-02f,
+	-2.905226e-03f,
+	1.927564e-02f,
+	1.875320e-03f,
+	-1.333339e-02f,
+	-1.288270e-03f,
+	9.255557e-03f,
+	9.269017e-04f,
+	-6.334764e-03f,
+	-6.593143e-04f,
+	4.249922e-03f,
+	4.776618e-04f,
+	-2.748275e-03f,
+	-3.261826e-04f,
+	1.713998e-03f,
+	2.281208e-04f,
+	-9.986735e-04f,
+	-1.410584e-04f,
+	5.476579e-04f,
+	9.393820e-05f,
+	-2.552815e-04f,
+	-4.670050e-05f,
+	1.019843e-04f,
+	2.934823e-05f,
+	-1.371797e-05f,
+	-2.611419e-06f,
+
+	4.040895e-13f,
+	2.753295e-06f,
+	1.371069e-05f,
+	-3.073596e-05f,
+	-1.019521e-04f,
+	5.104170e-05f,
+	2.551991e-04f,
+	-1.037327e-04f,
+	-5.474881e-04f,
+	1.599555e-04f,
+	9.983625e-04f,
+	-2.613071e-04f,
+	-1.713471e-03f,
+	3.808115e-04f,
+	2.747430e-03f,
+	-5.633757e-04f,
+	-4.248620e-03f,
+	7.889902e-04f,
+	6.332825e-03f,
+	-1.117919e-03f,
+	-9.252728e-03f,
+	1.564996e-03f,
+	1.332931e-02f,
+	-2.274599e-03f,
+	-1.926972e-02f,
+	3.490166e-03f,
+	2.854629e-02f,
+	-6.117922e-03f,
+	-4.544735e-02f,
+	1.404942e-02f,
+	8.785227e-02f,
+	-6.918523e-02f,
+	4.921880e-01f,
+	5.927765e-02f,
+	-8.785275e-02f,
+	-1.085025e-02f,
+	4.544748e-02f,
+	4.316951e-03f,
+	-2.854635e-02f,
+	-2.322105e-03f,
+	1.926976e-02f,
+	1.477193e-03f,
+	-1.332933e-02f,
+	-1.012334e-03f,
+	9.252744e-03f,
+	7.364469e-04f,
+	-6.332837e-03f,
+	-5.300422e-04f,
+	4.248629e-03f,
+	3.922358e-04f,
+	-2.747436e-03f,
+	-2.717550e-04f,
+	1.713475e-03f,
+	1.950711e-04f,
+	-9.983652e-04f,
+	-1.222502e-04f,
+	5.474898e-04f,
+	8.419867e-05f,
+	-2.552001e-04f,
+	-4.239081e-05f,
+	1.019527e-04f,
+	2.797604e-05f,
+	-1.371093e-05f,
+	-2.473992e-06f,
+
+	4.041509e-12f,
+	2.899604e-06f,
+	1.368864e-05f,
+	-3.213848e-05f,
+	-1.018551e-04f,
+	5.541193e-05f,
+	2.549510e-04f,
+	-1.135765e-04f,
+	-5.469770e-04f,
+	1.789304e-04f,
+	9.974272e-04f,
+	-2.946102e-04f,
+	-1.711886e-03f,
+	4.356091e-04f,
+	2.744887e-03f,
+	-6.493264e-04f,
+	-4.244710e-03f,
+	9.189924e-04f,
+	6.326995e-03f,
+	-1.309384e-03f,
+	-9.244224e-03f,
+	1.842348e-03f,
+	1.331704e-02f,
+	-2.674794e-03f,
+	-1.925193e-02f,
+	4.076581e-03f,
+	2.851972e-02f,
+	-7.022946e-03f,
+	-4.540409e-02f,
+	1.566151e-02f,
+	8.776096e-02f,
+	-7.425547e-02f,
+	4.843775e-01f,
+	5.444142e-02f,
+	-8.776386e-02f,
+	-9.264913e-03f,
+	4.540484e-02f,
+	3.422049e-03f,
+	-2.852007e-02f,
+	-1.741148e-03f,
+	1.925214e-02f,
+	1.080454e-03f,
+	-1.331718e-02f,
+	-7.373519e-04f,
+	9.244322e-03f,
+	5.466671e-04f,
+	-6.327065e-03f,
+	-4.012504e-04f,
+	4.244760e-03f,
+	3.071481e-04f,
+	-2.744923e-03f,
+	-2.175607e-04f,
+	1.711911e-03f,
+	1.621772e-04f,
+	-9.974435e-04f,
+	-1.035419e-04f,
+	5.469873e-04f,
+	7.451975e-05f,
+	-2.549572e-04f,
+	-3.811503e-05f,
+	1.018584e-04f,
+	2.662010e-05f,
+	-1.369004e-05f,
+	-2.341020e-06f,
+
+	1.818723e-11f,
+	3.050325e-06f,
+	1.365134e-05f,
+	-3.355503e-05f,
+	-1.016921e-04f,
+	5.980863e-05f,
+	2.545351e-04f,
+	-1.234638e-04f,
+	-5.461213e-04f,
+	1.979719e-04f,
+	9.958624e-04f,
+	-3.280102e-04f,
+	-1.709235e-03f,
+	4.905427e-04f,
+	2.740638e-03f,
+	-7.354625e-04f,
+	-4.238175e-03f,
+	1.049243e-03f,
+	6.317255e-03f,
+	-1.501182e-03f,
+	-9.230020e-03f,
+	2.120159e-03f,
+	1.329654e-02f,
+	-3.075664e-03f,
+	-1.922222e-02f,
+	4.664120e-03f,
+	2.847530e-02f,
+	-7.930289e-03f,
+	-4.533171e-02f,
+	1.728075e-02f,
+	8.760766e-02f,
+	-7.940256e-02f,
+	4.765702e-01f,
+	4.968426e-02f,
+	-8.761686e-02f,
+	-7.690223e-03f,
+	4.533410e-02f,
+	2.531557e-03f,
+	-2.847642e-02f,
+	-1.162692e-03f,
+	1.922288e-02f,
+	6.853371e-04f,
+	-1.329698e-02f,
+	-4.634860e-04f,
+	9.230330e-03f,
+	3.576742e-04f,
+	-6.317477e-03f,
+	-2.730147e-04f,
+	4.238334e-03f,
+	2.224488e-04f,
+	-2.740750e-03f,
+	-1.636314e-04f,
+	1.709313e-03f,
+	1.294582e-04f,
+	-9.959141e-04f,
+	-8.494436e-05f,
+	5.461542e-04f,
+	6.490696e-05f,
+	-2.545547e-04f,
+	-3.387557e-05f,
+	1.017027e-04f,
+	2.528110e-05f,
+	-1.365579e-05f,
+	-2.212501e-06f,
+
+	5.496064e-11f,
+	3.205428e-06f,
+	1.359834e-05f,
+	-3.498481e-05f,
+	-1.014621e-04f,
+	6.422922e-05f,
+	2.539497e-04f,
+	-1.333887e-04f,
+	-5.449183e-04f,
+	2.170684e-04f,
+	9.936638e-04f,
+	-3.614871e-04f,
+	-1.705513e-03f,
+	5.455792e-04f,
+	2.734672e-03f,
+	-8.217320e-04f,
+	-4.229003e-03f,
+	1.179664e-03f,
+	6.303587e-03f,
+	-1.693198e-03f,
+	-9.210088e-03f,
+	2.398262e-03f,
+	1.326778e-02f,
+	-3.476969e-03f,
+	-1.918052e-02f,
+	5.252433e-03f,
+	2.841294e-02f,
+	-8.839414e-03f,
+	-4.523000e-02f,
+	1.890623e-02f,
+	8.739145e-02f,
+	-8.462587e-02f,
+	4.687677e-01f,
+	4.500666e-02f,
+	-8.741274e-02f,
+	-6.127011e-03f,
+	4.523554e-02f,
+	1.645981e-03f,
+	-2.841554e-02f,
+	-5.870750e-04f,
+	1.918206e-02f,
+	2.920721e-04f,
+	-1.326880e-02f,
+	-1.908965e-04f,
+	9.210806e-03f,
+	1.695788e-04f,
+	-6.304102e-03f,
+	-1.454102e-04f,
+	4.229371e-03f,
+	1.381872e-04f,
+	-2.734932e-03f,
+	-1.099984e-04f,
+	1.705692e-03f,
+	9.693322e-05f,
+	-9.937834e-04f,
+	-6.646811e-05f,
+	5.449943e-04f,
+	5.536569e-05f,
+	-2.539951e-04f,
+	-2.967471e-05f,
+	1.014867e-04f,
+	2.395970e-05f,
+	-1.360863e-05f,
+	-2.088427e-06f,
+
+	1.313109e-10f,
+	3.364872e-06f,
+	1.352917e-05f,
+	-3.642698e-05f,
+	-1.011642e-04f,
+	6.867106e-05f,
+	2.531929e-04f,
+	-1.433452e-04f,
+	-5.433650e-04f,
+	2.362086e-04f,
+	9.908271e-04f,
+	-3.950206e-04f,
+	-1.700712e-03f,
+	6.006851e-04f,
+	2.726981e-03f,
+	-9.080824e-04f,
+	-4.217182e-03f,
+	1.310175e-03f,
+	6.285977e-03f,
+	-1.885314e-03f,
+	-9.184411e-03f,
+	2.676488e-03f,
+	1.323073e-02f,
+	-3.878464e-03f,
+	-1.912679e-02f,
+	5.841163e-03f,
+	2.833257e-02f,
+	-9.749779e-03f,
+	-4.509876e-02f,
+	2.053703e-02f,
+	8.711141e-02f,
+	-8.992476e-02f,
+	4.609715e-01f,
+	4.040908e-02f,
+	-8.715253e-02f,
+	-4.576098e-03f,
+	4.510947e-02f,
+	7.658233e-04f,
+	-2.833759e-02f,
+	-1.462755e-05f,
+	1.912977e-02f,
+	-9.911223e-05f,
+	-1.323270e-02f,
+	8.025771e-05f,
+	9.185796e-03f,
+	-1.750940e-05f,
+	-6.286969e-03f,
+	-1.851088e-05f,
+	4.217893e-03f,
+	5.441216e-05f,
+	-2.727484e-03f,
+	-5.669259e-05f,
+	1.701059e-03f,
+	6.462067e-05f,
+	-9.910580e-04f,
+	-4.812363e-05f,
+	5.435118e-04f,
+	4.590127e-05f,
+	-2.532807e-04f,
+	-2.551472e-05f,
+	1.012116e-04f,
+	2.265653e-05f,
+	-1.354905e-05f,
+	-1.968781e-06f,
+
+	2.689926e-10f,
+	3.528610e-06f,
+	1.344340e-05f,
+	-3.788071e-05f,
+	-1.007972e-04f,
+	7.313143e-05f,
+	2.522632e-04f,
+	-1.533271e-04f,
+	-5.414588e-04f,
+	2.553805e-04f,
+	9.873485e-04f,
+	-4.285901e-04f,
+	-1.694828e-03f,
+	6.558268e-04f,
+	2.717558e-03f,
+	-9.944610e-04f,
+	-4.202703e-03f,
+	1.440697e-03f,
+	6.264410e-03f,
+	-2.077414e-03f,
+	-9.152968e-03f,
+	2.954667e-03f,
+	1.318536e-02f,
+	-4.279907e-03f,
+	-1.906100e-02f,
+	6.429955e-03f,
+	2.823410e-02f,
+	-1.066084e-02f,
+	-4.493781e-02f,
+	2.217221e-02f,
+	8.676662e-02f,
+	-9.529854e-02f,
+	4.531832e-01f,
+	3.589194e-02f,
+	-8.683725e-02f,
+	-3.038288e-03f,
+	4.495619e-02f,
+	-1.084239e-04f,
+	-2.824273e-02f,
+	5.543219e-04f,
+	1.906611e-02f,
+	-4.879898e-04f,
+	-1.318875e-02f,
+	3.498197e-04f,
+	9.155346e-03f,
+	-2.034823e-04f,
+	-6.266114e-03f,
+	1.076099e-04f,
+	4.203924e-03f,
+	-2.882822e-05f,
+	-2.718421e-03f,
+	-3.744443e-06f,
+	1.695423e-03f,
+	3.253889e-05f,
+	-9.877448e-04f,
+	-2.992118e-05f,
+	5.417108e-04f,
+	3.651887e-05f,
+	-2.524139e-04f,
+	-2.139777e-05f,
+	1.008786e-04f,
+	2.137219e-05f,
+	-1.347751e-05f,
+	-1.853542e-06f,
+
+	4.945319e-10f,
+	3.696585e-06f,
+	1.334056e-05f,
+	-3.934510e-05f,
+	-1.003604e-04f,
+	7.760760e-05f,
+	2.511590e-04f,
+	-1.633285e-04f,
+	-5.391974e-04f,
+	2.745725e-04f,
+	9.832245e-04f,
+	-4.621749e-04f,
+	-1.687855e-03f,
+	7.109703e-04f,
+	2.706396e-03f,
+	-1.080815e-03f,
+	-4.185556e-03f,
+	1.571149e-03f,
+	6.238876e-03f,
+	-2.269380e-03f,
+	-9.115748e-03f,
+	3.232628e-03f,
+	1.313166e-02f,
+	-4.681051e-03f,
+	-1.898311e-02f,
+	7.018448e-03f,
+	2.811749e-02f,
+	-1.157204e-02f,
+	-4.474698e-02f,
+	2.381081e-02f,
+	8.635623e-02f,
+	-1.007465e-01f,
+	4.454044e-01f,
+	3.145565e-02f,
+	-8.646794e-02f,
+	-1.514370e-03f,
+	4.477604e-02f,
+	-9.762737e-04f,
+	-2.813112e-02f,
+	1.119449e-03f,
+	1.899118e-02f,
+	-8.743375e-04f,
+	-1.313702e-02f,
+	6.176343e-04f,
+	9.119507e-03f,
+	-3.882329e-04f,
+	-6.241570e-03f,
+	2.328799e-04f,
+	4.187488e-03f,
+	-1.114864e-04f,
+	-2.707761e-03f,
+	4.881603e-05f,
+	1.688796e-03f,
+	7.059108e-07f,
+	-9.838510e-04f,
+	-1.187086e-05f,
+	5.395959e-04f,
+	2.722358e-05f,
+	-2.513972e-04f,
+	-1.732602e-05f,
+	1.004891e-04f,
+	2.010726e-05f,
+	-1.339448e-05f,
+	-1.742679e-06f,
+
+	8.391828e-10f,
+	3.868731e-06f,
+	1.322022e-05f,
+	-4.081926e-05f,
+	-9.985280e-05f,
+	8.209677e-05f,
+	2.498787e-04f,
+	-1.733429e-04f,
+	-5.365786e-04f,
+	2.937725e-04f,
+	9.784522e-04f,
+	-4.957542e-04f,
+	-1.679791e-03f,
+	7.660812e-04f,
+	2.693490e-03f,
+	-1.167089e-03f,
+	-4.165737e-03f,
+	1.701451e-03f,
+	6.209367e-03f,
+	-2.461093e-03f,
+	-9.072739e-03f,
+	3.510200e-03f,
+	1.306960e-02f,
+	-5.081650e-03f,
+	-1.889309e-02f,
+	7.606282e-03f,
+	2.798266e-02f,
+	-1.248283e-02f,
+	-4.452611e-02f,
+	2.545188e-02f,
+	8.587934e-02f,
+	-1.062680e-01f,
+	4.376366e-01f,
+	2.710060e-02f,
+	-8.604565e-02f,
+	-5.114924e-06f,
+	4.456935e-02f,
+	-1.837247e-03f,
+	-2.800295e-02f,
+	1.680435e-03f,
+	1.890511e-02f,
+	-1.257935e-03f,
+	-1.307758e-02f,
+	8.835485e-04f,
+	9.078331e-03f,
+	-5.716557e-04f,
+	-6.213375e-03f,
+	3.572277e-04f,
+	4.168610e-03f,
+	-1.935156e-04f,
+	-2.695521e-03f,
+	1.009593e-04f,
+	1.681191e-03f,
+	-3.086056e-05f,
+	-9.793842e-04f,
+	6.017448e-06f,
+	5.371714e-04f,
+	1.802037e-05f,
+	-2.502332e-04f,
+	-1.330151e-05f,
+	1.000442e-04f,
+	1.886228e-05f,
+	-1.330045e-05f,
+	-1.636157e-06f,
+
+	1.338874e-09f,
+	4.044975e-06f,
+	1.308194e-05f,
+	-4.230226e-05f,
+	-9.927352e-05f,
+	8.659609e-05f,
+	2.484211e-04f,
+	-1.833641e-04f,
+	-5.336004e-04f,
+	3.129685e-04f,
+	9.730286e-04f,
+	-5.293069e-04f,
+	-1.670630e-03f,
+	8.211253e-04f,
+	2.678836e-03f,
+	-1.253232e-03f,
+	-4.143239e-03f,
+	1.831522e-03f,
+	6.175878e-03f,
+	-2.652434e-03f,
+	-9.023932e-03f,
+	3.787212e-03f,
+	1.299919e-02f,
+	-5.481454e-03f,
+	-1.879093e-02f,
+	8.193092e-03f,
+	2.782959e-02f,
+	-1.339264e-02f,
+	-4.427507e-02f,
+	2.709445e-02f,
+	8.533512e-02f,
+	-1.118621e-01f,
+	4.298814e-01f,
+	2.282713e-02f,
+	-8.557143e-02f,
+	1.488720e-03f,
+	4.433649e-02f,
+	-2.690872e-03f,
+	-2.785840e-02f,
+	2.236965e-03f,
+	1.880800e-02f,
+	-1.638565e-03f,
+	-1.301052e-02f,
+	1.147411e-03f,
+	9.031875e-03f,
+	-7.536465e-04f,
+	-6.181569e-03f,
+	4.805829e-04f,
+	4.147319e-03f,
+	-2.748697e-04f,
+	-2.681720e-03f,
+	1.526562e-04f,
+	1.672618e-03f,
+	-6.214313e-05f,
+	-9.743522e-04f,
+	2.373405e-05f,
+	5.344423e-04f,
+	8.914081e-06f,
+	-2.489245e-04f,
+	-9.326267e-06f,
+	9.954536e-05f,
+	1.763778e-05f,
+	-1.319588e-05f,
+	-1.533932e-06f,
+
+	2.034147e-09f,
+	4.225230e-06f,
+	1.292529e-05f,
+	-4.379313e-05f,
+	-9.862177e-05f,
+	9.110267e-05f,
+	2.467849e-04f,
+	-1.933856e-04f,
+	-5.302610e-04f,
+	3.321484e-04f,
+	9.669517e-04f,
+	-5.628118e-04f,
+	-1.660371e-03f,
+	8.760677e-04f,
+	2.662431e-03f,
+	-1.339188e-03f,
+	-4.118060e-03f,
+	1.961280e-03f,
+	6.138403e-03f,
+	-2.843282e-03f,
+	-8.969326e-03f,
+	4.063489e-03f,
+	1.292041e-02f,
+	-5.880215e-03f,
+	-1.867662e-02f,
+	8.778515e-03f,
+	2.765824e-02f,
+	-1.430092e-02f,
+	-4.399373e-02f,
+	2.873751e-02f,
+	8.472272e-02f,
+	-1.175282e-01f,
+	4.221405e-01f,
+	1.863556e-02f,
+	-8.504635e-02f,
+	2.966397e-03f,
+	4.407780e-02f,
+	-3.536685e-03f,
+	-2.769767e-02f,
+	2.788727e-03f,
+	1.869998e-02f,
+	-2.016012e-03f,
+	-1.293591e-02f,
+	1.409073e-03f,
+	8.980196e-03f,
+	-9.341026e-04f,
+	-6.146192e-03f,
+	6.028764e-04f,
+	4.123644e-03f,
+	-3.555033e-04f,
+	-2.666378e-03f,
+	2.038783e-04f,
+	1.663092e-03f,
+	-9.312471e-05f,
+	-9.687633e-04f,
+	4.126945e-05f,
+	5.314133e-04f,
+	-9.054033e-08f,
+	-2.474738e-04f,
+	-5.402226e-06f,
+	9.899381e-05f,
+	1.643424e-05f,
+	-1.308124e-05f,
+	-1.435957e-06f,
+
+	2.970082e-09f,
+	4.409404e-06f,
+	1.274986e-05f,
+	-4.529089e-05f,
+	-9.789676e-05f,
+	9.561357e-05f,
+	2.449688e-04f,
+	-2.034011e-04f,
+	-5.265590e-04f,
+	3.512997e-04f,
+	9.602195e-04f,
+	-5.962475e-04f,
+	-1.649011e-03f,
+	9.308737e-04f,
+	2.644272e-03f,
+	-1.424903e-03f,
+	-4.090196e-03f,
+	2.090644e-03f,
+	6.096943e-03f,
+	-3.033519e-03f,
+	-8.908920e-03f,
+	4.338859e-03f,
+	1.283326e-02f,
+	-6.277682e-03f,
+	-1.855016e-02f,
+	9.362184e-03f,
+	2.746859e-02f,
+	-1.520709e-02f,
+	-4.368200e-02f,
+	3.038008e-02f,
+	8.404133e-02f,
+	-1.232654e-01f,
+	4.144152e-01f,
+	1.452618e-02f,
+	-8.447149e-02f,
+	4.427193e-03f,
+	4.379368e-02f,
+	-4.374231e-03f,
+	-2.752096e-02f,
+	3.335416e-03f,
+	1.858118e-02f,
+	-2.390066e-03f,
+	-1.285385e-02f,
+	1.668387e-03f,
+	8.923357e-03f,
+	-1.112923e-03f,
+	-6.107288e-03f,
+	7.240399e-04f,
+	4.097613e-03f,
+	-4.353716e-04f,
+	-2.649515e-03f,
+	2.545974e-04f,
+	1.652626e-03f,
+	-1.237886e-04f,
+	-9.626257e-04f,
+	5.861437e-05f,
+	5.280895e-04f,
+	-8.988884e-06f,
+	-2.458839e-04f,
+	-1.531269e-06f,
+	9.839090e-05f,
+	1.525212e-05f,
+	-1.295700e-05f,
+	-1.342178e-06f,
+
+	4.196218e-09f,
+	4.597392e-06f,
+	1.255523e-05f,
+	-4.679453e-05f,
+	-9.709774e-05f,
+	1.001258e-04f,
+	2.429720e-04f,
+	-2.134040e-04f,
+	-5.224930e-04f,
+	3.704102e-04f,
+	9.528307e-04f,
+	-6.295926e-04f,
+	-1.636549e-03f,
+	9.855082e-04f,
+	2.624358e-03f,
+	-1.510323e-03f,
+	-4.059650e-03f,
+	2.219530e-03f,
+	6.051499e-03f,
+	-3.223024e-03f,
+	-8.842717e-03f,
+	4.613147e-03f,
+	1.273775e-02f,
+	-6.673606e-03f,
+	-1.841154e-02f,
+	9.943729e-03f,
+	2.726063e-02f,
+	-1.611060e-02f,
+	-4.333979e-02f,
+	3.202114e-02f,
+	8.329016e-02f,
+	-1.290729e-01f,
+	4.067073e-01f,
+	1.049926e-02f,
+	-8.384795e-02f,
+	5.870403e-03f,
+	4.348450e-02f,
+	-5.203062e-03f,
+	-2.732849e-02f,
+	3.876732e-03f,
+	1.845174e-02f,
+	-2.760518e-03f,
+	-1.276443e-02f,
+	1.925210e-03f,
+	8.861423e-03f,
+	-1.290008e-03f,
+	-6.064902e-03f,
+	8.440064e-04f,
+	4.069258e-03f,
+	-5.144310e-04f,
+	-2.631151e-03f,
+	3.047860e-04f,
+	1.641232e-03f,
+	-1.541183e-04f,
+	-9.559481e-04f,
+	7.575971e-05f,
+	5.244759e-04f,
+	-1.777646e-05f,
+	-2.441576e-04f,
+	2.284789e-06f,
+	9.773799e-05f,
+	1.409187e-05f,
+	-1.282361e-05f,
+	-1.252535e-06f,
+
+	5.766463e-09f,
+	4.789083e-06f,
+	1.234099e-05f,
+	-4.830303e-05f,
+	-9.622403e-05f,
+	1.046364e-04f,
+	2.407934e-04f,
+	-2.233877e-04f,
+	-5.180619e-04f,
+	3.894673e-04f,
+	9.447839e-04f,
+	-6.628255e-04f,
+	-1.622984e-03f,
+	1.039936e-03f,
+	2.602690e-03f,
+	-1.595393e-03f,
+	-4.026420e-03f,
+	2.347858e-03f,
+	6.002075e-03f,
+	-3.411675e-03f,
+	-8.770725e-03f,
+	4.886180e-03f,
+	1.263390e-02f,
+	-7.067735e-03f,
+	-1.826079e-02f,
+	1.052278e-02f,
+	2.703437e-02f,
+	-1.701085e-02f,
+	-4.296701e-02f,
+	3.365967e-02f,
+	8.246841e-02f,
+	-1.349499e-01f,
+	3.990182e-01f,
+	6.555033e-03f,
+	-8.317681e-02f,
+	7.295340e-03f,
+	4.315068e-02f,
+	-6.022739e-03f,
+	-2.712047e-02f,
+	4.412378e-03f,
+	1.831180e-02f,
+	-3.127165e-03f,
+	-1.266775e-02f,
+	2.179398e-03f,
+	8.794460e-03f,
+	-1.465261e-03f,
+	-6.019081e-03f,
+	9.627098e-04f,
+	4.038613e-03f,
+	-5.926382e-04f,
+	-2.611310e-03f,
+	3.544170e-04f,
+	1.628926e-03f,
+	-1.840978e-04f,
+	-9.487395e-04f,
+	9.269662e-05f,
+	5.205780e-04f,
+	-2.644888e-05f,
+	-2.422977e-04f,
+	6.044195e-06f,
+	9.703644e-05f,
+	1.295388e-05f,
+	-1.268155e-05f,
+	-1.166964e-06f,
+
+	7.738991e-09f,
+	4.984352e-06f,
+	1.210676e-05f,
+	-4.981532e-05f,
+	-9.527498e-05f,
+	1.091422e-04f,
+	2.384322e-04f,
+	-2.333456e-04f,
+	-5.132649e-04f,
+	4.084586e-04f,
+	9.360786e-04f,
+	-6.959246e-04f,
+	-1.608316e-03f,
+	1.094122e-03f,
+	2.579269e-03f,
+	-1.680057e-03f,
+	-3.990512e-03f,
+	2.475544e-03f,
+	5.948677e-03f,
+	-3.599353e-03f,
+	-8.692953e-03f,
+	5.157783e-03f,
+	1.252171e-02f,
+	-7.459818e-03f,
+	-1.809791e-02f,
+	1.109898e-02f,
+	2.678981e-02f,
+	-1.790729e-02f,
+	-4.256363e-02f,
+	3.529465e-02f,
+	8.157534e-02f,
+	-1.408954e-01f,
+	3.913495e-01f,
+	2.693716e-03f,
+	-8.245917e-02f,
+	8.701334e-03f,
+	4.279261e-02f,
+	-6.832832e-03f,
+	-2.689715e-02f,
+	4.942064e-03f,
+	1.816150e-02f,
+	-3.489804e-03f,
+	-1.256390e-02f,
+	2.430812e-03f,
+	8.722538e-03f,
+	-1.638583e-03f,
+	-5.969875e-03f,
+	1.080085e-03f,
+	4.005710e-03f,
+	-6.699510e-04f,
+	-2.590013e-03f,
+	4.034640e-04f,
+	1.615723e-03f,
+	-2.137114e-04f,
+	-9.410091e-04f,
+	1.094164e-04f,
+	5.164011e-04f,
+	-3.500193e-05f,
+	-2.403073e-04f,
+	9.745263e-06f,
+	9.628764e-05f,
+	1.183854e-05f,
+	-1.253127e-05f,
+	-1.085395e-06f,
+
+	1.017613e-08f,
+	5.183068e-06f,
+	1.185214e-05f,
+	-5.133032e-05f,
+	-9.424997e-05f,
+	1.136401e-04f,
+	2.358877e-04f,
+	-2.432708e-04f,
+	-5.081012e-04f,
+	4.273714e-04f,
+	9.267146e-04f,
+	-7.288678e-04f,
+	-1.592546e-03f,
+	1.148030e-03f,
+	2.554097e-03f,
+	-1.764262e-03f,
+	-3.951930e-03f,
+	2.602506e-03f,
+	5.891313e-03f,
+	-3.785936e-03f,
+	-8.609417e-03f,
+	5.427781e-03f,
+	1.240120e-02f,
+	-7.849602e-03f,
+	-1.792295e-02f,
+	1.167194e-02f,
+	2.652698e-02f,
+	-1.879932e-02f,
+	-4.212961e-02f,
+	3.692501e-02f,
+	8.061020e-02f,
+	-1.469086e-01f,
+	3.837027e-01f,
+	-1.084513e-03f,
+	-8.169615e-02f,
+	1.008773e-02f,
+	4.241072e-02f,
+	-7.632918e-03f,
+	-2.665874e-02f,
+	5.465506e-03f,
+	1.800100e-02f,
+	-3.848239e-03f,
+	-1.245300e-02f,
+	2.679315e-03f,
+	8.645731e-03f,
+	-1.809883e-03f,
+	-5.917332e-03f,
+	1.196070e-03f,
+	3.970584e-03f,
+	-7.463280e-04f,
+	-2.567284e-03f,
+	4.519011e-04f,
+	1.601637e-03f,
+	-2.429437e-04f,
+	-9.327664e-04f,
+	1.259107e-04f,
+	5.119508e-04f,
+	-4.343146e-05f,
+	-2.381893e-04f,
+	1.338637e-05f,
+	9.549297e-05f,
+	1.074620e-05f,
+	-1.237322e-05f,
+	-1.007755e-06f,
+
+	1.314427e-08f,
+	5.385086e-06f,
+	1.157676e-05f,
+	-5.284693e-05f,
+	-9.314845e-05f,
+	1.181271e-04f,
+	2.331593e-04f,
+	-2.531568e-04f,
+	-5.025706e-04f,
+	4.461930e-04f,
+	9.166919e-04f,
+	-7.616336e-04f,
+	-1.575675e-03f,
+	1.201626e-03f,
+	2.527177e-03f,
+	-1.847951e-03f,
+	-3.910680e-03f,
+	2.728662e-03f,
+	5.829996e-03f,
+	-3.971304e-03f,
+	-8.520135e-03f,
+	5.696000e-03f,
+	1.227241e-02f,
+	-8.236837e-03f,
+	-1.773593e-02f,
+	1.224130e-02f,
+	2.624592e-02f,
+	-1.968638e-02f,
+	-4.166492e-02f,
+	3.854972e-02f,
+	7.957227e-02f,
+	-1.529884e-01f,
+	3.760793e-01f,
+	-4.779501e-03f,
+	-8.088887e-02f,
+	1.145390e-02f,
+	4.200545e-02f,
+	-8.422586e-03f,
+	-2.640550e-02f,
+	5.982422e-03f,
+	1.783046e-02f,
+	-4.202275e-03f,
+	-1.233514e-02f,
+	2.924772e-03f,
+	8.564113e-03f,
+	-1.979066e-03f,
+	-5.861507e-03f,
+	1.310601e-03f,
+	3.933271e-03f,
+	-8.217287e-04f,
+	-2.543147e-03f,
+	4.997029e-04f,
+	1.586685e-03f,
+	-2.717797e-04f,
+	-9.240211e-04f,
+	1.421713e-04f,
+	5.072326e-04f,
+	-5.173348e-05f,
+	-2.359468e-04f,
+	1.696597e-05f,
+	9.465383e-05f,
+	9.677190e-06f,
+	-1.220785e-05f,
+	-9.339640e-07f,
+
+	1.671367e-08f,
+	5.590254e-06f,
+	1.128026e-05f,
+	-5.436403e-05f,
+	-9.196991e-05f,
+	1.225999e-04f,
+	2.302465e-04f,
+	-2.629966e-04f,
+	-4.966727e-04f,
+	4.649107e-04f,
+	9.060111e-04f,
+	-7.941998e-04f,
+	-1.557705e-03f,
+	1.254873e-03f,
+	2.498513e-03f,
+	-1.931070e-03f,
+	-3.866772e-03f,
+	2.853928e-03f,
+	5.764740e-03f,
+	-4.155335e-03f,
+	-8.425127e-03f,
+	5.962266e-03f,
+	1.213536e-02f,
+	-8.621270e-03f,
+	-1.753689e-02f,
+	1.280669e-02f,
+	2.594667e-02f,
+	-2.056789e-02f,
+	-4.116957e-02f,
+	4.016770e-02f,
+	7.846085e-02f,
+	-1.591341e-01f,
+	3.684808e-01f,
+	-8.391121e-03f,
+	-8.003844e-02f,
+	1.279922e-02f,
+	4.157723e-02f,
+	-9.201433e-03f,
+	-2.613767e-02f,
+	6.492540e-03f,
+	1.765003e-02f,
+	-4.551723e-03f,
+	-1.221044e-02f,
+	3.167050e-03f,
+	8.477761e-03f,
+	-2.146042e-03f,
+	-5.802452e-03f,
+	1.423617e-03f,
+	3.893809e-03f,
+	-8.961132e-04f,
+	-2.517628e-03f,
+	5.468446e-04f,
+	1.570882e-03f,
+	-3.002048e-04f,
+	-9.147830e-04f,
+	1.581901e-04f,
+	5.022524e-04f,
+	-5.990415e-05f,
+	-2.335827e-04f,
+	2.048255e-05f,
+	9.377165e-05f,
+	8.631799e-06f,
+	-1.203560e-05f,
+	-8.639404e-07f,
+
+	2.095842e-08f,
+	5.798408e-06f,
+	1.096228e-05f,
+	-5.588046e-05f,
+	-9.071388e-05f,
+	1.270553e-04f,
+	2.271490e-04f,
+	-2.727835e-04f,
+	-4.904078e-04f,
+	4.835117e-04f,
+	8.946734e-04f,
+	-8.265445e-04f,
+	-1.538638e-03f,
+	1.307736e-03f,
+	2.468112e-03f,
+	-2.013564e-03f,
+	-3.820214e-03f,
+	2.978222e-03f,
+	5.695560e-03f,
+	-4.337909e-03f,
+	-8.324418e-03f,
+	6.226403e-03f,
+	1.199009e-02f,
+	-9.002650e-03f,
+	-1.732588e-02f,
+	1.336774e-02f,
+	2.562928e-02f,
+	-2.144325e-02f,
+	-4.064357e-02f,
+	4.177790e-02f,
+	7.727525e-02f,
+	-1.653445e-01f,
+	3.609088e-01f,
+	-1.191928e-02f,
+	-7.914601e-02f,
+	1.412309e-02f,
+	4.112652e-02f,
+	-9.969062e-03f,
+	-2.585552e-02f,
+	6.995592e-03f,
+	1.745988e-02f,
+	-4.896395e-03f,
+	-1.207901e-02f,
+	3.406021e-03f,
+	8.386756e-03f,
+	-2.310722e-03f,
+	-5.740224e-03f,
+	1.535059e-03f,
+	3.852235e-03f,
+	-9.694429e-04f,
+	-2.490750e-03f,
+	5.933021e-04f,
+	1.554244e-03f,
+	-3.282049e-04f,
+	-9.050624e-04f,
+	1.739595e-04f,
+	4.970162e-04f,
+	-6.793972e-05f,
+	-2.311003e-04f,
+	2.393471e-05f,
+	9.284785e-05f,
+	7.610302e-06f,
+	-1.185692e-05f,
+	-7.975977e-07f,
+
+	2.595619e-08f,
+	6.009376e-06f,
+	1.062249e-05f,
+	-5.739505e-05f,
+	-8.937996e-05f,
+	1.314901e-04f,
+	2.238665e-04f,
+	-2.825104e-04f,
+	-4.837760e-04f,
+	5.019831e-04f,
+	8.826801e-04f,
+	-8.586458e-04f,
+	-1.518479e-03f,
+	1.360180e-03f,
+	2.435980e-03f,
+	-2.095377e-03f,
+	-3.771018e-03f,
+	3.101462e-03f,
+	5.622474e-03f,
+	-4.518906e-03f,
+	-8.218039e-03f,
+	6.488239e-03f,
+	1.183665e-02f,
+	-9.380726e-03f,
+	-1.710296e-02f,
+	1.392407e-02f,
+	2.529383e-02f,
+	-2.231189e-02f,
+	-4.008695e-02f,
+	4.337922e-02f,
+	7.601482e-02f,
+	-1.716188e-01f,
+	3.533648e-01f,
+	-1.536390e-02f,
+	-7.821271e-02f,
+	1.542494e-02f,
+	4.065378e-02f,
+	-1.072509e-02f,
+	-2.555931e-02f,
+	7.491314e-03f,
+	1.726020e-02f,
+	-5.236111e-03f,
+	-1.194097e-02f,
+	3.641558e-03f,
+	8.291181e-03f,
+	-2.473020e-03f,
+	-5.674880e-03f,
+	1.644869e-03f,
+	3.808589e-03f,
+	-1.041680e-03f,
+	-2.462541e-03f,
+	6.390518e-04f,
+	1.536790e-03f,
+	-3.557660e-04f,
+	-8.948696e-04f,
+	1.894720e-04f,
+	4.915298e-04f,
+	-7.583659e-05f,
+	-2.285027e-04f,
+	2.732108e-05f,
+	9.188385e-05f,
+	6.612944e-06f,
+	-1.167224e-05f,
+	-7.348461e-07f,
+
+	3.178819e-08f,
+	6.222972e-06f,
+	1.026055e-05f,
+	-5.890660e-05f,
+	-8.796778e-05f,
+	1.359011e-04f,
+	2.203989e-04f,
+	-2.921706e-04f,
+	-4.767779e-04f,
+	5.203121e-04f,
+	8.700329e-04f,
+	-8.904815e-04f,
+	-1.497231e-03f,
+	1.412168e-03f,
+	2.402125e-03f,
+	-2.176455e-03f,
+	-3.719199e-03f,
+	3.223565e-03f,
+	5.545507e-03f,
+	-4.698203e-03f,
+	-8.106020e-03f,
+	6.747600e-03f,
+	1.167507e-02f,
+	-9.755248e-03f,
+	-1.686820e-02f,
+	1.447532e-02f,
+	2.494040e-02f,
+	-2.317322e-02f,
+	-3.949978e-02f,
+	4.497058e-02f,
+	7.467894e-02f,
+	-1.779558e-01f,
+	3.458501e-01f,
+	-1.872494e-02f,
+	-7.723967e-02f,
+	1.670421e-02f,
+	4.015947e-02f,
+	-1.146915e-02f,
+	-2.524931e-02f,
+	7.979451e-03f,
+	1.705115e-02f,
+	-5.570691e-03f,
+	-1.179645e-02f,
+	3.873536e-03f,
+	8.191120e-03f,
+	-2.632849e-03f,
+	-5.606479e-03f,
+	1.752989e-03f,
+	3.762911e-03f,
+	-1.112787e-03f,
+	-2.433028e-03f,
+	6.840709e-04f,
+	1.518535e-03f,
+	-3.828747e-04f,
+	-8.842152e-04f,
+	2.047201e-04f,
+	4.857994e-04f,
+	-8.359129e-05f,
+	-2.257931e-04f,
+	3.064037e-05f,
+	9.088108e-05f,
+	5.639944e-06f,
+	-1.148198e-05f,
+	-6.755927e-07f,
+
+	3.853889e-08f,
+	6.439003e-06f,
+	9.876153e-06f,
+	-6.041392e-05f,
+	-8.647702e-05f,
+	1.402849e-04f,
+	2.167462e-04f,
+	-3.017570e-04f,
+	-4.694144e-04f,
+	5.384857e-04f,
+	8.567343e-04f,
+	-9.220295e-04f,
+	-1.474899e-03f,
+	1.463665e-03f,
+	2.366555e-03f,
+	-2.256742e-03f,
+	-3.664770e-03f,
+	3.344449e-03f,
+	5.464680e-03f,
+	-4.875683e-03f,
+	-7.988400e-03f,
+	7.004312e-03f,
+	1.150541e-02f,
+	-1.012597e-02f,
+	-1.662166e-02f,
+	1.502112e-02f,
+	2.456907e-02f,
+	-2.402666e-02f,
+	-3.888213e-02f,
+	4.655087e-02f,
+	7.326695e-02f,
+	-1.843545e-01f,
+	3.383664e-01f,
+	-2.200239e-02f,
+	-7.622804e-02f,
+	1.796034e-02f,
+	3.964407e-02f,
+	-1.220086e-02f,
+	-2.492579e-02f,
+	8.459752e-03f,
+	1.683291e-02f,
+	-5.899962e-03f,
+	-1.164557e-02f,
+	4.101836e-03f,
+	8.086659e-03f,
+	-2.790128e-03f,
+	-5.535081e-03f,
+	1.859365e-03f,
+	3.715243e-03f,
+	-1.182729e-03f,
+	-2.402238e-03f,
+	7.283367e-04f,
+	1.499498e-03f,
+	-4.095178e-04f,
+	-8.731099e-04f,
+	2.196970e-04f,
+	4.798311e-04f,
+	-9.120048e-05f,
+	-2.229748e-04f,
+	3.389135e-05f,
+	8.984100e-05f,
+	4.691494e-06f,
+	-1.128657e-05f,
+	-6.197415e-07f,
+
+	4.629594e-08f,
+	6.657266e-06f,
+	9.468999e-06f,
+	-6.191577e-05f,
+	-8.490744e-05f,
+	1.446381e-04f,
+	2.129085e-04f,
+	-3.112627e-04f,
+	-4.616864e-04f,
+	5.564911e-04f,
+	8.427870e-04f,
+	-9.532680e-04f,
+	-1.451489e-03f,
+	1.514636e-03f,
+	2.329282e-03f,
+	-2.336183e-03f,
+	-3.607749e-03f,
+	3.464032e-03f,
+	5.380020e-03f,
+	-5.051225e-03f,
+	-7.865216e-03f,
+	7.258204e-03f,
+	1.132774e-02f,
+	-1.049263e-02f,
+	-1.636343e-02f,
+	1.556110e-02f,
+	2.417995e-02f,
+	-2.487163e-02f,
+	-3.823407e-02f,
+	4.811901e-02f,
+	7.177830e-02f,
+	-1.908139e-01f,
+	3.309150e-01f,
+	-2.519625e-02f,
+	-7.517898e-02f,
+	1.919281e-02f,
+	3.910808e-02f,
+	-1.291987e-02f,
+	-2.458906e-02f,
+	8.931975e-03f,
+	1.660568e-02f,
+	-6.223754e-03f,
+	-1.148846e-02f,
+	4.326337e-03f,
+	7.977889e-03f,
+	-2.944775e-03f,
+	-5.460748e-03f,
+	1.963941e-03f,
+	3.665625e-03f,
+	-1.251470e-03f,
+	-2.370198e-03f,
+	7.718279e-04f,
+	1.479696e-03f,
+	-4.356829e-04f,
+	-8.615648e-04f,
+	2.343957e-04f,
+	4.736313e-04f,
+	-9.866095e-05f,
+	-2.200510e-04f,
+	3.707287e-05f,
+	8.876503e-05f,
+	3.767761e-06f,
+	-1.108642e-05f,
+	-5.671937e-07f,
+
+	5.514998e-08f,
+	6.877543e-06f,
+	9.038803e-06f,
+	-6.341089e-05f,
+	-8.325883e-05f,
+	1.489576e-04f,
+	2.088862e-04f,
+	-3.206806e-04f,
+	-4.535952e-04f,
+	5.743153e-04f,
+	8.281940e-04f,
+	-9.841748e-04f,
+	-1.427007e-03f,
+	1.565045e-03f,
+	2.290315e-03f,
+	-2.414724e-03f,
+	-3.548155e-03f,
+	3.582232e-03f,
+	5.291556e-03f,
+	-5.224710e-03f,
+	-7.736512e-03f,
+	7.509103e-03f,
+	1.114210e-02f,
+	-1.085499e-02f,
+	-1.609359e-02f,
+	1.609489e-02f,
+	2.377315e-02f,
+	-2.570755e-02f,
+	-3.755572e-02f,
+	4.967387e-02f,
+	7.021239e-02f,
+	-1.973329e-01f,
+	3.234974e-01f,
+	-2.830658e-02f,
+	-7.409363e-02f,
+	2.040112e-02f,
+	3.855198e-02f,
+	-1.362585e-02f,
+	-2.423938e-02f,
+	9.395880e-03f,
+	1.636964e-02f,
+	-6.541901e-03f,
+	-1.132524e-02f,
+	4.546927e-03f,
+	7.864901e-03f,
+	-3.096711e-03f,
+	-5.383543e-03f,
+	2.066665e-03f,
+	3.614103e-03f,
+	-1.318976e-03f,
+	-2.336938e-03f,
+	8.145233e-04f,
+	1.459148e-03f,
+	-4.613575e-04f,
+	-8.495909e-04f,
+	2.488098e-04f,
+	4.672063e-04f,
+	-1.059697e-04f,
+	-2.170249e-04f,
+	4.018383e-05f,
+	8.765463e-05f,
+	2.868888e-06f,
+	-1.088193e-05f,
+	-5.178485e-07f,
+
+	6.519441e-08f,
+	7.099612e-06f,
+	8.585293e-06f,
+	-6.489802e-05f,
+	-8.153105e-05f,
+	1.532398e-04f,
+	2.046794e-04f,
+	-3.300038e-04f,
+	-4.451424e-04f,
+	5.919453e-04f,
+	8.129591e-04f,
+	-1.014728e-03f,
+	-1.401460e-03f,
+	1.614857e-03f,
+	2.249669e-03f,
+	-2.492311e-03f,
+	-3.486007e-03f,
+	3.698969e-03f,
+	5.199320e-03f,
+	-5.396020e-03f,
+	-7.602335e-03f,
+	7.756839e-03f,
+	1.094857e-02f,
+	-1.121281e-02f,
+	-1.581224e-02f,
+	1.662212e-02f,
+	2.334881e-02f,
+	-2.653382e-02f,
+	-3.684720e-02f,
+	5.121433e-02f,
+	6.856868e-02f,
+	-2.039103e-01f,
+	3.161151e-01f,
+	-3.133343e-02f,
+	-7.297315e-02f,
+	2.158479e-02f,
+	3.797629e-02f,
+	-1.431845e-02f,
+	-2.387707e-02f,
+	9.851237e-03f,
+	1.612500e-02f,
+	-6.854243e-03f,
+	-1.115606e-02f,
+	4.763493e-03f,
+	7.747788e-03f,
+	-3.245861e-03f,
+	-5.303532e-03f,
+	2.167486e-03f,
+	3.560719e-03f,
+	-1.385214e-03f,
+	-2.302487e-03f,
+	8.564024e-04f,
+	1.437872e-03f,
+	-4.865298e-04f,
+	-8.371997e-04f,
+	2.629329e-04f,
+	4.605626e-04f,
+	-1.131236e-04f,
+	-2.139001e-04f,
+	4.322320e-05f,
+	8.651124e-05f,
+	1.994992e-06f,
+	-1.067352e-05f,
+	-4.716029e-07f,
+
+	7.652523e-08f,
+	7.323236e-06f,
+	8.108213e-06f,
+	-6.637586e-05f,
+	-7.972400e-05f,
+	1.574814e-04f,
+	2.002889e-04f,
+	-3.392252e-04f,
+	-4.363297e-04f,
+	6.093684e-04f,
+	7.970862e-04f,
+	-1.044905e-03f,
+	-1.374855e-03f,
+	1.664037e-03f,
+	2.207355e-03f,
+	-2.568889e-03f,
+	-3.421328e-03f,
+	3.814161e-03f,
+	5.103346e-03f,
+	-5.565036e-03f,
+	-7.462736e-03f,
+	8.001243e-03f,
+	1.074723e-02f,
+	-1.156583e-02f,
+	-1.551948e-02f,
+	1.714244e-02f,
+	2.290705e-02f,
+	-2.734987e-02f,
+	-3.610867e-02f,
+	5.273928e-02f,
+	6.684665e-02f,
+	-2.105450e-01f,
+	3.087695e-01f,
+	-3.427690e-02f,
+	-7.181870e-02f,
+	2.274333e-02f,
+	3.738150e-02f,
+	-1.499735e-02f,
+	-2.350241e-02f,
+	1.029782e-02f,
+	1.587194e-02f,
+	-7.160622e-03f,
+	-1.098104e-02f,
+	4.975925e-03f,
+	7.626644e-03f,
+	-3.392148e-03f,
+	-5.220780e-03f,
+	2.266354e-03f,
+	3.505518e-03f,
+	-1.450153e-03f,
+	-2.266874e-03f,
+	8.974457e-04f,
+	1.415887e-03f,
+	-5.111885e-04f,
+	-8.244025e-04f,
+	2.767589e-04f,
+	4.537066e-04f,
+	-1.201201e-04f,
+	-2.106797e-04f,
+	4.619003e-05f,
+	8.533631e-05f,
+	1.146165e-06f,
+	-1.046158e-05f,
+	-4.283517e-07f,
+
+	8.924086e-08f,
+	7.548170e-06f,
+	7.607327e-06f,
+	-6.784313e-05f,
+	-7.783764e-05f,
+	1.616791e-04f,
+	1.957152e-04f,
+	-3.483378e-04f,
+	-4.271591e-04f,
+	6.265714e-04f,
+	7.805799e-04f,
+	-1.074685e-03f,
+	-1.347202e-03f,
+	1.712548e-03f,
+	2.163388e-03f,
+	-2.644404e-03f,
+	-3.354141e-03f,
+	3.927728e-03f,
+	5.003670e-03f,
+	-5.731642e-03f,
+	-7.317770e-03f,
+	8.242143e-03f,
+	1.053814e-02f,
+	-1.191382e-02f,
+	-1.521542e-02f,
+	1.765548e-02f,
+	2.244802e-02f,
+	-2.815513e-02f,
+	-3.534028e-02f,
+	5.424758e-02f,
+	6.504579e-02f,
+	-2.172359e-01f,
+	3.014620e-01f,
+	-3.713711e-02f,
+	-7.063144e-02f,
+	2.387631e-02f,
+	3.676814e-02f,
+	-1.566223e-02f,
+	-2.311573e-02f,
+	1.073542e-02f,
+	1.561067e-02f,
+	-7.460886e-03f,
+	-1.080033e-02f,
+	5.184118e-03f,
+	7.501569e-03f,
+	-3.535502e-03f,
+	-5.135354e-03f,
+	2.363221e-03f,
+	3.448547e-03f,
+	-1.513760e-03f,
+	-2.230130e-03f,
+	9.376340e-04f,
+	1.393214e-03f,
+	-5.353225e-04f,
+	-8.112111e-04f,
+	2.902820e-04f,
+	4.466449e-04f,
+	-1.269564e-04f,
+	-2.073673e-04f,
+	4.908341e-05f,
+	8.413128e-05f,
+	3.224750e-07f,
+	-1.024648e-05f,
+	-3.879887e-07f,
+
+	1.034419e-07f,
+	7.774158e-06f,
+	7.082412e-06f,
+	-6.929850e-05f,
+	-7.587200e-05f,
+	1.658293e-04f,
+	1.909591e-04f,
+	-3.573344e-04f,
+	-4.176330e-04f,
+	6.435417e-04f,
+	7.634449e-04f,
+	-1.104046e-03f,
+	-1.318510e-03f,
+	1.760358e-03f,
+	2.117785e-03f,
+	-2.718802e-03f,
+	-3.284472e-03f,
+	4.039590e-03f,
+	4.900332e-03f,
+	-5.895721e-03f,
+	-7.167494e-03f,
+	8.479375e-03f,
+	1.032140e-02f,
+	-1.225652e-02f,
+	-1.490017e-02f,
+	1.816087e-02f,
+	2.197189e-02f,
+	-2.894900e-02f,
+	-3.454221e-02f,
+	5.573810e-02f,
+	6.316562e-02f,
+	-2.239818e-01f,
+	2.941939e-01f,
+	-3.991422e-02f,
+	-6.941253e-02f,
+	2.498329e-02f,
+	3.613672e-02f,
+	-1.631280e-02f,
+	-2.271733e-02f,
+	1.116381e-02f,
+	1.534140e-02f,
+	-7.754888e-03f,
+	-1.061408e-02f,
+	5.387970e-03f,
+	7.372660e-03f,
+	-3.675851e-03f,
+	-5.047322e-03f,
+	2.458041e-03f,
+	3.389852e-03f,
+	-1.576007e-03f,
+	-2.192285e-03f,
+	9.769488e-04f,
+	1.369870e-03f,
+	-5.589212e-04f,
+	-7.976372e-04f,
+	3.034967e-04f,
+	4.393843e-04f,
+	-1.336300e-04f,
+	-2.039661e-04f,
+	5.190252e-05f,
+	8.289760e-05f,
+	-4.760331e-07f,
+	-1.002860e-05f,
+	-3.504062e-07f,
+
+	1.192309e-07f,
+	8.000933e-06f,
+	6.533264e-06f,
+	-7.074062e-05f,
+	-7.382716e-05f,
+	1.699287e-04f,
+	1.860215e-04f,
+	-3.662082e-04f,
+	-4.077538e-04f,
+	6.602663e-04f,
+	7.456868e-04f,
+	-1.132965e-03f,
+	-1.288788e-03f,
+	1.807429e-03f,
+	2.070562e-03f,
+	-2.792030e-03f,
+	-3.212348e-03f,
+	4.149667e-03f,
+	4.793372e-03f,
+	-6.057158e-03f,
+	-7.011970e-03f,
+	8.712772e-03f,
+	1.009709e-02f,
+	-1.259371e-02f,
+	-1.457387e-02f,
+	1.865827e-02f,
+	2.147881e-02f,
+	-2.973092e-02f,
+	-3.371468e-02f,
+	5.720969e-02f,
+	6.120570e-02f,
+	-2.307815e-01f,
+	2.869667e-01f,
+	-4.260838e-02f,
+	-6.816313e-02f,
+	2.606387e-02f,
+	3.548779e-02f,
+	-1.694875e-02f,
+	-2.230752e-02f,
+	1.158280e-02f,
+	1.506434e-02f,
+	-8.042485e-03f,
+	-1.042242e-02f,
+	5.587381e-03f,
+	7.240019e-03f,
+	-3.813128e-03f,
+	-4.956756e-03f,
+	2.550768e-03f,
+	3.329480e-03f,
+	-1.636864e-03f,
+	-2.153371e-03f,
+	1.015373e-03f,
+	1.345876e-03f,
+	-5.819745e-04f,
+	-7.836927e-04f,
+	3.163976e-04f,
+	4.319315e-04f,
+	-1.401385e-04f,
+	-2.004795e-04f,
+	5.464659e-05f,
+	8.163670e-05f,
+	-1.249338e-06f,
+	-9.808325e-06f,
+	-3.154953e-07f,
+
+	1.367123e-07f,
+	8.228221e-06f,
+	5.959696e-06f,
+	-7.216816e-05f,
+	-7.170325e-05f,
+	1.739738e-04f,
+	1.809034e-04f,
+	-3.749520e-04f,
+	-3.975243e-04f,
+	6.767323e-04f,
+	7.273112e-04f,
+	-1.161422e-03f,
+	-1.258047e-03f,
+	1.853729e-03f,
+	2.021738e-03f,
+	-2.864036e-03f,
+	-3.137797e-03f,
+	4.257882e-03f,
+	4.682835e-03f,
+	-6.215837e-03f,
+	-6.851262e-03f,
+	8.942168e-03f,
+	9.865306e-03f,
+	-1.292513e-02f,
+	-1.423664e-02f,
+	1.914732e-02f,
+	2.096899e-02f,
+	-3.050032e-02f,
+	-3.285789e-02f,
+	5.866121e-02f,
+	5.916557e-02f,
+	-2.376338e-01f,
+	2.797818e-01f,
+	-4.521982e-02f,
+	-6.688440e-02f,
+	2.711764e-02f,
+	3.482187e-02f,
+	-1.756981e-02f,
+	-2.188664e-02f,
+	1.199218e-02f,
+	1.477970e-02f,
+	-8.323538e-03f,
+	-1.022550e-02f,
+	5.782255e-03f,
+	7.103748e-03f,
+	-3.947267e-03f,
+	-4.863725e-03f,
+	2.641358e-03f,
+	3.267479e-03f,
+	-1.696303e-03f,
+	-2.113418e-03f,
+	1.052888e-03f,
+	1.321251e-03f,
+	-6.044725e-04f,
+	-7.693897e-04f,
+	3.289797e-04f,
+	4.242931e-04f,
+	-1.464796e-04f,
+	-1.969111e-04f,
+	5.731492e-05f,
+	8.035003e-05f,
+	-1.997442e-06f,
+	-9.586003e-06f,
+	-2.831467e-07f,
+
+	1.559919e-07f,
+	8.455735e-06f,
+	5.361542e-06f,
+	-7.357976e-05f,
+	-6.950048e-05f,
+	1.779612e-04f,
+	1.756060e-04f,
+	-3.835588e-04f,
+	-3.869476e-04f,
+	6.929271e-04f,
+	7.083245e-04f,
+	-1.189394e-03f,
+	-1.226298e-03f,
+	1.899223e-03f,
+	1.971330e-03f,
+	-2.934766e-03f,
+	-3.060850e-03f,
+	4.364155e-03f,
+	4.568768e-03f,
+	-6.371647e-03f,
+	-6.685439e-03f,
+	9.167400e-03f,
+	9.626147e-03f,
+	-1.325057e-02f,
+	-1.388863e-02f,
+	1.962766e-02f,
+	2.044260e-02f,
+	-3.125661e-02f,
+	-3.197210e-02f,
+	6.009152e-02f,
+	5.704486e-02f,
+	-2.445375e-01f,
+	2.726405e-01f,
+	-4.774874e-02f,
+	-6.557750e-02f,
+	2.814424e-02f,
+	3.413951e-02f,
+	-1.817571e-02f,
+	-2.145501e-02f,
+	1.239177e-02f,
+	1.448771e-02f,
+	-8.597914e-03f,
+	-1.002348e-02f,
+	5.972499e-03f,
+	6.963952e-03f,
+	-4.078206e-03f,
+	-4.768302e-03f,
+	2.729769e-03f,
+	3.203897e-03f,
+	-1.754297e-03f,
+	-2.072460e-03f,
+	1.089480e-03f,
+	1.296017e-03f,
+	-6.264061e-04f,
+	-7.547404e-04f,
+	3.412381e-04f,
+	4.164760e-04f,
+	-1.526513e-04f,
+	-1.932642e-04f,
+	5.990688e-05f,
+	7.903900e-05f,
+	-2.720368e-06f,
+	-9.361989e-06f,
+	-2.532506e-07f,
+
+	1.771769e-07f,
+	8.683179e-06f,
+	4.738651e-06f,
+	-7.497403e-05f,
+	-6.721911e-05f,
+	1.818874e-04f,
+	1.701305e-04f,
+	-3.920216e-04f,
+	-3.760269e-04f,
+	7.088379e-04f,
+	6.887332e-04f,
+	-1.216861e-03f,
+	-1.193554e-03f,
+	1.943877e-03f,
+	1.919361e-03f,
+	-3.004169e-03f,
+	-2.981539e-03f,
+	4.468410e-03f,
+	4.451219e-03f,
+	-6.524474e-03f,
+	-6.514575e-03f,
+	9.388306e-03f,
+	9.379718e-03f,
+	-1.356977e-02f,
+	-1.352998e-02f,
+	2.009894e-02f,
+	1.989986e-02f,
+	-3.199924e-02f,
+	-3.105754e-02f,
+	6.149946e-02f,
+	5.484316e-02f,
+	-2.514913e-01f,
+	2.655441e-01f,
+	-5.019542e-02f,
+	-6.424361e-02f,
+	2.914331e-02f,
+	3.344125e-02f,
+	-1.876618e-02f,
+	-2.101296e-02f,
+	1.278138e-02f,
+	1.418857e-02f,
+	-8.865484e-03f,
+	-9.816503e-03f,
+	6.158023e-03f,
+	6.820736e-03f,
+	-4.205883e-03f,
+	-4.670558e-03f,
+	2.815963e-03f,
+	3.138785e-03f,
+	-1.810821e-03f,
+	-2.030529e-03f,
+	1.125131e-03f,
+	1.270194e-03f,
+	-6.477663e-04f,
+	-7.397571e-04f,
+	3.531683e-04f,
+	4.084871e-04f,
+	-1.586516e-04f,
+	-1.895423e-04f,
+	6.242189e-05f,
+	7.770506e-05f,
+	-3.418163e-06f,
+	-9.136626e-06f,
+	-2.256969e-07f,
+
+	2.003755e-07f,
+	8.910248e-06f,
+	4.090894e-06f,
+	-7.634960e-05f,
+	-6.485945e-05f,
+	1.857489e-04f,
+	1.644786e-04f,
+	-4.003333e-04f,
+	-3.647659e-04f,
+	7.244521e-04f,
+	6.685447e-04f,
+	-1.243801e-03f,
+	-1.159827e-03f,
+	1.987657e-03f,
+	1.865850e-03f,
+	-3.072192e-03f,
+	-2.899898e-03f,
+	4.570569e-03f,
+	4.330239e-03f,
+	-6.674207e-03f,
+	-6.338743e-03f,
+	9.604727e-03f,
+	9.126125e-03f,
+	-1.388251e-02f,
+	-1.316084e-02f,
+	2.056082e-02f,
+	1.934098e-02f,
+	-3.272764e-02f,
+	-3.011452e-02f,
+	6.288388e-02f,
+	5.256012e-02f,
+	-2.584939e-01f,
+	2.584939e-01f,
+	-5.256012e-02f,
+	-6.288388e-02f,
+	3.011452e-02f,
+	3.272764e-02f,
+	-1.934098e-02f,
+	-2.056082e-02f,
+	1.316084e-02f,
+	1.388251e-02f,
+	-9.126125e-03f,
+	-9.604727e-03f,
+	6.338743e-03f,
+	6.674207e-03f,
+	-4.330239e-03f,
+	-4.570569e-03f,
+	2.899898e-03f,
+	3.072192e-03f,
+	-1.865850e-03f,
+	-1.987657e-03f,
+	1.159827e-03f,
+	1.243801e-03f,
+	-6.685447e-04f,
+	-7.244521e-04f,
+	3.647659e-04f,
+	4.003333e-04f,
+	-1.644786e-04f,
+	-1.857489e-04f,
+	6.485945e-05f,
+	7.634960e-05f,
+	-4.090894e-06f,
+	-8.910248e-06f,
+	-2.003755e-07f,
+
+	2.256969e-07f,
+	9.136626e-06f,
+	3.418163e-06f,
+	-7.770506e-05f,
+	-6.242189e-05f,
+	1.895423e-04f,
+	1.586516e-04f,
+	-4.084871e-04f,
+	-3.531683e-04f,
+	7.397571e-04f,
+	6.477663e-04f,
+	-1.270194e-03f,
+	-1.125131e-03f,
+	2.030529e-03f,
+	1.810821e-03f,
+	-3.138785e-03f,
+	-2.815963e-03f,
+	4.670558e-03f,
+	4.205883e-03f,
+	-6.820736e-03f,
+	-6.158023e-03f,
+	9.816503e-03f,
+	8.865484e-03f,
+	-1.418857e-02f,
+	-1.278138e-02f,
+	2.101296e-02f,
+	1.876618e-02f,
+	-3.344125e-02f,
+	-2.914331e-02f,
+	6.424361e-02f,
+	5.019542e-02f,
+	-2.655441e-01f,
+	2.514913e-01f,
+	-5.484316e-02f,
+	-6.149946e-02f,
+	3.105754e-02f,
+	3.199924e-02f,
+	-1.989986e-02f,
+	-2.009894e-02f,
+	1.352998e-02f,
+	1.356977e-02f,
+	-9.379718e-03f,
+	-9.388306e-03f,
+	6.514575e-03f,
+	6.524474e-03f,
+	-4.451219e-03f,
+	-4.468410e-03f,
+	2.981539e-03f,
+	3.004169e-03f,
+	-1.919361e-03f,
+	-1.943877e-03f,
+	1.193554e-03f,
+	1.216861e-03f,
+	-6.887332e-04f,
+	-7.088379e-04f,
+	3.760269e-04f,
+	3.920216e-04f,
+	-1.701305e-04f,
+	-1.818874e-04f,
+	6.721911e-05f,
+	7.497403e-05f,
+	-4.738651e-06f,
+	-8.683179e-06f,
+	-1.771769e-07f,
+
+	2.532506e-07f,
+	9.361989e-06f,
+	2.720368e-06f,
+	-7.903900e-05f,
+	-5.990688e-05f,
+	1.932642e-04f,
+	1.526513e-04f,
+	-4.164760e-04f,
+	-3.412381e-04f,
+	7.547404e-04f,
+	6.264061e-04f,
+	-1.296017e-03f,
+	-1.089480e-03f,
+	2.072460e-03f,
+	1.754297e-03f,
+	-3.203897e-03f,
+	-2.729769e-03f,
+	4.768302e-03f,
+	4.078206e-03f,
+	-6.963952e-03f,
+	-5.972499e-03f,
+	1.002348e-02f,
+	8.597914e-03f,
+	-1.448771e-02f,
+	-1.239177e-02f,
+	2.145501e-02f,
+	1.817571e-02f,
+	-3.413951e-02f,
+	-2.814424e-02f,
+	6.557750e-02f,
+	4.774874e-02f,
+	-2.726405e-01f,
+	2.445375e-01f,
+	-5.704486e-02f,
+	-6.009152e-02f,
+	3.197210e-02f,
+	3.125661e-02f,
+	-2.044260e-02f,
+	-1.962766e-02f,
+	1.388863e-02f,
+	1.325057e-02f,
+	-9.626147e-03f,
+	-9.167400e-03f,
+	6.685439e-03f,
+	6.371647e-03f,
+	-4.568768e-03f,
+	-4.364155e-03f,
+	3.060850e-03f,
+	2.934766e-03f,
+	-1.971330e-03f,
+	-1.899223e-03f,
+	1.226298e-03f,
+	1.189394e-03f,
+	-7.083245e-04f,
+	-6.929271e-04f,
+	3.869476e-04f,
+	3.835588e-04f,
+	-1.756060e-04f,
+	-1.779612e-04f,
+	6.950048e-05f,
+	7.357976e-05f,
+	-5.361542e-06f,
+	-8.455735e-06f,
+	-1.559919e-07f,
+
+	2.831467e-07f,
+	9.586003e-06f,
+	1.997442e-06f,
+	-8.035003e-05f,
+	-5.731492e-05f,
+	1.969111e-04f,
+	1.464796e-04f,
+	-4.242931e-04f,
+	-3.289797e-04f,
+	7.693897e-04f,
+	6.044725e-04f,
+	-1.321251e-03f,
+	-1.052888e-03f,
+	2.113418e-03f,
+	1.696303e-03f,
+	-3.267479e-03f,
+	-2.641358e-03f,
+	4.863725e-03f,
+	3.947267e-03f,
+	-7.103748e-03f,
+	-5.782255e-03f,
+	1.022550e-02f,
+	8.323538e-03f,
+	-1.477970e-02f,
+	-1.199218e-02f,
+	2.188664e-02f,
+	1.756981e-02f,
+	-3.482187e-02f,
+	-2.711764e-02f,
+	6.688440e-02f,
+	4.521982e-02f,
+	-2.797818e-01f,
+	2.376338e-01f,
+	-5.916557e-02f,
+	-5.866121e-02f,
+	3.285789e-02f,
+	3.050032e-02f,
+	-2.096899e-02f,
+	-1.914732e-02f,
+	1.423664e-02f,
+	1.292513e-02f,
+	-9.865306e-03f,
+	-8.942168e-03f,
+	6.851262e-03f,
+	6.215837e-03f,
+	-4.682835e-03f,
+	-4.257882e-03f,
+	3.137797e-03f,
+	2.864036e-03f,
+	-2.021738e-03f,
+	-1.853729e-03f,
+	1.258047e-03f,
+	1.161422e-03f,
+	-7.273112e-04f,
+	-6.767323e-04f,
+	3.975243e-04f,
+	3.749520e-04f,
+	-1.809034e-04f,
+	-1.739738e-04f,
+	7.170325e-05f,
+	7.216816e-05f,
+	-5.959696e-06f,
+	-8.228221e-06f,
+	-1.367123e-07f,
+
+	3.154953e-07f,
+	9.808325e-06f,
+	1.249338e-06f,
+	-8.163670e-05f,
+	-5.464659e-05f,
+	2.004795e-04f,
+	1.401385e-04f,
+	-4.319315e-04f,
+	-3.163976e-04f,
+	7.836927e-04f,
+	5.819745e-04f,
+	-1.345876e-03f,
+	-1.015373e-03f,
+	2.153371e-03f,
+	1.636864e-03f,
+	-3.329480e-03f,
+	-2.550768e-03f,
+	4.956756e-03f,
+	3.813128e-03f,
+	-7.240019e-03f,
+	-5.587381e-03f,
+	1.042242e-02f,
+	8.042485e-03f,
+	-1.506434e-02f,
+	-1.158280e-02f,
+	2.230752e-02f,
+	1.694875e-02f,
+	-3.548779e-02f,
+	-2.606387e-02f,
+	6.816313e-02f,
+	4.260838e-02f,
+	-2.869667e-01f,
+	2.307815e-01f,
+	-6.120570e-02f,
+	-5.720969e-02f,
+	3.371468e-02f,
+	2.973092e-02f,
+	-2.147881e-02f,
+	-1.865827e-02f,
+	1.457387e-02f,
+	1.259371e-02f,
+	-1.009709e-02f,
+	-8.712772e-03f,
+	7.011970e-03f,
+	6.057158e-03f,
+	-4.793372e-03f,
+	-4.149667e-03f,
+	3.212348e-03f,
+	2.792030e-03f,
+	-2.070562e-03f,
+	-1.807429e-03f,
+	1.288788e-03f,
+	1.132965e-03f,
+	-7.456868e-04f,
+	-6.602663e-04f,
+	4.077538e-04f,
+	3.662082e-04f,
+	-1.860215e-04f,
+	-1.699287e-04f,
+	7.382716e-05f,
+	7.074062e-05f,
+	-6.533264e-06f,
+	-8.000933e-06f,
+	-1.192309e-07f,
+
+	3.504062e-07f,
+	1.002860e-05f,
+	4.760331e-07f,
+	-8.289760e-05f,
+	-5.190252e-05f,
+	2.039661e-04f,
+	1.336300e-04f,
+	-4.393843e-04f,
+	-3.034967e-04f,
+	7.976372e-04f,
+	5.589212e-04f,
+	-1.369870e-03f,
+	-9.769488e-04f,
+	2.192285e-03f,
+	1.576007e-03f,
+	-3.389852e-03f,
+	-2.458041e-03f,
+	5.047322e-03f,
+	3.675851e-03f,
+	-7.372660e-03f,
+	-5.387970e-03f,
+	1.061408e-02f,
+	7.754888e-03f,
+	-1.534140e-02f,
+	-1.116381e-02f,
+	2.271733e-02f,
+	1.631280e-02f,
+	-3.613672e-02f,
+	-2.498329e-02f,
+	6.941253e-02f,
+	3.991422e-02f,
+	-2.941939e-01f,
+	2.239818e-01f,
+	-6.316562e-02f,
+	-5.573810e-02f,
+	3.454221e-02f,
+	2.894900e-02f,
+	-2.197189e-02f,
+	-1.816087e-02f,
+	1.490017e-02f,
+	1.225652e-02f,
+	-1.032140e-02f,
+	-8.479375e-03f,
+	7.167494e-03f,
+	5.895721e-03f,
+	-4.900332e-03f,
+	-4.039590e-03f,
+	3.284472e-03f,
+	2.718802e-03f,
+	-2.117785e-03f,
+	-1.760358e-03f,
+	1.318510e-03f,
+	1.104046e-03f,
+	-7.634449e-04f,
+	-6.435417e-04f,
+	4.176330e-04f,
+	3.573344e-04f,
+	-1.909591e-04f,
+	-1.658293e-04f,
+	7.587200e-05f,
+	6.929850e-05f,
+	-7.082412e-06f,
+	-7.774158e-06f,
+	-1.034419e-07f,
+
+	3.879887e-07f,
+	1.024648e-05f,
+	-3.224750e-07f,
+	-8.413128e-05f,
+	-4.908341e-05f,
+	2.073673e-04f,
+	1.269564e-04f,
+	-4.466449e-04f,
+	-2.902820e-04f,
+	8.112111e-04f,
+	5.353225e-04f,
+	-1.393214e-03f,
+	-9.376340e-04f,
+	2.230130e-03f,
+	1.513760e-03f,
+	-3.448547e-03f,
+	-2.363221e-03f,
+	5.135354e-03f,
+	3.535502e-03f,
+	-7.501569e-03f,
+	-5.184118e-03f,
+	1.080033e-02f,
+	7.460886e-03f,
+	-1.561067e-02f,
+	-1.073542e-02f,
+	2.311573e-02f,
+	1.566223e-02f,
+	-3.676814e-02f,
+	-2.387631e-02f,
+	7.063144e-02f,
+	3.713711e-02f,
+	-3.014620e-01f,
+	2.172359e-01f,
+	-6.504579e-02f,
+	-5.424758e-02f,
+	3.534028e-02f,
+	2.815513e-02f,
+	-2.244802e-02f,
+	-1.765548e-02f,
+	1.521542e-02f,
+	1.191382e-02f,
+	-1.053814e-02f,
+	-8.242143e-03f,
+	7.317770e-03f,
+	5.731642e-03f,
+	-5.003670e-03f,
+	-3.927728e-03f,
+	3.354141e-03f,
+	2.644404e-03f,
+	-2.163388e-03f,
+	-1.712548e-03f,
+	1.347202e-03f,
+	1.074685e-03f,
+	-7.805799e-04f,
+	-6.265714e-04f,
+	4.271591e-04f,
+	3.483378e-04f,
+	-1.957152e-04f,
+	-1.616791e-04f,
+	7.783764e-05f,
+	6.784313e-05f,
+	-7.607327e-06f,
+	-7.548170e-06f,
+	-8.924086e-08f,
+
+	4.283517e-07f,
+	1.046158e-05f,
+	-1.146165e-06f,
+	-8.533631e-05f,
+	-4.619003e-05f,
+	2.106797e-04f,
+	1.201201e-04f,
+	-4.537066e-04f,
+	-2.767589e-04f,
+	8.244025e-04f,
+	5.111885e-04f,
+	-1.415887e-03f,
+	-8.974457e-04f,
+	2.266874e-03f,
+	1.450153e-03f,
+	-3.505518e-03f,
+	-2.266354e-03f,
+	5.220780e-03f,
+	3.392148e-03f,
+	-7.626644e-03f,
+	-4.975925e-03f,
+	1.098104e-02f,
+	7.160622e-03f,
+	-1.587194e-02f,
+	-1.029782e-02f,
+	2.350241e-02f,
+	1.499735e-02f,
+	-3.738150e-02f,
+	-2.274333e-02f,
+	7.181870e-02f,
+	3.427690e-02f,
+	-3.087695e-01f,
+	2.105450e-01f,
+	-6.684665e-02f,
+	-5.273928e-02f,
+	3.610867e-02f,
+	2.734987e-02f,
+	-2.290705e-02f,
+	-1.714244e-02f,
+	1.551948e-02f,
+	1.156583e-02f,
+	-1.074723e-02f,
+	-8.001243e-03f,
+	7.462736e-03f,
+	5.565036e-03f,
+	-5.103346e-03f,
+	-3.814161e-03f,
+	3.421328e-03f,
+	2.568889e-03f,
+	-2.207355e-03f,
+	-1.664037e-03f,
+	1.374855e-03f,
+	1.044905e-03f,
+	-7.970862e-04f,
+	-6.093684e-04f,
+	4.363297e-04f,
+	3.392252e-04f,
+	-2.002889e-04f,
+	-1.574814e-04f,
+	7.972400e-05f,
+	6.637586e-05f,
+	-8.108213e-06f,
+	-7.323236e-06f,
+	-7.652523e-08f,
+
+	4.716029e-07f,
+	1.067352e-05f,
+	-1.994992e-06f,
+	-8.651124e-05f,
+	-4.322320e-05f,
+	2.139001e-04f,
+	1.131236e-04f,
+	-4.605626e-04f,
+	-2.629329e-04f,
+	8.371997e-04f,
+	4.865298e-04f,
+	-1.437872e-03f,
+	-8.564024e-04f,
+	2.302487e-03f,
+	1.385214e-03f,
+	-3.560719e-03f,
+	-2.167486e-03f,
+	5.303532e-03f,
+	3.245861e-03f,
+	-7.747788e-03f,
+	-4.763493e-03f,
+	1.115606e-02f,
+	6.854243e-03f,
+	-1.612500e-02f,
+	-9.851237e-03f,
+	2.387707e-02f,
+	1.431845e-02f,
+	-3.797629e-02f,
+	-2.158479e-02f,
+	7.297315e-02f,
+	3.133343e-02f,
+	-3.161151e-01f,
+	2.039103e-01f,
+	-6.856868e-02f,
+	-5.121433e-02f,
+	3.684720e-02f,
+	2.653382e-02f,
+	-2.334881e-02f,
+	-1.662212e-02f,
+	1.581224e-02f,
+	1.121281e-02f,
+	-1.094857e-02f,
+	-7.756839e-03f,
+	7.602335e-03f,
+	5.396020e-03f,
+	-5.199320e-03f,
+	-3.698969e-03f,
+	3.486007e-03f,
+	2.492311e-03f,
+	-2.249669e-03f,
+	-1.614857e-03f,
+	1.401460e-03f,
+	1.014728e-03f,
+	-8.129591e-04f,
+	-5.919453e-04f,
+	4.451424e-04f,
+	3.300038e-04f,
+	-2.046794e-04f,
+	-1.532398e-04f,
+	8.153105e-05f,
+	6.489802e-05f,
+	-8.585293e-06f,
+	-7.099612e-06f,
+	-6.519441e-08f,
+
+	5.178485e-07f,
+	1.088193e-05f,
+	-2.868888e-06f,
+	-8.765463e-05f,
+	-4.018383e-05f,
+	2.170249e-04f,
+	1.059697e-04f,
+	-4.672063e-04f,
+	-2.488098e-04f,
+	8.495909e-04f,
+	4.613575e-04f,
+	-1.459148e-03f,
+	-8.145233e-04f,
+	2.336938e-03f,
+	1.318976e-03f,
+	-3.614103e-03f,
+	-2.066665e-03f,
+	5.383543e-03f,
+	3.096711e-03f,
+	-7.864901e-03f,
+	-4.546927e-03f,
+	1.132524e-02f,
+	6.541901e-03f,
+	-1.636964e-02f,
+	-9.395880e-03f,
+	2.423938e-02f,
+	1.362585e-02f,
+	-3.855198e-02f,
+	-2.040112e-02f,
+	7.409363e-02f,
+	2.830658e-02f,
+	-3.234974e-01f,
+	1.973329e-01f,
+	-7.021239e-02f,
+	-4.967387e-02f,
+	3.755572e-02f,
+	2.570755e-02f,
+	-2.377315e-02f,
+	-1.609489e-02f,
+	1.609359e-02f,
+	1.085499e-02f,
+	-1.114210e-02f,
+	-7.509103e-03f,
+	7.736512e-03f,
+	5.224710e-03f,
+	-5.291556e-03f,
+	-3.582232e-03f,
+	3.548155e-03f,
+	2.414724e-03f,
+	-2.290315e-03f,
+	-1.565045e-03f,
+	1.427007e-03f,
+	9.841748e-04f,
+	-8.281940e-04f,
+	-5.743153e-04f,
+	4.535952e-04f,
+	3.206806e-04f,
+	-2.088862e-04f,
+	-1.489576e-04f,
+	8.325883e-05f,
+	6.341089e-05f,
+	-9.038803e-06f,
+	-6.877543e-06f,
+	-5.514998e-08f,
+
+	5.671938e-07f,
+	1.108642e-05f,
+	-3.767761e-06f,
+	-8.876503e-05f,
+	-3.707287e-05f,
+	2.200510e-04f,
+	9.866095e-05f,
+	-4.736313e-04f,
+	-2.343957e-04f,
+	8.615648e-04f,
+	4.356829e-04f,
+	-1.479696e-03f,
+	-7.718279e-04f,
+	2.370198e-03f,
+	1.251470e-03f,
+	-3.665625e-03f,
+	-1.963941e-03f,
+	5.460748e-03f,
+	2.944775e-03f,
+	-7.977889e-03f,
+	-4.326337e-03f,
+	1.148846e-02f,
+	6.223754e-03f,
+	-1.660568e-02f,
+	-8.931975e-03f,
+	2.458906e-02f,
+	1.291987e-02f,
+	-3.910808e-02f,
+	-1.919281e-02f,
+	7.517898e-02f,
+	2.519625e-02f,
+	-3.309150e-01f,
+	1.908139e-01f,
+	-7.177830e-02f,
+	-4.811901e-02f,
+	3.823407e-02f,
+	2.487163e-02f,
+	-2.417995e-02f,
+	-1.556110e-02f,
+	1.636343e-02f,
+	1.049263e-02f,
+	-1.132774e-02f,
+	-7.258204e-03f,
+	7.865216e-03f,
+	5.051225e-03f,
+	-5.380020e-03f,
+	-3.464032e-03f,
+	3.607749e-03f,
+	2.336183e-03f,
+	-2.329282e-03f,
+	-1.514636e-03f,
+	1.451489e-03f,
+	9.532680e-04f,
+	-8.427870e-04f,
+	-5.564911e-04f,
+	4.616864e-04f,
+	3.112627e-04f,
+	-2.129085e-04f,
+	-1.446381e-04f,
+	8.490744e-05f,
+	6.191577e-05f,
+	-9.468999e-06f,
+	-6.657266e-06f,
+	-4.629594e-08f,
+
+	6.197415e-07f,
+	1.128657e-05f,
+	-4.691494e-06f,
+	-8.984100e-05f,
+	-3.389135e-05f,
+	2.229748e-04f,
+	9.120048e-05f,
+	-4.798311e-04f,
+	-2.196970e-04f,
+	8.731099e-04f,
+	4.095178e-04f,
+	-1.499498e-03f,
+	-7.283367e-04f,
+	2.402238e-03f,
+	1.182729e-03f,
+	-3.715243e-03f,
+	-1.859365e-03f,
+	5.535081e-03f,
+	2.790128e-03f,
+	-8.086659e-03f,
+	-4.101836e-03f,
+	1.164557e-02f,
+	5.899962e-03f,
+	-1.683291e-02f,
+	-8.459752e-03f,
+	2.492579e-02f,
+	1.220086e-02f,
+	-3.964407e-02f,
+	-1.796034e-02f,
+	7.622804e-02f,
+	2.200239e-02f,
+	-3.383664e-01f,
+	1.843545e-01f,
+	-7.326695e-02f,
+	-4.655087e-02f,
+	3.888213e-02f,
+	2.402666e-02f,
+	-2.456907e-02f,
+	-1.502112e-02f,
+	1.662166e-02f,
+	1.012597e-02f,
+	-1.150541e-02f,
+	-7.004312e-03f,
+	7.988400e-03f,
+	4.875683e-03f,
+	-5.464680e-03f,
+	-3.344449e-03f,
+	3.664770e-03f,
+	2.256742e-03f,
+	-2.366555e-03f,
+	-1.463665e-03f,
+	1.474899e-03f,
+	9.220295e-04f,
+	-8.567343e-04f,
+	-5.384857e-04f,
+	4.694144e-04f,
+	3.017570e-04f,
+	-2.167462e-04f,
+	-1.402849e-04f,
+	8.647702e-05f,
+	6.041392e-05f,
+	-9.876153e-06f,
+	-6.439003e-06f,
+	-3.853889e-08f,
+
+	6.755927e-07f,
+	1.148198e-05f,
+	-5.639944e-06f,
+	-9.088108e-05f,
+	-3.064037e-05f,
+	2.257931e-04f,
+	8.359129e-05f,
+	-4.857994e-04f,
+	-2.047201e-04f,
+	8.842152e-04f,
+	3.828747e-04f,
+	-1.518535e-03f,
+	-6.840709e-04f,
+	2.433028e-03f,
+	1.112787e-03f,
+	-3.762911e-03f,
+	-1.752989e-03f,
+	5.606479e-03f,
+	2.632849e-03f,
+	-8.191120e-03f,
+	-3.873536e-03f,
+	1.179645e-02f,
+	5.570691e-03f,
+	-1.705115e-02f,
+	-7.979451e-03f,
+	2.524931e-02f,
+	1.146915e-02f,
+	-4.015947e-02f,
+	-1.670421e-02f,
+	7.723967e-02f,
+	1.872494e-02f,
+	-3.458501e-01f,
+	1.779558e-01f,
+	-7.467894e-02f,
+	-4.497058e-02f,
+	3.949978e-02f,
+	2.317322e-02f,
+	-2.494040e-02f,
+	-1.447532e-02f,
+	1.686820e-02f,
+	9.755248e-03f,
+	-1.167507e-02f,
+	-6.747600e-03f,
+	8.106020e-03f,
+	4.698203e-03f,
+	-5.545507e-03f,
+	-3.223565e-03f,
+	3.719199e-03f,
+	2.176455e-03f,
+	-2.402125e-03f,
+	-1.412168e-03f,
+	1.497231e-03f,
+	8.904815e-04f,
+	-8.700329e-04f,
+	-5.203121e-04f,
+	4.767779e-04f,
+	2.921706e-04f,
+	-2.203989e-04f,
+	-1.359011e-04f,
+	8.796778e-05f,
+	5.890660e-05f,
+	-1.026055e-05f,
+	-6.222972e-06f,
+	-3.178818e-08f,
+
+	7.348461e-07f,
+	1.167224e-05f,
+	-6.612944e-06f,
+	-9.188385e-05f,
+	-2.732108e-05f,
+	2.285027e-04f,
+	7.583659e-05f,
+	-4.915298e-04f,
+	-1.894720e-04f,
+	8.948696e-04f,
+	3.557660e-04f,
+	-1.536790e-03f,
+	-6.390518e-04f,
+	2.462541e-03f,
+	1.041680e-03f,
+	-3.808589e-03f,
+	-1.644869e-03f,
+	5.674880e-03f,
+	2.473020e-03f,
+	-8.291181e-03f,
+	-3.641558e-03f,
+	1.194097e-02f,
+	5.236111e-03f,
+	-1.726020e-02f,
+	-7.491314e-03f,
+	2.555931e-02f,
+	1.072509e-02f,
+	-4.065378e-02f,
+	-1.542494e-02f,
+	7.821271e-02f,
+	1.536390e-02f,
+	-3.533648e-01f,
+	1.716188e-01f,
+	-7.601482e-02f,
+	-4.337922e-02f,
+	4.008695e-02f,
+	2.231189e-02f,
+	-2.529383e-02f,
+	-1.392407e-02f,
+	1.710296e-02f,
+	9.380726e-03f,
+	-1.183665e-02f,
+	-6.488239e-03f,
+	8.218039e-03f,
+	4.518906e-03f,
+	-5.622474e-03f,
+	-3.101462e-03f,
+	3.771018e-03f,
+	2.095377e-03f,
+	-2.435980e-03f,
+	-1.360180e-03f,
+	1.518479e-03f,
+	8.586458e-04f,
+	-8.826801e-04f,
+	-5.019831e-04f,
+	4.837760e-04f,
+	2.825104e-04f,
+	-2.238665e-04f,
+	-1.314901e-04f,
+	8.937996e-05f,
+	5.739505e-05f,
+	-1.062249e-05f,
+	-6.009376e-06f,
+	-2.595619e-08f,
+
+	7.975977e-07f,
+	1.185692e-05f,
+	-7.610302e-06f,
+	-9.284785e-05f,
+	-2.393471e-05f,
+	2.311003e-04f,
+	6.793972e-05f,
+	-4.970162e-04f,
+	-1.739595e-04f,
+	9.050624e-04f,
+	3.282049e-04f,
+	-1.554244e-03f,
+	-5.933021e-04f,
+	2.490750e-03f,
+	9.694429e-04f,
+	-3.852235e-03f,
+	-1.535059e-03f,
+	5.740224e-03f,
+	2.310722e-03f,
+	-8.386756e-03f,
+	-3.406021e-03f,
+	1.207901e-02f,
+	4.896395e-03f,
+	-1.745988e-02f,
+	-6.995592e-03f,
+	2.585552e-02f,
+	9.969062e-03f,
+	-4.112652e-02f,
+	-1.412309e-02f,
+	7.914601e-02f,
+	1.191928e-02f,
+	-3.609088e-01f,
+	1.653445e-01f,
+	-7.727525e-02f,
+	-4.177790e-02f,
+	4.064357e-02f,
+	2.144325e-02f,
+	-2.562928e-02f,
+	-1.336774e-02f,
+	1.732588e-02f,
+	9.002650e-03f,
+	-1.199009e-02f,
+	-6.226403e-03f,
+	8.324418e-03f,
+	4.337909e-03f,
+	-5.695560e-03f,
+	-2.978222e-03f,
+	3.820214e-03f,
+	2.013564e-03f,
+	-2.468112e-03f,
+	-1.307736e-03f,
+	1.538638e-03f,
+	8.265445e-04f,
+	-8.946734e-04f,
+	-4.835117e-04f,
+	4.904078e-04f,
+	2.727835e-04f,
+	-2.271490e-04f,
+	-1.270553e-04f,
+	9.071388e-05f,
+	5.588046e-05f,
+	-1.096228e-05f,
+	-5.798408e-06f,
+	-2.095841e-08f,
+
+	8.639404e-07f,
+	1.203560e-05f,
+	-8.631799e-06f,
+	-9.377165e-05f,
+	-2.048255e-05f,
+	2.335827e-04f,
+	5.990415e-05f,
+	-5.022524e-04f,
+	-1.581901e-04f,
+	9.147830e-04f,
+	3.002048e-04f,
+	-1.570882e-03f,
+	-5.468446e-04f,
+	2.517628e-03f,
+	8.961132e-04f,
+	-3.893809e-03f,
+	-1.423617e-03f,
+	5.802452e-03f,
+	2.146042e-03f,
+	-8.477761e-03f,
+	-3.167050e-03f,
+	1.221044e-02f,
+	4.551723e-03f,
+	-1.765003e-02f,
+	-6.492540e-03f,
+	2.613767e-02f,
+	9.201433e-03f,
+	-4.157723e-02f,
+	-1.279922e-02f,
+	8.003844e-02f,
+	8.391121e-03f,
+	-3.684808e-01f,
+	1.591341e-01f,
+	-7.846085e-02f,
+	-4.016770e-02f,
+	4.116957e-02f,
+	2.056789e-02f,
+	-2.594667e-02f,
+	-1.280669e-02f,
+	1.753689e-02f,
+	8.621270e-03f,
+	-1.213536e-02f,
+	-5.962266e-03f,
+	8.425127e-03f,
+	4.155335e-03f,
+	-5.764740e-03f,
+	-2.853928e-03f,
+	3.866772e-03f,
+	1.931070e-03f,
+	-2.498513e-03f,
+	-1.254873e-03f,
+	1.557705e-03f,
+	7.941998e-04f,
+	-9.060111e-04f,
+	-4.649107e-04f,
+	4.966727e-04f,
+	2.629966e-04f,
+	-2.302465e-04f,
+	-1.225999e-04f,
+	9.196991e-05f,
+	5.436403e-05f,
+	-1.128026e-05f,
+	-5.590254e-06f,
+	-1.671367e-08f,
+
+	9.339640e-07f,
+	1.220785e-05f,
+	-9.677190e-06f,
+	-9.465383e-05f,
+	-1.696597e-05f,
+	2.359468e-04f,
+	5.173348e-05f,
+	-5.072326e-04f,
+	-1.421713e-04f,
+	9.240211e-04f,
+	2.717797e-04f,
+	-1.586685e-03f,
+	-4.997029e-04f,
+	2.543147e-03f,
+	8.217287e-04f,
+	-3.933271e-03f,
+	-1.310601e-03f,
+	5.861507e-03f,
+	1.979066e-03f,
+	-8.564113e-03f,
+	-2.924772e-03f,
+	1.233514e-02f,
+	4.202275e-03f,
+	-1.783046e-02f,
+	-5.982422e-03f,
+	2.640550e-02f,
+	8.422586e-03f,
+	-4.200545e-02f,
+	-1.145390e-02f,
+	8.088887e-02f,
+	4.779501e-03f,
+	-3.760793e-01f,
+	1.529884e-01f,
+	-7.957227e-02f,
+	-3.854972e-02f,
+	4.166492e-02f,
+	1.968638e-02f,
+	-2.624592e-02f,
+	-1.224130e-02f,
+	1.773593e-02f,
+	8.236837e-03f,
+	-1.227241e-02f,
+	-5.696000e-03f,
+	8.520135e-03f,
+	3.971304e-03f,
+	-5.829996e-03f,
+	-2.728662e-03f,
+	3.910680e-03f,
+	1.847951e-03f,
+	-2.527177e-03f,
+	-1.201626e-03f,
+	1.575675e-03f,
+	7.616336e-04f,
+	-9.166919e-04f,
+	-4.461930e-04f,
+	5.025706e-04f,
+	2.531568e-04f,
+	-2.331593e-04f,
+	-1.181271e-04f,
+	9.314845e-05f,
+	5.284693e-05f,
+	-1.157676e-05f,
+	-5.385086e-06f,
+	-1.314426e-08f,
+
+	1.007755e-06f,
+	1.237322e-05f,
+	-1.074620e-05f,
+	-9.549297e-05f,
+	-1.338637e-05f,
+	2.381893e-04f,
+	4.343146e-05f,
+	-5.119508e-04f,
+	-1.259107e-04f,
+	9.327664e-04f,
+	2.429437e-04f,
+	-1.601637e-03f,
+	-4.519011e-04f,
+	2.567284e-03f,
+	7.463280e-04f,
+	-3.970584e-03f,
+	-1.196070e-03f,
+	5.917332e-03f,
+	1.809883e-03f,
+	-8.645731e-03f,
+	-2.679315e-03f,
+	1.245300e-02f,
+	3.848239e-03f,
+	-1.800100e-02f,
+	-5.465506e-03f,
+	2.665874e-02f,
+	7.632918e-03f,
+	-4.241072e-02f,
+	-1.008773e-02f,
+	8.169615e-02f,
+	1.084513e-03f,
+	-3.837027e-01f,
+	1.469086e-01f,
+	-8.061020e-02f,
+	-3.692501e-02f,
+	4.212961e-02f,
+	1.879932e-02f,
+	-2.652698e-02f,
+	-1.167194e-02f,
+	1.792295e-02f,
+	7.849602e-03f,
+	-1.240120e-02f,
+	-5.427781e-03f,
+	8.609417e-03f,
+	3.785936e-03f,
+	-5.891313e-03f,
+	-2.602506e-03f,
+	3.951930e-03f,
+	1.764262e-03f,
+	-2.554097e-03f,
+	-1.148030e-03f,
+	1.592546e-03f,
+	7.288678e-04f,
+	-9.267146e-04f,
+	-4.273714e-04f,
+	5.081012e-04f,
+	2.432708e-04f,
+	-2.358877e-04f,
+	-1.136401e-04f,
+	9.424997e-05f,
+	5.133032e-05f,
+	-1.185214e-05f,
+	-5.183068e-06f,
+	-1.017613e-08f,
+
+	1.085395e-06f,
+	1.253127e-05f,
+	-1.183854e-05f,
+	-9.628764e-05f,
+	-9.745263e-06f,
+	2.403073e-04f,
+	3.500193e-05f,
+	-5.164011e-04f,
+	-1.094164e-04f,
+	9.410091e-04f,
+	2.137114e-04f,
+	-1.615723e-03f,
+	-4.034640e-04f,
+	2.590013e-03f,
+	6.699510e-04f,
+	-4.005710e-03f,
+	-1.080085e-03f,
+	5.969875e-03f,
+	1.638583e-03f,
+	-8.722538e-03f,
+	-2.430812e-03f,
+	1.256390e-02f,
+	3.489804e-03f,
+	-1.816150e-02f,
+	-4.942064e-03f,
+	2.689715e-02f,
+	6.832832e-03f,
+	-4.279261e-02f,
+	-8.701334e-03f,
+	8.245917e-02f,
+	-2.693716e-03f,
+	-3.913495e-01f,
+	1.408954e-01f,
+	-8.157534e-02f,
+	-3.529465e-02f,
+	4.256363e-02f,
+	1.790729e-02f,
+	-2.678981e-02f,
+	-1.109898e-02f,
+	1.809791e-02f,
+	7.459818e-03f,
+	-1.252171e-02f,
+	-5.157783e-03f,
+	8.692953e-03f,
+	3.599353e-03f,
+	-5.948677e-03f,
+	-2.475544e-03f,
+	3.990512e-03f,
+	1.680057e-03f,
+	-2.579269e-03f,
+	-1.094122e-03f,
+	1.608316e-03f,
+	6.959246e-04f,
+	-9.360786e-04f,
+	-4.084586e-04f,
+	5.132649e-04f,
+	2.333456e-04f,
+	-2.384322e-04f,
+	-1.091422e-04f,
+	9.527498e-05f,
+	4.981532e-05f,
+	-1.210676e-05f,
+	-4.984352e-06f,
+	-7.738988e-09f,
+
+	1.166964e-06f,
+	1.268155e-05f,
+	-1.295388e-05f,
+	-9.703644e-05f,
+	-6.044195e-06f,
+	2.422977e-04f,
+	2.644888e-05f,
+	-5.205780e-04f,
+	-9.269662e-05f,
+	9.487395e-04f,
+	1.840978e-04f,
+	-1.628926e-03f,
+	-3.544170e-04f,
+	2.611310e-03f,
+	5.926382e-04f,
+	-4.038613e-03f,
+	-9.627098e-04f,
+	6.019081e-03f,
+	1.465261e-03f,
+	-8.794460e-03f,
+	-2.179398e-03f,
+	1.266775e-02f,
+	3.127165e-03f,
+	-1.831180e-02f,
+	-4.412378e-03f,
+	2.712047e-02f,
+	6.022739e-03f,
+	-4.315068e-02f,
+	-7.295340e-03f,
+	8.317681e-02f,
+	-6.555033e-03f,
+	-3.990182e-01f,
+	1.349499e-01f,
+	-8.246841e-02f,
+	-3.365967e-02f,
+	4.296701e-02f,
+	1.701085e-02f,
+	-2.703437e-02f,
+	-1.052278e-02f,
+	1.826079e-02f,
+	7.067735e-03f,
+	-1.263390e-02f,
+	-4.886180e-03f,
+	8.770725e-03f,
+	3.411675e-03f,
+	-6.002075e-03f,
+	-2.347858e-03f,
+	4.026420e-03f,
+	1.595393e-03f,
+	-2.602690e-03f,
+	-1.039936e-03f,
+	1.622984e-03f,
+	6.628255e-04f,
+	-9.447839e-04f,
+	-3.894673e-04f,
+	5.180619e-04f,
+	2.233877e-04f,
+	-2.407934e-04f,
+	-1.046364e-04f,
+	9.622403e-05f,
+	4.830303e-05f,
+	-1.234099e-05f,
+	-4.789083e-06f,
+	-5.766461e-09f,
+
+	1.252535e-06f,
+	1.282361e-05f,
+	-1.409187e-05f,
+	-9.773799e-05f,
+	-2.284789e-06f,
+	2.441576e-04f,
+	1.777646e-05f,
+	-5.244759e-04f,
+	-7.575971e-05f,
+	9.559481e-04f,
+	1.541183e-04f,
+	-1.641232e-03f,
+	-3.047860e-04f,
+	2.631151e-03f,
+	5.144310e-04f,
+	-4.069258e-03f,
+	-8.440064e-04f,
+	6.064902e-03f,
+	1.290008e-03f,
+	-8.861423e-03f,
+	-1.925210e-03f,
+	1.276443e-02f,
+	2.760518e-03f,
+	-1.845174e-02f,
+	-3.876732e-03f,
+	2.732849e-02f,
+	5.203062e-03f,
+	-4.348450e-02f,
+	-5.870403e-03f,
+	8.384795e-02f,
+	-1.049926e-02f,
+	-4.067073e-01f,
+	1.290729e-01f,
+	-8.329016e-02f,
+	-3.202114e-02f,
+	4.333979e-02f,
+	1.611060e-02f,
+	-2.726063e-02f,
+	-9.943729e-03f,
+	1.841154e-02f,
+	6.673606e-03f,
+	-1.273775e-02f,
+	-4.613147e-03f,
+	8.842717e-03f,
+	3.223024e-03f,
+	-6.051499e-03f,
+	-2.219530e-03f,
+	4.059650e-03f,
+	1.510323e-03f,
+	-2.624358e-03f,
+	-9.855082e-04f,
+	1.636549e-03f,
+	6.295926e-04f,
+	-9.528307e-04f,
+	-3.704102e-04f,
+	5.224930e-04f,
+	2.134040e-04f,
+	-2.429720e-04f,
+	-1.001258e-04f,
+	9.709774e-05f,
+	4.679453e-05f,
+	-1.255523e-05f,
+	-4.597392e-06f,
+	-4.196216e-09f,
+
+	1.342178e-06f,
+	1.295700e-05f,
+	-1.525212e-05f,
+	-9.839090e-05f,
+	1.531269e-06f,
+	2.458839e-04f,
+	8.988884e-06f,
+	-5.280895e-04f,
+	-5.861437e-05f,
+	9.626257e-04f,
+	1.237886e-04f,
+	-1.652626e-03f,
+	-2.545974e-04f,
+	2.649515e-03f,
+	4.353716e-04f,
+	-4.097613e-03f,
+	-7.240399e-04f,
+	6.107288e-03f,
+	1.112923e-03f,
+	-8.923357e-03f,
+	-1.668387e-03f,
+	1.285385e-02f,
+	2.390066e-03f,
+	-1.858118e-02f,
+	-3.335416e-03f,
+	2.752096e-02f,
+	4.374231e-03f,
+	-4.379368e-02f,
+	-4.427193e-03f,
+	8.447149e-02f,
+	-1.452618e-02f,
+	-4.144152e-01f,
+	1.232654e-01f,
+	-8.404133e-02f,
+	-3.038008e-02f,
+	4.368200e-02f,
+	1.520709e-02f,
+	-2.746859e-02f,
+	-9.362184e-03f,
+	1.855016e-02f,
+	6.277682e-03f,
+	-1.283326e-02f,
+	-4.338859e-03f,
+	8.908920e-03f,
+	3.033519e-03f,
+	-6.096943e-03f,
+	-2.090644e-03f,
+	4.090196e-03f,
+	1.424903e-03f,
+	-2.644272e-03f,
+	-9.308737e-04f,
+	1.649011e-03f,
+	5.962475e-04f,
+	-9.602195e-04f,
+	-3.512997e-04f,
+	5.265590e-04f,
+	2.034011e-04f,
+	-2.449688e-04f,
+	-9.561357e-05f,
+	9.789676e-05f,
+	4.529089e-05f,
+	-1.274986e-05f,
+	-4.409404e-06f,
+	-2.970080e-09f,
+
+	1.435957e-06f,
+	1.308124e-05f,
+	-1.643424e-05f,
+	-9.899381e-05f,
+	5.402226e-06f,
+	2.474738e-04f,
+	9.054033e-08f,
+	-5.314133e-04f,
+	-4.126945e-05f,
+	9.687633e-04f,
+	9.312471e-05f,
+	-1.663092e-03f,
+	-2.038783e-04f,
+	2.666378e-03f,
+	3.555033e-04f,
+	-4.123644e-03f,
+	-6.028764e-04f,
+	6.146192e-03f,
+	9.341026e-04f,
+	-8.980196e-03f,
+	-1.409073e-03f,
+	1.293591e-02f,
+	2.016012e-03f,
+	-1.869998e-02f,
+	-2.788727e-03f,
+	2.769767e-02f,
+	3.536685e-03f,
+	-4.407780e-02f,
+	-2.966397e-03f,
+	8.504635e-02f,
+	-1.863556e-02f,
+	-4.221405e-01f,
+	1.175282e-01f,
+	-8.472272e-02f,
+	-2.873751e-02f,
+	4.399373e-02f,
+	1.430092e-02f,
+	-2.765824e-02f,
+	-8.778515e-03f,
+	1.867662e-02f,
+	5.880215e-03f,
+	-1.292041e-02f,
+	-4.063489e-03f,
+	8.969326e-03f,
+	2.843282e-03f,
+	-6.138403e-03f,
+	-1.961280e-03f,
+	4.118060e-03f,
+	1.339188e-03f,
+	-2.662431e-03f,
+	-8.760677e-04f,
+	1.660371e-03f,
+	5.628118e-04f,
+	-9.669517e-04f,
+	-3.321484e-04f,
+	5.302610e-04f,
+	1.933856e-04f,
+	-2.467849e-04f,
+	-9.110267e-05f,
+	9.862177e-05f,
+	4.379313e-05f,
+	-1.292529e-05f,
+	-4.225230e-06f,
+	-2.034145e-09f,
+
+	1.533932e-06f,
+	1.319588e-05f,
+	-1.763778e-05f,
+	-9.954536e-05f,
+	9.326267e-06f,
+	2.489245e-04f,
+	-8.914081e-06f,
+	-5.344423e-04f,
+	-2.373405e-05f,
+	9.743522e-04f,
+	6.214313e-05f,
+	-1.672618e-03f,
+	-1.526562e-04f,
+	2.681720e-03f,
+	2.748697e-04f,
+	-4.147319e-03f,
+	-4.805829e-04f,
+	6.181569e-03f,
+	7.536465e-04f,
+	-9.031875e-03f,
+	-1.147411e-03f,
+	1.301052e-02f,
+	1.638565e-03f,
+	-1.880800e-02f,
+	-2.236965e-03f,
+	2.785840e-02f,
+	2.690872e-03f,
+	-4.433649e-02f,
+	-1.488720e-03f,
+	8.557143e-02f,
+	-2.282713e-02f,
+	-4.298814e-01f,
+	1.118621e-01f,
+	-8.533512e-02f,
+	-2.709445e-02f,
+	4.427507e-02f,
+	1.339264e-02f,
+	-2.782959e-02f,
+	-8.193092e-03f,
+	1.879093e-02f,
+	5.481454e-03f,
+	-1.299919e-02f,
+	-3.787212e-03f,
+	9.023932e-03f,
+	2.652434e-03f,
+	-6.175878e-03f,
+	-1.831522e-03f,
+	4.143239e-03f,
+	1.253232e-03f,
+	-2.678836e-03f,
+	-8.211253e-04f,
+	1.670630e-03f,
+	5.293069e-04f,
+	-9.730286e-04f,
+	-3.129685e-04f,
+	5.336004e-04f,
+	1.833641e-04f,
+	-2.484211e-04f,
+	-8.659609e-05f,
+	9.927352e-05f,
+	4.230226e-05f,
+	-1.308194e-05f,
+	-4.044975e-06f,
+	-1.338872e-09f,
+
+	1.636157e-06f,
+	1.330045e-05f,
+	-1.886228e-05f,
+	-1.000442e-04f,
+	1.330151e-05f,
+	2.502332e-04f,
+	-1.802037e-05f,
+	-5.371714e-04f,
+	-6.017448e-06f,
+	9.793842e-04f,
+	3.086056e-05f,
+	-1.681191e-03f,
+	-1.009593e-04f,
+	2.695521e-03f,
+	1.935156e-04f,
+	-4.168610e-03f,
+	-3.572277e-04f,
+	6.213375e-03f,
+	5.716557e-04f,
+	-9.078331e-03f,
+	-8.835485e-04f,
+	1.307758e-02f,
+	1.257935e-03f,
+	-1.890511e-02f,
+	-1.680435e-03f,
+	2.800295e-02f,
+	1.837247e-03f,
+	-4.456935e-02f,
+	5.114924e-06f,
+	8.604565e-02f,
+	-2.710060e-02f,
+	-4.376366e-01f,
+	1.062680e-01f,
+	-8.587934e-02f,
+	-2.545188e-02f,
+	4.452611e-02f,
+	1.248283e-02f,
+	-2.798266e-02f,
+	-7.606282e-03f,
+	1.889309e-02f,
+	5.081650e-03f,
+	-1.306960e-02f,
+	-3.510200e-03f,
+	9.072739e-03f,
+	2.461093e-03f,
+	-6.209367e-03f,
+	-1.701451e-03f,
+	4.165737e-03f,
+	1.167089e-03f,
+	-2.693490e-03f,
+	-7.660812e-04f,
+	1.679791e-03f,
+	4.957542e-04f,
+	-9.784522e-04f,
+	-2.937725e-04f,
+	5.365786e-04f,
+	1.733429e-04f,
+	-2.498787e-04f,
+	-8.209677e-05f,
+	9.985280e-05f,
+	4.081926e-05f,
+	-1.322022e-05f,
+	-3.868731e-06f,
+	-8.391809e-10f,
+
+	1.742679e-06f,
+	1.339448e-05f,
+	-2.010726e-05f,
+	-1.004891e-04f,
+	1.732602e-05f,
+	2.513972e-04f,
+	-2.722358e-05f,
+	-5.395959e-04f,
+	1.187086e-05f,
+	9.838510e-04f,
+	-7.059108e-07f,
+	-1.688796e-03f,
+	-4.881603e-05f,
+	2.707761e-03f,
+	1.114864e-04f,
+	-4.187488e-03f,
+	-2.328799e-04f,
+	6.241570e-03f,
+	3.882329e-04f,
+	-9.119507e-03f,
+	-6.176343e-04f,
+	1.313702e-02f,
+	8.743375e-04f,
+	-1.899118e-02f,
+	-1.119449e-03f,
+	2.813112e-02f,
+	9.762737e-04f,
+	-4.477604e-02f,
+	1.514370e-03f,
+	8.646794e-02f,
+	-3.145565e-02f,
+	-4.454044e-01f,
+	1.007465e-01f,
+	-8.635623e-02f,
+	-2.381081e-02f,
+	4.474698e-02f,
+	1.157204e-02f,
+	-2.811749e-02f,
+	-7.018448e-03f,
+	1.898311e-02f,
+	4.681051e-03f,
+	-1.313166e-02f,
+	-3.232628e-03f,
+	9.115748e-03f,
+	2.269380e-03f,
+	-6.238876e-03f,
+	-1.571149e-03f,
+	4.185556e-03f,
+	1.080815e-03f,
+	-2.706396e-03f,
+	-7.109703e-04f,
+	1.687855e-03f,
+	4.621749e-04f,
+	-9.832245e-04f,
+	-2.745725e-04f,
+	5.391974e-04f,
+	1.633285e-04f,
+	-2.511590e-04f,
+	-7.760760e-05f,
+	1.003604e-04f,
+	3.934510e-05f,
+	-1.334056e-05f,
+	-3.696585e-06f,
+	-4.945302e-10f,
+
+	1.853542e-06f,
+	1.347751e-05f,
+	-2.137219e-05f,
+	-1.008786e-04f,
+	2.139777e-05f,
+	2.524139e-04f,
+	-3.651887e-05f,
+	-5.417108e-04f,
+	2.992118e-05f,
+	9.877448e-04f,
+	-3.253889e-05f,
+	-1.695423e-03f,
+	3.744443e-06f,
+	2.718421e-03f,
+	2.882822e-05f,
+	-4.203924e-03f,
+	-1.076099e-04f,
+	6.266114e-03f,
+	2.034823e-04f,
+	-9.155346e-03f,
+	-3.498197e-04f,
+	1.318875e-02f,
+	4.879898e-04f,
+	-1.906611e-02f,
+	-5.543219e-04f,
+	2.824273e-02f,
+	1.084239e-04f,
+	-4.495619e-02f,
+	3.038288e-03f,
+	8.683725e-02f,
+	-3.589194e-02f,
+	-4.531832e-01f,
+	9.529854e-02f,
+	-8.676662e-02f,
+	-2.217221e-02f,
+	4.493781e-02f,
+	1.066084e-02f,
+	-2.823410e-02f,
+	-6.429955e-03f,
+	1.906100e-02f,
+	4.279907e-03f,
+	-1.318536e-02f,
+	-2.954667e-03f,
+	9.152968e-03f,
+	2.077414e-03f,
+	-6.264410e-03f,
+	-1.440697e-03f,
+	4.202703e-03f,
+	9.944610e-04f,
+	-2.717558e-03f,
+	-6.558268e-04f,
+	1.694828e-03f,
+	4.285901e-04f,
+	-9.873485e-04f,
+	-2.553805e-04f,
+	5.414588e-04f,
+	1.533271e-04f,
+	-2.522632e-04f,
+	-7.313143e-05f,
+	1.007972e-04f,
+	3.788071e-05f,
+	-1.344340e-05f,
+	-3.528610e-06f,
+	-2.689908e-10f,
+
+	1.968781e-06f,
+	1.354905e-05f,
+	-2.265653e-05f,
+	-1.012116e-04f,
+	2.551472e-05f,
+	2.532807e-04f,
+	-4.590127e-05f,
+	-5.435118e-04f,
+	4.812363e-05f,
+	9.910580e-04f,
+	-6.462067e-05f,
+	-1.701059e-03f,
+	5.669259e-05f,
+	2.727484e-03f,
+	-5.441216e-05f,
+	-4.217893e-03f,
+	1.851088e-05f,
+	6.286969e-03f,
+	1.750940e-05f,
+	-9.185796e-03f,
+	-8.025771e-05f,
+	1.323270e-02f,
+	9.911223e-05f,
+	-1.912977e-02f,
+	1.462755e-05f,
+	2.833759e-02f,
+	-7.658233e-04f,
+	-4.510947e-02f,
+	4.576098e-03f,
+	8.715253e-02f,
+	-4.040908e-02f,
+	-4.609715e-01f,
+	8.992476e-02f,
+	-8.711141e-02f,
+	-2.053703e-02f,
+	4.509876e-02f,
+	9.749779e-03f,
+	-2.833257e-02f,
+	-5.841163e-03f,
+	1.912679e-02f,
+	3.878464e-03f,
+	-1.323073e-02f,
+	-2.676488e-03f,
+	9.184411e-03f,
+	1.885314e-03f,
+	-6.285977e-03f,
+	-1.310175e-03f,
+	4.217182e-03f,
+	9.080824e-04f,
+	-2.726981e-03f,
+	-6.006851e-04f,
+	1.700712e-03f,
+	3.950206e-04f,
+	-9.908271e-04f,
+	-2.362086e-04f,
+	5.433650e-04f,
+	1.433452e-04f,
+	-2.531929e-04f,
+	-6.867106e-05f,
+	1.011642e-04f,
+	3.642698e-05f,
+	-1.352917e-05f,
+	-3.364872e-06f,
+	-1.313090e-10f,
+
+	2.088427e-06f,
+	1.360863e-05f,
+	-2.395970e-05f,
+	-1.014867e-04f,
+	2.967471e-05f,
+	2.539951e-04f,
+	-5.536569e-05f,
+	-5.449943e-04f,
+	6.646811e-05f,
+	9.937834e-04f,
+	-9.693322e-05f,
+	-1.705692e-03f,
+	1.099984e-04f,
+	2.734932e-03f,
+	-1.381872e-04f,
+	-4.229371e-03f,
+	1.454102e-04f,
+	6.304102e-03f,
+	-1.695788e-04f,
+	-9.210806e-03f,
+	1.908965e-04f,
+	1.326880e-02f,
+	-2.920721e-04f,
+	-1.918206e-02f,
+	5.870750e-04f,
+	2.841554e-02f,
+	-1.645981e-03f,
+	-4.523554e-02f,
+	6.127011e-03f,
+	8.741274e-02f,
+	-4.500666e-02f,
+	-4.687677e-01f,
+	8.462587e-02f,
+	-8.739145e-02f,
+	-1.890623e-02f,
+	4.523000e-02f,
+	8.839414e-03f,
+	-2.841294e-02f,
+	-5.252433e-03f,
+	1.918052e-02f,
+	3.476969e-03f,
+	-1.326778e-02f,
+	-2.398262e-03f,
+	9.210088e-03f,
+	1.693198e-03f,
+	-6.303587e-03f,
+	-1.179664e-03f,
+	4.229003e-03f,
+	8.217320e-04f,
+	-2.734672e-03f,
+	-5.455792e-04f,
+	1.705513e-03f,
+	3.614871e-04f,
+	-9.936638e-04f,
+	-2.170684e-04f,
+	5.449183e-04f,
+	1.333887e-04f,
+	-2.539497e-04f,
+	-6.422922e-05f,
+	1.014621e-04f,
+	3.498481e-05f,
+	-1.359834e-05f,
+	-3.205428e-06f,
+	-5.495893e-11f,
+
+	2.212501e-06f,
+	1.365579e-05f,
+	-2.528110e-05f,
+	-1.017027e-04f,
+	3.387557e-05f,
+	2.545547e-04f,
+	-6.490696e-05f,
+	-5.461542e-04f,
+	8.494436e-05f,
+	9.959141e-04f,
+	-1.294582e-04f,
+	-1.709313e-03f,
+	1.636314e-04f,
+	2.740750e-03f,
+	-2.224488e-04f,
+	-4.238334e-03f,
+	2.730147e-04f,
+	6.317477e-03f,
+	-3.576742e-04f,
+	-9.230330e-03f,
+	4.634860e-04f,
+	1.329698e-02f,
+	-6.853371e-04f,
+	-1.922288e-02f,
+	1.162692e-03f,
+	2.847642e-02f,
+	-2.531557e-03f,
+	-4.533410e-02f,
+	7.690223e-03f,
+	8.761686e-02f,
+	-4.968426e-02f,
+	-4.765702e-01f,
+	7.940256e-02f,
+	-8.760766e-02f,
+	-1.728075e-02f,
+	4.533171e-02f,
+	7.930289e-03f,
+	-2.847530e-02f,
+	-4.664120e-03f,
+	1.922222e-02f,
+	3.075664e-03f,
+	-1.329654e-02f,
+	-2.120159e-03f,
+	9.230020e-03f,
+	1.501182e-03f,
+	-6.317255e-03f,
+	-1.049243e-03f,
+	4.238175e-03f,
+	7.354625e-04f,
+	-2.740638e-03f,
+	-4.905427e-04f,
+	1.709235e-03f,
+	3.280102e-04f,
+	-9.958624e-04f,
+	-1.979719e-04f,
+	5.461213e-04f,
+	1.234638e-04f,
+	-2.545351e-04f,
+	-5.980863e-05f,
+	1.016921e-04f,
+	3.355503e-05f,
+	-1.365134e-05f,
+	-3.050325e-06f,
+	-1.818545e-11f,
+
+	2.341020e-06f,
+	1.369004e-05f,
+	-2.662010e-05f,
+	-1.018584e-04f,
+	3.811503e-05f,
+	2.549572e-04f,
+	-7.451975e-05f,
+	-5.469873e-04f,
+	1.035419e-04f,
+	9.974435e-04f,
+	-1.621772e-04f,
+	-1.711911e-03f,
+	2.175607e-04f,
+	2.744923e-03f,
+	-3.071481e-04f,
+	-4.244760e-03f,
+	4.012504e-04f,
+	6.327065e-03f,
+	-5.466671e-04f,
+	-9.244322e-03f,
+	7.373519e-04f,
+	1.331718e-02f,
+	-1.080454e-03f,
+	-1.925214e-02f,
+	1.741148e-03f,
+	2.852007e-02f,
+	-3.422049e-03f,
+	-4.540484e-02f,
+	9.264913e-03f,
+	8.776386e-02f,
+	-5.444142e-02f,
+	-4.843775e-01f,
+	7.425547e-02f,
+	-8.776096e-02f,
+	-1.566151e-02f,
+	4.540409e-02f,
+	7.022946e-03f,
+	-2.851972e-02f,
+	-4.076581e-03f,
+	1.925193e-02f,
+	2.674794e-03f,
+	-1.331704e-02f,
+	-1.842348e-03f,
+	9.244224e-03f,
+	1.309384e-03f,
+	-6.326995e-03f,
+	-9.189924e-04f,
+	4.244710e-03f,
+	6.493264e-04f,
+	-2.744887e-03f,
+	-4.356091e-04f,
+	1.711886e-03f,
+	2.946102e-04f,
+	-9.974272e-04f,
+	-1.789304e-04f,
+	5.469770e-04f,
+	1.135765e-04f,
+	-2.549510e-04f,
+	-5.541193e-05f,
+	1.018551e-04f,
+	3.213848e-05f,
+	-1.368864e-05f,
+	-2.899604e-06f,
+	-4.039880e-12f,
+
+	2.473992e-06f,
+	1.371093e-05f,
+	-2.797604e-05f,
+	-1.019527e-04f,
+	4.239081e-05f,
+	2.552001e-04f,
+	-8.419867e-05f,
+	-5.474898e-04f,
+	1.222502e-04f,
+	9.983652e-04f,
+	-1.950711e-04f,
+	-1.713475e-03f,
+	2.717550e-04f,
+	2.747436e-03f,
+	-3.922358e-04f,
+	-4.248629e-03f,
+	5.300422e-04f,
+	6.332837e-03f,
+	-7.364469e-04f,
+	-9.252744e-03f,
+	1.012334e-03f,
+	1.332933e-02f,
+	-1.477193e-03f,
+	-1.926976e-02f,
+	2.322105e-03f,
+	2.854635e-02f,
+	-4.316951e-03f,
+	-4.544748e-02f,
+	1.085025e-02f,
+	8.785275e-02f,
+	-5.927765e-02f,
+	-4.921880e-01f,
+	6.918523e-02f,
+	-8.785227e-02f,
+	-1.404942e-02f,
+	4.544735e-02f,
+	6.117922e-03f,
+	-2.854629e-02f,
+	-3.490166e-03f,
+	1.926972e-02f,
+	2.274599e-03f,
+	-1.332931e-02f,
+	-1.564996e-03f,
+	9.252728e-03f,
+	1.117919e-03f,
+	-6.332825e-03f,
+	-7.889902e-04f,
+	4.248620e-03f,
+	5.633757e-04f,
+	-2.747430e-03f,
+	-3.808115e-04f,
+	1.713471e-03f,
+	2.613071e-04f,
+	-9.983625e-04f,
+	-1.599555e-04f,
+	5.474881e-04f,
+	1.037327e-04f,
+	-2.551991e-04f,
+	-5.104170e-05f,
+	1.019521e-04f,
+	3.073596e-05f,
+	-1.371069e-05f,
+	-2.753295e-06f,
+	-4.023448e-13f,
+
+	2.611419e-06f,
+	1.371797e-05f,
+	-2.934823e-05f,
+	-1.019843e-04f,
+	4.670050e-05f,
+	2.552815e-04f,
+	-9.393820e-05f,
+	-5.476579e-04f,
+	1.410584e-04f,
+	9.986735e-04f,
+	-2.281208e-04f,
+	-1.713998e-03f,
+	3.261826e-04f,
+	2.748275e-03f,
+	-4.776618e-04f,
+	-4.249922e-03f,
+	6.593143e-04f,
+	6.334764e-03f,
+	-9.269017e-04f,
+	-9.255557e-03f,
+	1.288270e-03f,
+	1.333339e-02f,
+	-1.875320e-03f,
+	-1.927564e-02f,
+	2.905226e-03f,
+	2.855514e-02f,
+	-5.215749e-03f,
+	-4.546173e-02f,
+	1.244537e-02f,
+	8.788255e-02f,
+	-6.419244e-02f,
+	-5.000000e-01f,
+	6.419244e-02f,
+	-8.788255e-02f,
+	-1.244537e-02f,
+	4.546173e-02f,
+	5.215749e-03f,
+	-2.855514e-02f,
+	-2.905226e-03f,
+	1.927564e-02f,
+	1.875320e-03f,
+	-1.333339e-02f,
+	-1.288270e-03f,
+	9.255557e-03f,
+	9.269017e-04f,
+	-6.334764e-03f,
+	-6.593143e-04f,
+	4.249922e-03f,
+	4.776618e-04f,
+	-2.748275e-03f,
+	-3.261826e-04f,
+	1.713998e-03f,
+	2.281208e-04f,
+	-9.986735e-04f,
+	-1.410584e-04f,
+	5.476579e-04f,
+	9.393820e-05f,
+	-2.552815e-04f,
+	-4.670050e-05f,
+	1.019843e-04f,
+	2.934823e-05f,
+	-1.371797e-05f,
+	-2.611419e-06f,
+	1.665335e-15f
+};
+
+// blamp table: 4160 entries
+const float blamp[] = {
+	-1.031836e-39f,
+	1.772968e-08f,
+	-1.124919e-07f,
+	7.375387e-08f,
+	-2.551894e-07f,
+	1.699016e-07f,
+	-4.486818e-07f,
+	3.281352e-07f,
+	-7.160630e-07f,
+	5.725118e-07f,
+	-1.082303e-06f,
+	9.290406e-07f,
+	-1.574829e-06f,
+	1.427294e-06f,
+	-2.226577e-06f,
+	2.105486e-06f,
+	-3.083934e-06f,
+	3.022509e-06f,
+	-4.224808e-06f,
+	4.285158e-06f,
+	-5.800129e-06f,
+	6.112685e-06f,
+	-8.137110e-06f,
+	9.007854e-06f,
+	-1.203488e-05f,
+	1.429466e-05f,
+	-1.980544e-05f,
+	2.629660e-05f,
+	-4.031420e-05f,
+	6.571643e-05f,
+	-1.325236e-04f,
+	3.717188e-04f,
+	-3.170650e-03f,
+	3.717188e-04f,
+	-1.325236e-04f,
+	6.571643e-05f,
+	-4.031420e-05f,
+	2.629660e-05f,
+	-1.980544e-05f,
+	1.429466e-05f,
+	-1.203488e-05f,
+	9.007854e-06f,
+	-8.137110e-06f,
+	6.112685e-06f,
+	-5.800129e-06f,
+	4.285158e-06f,
+	-4.224808e-06f,
+	3.022509e-06f,
+	-3.083934e-06f,
+	2.105486e-06f,
+	-2.226577e-06f,
+	1.427294e-06f,
+	-1.574829e-06f,
+	9.290406e-07f,
+	-1.082303e-06f,
+	5.725118e-07f,
+	-7.160630e-07f,
+	3.281352e-07f,
+	-4.486818e-07f,
+	1.699016e-07f,
+	-2.551894e-07f,
+	7.375387e-08f,
+	-1.124919e-07f,
+	1.772968e-08f,
+
+	1.972514e-16f,
+	1.854423e-08f,
+	-1.182058e-07f,
+	8.678015e-08f,
+	-2.807771e-07f,
+	2.120099e-07f,
+	-5.145167e-07f,
+	4.240482e-07f,
+	-8.521067e-07f,
+	7.583562e-07f,
+	-1.331810e-06f,
+	1.256200e-06f,
+	-1.998368e-06f,
+	1.966666e-06f,
+	-2.906644e-06f,
+	2.952634e-06f,
+	-4.130952e-06f,
+	4.304992e-06f,
+	-5.786479e-06f,
+	6.174943e-06f,
+	-8.078514e-06f,
+	8.850402e-06f,
+	-1.142406e-05f,
+	1.295602e-05f,
+	-1.679451e-05f,
+	2.007030e-05f,
+	-2.689741e-05f,
+	3.517013e-05f,
+	-5.176562e-05f,
+	8.128412e-05f,
+	-1.558403e-04f,
+	4.151792e-04f,
+	-2.930323e-03f,
+	3.282573e-04f,
+	-1.092067e-04f,
+	5.014863e-05f,
+	-2.886273e-05f,
+	1.742302e-05f,
+	-1.271344e-05f,
+	8.518999e-06f,
+	-7.275229e-06f,
+	5.059674e-06f,
+	-4.850150e-06f,
+	3.374958e-06f,
+	-3.521736e-06f,
+	2.395367e-06f,
+	-2.663132e-06f,
+	1.740021e-06f,
+	-2.036911e-06f,
+	1.258334e-06f,
+	-1.546508e-06f,
+	8.879201e-07f,
+	-1.151287e-06f,
+	6.018794e-07f,
+	-8.327953e-07f,
+	3.866663e-07f,
+	-5.800185e-07f,
+	2.322217e-07f,
+	-3.828463e-07f,
+	1.277930e-07f,
+	-2.296015e-07f,
+	6.072739e-08f,
+	-1.067779e-07f,
+	1.691507e-08f,
+
+	2.365890e-15f,
+	1.935528e-08f,
+	-1.239054e-07f,
+	9.977283e-08f,
+	-3.063017e-07f,
+	2.540134e-07f,
+	-5.801904e-07f,
+	5.197252e-07f,
+	-9.878181e-07f,
+	9.437459e-07f,
+	-1.580708e-06f,
+	1.582562e-06f,
+	-2.420878e-06f,
+	2.504725e-06f,
+	-3.585058e-06f,
+	3.797722e-06f,
+	-5.175428e-06f,
+	5.584360e-06f,
+	-7.344358e-06f,
+	8.060139e-06f,
+	-1.035137e-05f,
+	1.158147e-05f,
+	-1.470303e-05f,
+	1.689460e-05f,
+	-2.154258e-05f,
+	2.583189e-05f,
+	-3.397209e-05f,
+	4.402197e-05f,
+	-6.318891e-05f,
+	9.681319e-05f,
+	-1.790976e-04f,
+	4.585182e-04f,
+	-2.697621e-03f,
+	2.849118e-04f,
+	-8.594775e-05f,
+	3.461882e-05f,
+	-1.743902e-05f,
+	8.570893e-06f,
+	-5.638557e-06f,
+	2.757258e-06f,
+	-2.527043e-06f,
+	1.121000e-06f,
+	-1.571100e-06f,
+	6.438207e-07f,
+	-1.248825e-06f,
+	5.101234e-07f,
+	-1.105213e-06f,
+	4.606186e-07f,
+	-9.924073e-07f,
+	4.132213e-07f,
+	-8.680743e-07f,
+	3.498446e-07f,
+	-7.287640e-07f,
+	2.755064e-07f,
+	-5.838876e-07f,
+	2.012692e-07f,
+	-4.443012e-07f,
+	1.365400e-07f,
+	-3.171691e-07f,
+	8.578686e-08f,
+	-2.040750e-07f,
+	4.773342e-08f,
+	-1.010775e-07f,
+	1.610364e-08f,
+
+	1.319947e-14f,
+	2.015917e-08f,
+	-1.295761e-07f,
+	1.126978e-07f,
+	-3.316995e-07f,
+	2.958066e-07f,
+	-6.455404e-07f,
+	6.149290e-07f,
+	-1.122863e-06f,
+	1.128224e-06f,
+	-1.828388e-06f,
+	1.907324e-06f,
+	-2.841321e-06f,
+	3.040153e-06f,
+	-4.260160e-06f,
+	4.638687e-06f,
+	-6.214811e-06f,
+	6.857491e-06f,
+	-8.894648e-06f,
+	9.936151e-06f,
+	-1.261315e-05f,
+	1.429924e-05f,
+	-1.796603e-05f,
+	2.081398e-05f,
+	-2.626749e-05f,
+	3.156535e-05f,
+	-4.101217e-05f,
+	5.283038e-05f,
+	-7.455581e-05f,
+	1.122648e-04f,
+	-2.022356e-04f,
+	5.016116e-04f,
+	-2.472535e-03f,
+	2.417951e-04f,
+	-6.280377e-05f,
+	1.916458e-05f,
+	-6.070567e-06f,
+	-2.385186e-07f,
+	1.402239e-06f,
+	-2.976740e-06f,
+	2.198293e-06f,
+	-2.798724e-06f,
+	1.692180e-06f,
+	-2.074182e-06f,
+	1.013159e-06f,
+	-1.366056e-06f,
+	4.452195e-07f,
+	-8.126328e-07f,
+	4.707813e-08f,
+	-4.278288e-07f,
+	-1.928995e-07f,
+	-1.856439e-07f,
+	-3.082700e-07f,
+	-4.929692e-08f,
+	-3.361747e-07f,
+	1.676437e-08f,
+	-3.092349e-07f,
+	4.131972e-08f,
+	-2.518065e-07f,
+	4.398425e-08f,
+	-1.786703e-07f,
+	3.480379e-08f,
+	-9.540400e-08f,
+	1.529843e-08f,
+
+	4.880451e-14f,
+	2.095201e-08f,
+	-1.352028e-07f,
+	1.255204e-07f,
+	-3.569062e-07f,
+	3.372828e-07f,
+	-7.104030e-07f,
+	7.094209e-07f,
+	-1.256906e-06f,
+	1.311332e-06f,
+	-2.074236e-06f,
+	2.229684e-06f,
+	-3.258664e-06f,
+	3.571630e-06f,
+	-4.930290e-06f,
+	5.473457e-06f,
+	-7.246549e-06f,
+	8.121257e-06f,
+	-1.043354e-05f,
+	1.179838e-05f,
+	-1.485832e-05f,
+	1.699704e-05f,
+	-2.120505e-05f,
+	2.470454e-05f,
+	-3.095763e-05f,
+	3.725656e-05f,
+	-4.800027e-05f,
+	6.157352e-05f,
+	-8.583799e-05f,
+	1.275997e-04f,
+	-2.251939e-04f,
+	5.443315e-04f,
+	-2.255049e-03f,
+	1.990163e-04f,
+	-3.983071e-05f,
+	3.822901e-06f,
+	5.215475e-06f,
+	-8.984201e-06f,
+	8.392156e-06f,
+	-8.669323e-06f,
+	6.889516e-06f,
+	-6.690155e-06f,
+	4.931914e-06f,
+	-4.772574e-06f,
+	3.258829e-06f,
+	-3.228703e-06f,
+	1.984474e-06f,
+	-2.076703e-06f,
+	1.079073e-06f,
+	-1.262816e-06f,
+	4.774124e-07f,
+	-7.172728e-07f,
+	1.091972e-07f,
+	-3.717593e-07f,
+	-9.024343e-08f,
+	-1.664104e-07f,
+	-1.751388e-07f,
+	-5.321351e-08f,
+	-1.869122e-07f,
+	2.484317e-09f,
+	-1.534466e-07f,
+	2.196951e-08f,
+	-8.977013e-08f,
+	1.450223e-08f,
+
+	1.393247e-13f,
+	2.172976e-08f,
+	-1.407701e-07f,
+	1.382054e-07f,
+	-3.818563e-07f,
+	3.783347e-07f,
+	-7.746137e-07f,
+	8.029609e-07f,
+	-1.389611e-06f,
+	1.492609e-06f,
+	-2.317638e-06f,
+	2.548836e-06f,
+	-3.671865e-06f,
+	4.097836e-06f,
+	-5.593787e-06f,
+	6.299966e-06f,
+	-8.268090e-06f,
+	9.372537e-06f,
+	-1.195725e-05f,
+	1.364222e-05f,
+	-1.708134e-05f,
+	1.966821e-05f,
+	-2.441210e-05f,
+	2.855669e-05f,
+	-3.560143e-05f,
+	4.289144e-05f,
+	-5.491905e-05f,
+	7.022957e-05f,
+	-9.700702e-05f,
+	1.427788e-04f,
+	-2.479111e-04f,
+	5.865471e-04f,
+	-2.045142e-03f,
+	1.566804e-04f,
+	-1.708316e-05f,
+	-1.136990e-05f,
+	1.639241e-05f,
+	-1.764545e-05f,
+	1.531464e-05f,
+	-1.430700e-05f,
+	1.153551e-05f,
+	-1.054407e-05f,
+	8.140428e-06f,
+	-7.444964e-06f,
+	5.482869e-06f,
+	-5.073408e-06f,
+	3.508911e-06f,
+	-3.328603e-06f,
+	2.101140e-06f,
+	-2.089768e-06f,
+	1.141281e-06f,
+	-1.243788e-06f,
+	5.226551e-07f,
+	-6.911216e-07f,
+	1.533292e-07f,
+	-3.478247e-07f,
+	-4.232605e-08f,
+	-1.468382e-07f,
+	-1.226367e-07f,
+	-3.861601e-08f,
+	-1.284614e-07f,
+	9.260596e-09f,
+	-8.418809e-08f,
+	1.371765e-08f,
+
+	3.334611e-13f,
+	2.248813e-08f,
+	-1.462624e-07f,
+	1.507172e-07f,
+	-4.064845e-07f,
+	4.188543e-07f,
+	-8.380075e-07f,
+	8.953091e-07f,
+	-1.520639e-06f,
+	1.671597e-06f,
+	-2.557981e-06f,
+	2.863978e-06f,
+	-4.079892e-06f,
+	4.617453e-06f,
+	-6.248994e-06f,
+	7.116152e-06f,
+	-9.276892e-06f,
+	1.060822e-05f,
+	-1.346197e-05f,
+	1.546310e-05f,
+	-1.927669e-05f,
+	2.230613e-05f,
+	-2.757924e-05f,
+	3.236085e-05f,
+	-4.018734e-05f,
+	4.845595e-05f,
+	-6.175120e-05f,
+	7.877677e-05f,
+	-1.080345e-04f,
+	1.577626e-04f,
+	-2.703256e-04f,
+	6.281239e-04f,
+	-1.842786e-03f,
+	1.148883e-04f,
+	5.385612e-06f,
+	-2.637828e-05f,
+	2.743403e-05f,
+	-2.620193e-05f,
+	2.215342e-05f,
+	-1.987652e-05f,
+	1.612534e-05f,
+	-1.435140e-05f,
+	1.131017e-05f,
+	-1.008506e-05f,
+	7.680044e-06f,
+	-6.895832e-06f,
+	5.014947e-06f,
+	-4.565392e-06f,
+	3.110880e-06f,
+	-2.906745e-06f,
+	1.797151e-06f,
+	-1.763958e-06f,
+	9.311387e-07f,
+	-1.006638e-06f,
+	3.939767e-07f,
+	-5.270566e-07f,
+	8.889613e-08f,
+	-2.393375e-07f,
+	-5.912714e-08f,
+	-7.922220e-08f,
+	-1.037708e-07f,
+	-3.293902e-09f,
+	-7.866958e-08f,
+	1.294705e-08f,
+
+	7.028512e-13f,
+	2.322270e-08f,
+	-1.516637e-07f,
+	1.630199e-07f,
+	-4.307246e-07f,
+	4.587336e-07f,
+	-9.004194e-07f,
+	9.862256e-07f,
+	-1.649656e-06f,
+	1.847836e-06f,
+	-2.794654e-06f,
+	3.174309e-06f,
+	-4.481711e-06f,
+	5.129170e-06f,
+	-6.894263e-06f,
+	7.919964e-06f,
+	-1.027043e-05f,
+	1.182520e-05f,
+	-1.494396e-05f,
+	1.725646e-05f,
+	-2.143889e-05f,
+	2.490422e-05f,
+	-3.069854e-05f,
+	3.610751e-05f,
+	-4.470387e-05f,
+	5.393613e-05f,
+	-6.847952e-05f,
+	8.719343e-05f,
+	-1.188922e-04f,
+	1.725119e-04f,
+	-2.923755e-04f,
+	6.689246e-04f,
+	-1.647948e-03f,
+	7.373662e-05f,
+	2.752388e-05f,
+	-4.116748e-05f,
+	3.831467e-05f,
+	-3.463368e-05f,
+	2.889251e-05f,
+	-2.536483e-05f,
+	2.064826e-05f,
+	-1.810322e-05f,
+	1.443371e-05f,
+	-1.268668e-05f,
+	9.845217e-06f,
+	-8.691713e-06f,
+	6.499064e-06f,
+	-5.784182e-06f,
+	4.105940e-06f,
+	-3.711844e-06f,
+	2.443499e-06f,
+	-2.276574e-06f,
+	1.333702e-06f,
+	-1.317579e-06f,
+	6.311448e-07f,
+	-7.036933e-07f,
+	2.182278e-07f,
+	-3.304998e-07f,
+	3.473081e-09f,
+	-1.192423e-07f,
+	-7.942894e-08f,
+	-1.566601e-08f,
+	-7.322569e-08f,
+	1.219260e-08f,
+
+	1.346271e-12f,
+	2.392883e-08f,
+	-1.569576e-07f,
+	1.750771e-07f,
+	-4.545105e-07f,
+	4.978644e-07f,
+	-9.616846e-07f,
+	1.075471e-06f,
+	-1.776326e-06f,
+	2.020871e-06f,
+	-3.027049e-06f,
+	3.479034e-06f,
+	-4.876299e-06f,
+	5.631684e-06f,
+	-7.527958e-06f,
+	8.709369e-06f,
+	-1.124618e-05f,
+	1.302042e-05f,
+	-1.639948e-05f,
+	1.901781e-05f,
+	-2.356251e-05f,
+	2.745594e-05f,
+	-3.376218e-05f,
+	3.978728e-05f,
+	-4.913966e-05f,
+	5.931814e-05f,
+	-7.508691e-05f,
+	9.545802e-05f,
+	-1.295519e-04f,
+	1.869874e-04f,
+	-3.139988e-04f,
+	7.088089e-04f,
+	-1.460588e-03f,
+	3.331773e-05f,
+	4.928147e-05f,
+	-5.570370e-05f,
+	4.900929e-05f,
+	-4.292122e-05f,
+	3.551629e-05f,
+	-3.075921e-05f,
+	2.509376e-05f,
+	-2.179081e-05f,
+	1.750379e-05f,
+	-1.524377e-05f,
+	1.197335e-05f,
+	-1.045688e-05f,
+	7.957820e-06f,
+	-6.982148e-06f,
+	5.084019e-06f,
+	-4.503206e-06f,
+	3.078835e-06f,
+	-2.780456e-06f,
+	1.729422e-06f,
+	-1.623232e-06f,
+	8.642924e-07f,
+	-8.773323e-07f,
+	3.453765e-07f,
+	-4.201193e-07f,
+	6.502463e-08f,
+	-1.585873e-07f,
+	-5.548836e-08f,
+	-2.782887e-08f,
+	-6.786694e-08f,
+	1.145624e-08f,
+
+	2.393624e-12f,
+	2.460172e-08f,
+	-1.621278e-07f,
+	1.868526e-07f,
+	-4.777762e-07f,
+	5.361391e-07f,
+	-1.021639e-06f,
+	1.162809e-06f,
+	-1.900316e-06f,
+	2.190248e-06f,
+	-3.254563e-06f,
+	3.777365e-06f,
+	-5.262642e-06f,
+	6.123708e-06f,
+	-8.148461e-06f,
+	9.482354e-06f,
+	-1.220169e-05f,
+	1.419085e-05f,
+	-1.782484e-05f,
+	2.074268e-05f,
+	-2.564218e-05f,
+	2.995485e-05f,
+	-3.676241e-05f,
+	4.339081e-05f,
+	-5.348346e-05f,
+	6.458828e-05f,
+	-8.155651e-05f,
+	1.035492e-04f,
+	-1.399857e-04f,
+	2.011502e-04f,
+	-3.351333e-04f,
+	7.476336e-04f,
+	-1.280661e-03f,
+	-6.280282e-06f,
+	7.060990e-05f,
+	-6.995407e-05f,
+	5.949349e-05f,
+	-5.104554e-05f,
+	4.200953e-05f,
+	-3.604719e-05f,
+	2.945157e-05f,
+	-2.540565e-05f,
+	2.051332e-05f,
+	-1.775043e-05f,
+	1.405954e-05f,
+	-1.218726e-05f,
+	9.387854e-06f,
+	-8.156533e-06f,
+	6.042870e-06f,
+	-5.279013e-06f,
+	3.701706e-06f,
+	-3.274453e-06f,
+	2.117397e-06f,
+	-1.922901e-06f,
+	1.092893e-06f,
+	-1.047582e-06f,
+	4.700582e-07f,
+	-5.079960e-07f,
+	1.253925e-07f,
+	-1.971708e-07f,
+	-3.199953e-08f,
+	-3.975676e-08f,
+	-6.260326e-08f,
+	1.073971e-08f,
+
+	4.009682e-12f,
+	2.523644e-08f,
+	-1.671575e-07f,
+	1.983099e-07f,
+	-5.004557e-07f,
+	5.734502e-07f,
+	-1.080121e-06f,
+	1.248002e-06f,
+	-2.021299e-06f,
+	2.355521e-06f,
+	-3.476600e-06f,
+	4.068525e-06f,
+	-5.639738e-06f,
+	6.603968e-06f,
+	-8.754174e-06f,
+	1.023693e-05f,
+	-1.313448e-05f,
+	1.533349e-05f,
+	-1.921641e-05f,
+	2.242667e-05f,
+	-2.767260e-05f,
+	3.239458e-05f,
+	-3.969159e-05f,
+	4.690893e-05f,
+	-5.772418e-05f,
+	6.973303e-05f,
+	-8.787161e-05f,
+	1.114460e-04f,
+	-1.501659e-04f,
+	2.149615e-04f,
+	-3.557171e-04f,
+	7.852530e-04f,
+	-1.108116e-03f,
+	-4.497377e-05f,
+	9.146245e-05f,
+	-8.388677e-05f,
+	6.974362e-05f,
+	-5.898816e-05f,
+	4.835739e-05f,
+	-4.121668e-05f,
+	3.371170e-05f,
+	-2.893944e-05f,
+	2.345538e-05f,
+	-2.020090e-05f,
+	1.609900e-05f,
+	-1.387889e-05f,
+	1.078590e-05f,
+	-9.304655e-06f,
+	6.980307e-06f,
+	-6.037502e-06f,
+	4.310698e-06f,
+	-3.757447e-06f,
+	2.496753e-06f,
+	-2.215914e-06f,
+	1.316436e-06f,
+	-1.214063e-06f,
+	5.919979e-07f,
+	-5.939366e-07f,
+	1.844463e-07f,
+	-2.349100e-07f,
+	-9.010932e-09f,
+	-5.142517e-08f,
+	-5.744397e-08f,
+	1.004454e-08f,
+
+	6.397546e-12f,
+	2.582788e-08f,
+	-1.720300e-07f,
+	2.094126e-07f,
+	-5.224833e-07f,
+	6.096917e-07f,
+	-1.136968e-06f,
+	1.330819e-06f,
+	-2.138947e-06f,
+	2.516247e-06f,
+	-3.692574e-06f,
+	4.351743e-06f,
+	-6.006598e-06f,
+	7.071210e-06f,
+	-9.343522e-06f,
+	1.097115e-05f,
+	-1.404217e-05f,
+	1.644539e-05f,
+	-2.057061e-05f,
+	2.406546e-05f,
+	-2.964858e-05f,
+	3.476888e-05f,
+	-4.254222e-05f,
+	5.033262e-05f,
+	-6.185091e-05f,
+	7.473913e-05f,
+	-9.401580e-05f,
+	1.191275e-04f,
+	-1.600655e-04f,
+	2.283830e-04f,
+	-3.756883e-04f,
+	8.215188e-04f,
+	-9.428947e-04f,
+	-8.268350e-05f,
+	1.117942e-04f,
+	-9.747109e-05f,
+	7.973675e-05f,
+	-6.673119e-05f,
+	5.454549e-05f,
+	-4.625593e-05f,
+	3.786445e-05f,
+	-3.238411e-05f,
+	2.632328e-05f,
+	-2.258960e-05f,
+	1.808708e-05f,
+	-1.552792e-05f,
+	1.214877e-05f,
+	-1.042391e-05f,
+	7.894211e-06f,
+	-6.776960e-06f,
+	4.904443e-06f,
+	-4.228353e-06f,
+	2.866644e-06f,
+	-2.501618e-06f,
+	1.534427e-06f,
+	-1.376409e-06f,
+	7.109298e-07f,
+	-6.777547e-07f,
+	2.420605e-07f,
+	-2.717252e-07f,
+	1.343109e-08f,
+	-6.281083e-08f,
+	-5.239779e-08f,
+	9.372076e-09f,
+
+	9.801791e-12f,
+	2.637081e-08f,
+	-1.767284e-07f,
+	2.201244e-07f,
+	-5.437942e-07f,
+	6.447581e-07f,
+	-1.192021e-06f,
+	1.411029e-06f,
+	-2.252942e-06f,
+	2.671992e-06f,
+	-3.901905e-06f,
+	4.626268e-06f,
+	-6.362253e-06f,
+	7.524204e-06f,
+	-9.914962e-06f,
+	1.168308e-05f,
+	-1.492238e-05f,
+	1.752367e-05f,
+	-2.188393e-05f,
+	2.565482e-05f,
+	-3.156499e-05f,
+	3.707163e-05f,
+	-4.530693e-05f,
+	5.365301e-05f,
+	-6.585295e-05f,
+	7.959353e-05f,
+	-9.997297e-05f,
+	1.265734e-04f,
+	-1.696573e-04f,
+	2.413770e-04f,
+	-3.949856e-04f,
+	8.562806e-04f,
+	-7.849357e-04f,
+	-1.193347e-04f,
+	1.315623e-04f,
+	-1.106775e-04f,
+	8.945080e-05f,
+	-7.425734e-05f,
+	6.055994e-05f,
+	-5.115357e-05f,
+	4.190042e-05f,
+	-3.573189e-05f,
+	2.911051e-05f,
+	-2.491112e-05f,
+	2.001929e-05f,
+	-1.713062e-05f,
+	1.347340e-05f,
+	-1.151178e-05f,
+	8.782534e-06f,
+	-7.495733e-06f,
+	5.481618e-06f,
+	-4.686126e-06f,
+	3.226252e-06f,
+	-2.779384e-06f,
+	1.746390e-06f,
+	-1.534266e-06f,
+	8.265985e-07f,
+	-7.592711e-07f,
+	2.981149e-07f,
+	-3.075400e-07f,
+	3.528238e-08f,
+	-7.389173e-08f,
+	-4.747281e-08f,
+	8.723445e-09f,
+
+	1.451128e-11f,
+	2.685990e-08f,
+	-1.812359e-07f,
+	2.304093e-07f,
+	-5.643238e-07f,
+	6.785459e-07f,
+	-1.245124e-06f,
+	1.488406e-06f,
+	-2.362968e-06f,
+	2.822327e-06f,
+	-4.104027e-06f,
+	4.891358e-06f,
+	-6.705752e-06f,
+	7.961744e-06f,
+	-1.046698e-05f,
+	1.237086e-05f,
+	-1.577280e-05f,
+	1.856550e-05f,
+	-2.315295e-05f,
+	2.719059e-05f,
+	-3.341687e-05f,
+	3.929682e-05f,
+	-4.797853e-05f,
+	5.686146e-05f,
+	-6.971984e-05f,
+	8.428348e-05f,
+	-1.057273e-04f,
+	1.337637e-04f,
+	-1.789153e-04f,
+	2.539062e-04f,
+	-4.135484e-04f,
+	8.893856e-04f,
+	-6.341700e-04f,
+	-1.548573e-04f,
+	1.507257e-04f,
+	-1.234776e-04f,
+	9.886454e-05f,
+	-8.154997e-05f,
+	6.638734e-05f,
+	-5.589864e-05f,
+	4.581059e-05f,
+	-3.897525e-05f,
+	3.181082e-05f,
+	-2.716024e-05f,
+	2.189129e-05f,
+	-1.868341e-05f,
+	1.475684e-05f,
+	-1.256584e-05f,
+	9.643300e-06f,
+	-8.192228e-06f,
+	6.040949e-06f,
+	-5.129759e-06f,
+	3.574792e-06f,
+	-3.048607e-06f,
+	1.951867e-06f,
+	-1.687295e-06f,
+	9.387588e-07f,
+	-8.383145e-07f,
+	3.524942e-07f,
+	-3.422818e-07f,
+	5.650104e-08f,
+	-8.464719e-08f,
+	-4.267648e-08f,
+	8.099599e-09f,
+
+	2.086157e-11f,
+	2.728968e-08f,
+	-1.855356e-07f,
+	2.402315e-07f,
+	-5.840087e-07f,
+	7.109530e-07f,
+	-1.296124e-06f,
+	1.562731e-06f,
+	-2.468718e-06f,
+	2.966837e-06f,
+	-4.298386e-06f,
+	5.146291e-06f,
+	-7.036168e-06f,
+	8.382653e-06f,
+	-1.099811e-05f,
+	1.303265e-05f,
+	-1.659119e-05f,
+	1.956814e-05f,
+	-2.437431e-05f,
+	2.866874e-05f,
+	-3.519934e-05f,
+	4.143862e-05f,
+	-5.055000e-05f,
+	5.994953e-05f,
+	-7.344139e-05f,
+	8.879654e-05f,
+	-1.112635e-04f,
+	1.406789e-04f,
+	-1.878136e-04f,
+	2.659341e-04f,
+	-4.313165e-04f,
+	9.206794e-04f,
+	-4.905239e-04f,
+	-1.891854e-04f,
+	1.692454e-04f,
+	-1.358444e-04f,
+	1.079576e-04f,
+	-8.859311e-05f,
+	7.201483e-05f,
+	-6.048064e-05f,
+	4.958624e-05f,
+	-4.210696e-05f,
+	3.441820e-05f,
+	-2.933197e-05f,
+	2.369894e-05f,
+	-2.018284e-05f,
+	1.599624e-05f,
+	-1.358376e-05f,
+	1.047461e-05f,
+	-8.864916e-06f,
+	6.581215e-06f,
+	-5.558287e-06f,
+	3.911509e-06f,
+	-3.308708e-06f,
+	2.150421e-06f,
+	-1.835172e-06f,
+	1.047177e-06f,
+	-9.147212e-07f,
+	4.050892e-07f,
+	-3.758819e-07f,
+	7.704755e-08f,
+	-9.505782e-08f,
+	-3.801563e-08f,
+	7.501304e-09f,
+
+	2.923700e-11f,
+	2.765463e-08f,
+	-1.896106e-07f,
+	2.495558e-07f,
+	-6.027864e-07f,
+	7.418792e-07f,
+	-1.344869e-06f,
+	1.633785e-06f,
+	-2.569891e-06f,
+	3.105114e-06f,
+	-4.484441e-06f,
+	5.390364e-06f,
+	-7.352597e-06f,
+	8.785787e-06f,
+	-1.150690e-05f,
+	1.366667e-05f,
+	-1.737534e-05f,
+	2.052890e-05f,
+	-2.554478e-05f,
+	3.008534e-05f,
+	-3.690768e-05f,
+	4.349136e-05f,
+	-5.301454e-05f,
+	6.290904e-05f,
+	-7.700769e-05f,
+	9.312062e-05f,
+	-1.165665e-04f,
+	1.473000e-04f,
+	-1.963271e-04f,
+	2.774251e-04f,
+	-4.482307e-04f,
+	9.500055e-04f,
+	-3.539179e-04f,
+	-2.222579e-04f,
+	1.870847e-04f,
+	-1.477521e-04f,
+	1.167107e-04f,
+	-9.537154e-05f,
+	7.743014e-05f,
+	-6.488949e-05f,
+	5.321907e-05f,
+	-4.512013e-05f,
+	3.692689e-05f,
+	-3.142151e-05f,
+	2.543823e-05f,
+	-2.162562e-05f,
+	1.718888e-05f,
+	-1.456332e-05f,
+	1.127467e-05f,
+	-9.512337e-06f,
+	7.101249e-06f,
+	-5.970788e-06f,
+	4.235686e-06f,
+	-3.559134e-06f,
+	2.341634e-06f,
+	-1.977589e-06f,
+	1.151630e-06f,
+	-9.883362e-07f,
+	4.557962e-07f,
+	-4.082750e-07f,
+	9.688473e-08f,
+	-1.051056e-07f,
+	-3.349649e-08f,
+	6.929151e-09f,
+
+	4.007222e-11f,
+	2.794912e-08f,
+	-1.934443e-07f,
+	2.583474e-07f,
+	-6.205959e-07f,
+	7.712269e-07f,
+	-1.391214e-06f,
+	1.701359e-06f,
+	-2.666193e-06f,
+	3.236761e-06f,
+	-4.661669e-06f,
+	5.622893e-06f,
+	-7.654162e-06f,
+	9.170035e-06f,
+	-1.199198e-05f,
+	1.427119e-05f,
+	-1.812314e-05f,
+	2.144520e-05f,
+	-2.666120e-05f,
+	3.143661e-05f,
+	-3.853734e-05f,
+	4.544955e-05f,
+	-5.536557e-05f,
+	6.573203e-05f,
+	-8.040917e-05f,
+	9.724404e-05f,
+	-1.216219e-04f,
+	1.536086e-04f,
+	-2.044313e-04f,
+	2.883441e-04f,
+	-4.642329e-04f,
+	9.772060e-04f,
+	-2.242676e-04f,
+	-2.540183e-04f,
+	2.042089e-04f,
+	-1.591765e-04f,
+	1.251053e-04f,
+	-1.018708e-04f,
+	8.262157e-05f,
+	-6.911562e-05f,
+	5.670115e-05f,
+	-4.800816e-05f,
+	3.933140e-05f,
+	-3.342429e-05f,
+	2.710539e-05f,
+	-2.300859e-05f,
+	1.833218e-05f,
+	-1.550238e-05f,
+	1.204173e-05f,
+	-1.013310e-05f,
+	7.599942e-06f,
+	-6.366387e-06f,
+	4.546640e-06f,
+	-3.799362e-06f,
+	2.525112e-06f,
+	-2.114253e-06f,
+	1.251909e-06f,
+	-1.059013e-06f,
+	5.045175e-07f,
+	-4.394000e-07f,
+	1.159779e-07f,
+	-1.147739e-07f,
+	-2.912464e-08f,
+	6.383562e-09f,
+
+	5.385343e-11f,
+	2.816751e-08f,
+	-1.970202e-07f,
+	2.665722e-07f,
+	-6.373774e-07f,
+	7.989008e-07f,
+	-1.435014e-06f,
+	1.765247e-06f,
+	-2.757343e-06f,
+	3.361396e-06f,
+	-4.829562e-06f,
+	5.843219e-06f,
+	-7.940017e-06f,
+	9.534326e-06f,
+	-1.245199e-05f,
+	1.484456e-05f,
+	-1.883255e-05f,
+	2.231453e-05f,
+	-2.772055e-05f,
+	3.271888e-05f,
+	-4.008389e-05f,
+	4.730790e-05f,
+	-5.759673e-05f,
+	6.841090e-05f,
+	-8.363656e-05f,
+	1.011555e-04f,
+	-1.264156e-04f,
+	1.595868e-04f,
+	-2.121027e-04f,
+	2.986574e-04f,
+	-4.792659e-04f,
+	1.002122e-03f,
+	-1.014833e-04f,
+	-2.844145e-04f,
+	2.205857e-04f,
+	-1.700944e-04f,
+	1.331240e-04f,
+	-1.080771e-04f,
+	8.757804e-05f,
+	-7.314995e-05f,
+	6.002497e-05f,
+	-5.076481e-05f,
+	4.162654e-05f,
+	-3.533599e-05f,
+	2.869680e-05f,
+	-2.432878e-05f,
+	1.942367e-05f,
+	-1.639896e-05f,
+	1.277418e-05f,
+	-1.072589e-05f,
+	8.076244e-06f,
+	-6.744255e-06f,
+	4.843726e-06f,
+	-4.028896e-06f,
+	2.700481e-06f,
+	-2.244890e-06f,
+	1.347814e-06f,
+	-1.126613e-06f,
+	5.511616e-07f,
+	-4.692000e-07f,
+	1.342949e-07f,
+	-1.240474e-07f,
+	-2.490504e-08f,
+	5.864800e-09f,
+
+	7.111903e-11f,
+	2.830409e-08f,
+	-2.003218e-07f,
+	2.741968e-07f,
+	-6.530726e-07f,
+	8.248085e-07f,
+	-1.476133e-06f,
+	1.825254e-06f,
+	-2.843066e-06f,
+	3.478649e-06f,
+	-4.987630e-06f,
+	6.050705e-06f,
+	-8.209347e-06f,
+	9.877627e-06f,
+	-1.288564e-05f,
+	1.538517e-05f,
+	-1.950159e-05f,
+	2.313450e-05f,
+	-2.871992e-05f,
+	3.392863e-05f,
+	-4.154312e-05f,
+	4.906135e-05f,
+	-5.970192e-05f,
+	7.093828e-05f,
+	-8.668099e-05f,
+	1.048441e-04f,
+	-1.309341e-04f,
+	1.652175e-04f,
+	-2.193183e-04f,
+	3.083321e-04f,
+	-4.932741e-04f,
+	1.024592e-03f,
+	1.453000e-05f,
+	-3.133991e-04f,
+	2.361847e-04f,
+	-1.804846e-04f,
+	1.407506e-04f,
+	-1.139775e-04f,
+	9.228911e-05f,
+	-7.698390e-05f,
+	6.318344e-05f,
+	-5.338418e-05f,
+	4.380740e-05f,
+	-3.715251e-05f,
+	3.020908e-05f,
+	-2.558338e-05f,
+	2.046105e-05f,
+	-1.725114e-05f,
+	1.347047e-05f,
+	-1.128947e-05f,
+	8.529167e-06f,
+	-7.103612e-06f,
+	5.126336e-06f,
+	-4.247272e-06f,
+	2.867390e-06f,
+	-2.369240e-06f,
+	1.439161e-06f,
+	-1.191009e-06f,
+	5.956431e-07f,
+	-4.976220e-07f,
+	1.518061e-07f,
+	-1.329123e-07f,
+	-2.084203e-08f,
+	5.372976e-09f,
+
+	9.245984e-11f,
+	2.835316e-08f,
+	-2.033334e-07f,
+	2.811888e-07f,
+	-6.676251e-07f,
+	8.488607e-07f,
+	-1.514437e-06f,
+	1.881188e-06f,
+	-2.923099e-06f,
+	3.588165e-06f,
+	-5.135405e-06f,
+	6.244741e-06f,
+	-8.461371e-06f,
+	1.019895e-05f,
+	-1.329171e-05f,
+	1.589149e-05f,
+	-2.012838e-05f,
+	2.390281e-05f,
+	-2.965652e-05f,
+	3.506251e-05f,
+	-4.291098e-05f,
+	5.070502e-05f,
+	-6.167532e-05f,
+	7.330717e-05f,
+	-8.953398e-05f,
+	1.082996e-04f,
+	-1.351646e-04f,
+	1.704842e-04f,
+	-2.260563e-04f,
+	3.173366e-04f,
+	-5.062031e-04f,
+	1.044456e-03f,
+	1.238718e-04f,
+	-3.409291e-04f,
+	2.509782e-04f,
+	-1.903268e-04f,
+	1.479697e-04f,
+	-1.195600e-04f,
+	9.674500e-05f,
+	-8.060945e-05f,
+	6.616991e-05f,
+	-5.586076e-05f,
+	4.586937e-05f,
+	-3.887002e-05f,
+	3.163903e-05f,
+	-2.676976e-05f,
+	2.144214e-05f,
+	-1.805716e-05f,
+	1.412916e-05f,
+	-1.182267e-05f,
+	8.957783e-06f,
+	-7.443729e-06f,
+	5.393905e-06f,
+	-4.454054e-06f,
+	3.025513e-06f,
+	-2.487063e-06f,
+	1.525776e-06f,
+	-1.252080e-06f,
+	6.378832e-07f,
+	-5.246172e-07f,
+	1.684842e-07f,
+	-1.413560e-07f,
+	-1.693936e-08f,
+	4.908061e-09f,
+
+	1.185188e-10f,
+	2.830900e-08f,
+	-2.060390e-07f,
+	2.875165e-07f,
+	-6.809805e-07f,
+	8.709714e-07f,
+	-1.549799e-06f,
+	1.932867e-06f,
+	-2.997190e-06f,
+	3.689605e-06f,
+	-5.272438e-06f,
+	6.424745e-06f,
+	-8.695343e-06f,
+	1.049736e-05f,
+	-1.366901e-05f,
+	1.636206e-05f,
+	-2.071114e-05f,
+	2.461728e-05f,
+	-3.052770e-05f,
+	3.611732e-05f,
+	-4.418363e-05f,
+	5.223432e-05f,
+	-6.351139e-05f,
+	7.551091e-05f,
+	-9.218745e-05f,
+	1.115120e-04f,
+	-1.390949e-04f,
+	1.753713e-04f,
+	-2.322957e-04f,
+	3.256404e-04f,
+	-5.180003e-04f,
+	1.061551e-03f,
+	2.266466e-04f,
+	-3.669661e-04f,
+	2.649406e-04f,
+	-1.996028e-04f,
+	1.547673e-04f,
+	-1.248134e-04f,
+	1.009366e-04f,
+	-8.401912e-05f,
+	6.897819e-05f,
+	-5.818937e-05f,
+	4.780815e-05f,
+	-4.048494e-05f,
+	3.298370e-05f,
+	-2.788545e-05f,
+	2.236492e-05f,
+	-1.881536e-05f,
+	1.474891e-05f,
+	-1.232443e-05f,
+	9.361236e-06f,
+	-7.763931e-06f,
+	5.645906e-06f,
+	-4.648841e-06f,
+	3.174547e-06f,
+	-2.598136e-06f,
+	1.607502e-06f,
+	-1.309717e-06f,
+	6.778096e-07f,
+	-5.501412e-07f,
+	1.843050e-07f,
+	-1.493674e-07f,
+	-1.320017e-08f,
+	4.469889e-09f,
+
+	1.499903e-10f,
+	2.816594e-08f,
+	-2.084234e-07f,
+	2.931496e-07f,
+	-6.930865e-07f,
+	8.910584e-07f,
+	-1.582096e-06f,
+	1.980117e-06f,
+	-3.065100e-06f,
+	3.782645e-06f,
+	-5.398303e-06f,
+	6.590166e-06f,
+	-8.910558e-06f,
+	1.077195e-05f,
+	-1.401643e-05f,
+	1.679550e-05f,
+	-2.124816e-05f,
+	2.527584e-05f,
+	-3.133097e-05f,
+	3.709003e-05f,
+	-4.535744e-05f,
+	5.364488e-05f,
+	-6.520488e-05f,
+	7.754317e-05f,
+	-9.463375e-05f,
+	1.144720e-04f,
+	-1.427131e-04f,
+	1.798638e-04f,
+	-2.380165e-04f,
+	3.332143e-04f,
+	-5.286148e-04f,
+	1.075714e-03f,
+	3.229635e-04f,
+	-3.914761e-04f,
+	2.780486e-04f,
+	-2.082955e-04f,
+	1.611302e-04f,
+	-1.297273e-04f,
+	1.048555e-04f,
+	-8.720599e-05f,
+	7.160255e-05f,
+	-6.036526e-05f,
+	4.961978e-05f,
+	-4.199398e-05f,
+	3.424033e-05f,
+	-2.892819e-05f,
+	2.322752e-05f,
+	-1.952421e-05f,
+	1.532847e-05f,
+	-1.279373e-05f,
+	9.738732e-06f,
+	-8.063592e-06f,
+	5.881854e-06f,
+	-4.831263e-06f,
+	3.314216e-06f,
+	-2.702257e-06f,
+	1.684192e-06f,
+	-1.363820e-06f,
+	7.153564e-07f,
+	-5.741539e-07f,
+	1.992463e-07f,
+	-1.569370e-07f,
+	-9.627003e-09f,
+	4.058171e-09f,
+
+	1.876185e-10f,
+	2.791835e-08f,
+	-2.104717e-07f,
+	2.980585e-07f,
+	-7.038930e-07f,
+	9.090433e-07f,
+	-1.611212e-06f,
+	2.022774e-06f,
+	-3.126601e-06f,
+	3.866982e-06f,
+	-5.512599e-06f,
+	6.740480e-06f,
+	-9.106348e-06f,
+	1.102190e-05f,
+	-1.433292e-05f,
+	1.719052e-05f,
+	-2.173786e-05f,
+	2.587654e-05f,
+	-3.206396e-05f,
+	3.797782e-05f,
+	-4.642900e-05f,
+	5.493259e-05f,
+	-6.675089e-05f,
+	7.939803e-05f,
+	-9.686571e-05f,
+	1.171707e-04f,
+	-1.460084e-04f,
+	1.839477e-04f,
+	-2.431999e-04f,
+	3.400307e-04f,
+	-5.379976e-04f,
+	1.086782e-03f,
+	4.129360e-04f,
+	-4.144299e-04f,
+	2.902816e-04f,
+	-2.163896e-04f,
+	1.670466e-04f,
+	-1.342922e-04f,
+	1.084940e-04f,
+	-9.016374e-05f,
+	7.403773e-05f,
+	-6.238406e-05f,
+	5.130062e-05f,
+	-4.339409e-05f,
+	3.540641e-05f,
+	-2.989590e-05f,
+	2.402824e-05f,
+	-2.018231e-05f,
+	1.586673e-05f,
+	-1.322967e-05f,
+	1.008954e-05f,
+	-8.342144e-06f,
+	6.101309e-06f,
+	-5.000982e-06f,
+	3.444264e-06f,
+	-2.799239e-06f,
+	1.755714e-06f,
+	-1.414299e-06f,
+	7.504647e-07f,
+	-5.966194e-07f,
+	2.132890e-07f,
+	-1.640562e-07f,
+	-6.221837e-09f,
+	3.672504e-09f,
+
+	2.321959e-10f,
+	2.756067e-08f,
+	-2.121695e-07f,
+	3.022153e-07f,
+	-7.133523e-07f,
+	9.248517e-07f,
+	-1.637038e-06f,
+	2.060682e-06f,
+	-3.181480e-06f,
+	3.942327e-06f,
+	-5.614947e-06f,
+	6.875201e-06f,
+	-9.282090e-06f,
+	1.124640e-05f,
+	-1.461749e-05f,
+	1.754589e-05f,
+	-2.217874e-05f,
+	2.641759e-05f,
+	-3.272448e-05f,
+	3.877803e-05f,
+	-4.739510e-05f,
+	5.609364e-05f,
+	-6.814480e-05f,
+	8.106996e-05f,
+	-9.887660e-05f,
+	1.196000e-04f,
+	-1.489706e-04f,
+	1.876098e-04f,
+	-2.478279e-04f,
+	3.460635e-04f,
+	-5.461018e-04f,
+	1.094593e-03f,
+	4.966819e-04f,
+	-4.358022e-04f,
+	3.016210e-04f,
+	-2.238713e-04f,
+	1.725058e-04f,
+	-1.384996e-04f,
+	1.118452e-04f,
+	-9.288661e-05f,
+	7.627897e-05f,
+	-6.424179e-05f,
+	5.284735e-05f,
+	-4.468253e-05f,
+	3.647965e-05f,
+	-3.078668e-05f,
+	2.476552e-05f,
+	-2.078841e-05f,
+	1.636264e-05f,
+	-1.363143e-05f,
+	1.041302e-05f,
+	-8.599071e-06f,
+	6.303871e-06f,
+	-5.157694e-06f,
+	3.564468e-06f,
+	-2.888918e-06f,
+	1.821951e-06f,
+	-1.461071e-06f,
+	7.830820e-07f,
+	-6.175062e-07f,
+	2.264164e-07f,
+	-1.707183e-07f,
+	-2.986084e-09f,
+	3.312378e-09f,
+
+	2.845606e-10f,
+	2.708744e-08f,
+	-2.135029e-07f,
+	3.055933e-07f,
+	-7.214194e-07f,
+	9.384138e-07f,
+	-1.659471e-06f,
+	2.093696e-06f,
+	-3.229538e-06f,
+	4.008414e-06f,
+	-5.704996e-06f,
+	6.993872e-06f,
+	-9.437204e-06f,
+	1.144473e-05f,
+	-1.486924e-05f,
+	1.786049e-05f,
+	-2.256942e-05f,
+	2.689728e-05f,
+	-3.331049e-05f,
+	3.948820e-05f,
+	-4.825282e-05f,
+	5.712447e-05f,
+	-6.938237e-05f,
+	8.255382e-05f,
+	-1.006602e-04f,
+	1.217523e-04f,
+	-1.515900e-04f,
+	1.908378e-04f,
+	-2.518842e-04f,
+	3.512879e-04f,
+	-5.528826e-04f,
+	1.098981e-03f,
+	5.743231e-04f,
+	-4.555723e-04f,
+	3.120507e-04f,
+	-2.307285e-04f,
+	1.774983e-04f,
+	-1.423418e-04f,
+	1.149028e-04f,
+	-9.536946e-05f,
+	7.832201e-05f,
+	-6.593491e-05f,
+	5.425702e-05f,
+	-4.585682e-05f,
+	3.745801e-05f,
+	-3.159885e-05f,
+	2.543798e-05f,
+	-2.134136e-05f,
+	1.681529e-05f,
+	-1.399827e-05f,
+	1.070858e-05f,
+	-8.833917e-06f,
+	6.489187e-06f,
+	-5.301131e-06f,
+	3.674623e-06f,
+	-2.971145e-06f,
+	1.882799e-06f,
+	-1.504068e-06f,
+	8.131631e-07f,
+	-6.367873e-07f,
+	2.386143e-07f,
+	-1.769176e-07f,
+	7.938866e-11f,
+	2.977188e-09f,
+
+	3.455937e-10f,
+	2.649330e-08f,
+	-2.144588e-07f,
+	3.081671e-07f,
+	-7.280522e-07f,
+	9.496644e-07f,
+	-1.678415e-06f,
+	2.121682e-06f,
+	-3.270589e-06f,
+	4.064995e-06f,
+	-5.782422e-06f,
+	7.096075e-06f,
+	-9.571154e-06f,
+	1.161622e-05f,
+	-1.508731e-05f,
+	1.813329e-05f,
+	-2.290863e-05f,
+	2.731408e-05f,
+	-3.382013e-05f,
+	4.010609e-05f,
+	-4.899943e-05f,
+	5.802186e-05f,
+	-7.045970e-05f,
+	8.384493e-05f,
+	-1.022109e-04f,
+	1.236205e-04f,
+	-1.538580e-04f,
+	1.936205e-04f,
+	-2.553532e-04f,
+	3.556809e-04f,
+	-5.582977e-04f,
+	1.099786e-03f,
+	6.459854e-04f,
+	-4.737240e-04f,
+	3.215572e-04f,
+	-2.369507e-04f,
+	1.820159e-04f,
+	-1.458122e-04f,
+	1.176613e-04f,
+	-9.760776e-05f,
+	8.016306e-05f,
+	-6.746026e-05f,
+	5.552700e-05f,
+	-4.691480e-05f,
+	3.833968e-05f,
+	-3.233092e-05f,
+	2.604437e-05f,
+	-2.184017e-05f,
+	1.722388e-05f,
+	-1.432954e-05f,
+	1.097570e-05f,
+	-9.046279e-06f,
+	6.656947e-06f,
+	-5.431058e-06f,
+	3.774557e-06f,
+	-3.045795e-06f,
+	1.938168e-06f,
+	-1.543229e-06f,
+	8.406690e-07f,
+	-6.544401e-07f,
+	2.498714e-07f,
+	-1.826498e-07f,
+	2.974248e-09f,
+	2.666244e-09f,
+
+	4.162155e-10f,
+	2.577305e-08f,
+	-2.150244e-07f,
+	3.099132e-07f,
+	-7.332113e-07f,
+	9.585430e-07f,
+	-1.693783e-06f,
+	2.144514e-06f,
+	-3.304465e-06f,
+	4.111845e-06f,
+	-5.846928e-06f,
+	7.181426e-06f,
+	-9.683455e-06f,
+	1.176025e-05f,
+	-1.527097e-05f,
+	1.836334e-05f,
+	-2.319523e-05f,
+	2.766659e-05f,
+	-3.425169e-05f,
+	4.062965e-05f,
+	-4.963249e-05f,
+	5.878285e-05f,
+	-7.137325e-05f,
+	8.493903e-05f,
+	-1.035234e-04f,
+	1.251982e-04f,
+	-1.557666e-04f,
+	1.959475e-04f,
+	-2.582209e-04f,
+	3.592215e-04f,
+	-5.623071e-04f,
+	1.096845e-03f,
+	7.117987e-04f,
+	-4.902449e-04f,
+	3.301293e-04f,
+	-2.425289e-04f,
+	1.860513e-04f,
+	-1.489049e-04f,
+	1.201160e-04f,
+	-9.959760e-05f,
+	8.179887e-05f,
+	-6.881514e-05f,
+	5.665504e-05f,
+	-4.785458e-05f,
+	3.912310e-05f,
+	-3.298159e-05f,
+	2.658366e-05f,
+	-2.228398e-05f,
+	1.758770e-05f,
+	-1.462469e-05f,
+	1.121395e-05f,
+	-9.235815e-06f,
+	6.806887e-06f,
+	-5.547272e-06f,
+	3.864120e-06f,
+	-3.112759e-06f,
+	1.987984e-06f,
+	-1.578502e-06f,
+	8.655679e-07f,
+	-6.704462e-07f,
+	2.601787e-07f,
+	-1.879121e-07f,
+	5.698670e-09f,
+	2.378776e-09f,
+
+	4.973816e-10f,
+	2.492165e-08f,
+	-2.151880e-07f,
+	3.108093e-07f,
+	-7.368605e-07f,
+	9.649941e-07f,
+	-1.705493e-06f,
+	2.162080e-06f,
+	-3.331012e-06f,
+	4.148758e-06f,
+	-5.898246e-06f,
+	7.249582e-06f,
+	-9.773667e-06f,
+	1.187628e-05f,
+	-1.541950e-05f,
+	1.854980e-05f,
+	-2.342818e-05f,
+	2.795355e-05f,
+	-3.460368e-05f,
+	4.105706e-05f,
+	-5.014983e-05f,
+	5.940483e-05f,
+	-7.211988e-05f,
+	8.583230e-05f,
+	-1.045931e-04f,
+	1.264799e-04f,
+	-1.573085e-04f,
+	1.978096e-04f,
+	-2.604746e-04f,
+	3.618901e-04f,
+	-5.648737e-04f,
+	1.089995e-03f,
+	7.718960e-04f,
+	-5.051271e-04f,
+	3.377580e-04f,
+	-2.474559e-04f,
+	1.895987e-04f,
+	-1.516153e-04f,
+	1.222629e-04f,
+	-1.013357e-04f,
+	8.322670e-05f,
+	-6.999725e-05f,
+	5.763921e-05f,
+	-4.867456e-05f,
+	3.980695e-05f,
+	-3.354979e-05f,
+	2.705495e-05f,
+	-2.267205e-05f,
+	1.790618e-05f,
+	-1.488325e-05f,
+	1.142296e-05f,
+	-9.402237e-06f,
+	6.938786e-06f,
+	-5.649611e-06f,
+	3.943191e-06f,
+	-3.171951e-06f,
+	2.032185e-06f,
+	-1.609848e-06f,
+	8.878348e-07f,
+	-6.847916e-07f,
+	2.695299e-07f,
+	-1.927029e-07f,
+	8.253330e-09f,
+	2.113950e-09f,
+
+	5.900787e-10f,
+	2.393426e-08f,
+	-2.149384e-07f,
+	3.108353e-07f,
+	-7.389667e-07f,
+	9.689679e-07f,
+	-1.713473e-06f,
+	2.174281e-06f,
+	-3.350092e-06f,
+	4.175552e-06f,
+	-5.936139e-06f,
+	7.300237e-06f,
+	-9.841406e-06f,
+	1.196381e-05f,
+	-1.553233e-05f,
+	1.869194e-05f,
+	-2.360658e-05f,
+	2.817387e-05f,
+	-3.487475e-05f,
+	4.138673e-05f,
+	-5.054950e-05f,
+	5.988548e-05f,
+	-7.269681e-05f,
+	8.652142e-05f,
+	-1.054160e-04f,
+	1.274604e-04f,
+	-1.584776e-04f,
+	1.991984e-04f,
+	-2.621029e-04f,
+	3.636692e-04f,
+	-5.659628e-04f,
+	1.079075e-03f,
+	8.264142e-04f,
+	-5.183668e-04f,
+	3.444369e-04f,
+	-2.517262e-04f,
+	1.926534e-04f,
+	-1.539393e-04f,
+	1.240988e-04f,
+	-1.028193e-04f,
+	8.444431e-05f,
+	-7.100472e-05f,
+	5.847797e-05f,
+	-4.937347e-05f,
+	4.039016e-05f,
+	-3.403462e-05f,
+	2.745752e-05f,
+	-2.300381e-05f,
+	1.817885e-05f,
+	-1.510485e-05f,
+	1.160243e-05f,
+	-9.545318e-06f,
+	7.052470e-06f,
+	-5.737941e-06f,
+	4.011672e-06f,
+	-3.223301e-06f,
+	2.070724e-06f,
+	-1.637236e-06f,
+	9.074514e-07f,
+	-6.974669e-07f,
+	2.779212e-07f,
+	-1.970219e-07f,
+	1.063937e-08f,
+	1.870873e-09f,
+
+	6.953188e-10f,
+	2.280622e-08f,
+	-2.142652e-07f,
+	3.099726e-07f,
+	-7.395002e-07f,
+	9.704198e-07f,
+	-1.717660e-06f,
+	2.181026e-06f,
+	-3.361587e-06f,
+	4.192070e-06f,
+	-5.960401e-06f,
+	7.333125e-06f,
+	-9.886333e-06f,
+	1.202244e-05f,
+	-1.560892e-05f,
+	1.878910e-05f,
+	-2.372964e-05f,
+	2.832660e-05f,
+	-3.506377e-05f,
+	4.161727e-05f,
+	-5.082986e-05f,
+	6.022284e-05f,
+	-7.310168e-05f,
+	8.700350e-05f,
+	-1.059885e-04f,
+	1.281355e-04f,
+	-1.592683e-04f,
+	2.001069e-04f,
+	-2.630957e-04f,
+	3.645431e-04f,
+	-5.655430e-04f,
+	1.063927e-03f,
+	8.754930e-04f,
+	-5.299639e-04f,
+	3.501620e-04f,
+	-2.553356e-04f,
+	1.952121e-04f,
+	-1.558741e-04f,
+	1.256213e-04f,
+	-1.040465e-04f,
+	8.545000e-05f,
+	-7.183614e-05f,
+	5.917013e-05f,
+	-4.995029e-05f,
+	4.087192e-05f,
+	-3.443542e-05f,
+	2.779082e-05f,
+	-2.327882e-05f,
+	1.840535e-05f,
+	-1.528920e-05f,
+	1.175214e-05f,
+	-9.664887e-06f,
+	7.147811e-06f,
+	-5.812169e-06f,
+	4.069496e-06f,
+	-3.266761e-06f,
+	2.103569e-06f,
+	-1.660645e-06f,
+	9.244060e-07f,
+	-7.084664e-07f,
+	2.853513e-07f,
+	-2.008698e-07f,
+	1.285839e-08f,
+	1.648604e-09f,
+
+	8.141346e-10f,
+	2.153315e-08f,
+	-2.131591e-07f,
+	3.082048e-07f,
+	-7.384349e-07f,
+	9.693107e-07f,
+	-1.717998e-06f,
+	2.182239e-06f,
+	-3.365392e-06f,
+	4.198175e-06f,
+	-5.970855e-06f,
+	7.348024e-06f,
+	-9.908167e-06f,
+	1.205180e-05f,
+	-1.564884e-05f,
+	1.884076e-05f,
+	-2.379671e-05f,
+	2.841094e-05f,
+	-3.516978e-05f,
+	4.174756e-05f,
+	-5.098956e-05f,
+	6.041526e-05f,
+	-7.333251e-05f,
+	8.727617e-05f,
+	-1.063079e-04f,
+	1.285015e-04f,
+	-1.596760e-04f,
+	2.005290e-04f,
+	-2.634445e-04f,
+	3.644982e-04f,
+	-5.635857e-04f,
+	1.044392e-03f,
+	9.192753e-04f,
+	-5.399227e-04f,
+	3.549315e-04f,
+	-2.582819e-04f,
+	1.972725e-04f,
+	-1.574178e-04f,
+	1.268288e-04f,
+	-1.050158e-04f,
+	8.624258e-05f,
+	-7.249050e-05f,
+	5.971485e-05f,
+	-5.040435e-05f,
+	4.125164e-05f,
+	-3.475172e-05f,
+	2.805447e-05f,
+	-2.349676e-05f,
+	1.858543e-05f,
+	-1.543612e-05f,
+	1.187196e-05f,
+	-9.760834e-06f,
+	7.224725e-06f,
+	-5.872233e-06f,
+	4.116620e-06f,
+	-3.302303e-06f,
+	2.130702e-06f,
+	-1.680066e-06f,
+	9.386940e-07f,
+	-7.177892e-07f,
+	2.918212e-07f,
+	-2.042489e-07f,
+	1.491243e-08f,
+	1.446162e-09f,
+
+	9.475727e-10f,
+	2.011092e-08f,
+	-2.116115e-07f,
+	3.055171e-07f,
+	-7.357481e-07f,
+	9.656076e-07f,
+	-1.714441e-06f,
+	2.177857e-06f,
+	-3.361424e-06f,
+	4.193756e-06f,
+	-5.967359e-06f,
+	7.344750e-06f,
+	-9.906680e-06f,
+	1.205160e-05f,
+	-1.565173e-05f,
+	1.884649e-05f,
+	-2.380727e-05f,
+	2.842628e-05f,
+	-3.519204e-05f,
+	4.177668e-05f,
+	-5.102750e-05f,
+	6.046144e-05f,
+	-7.338773e-05f,
+	8.733755e-05f,
+	-1.063716e-04f,
+	1.285556e-04f,
+	-1.596972e-04f,
+	2.004598e-04f,
+	-2.631424e-04f,
+	3.635230e-04f,
+	-5.600654e-04f,
+	1.020314e-03f,
+	9.579069e-04f,
+	-5.482509e-04f,
+	3.587458e-04f,
+	-2.605643e-04f,
+	1.988335e-04f,
+	-1.585695e-04f,
+	1.277203e-04f,
+	-1.057264e-04f,
+	8.682138e-05f,
+	-7.296724e-05f,
+	6.011166e-05f,
+	-5.073525e-05f,
+	4.152902e-05f,
+	-3.498326e-05f,
+	2.824826e-05f,
+	-2.365748e-05f,
+	1.871897e-05f,
+	-1.554550e-05f,
+	1.196179e-05f,
+	-9.833102e-06f,
+	7.283174e-06f,
+	-5.918107e-06f,
+	4.153027e-06f,
+	-3.329918e-06f,
+	2.152119e-06f,
+	-1.695498e-06f,
+	9.503170e-07f,
+	-7.254384e-07f,
+	2.973346e-07f,
+	-2.071624e-07f,
+	1.680392e-08f,
+	1.262535e-09f,
+
+	1.096688e-09f,
+	1.853568e-08f,
+	-2.096148e-07f,
+	3.018971e-07f,
+	-7.314210e-07f,
+	9.592834e-07f,
+	-1.706950e-06f,
+	2.167830e-06f,
+	-3.349615e-06f,
+	4.178727e-06f,
+	-5.949802e-06f,
+	7.323166e-06f,
+	-9.881697e-06f,
+	1.202165e-05f,
+	-1.561735e-05f,
+	1.880596e-05f,
+	-2.376095e-05f,
+	2.837215e-05f,
+	-3.512998e-05f,
+	4.170397e-05f,
+	-5.094290e-05f,
+	6.036044e-05f,
+	-7.326622e-05f,
+	8.718625e-05f,
+	-1.061782e-04f,
+	1.282957e-04f,
+	-1.593289e-04f,
+	1.998955e-04f,
+	-2.621836e-04f,
+	3.616080e-04f,
+	-5.549600e-04f,
+	9.915361e-04f,
+	9.915361e-04f,
+	-5.549600e-04f,
+	3.616080e-04f,
+	-2.621836e-04f,
+	1.998955e-04f,
+	-1.593289e-04f,
+	1.282957e-04f,
+	-1.061782e-04f,
+	8.718625e-05f,
+	-7.326622e-05f,
+	6.036044e-05f,
+	-5.094290e-05f,
+	4.170397e-05f,
+	-3.512998e-05f,
+	2.837215e-05f,
+	-2.376095e-05f,
+	1.880596e-05f,
+	-1.561735e-05f,
+	1.202165e-05f,
+	-9.881697e-06f,
+	7.323166e-06f,
+	-5.949802e-06f,
+	4.178727e-06f,
+	-3.349615e-06f,
+	2.167830e-06f,
+	-1.706950e-06f,
+	9.592834e-07f,
+	-7.314210e-07f,
+	3.018971e-07f,
+	-2.096148e-07f,
+	1.853568e-08f,
+	1.096688e-09f,
+
+	1.262535e-09f,
+	1.680392e-08f,
+	-2.071624e-07f,
+	2.973346e-07f,
+	-7.254384e-07f,
+	9.503170e-07f,
+	-1.695498e-06f,
+	2.152119e-06f,
+	-3.329918e-06f,
+	4.153027e-06f,
+	-5.918107e-06f,
+	7.283174e-06f,
+	-9.833102e-06f,
+	1.196179e-05f,
+	-1.554550e-05f,
+	1.871897e-05f,
+	-2.365748e-05f,
+	2.824826e-05f,
+	-3.498326e-05f,
+	4.152902e-05f,
+	-5.073525e-05f,
+	6.011166e-05f,
+	-7.296724e-05f,
+	8.682138e-05f,
+	-1.057264e-04f,
+	1.277203e-04f,
+	-1.585695e-04f,
+	1.988335e-04f,
+	-2.605643e-04f,
+	3.587458e-04f,
+	-5.482509e-04f,
+	9.579069e-04f,
+	1.020314e-03f,
+	-5.600654e-04f,
+	3.635230e-04f,
+	-2.631424e-04f,
+	2.004598e-04f,
+	-1.596972e-04f,
+	1.285556e-04f,
+	-1.063716e-04f,
+	8.733755e-05f,
+	-7.338773e-05f,
+	6.046144e-05f,
+	-5.102750e-05f,
+	4.177668e-05f,
+	-3.519204e-05f,
+	2.842628e-05f,
+	-2.380727e-05f,
+	1.884649e-05f,
+	-1.565173e-05f,
+	1.205160e-05f,
+	-9.906680e-06f,
+	7.344750e-06f,
+	-5.967359e-06f,
+	4.193756e-06f,
+	-3.361424e-06f,
+	2.177857e-06f,
+	-1.714441e-06f,
+	9.656076e-07f,
+	-7.357481e-07f,
+	3.055171e-07f,
+	-2.116115e-07f,
+	2.011092e-08f,
+	9.475727e-10f,
+
+	1.446162e-09f,
+	1.491243e-08f,
+	-2.042489e-07f,
+	2.918212e-07f,
+	-7.177892e-07f,
+	9.386940e-07f,
+	-1.680066e-06f,
+	2.130702e-06f,
+	-3.302303e-06f,
+	4.116620e-06f,
+	-5.872233e-06f,
+	7.224725e-06f,
+	-9.760834e-06f,
+	1.187196e-05f,
+	-1.543612e-05f,
+	1.858543e-05f,
+	-2.349676e-05f,
+	2.805447e-05f,
+	-3.475172e-05f,
+	4.125164e-05f,
+	-5.040435e-05f,
+	5.971485e-05f,
+	-7.249050e-05f,
+	8.624258e-05f,
+	-1.050158e-04f,
+	1.268288e-04f,
+	-1.574178e-04f,
+	1.972725e-04f,
+	-2.582819e-04f,
+	3.549315e-04f,
+	-5.399227e-04f,
+	9.192753e-04f,
+	1.044392e-03f,
+	-5.635857e-04f,
+	3.644982e-04f,
+	-2.634445e-04f,
+	2.005290e-04f,
+	-1.596760e-04f,
+	1.285015e-04f,
+	-1.063079e-04f,
+	8.727617e-05f,
+	-7.333251e-05f,
+	6.041526e-05f,
+	-5.098956e-05f,
+	4.174756e-05f,
+	-3.516978e-05f,
+	2.841094e-05f,
+	-2.379671e-05f,
+	1.884076e-05f,
+	-1.564884e-05f,
+	1.205180e-05f,
+	-9.908167e-06f,
+	7.348024e-06f,
+	-5.970855e-06f,
+	4.198175e-06f,
+	-3.365392e-06f,
+	2.182239e-06f,
+	-1.717998e-06f,
+	9.693107e-07f,
+	-7.384349e-07f,
+	3.082048e-07f,
+	-2.131591e-07f,
+	2.153315e-08f,
+	8.141346e-10f,
+
+	1.648604e-09f,
+	1.285839e-08f,
+	-2.008698e-07f,
+	2.853513e-07f,
+	-7.084664e-07f,
+	9.244060e-07f,
+	-1.660645e-06f,
+	2.103569e-06f,
+	-3.266761e-06f,
+	4.069496e-06f,
+	-5.812169e-06f,
+	7.147811e-06f,
+	-9.664887e-06f,
+	1.175214e-05f,
+	-1.528920e-05f,
+	1.840535e-05f,
+	-2.327882e-05f,
+	2.779082e-05f,
+	-3.443542e-05f,
+	4.087192e-05f,
+	-4.995029e-05f,
+	5.917013e-05f,
+	-7.183614e-05f,
+	8.545000e-05f,
+	-1.040465e-04f,
+	1.256213e-04f,
+	-1.558741e-04f,
+	1.952121e-04f,
+	-2.553356e-04f,
+	3.501620e-04f,
+	-5.299639e-04f,
+	8.754930e-04f,
+	1.063927e-03f,
+	-5.655430e-04f,
+	3.645431e-04f,
+	-2.630957e-04f,
+	2.001069e-04f,
+	-1.592683e-04f,
+	1.281355e-04f,
+	-1.059885e-04f,
+	8.700350e-05f,
+	-7.310168e-05f,
+	6.022284e-05f,
+	-5.082986e-05f,
+	4.161727e-05f,
+	-3.506377e-05f,
+	2.832660e-05f,
+	-2.372964e-05f,
+	1.878910e-05f,
+	-1.560892e-05f,
+	1.202244e-05f,
+	-9.886333e-06f,
+	7.333125e-06f,
+	-5.960401e-06f,
+	4.192070e-06f,
+	-3.361587e-06f,
+	2.181026e-06f,
+	-1.717660e-06f,
+	9.704198e-07f,
+	-7.395002e-07f,
+	3.099726e-07f,
+	-2.142652e-07f,
+	2.280622e-08f,
+	6.953188e-10f,
+
+	1.870873e-09f,
+	1.063937e-08f,
+	-1.970219e-07f,
+	2.779212e-07f,
+	-6.974669e-07f,
+	9.074514e-07f,
+	-1.637236e-06f,
+	2.070724e-06f,
+	-3.223301e-06f,
+	4.011672e-06f,
+	-5.737941e-06f,
+	7.052470e-06f,
+	-9.545318e-06f,
+	1.160243e-05f,
+	-1.510485e-05f,
+	1.817885e-05f,
+	-2.300381e-05f,
+	2.745752e-05f,
+	-3.403462e-05f,
+	4.039016e-05f,
+	-4.937347e-05f,
+	5.847797e-05f,
+	-7.100472e-05f,
+	8.444431e-05f,
+	-1.028193e-04f,
+	1.240988e-04f,
+	-1.539393e-04f,
+	1.926534e-04f,
+	-2.517262e-04f,
+	3.444369e-04f,
+	-5.183668e-04f,
+	8.264142e-04f,
+	1.079075e-03f,
+	-5.659628e-04f,
+	3.636692e-04f,
+	-2.621029e-04f,
+	1.991984e-04f,
+	-1.584776e-04f,
+	1.274604e-04f,
+	-1.054160e-04f,
+	8.652142e-05f,
+	-7.269681e-05f,
+	5.988548e-05f,
+	-5.054950e-05f,
+	4.138673e-05f,
+	-3.487475e-05f,
+	2.817387e-05f,
+	-2.360658e-05f,
+	1.869194e-05f,
+	-1.553233e-05f,
+	1.196381e-05f,
+	-9.841406e-06f,
+	7.300237e-06f,
+	-5.936139e-06f,
+	4.175552e-06f,
+	-3.350092e-06f,
+	2.174281e-06f,
+	-1.713473e-06f,
+	9.689679e-07f,
+	-7.389667e-07f,
+	3.108353e-07f,
+	-2.149384e-07f,
+	2.393426e-08f,
+	5.900787e-10f,
+
+	2.113950e-09f,
+	8.253330e-09f,
+	-1.927029e-07f,
+	2.695299e-07f,
+	-6.847916e-07f,
+	8.878348e-07f,
+	-1.609848e-06f,
+	2.032185e-06f,
+	-3.171951e-06f,
+	3.943191e-06f,
+	-5.649611e-06f,
+	6.938786e-06f,
+	-9.402237e-06f,
+	1.142296e-05f,
+	-1.488325e-05f,
+	1.790618e-05f,
+	-2.267205e-05f,
+	2.705495e-05f,
+	-3.354979e-05f,
+	3.980695e-05f,
+	-4.867456e-05f,
+	5.763921e-05f,
+	-6.999725e-05f,
+	8.322670e-05f,
+	-1.013357e-04f,
+	1.222629e-04f,
+	-1.516153e-04f,
+	1.895987e-04f,
+	-2.474559e-04f,
+	3.377580e-04f,
+	-5.051271e-04f,
+	7.718960e-04f,
+	1.089995e-03f,
+	-5.648737e-04f,
+	3.618901e-04f,
+	-2.604746e-04f,
+	1.978096e-04f,
+	-1.573085e-04f,
+	1.264799e-04f,
+	-1.045931e-04f,
+	8.583230e-05f,
+	-7.211988e-05f,
+	5.940483e-05f,
+	-5.014983e-05f,
+	4.105706e-05f,
+	-3.460368e-05f,
+	2.795355e-05f,
+	-2.342818e-05f,
+	1.854980e-05f,
+	-1.541950e-05f,
+	1.187628e-05f,
+	-9.773667e-06f,
+	7.249582e-06f,
+	-5.898246e-06f,
+	4.148758e-06f,
+	-3.331012e-06f,
+	2.162080e-06f,
+	-1.705493e-06f,
+	9.649941e-07f,
+	-7.368605e-07f,
+	3.108093e-07f,
+	-2.151880e-07f,
+	2.492165e-08f,
+	4.973816e-10f,
+
+	2.378776e-09f,
+	5.698670e-09f,
+	-1.879121e-07f,
+	2.601787e-07f,
+	-6.704462e-07f,
+	8.655679e-07f,
+	-1.578502e-06f,
+	1.987984e-06f,
+	-3.112759e-06f,
+	3.864120e-06f,
+	-5.547272e-06f,
+	6.806887e-06f,
+	-9.235815e-06f,
+	1.121395e-05f,
+	-1.462469e-05f,
+	1.758770e-05f,
+	-2.228398e-05f,
+	2.658366e-05f,
+	-3.298159e-05f,
+	3.912310e-05f,
+	-4.785458e-05f,
+	5.665504e-05f,
+	-6.881514e-05f,
+	8.179887e-05f,
+	-9.959760e-05f,
+	1.201160e-04f,
+	-1.489049e-04f,
+	1.860513e-04f,
+	-2.425289e-04f,
+	3.301293e-04f,
+	-4.902449e-04f,
+	7.117987e-04f,
+	1.096845e-03f,
+	-5.623071e-04f,
+	3.592215e-04f,
+	-2.582209e-04f,
+	1.959475e-04f,
+	-1.557666e-04f,
+	1.251982e-04f,
+	-1.035234e-04f,
+	8.493903e-05f,
+	-7.137325e-05f,
+	5.878285e-05f,
+	-4.963249e-05f,
+	4.062965e-05f,
+	-3.425169e-05f,
+	2.766659e-05f,
+	-2.319523e-05f,
+	1.836334e-05f,
+	-1.527097e-05f,
+	1.176025e-05f,
+	-9.683455e-06f,
+	7.181426e-06f,
+	-5.846928e-06f,
+	4.111845e-06f,
+	-3.304465e-06f,
+	2.144514e-06f,
+	-1.693783e-06f,
+	9.585430e-07f,
+	-7.332113e-07f,
+	3.099132e-07f,
+	-2.150244e-07f,
+	2.577305e-08f,
+	4.162155e-10f,
+
+	2.666244e-09f,
+	2.974248e-09f,
+	-1.826498e-07f,
+	2.498714e-07f,
+	-6.544401e-07f,
+	8.406690e-07f,
+	-1.543229e-06f,
+	1.938168e-06f,
+	-3.045795e-06f,
+	3.774557e-06f,
+	-5.431058e-06f,
+	6.656947e-06f,
+	-9.046279e-06f,
+	1.097570e-05f,
+	-1.432954e-05f,
+	1.722388e-05f,
+	-2.184017e-05f,
+	2.604437e-05f,
+	-3.233092e-05f,
+	3.833968e-05f,
+	-4.691480e-05f,
+	5.552700e-05f,
+	-6.746026e-05f,
+	8.016306e-05f,
+	-9.760776e-05f,
+	1.176613e-04f,
+	-1.458122e-04f,
+	1.820159e-04f,
+	-2.369507e-04f,
+	3.215572e-04f,
+	-4.737240e-04f,
+	6.459854e-04f,
+	1.099786e-03f,
+	-5.582977e-04f,
+	3.556809e-04f,
+	-2.553532e-04f,
+	1.936205e-04f,
+	-1.538580e-04f,
+	1.236205e-04f,
+	-1.022109e-04f,
+	8.384493e-05f,
+	-7.045970e-05f,
+	5.802186e-05f,
+	-4.899943e-05f,
+	4.010609e-05f,
+	-3.382013e-05f,
+	2.731408e-05f,
+	-2.290863e-05f,
+	1.813329e-05f,
+	-1.508731e-05f,
+	1.161622e-05f,
+	-9.571154e-06f,
+	7.096075e-06f,
+	-5.782422e-06f,
+	4.064995e-06f,
+	-3.270589e-06f,
+	2.121682e-06f,
+	-1.678415e-06f,
+	9.496644e-07f,
+	-7.280522e-07f,
+	3.081671e-07f,
+	-2.144588e-07f,
+	2.649330e-08f,
+	3.455937e-10f,
+
+	2.977188e-09f,
+	7.938866e-11f,
+	-1.769176e-07f,
+	2.386143e-07f,
+	-6.367873e-07f,
+	8.131631e-07f,
+	-1.504068e-06f,
+	1.882799e-06f,
+	-2.971145e-06f,
+	3.674623e-06f,
+	-5.301131e-06f,
+	6.489187e-06f,
+	-8.833917e-06f,
+	1.070858e-05f,
+	-1.399827e-05f,
+	1.681529e-05f,
+	-2.134136e-05f,
+	2.543798e-05f,
+	-3.159885e-05f,
+	3.745801e-05f,
+	-4.585682e-05f,
+	5.425702e-05f,
+	-6.593491e-05f,
+	7.832201e-05f,
+	-9.536946e-05f,
+	1.149028e-04f,
+	-1.423418e-04f,
+	1.774983e-04f,
+	-2.307285e-04f,
+	3.120507e-04f,
+	-4.555723e-04f,
+	5.743231e-04f,
+	1.098981e-03f,
+	-5.528826e-04f,
+	3.512879e-04f,
+	-2.518842e-04f,
+	1.908378e-04f,
+	-1.515900e-04f,
+	1.217523e-04f,
+	-1.006602e-04f,
+	8.255382e-05f,
+	-6.938237e-05f,
+	5.712447e-05f,
+	-4.825282e-05f,
+	3.948820e-05f,
+	-3.331049e-05f,
+	2.689728e-05f,
+	-2.256942e-05f,
+	1.786049e-05f,
+	-1.486924e-05f,
+	1.144473e-05f,
+	-9.437204e-06f,
+	6.993872e-06f,
+	-5.704996e-06f,
+	4.008414e-06f,
+	-3.229538e-06f,
+	2.093696e-06f,
+	-1.659471e-06f,
+	9.384138e-07f,
+	-7.214194e-07f,
+	3.055933e-07f,
+	-2.135029e-07f,
+	2.708744e-08f,
+	2.845606e-10f,
+
+	3.312378e-09f,
+	-2.986084e-09f,
+	-1.707183e-07f,
+	2.264164e-07f,
+	-6.175062e-07f,
+	7.830820e-07f,
+	-1.461071e-06f,
+	1.821951e-06f,
+	-2.888918e-06f,
+	3.564468e-06f,
+	-5.157694e-06f,
+	6.303871e-06f,
+	-8.599071e-06f,
+	1.041302e-05f,
+	-1.363143e-05f,
+	1.636264e-05f,
+	-2.078841e-05f,
+	2.476552e-05f,
+	-3.078668e-05f,
+	3.647965e-05f,
+	-4.468253e-05f,
+	5.284735e-05f,
+	-6.424179e-05f,
+	7.627897e-05f,
+	-9.288661e-05f,
+	1.118452e-04f,
+	-1.384996e-04f,
+	1.725058e-04f,
+	-2.238713e-04f,
+	3.016210e-04f,
+	-4.358022e-04f,
+	4.966819e-04f,
+	1.094593e-03f,
+	-5.461018e-04f,
+	3.460635e-04f,
+	-2.478279e-04f,
+	1.876098e-04f,
+	-1.489706e-04f,
+	1.196000e-04f,
+	-9.887660e-05f,
+	8.106996e-05f,
+	-6.814480e-05f,
+	5.609364e-05f,
+	-4.739510e-05f,
+	3.877803e-05f,
+	-3.272448e-05f,
+	2.641759e-05f,
+	-2.217874e-05f,
+	1.754589e-05f,
+	-1.461749e-05f,
+	1.124640e-05f,
+	-9.282090e-06f,
+	6.875201e-06f,
+	-5.614947e-06f,
+	3.942327e-06f,
+	-3.181480e-06f,
+	2.060682e-06f,
+	-1.637038e-06f,
+	9.248517e-07f,
+	-7.133523e-07f,
+	3.022153e-07f,
+	-2.121695e-07f,
+	2.756067e-08f,
+	2.321959e-10f,
+
+	3.672504e-09f,
+	-6.221837e-09f,
+	-1.640562e-07f,
+	2.132890e-07f,
+	-5.966194e-07f,
+	7.504647e-07f,
+	-1.414299e-06f,
+	1.755714e-06f,
+	-2.799239e-06f,
+	3.444264e-06f,
+	-5.000982e-06f,
+	6.101309e-06f,
+	-8.342144e-06f,
+	1.008954e-05f,
+	-1.322967e-05f,
+	1.586673e-05f,
+	-2.018231e-05f,
+	2.402824e-05f,
+	-2.989590e-05f,
+	3.540641e-05f,
+	-4.339409e-05f,
+	5.130062e-05f,
+	-6.238406e-05f,
+	7.403773e-05f,
+	-9.016374e-05f,
+	1.084940e-04f,
+	-1.342922e-04f,
+	1.670466e-04f,
+	-2.163896e-04f,
+	2.902816e-04f,
+	-4.144299e-04f,
+	4.129360e-04f,
+	1.086782e-03f,
+	-5.379976e-04f,
+	3.400307e-04f,
+	-2.431999e-04f,
+	1.839477e-04f,
+	-1.460084e-04f,
+	1.171707e-04f,
+	-9.686571e-05f,
+	7.939803e-05f,
+	-6.675089e-05f,
+	5.493259e-05f,
+	-4.642900e-05f,
+	3.797782e-05f,
+	-3.206396e-05f,
+	2.587654e-05f,
+	-2.173786e-05f,
+	1.719052e-05f,
+	-1.433292e-05f,
+	1.102190e-05f,
+	-9.106348e-06f,
+	6.740480e-06f,
+	-5.512599e-06f,
+	3.866982e-06f,
+	-3.126601e-06f,
+	2.022774e-06f,
+	-1.611212e-06f,
+	9.090433e-07f,
+	-7.038930e-07f,
+	2.980585e-07f,
+	-2.104717e-07f,
+	2.791835e-08f,
+	1.876185e-10f,
+
+	4.058171e-09f,
+	-9.627003e-09f,
+	-1.569370e-07f,
+	1.992463e-07f,
+	-5.741539e-07f,
+	7.153564e-07f,
+	-1.363820e-06f,
+	1.684192e-06f,
+	-2.702257e-06f,
+	3.314216e-06f,
+	-4.831263e-06f,
+	5.881854e-06f,
+	-8.063592e-06f,
+	9.738732e-06f,
+	-1.279373e-05f,
+	1.532847e-05f,
+	-1.952421e-05f,
+	2.322752e-05f,
+	-2.892819e-05f,
+	3.424033e-05f,
+	-4.199398e-05f,
+	4.961978e-05f,
+	-6.036526e-05f,
+	7.160255e-05f,
+	-8.720599e-05f,
+	1.048555e-04f,
+	-1.297273e-04f,
+	1.611302e-04f,
+	-2.082955e-04f,
+	2.780486e-04f,
+	-3.914761e-04f,
+	3.229635e-04f,
+	1.075714e-03f,
+	-5.286148e-04f,
+	3.332143e-04f,
+	-2.380165e-04f,
+	1.798638e-04f,
+	-1.427131e-04f,
+	1.144720e-04f,
+	-9.463375e-05f,
+	7.754317e-05f,
+	-6.520488e-05f,
+	5.364488e-05f,
+	-4.535744e-05f,
+	3.709003e-05f,
+	-3.133097e-05f,
+	2.527584e-05f,
+	-2.124816e-05f,
+	1.679550e-05f,
+	-1.401643e-05f,
+	1.077195e-05f,
+	-8.910558e-06f,
+	6.590166e-06f,
+	-5.398303e-06f,
+	3.782645e-06f,
+	-3.065100e-06f,
+	1.980117e-06f,
+	-1.582096e-06f,
+	8.910584e-07f,
+	-6.930865e-07f,
+	2.931496e-07f,
+	-2.084234e-07f,
+	2.816594e-08f,
+	1.499903e-10f,
+
+	4.469889e-09f,
+	-1.320017e-08f,
+	-1.493674e-07f,
+	1.843050e-07f,
+	-5.501412e-07f,
+	6.778096e-07f,
+	-1.309717e-06f,
+	1.607502e-06f,
+	-2.598136e-06f,
+	3.174547e-06f,
+	-4.648841e-06f,
+	5.645906e-06f,
+	-7.763931e-06f,
+	9.361236e-06f,
+	-1.232443e-05f,
+	1.474891e-05f,
+	-1.881536e-05f,
+	2.236492e-05f,
+	-2.788545e-05f,
+	3.298370e-05f,
+	-4.048494e-05f,
+	4.780815e-05f,
+	-5.818937e-05f,
+	6.897819e-05f,
+	-8.401912e-05f,
+	1.009366e-04f,
+	-1.248134e-04f,
+	1.547673e-04f,
+	-1.996028e-04f,
+	2.649406e-04f,
+	-3.669661e-04f,
+	2.266466e-04f,
+	1.061551e-03f,
+	-5.180003e-04f,
+	3.256404e-04f,
+	-2.322957e-04f,
+	1.753713e-04f,
+	-1.390949e-04f,
+	1.115120e-04f,
+	-9.218745e-05f,
+	7.551091e-05f,
+	-6.351139e-05f,
+	5.223432e-05f,
+	-4.418363e-05f,
+	3.611732e-05f,
+	-3.052770e-05f,
+	2.461728e-05f,
+	-2.071114e-05f,
+	1.636206e-05f,
+	-1.366901e-05f,
+	1.049736e-05f,
+	-8.695343e-06f,
+	6.424745e-06f,
+	-5.272438e-06f,
+	3.689605e-06f,
+	-2.997190e-06f,
+	1.932867e-06f,
+	-1.549799e-06f,
+	8.709714e-07f,
+	-6.809805e-07f,
+	2.875165e-07f,
+	-2.060390e-07f,
+	2.830900e-08f,
+	1.185188e-10f,
+
+	4.908061e-09f,
+	-1.693936e-08f,
+	-1.413560e-07f,
+	1.684842e-07f,
+	-5.246172e-07f,
+	6.378832e-07f,
+	-1.252080e-06f,
+	1.525776e-06f,
+	-2.487063e-06f,
+	3.025513e-06f,
+	-4.454054e-06f,
+	5.393905e-06f,
+	-7.443729e-06f,
+	8.957783e-06f,
+	-1.182267e-05f,
+	1.412916e-05f,
+	-1.805716e-05f,
+	2.144214e-05f,
+	-2.676976e-05f,
+	3.163903e-05f,
+	-3.887002e-05f,
+	4.586937e-05f,
+	-5.586076e-05f,
+	6.616991e-05f,
+	-8.060945e-05f,
+	9.674500e-05f,
+	-1.195600e-04f,
+	1.479697e-04f,
+	-1.903268e-04f,
+	2.509782e-04f,
+	-3.409291e-04f,
+	1.238718e-04f,
+	1.044456e-03f,
+	-5.062031e-04f,
+	3.173366e-04f,
+	-2.260563e-04f,
+	1.704842e-04f,
+	-1.351646e-04f,
+	1.082996e-04f,
+	-8.953398e-05f,
+	7.330717e-05f,
+	-6.167532e-05f,
+	5.070502e-05f,
+	-4.291098e-05f,
+	3.506251e-05f,
+	-2.965652e-05f,
+	2.390281e-05f,
+	-2.012838e-05f,
+	1.589149e-05f,
+	-1.329171e-05f,
+	1.019895e-05f,
+	-8.461371e-06f,
+	6.244741e-06f,
+	-5.135405e-06f,
+	3.588165e-06f,
+	-2.923099e-06f,
+	1.881188e-06f,
+	-1.514437e-06f,
+	8.488607e-07f,
+	-6.676251e-07f,
+	2.811888e-07f,
+	-2.033334e-07f,
+	2.835316e-08f,
+	9.245984e-11f,
+
+	5.372976e-09f,
+	-2.084203e-08f,
+	-1.329123e-07f,
+	1.518061e-07f,
+	-4.976220e-07f,
+	5.956431e-07f,
+	-1.191009e-06f,
+	1.439161e-06f,
+	-2.369240e-06f,
+	2.867390e-06f,
+	-4.247272e-06f,
+	5.126336e-06f,
+	-7.103612e-06f,
+	8.529167e-06f,
+	-1.128947e-05f,
+	1.347047e-05f,
+	-1.725114e-05f,
+	2.046105e-05f,
+	-2.558338e-05f,
+	3.020908e-05f,
+	-3.715251e-05f,
+	4.380740e-05f,
+	-5.338418e-05f,
+	6.318344e-05f,
+	-7.698390e-05f,
+	9.228911e-05f,
+	-1.139775e-04f,
+	1.407506e-04f,
+	-1.804846e-04f,
+	2.361847e-04f,
+	-3.133991e-04f,
+	1.453000e-05f,
+	1.024592e-03f,
+	-4.932741e-04f,
+	3.083321e-04f,
+	-2.193183e-04f,
+	1.652175e-04f,
+	-1.309341e-04f,
+	1.048441e-04f,
+	-8.668099e-05f,
+	7.093828e-05f,
+	-5.970192e-05f,
+	4.906135e-05f,
+	-4.154312e-05f,
+	3.392863e-05f,
+	-2.871992e-05f,
+	2.313450e-05f,
+	-1.950159e-05f,
+	1.538517e-05f,
+	-1.288564e-05f,
+	9.877627e-06f,
+	-8.209347e-06f,
+	6.050705e-06f,
+	-4.987630e-06f,
+	3.478649e-06f,
+	-2.843066e-06f,
+	1.825254e-06f,
+	-1.476133e-06f,
+	8.248085e-07f,
+	-6.530726e-07f,
+	2.741968e-07f,
+	-2.003218e-07f,
+	2.830409e-08f,
+	7.111903e-11f,
+
+	5.864800e-09f,
+	-2.490504e-08f,
+	-1.240474e-07f,
+	1.342949e-07f,
+	-4.692000e-07f,
+	5.511616e-07f,
+	-1.126613e-06f,
+	1.347814e-06f,
+	-2.244890e-06f,
+	2.700481e-06f,
+	-4.028896e-06f,
+	4.843726e-06f,
+	-6.744255e-06f,
+	8.076244e-06f,
+	-1.072589e-05f,
+	1.277418e-05f,
+	-1.639896e-05f,
+	1.942367e-05f,
+	-2.432878e-05f,
+	2.869680e-05f,
+	-3.533599e-05f,
+	4.162654e-05f,
+	-5.076481e-05f,
+	6.002497e-05f,
+	-7.314995e-05f,
+	8.757804e-05f,
+	-1.080771e-04f,
+	1.331240e-04f,
+	-1.700944e-04f,
+	2.205857e-04f,
+	-2.844145e-04f,
+	-1.014833e-04f,
+	1.002122e-03f,
+	-4.792659e-04f,
+	2.986574e-04f,
+	-2.121027e-04f,
+	1.595868e-04f,
+	-1.264156e-04f,
+	1.011555e-04f,
+	-8.363656e-05f,
+	6.841090e-05f,
+	-5.759673e-05f,
+	4.730790e-05f,
+	-4.008389e-05f,
+	3.271888e-05f,
+	-2.772055e-05f,
+	2.231453e-05f,
+	-1.883255e-05f,
+	1.484456e-05f,
+	-1.245199e-05f,
+	9.534326e-06f,
+	-7.940017e-06f,
+	5.843219e-06f,
+	-4.829562e-06f,
+	3.361396e-06f,
+	-2.757343e-06f,
+	1.765247e-06f,
+	-1.435014e-06f,
+	7.989008e-07f,
+	-6.373774e-07f,
+	2.665722e-07f,
+	-1.970202e-07f,
+	2.816751e-08f,
+	5.385343e-11f,
+
+	6.383562e-09f,
+	-2.912464e-08f,
+	-1.147739e-07f,
+	1.159779e-07f,
+	-4.394000e-07f,
+	5.045175e-07f,
+	-1.059013e-06f,
+	1.251909e-06f,
+	-2.114253e-06f,
+	2.525112e-06f,
+	-3.799362e-06f,
+	4.546640e-06f,
+	-6.366387e-06f,
+	7.599942e-06f,
+	-1.013310e-05f,
+	1.204173e-05f,
+	-1.550238e-05f,
+	1.833218e-05f,
+	-2.300859e-05f,
+	2.710539e-05f,
+	-3.342429e-05f,
+	3.933140e-05f,
+	-4.800816e-05f,
+	5.670115e-05f,
+	-6.911562e-05f,
+	8.262157e-05f,
+	-1.018708e-04f,
+	1.251053e-04f,
+	-1.591765e-04f,
+	2.042089e-04f,
+	-2.540183e-04f,
+	-2.242676e-04f,
+	9.772060e-04f,
+	-4.642329e-04f,
+	2.883441e-04f,
+	-2.044313e-04f,
+	1.536086e-04f,
+	-1.216219e-04f,
+	9.724404e-05f,
+	-8.040917e-05f,
+	6.573203e-05f,
+	-5.536557e-05f,
+	4.544955e-05f,
+	-3.853734e-05f,
+	3.143661e-05f,
+	-2.666120e-05f,
+	2.144520e-05f,
+	-1.812314e-05f,
+	1.427119e-05f,
+	-1.199198e-05f,
+	9.170035e-06f,
+	-7.654162e-06f,
+	5.622893e-06f,
+	-4.661669e-06f,
+	3.236761e-06f,
+	-2.666193e-06f,
+	1.701359e-06f,
+	-1.391214e-06f,
+	7.712269e-07f,
+	-6.205959e-07f,
+	2.583474e-07f,
+	-1.934443e-07f,
+	2.794912e-08f,
+	4.007222e-11f,
+
+	6.929151e-09f,
+	-3.349649e-08f,
+	-1.051056e-07f,
+	9.688473e-08f,
+	-4.082750e-07f,
+	4.557962e-07f,
+	-9.883362e-07f,
+	1.151630e-06f,
+	-1.977589e-06f,
+	2.341634e-06f,
+	-3.559134e-06f,
+	4.235686e-06f,
+	-5.970788e-06f,
+	7.101249e-06f,
+	-9.512337e-06f,
+	1.127467e-05f,
+	-1.456332e-05f,
+	1.718888e-05f,
+	-2.162562e-05f,
+	2.543823e-05f,
+	-3.142151e-05f,
+	3.692689e-05f,
+	-4.512013e-05f,
+	5.321907e-05f,
+	-6.488949e-05f,
+	7.743014e-05f,
+	-9.537154e-05f,
+	1.167107e-04f,
+	-1.477521e-04f,
+	1.870847e-04f,
+	-2.222579e-04f,
+	-3.539179e-04f,
+	9.500055e-04f,
+	-4.482307e-04f,
+	2.774251e-04f,
+	-1.963271e-04f,
+	1.473000e-04f,
+	-1.165665e-04f,
+	9.312062e-05f,
+	-7.700769e-05f,
+	6.290904e-05f,
+	-5.301454e-05f,
+	4.349136e-05f,
+	-3.690768e-05f,
+	3.008534e-05f,
+	-2.554478e-05f,
+	2.052890e-05f,
+	-1.737534e-05f,
+	1.366667e-05f,
+	-1.150690e-05f,
+	8.785787e-06f,
+	-7.352597e-06f,
+	5.390364e-06f,
+	-4.484441e-06f,
+	3.105114e-06f,
+	-2.569891e-06f,
+	1.633785e-06f,
+	-1.344869e-06f,
+	7.418792e-07f,
+	-6.027864e-07f,
+	2.495558e-07f,
+	-1.896106e-07f,
+	2.765463e-08f,
+	2.923700e-11f,
+
+	7.501304e-09f,
+	-3.801563e-08f,
+	-9.505782e-08f,
+	7.704755e-08f,
+	-3.758819e-07f,
+	4.050892e-07f,
+	-9.147212e-07f,
+	1.047177e-06f,
+	-1.835172e-06f,
+	2.150421e-06f,
+	-3.308708e-06f,
+	3.911509e-06f,
+	-5.558287e-06f,
+	6.581215e-06f,
+	-8.864916e-06f,
+	1.047461e-05f,
+	-1.358376e-05f,
+	1.599624e-05f,
+	-2.018284e-05f,
+	2.369894e-05f,
+	-2.933197e-05f,
+	3.441820e-05f,
+	-4.210696e-05f,
+	4.958624e-05f,
+	-6.048064e-05f,
+	7.201483e-05f,
+	-8.859311e-05f,
+	1.079576e-04f,
+	-1.358444e-04f,
+	1.692454e-04f,
+	-1.891854e-04f,
+	-4.905239e-04f,
+	9.206794e-04f,
+	-4.313165e-04f,
+	2.659341e-04f,
+	-1.878136e-04f,
+	1.406789e-04f,
+	-1.112635e-04f,
+	8.879654e-05f,
+	-7.344139e-05f,
+	5.994953e-05f,
+	-5.055000e-05f,
+	4.143862e-05f,
+	-3.519934e-05f,
+	2.866874e-05f,
+	-2.437431e-05f,
+	1.956814e-05f,
+	-1.659119e-05f,
+	1.303265e-05f,
+	-1.099811e-05f,
+	8.382653e-06f,
+	-7.036168e-06f,
+	5.146291e-06f,
+	-4.298386e-06f,
+	2.966837e-06f,
+	-2.468718e-06f,
+	1.562731e-06f,
+	-1.296124e-06f,
+	7.109530e-07f,
+	-5.840087e-07f,
+	2.402315e-07f,
+	-1.855356e-07f,
+	2.728968e-08f,
+	2.086157e-11f,
+
+	8.099599e-09f,
+	-4.267648e-08f,
+	-8.464719e-08f,
+	5.650104e-08f,
+	-3.422818e-07f,
+	3.524942e-07f,
+	-8.383145e-07f,
+	9.387588e-07f,
+	-1.687295e-06f,
+	1.951867e-06f,
+	-3.048607e-06f,
+	3.574792e-06f,
+	-5.129759e-06f,
+	6.040949e-06f,
+	-8.192228e-06f,
+	9.643300e-06f,
+	-1.256584e-05f,
+	1.475684e-05f,
+	-1.868341e-05f,
+	2.189129e-05f,
+	-2.716024e-05f,
+	3.181082e-05f,
+	-3.897525e-05f,
+	4.581059e-05f,
+	-5.589864e-05f,
+	6.638734e-05f,
+	-8.154997e-05f,
+	9.886454e-05f,
+	-1.234776e-04f,
+	1.507257e-04f,
+	-1.548573e-04f,
+	-6.341700e-04f,
+	8.893856e-04f,
+	-4.135484e-04f,
+	2.539062e-04f,
+	-1.789153e-04f,
+	1.337637e-04f,
+	-1.057273e-04f,
+	8.428348e-05f,
+	-6.971984e-05f,
+	5.686146e-05f,
+	-4.797853e-05f,
+	3.929682e-05f,
+	-3.341687e-05f,
+	2.719059e-05f,
+	-2.315295e-05f,
+	1.856550e-05f,
+	-1.577280e-05f,
+	1.237086e-05f,
+	-1.046698e-05f,
+	7.961744e-06f,
+	-6.705752e-06f,
+	4.891358e-06f,
+	-4.104027e-06f,
+	2.822327e-06f,
+	-2.362968e-06f,
+	1.488406e-06f,
+	-1.245124e-06f,
+	6.785459e-07f,
+	-5.643238e-07f,
+	2.304093e-07f,
+	-1.812359e-07f,
+	2.685990e-08f,
+	1.451128e-11f,
+
+	8.723445e-09f,
+	-4.747281e-08f,
+	-7.389173e-08f,
+	3.528238e-08f,
+	-3.075400e-07f,
+	2.981149e-07f,
+	-7.592711e-07f,
+	8.265985e-07f,
+	-1.534266e-06f,
+	1.746390e-06f,
+	-2.779384e-06f,
+	3.226252e-06f,
+	-4.686126e-06f,
+	5.481618e-06f,
+	-7.495733e-06f,
+	8.782534e-06f,
+	-1.151178e-05f,
+	1.347340e-05f,
+	-1.713062e-05f,
+	2.001929e-05f,
+	-2.491112e-05f,
+	2.911051e-05f,
+	-3.573189e-05f,
+	4.190042e-05f,
+	-5.115357e-05f,
+	6.055994e-05f,
+	-7.425734e-05f,
+	8.945080e-05f,
+	-1.106775e-04f,
+	1.315623e-04f,
+	-1.193347e-04f,
+	-7.849357e-04f,
+	8.562806e-04f,
+	-3.949856e-04f,
+	2.413770e-04f,
+	-1.696573e-04f,
+	1.265734e-04f,
+	-9.997297e-05f,
+	7.959353e-05f,
+	-6.585295e-05f,
+	5.365301e-05f,
+	-4.530693e-05f,
+	3.707163e-05f,
+	-3.156499e-05f,
+	2.565482e-05f,
+	-2.188393e-05f,
+	1.752367e-05f,
+	-1.492238e-05f,
+	1.168308e-05f,
+	-9.914962e-06f,
+	7.524204e-06f,
+	-6.362253e-06f,
+	4.626268e-06f,
+	-3.901905e-06f,
+	2.671992e-06f,
+	-2.252942e-06f,
+	1.411029e-06f,
+	-1.192021e-06f,
+	6.447581e-07f,
+	-5.437942e-07f,
+	2.201244e-07f,
+	-1.767284e-07f,
+	2.637081e-08f,
+	9.801791e-12f,
+
+	9.372076e-09f,
+	-5.239779e-08f,
+	-6.281083e-08f,
+	1.343109e-08f,
+	-2.717252e-07f,
+	2.420605e-07f,
+	-6.777547e-07f,
+	7.109298e-07f,
+	-1.376409e-06f,
+	1.534427e-06f,
+	-2.501618e-06f,
+	2.866644e-06f,
+	-4.228353e-06f,
+	4.904443e-06f,
+	-6.776960e-06f,
+	7.894211e-06f,
+	-1.042391e-05f,
+	1.214877e-05f,
+	-1.552792e-05f,
+	1.808708e-05f,
+	-2.258960e-05f,
+	2.632328e-05f,
+	-3.238411e-05f,
+	3.786445e-05f,
+	-4.625593e-05f,
+	5.454549e-05f,
+	-6.673119e-05f,
+	7.973675e-05f,
+	-9.747109e-05f,
+	1.117942e-04f,
+	-8.268350e-05f,
+	-9.428947e-04f,
+	8.215188e-04f,
+	-3.756883e-04f,
+	2.283830e-04f,
+	-1.600655e-04f,
+	1.191275e-04f,
+	-9.401580e-05f,
+	7.473913e-05f,
+	-6.185091e-05f,
+	5.033262e-05f,
+	-4.254222e-05f,
+	3.476888e-05f,
+	-2.964858e-05f,
+	2.406546e-05f,
+	-2.057061e-05f,
+	1.644539e-05f,
+	-1.404217e-05f,
+	1.097115e-05f,
+	-9.343522e-06f,
+	7.071210e-06f,
+	-6.006598e-06f,
+	4.351743e-06f,
+	-3.692574e-06f,
+	2.516247e-06f,
+	-2.138947e-06f,
+	1.330819e-06f,
+	-1.136968e-06f,
+	6.096917e-07f,
+	-5.224833e-07f,
+	2.094126e-07f,
+	-1.720300e-07f,
+	2.582788e-08f,
+	6.397546e-12f,
+
+	1.004454e-08f,
+	-5.744397e-08f,
+	-5.142517e-08f,
+	-9.010932e-09f,
+	-2.349100e-07f,
+	1.844463e-07f,
+	-5.939366e-07f,
+	5.919979e-07f,
+	-1.214063e-06f,
+	1.316436e-06f,
+	-2.215914e-06f,
+	2.496753e-06f,
+	-3.757447e-06f,
+	4.310698e-06f,
+	-6.037502e-06f,
+	6.980307e-06f,
+	-9.304655e-06f,
+	1.078590e-05f,
+	-1.387889e-05f,
+	1.609900e-05f,
+	-2.020090e-05f,
+	2.345538e-05f,
+	-2.893944e-05f,
+	3.371170e-05f,
+	-4.121668e-05f,
+	4.835739e-05f,
+	-5.898816e-05f,
+	6.974362e-05f,
+	-8.388677e-05f,
+	9.146245e-05f,
+	-4.497377e-05f,
+	-1.108116e-03f,
+	7.852530e-04f,
+	-3.557171e-04f,
+	2.149615e-04f,
+	-1.501659e-04f,
+	1.114460e-04f,
+	-8.787161e-05f,
+	6.973303e-05f,
+	-5.772418e-05f,
+	4.690893e-05f,
+	-3.969159e-05f,
+	3.239458e-05f,
+	-2.767260e-05f,
+	2.242667e-05f,
+	-1.921641e-05f,
+	1.533349e-05f,
+	-1.313448e-05f,
+	1.023693e-05f,
+	-8.754174e-06f,
+	6.603968e-06f,
+	-5.639738e-06f,
+	4.068525e-06f,
+	-3.476600e-06f,
+	2.355521e-06f,
+	-2.021299e-06f,
+	1.248002e-06f,
+	-1.080121e-06f,
+	5.734502e-07f,
+	-5.004557e-07f,
+	1.983099e-07f,
+	-1.671575e-07f,
+	2.523644e-08f,
+	4.009682e-12f,
+
+	1.073971e-08f,
+	-6.260326e-08f,
+	-3.975676e-08f,
+	-3.199953e-08f,
+	-1.971708e-07f,
+	1.253925e-07f,
+	-5.079960e-07f,
+	4.700582e-07f,
+	-1.047582e-06f,
+	1.092893e-06f,
+	-1.922901e-06f,
+	2.117397e-06f,
+	-3.274453e-06f,
+	3.701706e-06f,
+	-5.279013e-06f,
+	6.042870e-06f,
+	-8.156533e-06f,
+	9.387854e-06f,
+	-1.218726e-05f,
+	1.405954e-05f,
+	-1.775043e-05f,
+	2.051332e-05f,
+	-2.540565e-05f,
+	2.945157e-05f,
+	-3.604719e-05f,
+	4.200953e-05f,
+	-5.104554e-05f,
+	5.949349e-05f,
+	-6.995407e-05f,
+	7.060990e-05f,
+	-6.280282e-06f,
+	-1.280661e-03f,
+	7.476336e-04f,
+	-3.351333e-04f,
+	2.011502e-04f,
+	-1.399857e-04f,
+	1.035492e-04f,
+	-8.155651e-05f,
+	6.458828e-05f,
+	-5.348346e-05f,
+	4.339081e-05f,
+	-3.676241e-05f,
+	2.995485e-05f,
+	-2.564218e-05f,
+	2.074268e-05f,
+	-1.782484e-05f,
+	1.419085e-05f,
+	-1.220169e-05f,
+	9.482354e-06f,
+	-8.148461e-06f,
+	6.123708e-06f,
+	-5.262642e-06f,
+	3.777365e-06f,
+	-3.254563e-06f,
+	2.190248e-06f,
+	-1.900316e-06f,
+	1.162809e-06f,
+	-1.021639e-06f,
+	5.361391e-07f,
+	-4.777762e-07f,
+	1.868526e-07f,
+	-1.621278e-07f,
+	2.460172e-08f,
+	2.393624e-12f,
+
+	1.145624e-08f,
+	-6.786694e-08f,
+	-2.782887e-08f,
+	-5.548836e-08f,
+	-1.585873e-07f,
+	6.502463e-08f,
+	-4.201193e-07f,
+	3.453765e-07f,
+	-8.773323e-07f,
+	8.642924e-07f,
+	-1.623232e-06f,
+	1.729422e-06f,
+	-2.780456e-06f,
+	3.078835e-06f,
+	-4.503206e-06f,
+	5.084019e-06f,
+	-6.982148e-06f,
+	7.957820e-06f,
+	-1.045688e-05f,
+	1.197335e-05f,
+	-1.524377e-05f,
+	1.750379e-05f,
+	-2.179081e-05f,
+	2.509376e-05f,
+	-3.075921e-05f,
+	3.551629e-05f,
+	-4.292122e-05f,
+	4.900929e-05f,
+	-5.570370e-05f,
+	4.928147e-05f,
+	3.331773e-05f,
+	-1.460588e-03f,
+	7.088089e-04f,
+	-3.139988e-04f,
+	1.869874e-04f,
+	-1.295519e-04f,
+	9.545802e-05f,
+	-7.508691e-05f,
+	5.931814e-05f,
+	-4.913966e-05f,
+	3.978728e-05f,
+	-3.376218e-05f,
+	2.745594e-05f,
+	-2.356251e-05f,
+	1.901781e-05f,
+	-1.639948e-05f,
+	1.302042e-05f,
+	-1.124618e-05f,
+	8.709369e-06f,
+	-7.527958e-06f,
+	5.631684e-06f,
+	-4.876299e-06f,
+	3.479034e-06f,
+	-3.027049e-06f,
+	2.020871e-06f,
+	-1.776326e-06f,
+	1.075471e-06f,
+	-9.616846e-07f,
+	4.978644e-07f,
+	-4.545105e-07f,
+	1.750771e-07f,
+	-1.569576e-07f,
+	2.392883e-08f,
+	1.346271e-12f,
+
+	1.219260e-08f,
+	-7.322569e-08f,
+	-1.566601e-08f,
+	-7.942894e-08f,
+	-1.192423e-07f,
+	3.473081e-09f,
+	-3.304998e-07f,
+	2.182278e-07f,
+	-7.036933e-07f,
+	6.311448e-07f,
+	-1.317579e-06f,
+	1.333702e-06f,
+	-2.276574e-06f,
+	2.443499e-06f,
+	-3.711844e-06f,
+	4.105940e-06f,
+	-5.784182e-06f,
+	6.499064e-06f,
+	-8.691713e-06f,
+	9.845217e-06f,
+	-1.268668e-05f,
+	1.443371e-05f,
+	-1.810322e-05f,
+	2.064826e-05f,
+	-2.536483e-05f,
+	2.889251e-05f,
+	-3.463368e-05f,
+	3.831467e-05f,
+	-4.116748e-05f,
+	2.752388e-05f,
+	7.373662e-05f,
+	-1.647948e-03f,
+	6.689246e-04f,
+	-2.923755e-04f,
+	1.725119e-04f,
+	-1.188922e-04f,
+	8.719343e-05f,
+	-6.847952e-05f,
+	5.393613e-05f,
+	-4.470387e-05f,
+	3.610751e-05f,
+	-3.069854e-05f,
+	2.490422e-05f,
+	-2.143889e-05f,
+	1.725646e-05f,
+	-1.494396e-05f,
+	1.182520e-05f,
+	-1.027043e-05f,
+	7.919964e-06f,
+	-6.894263e-06f,
+	5.129170e-06f,
+	-4.481711e-06f,
+	3.174309e-06f,
+	-2.794654e-06f,
+	1.847836e-06f,
+	-1.649656e-06f,
+	9.862256e-07f,
+	-9.004194e-07f,
+	4.587336e-07f,
+	-4.307246e-07f,
+	1.630199e-07f,
+	-1.516637e-07f,
+	2.322270e-08f,
+	7.028512e-13f,
+
+	1.294705e-08f,
+	-7.866958e-08f,
+	-3.293902e-09f,
+	-1.037708e-07f,
+	-7.922220e-08f,
+	-5.912714e-08f,
+	-2.393375e-07f,
+	8.889613e-08f,
+	-5.270566e-07f,
+	3.939767e-07f,
+	-1.006638e-06f,
+	9.311387e-07f,
+	-1.763958e-06f,
+	1.797151e-06f,
+	-2.906745e-06f,
+	3.110880e-06f,
+	-4.565392e-06f,
+	5.014947e-06f,
+	-6.895832e-06f,
+	7.680044e-06f,
+	-1.008506e-05f,
+	1.131017e-05f,
+	-1.435140e-05f,
+	1.612534e-05f,
+	-1.987652e-05f,
+	2.215342e-05f,
+	-2.620193e-05f,
+	2.743403e-05f,
+	-2.637828e-05f,
+	5.385612e-06f,
+	1.148883e-04f,
+	-1.842786e-03f,
+	6.281239e-04f,
+	-2.703256e-04f,
+	1.577626e-04f,
+	-1.080345e-04f,
+	7.877677e-05f,
+	-6.175120e-05f,
+	4.845595e-05f,
+	-4.018734e-05f,
+	3.236085e-05f,
+	-2.757924e-05f,
+	2.230613e-05f,
+	-1.927669e-05f,
+	1.546310e-05f,
+	-1.346197e-05f,
+	1.060822e-05f,
+	-9.276892e-06f,
+	7.116152e-06f,
+	-6.248994e-06f,
+	4.617453e-06f,
+	-4.079892e-06f,
+	2.863978e-06f,
+	-2.557981e-06f,
+	1.671597e-06f,
+	-1.520639e-06f,
+	8.953091e-07f,
+	-8.380075e-07f,
+	4.188543e-07f,
+	-4.064845e-07f,
+	1.507172e-07f,
+	-1.462624e-07f,
+	2.248813e-08f,
+	3.334611e-13f,
+
+	1.371765e-08f,
+	-8.418809e-08f,
+	9.260596e-09f,
+	-1.284614e-07f,
+	-3.861601e-08f,
+	-1.226367e-07f,
+	-1.468382e-07f,
+	-4.232605e-08f,
+	-3.478247e-07f,
+	1.533292e-07f,
+	-6.911216e-07f,
+	5.226551e-07f,
+	-1.243788e-06f,
+	1.141281e-06f,
+	-2.089768e-06f,
+	2.101140e-06f,
+	-3.328603e-06f,
+	3.508911e-06f,
+	-5.073408e-06f,
+	5.482869e-06f,
+	-7.444964e-06f,
+	8.140428e-06f,
+	-1.054407e-05f,
+	1.153551e-05f,
+	-1.430700e-05f,
+	1.531464e-05f,
+	-1.764545e-05f,
+	1.639241e-05f,
+	-1.136990e-05f,
+	-1.708316e-05f,
+	1.566804e-04f,
+	-2.045142e-03f,
+	5.865471e-04f,
+	-2.479111e-04f,
+	1.427788e-04f,
+	-9.700702e-05f,
+	7.022957e-05f,
+	-5.491905e-05f,
+	4.289144e-05f,
+	-3.560143e-05f,
+	2.855669e-05f,
+	-2.441210e-05f,
+	1.966821e-05f,
+	-1.708134e-05f,
+	1.364222e-05f,
+	-1.195725e-05f,
+	9.372537e-06f,
+	-8.268090e-06f,
+	6.299966e-06f,
+	-5.593787e-06f,
+	4.097836e-06f,
+	-3.671865e-06f,
+	2.548836e-06f,
+	-2.317638e-06f,
+	1.492609e-06f,
+	-1.389611e-06f,
+	8.029609e-07f,
+	-7.746137e-07f,
+	3.783347e-07f,
+	-3.818563e-07f,
+	1.382054e-07f,
+	-1.407701e-07f,
+	2.172976e-08f,
+	1.393247e-13f,
+
+	1.450223e-08f,
+	-8.977013e-08f,
+	2.196951e-08f,
+	-1.534466e-07f,
+	2.484317e-09f,
+	-1.869122e-07f,
+	-5.321351e-08f,
+	-1.751388e-07f,
+	-1.664104e-07f,
+	-9.024343e-08f,
+	-3.717593e-07f,
+	1.091972e-07f,
+	-7.172728e-07f,
+	4.774124e-07f,
+	-1.262816e-06f,
+	1.079073e-06f,
+	-2.076703e-06f,
+	1.984474e-06f,
+	-3.228703e-06f,
+	3.258829e-06f,
+	-4.772574e-06f,
+	4.931914e-06f,
+	-6.690155e-06f,
+	6.889516e-06f,
+	-8.669323e-06f,
+	8.392156e-06f,
+	-8.984201e-06f,
+	5.215475e-06f,
+	3.822901e-06f,
+	-3.983071e-05f,
+	1.990163e-04f,
+	-2.255049e-03f,
+	5.443315e-04f,
+	-2.251939e-04f,
+	1.275997e-04f,
+	-8.583799e-05f,
+	6.157352e-05f,
+	-4.800027e-05f,
+	3.725656e-05f,
+	-3.095763e-05f,
+	2.470454e-05f,
+	-2.120505e-05f,
+	1.699704e-05f,
+	-1.485832e-05f,
+	1.179838e-05f,
+	-1.043354e-05f,
+	8.121257e-06f,
+	-7.246549e-06f,
+	5.473457e-06f,
+	-4.930290e-06f,
+	3.571630e-06f,
+	-3.258664e-06f,
+	2.229684e-06f,
+	-2.074236e-06f,
+	1.311332e-06f,
+	-1.256906e-06f,
+	7.094209e-07f,
+	-7.104030e-07f,
+	3.372828e-07f,
+	-3.569062e-07f,
+	1.255204e-07f,
+	-1.352028e-07f,
+	2.095201e-08f,
+	4.880451e-14f,
+
+	1.529843e-08f,
+	-9.540400e-08f,
+	3.480379e-08f,
+	-1.786703e-07f,
+	4.398425e-08f,
+	-2.518065e-07f,
+	4.131972e-08f,
+	-3.092349e-07f,
+	1.676437e-08f,
+	-3.361747e-07f,
+	-4.929692e-08f,
+	-3.082700e-07f,
+	-1.856439e-07f,
+	-1.928995e-07f,
+	-4.278288e-07f,
+	4.707813e-08f,
+	-8.126328e-07f,
+	4.452195e-07f,
+	-1.366056e-06f,
+	1.013159e-06f,
+	-2.074182e-06f,
+	1.692180e-06f,
+	-2.798724e-06f,
+	2.198293e-06f,
+	-2.976740e-06f,
+	1.402239e-06f,
+	-2.385186e-07f,
+	-6.070567e-06f,
+	1.916458e-05f,
+	-6.280377e-05f,
+	2.417951e-04f,
+	-2.472535e-03f,
+	5.016116e-04f,
+	-2.022356e-04f,
+	1.122648e-04f,
+	-7.455581e-05f,
+	5.283038e-05f,
+	-4.101217e-05f,
+	3.156535e-05f,
+	-2.626749e-05f,
+	2.081398e-05f,
+	-1.796603e-05f,
+	1.429924e-05f,
+	-1.261315e-05f,
+	9.936151e-06f,
+	-8.894648e-06f,
+	6.857491e-06f,
+	-6.214811e-06f,
+	4.638687e-06f,
+	-4.260160e-06f,
+	3.040153e-06f,
+	-2.841321e-06f,
+	1.907324e-06f,
+	-1.828388e-06f,
+	1.128224e-06f,
+	-1.122863e-06f,
+	6.149290e-07f,
+	-6.455404e-07f,
+	2.958066e-07f,
+	-3.316995e-07f,
+	1.126978e-07f,
+	-1.295761e-07f,
+	2.015917e-08f,
+	1.319947e-14f,
+
+	1.610364e-08f,
+	-1.010775e-07f,
+	4.773342e-08f,
+	-2.040750e-07f,
+	8.578686e-08f,
+	-3.171691e-07f,
+	1.365400e-07f,
+	-4.443012e-07f,
+	2.012692e-07f,
+	-5.838876e-07f,
+	2.755064e-07f,
+	-7.287640e-07f,
+	3.498446e-07f,
+	-8.680743e-07f,
+	4.132213e-07f,
+	-9.924073e-07f,
+	4.606186e-07f,
+	-1.105213e-06f,
+	5.101234e-07f,
+	-1.248825e-06f,
+	6.438207e-07f,
+	-1.571100e-06f,
+	1.121000e-06f,
+	-2.527043e-06f,
+	2.757258e-06f,
+	-5.638557e-06f,
+	8.570893e-06f,
+	-1.743902e-05f,
+	3.461882e-05f,
+	-8.594775e-05f,
+	2.849118e-04f,
+	-2.697621e-03f,
+	4.585182e-04f,
+	-1.790976e-04f,
+	9.681319e-05f,
+	-6.318891e-05f,
+	4.402197e-05f,
+	-3.397209e-05f,
+	2.583189e-05f,
+	-2.154258e-05f,
+	1.689460e-05f,
+	-1.470303e-05f,
+	1.158147e-05f,
+	-1.035137e-05f,
+	8.060139e-06f,
+	-7.344358e-06f,
+	5.584360e-06f,
+	-5.175428e-06f,
+	3.797722e-06f,
+	-3.585058e-06f,
+	2.504725e-06f,
+	-2.420878e-06f,
+	1.582562e-06f,
+	-1.580708e-06f,
+	9.437459e-07f,
+	-9.878181e-07f,
+	5.197252e-07f,
+	-5.801904e-07f,
+	2.540134e-07f,
+	-3.063017e-07f,
+	9.977283e-08f,
+	-1.239054e-07f,
+	1.935528e-08f,
+	2.365890e-15f,
+
+	1.691507e-08f,
+	-1.067779e-07f,
+	6.072739e-08f,
+	-2.296015e-07f,
+	1.277930e-07f,
+	-3.828463e-07f,
+	2.322217e-07f,
+	-5.800185e-07f,
+	3.866663e-07f,
+	-8.327953e-07f,
+	6.018794e-07f,
+	-1.151287e-06f,
+	8.879201e-07f,
+	-1.546508e-06f,
+	1.258334e-06f,
+	-2.036911e-06f,
+	1.740021e-06f,
+	-2.663132e-06f,
+	2.395367e-06f,
+	-3.521736e-06f,
+	3.374958e-06f,
+	-4.850150e-06f,
+	5.059674e-06f,
+	-7.275229e-06f,
+	8.518999e-06f,
+	-1.271344e-05f,
+	1.742302e-05f,
+	-2.886273e-05f,
+	5.014863e-05f,
+	-1.092067e-04f,
+	3.282573e-04f,
+	-2.930323e-03f,
+	4.151792e-04f,
+	-1.558403e-04f,
+	8.128412e-05f,
+	-5.176562e-05f,
+	3.517013e-05f,
+	-2.689741e-05f,
+	2.007030e-05f,
+	-1.679451e-05f,
+	1.295602e-05f,
+	-1.142406e-05f,
+	8.850402e-06f,
+	-8.078514e-06f,
+	6.174943e-06f,
+	-5.786479e-06f,
+	4.304992e-06f,
+	-4.130952e-06f,
+	2.952634e-06f,
+	-2.906644e-06f,
+	1.966666e-06f,
+	-1.998368e-06f,
+	1.256200e-06f,
+	-1.331810e-06f,
+	7.583562e-07f,
+	-8.521067e-07f,
+	4.240482e-07f,
+	-5.145167e-07f,
+	2.120099e-07f,
+	-2.807771e-07f,
+	8.678015e-08f,
+	-1.182058e-07f,
+	1.854423e-08f,
+	1.972514e-16f,
+
+	1.772968e-08f,
+	-1.124919e-07f,
+	7.375387e-08f,
+	-2.551894e-07f,
+	1.699016e-07f,
+	-4.486818e-07f,
+	3.281352e-07f,
+	-7.160630e-07f,
+	5.725118e-07f,
+	-1.082303e-06f,
+	9.290406e-07f,
+	-1.574829e-06f,
+	1.427294e-06f,
+	-2.226577e-06f,
+	2.105486e-06f,
+	-3.083934e-06f,
+	3.022509e-06f,
+	-4.224808e-06f,
+	4.285158e-06f,
+	-5.800129e-06f,
+	6.112685e-06f,
+	-8.137110e-06f,
+	9.007854e-06f,
+	-1.203488e-05f,
+	1.429466e-05f,
+	-1.980544e-05f,
+	2.629660e-05f,
+	-4.031420e-05f,
+	6.571643e-05f,
+	-1.325236e-04f,
+	3.717188e-04f,
+	-3.170650e-03f,
+	3.717188e-04f,
+	-1.325236e-04f,
+	6.571643e-05f,
+	-4.031420e-05f,
+	2.629660e-05f,
+	-1.980544e-05f,
+	1.429466e-05f,
+	-1.203488e-05f,
+	9.007854e-06f,
+	-8.137110e-06f,
+	6.112685e-06f,
+	-5.800129e-06f,
+	4.285158e-06f,
+	-4.224808e-06f,
+	3.022509e-06f,
+	-3.083934e-06f,
+	2.105486e-06f,
+	-2.226577e-06f,
+	1.427294e-06f,
+	-1.574829e-06f,
+	9.290406e-07f,
+	-1.082303e-06f,
+	5.725118e-07f,
+	-7.160630e-07f,
+	3.281352e-07f,
+	-4.486818e-07f,
+	1.699016e-07f,
+	-2.551894e-07f,
+	7.375387e-08f,
+	-1.124919e-07f,
+	1.772968e-08f,
+	-1.031836e-39f
+};
+
+// blampd2 table: 4160 entries
+const float blampd2[] = {
+	-5.159147e-40f,
+	1.771614e-08f,
+	2.899878e-07f,
+	2.901052e-07f,
+	-1.986046e-06f,
+	-3.614025e-06f,
+	1.827861e-06f,
+	6.070517e-06f,
+	-5.605317e-06f,
+	-1.527665e-05f,
+	5.735891e-06f,
+	2.359858e-05f,
+	-1.239544e-05f,
+	-4.365927e-05f,
+	1.370170e-05f,
+	6.420231e-05f,
+	-2.432161e-05f,
+	-1.031419e-04f,
+	2.834299e-05f,
+	1.462911e-04f,
+	-4.554221e-05f,
+	-2.184754e-04f,
+	5.741838e-05f,
+	3.063327e-04f,
+	-9.254090e-05f,
+	-4.506854e-04f,
+	1.408368e-04f,
+	6.633282e-04f,
+	-2.816394e-04f,
+	-1.077519e-03f,
+	7.553768e-04f,
+	1.969009e-03f,
+	-6.357988e-03f,
+	1.969009e-03f,
+	7.553768e-04f,
+	-1.077519e-03f,
+	-2.816394e-04f,
+	6.633282e-04f,
+	1.408368e-04f,
+	-4.506854e-04f,
+	-9.254090e-05f,
+	3.063327e-04f,
+	5.741838e-05f,
+	-2.184754e-04f,
+	-4.554221e-05f,
+	1.462911e-04f,
+	2.834299e-05f,
+	-1.031419e-04f,
+	-2.432161e-05f,
+	6.420231e-05f,
+	1.370170e-05f,
+	-4.365927e-05f,
+	-1.239544e-05f,
+	2.359858e-05f,
+	5.735891e-06f,
+	-1.527665e-05f,
+	-5.605317e-06f,
+	6.070517e-06f,
+	1.827861e-06f,
+	-3.614025e-06f,
+	-1.986046e-06f,
+	2.901052e-07f,
+	2.899878e-07f,
+	1.771614e-08f,
+
+	9.865466e-17f,
+	1.902588e-08f,
+	2.966842e-07f,
+	2.754363e-07f,
+	-2.035835e-06f,
+	-3.590162e-06f,
+	1.952490e-06f,
+	6.022257e-06f,
+	-5.872686e-06f,
+	-1.520316e-05f,
+	6.223449e-06f,
+	2.347909e-05f,
+	-1.323223e-05f,
+	-4.348667e-05f,
+	1.504342e-05f,
+	6.394814e-05f,
+	-2.639645e-05f,
+	-1.027883e-04f,
+	3.143566e-05f,
+	1.457919e-04f,
+	-5.006083e-05f,
+	-2.177788e-04f,
+	6.392783e-05f,
+	3.053196e-04f,
+	-1.019514e-04f,
+	-4.491240e-04f,
+	1.547776e-04f,
+	6.605612e-04f,
+	-3.038340e-04f,
+	-1.071050e-03f,
+	7.982808e-04f,
+	1.936446e-03f,
+	-6.115755e-03f,
+	1.999153e-03f,
+	7.124727e-04f,
+	-1.083206e-03f,
+	-2.594448e-04f,
+	6.656555e-04f,
+	1.268960e-04f,
+	-4.519616e-04f,
+	-8.313040e-05f,
+	3.071512e-04f,
+	5.090893e-05f,
+	-2.190371e-04f,
+	-4.102358e-05f,
+	1.466972e-04f,
+	2.525031e-05f,
+	-1.034322e-04f,
+	-2.224677e-05f,
+	6.441468e-05f,
+	1.235997e-05f,
+	-4.380525e-05f,
+	-1.155866e-05f,
+	2.370190e-05f,
+	5.248333e-06f,
+	-1.534094e-05f,
+	-5.337947e-06f,
+	6.114008e-06f,
+	1.703232e-06f,
+	-3.635776e-06f,
+	-1.936257e-06f,
+	3.041004e-07f,
+	2.832913e-07f,
+	1.647459e-08f,
+
+	1.184006e-15f,
+	2.040599e-08f,
+	3.033735e-07f,
+	2.600861e-07f,
+	-2.085593e-06f,
+	-3.564173e-06f,
+	2.077038e-06f,
+	5.969203e-06f,
+	-6.139890e-06f,
+	-1.512043e-05f,
+	6.710702e-06f,
+	2.334337e-05f,
+	-1.406849e-05f,
+	-4.328735e-05f,
+	1.638432e-05f,
+	6.365208e-05f,
+	-2.847001e-05f,
+	-1.023713e-04f,
+	3.452644e-05f,
+	1.451993e-04f,
+	-5.457669e-05f,
+	-2.169470e-04f,
+	7.043329e-05f,
+	3.041112e-04f,
+	-1.113561e-04f,
+	-4.472767e-04f,
+	1.687097e-04f,
+	6.573530e-04f,
+	-3.260145e-04f,
+	-1.063797e-03f,
+	8.411551e-04f,
+	1.901426e-03f,
+	-5.877335e-03f,
+	2.026916e-03f,
+	6.695975e-04f,
+	-1.088117e-03f,
+	-2.372640e-04f,
+	6.675449e-04f,
+	1.129638e-04f,
+	-4.529536e-04f,
+	-7.372563e-05f,
+	3.077757e-04f,
+	4.440343e-05f,
+	-2.194643e-04f,
+	-3.650770e-05f,
+	1.470104e-04f,
+	2.215952e-05f,
+	-1.036596e-04f,
+	-2.017319e-05f,
+	6.458543e-05f,
+	1.101906e-05f,
+	-4.392472e-05f,
+	-1.072238e-05f,
+	2.378911e-05f,
+	4.761075e-06f,
+	-1.539606e-05f,
+	-5.070740e-06f,
+	6.152757e-06f,
+	1.578681e-06f,
+	-3.655431e-06f,
+	-1.886498e-06f,
+	3.174296e-07f,
+	2.766016e-07f,
+	1.529905e-08f,
+
+	6.610943e-15f,
+	2.185861e-08f,
+	3.100483e-07f,
+	2.440476e-07f,
+	-2.135287e-06f,
+	-3.536043e-06f,
+	2.201424e-06f,
+	5.911332e-06f,
+	-6.406759e-06f,
+	-1.502841e-05f,
+	7.197345e-06f,
+	2.319136e-05f,
+	-1.490373e-05f,
+	-4.306123e-05f,
+	1.772356e-05f,
+	6.331399e-05f,
+	-3.054103e-05f,
+	-1.018907e-04f,
+	3.761342e-05f,
+	1.445131e-04f,
+	-5.908700e-05f,
+	-2.159796e-04f,
+	7.693074e-05f,
+	3.027073e-04f,
+	-1.207492e-04f,
+	-4.451427e-04f,
+	1.826245e-04f,
+	6.537023e-04f,
+	-3.481668e-04f,
+	-1.055754e-03f,
+	8.839697e-04f,
+	1.863912e-03f,
+	-5.642729e-03f,
+	2.052338e-03f,
+	6.267799e-04f,
+	-1.092257e-03f,
+	-2.151110e-04f,
+	6.689985e-04f,
+	9.904864e-05f,
+	-4.536626e-04f,
+	-6.433232e-05f,
+	3.082067e-04f,
+	3.790584e-05f,
+	-2.197575e-04f,
+	-3.199728e-05f,
+	1.472312e-04f,
+	1.907247e-05f,
+	-1.038242e-04f,
+	-1.810212e-05f,
+	6.471472e-05f,
+	9.679788e-06f,
+	-4.401778e-05f,
+	-9.887120e-06f,
+	2.386031e-05f,
+	4.274415e-06f,
+	-1.544208e-05f,
+	-4.803860e-06f,
+	6.186797e-06f,
+	1.454289e-06f,
+	-3.673007e-06f,
+	-1.836801e-06f,
+	3.301008e-07f,
+	2.699254e-07f,
+	1.418735e-08f,
+
+	2.446931e-14f,
+	2.338589e-08f,
+	3.167011e-07f,
+	2.273142e-07f,
+	-2.184885e-06f,
+	-3.505760e-06f,
+	2.325566e-06f,
+	5.848624e-06f,
+	-6.673126e-06f,
+	-1.492708e-05f,
+	7.683069e-06f,
+	2.302302e-05f,
+	-1.573741e-05f,
+	-4.280827e-05f,
+	1.906031e-05f,
+	6.293382e-05f,
+	-3.260822e-05f,
+	-1.013466e-04f,
+	4.069467e-05f,
+	1.437332e-04f,
+	-6.358898e-05f,
+	-2.148764e-04f,
+	8.341617e-05f,
+	3.011075e-04f,
+	-1.301249e-04f,
+	-4.427217e-04f,
+	1.965133e-04f,
+	6.496081e-04f,
+	-3.702766e-04f,
+	-1.046919e-03f,
+	9.266941e-04f,
+	1.823866e-03f,
+	-5.411934e-03f,
+	2.075456e-03f,
+	5.840481e-04f,
+	-1.095630e-03f,
+	-1.929992e-04f,
+	6.700184e-04f,
+	8.515900e-05f,
+	-4.540897e-04f,
+	-5.495611e-05f,
+	3.084454e-04f,
+	3.142005e-05f,
+	-2.199172e-04f,
+	-2.749505e-05f,
+	1.473600e-04f,
+	1.599103e-05f,
+	-1.039264e-04f,
+	-1.603481e-05f,
+	6.480277e-05f,
+	8.342951e-06f,
+	-4.408458e-05f,
+	-9.053379e-06f,
+	2.391559e-05f,
+	3.788649e-06f,
+	-1.547905e-05f,
+	-4.537466e-06f,
+	6.216160e-06f,
+	1.330131e-06f,
+	-3.688522e-06f,
+	-1.787194e-06f,
+	3.421224e-07f,
+	2.632690e-07f,
+	1.313732e-08f,
+
+	6.994576e-14f,
+	2.498997e-08f,
+	3.233240e-07f,
+	2.098797e-07f,
+	-2.234355e-06f,
+	-3.473314e-06f,
+	2.449380e-06f,
+	5.781062e-06f,
+	-6.938821e-06f,
+	-1.481642e-05f,
+	8.167564e-06f,
+	2.283833e-05f,
+	-1.656901e-05f,
+	-4.252842e-05f,
+	2.039372e-05f,
+	6.251150e-05f,
+	-3.467027e-05f,
+	-1.007387e-04f,
+	4.376830e-05f,
+	1.428596e-04f,
+	-6.807983e-05f,
+	-2.136375e-04f,
+	8.988553e-05f,
+	2.993118e-04f,
+	-1.394772e-04f,
+	-4.400133e-04f,
+	2.103671e-04f,
+	6.450698e-04f,
+	-3.923296e-04f,
+	-1.037290e-03f,
+	9.692973e-04f,
+	1.781251e-03f,
+	-5.184947e-03f,
+	2.096309e-03f,
+	5.414296e-04f,
+	-1.098243e-03f,
+	-1.709424e-04f,
+	6.706071e-04f,
+	7.130326e-05f,
+	-4.542366e-04f,
+	-4.560264e-05f,
+	3.084925e-04f,
+	2.494995e-05f,
+	-2.199442e-04f,
+	-2.300369e-05f,
+	1.473971e-04f,
+	1.291704e-05f,
+	-1.039664e-04f,
+	-1.397249e-05f,
+	6.484980e-05f,
+	7.009354e-06f,
+	-4.412528e-05f,
+	-8.221652e-06f,
+	2.395503e-05f,
+	3.304069e-06f,
+	-1.550702e-05f,
+	-4.271718e-06f,
+	6.240884e-06f,
+	1.206285e-06f,
+	-3.701996e-06f,
+	-1.737707e-06f,
+	3.535034e-07f,
+	2.566387e-07f,
+	1.214679e-08f,
+
+	1.676761e-13f,
+	2.667295e-08f,
+	3.299091e-07f,
+	1.917382e-07f,
+	-2.283662e-06f,
+	-3.438694e-06f,
+	2.572783e-06f,
+	5.708633e-06f,
+	-7.203670e-06f,
+	-1.469640e-05f,
+	8.650517e-06f,
+	2.263725e-05f,
+	-1.739800e-05f,
+	-4.222166e-05f,
+	2.172295e-05f,
+	6.204701e-05f,
+	-3.672591e-05f,
+	-1.000671e-04f,
+	4.683236e-05f,
+	1.418921e-04f,
+	-7.255673e-05f,
+	-2.122627e-04f,
+	9.633477e-05f,
+	2.973200e-04f,
+	-1.488004e-04f,
+	-4.370174e-04f,
+	2.241774e-04f,
+	6.400867e-04f,
+	-4.143111e-04f,
+	-1.026863e-03f,
+	1.011748e-03f,
+	1.736031e-03f,
+	-4.961764e-03f,
+	2.114937e-03f,
+	4.989516e-04f,
+	-1.100102e-03f,
+	-1.489537e-04f,
+	6.707677e-04f,
+	5.748970e-05f,
+	-4.541049e-04f,
+	-3.627747e-05f,
+	3.083491e-04f,
+	1.849940e-05f,
+	-2.198392e-04f,
+	-1.852588e-05f,
+	1.473431e-04f,
+	9.852321e-06f,
+	-1.039446e-04f,
+	-1.191638e-05f,
+	6.485604e-05f,
+	5.679787e-06f,
+	-4.414003e-05f,
+	-7.392433e-06f,
+	2.397875e-05f,
+	2.820963e-06f,
+	-1.552608e-05f,
+	-4.006771e-06f,
+	6.261006e-06f,
+	1.082824e-06f,
+	-3.713449e-06f,
+	-1.688369e-06f,
+	3.642526e-07f,
+	2.500404e-07f,
+	1.121360e-08f,
+
+	3.540835e-13f,
+	2.843691e-08f,
+	3.364482e-07f,
+	1.728842e-07f,
+	-2.332773e-06f,
+	-3.401892e-06f,
+	2.695688e-06f,
+	5.631324e-06f,
+	-7.467502e-06f,
+	-1.456702e-05f,
+	9.131614e-06f,
+	2.241978e-05f,
+	-1.822385e-05f,
+	-4.188797e-05f,
+	2.304716e-05f,
+	6.154036e-05f,
+	-3.877382e-05f,
+	-9.933180e-05f,
+	4.988492e-05f,
+	1.408309e-04f,
+	-7.701686e-05f,
+	-2.107521e-04f,
+	1.027598e-04f,
+	2.951323e-04f,
+	-1.580885e-04f,
+	-4.337341e-04f,
+	2.379351e-04f,
+	6.346587e-04f,
+	-4.362068e-04f,
+	-1.015636e-03f,
+	1.054014e-03f,
+	1.688168e-03f,
+	-4.742383e-03f,
+	2.131379e-03f,
+	4.566408e-04f,
+	-1.101213e-03f,
+	-1.270464e-04f,
+	6.705028e-04f,
+	4.372656e-05f,
+	-4.536963e-04f,
+	-2.698614e-05f,
+	3.080165e-04f,
+	1.207221e-05f,
+	-2.196030e-04f,
+	-1.406424e-05f,
+	1.471987e-04f,
+	6.798688e-06f,
+	-1.038615e-04f,
+	-9.867695e-06f,
+	6.482178e-05f,
+	4.355036e-06f,
+	-4.412903e-05f,
+	-6.566208e-06f,
+	2.398686e-05f,
+	2.339616e-06f,
+	-1.553628e-05f,
+	-3.742780e-06f,
+	6.276568e-06f,
+	9.598232e-07f,
+	-3.722903e-06f,
+	-1.639207e-06f,
+	3.743794e-07f,
+	2.434799e-07f,
+	1.033562e-08f,
+
+	6.796975e-13f,
+	3.028391e-08f,
+	3.429327e-07f,
+	1.533129e-07f,
+	-2.381653e-06f,
+	-3.362902e-06f,
+	2.818012e-06f,
+	5.549129e-06f,
+	-7.730143e-06f,
+	-1.442826e-05f,
+	9.610539e-06f,
+	2.218591e-05f,
+	-1.904603e-05f,
+	-4.152736e-05f,
+	2.436549e-05f,
+	6.099155e-05f,
+	-4.081271e-05f,
+	-9.853282e-05f,
+	5.292404e-05f,
+	1.396760e-04f,
+	-8.145741e-05f,
+	-2.091059e-04f,
+	1.091566e-04f,
+	2.927488e-04f,
+	-1.673356e-04f,
+	-4.301636e-04f,
+	2.516314e-04f,
+	6.287859e-04f,
+	-4.580020e-04f,
+	-1.003609e-03f,
+	1.096064e-03f,
+	1.637627e-03f,
+	-4.526796e-03f,
+	2.145675e-03f,
+	4.145232e-04f,
+	-1.101584e-03f,
+	-1.052336e-04f,
+	6.698159e-04f,
+	3.002195e-05f,
+	-4.530127e-04f,
+	-1.773412e-05f,
+	3.074960e-04f,
+	5.672162e-06f,
+	-2.192365e-04f,
+	-9.621409e-06f,
+	1.469643e-04f,
+	3.757930e-06f,
+	-1.037174e-04f,
+	-7.827632e-06f,
+	6.474732e-05f,
+	3.035875e-06f,
+	-4.409246e-05f,
+	-5.743457e-06f,
+	2.397950e-05f,
+	1.860311e-06f,
+	-1.553771e-05f,
+	-3.479897e-06f,
+	6.287614e-06f,
+	8.373548e-07f,
+	-3.730381e-06f,
+	-1.590249e-06f,
+	3.838934e-07f,
+	2.369626e-07f,
+	9.510707e-09f,
+
+	1.211450e-12f,
+	3.221597e-08f,
+	3.493541e-07f,
+	1.330195e-07f,
+	-2.430267e-06f,
+	-3.321717e-06f,
+	2.939667e-06f,
+	5.462042e-06f,
+	-7.991417e-06f,
+	-1.428013e-05f,
+	1.008697e-05f,
+	2.193565e-05f,
+	-1.986400e-05f,
+	-4.113986e-05f,
+	2.567709e-05f,
+	6.040065e-05f,
+	-4.284127e-05f,
+	-9.767028e-05f,
+	5.594778e-05f,
+	1.384276e-04f,
+	-8.587554e-05f,
+	-2.073243e-04f,
+	1.155211e-04f,
+	2.901699e-04f,
+	-1.765358e-04f,
+	-4.263064e-04f,
+	2.652574e-04f,
+	6.224687e-04f,
+	-4.796820e-04f,
+	-9.907805e-04f,
+	1.137864e-03f,
+	1.584373e-03f,
+	-4.315000e-03f,
+	2.157865e-03f,
+	3.726245e-04f,
+	-1.101222e-03f,
+	-8.352802e-05f,
+	6.687104e-04f,
+	1.638393e-05f,
+	-4.520563e-04f,
+	-8.526817e-06f,
+	3.067888e-04f,
+	-6.970030e-07f,
+	-2.187407e-04f,
+	-5.199972e-06f,
+	1.466408e-04f,
+	7.318207e-07f,
+	-1.035129e-04f,
+	-5.797376e-06f,
+	6.463296e-05f,
+	1.723072e-06f,
+	-4.403054e-05f,
+	-4.924656e-06f,
+	2.395680e-05f,
+	1.383324e-06f,
+	-1.553044e-05f,
+	-3.218273e-06f,
+	6.294189e-06f,
+	7.154901e-07f,
+	-3.735905e-06f,
+	-1.541521e-06f,
+	3.928046e-07f,
+	2.304937e-07f,
+	8.736759e-09f,
+
+	2.034941e-12f,
+	3.423506e-08f,
+	3.557036e-07f,
+	1.120001e-07f,
+	-2.478582e-06f,
+	-3.278334e-06f,
+	3.060567e-06f,
+	5.370062e-06f,
+	-8.251149e-06f,
+	-1.412263e-05f,
+	1.056060e-05f,
+	2.166902e-05f,
+	-2.067723e-05f,
+	-4.072550e-05f,
+	2.698111e-05f,
+	5.976774e-05f,
+	-4.485819e-05f,
+	-9.674430e-05f,
+	5.895420e-05f,
+	1.370858e-04f,
+	-9.026843e-05f,
+	-2.054076e-04f,
+	1.218491e-04f,
+	2.873960e-04f,
+	-1.856832e-04f,
+	-4.221629e-04f,
+	2.788043e-04f,
+	6.157076e-04f,
+	-5.012320e-04f,
+	-9.771497e-04f,
+	1.179382e-03f,
+	1.528369e-03f,
+	-4.106987e-03f,
+	2.167988e-03f,
+	3.309698e-04f,
+	-1.100134e-03f,
+	-6.194250e-05f,
+	6.671901e-04f,
+	2.820436e-06f,
+	-4.508293e-04f,
+	6.304049e-07f,
+	3.058966e-04f,
+	-7.031580e-06f,
+	-2.181165e-04f,
+	-8.024942e-07f,
+	1.462287e-04f,
+	-2.277887e-06f,
+	-1.032484e-04f,
+	-3.778098e-06f,
+	6.447907e-05f,
+	4.173842e-07f,
+	-4.394350e-05f,
+	-4.110273e-06f,
+	2.391889e-05f,
+	9.089308e-07f,
+	-1.551458e-05f,
+	-2.958054e-06f,
+	6.296344e-06f,
+	5.942991e-07f,
+	-3.739501e-06f,
+	-1.493049e-06f,
+	4.011229e-07f,
+	2.240784e-07f,
+	8.011688e-09f,
+
+	3.256677e-12f,
+	3.634312e-08f,
+	3.619719e-07f,
+	9.025111e-08f,
+	-2.526560e-06f,
+	-3.232749e-06f,
+	3.180624e-06f,
+	5.273191e-06f,
+	-8.509161e-06f,
+	-1.395578e-05f,
+	1.103110e-05f,
+	2.138605e-05f,
+	-2.148519e-05f,
+	-4.028435e-05f,
+	2.827669e-05f,
+	5.909291e-05f,
+	-4.686216e-05f,
+	-9.575507e-05f,
+	6.194134e-05f,
+	1.356510e-04f,
+	-9.463324e-05f,
+	-2.033563e-04f,
+	1.281366e-04f,
+	2.844278e-04f,
+	-1.947718e-04f,
+	-4.177340e-04f,
+	2.922630e-04f,
+	6.085035e-04f,
+	-5.226372e-04f,
+	-9.627167e-04f,
+	1.220585e-03f,
+	1.469582e-03f,
+	-3.902749e-03f,
+	2.176084e-03f,
+	2.895836e-04f,
+	-1.098329e-03f,
+	-4.048950e-05f,
+	6.652587e-04f,
+	-1.066067e-05f,
+	-4.493342e-04f,
+	9.732252e-06f,
+	3.048209e-04f,
+	-1.332791e-05f,
+	-2.173652e-04f,
+	3.568490e-06f,
+	1.457289e-04f,
+	-5.269459e-06f,
+	-1.029244e-04f,
+	-1.770955e-06f,
+	6.428598e-05f,
+	-8.804412e-07f,
+	-4.383157e-05f,
+	-3.300772e-06f,
+	2.386593e-05f,
+	4.374003e-07f,
+	-1.549019e-05f,
+	-2.699386e-06f,
+	6.294127e-06f,
+	4.738505e-07f,
+	-3.741193e-06f,
+	-1.444860e-06f,
+	4.088589e-07f,
+	2.177214e-07f,
+	7.333433e-09f,
+
+	5.006261e-12f,
+	3.854205e-08f,
+	3.681499e-07f,
+	6.776932e-08f,
+	-2.574166e-06f,
+	-3.184961e-06f,
+	3.299750e-06f,
+	5.171431e-06f,
+	-8.765278e-06f,
+	-1.377958e-05f,
+	1.149816e-05f,
+	2.108677e-05f,
+	-2.228732e-05f,
+	-3.981649e-05f,
+	2.956298e-05f,
+	5.837630e-05f,
+	-4.885187e-05f,
+	-9.470277e-05f,
+	6.490728e-05f,
+	1.341236e-04f,
+	-9.896713e-05f,
+	-2.011707e-04f,
+	1.343795e-04f,
+	2.812659e-04f,
+	-2.037956e-04f,
+	-4.130207e-04f,
+	3.056246e-04f,
+	6.008575e-04f,
+	-5.438828e-04f,
+	-9.474821e-04f,
+	1.261437e-03f,
+	1.407976e-03f,
+	-3.702280e-03f,
+	2.182193e-03f,
+	2.484900e-04f,
+	-1.095815e-03f,
+	-1.918135e-05f,
+	6.629205e-04f,
+	-2.405165e-05f,
+	-4.475734e-04f,
+	1.877349e-05f,
+	3.035634e-04f,
+	-1.958237e-05f,
+	-2.164879e-04f,
+	7.910478e-06f,
+	1.451423e-04f,
+	-8.241185e-06f,
+	-1.025416e-04f,
+	2.229103e-07f,
+	6.405410e-05f,
+	-2.169666e-06f,
+	-4.369500e-05f,
+	-2.496607e-06f,
+	2.379808e-05f,
+	-3.100149e-08f,
+	-1.545738e-05f,
+	-2.442413e-06f,
+	6.287592e-06f,
+	3.542115e-07f,
+	-3.741010e-06f,
+	-1.396976e-06f,
+	4.160229e-07f,
+	2.114273e-07f,
+	6.699958e-09f,
+
+	7.438557e-12f,
+	4.083367e-08f,
+	3.742281e-07f,
+	4.455214e-08f,
+	-2.621364e-06f,
+	-3.134970e-06f,
+	3.417857e-06f,
+	5.064793e-06f,
+	-9.019320e-06f,
+	-1.359406e-05f,
+	1.196144e-05f,
+	2.077124e-05f,
+	-2.308311e-05f,
+	-3.932200e-05f,
+	3.083911e-05f,
+	5.761807e-05f,
+	-5.082600e-05f,
+	-9.358769e-05f,
+	6.785004e-05f,
+	1.325038e-04f,
+	-1.032673e-04f,
+	-1.988516e-04f,
+	1.405738e-04f,
+	2.779111e-04f,
+	-2.127488e-04f,
+	-4.080239e-04f,
+	3.188802e-04f,
+	5.927713e-04f,
+	-5.649538e-04f,
+	-9.314467e-04f,
+	1.301905e-03f,
+	1.343517e-03f,
+	-3.505570e-03f,
+	2.186357e-03f,
+	2.077125e-04f,
+	-1.092601e-03f,
+	1.969814e-06f,
+	6.601798e-04f,
+	-3.734486e-05f,
+	-4.455497e-04f,
+	2.774897e-05f,
+	3.021260e-04f,
+	-2.579140e-05f,
+	-2.154858e-04f,
+	1.222100e-05f,
+	1.444696e-04f,
+	-1.119138e-05f,
+	-1.021005e-04f,
+	2.202371e-06f,
+	6.378382e-05f,
+	-3.449564e-06f,
+	-4.353406e-05f,
+	-1.698229e-06f,
+	2.371551e-05f,
+	-4.960131e-07f,
+	-1.541626e-05f,
+	-2.187272e-06f,
+	6.276795e-06f,
+	2.354480e-07f,
+	-3.738976e-06f,
+	-1.349424e-06f,
+	4.226259e-07f,
+	2.052005e-07f,
+	6.109260e-09f,
+
+	1.073579e-11f,
+	4.321976e-08f,
+	3.801968e-07f,
+	2.059747e-08f,
+	-2.668116e-06f,
+	-3.082778e-06f,
+	3.534856e-06f,
+	4.953285e-06f,
+	-9.271108e-06f,
+	-1.339925e-05f,
+	1.242064e-05f,
+	2.043951e-05f,
+	-2.387200e-05f,
+	-3.880099e-05f,
+	3.210424e-05f,
+	5.681840e-05f,
+	-5.278326e-05f,
+	-9.241010e-05f,
+	7.076770e-05f,
+	1.307921e-04f,
+	-1.075309e-04f,
+	-1.963994e-04f,
+	1.467153e-04f,
+	2.743643e-04f,
+	-2.216255e-04f,
+	-4.027452e-04f,
+	3.320209e-04f,
+	5.842463e-04f,
+	-5.858353e-04f,
+	-9.146121e-04f,
+	1.341955e-03f,
+	1.276172e-03f,
+	-3.312609e-03f,
+	2.188615e-03f,
+	1.672740e-04f,
+	-1.088696e-03f,
+	2.295206e-05f,
+	6.570412e-04f,
+	-5.053275e-05f,
+	-4.432659e-04f,
+	3.665359e-05f,
+	3.005105e-04f,
+	-3.195148e-05f,
+	-2.143602e-04f,
+	1.649761e-05f,
+	1.437118e-04f,
+	-1.411837e-05f,
+	-1.016018e-04f,
+	4.166317e-06f,
+	6.347557e-05f,
+	-4.719418e-06f,
+	-4.334903e-05f,
+	-9.060779e-07f,
+	2.361839e-05f,
+	-9.573776e-07f,
+	-1.536691e-05f,
+	-1.934104e-06f,
+	6.261793e-06f,
+	1.176245e-07f,
+	-3.735121e-06f,
+	-1.302226e-06f,
+	4.286787e-07f,
+	1.990450e-07f,
+	5.559367e-09f,
+
+	1.510960e-11f,
+	4.570204e-08f,
+	3.860461e-07f,
+	-4.096293e-09f,
+	-2.714387e-06f,
+	-3.028388e-06f,
+	3.650656e-06f,
+	4.836924e-06f,
+	-9.520465e-06f,
+	-1.319519e-05f,
+	1.287542e-05f,
+	2.009166e-05f,
+	-2.465346e-05f,
+	-3.825358e-05f,
+	3.335750e-05f,
+	5.597750e-05f,
+	-5.472234e-05f,
+	-9.117035e-05f,
+	7.365832e-05f,
+	1.289890e-04f,
+	-1.117551e-04f,
+	-1.938151e-04f,
+	1.528000e-04f,
+	2.706267e-04f,
+	-2.304196e-04f,
+	-3.971859e-04f,
+	3.450377e-04f,
+	5.752848e-04f,
+	-6.065123e-04f,
+	-8.969804e-04f,
+	1.381551e-03f,
+	1.205908e-03f,
+	-3.123387e-03f,
+	2.189008e-03f,
+	1.271970e-04f,
+	-1.084108e-03f,
+	4.375366e-05f,
+	6.535096e-04f,
+	-6.360792e-05f,
+	-4.407250e-04f,
+	4.548232e-05f,
+	2.987190e-04f,
+	-3.805912e-05f,
+	-2.131126e-04f,
+	2.073791e-05f,
+	1.428699e-04f,
+	-1.702052e-05f,
+	-1.010461e-04f,
+	6.113654e-06f,
+	6.312980e-05f,
+	-5.978524e-06f,
+	-4.314020e-05f,
+	-1.205895e-07f,
+	2.350690e-05f,
+	-1.414842e-06f,
+	-1.530946e-05f,
+	-1.683041e-06f,
+	6.242644e-06f,
+	8.040048e-10f,
+	-3.729474e-06f,
+	-1.255404e-06f,
+	4.341926e-07f,
+	1.929648e-07f,
+	5.048344e-09f,
+
+	2.080305e-11f,
+	4.828216e-08f,
+	3.917661e-07f,
+	-2.953019e-08f,
+	-2.760139e-06f,
+	-2.971804e-06f,
+	3.765170e-06f,
+	4.715726e-06f,
+	-9.767211e-06f,
+	-1.298192e-05f,
+	1.332547e-05f,
+	1.972777e-05f,
+	-2.542695e-05f,
+	-3.767994e-05f,
+	3.459805e-05f,
+	5.509561e-05f,
+	-5.664192e-05f,
+	-8.986879e-05f,
+	7.651997e-05f,
+	1.270952e-04f,
+	-1.159371e-04f,
+	-1.910993e-04f,
+	1.588238e-04f,
+	2.666993e-04f,
+	-2.391254e-04f,
+	-3.913477e-04f,
+	3.579217e-04f,
+	5.658888e-04f,
+	-6.269700e-04f,
+	-8.785540e-04f,
+	1.420658e-03f,
+	1.132691e-03f,
+	-2.937894e-03f,
+	2.187576e-03f,
+	8.750339e-05f,
+	-1.078849e-03f,
+	6.436308e-05f,
+	6.495898e-04f,
+	-7.656305e-05f,
+	-4.379301e-04f,
+	5.423024e-05f,
+	2.967535e-04f,
+	-4.411091e-05f,
+	-2.117445e-04f,
+	2.493953e-05f,
+	1.419449e-04f,
+	-1.989621e-05f,
+	-1.004341e-04f,
+	8.043306e-06f,
+	6.274697e-05f,
+	-7.226188e-06f,
+	-4.290788e-05f,
+	6.578095e-07f,
+	2.338124e-05f,
+	-1.868160e-06f,
+	-1.524401e-05f,
+	-1.434217e-06f,
+	6.219410e-06f,
+	-1.149519e-07f,
+	-3.722064e-06f,
+	-1.208982e-06f,
+	4.391788e-07f,
+	1.869636e-07f,
+	4.574292e-09f,
+
+	2.809259e-11f,
+	5.096168e-08f,
+	3.973464e-07f,
+	-5.570474e-08f,
+	-2.805334e-06f,
+	-2.913033e-06f,
+	3.878306e-06f,
+	4.589712e-06f,
+	-1.001117e-05f,
+	-1.275948e-05f,
+	1.377047e-05f,
+	1.934793e-05f,
+	-2.619194e-05f,
+	-3.708021e-05f,
+	3.582503e-05f,
+	5.417300e-05f,
+	-5.854071e-05f,
+	-8.850585e-05f,
+	7.935072e-05f,
+	1.251112e-04f,
+	-1.200741e-04f,
+	-1.882530e-04f,
+	1.647827e-04f,
+	2.625835e-04f,
+	-2.477369e-04f,
+	-3.852325e-04f,
+	3.706640e-04f,
+	5.560611e-04f,
+	-6.471932e-04f,
+	-8.593358e-04f,
+	1.459241e-03f,
+	1.056489e-03f,
+	-2.756116e-03f,
+	2.184361e-03f,
+	4.821450e-05f,
+	-1.072928e-03f,
+	8.476900e-05f,
+	6.452870e-04f,
+	-8.939097e-05f,
+	-4.348844e-04f,
+	6.289247e-05f,
+	2.946164e-04f,
+	-5.010348e-05f,
+	-2.102572e-04f,
+	2.910014e-05f,
+	1.409378e-04f,
+	-2.274386e-05f,
+	-9.976656e-05f,
+	9.954215e-06f,
+	6.232758e-05f,
+	-8.461729e-06f,
+	-4.265237e-05f,
+	1.428700e-06f,
+	2.324159e-05f,
+	-2.317086e-06f,
+	-1.517068e-05f,
+	-1.187761e-06f,
+	6.192155e-06f,
+	-2.295831e-07f,
+	-3.712921e-06f,
+	-1.162980e-06f,
+	4.436487e-07f,
+	1.810448e-07f,
+	4.135350e-09f,
+
+	3.728988e-11f,
+	5.374212e-08f,
+	4.027767e-07f,
+	-8.261990e-08f,
+	-2.849934e-06f,
+	-2.852082e-06f,
+	3.989975e-06f,
+	4.458906e-06f,
+	-1.025215e-05f,
+	-1.252794e-05f,
+	1.421009e-05f,
+	1.895224e-05f,
+	-2.694788e-05f,
+	-3.645457e-05f,
+	3.703758e-05f,
+	5.320995e-05f,
+	-6.041742e-05f,
+	-8.708199e-05f,
+	8.214865e-05f,
+	1.230376e-04f,
+	-1.241634e-04f,
+	-1.852773e-04f,
+	1.706727e-04f,
+	2.582808e-04f,
+	-2.562483e-04f,
+	-3.788422e-04f,
+	3.832558e-04f,
+	5.458045e-04f,
+	-6.671671e-04f,
+	-8.393296e-04f,
+	1.497262e-03f,
+	9.772704e-04f,
+	-2.578042e-03f,
+	2.179402e-03f,
+	9.351103e-06f,
+	-1.066355e-03f,
+	1.049604e-04f,
+	6.406067e-04f,
+	-1.020846e-04f,
+	-4.315914e-04f,
+	7.146422e-05f,
+	2.923097e-04f,
+	-5.603352e-05f,
+	-2.086524e-04f,
+	3.321746e-05f,
+	1.398497e-04f,
+	-2.556189e-05f,
+	-9.904422e-05f,
+	1.184534e-05f,
+	6.187212e-05f,
+	-9.684477e-06f,
+	-4.237402e-05f,
+	2.191670e-06f,
+	2.308817e-05f,
+	-2.761384e-06f,
+	-1.508959e-05f,
+	-9.437987e-07f,
+	6.160943e-06f,
+	-3.430311e-07f,
+	-3.702077e-06f,
+	-1.117418e-06f,
+	4.476141e-07f,
+	1.752116e-07f,
+	3.729701e-09f,
+
+	4.874364e-11f,
+	5.662488e-08f,
+	4.080464e-07f,
+	-1.102751e-07f,
+	-2.893902e-06f,
+	-2.788961e-06f,
+	4.100086e-06f,
+	4.323337e-06f,
+	-1.048999e-05f,
+	-1.228734e-05f,
+	1.464401e-05f,
+	1.854082e-05f,
+	-2.769425e-05f,
+	-3.580322e-05f,
+	3.823487e-05f,
+	5.220679e-05f,
+	-6.227074e-05f,
+	-8.559769e-05f,
+	8.491184e-05f,
+	1.208753e-04f,
+	-1.282021e-04f,
+	-1.821731e-04f,
+	1.764898e-04f,
+	2.537927e-04f,
+	-2.646538e-04f,
+	-3.721792e-04f,
+	3.956882e-04f,
+	5.351221e-04f,
+	-6.868767e-04f,
+	-8.185392e-04f,
+	1.534687e-03f,
+	8.950040e-04f,
+	-2.403659e-03f,
+	2.172741e-03f,
+	-2.906655e-05f,
+	-1.059141e-03f,
+	1.249262e-04f,
+	6.355544e-04f,
+	-1.146371e-04f,
+	-4.280546e-04f,
+	7.994081e-05f,
+	2.898359e-04f,
+	-6.189777e-05f,
+	-2.069318e-04f,
+	3.728922e-05f,
+	1.386818e-04f,
+	-2.834878e-05f,
+	-9.826787e-05f,
+	1.371566e-05f,
+	6.138112e-05f,
+	-1.089378e-05f,
+	-4.207315e-05f,
+	2.946317e-06f,
+	2.292119e-05f,
+	-3.200821e-06f,
+	-1.500086e-05f,
+	-7.024545e-07f,
+	6.125842e-06f,
+	-4.552389e-07f,
+	-3.689563e-06f,
+	-1.072318e-06f,
+	4.510865e-07f,
+	1.694672e-07f,
+	3.355570e-09f,
+
+	6.284138e-11f,
+	5.961130e-08f,
+	4.131448e-07f,
+	-1.386690e-07f,
+	-2.937200e-06f,
+	-2.723679e-06f,
+	4.208549e-06f,
+	4.183034e-06f,
+	-1.072450e-05f,
+	-1.203775e-05f,
+	1.507192e-05f,
+	1.811378e-05f,
+	-2.843051e-05f,
+	-3.512638e-05f,
+	3.941605e-05f,
+	5.116386e-05f,
+	-6.409941e-05f,
+	-8.405349e-05f,
+	8.763839e-05f,
+	1.186250e-04f,
+	-1.321874e-04f,
+	-1.789417e-04f,
+	1.822300e-04f,
+	2.491208e-04f,
+	-2.729476e-04f,
+	-3.652457e-04f,
+	4.079524e-04f,
+	5.240173e-04f,
+	-7.063071e-04f,
+	-7.969695e-04f,
+	1.571477e-03f,
+	8.096586e-04f,
+	-2.232953e-03f,
+	2.164419e-03f,
+	-6.701879e-05f,
+	-1.051297e-03f,
+	1.446560e-04f,
+	6.301359e-04f,
+	-1.270415e-04f,
+	-4.242775e-04f,
+	8.831760e-05f,
+	2.871975e-04f,
+	-6.769304e-05f,
+	-2.050971e-04f,
+	4.131322e-05f,
+	1.374353e-04f,
+	-3.110302e-05f,
+	-9.743831e-05f,
+	1.556417e-05f,
+	6.085513e-05f,
+	-1.208898e-05f,
+	-4.175012e-05f,
+	3.692246e-06f,
+	2.274085e-05f,
+	-3.635168e-06f,
+	-1.490462e-05f,
+	-4.638487e-07f,
+	6.086919e-06f,
+	-5.661510e-07f,
+	-3.675412e-06f,
+	-1.027697e-06f,
+	4.540780e-07f,
+	1.638143e-07f,
+	3.011224e-09f,
+
+	8.001108e-11f,
+	6.270260e-08f,
+	4.180610e-07f,
+	-1.678000e-07f,
+	-2.979789e-06f,
+	-2.656251e-06f,
+	4.315274e-06f,
+	4.038032e-06f,
+	-1.095551e-05f,
+	-1.177926e-05f,
+	1.549349e-05f,
+	1.767128e-05f,
+	-2.915612e-05f,
+	-3.442427e-05f,
+	4.058027e-05f,
+	5.008154e-05f,
+	-6.590214e-05f,
+	-8.244997e-05f,
+	9.032643e-05f,
+	1.162877e-04f,
+	-1.361167e-04f,
+	-1.755843e-04f,
+	1.878893e-04f,
+	2.442670e-04f,
+	-2.811238e-04f,
+	-3.580445e-04f,
+	4.200397e-04f,
+	5.124939e-04f,
+	-7.254433e-04f,
+	-7.746254e-04f,
+	1.607597e-03f,
+	7.212039e-04f,
+	-2.065907e-03f,
+	2.154476e-03f,
+	-1.044865e-04f,
+	-1.042834e-03f,
+	1.641393e-04f,
+	6.243571e-04f,
+	-1.392913e-04f,
+	-4.202641e-04f,
+	9.659008e-05f,
+	2.843971e-04f,
+	-7.341619e-05f,
+	-2.031500e-04f,
+	4.528728e-05f,
+	1.361113e-04f,
+	-3.382313e-05f,
+	-9.655640e-05f,
+	1.738989e-05f,
+	6.029470e-05f,
+	-1.326947e-05f,
+	-4.140530e-05f,
+	4.429070e-06f,
+	2.254740e-05f,
+	-4.064202e-06f,
+	-1.480100e-05f,
+	-2.280991e-07f,
+	6.044245e-06f,
+	-6.757134e-07f,
+	-3.659658e-06f,
+	-9.835757e-07f,
+	4.566003e-07f,
+	1.582556e-07f,
+	2.694980e-09f,
+
+	1.007227e-10f,
+	6.589993e-08f,
+	4.227840e-07f,
+	-1.976656e-07f,
+	-3.021631e-06f,
+	-2.586690e-06f,
+	4.420170e-06f,
+	3.888369e-06f,
+	-1.118282e-05f,
+	-1.151193e-05f,
+	1.590842e-05f,
+	1.721344e-05f,
+	-2.987057e-05f,
+	-3.369715e-05f,
+	4.172672e-05f,
+	4.896022e-05f,
+	-6.767765e-05f,
+	-8.078775e-05f,
+	9.297406e-05f,
+	1.138641e-04f,
+	-1.399872e-04f,
+	-1.721023e-04f,
+	1.934638e-04f,
+	2.392332e-04f,
+	-2.891768e-04f,
+	-3.505781e-04f,
+	4.319413e-04f,
+	5.005558e-04f,
+	-7.442705e-04f,
+	-7.515126e-04f,
+	1.643008e-03f,
+	6.296101e-04f,
+	-1.902509e-03f,
+	2.142953e-03f,
+	-1.414511e-04f,
+	-1.033764e-03f,
+	1.833659e-04f,
+	6.182241e-04f,
+	-1.513799e-04f,
+	-4.160180e-04f,
+	1.047538e-04f,
+	2.814372e-04f,
+	-7.906415e-05f,
+	-2.010923e-04f,
+	4.920929e-05f,
+	1.347112e-04f,
+	-3.650766e-05f,
+	-9.562297e-05f,
+	1.919186e-05f,
+	5.970041e-05f,
+	-1.443461e-05f,
+	-4.103905e-05f,
+	5.156412e-06f,
+	2.234105e-05f,
+	-4.487707e-06f,
+	-1.469014e-05f,
+	4.679825e-09f,
+	5.997892e-06f,
+	-7.838740e-07f,
+	-3.642333e-06f,
+	-9.399707e-07f,
+	4.586656e-07f,
+	1.527934e-07f,
+	2.405201e-09f,
+
+	1.254898e-10f,
+	6.920433e-08f,
+	4.273025e-07f,
+	-2.282630e-07f,
+	-3.062687e-06f,
+	-2.515011e-06f,
+	4.523148e-06f,
+	3.734086e-06f,
+	-1.140628e-05f,
+	-1.123585e-05f,
+	1.631637e-05f,
+	1.674043e-05f,
+	-3.057333e-05f,
+	-3.294527e-05f,
+	4.285455e-05f,
+	4.780033e-05f,
+	-6.942470e-05f,
+	-7.906747e-05f,
+	9.557942e-05f,
+	1.113553e-04f,
+	-1.437963e-04f,
+	-1.684970e-04f,
+	1.989496e-04f,
+	2.340214e-04f,
+	-2.971009e-04f,
+	-3.428496e-04f,
+	4.436486e-04f,
+	4.882074e-04f,
+	-7.627739e-04f,
+	-7.276374e-04f,
+	1.677674e-03f,
+	5.348477e-04f,
+	-1.742740e-03f,
+	2.129890e-03f,
+	-1.778946e-04f,
+	-1.024097e-03f,
+	2.023259e-04f,
+	6.117432e-04f,
+	-1.633009e-04f,
+	-4.115434e-04f,
+	1.128044e-04f,
+	2.783206e-04f,
+	-8.463390e-05f,
+	-1.989260e-04f,
+	5.307716e-05f,
+	1.332362e-04f,
+	-3.915519e-05f,
+	-9.463893e-05f,
+	2.096914e-05f,
+	5.907286e-05f,
+	-1.558382e-05f,
+	-4.065175e-05f,
+	5.873903e-06f,
+	2.212205e-05f,
+	-4.905469e-06f,
+	-1.457217e-05f,
+	2.343765e-07f,
+	5.947933e-06f,
+	-8.905820e-07f,
+	-3.623471e-06f,
+	-8.968995e-07f,
+	4.602858e-07f,
+	1.474301e-07f,
+	2.140298e-09f,
+
+	1.548707e-10f,
+	7.261671e-08f,
+	4.316052e-07f,
+	-2.595884e-07f,
+	-3.102919e-06f,
+	-2.441233e-06f,
+	4.624116e-06f,
+	3.575227e-06f,
+	-1.162570e-05f,
+	-1.095112e-05f,
+	1.671704e-05f,
+	1.625242e-05f,
+	-3.126387e-05f,
+	-3.216893e-05f,
+	4.396294e-05f,
+	4.660233e-05f,
+	-7.114203e-05f,
+	-7.728983e-05f,
+	9.814068e-05f,
+	1.087624e-04f,
+	-1.475411e-04f,
+	-1.647699e-04f,
+	2.043428e-04f,
+	2.286337e-04f,
+	-3.048904e-04f,
+	-3.348620e-04f,
+	4.551530e-04f,
+	4.754532e-04f,
+	-7.809387e-04f,
+	-7.030065e-04f,
+	1.711556e-03f,
+	4.368880e-04f,
+	-1.586585e-03f,
+	2.115330e-03f,
+	-2.137996e-04f,
+	-1.013847e-03f,
+	2.210096e-04f,
+	6.049209e-04f,
+	-1.750481e-04f,
+	-4.068445e-04f,
+	1.207377e-04f,
+	2.750500e-04f,
+	-9.012250e-05f,
+	-1.966530e-04f,
+	5.688885e-05f,
+	1.316877e-04f,
+	-4.176434e-05f,
+	-9.360520e-05f,
+	2.272080e-05f,
+	5.841266e-05f,
+	-1.671649e-05f,
+	-4.024381e-05f,
+	6.581184e-06f,
+	2.189063e-05f,
+	-5.317283e-06f,
+	-1.444723e-05f,
+	4.608826e-07f,
+	5.894444e-06f,
+	-9.957882e-07f,
+	-3.603108e-06f,
+	-8.543785e-07f,
+	4.614733e-07f,
+	1.421675e-07f,
+	1.898733e-09f,
+
+	1.894703e-10f,
+	7.613792e-08f,
+	4.356808e-07f,
+	-2.916377e-07f,
+	-3.142288e-06f,
+	-2.365373e-06f,
+	4.722985e-06f,
+	3.411841e-06f,
+	-1.184090e-05f,
+	-1.065783e-05f,
+	1.711012e-05f,
+	1.574958e-05f,
+	-3.194169e-05f,
+	-3.136842e-05f,
+	4.505109e-05f,
+	4.536668e-05f,
+	-7.282838e-05f,
+	-7.545557e-05f,
+	1.006560e-04f,
+	1.060863e-04f,
+	-1.512191e-04f,
+	-1.609227e-04f,
+	2.096396e-04f,
+	2.230725e-04f,
+	-3.125397e-04f,
+	-3.266187e-04f,
+	4.664459e-04f,
+	4.622980e-04f,
+	-7.987501e-04f,
+	-6.776272e-04f,
+	1.744616e-03f,
+	3.357026e-04f,
+	-1.434025e-03f,
+	2.099312e-03f,
+	-2.491492e-04f,
+	-1.003025e-03f,
+	2.394075e-04f,
+	5.977637e-04f,
+	-1.866153e-04f,
+	-4.019252e-04f,
+	1.285494e-04f,
+	2.716284e-04f,
+	-9.552707e-05f,
+	-1.942752e-04f,
+	6.064238e-05f,
+	1.300671e-04f,
+	-4.433375e-05f,
+	-9.252273e-05f,
+	2.444596e-05f,
+	5.772043e-05f,
+	-1.783206e-05f,
+	-3.981563e-05f,
+	7.277902e-06f,
+	2.164705e-05f,
+	-5.722948e-06f,
+	-1.431547e-05f,
+	6.840928e-07f,
+	5.837499e-06f,
+	-1.099446e-06f,
+	-3.581279e-06f,
+	-8.124236e-07f,
+	4.622402e-07f,
+	1.370076e-07f,
+	1.679018e-09f,
+
+	2.299405e-10f,
+	7.976863e-08f,
+	4.395176e-07f,
+	-3.244060e-07f,
+	-3.180755e-06f,
+	-2.287453e-06f,
+	4.819666e-06f,
+	3.243979e-06f,
+	-1.205172e-05f,
+	-1.035609e-05f,
+	1.749529e-05f,
+	1.523210e-05f,
+	-3.260625e-05f,
+	-3.054406e-05f,
+	4.611816e-05f,
+	4.409391e-05f,
+	-7.448255e-05f,
+	-7.356546e-05f,
+	1.031235e-04f,
+	1.033283e-04f,
+	-1.548276e-04f,
+	-1.569571e-04f,
+	2.148363e-04f,
+	2.173402e-04f,
+	-3.200434e-04f,
+	-3.181231e-04f,
+	4.775189e-04f,
+	4.487470e-04f,
+	-8.161937e-04f,
+	-6.515073e-04f,
+	1.776816e-03f,
+	2.312639e-04f,
+	-1.285043e-03f,
+	2.081877e-03f,
+	-2.839270e-04f,
+	-9.916427e-04f,
+	2.575104e-04f,
+	5.902785e-04f,
+	-1.979967e-04f,
+	-3.967902e-04f,
+	1.362356e-04f,
+	2.680587e-04f,
+	-1.008448e-04f,
+	-1.917947e-04f,
+	6.433579e-05f,
+	1.283758e-04f,
+	-4.686210e-05f,
+	-9.139246e-05f,
+	2.614373e-05f,
+	5.699682e-05f,
+	-1.892996e-05f,
+	-3.936761e-05f,
+	7.963718e-06f,
+	2.139155e-05f,
+	-6.122268e-06f,
+	-1.417704e-05f,
+	9.039052e-07f,
+	5.777178e-06f,
+	-1.201508e-06f,
+	-3.558018e-06f,
+	-7.710497e-07f,
+	4.625987e-07f,
+	1.319519e-07f,
+	1.479716e-09f,
+
+	2.769822e-10f,
+	8.350943e-08f,
+	4.431039e-07f,
+	-3.578878e-07f,
+	-3.218282e-06f,
+	-2.207495e-06f,
+	4.914069e-06f,
+	3.071696e-06f,
+	-1.225796e-05f,
+	-1.004600e-05f,
+	1.787225e-05f,
+	1.470018e-05f,
+	-3.325706e-05f,
+	-2.969618e-05f,
+	4.716337e-05f,
+	4.278453e-05f,
+	-7.610331e-05f,
+	-7.162031e-05f,
+	1.055415e-04f,
+	1.004896e-04f,
+	-1.583641e-04f,
+	-1.528747e-04f,
+	2.199289e-04f,
+	2.114392e-04f,
+	-3.273958e-04f,
+	-3.093789e-04f,
+	4.883637e-04f,
+	4.348055e-04f,
+	-8.332549e-04f,
+	-6.246554e-04f,
+	1.808118e-03f,
+	1.235447e-04f,
+	-1.139619e-03f,
+	2.063065e-03f,
+	-3.181174e-04f,
+	-9.797141e-04f,
+	2.753094e-04f,
+	5.824721e-04f,
+	-2.091864e-04f,
+	-3.914437e-04f,
+	1.437923e-04f,
+	2.643440e-04f,
+	-1.060729e-04f,
+	-1.892136e-04f,
+	6.796719e-05f,
+	1.266152e-04f,
+	-4.934811e-05f,
+	-9.021539e-05f,
+	2.781326e-05f,
+	5.624248e-05f,
+	-2.000965e-05f,
+	-3.890018e-05f,
+	8.638299e-06f,
+	2.112440e-05f,
+	-6.515053e-06f,
+	-1.403207e-05f,
+	1.120221e-06f,
+	5.713558e-06f,
+	-1.301931e-06f,
+	-3.533364e-06f,
+	-7.302712e-07f,
+	4.625612e-07f,
+	1.270019e-07f,
+	1.299444e-09f,
+
+	3.313457e-10f,
+	8.736077e-08f,
+	4.464281e-07f,
+	-3.920771e-07f,
+	-3.254830e-06f,
+	-2.125523e-06f,
+	5.006105e-06f,
+	2.895050e-06f,
+	-1.245948e-05f,
+	-9.727691e-06f,
+	1.824069e-05f,
+	1.415404e-05f,
+	-3.389361e-05f,
+	-2.882514e-05f,
+	4.818592e-05f,
+	4.143911e-05f,
+	-7.768944e-05f,
+	-6.962098e-05f,
+	1.079081e-04f,
+	9.757145e-05f,
+	-1.618258e-04f,
+	-1.486774e-04f,
+	2.249139e-04f,
+	2.053723e-04f,
+	-3.345916e-04f,
+	-3.003899e-04f,
+	4.989717e-04f,
+	4.204794e-04f,
+	-8.499192e-04f,
+	-5.970803e-04f,
+	1.838482e-03f,
+	1.251851e-05f,
+	-9.977339e-04f,
+	2.042918e-03f,
+	-3.517053e-04f,
+	-9.672514e-04f,
+	2.927959e-04f,
+	5.743516e-04f,
+	-2.201788e-04f,
+	-3.858903e-04f,
+	1.512155e-04f,
+	2.604872e-04f,
+	-1.112088e-04f,
+	-1.865341e-04f,
+	7.153474e-05f,
+	1.247868e-04f,
+	-5.179051e-05f,
+	-8.899254e-05f,
+	2.945372e-05f,
+	5.545809e-05f,
+	-2.107060e-05f,
+	-3.841377e-05f,
+	9.301322e-06f,
+	2.084586e-05f,
+	-6.901120e-06f,
+	-1.388073e-05f,
+	1.332945e-06f,
+	5.646721e-06f,
+	-1.400673e-06f,
+	-3.507351e-06f,
+	-6.901016e-07f,
+	4.621400e-07f,
+	1.221589e-07f,
+	1.136870e-09f,
+
+	3.938318e-10f,
+	9.132297e-08f,
+	4.494781e-07f,
+	-4.269669e-07f,
+	-3.290360e-06f,
+	-2.041562e-06f,
+	5.095686e-06f,
+	2.714102e-06f,
+	-1.265608e-05f,
+	-9.401275e-06f,
+	1.860031e-05f,
+	1.359389e-05f,
+	-3.451539e-05f,
+	-2.793130e-05f,
+	4.918501e-05f,
+	4.005824e-05f,
+	-7.923978e-05f,
+	-6.756836e-05f,
+	1.102216e-04f,
+	9.457512e-05f,
+	-1.652104e-04f,
+	-1.443671e-04f,
+	2.297875e-04f,
+	1.991421e-04f,
+	-3.416254e-04f,
+	-2.911600e-04f,
+	5.093350e-04f,
+	4.057745e-04f,
+	-8.661722e-04f,
+	-5.687915e-04f,
+	1.867870e-03f,
+	-1.018407e-04f,
+	-8.593675e-04f,
+	2.021476e-03f,
+	-3.846758e-04f,
+	-9.542677e-04f,
+	3.099613e-04f,
+	5.659242e-04f,
+	-2.309684e-04f,
+	-3.801347e-04f,
+	1.585017e-04f,
+	2.564916e-04f,
+	-1.162498e-04f,
+	-1.837583e-04f,
+	7.503664e-05f,
+	1.228922e-04f,
+	-5.418809e-05f,
+	-8.772493e-05f,
+	3.106431e-05f,
+	5.464433e-05f,
+	-2.211230e-05f,
+	-3.790883e-05f,
+	9.952476e-06f,
+	2.055620e-05f,
+	-7.280290e-06f,
+	-1.372317e-05f,
+	1.541984e-06f,
+	5.576745e-06f,
+	-1.497692e-06f,
+	-3.480016e-06f,
+	-6.505541e-07f,
+	4.613474e-07f,
+	1.174240e-07f,
+	9.907172e-10f,
+
+	4.652928e-10f,
+	9.539620e-08f,
+	4.522421e-07f,
+	-4.625499e-07f,
+	-3.324833e-06f,
+	-1.955641e-06f,
+	5.182725e-06f,
+	2.528919e-06f,
+	-1.284760e-05f,
+	-9.066885e-06f,
+	1.895081e-05f,
+	1.301996e-05f,
+	-3.512192e-05f,
+	-2.701505e-05f,
+	5.015988e-05f,
+	3.864251e-05f,
+	-8.075312e-05f,
+	-6.546337e-05f,
+	1.124803e-04f,
+	9.150200e-05f,
+	-1.685153e-04f,
+	-1.399458e-04f,
+	2.345462e-04f,
+	1.927515e-04f,
+	-3.484919e-04f,
+	-2.816934e-04f,
+	5.194452e-04f,
+	3.906971e-04f,
+	-8.819998e-04f,
+	-5.397991e-04f,
+	1.896241e-03f,
+	-2.195583e-04f,
+	-7.244988e-04f,
+	1.998778e-03f,
+	-4.170152e-04f,
+	-9.407760e-04f,
+	3.267976e-04f,
+	5.571973e-04f,
+	-2.415499e-04f,
+	-3.741816e-04f,
+	1.656471e-04f,
+	2.523603e-04f,
+	-1.211934e-04f,
+	-1.808885e-04f,
+	7.847113e-05f,
+	1.209329e-04f,
+	-5.653966e-05f,
+	-8.641362e-05f,
+	3.264423e-05f,
+	5.380190e-05f,
+	-2.313424e-05f,
+	-3.738579e-05f,
+	1.059146e-05f,
+	2.025569e-05f,
+	-7.652393e-06f,
+	-1.355954e-05f,
+	1.747250e-06f,
+	5.503715e-06f,
+	-1.592949e-06f,
+	-3.451398e-06f,
+	-6.116408e-07f,
+	4.601955e-07f,
+	1.127980e-07f,
+	8.597608e-10f,
+
+	5.466329e-10f,
+	9.958051e-08f,
+	4.547080e-07f,
+	-4.988179e-07f,
+	-3.358212e-06f,
+	-1.867787e-06f,
+	5.267133e-06f,
+	2.339568e-06f,
+	-1.303387e-05f,
+	-8.724657e-06f,
+	1.929189e-05f,
+	1.243249e-05f,
+	-3.571271e-05f,
+	-2.607680e-05f,
+	5.110976e-05f,
+	3.719258e-05f,
+	-8.222831e-05f,
+	-6.330699e-05f,
+	1.146825e-04f,
+	8.835353e-05f,
+	-1.717379e-04f,
+	-1.354156e-04f,
+	2.391863e-04f,
+	1.862036e-04f,
+	-3.551859e-04f,
+	-2.719946e-04f,
+	5.292944e-04f,
+	3.752538e-04f,
+	-8.973880e-04f,
+	-5.101138e-04f,
+	1.923558e-03f,
+	-3.406591e-04f,
+	-5.931061e-04f,
+	1.974866e-03f,
+	-4.487098e-04f,
+	-9.267898e-04f,
+	3.432968e-04f,
+	5.481782e-04f,
+	-2.519180e-04f,
+	-3.680358e-04f,
+	1.726481e-04f,
+	2.480968e-04f,
+	-1.260371e-04f,
+	-1.779269e-04f,
+	8.183654e-05f,
+	1.189104e-04f,
+	-5.884407e-05f,
+	-8.505968e-05f,
+	3.419274e-05f,
+	5.293151e-05f,
+	-2.413595e-05f,
+	-3.684511e-05f,
+	1.121797e-05f,
+	1.994462e-05f,
+	-8.017260e-06f,
+	-1.339001e-05f,
+	1.948657e-06f,
+	5.427713e-06f,
+	-1.686408e-06f,
+	-3.421532e-06f,
+	-5.733731e-07f,
+	4.586969e-07f,
+	1.082818e-07f,
+	7.428303e-10f,
+
+	6.388087e-10f,
+	1.038758e-07f,
+	4.568636e-07f,
+	-5.357621e-07f,
+	-3.390458e-06f,
+	-1.778032e-06f,
+	5.348824e-06f,
+	2.146123e-06f,
+	-1.321473e-05f,
+	-8.374733e-06f,
+	1.962325e-05f,
+	1.183174e-05f,
+	-3.628726e-05f,
+	-2.511695e-05f,
+	5.203388e-05f,
+	3.570909e-05f,
+	-8.366421e-05f,
+	-6.110020e-05f,
+	1.168264e-04f,
+	8.513120e-05f,
+	-1.748760e-04f,
+	-1.307786e-04f,
+	2.437043e-04f,
+	1.795014e-04f,
+	-3.617023e-04f,
+	-2.620679e-04f,
+	5.388747e-04f,
+	3.594513e-04f,
+	-9.123225e-04f,
+	-4.797468e-04f,
+	1.949779e-03f,
+	-4.651672e-04f,
+	-4.651672e-04f,
+	1.949779e-03f,
+	-4.797468e-04f,
+	-9.123225e-04f,
+	3.594513e-04f,
+	5.388747e-04f,
+	-2.620679e-04f,
+	-3.617023e-04f,
+	1.795014e-04f,
+	2.437043e-04f,
+	-1.307786e-04f,
+	-1.748760e-04f,
+	8.513120e-05f,
+	1.168264e-04f,
+	-6.110020e-05f,
+	-8.366421e-05f,
+	3.570909e-05f,
+	5.203388e-05f,
+	-2.511695e-05f,
+	-3.628726e-05f,
+	1.183174e-05f,
+	1.962325e-05f,
+	-8.374733e-06f,
+	-1.321473e-05f,
+	2.146123e-06f,
+	5.348824e-06f,
+	-1.778032e-06f,
+	-3.390458e-06f,
+	-5.357621e-07f,
+	4.568636e-07f,
+	1.038758e-07f,
+	6.388087e-10f,
+
+	7.428303e-10f,
+	1.082818e-07f,
+	4.586969e-07f,
+	-5.733731e-07f,
+	-3.421532e-06f,
+	-1.686408e-06f,
+	5.427713e-06f,
+	1.948657e-06f,
+	-1.339001e-05f,
+	-8.017260e-06f,
+	1.994462e-05f,
+	1.121797e-05f,
+	-3.684511e-05f,
+	-2.413595e-05f,
+	5.293151e-05f,
+	3.419274e-05f,
+	-8.505968e-05f,
+	-5.884407e-05f,
+	1.189104e-04f,
+	8.183654e-05f,
+	-1.779269e-04f,
+	-1.260371e-04f,
+	2.480968e-04f,
+	1.726481e-04f,
+	-3.680358e-04f,
+	-2.519180e-04f,
+	5.481782e-04f,
+	3.432968e-04f,
+	-9.267898e-04f,
+	-4.487098e-04f,
+	1.974866e-03f,
+	-5.931061e-04f,
+	-3.406591e-04f,
+	1.923558e-03f,
+	-5.101138e-04f,
+	-8.973880e-04f,
+	3.752538e-04f,
+	5.292944e-04f,
+	-2.719946e-04f,
+	-3.551859e-04f,
+	1.862036e-04f,
+	2.391863e-04f,
+	-1.354156e-04f,
+	-1.717379e-04f,
+	8.835353e-05f,
+	1.146825e-04f,
+	-6.330699e-05f,
+	-8.222831e-05f,
+	3.719258e-05f,
+	5.110976e-05f,
+	-2.607680e-05f,
+	-3.571271e-05f,
+	1.243249e-05f,
+	1.929189e-05f,
+	-8.724657e-06f,
+	-1.303387e-05f,
+	2.339568e-06f,
+	5.267133e-06f,
+	-1.867787e-06f,
+	-3.358212e-06f,
+	-4.988179e-07f,
+	4.547080e-07f,
+	9.958051e-08f,
+	5.466329e-10f,
+
+	8.597608e-10f,
+	1.127980e-07f,
+	4.601955e-07f,
+	-6.116408e-07f,
+	-3.451398e-06f,
+	-1.592949e-06f,
+	5.503715e-06f,
+	1.747250e-06f,
+	-1.355954e-05f,
+	-7.652393e-06f,
+	2.025569e-05f,
+	1.059146e-05f,
+	-3.738579e-05f,
+	-2.313424e-05f,
+	5.380190e-05f,
+	3.264423e-05f,
+	-8.641362e-05f,
+	-5.653966e-05f,
+	1.209329e-04f,
+	7.847113e-05f,
+	-1.808885e-04f,
+	-1.211934e-04f,
+	2.523603e-04f,
+	1.656471e-04f,
+	-3.741816e-04f,
+	-2.415499e-04f,
+	5.571973e-04f,
+	3.267976e-04f,
+	-9.407760e-04f,
+	-4.170152e-04f,
+	1.998778e-03f,
+	-7.244988e-04f,
+	-2.195583e-04f,
+	1.896241e-03f,
+	-5.397991e-04f,
+	-8.819998e-04f,
+	3.906971e-04f,
+	5.194452e-04f,
+	-2.816934e-04f,
+	-3.484919e-04f,
+	1.927515e-04f,
+	2.345462e-04f,
+	-1.399458e-04f,
+	-1.685153e-04f,
+	9.150200e-05f,
+	1.124803e-04f,
+	-6.546337e-05f,
+	-8.075312e-05f,
+	3.864251e-05f,
+	5.015988e-05f,
+	-2.701505e-05f,
+	-3.512192e-05f,
+	1.301996e-05f,
+	1.895081e-05f,
+	-9.066885e-06f,
+	-1.284760e-05f,
+	2.528919e-06f,
+	5.182725e-06f,
+	-1.955641e-06f,
+	-3.324833e-06f,
+	-4.625499e-07f,
+	4.522421e-07f,
+	9.539620e-08f,
+	4.652928e-10f,
+
+	9.907172e-10f,
+	1.174240e-07f,
+	4.613474e-07f,
+	-6.505541e-07f,
+	-3.480016e-06f,
+	-1.497692e-06f,
+	5.576745e-06f,
+	1.541984e-06f,
+	-1.372317e-05f,
+	-7.280290e-06f,
+	2.055620e-05f,
+	9.952476e-06f,
+	-3.790883e-05f,
+	-2.211230e-05f,
+	5.464433e-05f,
+	3.106431e-05f,
+	-8.772493e-05f,
+	-5.418809e-05f,
+	1.228922e-04f,
+	7.503664e-05f,
+	-1.837583e-04f,
+	-1.162498e-04f,
+	2.564916e-04f,
+	1.585017e-04f,
+	-3.801347e-04f,
+	-2.309684e-04f,
+	5.659242e-04f,
+	3.099613e-04f,
+	-9.542677e-04f,
+	-3.846758e-04f,
+	2.021476e-03f,
+	-8.593675e-04f,
+	-1.018407e-04f,
+	1.867870e-03f,
+	-5.687915e-04f,
+	-8.661722e-04f,
+	4.057745e-04f,
+	5.093350e-04f,
+	-2.911600e-04f,
+	-3.416254e-04f,
+	1.991421e-04f,
+	2.297875e-04f,
+	-1.443671e-04f,
+	-1.652104e-04f,
+	9.457512e-05f,
+	1.102216e-04f,
+	-6.756836e-05f,
+	-7.923978e-05f,
+	4.005824e-05f,
+	4.918501e-05f,
+	-2.793130e-05f,
+	-3.451539e-05f,
+	1.359389e-05f,
+	1.860031e-05f,
+	-9.401275e-06f,
+	-1.265608e-05f,
+	2.714102e-06f,
+	5.095686e-06f,
+	-2.041562e-06f,
+	-3.290360e-06f,
+	-4.269669e-07f,
+	4.494781e-07f,
+	9.132297e-08f,
+	3.938318e-10f,
+
+	1.136870e-09f,
+	1.221589e-07f,
+	4.621400e-07f,
+	-6.901016e-07f,
+	-3.507351e-06f,
+	-1.400673e-06f,
+	5.646721e-06f,
+	1.332945e-06f,
+	-1.388073e-05f,
+	-6.901120e-06f,
+	2.084586e-05f,
+	9.301322e-06f,
+	-3.841377e-05f,
+	-2.107060e-05f,
+	5.545809e-05f,
+	2.945372e-05f,
+	-8.899254e-05f,
+	-5.179051e-05f,
+	1.247868e-04f,
+	7.153474e-05f,
+	-1.865341e-04f,
+	-1.112088e-04f,
+	2.604872e-04f,
+	1.512155e-04f,
+	-3.858903e-04f,
+	-2.201788e-04f,
+	5.743516e-04f,
+	2.927959e-04f,
+	-9.672514e-04f,
+	-3.517053e-04f,
+	2.042918e-03f,
+	-9.977339e-04f,
+	1.251851e-05f,
+	1.838482e-03f,
+	-5.970803e-04f,
+	-8.499192e-04f,
+	4.204794e-04f,
+	4.989717e-04f,
+	-3.003899e-04f,
+	-3.345916e-04f,
+	2.053723e-04f,
+	2.249139e-04f,
+	-1.486774e-04f,
+	-1.618258e-04f,
+	9.757145e-05f,
+	1.079081e-04f,
+	-6.962098e-05f,
+	-7.768944e-05f,
+	4.143911e-05f,
+	4.818592e-05f,
+	-2.882514e-05f,
+	-3.389361e-05f,
+	1.415404e-05f,
+	1.824069e-05f,
+	-9.727691e-06f,
+	-1.245948e-05f,
+	2.895050e-06f,
+	5.006105e-06f,
+	-2.125523e-06f,
+	-3.254830e-06f,
+	-3.920771e-07f,
+	4.464281e-07f,
+	8.736077e-08f,
+	3.313457e-10f,
+
+	1.299444e-09f,
+	1.270019e-07f,
+	4.625612e-07f,
+	-7.302712e-07f,
+	-3.533364e-06f,
+	-1.301931e-06f,
+	5.713558e-06f,
+	1.120221e-06f,
+	-1.403207e-05f,
+	-6.515053e-06f,
+	2.112440e-05f,
+	8.638299e-06f,
+	-3.890018e-05f,
+	-2.000965e-05f,
+	5.624248e-05f,
+	2.781326e-05f,
+	-9.021539e-05f,
+	-4.934811e-05f,
+	1.266152e-04f,
+	6.796719e-05f,
+	-1.892136e-04f,
+	-1.060729e-04f,
+	2.643440e-04f,
+	1.437923e-04f,
+	-3.914437e-04f,
+	-2.091864e-04f,
+	5.824721e-04f,
+	2.753094e-04f,
+	-9.797141e-04f,
+	-3.181174e-04f,
+	2.063065e-03f,
+	-1.139619e-03f,
+	1.235447e-04f,
+	1.808118e-03f,
+	-6.246554e-04f,
+	-8.332549e-04f,
+	4.348055e-04f,
+	4.883637e-04f,
+	-3.093789e-04f,
+	-3.273958e-04f,
+	2.114392e-04f,
+	2.199289e-04f,
+	-1.528747e-04f,
+	-1.583641e-04f,
+	1.004896e-04f,
+	1.055415e-04f,
+	-7.162031e-05f,
+	-7.610331e-05f,
+	4.278453e-05f,
+	4.716337e-05f,
+	-2.969618e-05f,
+	-3.325706e-05f,
+	1.470018e-05f,
+	1.787225e-05f,
+	-1.004600e-05f,
+	-1.225796e-05f,
+	3.071696e-06f,
+	4.914069e-06f,
+	-2.207495e-06f,
+	-3.218282e-06f,
+	-3.578878e-07f,
+	4.431039e-07f,
+	8.350943e-08f,
+	2.769822e-10f,
+
+	1.479716e-09f,
+	1.319519e-07f,
+	4.625987e-07f,
+	-7.710497e-07f,
+	-3.558018e-06f,
+	-1.201508e-06f,
+	5.777178e-06f,
+	9.039052e-07f,
+	-1.417704e-05f,
+	-6.122268e-06f,
+	2.139155e-05f,
+	7.963718e-06f,
+	-3.936761e-05f,
+	-1.892996e-05f,
+	5.699682e-05f,
+	2.614373e-05f,
+	-9.139246e-05f,
+	-4.686210e-05f,
+	1.283758e-04f,
+	6.433579e-05f,
+	-1.917947e-04f,
+	-1.008448e-04f,
+	2.680587e-04f,
+	1.362356e-04f,
+	-3.967902e-04f,
+	-1.979967e-04f,
+	5.902785e-04f,
+	2.575104e-04f,
+	-9.916427e-04f,
+	-2.839270e-04f,
+	2.081877e-03f,
+	-1.285043e-03f,
+	2.312639e-04f,
+	1.776816e-03f,
+	-6.515073e-04f,
+	-8.161937e-04f,
+	4.487470e-04f,
+	4.775189e-04f,
+	-3.181231e-04f,
+	-3.200434e-04f,
+	2.173402e-04f,
+	2.148363e-04f,
+	-1.569571e-04f,
+	-1.548276e-04f,
+	1.033283e-04f,
+	1.031235e-04f,
+	-7.356546e-05f,
+	-7.448255e-05f,
+	4.409391e-05f,
+	4.611816e-05f,
+	-3.054406e-05f,
+	-3.260625e-05f,
+	1.523210e-05f,
+	1.749529e-05f,
+	-1.035609e-05f,
+	-1.205172e-05f,
+	3.243979e-06f,
+	4.819666e-06f,
+	-2.287453e-06f,
+	-3.180755e-06f,
+	-3.244060e-07f,
+	4.395176e-07f,
+	7.976863e-08f,
+	2.299405e-10f,
+
+	1.679018e-09f,
+	1.370076e-07f,
+	4.622402e-07f,
+	-8.124236e-07f,
+	-3.581279e-06f,
+	-1.099446e-06f,
+	5.837499e-06f,
+	6.840928e-07f,
+	-1.431547e-05f,
+	-5.722948e-06f,
+	2.164705e-05f,
+	7.277902e-06f,
+	-3.981563e-05f,
+	-1.783206e-05f,
+	5.772043e-05f,
+	2.444596e-05f,
+	-9.252273e-05f,
+	-4.433375e-05f,
+	1.300671e-04f,
+	6.064238e-05f,
+	-1.942752e-04f,
+	-9.552707e-05f,
+	2.716284e-04f,
+	1.285494e-04f,
+	-4.019252e-04f,
+	-1.866153e-04f,
+	5.977637e-04f,
+	2.394075e-04f,
+	-1.003025e-03f,
+	-2.491492e-04f,
+	2.099312e-03f,
+	-1.434025e-03f,
+	3.357026e-04f,
+	1.744616e-03f,
+	-6.776272e-04f,
+	-7.987501e-04f,
+	4.622980e-04f,
+	4.664459e-04f,
+	-3.266187e-04f,
+	-3.125397e-04f,
+	2.230725e-04f,
+	2.096396e-04f,
+	-1.609227e-04f,
+	-1.512191e-04f,
+	1.060863e-04f,
+	1.006560e-04f,
+	-7.545557e-05f,
+	-7.282838e-05f,
+	4.536668e-05f,
+	4.505109e-05f,
+	-3.136842e-05f,
+	-3.194169e-05f,
+	1.574958e-05f,
+	1.711012e-05f,
+	-1.065783e-05f,
+	-1.184090e-05f,
+	3.411841e-06f,
+	4.722985e-06f,
+	-2.365373e-06f,
+	-3.142288e-06f,
+	-2.916377e-07f,
+	4.356808e-07f,
+	7.613792e-08f,
+	1.894703e-10f,
+
+	1.898733e-09f,
+	1.421675e-07f,
+	4.614733e-07f,
+	-8.543785e-07f,
+	-3.603108e-06f,
+	-9.957882e-07f,
+	5.894444e-06f,
+	4.608826e-07f,
+	-1.444723e-05f,
+	-5.317283e-06f,
+	2.189063e-05f,
+	6.581184e-06f,
+	-4.024381e-05f,
+	-1.671649e-05f,
+	5.841266e-05f,
+	2.272080e-05f,
+	-9.360520e-05f,
+	-4.176434e-05f,
+	1.316877e-04f,
+	5.688885e-05f,
+	-1.966530e-04f,
+	-9.012250e-05f,
+	2.750500e-04f,
+	1.207377e-04f,
+	-4.068445e-04f,
+	-1.750481e-04f,
+	6.049209e-04f,
+	2.210096e-04f,
+	-1.013847e-03f,
+	-2.137996e-04f,
+	2.115330e-03f,
+	-1.586585e-03f,
+	4.368880e-04f,
+	1.711556e-03f,
+	-7.030065e-04f,
+	-7.809387e-04f,
+	4.754532e-04f,
+	4.551530e-04f,
+	-3.348620e-04f,
+	-3.048904e-04f,
+	2.286337e-04f,
+	2.043428e-04f,
+	-1.647699e-04f,
+	-1.475411e-04f,
+	1.087624e-04f,
+	9.814068e-05f,
+	-7.728983e-05f,
+	-7.114203e-05f,
+	4.660233e-05f,
+	4.396294e-05f,
+	-3.216893e-05f,
+	-3.126387e-05f,
+	1.625242e-05f,
+	1.671704e-05f,
+	-1.095112e-05f,
+	-1.162570e-05f,
+	3.575227e-06f,
+	4.624116e-06f,
+	-2.441233e-06f,
+	-3.102919e-06f,
+	-2.595884e-07f,
+	4.316052e-07f,
+	7.261671e-08f,
+	1.548707e-10f,
+
+	2.140298e-09f,
+	1.474301e-07f,
+	4.602858e-07f,
+	-8.968995e-07f,
+	-3.623471e-06f,
+	-8.905820e-07f,
+	5.947933e-06f,
+	2.343765e-07f,
+	-1.457217e-05f,
+	-4.905469e-06f,
+	2.212205e-05f,
+	5.873903e-06f,
+	-4.065175e-05f,
+	-1.558382e-05f,
+	5.907286e-05f,
+	2.096914e-05f,
+	-9.463893e-05f,
+	-3.915519e-05f,
+	1.332362e-04f,
+	5.307716e-05f,
+	-1.989260e-04f,
+	-8.463390e-05f,
+	2.783206e-04f,
+	1.128044e-04f,
+	-4.115434e-04f,
+	-1.633009e-04f,
+	6.117432e-04f,
+	2.023259e-04f,
+	-1.024097e-03f,
+	-1.778946e-04f,
+	2.129890e-03f,
+	-1.742740e-03f,
+	5.348477e-04f,
+	1.677674e-03f,
+	-7.276374e-04f,
+	-7.627739e-04f,
+	4.882074e-04f,
+	4.436486e-04f,
+	-3.428496e-04f,
+	-2.971009e-04f,
+	2.340214e-04f,
+	1.989496e-04f,
+	-1.684970e-04f,
+	-1.437963e-04f,
+	1.113553e-04f,
+	9.557942e-05f,
+	-7.906747e-05f,
+	-6.942470e-05f,
+	4.780033e-05f,
+	4.285455e-05f,
+	-3.294527e-05f,
+	-3.057333e-05f,
+	1.674043e-05f,
+	1.631637e-05f,
+	-1.123585e-05f,
+	-1.140628e-05f,
+	3.734086e-06f,
+	4.523148e-06f,
+	-2.515011e-06f,
+	-3.062687e-06f,
+	-2.282630e-07f,
+	4.273025e-07f,
+	6.920433e-08f,
+	1.254898e-10f,
+
+	2.405201e-09f,
+	1.527934e-07f,
+	4.586656e-07f,
+	-9.399707e-07f,
+	-3.642333e-06f,
+	-7.838740e-07f,
+	5.997892e-06f,
+	4.679825e-09f,
+	-1.469014e-05f,
+	-4.487707e-06f,
+	2.234105e-05f,
+	5.156412e-06f,
+	-4.103905e-05f,
+	-1.443461e-05f,
+	5.970041e-05f,
+	1.919186e-05f,
+	-9.562297e-05f,
+	-3.650766e-05f,
+	1.347112e-04f,
+	4.920929e-05f,
+	-2.010923e-04f,
+	-7.906415e-05f,
+	2.814372e-04f,
+	1.047538e-04f,
+	-4.160180e-04f,
+	-1.513799e-04f,
+	6.182241e-04f,
+	1.833659e-04f,
+	-1.033764e-03f,
+	-1.414511e-04f,
+	2.142953e-03f,
+	-1.902509e-03f,
+	6.296101e-04f,
+	1.643008e-03f,
+	-7.515126e-04f,
+	-7.442705e-04f,
+	5.005558e-04f,
+	4.319413e-04f,
+	-3.505781e-04f,
+	-2.891768e-04f,
+	2.392332e-04f,
+	1.934638e-04f,
+	-1.721023e-04f,
+	-1.399872e-04f,
+	1.138641e-04f,
+	9.297406e-05f,
+	-8.078775e-05f,
+	-6.767765e-05f,
+	4.896022e-05f,
+	4.172672e-05f,
+	-3.369715e-05f,
+	-2.987057e-05f,
+	1.721344e-05f,
+	1.590842e-05f,
+	-1.151193e-05f,
+	-1.118282e-05f,
+	3.888369e-06f,
+	4.420170e-06f,
+	-2.586690e-06f,
+	-3.021631e-06f,
+	-1.976656e-07f,
+	4.227840e-07f,
+	6.589993e-08f,
+	1.007227e-10f,
+
+	2.694980e-09f,
+	1.582556e-07f,
+	4.566003e-07f,
+	-9.835757e-07f,
+	-3.659658e-06f,
+	-6.757134e-07f,
+	6.044245e-06f,
+	-2.280991e-07f,
+	-1.480100e-05f,
+	-4.064202e-06f,
+	2.254740e-05f,
+	4.429070e-06f,
+	-4.140530e-05f,
+	-1.326947e-05f,
+	6.029470e-05f,
+	1.738989e-05f,
+	-9.655640e-05f,
+	-3.382313e-05f,
+	1.361113e-04f,
+	4.528728e-05f,
+	-2.031500e-04f,
+	-7.341619e-05f,
+	2.843971e-04f,
+	9.659008e-05f,
+	-4.202641e-04f,
+	-1.392913e-04f,
+	6.243571e-04f,
+	1.641393e-04f,
+	-1.042834e-03f,
+	-1.044865e-04f,
+	2.154476e-03f,
+	-2.065907e-03f,
+	7.212039e-04f,
+	1.607597e-03f,
+	-7.746254e-04f,
+	-7.254433e-04f,
+	5.124939e-04f,
+	4.200397e-04f,
+	-3.580445e-04f,
+	-2.811238e-04f,
+	2.442670e-04f,
+	1.878893e-04f,
+	-1.755843e-04f,
+	-1.361167e-04f,
+	1.162877e-04f,
+	9.032643e-05f,
+	-8.244997e-05f,
+	-6.590214e-05f,
+	5.008154e-05f,
+	4.058027e-05f,
+	-3.442427e-05f,
+	-2.915612e-05f,
+	1.767128e-05f,
+	1.549349e-05f,
+	-1.177926e-05f,
+	-1.095551e-05f,
+	4.038032e-06f,
+	4.315274e-06f,
+	-2.656251e-06f,
+	-2.979789e-06f,
+	-1.678000e-07f,
+	4.180610e-07f,
+	6.270260e-08f,
+	8.001108e-11f,
+
+	3.011224e-09f,
+	1.638143e-07f,
+	4.540780e-07f,
+	-1.027697e-06f,
+	-3.675412e-06f,
+	-5.661510e-07f,
+	6.086919e-06f,
+	-4.638487e-07f,
+	-1.490462e-05f,
+	-3.635168e-06f,
+	2.274085e-05f,
+	3.692246e-06f,
+	-4.175012e-05f,
+	-1.208898e-05f,
+	6.085513e-05f,
+	1.556417e-05f,
+	-9.743831e-05f,
+	-3.110302e-05f,
+	1.374353e-04f,
+	4.131322e-05f,
+	-2.050971e-04f,
+	-6.769304e-05f,
+	2.871975e-04f,
+	8.831760e-05f,
+	-4.242775e-04f,
+	-1.270415e-04f,
+	6.301359e-04f,
+	1.446560e-04f,
+	-1.051297e-03f,
+	-6.701879e-05f,
+	2.164419e-03f,
+	-2.232953e-03f,
+	8.096586e-04f,
+	1.571477e-03f,
+	-7.969695e-04f,
+	-7.063071e-04f,
+	5.240173e-04f,
+	4.079524e-04f,
+	-3.652457e-04f,
+	-2.729476e-04f,
+	2.491208e-04f,
+	1.822300e-04f,
+	-1.789417e-04f,
+	-1.321874e-04f,
+	1.186250e-04f,
+	8.763839e-05f,
+	-8.405349e-05f,
+	-6.409941e-05f,
+	5.116386e-05f,
+	3.941605e-05f,
+	-3.512638e-05f,
+	-2.843051e-05f,
+	1.811378e-05f,
+	1.507192e-05f,
+	-1.203775e-05f,
+	-1.072450e-05f,
+	4.183034e-06f,
+	4.208549e-06f,
+	-2.723679e-06f,
+	-2.937200e-06f,
+	-1.386690e-07f,
+	4.131448e-07f,
+	5.961130e-08f,
+	6.284138e-11f,
+
+	3.355570e-09f,
+	1.694672e-07f,
+	4.510865e-07f,
+	-1.072318e-06f,
+	-3.689563e-06f,
+	-4.552389e-07f,
+	6.125842e-06f,
+	-7.024545e-07f,
+	-1.500086e-05f,
+	-3.200821e-06f,
+	2.292119e-05f,
+	2.946317e-06f,
+	-4.207315e-05f,
+	-1.089378e-05f,
+	6.138112e-05f,
+	1.371566e-05f,
+	-9.826787e-05f,
+	-2.834878e-05f,
+	1.386818e-04f,
+	3.728922e-05f,
+	-2.069318e-04f,
+	-6.189777e-05f,
+	2.898359e-04f,
+	7.994081e-05f,
+	-4.280546e-04f,
+	-1.146371e-04f,
+	6.355544e-04f,
+	1.249262e-04f,
+	-1.059141e-03f,
+	-2.906655e-05f,
+	2.172741e-03f,
+	-2.403659e-03f,
+	8.950040e-04f,
+	1.534687e-03f,
+	-8.185392e-04f,
+	-6.868767e-04f,
+	5.351221e-04f,
+	3.956882e-04f,
+	-3.721792e-04f,
+	-2.646538e-04f,
+	2.537927e-04f,
+	1.764898e-04f,
+	-1.821731e-04f,
+	-1.282021e-04f,
+	1.208753e-04f,
+	8.491184e-05f,
+	-8.559769e-05f,
+	-6.227074e-05f,
+	5.220679e-05f,
+	3.823487e-05f,
+	-3.580322e-05f,
+	-2.769425e-05f,
+	1.854082e-05f,
+	1.464401e-05f,
+	-1.228734e-05f,
+	-1.048999e-05f,
+	4.323337e-06f,
+	4.100086e-06f,
+	-2.788961e-06f,
+	-2.893902e-06f,
+	-1.102751e-07f,
+	4.080464e-07f,
+	5.662488e-08f,
+	4.874364e-11f,
+
+	3.729701e-09f,
+	1.752116e-07f,
+	4.476141e-07f,
+	-1.117418e-06f,
+	-3.702077e-06f,
+	-3.430311e-07f,
+	6.160943e-06f,
+	-9.437987e-07f,
+	-1.508959e-05f,
+	-2.761384e-06f,
+	2.308817e-05f,
+	2.191670e-06f,
+	-4.237402e-05f,
+	-9.684477e-06f,
+	6.187212e-05f,
+	1.184534e-05f,
+	-9.904422e-05f,
+	-2.556189e-05f,
+	1.398497e-04f,
+	3.321746e-05f,
+	-2.086524e-04f,
+	-5.603352e-05f,
+	2.923097e-04f,
+	7.146422e-05f,
+	-4.315914e-04f,
+	-1.020846e-04f,
+	6.406067e-04f,
+	1.049604e-04f,
+	-1.066355e-03f,
+	9.351103e-06f,
+	2.179402e-03f,
+	-2.578042e-03f,
+	9.772704e-04f,
+	1.497262e-03f,
+	-8.393296e-04f,
+	-6.671671e-04f,
+	5.458045e-04f,
+	3.832558e-04f,
+	-3.788422e-04f,
+	-2.562483e-04f,
+	2.582808e-04f,
+	1.706727e-04f,
+	-1.852773e-04f,
+	-1.241634e-04f,
+	1.230376e-04f,
+	8.214865e-05f,
+	-8.708199e-05f,
+	-6.041742e-05f,
+	5.320995e-05f,
+	3.703758e-05f,
+	-3.645457e-05f,
+	-2.694788e-05f,
+	1.895224e-05f,
+	1.421009e-05f,
+	-1.252794e-05f,
+	-1.025215e-05f,
+	4.458906e-06f,
+	3.989975e-06f,
+	-2.852082e-06f,
+	-2.849934e-06f,
+	-8.261990e-08f,
+	4.027767e-07f,
+	5.374212e-08f,
+	3.728988e-11f,
+
+	4.135350e-09f,
+	1.810448e-07f,
+	4.436487e-07f,
+	-1.162980e-06f,
+	-3.712921e-06f,
+	-2.295831e-07f,
+	6.192155e-06f,
+	-1.187761e-06f,
+	-1.517068e-05f,
+	-2.317086e-06f,
+	2.324159e-05f,
+	1.428700e-06f,
+	-4.265237e-05f,
+	-8.461729e-06f,
+	6.232758e-05f,
+	9.954215e-06f,
+	-9.976656e-05f,
+	-2.274386e-05f,
+	1.409378e-04f,
+	2.910014e-05f,
+	-2.102572e-04f,
+	-5.010348e-05f,
+	2.946164e-04f,
+	6.289247e-05f,
+	-4.348844e-04f,
+	-8.939097e-05f,
+	6.452870e-04f,
+	8.476900e-05f,
+	-1.072928e-03f,
+	4.821450e-05f,
+	2.184361e-03f,
+	-2.756116e-03f,
+	1.056489e-03f,
+	1.459241e-03f,
+	-8.593358e-04f,
+	-6.471932e-04f,
+	5.560611e-04f,
+	3.706640e-04f,
+	-3.852325e-04f,
+	-2.477369e-04f,
+	2.625835e-04f,
+	1.647827e-04f,
+	-1.882530e-04f,
+	-1.200741e-04f,
+	1.251112e-04f,
+	7.935072e-05f,
+	-8.850585e-05f,
+	-5.854071e-05f,
+	5.417300e-05f,
+	3.582503e-05f,
+	-3.708021e-05f,
+	-2.619194e-05f,
+	1.934793e-05f,
+	1.377047e-05f,
+	-1.275948e-05f,
+	-1.001117e-05f,
+	4.589712e-06f,
+	3.878306e-06f,
+	-2.913033e-06f,
+	-2.805334e-06f,
+	-5.570474e-08f,
+	3.973464e-07f,
+	5.096168e-08f,
+	2.809259e-11f,
+
+	4.574292e-09f,
+	1.869636e-07f,
+	4.391788e-07f,
+	-1.208982e-06f,
+	-3.722064e-06f,
+	-1.149519e-07f,
+	6.219410e-06f,
+	-1.434217e-06f,
+	-1.524401e-05f,
+	-1.868160e-06f,
+	2.338124e-05f,
+	6.578095e-07f,
+	-4.290788e-05f,
+	-7.226188e-06f,
+	6.274697e-05f,
+	8.043306e-06f,
+	-1.004341e-04f,
+	-1.989621e-05f,
+	1.419449e-04f,
+	2.493953e-05f,
+	-2.117445e-04f,
+	-4.411091e-05f,
+	2.967535e-04f,
+	5.423024e-05f,
+	-4.379301e-04f,
+	-7.656305e-05f,
+	6.495898e-04f,
+	6.436308e-05f,
+	-1.078849e-03f,
+	8.750339e-05f,
+	2.187576e-03f,
+	-2.937894e-03f,
+	1.132691e-03f,
+	1.420658e-03f,
+	-8.785540e-04f,
+	-6.269700e-04f,
+	5.658888e-04f,
+	3.579217e-04f,
+	-3.913477e-04f,
+	-2.391254e-04f,
+	2.666993e-04f,
+	1.588238e-04f,
+	-1.910993e-04f,
+	-1.159371e-04f,
+	1.270952e-04f,
+	7.651997e-05f,
+	-8.986879e-05f,
+	-5.664192e-05f,
+	5.509561e-05f,
+	3.459805e-05f,
+	-3.767994e-05f,
+	-2.542695e-05f,
+	1.972777e-05f,
+	1.332547e-05f,
+	-1.298192e-05f,
+	-9.767211e-06f,
+	4.715726e-06f,
+	3.765170e-06f,
+	-2.971804e-06f,
+	-2.760139e-06f,
+	-2.953019e-08f,
+	3.917661e-07f,
+	4.828216e-08f,
+	2.080305e-11f,
+
+	5.048344e-09f,
+	1.929648e-07f,
+	4.341926e-07f,
+	-1.255404e-06f,
+	-3.729474e-06f,
+	8.040048e-10f,
+	6.242644e-06f,
+	-1.683041e-06f,
+	-1.530946e-05f,
+	-1.414842e-06f,
+	2.350690e-05f,
+	-1.205895e-07f,
+	-4.314020e-05f,
+	-5.978524e-06f,
+	6.312980e-05f,
+	6.113654e-06f,
+	-1.010461e-04f,
+	-1.702052e-05f,
+	1.428699e-04f,
+	2.073791e-05f,
+	-2.131126e-04f,
+	-3.805912e-05f,
+	2.987190e-04f,
+	4.548232e-05f,
+	-4.407250e-04f,
+	-6.360792e-05f,
+	6.535096e-04f,
+	4.375366e-05f,
+	-1.084108e-03f,
+	1.271970e-04f,
+	2.189008e-03f,
+	-3.123387e-03f,
+	1.205908e-03f,
+	1.381551e-03f,
+	-8.969804e-04f,
+	-6.065123e-04f,
+	5.752848e-04f,
+	3.450377e-04f,
+	-3.971859e-04f,
+	-2.304196e-04f,
+	2.706267e-04f,
+	1.528000e-04f,
+	-1.938151e-04f,
+	-1.117551e-04f,
+	1.289890e-04f,
+	7.365832e-05f,
+	-9.117035e-05f,
+	-5.472234e-05f,
+	5.597750e-05f,
+	3.335750e-05f,
+	-3.825358e-05f,
+	-2.465346e-05f,
+	2.009166e-05f,
+	1.287542e-05f,
+	-1.319519e-05f,
+	-9.520465e-06f,
+	4.836924e-06f,
+	3.650656e-06f,
+	-3.028388e-06f,
+	-2.714387e-06f,
+	-4.096293e-09f,
+	3.860461e-07f,
+	4.570204e-08f,
+	1.510960e-11f,
+
+	5.559367e-09f,
+	1.990450e-07f,
+	4.286787e-07f,
+	-1.302226e-06f,
+	-3.735121e-06f,
+	1.176245e-07f,
+	6.261793e-06f,
+	-1.934104e-06f,
+	-1.536691e-05f,
+	-9.573776e-07f,
+	2.361839e-05f,
+	-9.060779e-07f,
+	-4.334903e-05f,
+	-4.719418e-06f,
+	6.347557e-05f,
+	4.166317e-06f,
+	-1.016018e-04f,
+	-1.411837e-05f,
+	1.437118e-04f,
+	1.649761e-05f,
+	-2.143602e-04f,
+	-3.195148e-05f,
+	3.005105e-04f,
+	3.665359e-05f,
+	-4.432659e-04f,
+	-5.053275e-05f,
+	6.570412e-04f,
+	2.295206e-05f,
+	-1.088696e-03f,
+	1.672740e-04f,
+	2.188615e-03f,
+	-3.312609e-03f,
+	1.276172e-03f,
+	1.341955e-03f,
+	-9.146121e-04f,
+	-5.858353e-04f,
+	5.842463e-04f,
+	3.320209e-04f,
+	-4.027452e-04f,
+	-2.216255e-04f,
+	2.743643e-04f,
+	1.467153e-04f,
+	-1.963994e-04f,
+	-1.075309e-04f,
+	1.307921e-04f,
+	7.076770e-05f,
+	-9.241010e-05f,
+	-5.278326e-05f,
+	5.681840e-05f,
+	3.210424e-05f,
+	-3.880099e-05f,
+	-2.387200e-05f,
+	2.043951e-05f,
+	1.242064e-05f,
+	-1.339925e-05f,
+	-9.271108e-06f,
+	4.953285e-06f,
+	3.534856e-06f,
+	-3.082778e-06f,
+	-2.668116e-06f,
+	2.059747e-08f,
+	3.801968e-07f,
+	4.321976e-08f,
+	1.073579e-11f,
+
+	6.109260e-09f,
+	2.052005e-07f,
+	4.226259e-07f,
+	-1.349424e-06f,
+	-3.738976e-06f,
+	2.354480e-07f,
+	6.276795e-06f,
+	-2.187272e-06f,
+	-1.541626e-05f,
+	-4.960131e-07f,
+	2.371551e-05f,
+	-1.698229e-06f,
+	-4.353406e-05f,
+	-3.449564e-06f,
+	6.378382e-05f,
+	2.202371e-06f,
+	-1.021005e-04f,
+	-1.119138e-05f,
+	1.444696e-04f,
+	1.222100e-05f,
+	-2.154858e-04f,
+	-2.579140e-05f,
+	3.021260e-04f,
+	2.774897e-05f,
+	-4.455497e-04f,
+	-3.734486e-05f,
+	6.601798e-04f,
+	1.969814e-06f,
+	-1.092601e-03f,
+	2.077125e-04f,
+	2.186357e-03f,
+	-3.505570e-03f,
+	1.343517e-03f,
+	1.301905e-03f,
+	-9.314467e-04f,
+	-5.649538e-04f,
+	5.927713e-04f,
+	3.188802e-04f,
+	-4.080239e-04f,
+	-2.127488e-04f,
+	2.779111e-04f,
+	1.405738e-04f,
+	-1.988516e-04f,
+	-1.032673e-04f,
+	1.325038e-04f,
+	6.785004e-05f,
+	-9.358769e-05f,
+	-5.082600e-05f,
+	5.761807e-05f,
+	3.083911e-05f,
+	-3.932200e-05f,
+	-2.308311e-05f,
+	2.077124e-05f,
+	1.196144e-05f,
+	-1.359406e-05f,
+	-9.019320e-06f,
+	5.064793e-06f,
+	3.417857e-06f,
+	-3.134970e-06f,
+	-2.621364e-06f,
+	4.455214e-08f,
+	3.742281e-07f,
+	4.083367e-08f,
+	7.438557e-12f,
+
+	6.699958e-09f,
+	2.114273e-07f,
+	4.160229e-07f,
+	-1.396976e-06f,
+	-3.741010e-06f,
+	3.542115e-07f,
+	6.287592e-06f,
+	-2.442413e-06f,
+	-1.545738e-05f,
+	-3.100149e-08f,
+	2.379808e-05f,
+	-2.496607e-06f,
+	-4.369500e-05f,
+	-2.169666e-06f,
+	6.405410e-05f,
+	2.229103e-07f,
+	-1.025416e-04f,
+	-8.241185e-06f,
+	1.451423e-04f,
+	7.910478e-06f,
+	-2.164879e-04f,
+	-1.958237e-05f,
+	3.035634e-04f,
+	1.877349e-05f,
+	-4.475734e-04f,
+	-2.405165e-05f,
+	6.629205e-04f,
+	-1.918135e-05f,
+	-1.095815e-03f,
+	2.484900e-04f,
+	2.182193e-03f,
+	-3.702280e-03f,
+	1.407976e-03f,
+	1.261437e-03f,
+	-9.474821e-04f,
+	-5.438828e-04f,
+	6.008575e-04f,
+	3.056246e-04f,
+	-4.130207e-04f,
+	-2.037956e-04f,
+	2.812659e-04f,
+	1.343795e-04f,
+	-2.011707e-04f,
+	-9.896713e-05f,
+	1.341236e-04f,
+	6.490728e-05f,
+	-9.470277e-05f,
+	-4.885187e-05f,
+	5.837630e-05f,
+	2.956298e-05f,
+	-3.981649e-05f,
+	-2.228732e-05f,
+	2.108677e-05f,
+	1.149816e-05f,
+	-1.377958e-05f,
+	-8.765278e-06f,
+	5.171431e-06f,
+	3.299750e-06f,
+	-3.184961e-06f,
+	-2.574166e-06f,
+	6.776932e-08f,
+	3.681499e-07f,
+	3.854205e-08f,
+	5.006261e-12f,
+
+	7.333433e-09f,
+	2.177214e-07f,
+	4.088589e-07f,
+	-1.444860e-06f,
+	-3.741193e-06f,
+	4.738505e-07f,
+	6.294127e-06f,
+	-2.699386e-06f,
+	-1.549019e-05f,
+	4.374003e-07f,
+	2.386593e-05f,
+	-3.300772e-06f,
+	-4.383157e-05f,
+	-8.804412e-07f,
+	6.428598e-05f,
+	-1.770955e-06f,
+	-1.029244e-04f,
+	-5.269459e-06f,
+	1.457289e-04f,
+	3.568490e-06f,
+	-2.173652e-04f,
+	-1.332791e-05f,
+	3.048209e-04f,
+	9.732252e-06f,
+	-4.493342e-04f,
+	-1.066067e-05f,
+	6.652587e-04f,
+	-4.048950e-05f,
+	-1.098329e-03f,
+	2.895836e-04f,
+	2.176084e-03f,
+	-3.902749e-03f,
+	1.469582e-03f,
+	1.220585e-03f,
+	-9.627167e-04f,
+	-5.226372e-04f,
+	6.085035e-04f,
+	2.922630e-04f,
+	-4.177340e-04f,
+	-1.947718e-04f,
+	2.844278e-04f,
+	1.281366e-04f,
+	-2.033563e-04f,
+	-9.463324e-05f,
+	1.356510e-04f,
+	6.194134e-05f,
+	-9.575507e-05f,
+	-4.686216e-05f,
+	5.909291e-05f,
+	2.827669e-05f,
+	-4.028435e-05f,
+	-2.148519e-05f,
+	2.138605e-05f,
+	1.103110e-05f,
+	-1.395578e-05f,
+	-8.509161e-06f,
+	5.273191e-06f,
+	3.180624e-06f,
+	-3.232749e-06f,
+	-2.526560e-06f,
+	9.025111e-08f,
+	3.619719e-07f,
+	3.634312e-08f,
+	3.256677e-12f,
+
+	8.011688e-09f,
+	2.240784e-07f,
+	4.011229e-07f,
+	-1.493049e-06f,
+	-3.739501e-06f,
+	5.942991e-07f,
+	6.296344e-06f,
+	-2.958054e-06f,
+	-1.551458e-05f,
+	9.089308e-07f,
+	2.391889e-05f,
+	-4.110273e-06f,
+	-4.394350e-05f,
+	4.173842e-07f,
+	6.447907e-05f,
+	-3.778098e-06f,
+	-1.032484e-04f,
+	-2.277887e-06f,
+	1.462287e-04f,
+	-8.024942e-07f,
+	-2.181165e-04f,
+	-7.031580e-06f,
+	3.058966e-04f,
+	6.304049e-07f,
+	-4.508293e-04f,
+	2.820436e-06f,
+	6.671901e-04f,
+	-6.194250e-05f,
+	-1.100134e-03f,
+	3.309698e-04f,
+	2.167988e-03f,
+	-4.106987e-03f,
+	1.528369e-03f,
+	1.179382e-03f,
+	-9.771497e-04f,
+	-5.012320e-04f,
+	6.157076e-04f,
+	2.788043e-04f,
+	-4.221629e-04f,
+	-1.856832e-04f,
+	2.873960e-04f,
+	1.218491e-04f,
+	-2.054076e-04f,
+	-9.026843e-05f,
+	1.370858e-04f,
+	5.895420e-05f,
+	-9.674430e-05f,
+	-4.485819e-05f,
+	5.976774e-05f,
+	2.698111e-05f,
+	-4.072550e-05f,
+	-2.067723e-05f,
+	2.166902e-05f,
+	1.056060e-05f,
+	-1.412263e-05f,
+	-8.251149e-06f,
+	5.370062e-06f,
+	3.060567e-06f,
+	-3.278334e-06f,
+	-2.478582e-06f,
+	1.120001e-07f,
+	3.557036e-07f,
+	3.423506e-08f,
+	2.034941e-12f,
+
+	8.736759e-09f,
+	2.304937e-07f,
+	3.928046e-07f,
+	-1.541521e-06f,
+	-3.735905e-06f,
+	7.154901e-07f,
+	6.294189e-06f,
+	-3.218273e-06f,
+	-1.553044e-05f,
+	1.383324e-06f,
+	2.395680e-05f,
+	-4.924656e-06f,
+	-4.403054e-05f,
+	1.723072e-06f,
+	6.463296e-05f,
+	-5.797376e-06f,
+	-1.035129e-04f,
+	7.318207e-07f,
+	1.466408e-04f,
+	-5.199972e-06f,
+	-2.187407e-04f,
+	-6.970030e-07f,
+	3.067888e-04f,
+	-8.526817e-06f,
+	-4.520563e-04f,
+	1.638393e-05f,
+	6.687104e-04f,
+	-8.352802e-05f,
+	-1.101222e-03f,
+	3.726245e-04f,
+	2.157865e-03f,
+	-4.315000e-03f,
+	1.584373e-03f,
+	1.137864e-03f,
+	-9.907805e-04f,
+	-4.796820e-04f,
+	6.224687e-04f,
+	2.652574e-04f,
+	-4.263064e-04f,
+	-1.765358e-04f,
+	2.901699e-04f,
+	1.155211e-04f,
+	-2.073243e-04f,
+	-8.587554e-05f,
+	1.384276e-04f,
+	5.594778e-05f,
+	-9.767028e-05f,
+	-4.284127e-05f,
+	6.040065e-05f,
+	2.567709e-05f,
+	-4.113986e-05f,
+	-1.986400e-05f,
+	2.193565e-05f,
+	1.008697e-05f,
+	-1.428013e-05f,
+	-7.991417e-06f,
+	5.462042e-06f,
+	2.939667e-06f,
+	-3.321717e-06f,
+	-2.430267e-06f,
+	1.330195e-07f,
+	3.493541e-07f,
+	3.221597e-08f,
+	1.211450e-12f,
+
+	9.510707e-09f,
+	2.369626e-07f,
+	3.838934e-07f,
+	-1.590249e-06f,
+	-3.730381e-06f,
+	8.373548e-07f,
+	6.287614e-06f,
+	-3.479897e-06f,
+	-1.553771e-05f,
+	1.860311e-06f,
+	2.397950e-05f,
+	-5.743457e-06f,
+	-4.409246e-05f,
+	3.035875e-06f,
+	6.474732e-05f,
+	-7.827632e-06f,
+	-1.037174e-04f,
+	3.757930e-06f,
+	1.469643e-04f,
+	-9.621409e-06f,
+	-2.192365e-04f,
+	5.672162e-06f,
+	3.074960e-04f,
+	-1.773412e-05f,
+	-4.530127e-04f,
+	3.002195e-05f,
+	6.698159e-04f,
+	-1.052336e-04f,
+	-1.101584e-03f,
+	4.145232e-04f,
+	2.145675e-03f,
+	-4.526796e-03f,
+	1.637627e-03f,
+	1.096064e-03f,
+	-1.003609e-03f,
+	-4.580020e-04f,
+	6.287859e-04f,
+	2.516314e-04f,
+	-4.301636e-04f,
+	-1.673356e-04f,
+	2.927488e-04f,
+	1.091566e-04f,
+	-2.091059e-04f,
+	-8.145741e-05f,
+	1.396760e-04f,
+	5.292404e-05f,
+	-9.853282e-05f,
+	-4.081271e-05f,
+	6.099155e-05f,
+	2.436549e-05f,
+	-4.152736e-05f,
+	-1.904603e-05f,
+	2.218591e-05f,
+	9.610539e-06f,
+	-1.442826e-05f,
+	-7.730143e-06f,
+	5.549129e-06f,
+	2.818012e-06f,
+	-3.362902e-06f,
+	-2.381653e-06f,
+	1.533129e-07f,
+	3.429327e-07f,
+	3.028391e-08f,
+	6.796975e-13f,
+
+	1.033562e-08f,
+	2.434799e-07f,
+	3.743794e-07f,
+	-1.639207e-06f,
+	-3.722903e-06f,
+	9.598232e-07f,
+	6.276568e-06f,
+	-3.742780e-06f,
+	-1.553628e-05f,
+	2.339616e-06f,
+	2.398686e-05f,
+	-6.566208e-06f,
+	-4.412903e-05f,
+	4.355036e-06f,
+	6.482178e-05f,
+	-9.867695e-06f,
+	-1.038615e-04f,
+	6.798688e-06f,
+	1.471987e-04f,
+	-1.406424e-05f,
+	-2.196030e-04f,
+	1.207221e-05f,
+	3.080165e-04f,
+	-2.698614e-05f,
+	-4.536963e-04f,
+	4.372656e-05f,
+	6.705028e-04f,
+	-1.270464e-04f,
+	-1.101213e-03f,
+	4.566408e-04f,
+	2.131379e-03f,
+	-4.742383e-03f,
+	1.688168e-03f,
+	1.054014e-03f,
+	-1.015636e-03f,
+	-4.362068e-04f,
+	6.346587e-04f,
+	2.379351e-04f,
+	-4.337341e-04f,
+	-1.580885e-04f,
+	2.951323e-04f,
+	1.027598e-04f,
+	-2.107521e-04f,
+	-7.701686e-05f,
+	1.408309e-04f,
+	4.988492e-05f,
+	-9.933180e-05f,
+	-3.877382e-05f,
+	6.154036e-05f,
+	2.304716e-05f,
+	-4.188797e-05f,
+	-1.822385e-05f,
+	2.241978e-05f,
+	9.131614e-06f,
+	-1.456702e-05f,
+	-7.467502e-06f,
+	5.631324e-06f,
+	2.695688e-06f,
+	-3.401892e-06f,
+	-2.332773e-06f,
+	1.728842e-07f,
+	3.364482e-07f,
+	2.843691e-08f,
+	3.540835e-13f,
+
+	1.121360e-08f,
+	2.500404e-07f,
+	3.642526e-07f,
+	-1.688369e-06f,
+	-3.713449e-06f,
+	1.082824e-06f,
+	6.261006e-06f,
+	-4.006771e-06f,
+	-1.552608e-05f,
+	2.820963e-06f,
+	2.397875e-05f,
+	-7.392433e-06f,
+	-4.414003e-05f,
+	5.679787e-06f,
+	6.485604e-05f,
+	-1.191638e-05f,
+	-1.039446e-04f,
+	9.852321e-06f,
+	1.473431e-04f,
+	-1.852588e-05f,
+	-2.198392e-04f,
+	1.849940e-05f,
+	3.083491e-04f,
+	-3.627747e-05f,
+	-4.541049e-04f,
+	5.748970e-05f,
+	6.707677e-04f,
+	-1.489537e-04f,
+	-1.100102e-03f,
+	4.989516e-04f,
+	2.114937e-03f,
+	-4.961764e-03f,
+	1.736031e-03f,
+	1.011748e-03f,
+	-1.026863e-03f,
+	-4.143111e-04f,
+	6.400867e-04f,
+	2.241774e-04f,
+	-4.370174e-04f,
+	-1.488004e-04f,
+	2.973200e-04f,
+	9.633477e-05f,
+	-2.122627e-04f,
+	-7.255673e-05f,
+	1.418921e-04f,
+	4.683236e-05f,
+	-1.000671e-04f,
+	-3.672591e-05f,
+	6.204701e-05f,
+	2.172295e-05f,
+	-4.222166e-05f,
+	-1.739800e-05f,
+	2.263725e-05f,
+	8.650517e-06f,
+	-1.469640e-05f,
+	-7.203670e-06f,
+	5.708633e-06f,
+	2.572783e-06f,
+	-3.438694e-06f,
+	-2.283662e-06f,
+	1.917382e-07f,
+	3.299091e-07f,
+	2.667295e-08f,
+	1.676761e-13f,
+
+	1.214679e-08f,
+	2.566387e-07f,
+	3.535034e-07f,
+	-1.737707e-06f,
+	-3.701996e-06f,
+	1.206285e-06f,
+	6.240884e-06f,
+	-4.271718e-06f,
+	-1.550702e-05f,
+	3.304069e-06f,
+	2.395503e-05f,
+	-8.221652e-06f,
+	-4.412528e-05f,
+	7.009354e-06f,
+	6.484980e-05f,
+	-1.397249e-05f,
+	-1.039664e-04f,
+	1.291704e-05f,
+	1.473971e-04f,
+	-2.300369e-05f,
+	-2.199442e-04f,
+	2.494995e-05f,
+	3.084925e-04f,
+	-4.560264e-05f,
+	-4.542366e-04f,
+	7.130326e-05f,
+	6.706071e-04f,
+	-1.709424e-04f,
+	-1.098243e-03f,
+	5.414296e-04f,
+	2.096309e-03f,
+	-5.184947e-03f,
+	1.781251e-03f,
+	9.692973e-04f,
+	-1.037290e-03f,
+	-3.923296e-04f,
+	6.450698e-04f,
+	2.103671e-04f,
+	-4.400133e-04f,
+	-1.394772e-04f,
+	2.993118e-04f,
+	8.988553e-05f,
+	-2.136375e-04f,
+	-6.807983e-05f,
+	1.428596e-04f,
+	4.376830e-05f,
+	-1.007387e-04f,
+	-3.467027e-05f,
+	6.251150e-05f,
+	2.039372e-05f,
+	-4.252842e-05f,
+	-1.656901e-05f,
+	2.283833e-05f,
+	8.167564e-06f,
+	-1.481642e-05f,
+	-6.938821e-06f,
+	5.781062e-06f,
+	2.449380e-06f,
+	-3.473314e-06f,
+	-2.234355e-06f,
+	2.098797e-07f,
+	3.233240e-07f,
+	2.498997e-08f,
+	6.994576e-14f,
+
+	1.313732e-08f,
+	2.632690e-07f,
+	3.421224e-07f,
+	-1.787194e-06f,
+	-3.688522e-06f,
+	1.330131e-06f,
+	6.216160e-06f,
+	-4.537466e-06f,
+	-1.547905e-05f,
+	3.788649e-06f,
+	2.391559e-05f,
+	-9.053379e-06f,
+	-4.408458e-05f,
+	8.342951e-06f,
+	6.480277e-05f,
+	-1.603481e-05f,
+	-1.039264e-04f,
+	1.599103e-05f,
+	1.473600e-04f,
+	-2.749505e-05f,
+	-2.199172e-04f,
+	3.142005e-05f,
+	3.084454e-04f,
+	-5.495611e-05f,
+	-4.540897e-04f,
+	8.515900e-05f,
+	6.700184e-04f,
+	-1.929992e-04f,
+	-1.095630e-03f,
+	5.840481e-04f,
+	2.075456e-03f,
+	-5.411934e-03f,
+	1.823866e-03f,
+	9.266941e-04f,
+	-1.046919e-03f,
+	-3.702766e-04f,
+	6.496081e-04f,
+	1.965133e-04f,
+	-4.427217e-04f,
+	-1.301249e-04f,
+	3.011075e-04f,
+	8.341617e-05f,
+	-2.148764e-04f,
+	-6.358898e-05f,
+	1.437332e-04f,
+	4.069467e-05f,
+	-1.013466e-04f,
+	-3.260822e-05f,
+	6.293382e-05f,
+	1.906031e-05f,
+	-4.280827e-05f,
+	-1.573741e-05f,
+	2.302302e-05f,
+	7.683069e-06f,
+	-1.492708e-05f,
+	-6.673126e-06f,
+	5.848624e-06f,
+	2.325566e-06f,
+	-3.505760e-06f,
+	-2.184885e-06f,
+	2.273142e-07f,
+	3.167011e-07f,
+	2.338589e-08f,
+	2.446931e-14f,
+
+	1.418735e-08f,
+	2.699254e-07f,
+	3.301008e-07f,
+	-1.836801e-06f,
+	-3.673007e-06f,
+	1.454289e-06f,
+	6.186797e-06f,
+	-4.803860e-06f,
+	-1.544208e-05f,
+	4.274415e-06f,
+	2.386031e-05f,
+	-9.887120e-06f,
+	-4.401778e-05f,
+	9.679788e-06f,
+	6.471472e-05f,
+	-1.810212e-05f,
+	-1.038242e-04f,
+	1.907247e-05f,
+	1.472312e-04f,
+	-3.199728e-05f,
+	-2.197575e-04f,
+	3.790584e-05f,
+	3.082067e-04f,
+	-6.433232e-05f,
+	-4.536626e-04f,
+	9.904864e-05f,
+	6.689985e-04f,
+	-2.151110e-04f,
+	-1.092257e-03f,
+	6.267799e-04f,
+	2.052338e-03f,
+	-5.642729e-03f,
+	1.863912e-03f,
+	8.839697e-04f,
+	-1.055754e-03f,
+	-3.481668e-04f,
+	6.537023e-04f,
+	1.826245e-04f,
+	-4.451427e-04f,
+	-1.207492e-04f,
+	3.027073e-04f,
+	7.693074e-05f,
+	-2.159796e-04f,
+	-5.908700e-05f,
+	1.445131e-04f,
+	3.761342e-05f,
+	-1.018907e-04f,
+	-3.054103e-05f,
+	6.331399e-05f,
+	1.772356e-05f,
+	-4.306123e-05f,
+	-1.490373e-05f,
+	2.319136e-05f,
+	7.197345e-06f,
+	-1.502841e-05f,
+	-6.406759e-06f,
+	5.911332e-06f,
+	2.201424e-06f,
+	-3.536043e-06f,
+	-2.135287e-06f,
+	2.440476e-07f,
+	3.100483e-07f,
+	2.185861e-08f,
+	6.610943e-15f,
+
+	1.529905e-08f,
+	2.766016e-07f,
+	3.174296e-07f,
+	-1.886498e-06f,
+	-3.655431e-06f,
+	1.578681e-06f,
+	6.152757e-06f,
+	-5.070740e-06f,
+	-1.539606e-05f,
+	4.761075e-06f,
+	2.378911e-05f,
+	-1.072238e-05f,
+	-4.392472e-05f,
+	1.101906e-05f,
+	6.458543e-05f,
+	-2.017319e-05f,
+	-1.036596e-04f,
+	2.215952e-05f,
+	1.470104e-04f,
+	-3.650770e-05f,
+	-2.194643e-04f,
+	4.440343e-05f,
+	3.077757e-04f,
+	-7.372563e-05f,
+	-4.529536e-04f,
+	1.129638e-04f,
+	6.675449e-04f,
+	-2.372640e-04f,
+	-1.088117e-03f,
+	6.695975e-04f,
+	2.026916e-03f,
+	-5.877335e-03f,
+	1.901426e-03f,
+	8.411551e-04f,
+	-1.063797e-03f,
+	-3.260145e-04f,
+	6.573530e-04f,
+	1.687097e-04f,
+	-4.472767e-04f,
+	-1.113561e-04f,
+	3.041112e-04f,
+	7.043329e-05f,
+	-2.169470e-04f,
+	-5.457669e-05f,
+	1.451993e-04f,
+	3.452644e-05f,
+	-1.023713e-04f,
+	-2.847001e-05f,
+	6.365208e-05f,
+	1.638432e-05f,
+	-4.328735e-05f,
+	-1.406849e-05f,
+	2.334337e-05f,
+	6.710702e-06f,
+	-1.512043e-05f,
+	-6.139890e-06f,
+	5.969203e-06f,
+	2.077038e-06f,
+	-3.564173e-06f,
+	-2.085593e-06f,
+	2.600861e-07f,
+	3.033735e-07f,
+	2.040599e-08f,
+	1.184006e-15f,
+
+	1.647459e-08f,
+	2.832913e-07f,
+	3.041004e-07f,
+	-1.936257e-06f,
+	-3.635776e-06f,
+	1.703232e-06f,
+	6.114008e-06f,
+	-5.337947e-06f,
+	-1.534094e-05f,
+	5.248333e-06f,
+	2.370190e-05f,
+	-1.155866e-05f,
+	-4.380525e-05f,
+	1.235997e-05f,
+	6.441468e-05f,
+	-2.224677e-05f,
+	-1.034322e-04f,
+	2.525031e-05f,
+	1.466972e-04f,
+	-4.102358e-05f,
+	-2.190371e-04f,
+	5.090893e-05f,
+	3.071512e-04f,
+	-8.313040e-05f,
+	-4.519616e-04f,
+	1.268960e-04f,
+	6.656555e-04f,
+	-2.594448e-04f,
+	-1.083206e-03f,
+	7.124727e-04f,
+	1.999153e-03f,
+	-6.115755e-03f,
+	1.936446e-03f,
+	7.982808e-04f,
+	-1.071050e-03f,
+	-3.038340e-04f,
+	6.605612e-04f,
+	1.547776e-04f,
+	-4.491240e-04f,
+	-1.019514e-04f,
+	3.053196e-04f,
+	6.392783e-05f,
+	-2.177788e-04f,
+	-5.006083e-05f,
+	1.457919e-04f,
+	3.143566e-05f,
+	-1.027883e-04f,
+	-2.639645e-05f,
+	6.394814e-05f,
+	1.504342e-05f,
+	-4.348667e-05f,
+	-1.323223e-05f,
+	2.347909e-05f,
+	6.223449e-06f,
+	-1.520316e-05f,
+	-5.872686e-06f,
+	6.022257e-06f,
+	1.952490e-06f,
+	-3.590162e-06f,
+	-2.035835e-06f,
+	2.754363e-07f,
+	2.966842e-07f,
+	1.902588e-08f,
+	9.865466e-17f,
+
+	1.771614e-08f,
+	2.899878e-07f,
+	2.901052e-07f,
+	-1.986046e-06f,
+	-3.614025e-06f,
+	1.827861e-06f,
+	6.070517e-06f,
+	-5.605317e-06f,
+	-1.527665e-05f,
+	5.735891e-06f,
+	2.359858e-05f,
+	-1.239544e-05f,
+	-4.365927e-05f,
+	1.370170e-05f,
+	6.420231e-05f,
+	-2.432161e-05f,
+	-1.031419e-04f,
+	2.834299e-05f,
+	1.462911e-04f,
+	-4.554221e-05f,
+	-2.184754e-04f,
+	5.741838e-05f,
+	3.063327e-04f,
+	-9.254090e-05f,
+	-4.506854e-04f,
+	1.408368e-04f,
+	6.633282e-04f,
+	-2.816394e-04f,
+	-1.077519e-03f,
+	7.553768e-04f,
+	1.969009e-03f,
+	-6.357988e-03f,
+	1.969009e-03f,
+	7.553768e-04f,
+	-1.077519e-03f,
+	-2.816394e-04f,
+	6.633282e-04f,
+	1.408368e-04f,
+	-4.506854e-04f,
+	-9.254090e-05f,
+	3.063327e-04f,
+	5.741838e-05f,
+	-2.184754e-04f,
+	-4.554221e-05f,
+	1.462911e-04f,
+	2.834299e-05f,
+	-1.031419e-04f,
+	-2.432161e-05f,
+	6.420231e-05f,
+	1.370170e-05f,
+	-4.365927e-05f,
+	-1.239544e-05f,
+	2.359858e-05f,
+	5.735891e-06f,
+	-1.527665e-05f,
+	-5.605317e-06f,
+	6.070517e-06f,
+	1.827861e-06f,
+	-3.614025e-06f,
+	-1.986046e-06f,
+	2.901052e-07f,
+	2.899878e-07f,
+	1.771614e-08f,
+	-5.159147e-40f
+};
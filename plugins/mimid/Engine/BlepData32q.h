@@ -0,0 +1,282 @@
+// BLEP and BLAMP tables for Samples = 32, quantized to 16 bits, generated by Utils/blepnew.c.
+// See BlepData.h.
+
+// blep table: 4160 entries, times blepScale
+const float blepScale = 1.525925e-05f;
+const int16_t blep[] = {
+	0, 0, -1, 2, -3, 6, -9, 13, -18, 25, -34, 44, -57, 72, -91, 114, -141, 172, -210, 254, -306, 368, -441, 530, -639, 776, -952, 1192, -1538, 2091, -3131, 5837, 32767, -5837, 3131, -2091, 1538, -1192, 952, -776, 639, -530, 441, -368, 306, -254, 210, -172, 141, -114, 91, -72, 57, -44, 34, -25, 18, -13, 9, -6, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 6, -9, 13, -18, 25, -33, 44, -57, 72, -91, 114, -140, 172, -209, 253, -306, 367, -441, 530, -638, 775, -951, 1190, -1536, 2088, -3127, 5829, 31743, -5829, 3127, -2088, 1536, -1190, 951, -775, 638, -530, 441, -367, 306, -253, 209, -172, 140, -114, 91, -72, 57, -44, 33, -25, 18, -13, 9, -6, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 6, -9, 13, -18, 25, -33, 44, -57, 72, -91, 113, -140, 171, -209, 253, -304, 366, -439, 528, -636, 772, -948, 1186, -1530, 2080, -3115, 5804, 30720, -5806, 3116, -2080, 1530, -1186, 948, -772, 636, -528, 439, -366, 305, -253, 209, -171, 140, -113, 91, -72, 57, -44, 33, -25, 18, -13, 9, -6, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 6, -9, 13, -18, 25, -33, 43, -56, 72, -90, 113, -139, 170, -207, 251, -303, 364, -437, 524, -632, 767, -942, 1179, -1521, 2067, -3095, 5763, 29699, -5768, 3097, -2068, 1521, -1179, 942, -767, 632, -524, 437, -364, 303, -251, 207, -170, 139, -113, 90, -72, 56, -43, 33, -25, 18, -13, 9, -6, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 6, -9, 13, -18, 24, -33, 43, -56, 71, -90, 112, -138, 169, -206, 249, -300, 361, -433, 520, -627, 761, -934, 1168, -1508, 2049, -3067, 5704, 28680, -5715, 3070, -2050, 1508, -1169, 934, -761, 627, -520, 433, -361, 300, -249, 206, -169, 138, -112, 90, -71, 56, -43, 33, -24, 18, -13, 9, -6, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 5, -9, 12, -18, 24, -32, 43, -55, 70, -89, 110, -136, 167, -203, 246, -297, 356, -428, 514, -620, 752, -923, 1155, -1490, 2025, -3031, 5628, 27665, -5649, 3036, -2028, 1492, -1156, 924, -753, 620, -514, 428, -357, 297, -246, 203, -167, 136, -110, 89, -70, 55, -43, 33, -24, 18, -12, 9, -5, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 5, -8, 12, -17, 24, -32, 42, -54, 69, -87, 109, -134, 165, -201, 243, -293, 352, -422, 507, -611, 742, -911, 1139, -1470, 1997, -2986, 5533, 26653, -5569, 2995, -2001, 1472, -1141, 912, -742, 612, -508, 423, -352, 293, -243, 201, -165, 135, -109, 87, -69, 54, -42, 32, -24, 17, -12, 8, -5, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 5, -8, 12, -17, 23, -31, 41, -53, 68, -86, 107, -132, 162, -197, 239, -288, 346, -415, 499, -601, 729, -895, 1120, -1445, 1962, -2933, 5419, 25647, -5477, 2947, -1969, 1449, -1123, 897, -731, 602, -500, 416, -346, 288, -239, 198, -162, 132, -107, 86, -68, 54, -41, 32, -24, 17, -12, 8, -5, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 5, -8, 12, -17, 23, -31, 40, -52, 67, -84, 105, -130, 159, -193, 234, -282, 339, -407, 489, -590, 715, -878, 1098, -1416, 1923, -2871, 5287, 24646, -5373, 2893, -1933, 1422, -1102, 881, -717, 591, -490, 408, -340, 283, -235, 194, -159, 130, -105, 84, -67, 53, -41, 31, -23, 17, -12, 8, -5, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 5, -8, 12, -16, 22, -30, 40, -51, 65, -82, 103, -127, 155, -189, 229, -276, 332, -398, 478, -576, 699, -858, 1074, -1384, 1879, -2802, 5135, 23651, -5257, 2832, -1892, 1392, -1079, 862, -702, 579, -480, 400, -333, 277, -230, 190, -156, 127, -103, 83, -66, 52, -40, 30, -23, 17, -12, 8, -5, 3, -2, 1, 0,
+	0, 0, -1, 2, -3, 5, -8, 11, -16, 22, -29, 39, -50, 64, -80, 100, -124, 151, -184, 223, -269, 323, -388, 466, -562, 682, -837, 1046, -1348, 1829, -2724, 4963, 22664, -5130, 2765, -1848, 1359, -1053, 842, -685, 565, -469, 390, -325, 270, -224, 185, -152, 124, -101, 81, -64, 50, -39, 30, -22, 16, -11, 8, -5, 3, -2, 1, 0,
+	0, 0, -1, 1, -3, 5, -8, 11, -16, 21, -29, 37, -49, 62, -78, 97, -120, 147, -179, 217, -261, 314, -377, 453, -546, 662, -813, 1016, -1309, 1774, -2637, 4772, 21685, -4993, 2692, -1799, 1323, -1025, 819, -667, 550, -456, 380, -316, 263, -218, 180, -148, 121, -98, 79, -62, 49, -38, 29, -21, 16, -11, 8, -5, 3, -2, 1, 0,
+	0, 0, -1, 1, -3, 5, -7, 11, -15, 21, -28, 36, -47, 60, -75, 94, -116, 142, -173, 210, -253, 304, -365, 438, -528, 641, -786, 983, -1266, 1714, -2543, 4559, 20715, -4846, 2614, -1746, 1284, -995, 795, -647, 534, -443, 368, -307, 255, -212, 175, -144, 117, -95, 76, -61, 48, -37, 28, -21, 15, -11, 7, -5, 3, -1, 1, 0,
+	0, 0, -1, 1, -3, 4, -7, 10, -14, 20, -27, 35, -45, 58, -73, 91, -112, 137, -167, 202, -244, 293, -352, 423, -510, 618, -758, 947, -1219, 1649, -2440, 4327, 19754, -4690, 2530, -1690, 1243, -963, 769, -626, 516, -428, 356, -297, 247, -205, 169, -139, 114, -92, 74, -59, 46, -36, 27, -20, 15, -10, 7, -5, 3, -1, 1, 0,
+	0, 0, -1, 1, -3, 4, -7, 10, -14, 19, -26, 34, -43, 55, -70, 87, -108, 132, -161, 194, -234, 282, -338, 406, -489, 593, -728, 909, -1169, 1579, -2329, 4073, 18804, -4525, 2441, -1630, 1198, -928, 741, -604, 497, -413, 344, -286, 238, -198, 163, -134, 110, -89, 71, -56, 44, -34, 26, -19, 14, -10, 7, -4, 3, -1, 1, 0,
+	0, 0, -1, 1, -2, 4, -6, 9, -13, 18, -24, 32, -42, 53, -67, 83, -103, 126, -154, 186, -224, 269, -323, 388, -468, 567, -696, 868, -1116, 1505, -2211, 3799, 17865, -4353, 2347, -1567, 1151, -891, 712, -580, 478, -396, 330, -275, 229, -190, 157, -129, 105, -85, 68, -54, 43, -33, 25, -19, 14, -10, 7, -4, 3, -1, 1, 0,
+	0, 0, 0, 1, -2, 4, -6, 9, -13, 17, -23, 30, -39, 50, -63, 79, -98, 120, -146, 177, -213, 256, -308, 369, -445, 540, -661, 825, -1059, 1426, -2085, 3503, 16937, -4173, 2249, -1500, 1102, -853, 681, -555, 457, -379, 316, -263, 219, -181, 150, -123, 101, -81, 65, -52, 41, -32, 24, -18, 13, -9, 6, -4, 3, -1, 1, 0,
+	0, 0, 0, 1, -2, 4, -6, 8, -12, 16, -22, 29, -37, 48, -60, 75, -93, 113, -138, 167, -202, 243, -291, 350, -421, 510, -625, 780, -1000, 1342, -1951, 3185, 16022, -3986, 2147, -1431, 1050, -813, 649, -528, 435, -361, 301, -250, 208, -173, 143, -117, 96, -78, 62, -49, 39, -30, 23, -17, 13, -9, 6, -4, 2, -1, 1, 0,
+	0, 0, 0, 1, -2, 3, -5, 8, -11, 15, -21, 27, -35, 45, -56, 70, -87, 107, -130, 157, -190, 228, -274, 329, -396, 480, -588, 732, -937, 1255, -1809, 2846, 15119, -3794, 2040, -1358, 997, -771, 615, -501, 413, -342, 285, -237, 198, -164, 136, -111, 91, -74, 59, -47, 37, -29, 22, -16, 12, -8, 6, -4, 2, -1, 1, 0,
+	0, 0, 0, 1, -2, 3, -5, 7, -10, 14, -19, 25, -33, 42, -53, 66, -81, 100, -121, 147, -177, 213, -256, 307, -370, 448, -548, 682, -872, 1162, -1661, 2486, 14231, -3596, 1931, -1284, 941, -728, 581, -472, 389, -323, 269, -224, 186, -155, 128, -105, 86, -69, 56, -44, 35, -27, 21, -15, 11, -8, 6, -4, 2, -1, 1, 0,
+	0, 0, 0, 1, -2, 3, -5, 7, -10, 13, -18, 23, -30, 38, -49, 61, -75, 92, -112, 136, -164, 197, -237, 284, -342, 415, -507, 630, -803, 1066, -1506, 2103, 13357, -3393, 1817, -1206, 884, -683, 545, -443, 365, -302, 252, -210, 175, -145, 120, -98, 81, -65, 52, -42, 33, -25, 19, -14, 11, -8, 5, -3, 2, -1, 0, 0,
+	0, 0, 0, 1, -2, 3, -4, 6, -9, 12, -16, 21, -28, 35, -45, 56, -69, 85, -103, 125, -151, 181, -218, 261, -314, 380, -464, 576, -732, 967, -1344, 1699, 12497, -3186, 1701, -1127, 824, -636, 507, -413, 340, -282, 234, -195, 163, -135, 112, -92, 75, -61, 49, -39, 31, -24, 18, -14, 10, -7, 5, -3, 2, -1, 0, 0,
+	0, 0, 0, 1, -1, 2, -4, 5, -8, 11, -15, 19, -25, 32, -40, 50, -62, 77, -94, 113, -137, 164, -197, 237, -285, 344, -420, 520, -659, 863, -1175, 1272, 11654, -2975, 1582, -1046, 764, -589, 469, -381, 314, -260, 217, -181, 150, -125, 103, -85, 69, -56, 45, -36, 28, -22, 17, -13, 9, -7, 5, -3, 2, -1, 0, 0,
+	0, 0, 0, 1, -1, 2, -3, 5, -7, 9, -13, 17, -22, 28, -36, 45, -56, 69, -84, 101, -122, 147, -177, 212, -255, 308, -375, 463, -583, 756, -1000, 824, 10826, -2762, 1461, -963, 702, -540, 430, -350, 288, -238, 198, -165, 138, -114, 95, -78, 64, -52, 42, -33, 26, -20, 15, -12, 9, -6, 4, -3, 2, -1, 0, 0,
+	0, 0, 0, 0, -1, 2, -3, 4, -6, 8, -11, 15, -19, 25, -32, 39, -49, 60, -74, 89, -108, 130, -155, 186, -224, 270, -328, 404, -505, 646, -820, 354, 10015, -2545, 1338, -878, 638, -491, 390, -317, 261, -216, 180, -150, 125, -104, 86, -71, 58, -47, 38, -30, 24, -18, 14, -11, 8, -6, 4, -2, 2, -1, 0, 0,
+	0, 0, 0, 0, -1, 1, -2, 3, -5, 7, -10, 13, -17, 21, -27, 34, -42, 52, -63, 77, -93, 111, -134, 160, -192, 231, -281, 343, -426, 533, -634, -138, 9221, -2327, 1214, -792, 574, -441, 350, -284, 233, -193, 161, -134, 112, -93, 77, -63, 52, -42, 34, -27, 21, -17, 13, -10, 7, -5, 4, -2, 1, -1, 0, 0,
+	0, 0, 0, 0, -1, 1, -2, 3, -4, 6, -8, 10, -14, 17, -22, 28, -35, 43, -53, 64, -77, 93, -112, 133, -160, 192, -232, 281, -344, 417, -442, -652, 8445, -2108, 1087, -705, 509, -390, 309, -250, 206, -170, 142, -118, 99, -82, 68, -56, 46, -37, 30, -24, 19, -15, 11, -8, 6, -4, 3, -2, 1, -1, 0, 0,
+	0, 0, 0, 0, 0, 1, -1, 2, -3, 4, -6, 8, -11, 14, -18, 22, -28, 34, -42, 51, -62, 74, -89, 106, -127, 152, -182, 218, -261, 299, -246, -1187, 7687, -1887, 960, -617, 443, -338, 267, -216, 178, -147, 122, -102, 85, -71, 59, -48, 40, -32, 26, -21, 16, -13, 10, -7, 6, -4, 3, -2, 1, -1, 0, 0,
+	0, 0, 0, 0, 0, 0, -1, 1, -2, 3, -4, 6, -8, 10, -13, 16, -20, 25, -31, 38, -46, 55, -66, 79, -94, 111, -132, 154, -176, 179, -46, -1744, 6947, -1667, 832, -529, 377, -286, 225, -182, 149, -123, 103, -86, 71, -59, 49, -41, 34, -27, 22, -18, 14, -11, 8, -6, 5, -3, 2, -2, 1, -1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, -1, 2, -2, 3, -4, 6, -8, 10, -13, 16, -20, 24, -30, 36, -43, 51, -60, 70, -81, 89, -90, 56, 159, -2322, 6227, -1446, 704, -440, 310, -233, 183, -147, 121, -100, 83, -69, 58, -48, 40, -33, 27, -22, 18, -14, 12, -9, 7, -5, 4, -3, 2, -1, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, -1, 2, -3, 4, -5, 7, -9, 11, -13, 16, -19, 22, -26, 28, -29, 24, -3, -68, 367, -2922, 5526, -1227, 576, -351, 243, -181, 141, -113, 92, -76, 63, -53, 44, -37, 31, -25, 21, -17, 14, -11, 9, -7, 6, -4, 3, -2, 2, -1, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, -1, 1, -1, 1, -1, 1, -2, 2, -2, 2, -2, 2, -3, 3, -3, 3, -4, 4, -6, 9, -14, 23, -42, 84, -194, 578, -3542, 4844, -1009, 448, -262, 176, -128, 98, -78, 63, -52, 43, -36, 30, -25, 21, -18, 15, -12, 10, -8, 7, -5, 4, -3, 2, -2, 1, -1, 1, 0, 0, 0,
+	0, 0, 0, -1, 1, -1, 1, -2, 2, -3, 3, -4, 5, -6, 7, -9, 10, -12, 14, -17, 20, -23, 28, -35, 43, -56, 76, -109, 173, -320, 792, -4183, 4183, -792, 320, -173, 109, -76, 56, -43, 35, -28, 23, -20, 17, -14, 12, -10, 9, -7, 6, -5, 4, -3, 3, -2, 2, -1, 1, -1, 1, 0, 0, 0,
+	0, 0, 0, -1, 1, -1, 2, -2, 3, -4, 5, -7, 8, -10, 12, -15, 18, -21, 25, -30, 36, -43, 52, -63, 78, -98, 128, -176, 262, -448, 1009, -4844, 3542, -578, 194, -84, 42, -23, 14, -9, 6, -4, 4, -3, 3, -3, 3, -2, 2, -2, 2, -2, 2, -1, 1, -1, 1, -1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, -1, 1, -2, 2, -3, 4, -6, 7, -9, 11, -14, 17, -21, 25, -31, 37, -44, 53, -63, 76, -92, 113, -141, 181, -243, 351, -576, 1227, -5526, 2922, -367, 68, 3, -24, 29, -28, 26, -22, 19, -16, 13, -11, 9, -7, 5, -4, 3, -2, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, -1, 1, -2, 3, -4, 5, -7, 9, -12, 14, -18, 22, -27, 33, -40, 48, -58, 69, -83, 100, -121, 147, -183, 233, -310, 440, -704, 1446, -6227, 2322, -159, -56, 90, -89, 81, -70, 60, -51, 43, -36, 30, -24, 20, -16, 13, -10, 8, -6, 4, -3, 2, -2, 1, -1, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, -1, 2, -2, 3, -5, 6, -8, 11, -14, 18, -22, 27, -34, 41, -49, 59, -71, 86, -103, 123, -149, 182, -225, 286, -377, 529, -832, 1667, -6947, 1744, 46, -179, 176, -154, 132, -111, 94, -79, 66, -55, 46, -38, 31, -25, 20, -16, 13, -10, 8, -6, 4, -3, 2, -1, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, -1, 2, -3, 4, -6, 7, -10, 13, -16, 21, -26, 32, -40, 48, -59, 71, -85, 102, -122, 147, -178, 216, -267, 338, -443, 617, -960, 1887, -7687, 1187, 246, -299, 261, -218, 182, -152, 127, -106, 89, -74, 62, -51, 42, -34, 28, -22, 18, -14, 11, -8, 6, -4, 3, -2, 1, -1, 0, 0, 0, 0, 0,
+	0, 0, 1, -1, 2, -3, 4, -6, 8, -11, 15, -19, 24, -30, 37, -46, 56, -68, 82, -99, 118, -142, 170, -206, 250, -309, 390, -509, 705, -1087, 2108, -8445, 652, 442, -417, 344, -281, 232, -192, 160, -133, 112, -93, 77, -64, 53, -43, 35, -28, 22, -17, 14, -10, 8, -6, 4, -3, 2, -1, 1, 0, 0, 0, 0,
+	0, 0, 1, -1, 2, -4, 5, -7, 10, -13, 17, -21, 27, -34, 42, -52, 63, -77, 93, -112, 134, -161, 193, -233, 284, -350, 441, -574, 792, -1214, 2327, -9221, 138, 634, -533, 426, -343, 281, -231, 192, -160, 134, -111, 93, -77, 63, -52, 42, -34, 27, -21, 17, -13, 10, -7, 5, -3, 2, -1, 1, 0, 0, 0, 0,
+	0, 0, 1, -2, 2, -4, 6, -8, 11, -14, 18, -24, 30, -38, 47, -58, 71, -86, 104, -125, 150, -180, 216, -261, 317, -390, 491, -638, 878, -1338, 2545, -10015, -354, 820, -646, 505, -404, 328, -270, 224, -186, 155, -130, 108, -89, 74, -60, 49, -39, 32, -25, 19, -15, 11, -8, 6, -4, 3, -2, 1, 0, 0, 0, 0,
+	0, 0, 1, -2, 3, -4, 6, -9, 12, -15, 20, -26, 33, -42, 52, -64, 78, -95, 114, -138, 165, -198, 238, -288, 350, -430, 540, -702, 963, -1461, 2762, -10826, -824, 1000, -756, 583, -463, 375, -308, 255, -212, 177, -147, 122, -101, 84, -69, 56, -45, 36, -28, 22, -17, 13, -9, 7, -5, 3, -2, 1, -1, 0, 0, 0,
+	0, 0, 1, -2, 3, -5, 7, -9, 13, -17, 22, -28, 36, -45, 56, -69, 85, -103, 125, -150, 181, -217, 260, -314, 381, -469, 589, -764, 1046, -1582, 2975, -11654, -1272, 1175, -863, 659, -520, 420, -344, 285, -237, 197, -164, 137, -113, 94, -77, 62, -50, 40, -32, 25, -19, 15, -11, 8, -5, 4, -2, 1, -1, 0, 0, 0,
+	0, 0, 1, -2, 3, -5, 7, -10, 14, -18, 24, -31, 39, -49, 61, -75, 92, -112, 135, -163, 195, -234, 282, -340, 413, -507, 636, -824, 1127, -1701, 3186, -12497, -1699, 1344, -967, 732, -576, 464, -380, 314, -261, 218, -181, 151, -125, 103, -85, 69, -56, 45, -35, 28, -21, 16, -12, 9, -6, 4, -3, 2, -1, 0, 0, 0,
+	0, 0, 1, -2, 3, -5, 8, -11, 14, -19, 25, -33, 42, -52, 65, -81, 98, -120, 145, -175, 210, -252, 302, -365, 443, -545, 683, -884, 1206, -1817, 3393, -13357, -2103, 1506, -1066, 803, -630, 507, -415, 342, -284, 237, -197, 164, -136, 112, -92, 75, -61, 49, -38, 30, -23, 18, -13, 10, -7, 5, -3, 2, -1, 0, 0, 0,
+	0, -1, 1, -2, 4, -6, 8, -11, 15, -21, 27, -35, 44, -56, 69, -86, 105, -128, 155, -186, 224, -269, 323, -389, 472, -581, 728, -941, 1284, -1931, 3596, -14231, -2486, 1661, -1162, 872, -682, 548, -448, 370, -307, 256, -213, 177, -147, 121, -100, 81, -66, 53, -42, 33, -25, 19, -14, 10, -7, 5, -3, 2, -1, 0, 0, 0,
+	0, -1, 1, -2, 4, -6, 8, -12, 16, -22, 29, -37, 47, -59, 74, -91, 111, -136, 164, -198, 237, -285, 342, -413, 501, -615, 771, -997, 1358, -2040, 3794, -15119, -2846, 1809, -1255, 937, -732, 588, -480, 396, -329, 274, -228, 190, -157, 130, -107, 87, -70, 56, -45, 35, -27, 21, -15, 11, -8, 5, -3, 2, -1, 0, 0, 0,
+	0, -1, 1, -2, 4, -6, 9, -13, 17, -23, 30, -39, 49, -62, 78, -96, 117, -143, 173, -208, 250, -301, 361, -435, 528, -649, 813, -1050, 1431, -2147, 3986, -16022, -3185, 1951, -1342, 1000, -780, 625, -510, 421, -350, 291, -243, 202, -167, 138, -113, 93, -75, 60, -48, 37, -29, 22, -16, 12, -8, 6, -4, 2, -1, 0, 0, 0,
+	0, -1, 1, -3, 4, -6, 9, -13, 18, -24, 32, -41, 52, -65, 81, -101, 123, -150, 181, -219, 263, -316, 379, -457, 555, -681, 853, -1102, 1500, -2249, 4173, -16937, -3503, 2085, -1426, 1059, -825, 661, -540, 445, -369, 308, -256, 213, -177, 146, -120, 98, -79, 63, -50, 39, -30, 23, -17, 13, -9, 6, -4, 2, -1, 0, 0, 0,
+	0, -1, 1, -3, 4, -7, 10, -14, 19, -25, 33, -43, 54, -68, 85, -105, 129, -157, 190, -229, 275, -330, 396, -478, 580, -712, 891, -1151, 1567, -2347, 4353, -17865, -3799, 2211, -1505, 1116, -868, 696, -567, 468, -388, 323, -269, 224, -186, 154, -126, 103, -83, 67, -53, 42, -32, 24, -18, 13, -9, 6, -4, 2, -1, 1, 0, 0,
+	0, -1, 1, -3, 4, -7, 10, -14, 19, -26, 34, -44, 56, -71, 89, -110, 134, -163, 198, -238, 286, -344, 413, -497, 604, -741, 928, -1198, 1630, -2441, 4525, -18804, -4073, 2329, -1579, 1169, -909, 728, -593, 489, -406, 338, -282, 234, -194, 161, -132, 108, -87, 70, -55, 43, -34, 26, -19, 14, -10, 7, -4, 3, -1, 1, 0, 0,
+	0, -1, 1, -3, 5, -7, 10, -15, 20, -27, 36, -46, 59, -74, 92, -114, 139, -169, 205, -247, 297, -356, 428, -516, 626, -769, 963, -1243, 1690, -2530, 4690, -19754, -4327, 2440, -1649, 1219, -947, 758, -618, 510, -423, 352, -293, 244, -202, 167, -137, 112, -91, 73, -58, 45, -35, 27, -20, 14, -10, 7, -4, 3, -1, 1, 0, 0,
+	0, -1, 1, -3, 5, -7, 11, -15, 21, -28, 37, -48, 61, -76, 95, -117, 144, -175, 212, -255, 307, -368, 443, -534, 647, -795, 995, -1284, 1746, -2614, 4846, -20715, -4559, 2543, -1714, 1266, -983, 786, -641, 528, -438, 365, -304, 253, -210, 173, -142, 116, -94, 75, -60, 47, -36, 28, -21, 15, -11, 7, -5, 3, -1, 1, 0, 0,
+	0, -1, 2, -3, 5, -8, 11, -16, 21, -29, 38, -49, 62, -79, 98, -121, 148, -180, 218, -263, 316, -380, 456, -550, 667, -819, 1025, -1323, 1799, -2692, 4993, -21685, -4772, 2637, -1774, 1309, -1016, 813, -662, 546, -453, 377, -314, 261, -217, 179, -147, 120, -97, 78, -62, 49, -37, 29, -21, 16, -11, 8, -5, 3, -1, 1, 0, 0,
+	0, -1, 2, -3, 5, -8, 11, -16, 22, -30, 39, -50, 64, -81, 101, -124, 152, -185, 224, -270, 325, -390, 469, -565, 685, -842, 1053, -1359, 1848, -2765, 5130, -22664, -4963, 2724, -1829, 1348, -1046, 837, -682, 562, -466, 388, -323, 269, -223, 184, -151, 124, -100, 80, -64, 50, -39, 29, -22, 16, -11, 8, -5, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 5, -8, 12, -17, 23, -30, 40, -52, 66, -83, 103, -127, 156, -190, 230, -277, 333, -400, 480, -579, 702, -862, 1079, -1392, 1892, -2832, 5257, -23651, -5135, 2802, -1879, 1384, -1074, 858, -699, 576, -478, 398, -332, 276, -229, 189, -155, 127, -103, 82, -65, 51, -40, 30, -22, 16, -12, 8, -5, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 5, -8, 12, -17, 23, -31, 41, -53, 67, -84, 105, -130, 159, -194, 235, -283, 340, -408, 490, -591, 717, -881, 1102, -1422, 1933, -2893, 5373, -24646, -5287, 2871, -1923, 1416, -1098, 878, -715, 590, -489, 407, -339, 282, -234, 193, -159, 130, -105, 84, -67, 52, -40, 31, -23, 17, -12, 8, -5, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 5, -8, 12, -17, 24, -32, 41, -54, 68, -86, 107, -132, 162, -198, 239, -288, 346, -416, 500, -602, 731, -897, 1123, -1449, 1969, -2947, 5477, -25647, -5419, 2933, -1962, 1445, -1120, 895, -729, 601, -499, 415, -346, 288, -239, 197, -162, 132, -107, 86, -68, 53, -41, 31, -23, 17, -12, 8, -5, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 5, -8, 12, -17, 24, -32, 42, -54, 69, -87, 109, -135, 165, -201, 243, -293, 352, -423, 508, -612, 742, -912, 1141, -1472, 2001, -2995, 5569, -26653, -5533, 2986, -1997, 1470, -1139, 911, -742, 611, -507, 422, -352, 293, -243, 201, -165, 134, -109, 87, -69, 54, -42, 32, -24, 17, -12, 8, -5, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 5, -9, 12, -18, 24, -33, 43, -55, 70, -89, 110, -136, 167, -203, 246, -297, 357, -428, 514, -620, 753, -924, 1156, -1492, 2028, -3036, 5649, -27665, -5628, 3031, -2025, 1490, -1155, 923, -752, 620, -514, 428, -356, 297, -246, 203, -167, 136, -110, 89, -70, 55, -43, 32, -24, 18, -12, 9, -5, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 6, -9, 13, -18, 24, -33, 43, -56, 71, -90, 112, -138, 169, -206, 249, -300, 361, -433, 520, -627, 761, -934, 1169, -1508, 2050, -3070, 5715, -28680, -5704, 3067, -2049, 1508, -1168, 934, -761, 627, -520, 433, -361, 300, -249, 206, -169, 138, -112, 90, -71, 56, -43, 33, -24, 18, -13, 9, -6, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 6, -9, 13, -18, 25, -33, 43, -56, 72, -90, 113, -139, 170, -207, 251, -303, 364, -437, 524, -632, 767, -942, 1179, -1521, 2068, -3097, 5768, -29699, -5763, 3095, -2067, 1521, -1179, 942, -767, 632, -524, 437, -364, 303, -251, 207, -170, 139, -113, 90, -72, 56, -43, 33, -25, 18, -13, 9, -6, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 6, -9, 13, -18, 25, -33, 44, -57, 72, -91, 113, -140, 171, -209, 253, -305, 366, -439, 528, -636, 772, -948, 1186, -1530, 2080, -3116, 5806, -30720, -5804, 3115, -2080, 1530, -1186, 948, -772, 636, -528, 439, -366, 304, -253, 209, -171, 140, -113, 91, -72, 57, -44, 33, -25, 18, -13, 9, -6, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 6, -9, 13, -18, 25, -33, 44, -57, 72, -91, 114, -140, 172, -209, 253, -306, 367, -441, 530, -638, 775, -951, 1190, -1536, 2088, -3127, 5829, -31743, -5829, 3127, -2088, 1536, -1190, 951, -775, 638, -530, 441, -367, 306, -253, 209, -172, 140, -114, 91, -72, 57, -44, 33, -25, 18, -13, 9, -6, 3, -2, 1, 0, 0,
+	0, -1, 2, -3, 6, -9, 13, -18, 25, -34, 44, -57, 72, -91, 114, -141, 172, -210, 254, -306, 368, -441, 530, -639, 776, -952, 1192, -1538, 2091, -3131, 5837, -32767, -5837, 3131, -2091, 1538, -1192, 952, -776, 639, -530, 441, -368, 306, -254, 210, -172, 141, -114, 91, -72, 57, -44, 34, -25, 18, -13, 9, -6, 3, -2, 1, 0, 0
+};
+
+// blepd2 table: 4160 entries, times blepd2Scale
+const float blepd2Scale = 1.525925e-05f;
+const int16_t blepd2[] = {
+	0, 0, 1, -2, -7, 3, 17, -6, -36, 9, 65, -15, -112, 21, 180, -31, -279, 43, 415, -61, -607, 84, 874, -123, -1263, 190, 1871, -342, -2979, 816, 5759, -4207, 32767, 4207, -5759, -816, 2979, 342, -1871, -190, 1263, 123, -874, -84, 607, 61, -415, -43, 279, 31, -180, -21, 112, 15, -65, -9, 36, 6, -17, -3, 7, 2, -1, 0,
+	0, 0, 1, -2, -7, 3, 17, -7, -36, 10, 65, -17, -112, 25, 180, -37, -278, 52, 415, -73, -606, 103, 874, -149, -1263, 229, 1871, -401, -2978, 921, 5757, -4534, 32255, 3885, -5757, -711, 2978, 283, -1871, -152, 1263, 97, -874, -66, 606, 48, -415, -35, 278, 26, -180, -18, 112, 13, -65, -8, 36, 6, -17, -3, 7, 2, -1, 0,
+	0, 0, 1, -2, -7, 4, 17, -7, -36, 12, 65, -19, -112, 29, 180, -43, -278, 60, 415, -86, -606, 121, 873, -175, -1262, 267, 1869, -460, -2976, 1026, 5751, -4866, 31743, 3568, -5752, -607, 2976, 224, -1869, -114, 1262, 71, -873, -48, 606, 36, -415, -26, 278, 20, -180, -14, 112, 11, -65, -7, 36, 5, -17, -2, 7, 2, -1, 0,
+	0, 0, 1, -2, -7, 4, 17, -8, -36, 13, 65, -21, -112, 32, 180, -48, -278, 69, 414, -98, -605, 139, 871, -202, -1260, 306, 1866, -520, -2971, 1132, 5741, -5204, 31232, 3256, -5742, -504, 2971, 166, -1866, -76, 1260, 45, -871, -30, 605, 23, -414, -18, 278, 15, -180, -11, 112, 8, -65, -6, 36, 4, -17, -2, 7, 2, -1, 0,
+	0, 0, 1, -2, -7, 4, 17, -9, -36, 14, 65, -24, -112, 36, 179, -54, -277, 77, 413, -111, -604, 157, 869, -228, -1257, 344, 1862, -579, -2964, 1239, 5727, -5546, 30720, 2949, -5729, -402, 2964, 108, -1862, -38, 1257, 19, -870, -13, 604, 11, -413, -10, 277, 9, -179, -7, 112, 6, -65, -4, 36, 4, -17, -2, 7, 2, -1, 0,
+	0, 0, 1, -2, -7, 5, 17, -9, -36, 15, 65, -26, -111, 39, 179, -60, -276, 86, 412, -124, -602, 175, 867, -254, -1253, 383, 1857, -639, -2956, 1346, 5709, -5893, 30209, 2648, -5711, -300, 2956, 50, -1857, -1, 1254, -6, -867, 5, 602, -1, -412, -1, 276, 4, -179, -4, 111, 4, -65, -3, 36, 3, -17, -2, 7, 1, -1, 0,
+	0, 0, 1, -2, -7, 5, 17, -10, -35, 17, 65, -28, -111, 43, 178, -65, -275, 94, 411, -136, -600, 194, 864, -280, -1249, 421, 1850, -699, -2945, 1453, 5686, -6245, 29699, 2352, -5691, -199, 2946, -7, -1851, 36, 1249, -32, -864, 23, 600, -13, -411, 7, 275, -2, -178, 0, 111, 2, -65, -2, 36, 2, -17, -1, 7, 1, -1, 0,
+	0, 0, 1, -3, -7, 5, 16, -11, -35, 18, 64, -30, -111, 47, 177, -71, -274, 103, 409, -149, -597, 212, 861, -307, -1244, 460, 1843, -758, -2932, 1560, 5659, -6602, 29189, 2061, -5667, -99, 2934, -64, -1844, 73, 1245, -57, -861, 40, 598, -25, -409, 15, 274, -7, -177, 3, 111, 0, -64, -1, 35, 2, -16, -1, 7, 1, -1, 0,
+	0, 0, 1, -3, -7, 5, 16, -11, -35, 19, 64, -32, -110, 50, 177, -76, -273, 112, 407, -161, -595, 230, 857, -333, -1238, 498, 1834, -818, -2918, 1668, 5628, -6964, 28680, 1776, -5639, 0, 2921, -120, -1835, 110, 1239, -82, -857, 58, 595, -37, -407, 23, 273, -13, -177, 7, 110, -2, -64, 0, 35, 1, -16, -1, 7, 1, -1, 0,
+	0, 0, 1, -3, -7, 6, 16, -12, -35, 21, 64, -35, -109, 54, 176, -82, -272, 120, 405, -174, -591, 248, 852, -359, -1231, 537, 1824, -878, -2902, 1776, 5592, -7331, 28172, 1496, -5608, 98, 2906, -176, -1826, 147, 1233, -107, -853, 75, 592, -49, -405, 31, 272, -18, -176, 10, 110, -4, -64, 2, 35, 1, -16, -1, 7, 1, -1, 0,
+	0, 0, 1, -3, -6, 6, 16, -13, -35, 22, 63, -37, -109, 57, 174, -88, -270, 129, 402, -186, -588, 266, 847, -385, -1224, 575, 1813, -937, -2883, 1883, 5552, -7702, 27665, 1221, -5573, 194, 2889, -232, -1815, 183, 1225, -132, -848, 92, 589, -61, -403, 40, 270, -23, -175, 13, 109, -6, -63, 3, 35, 0, -16, 0, 6, 1, -1, 0,
+	0, 0, 1, -3, -6, 6, 16, -13, -35, 23, 63, -39, -108, 61, 173, -93, -268, 137, 400, -199, -584, 284, 841, -411, -1216, 614, 1800, -997, -2863, 1991, 5508, -8078, 27158, 952, -5536, 290, 2870, -287, -1804, 219, 1218, -157, -842, 109, 585, -73, -400, 47, 269, -29, -174, 17, 108, -8, -63, 4, 35, -1, -16, 0, 6, 1, -1, 0,
+	0, 0, 1, -3, -6, 7, 16, -14, -34, 24, 62, -41, -107, 65, 172, -99, -266, 145, 397, -211, -579, 302, 835, -437, -1207, 652, 1786, -1056, -2840, 2098, 5458, -8459, 26653, 688, -5495, 385, 2850, -341, -1791, 254, 1209, -181, -837, 126, 581, -85, -397, 55, 267, -34, -172, 20, 108, -10, -63, 5, 34, -1, -16, 0, 6, 1, -1, 0,
+	0, 0, 1, -3, -6, 7, 16, -15, -34, 26, 62, -43, -106, 68, 171, -105, -264, 154, 393, -224, -575, 320, 828, -463, -1197, 690, 1772, -1115, -2816, 2206, 5404, -8844, 26149, 430, -5451, 478, 2828, -395, -1777, 289, 1200, -205, -830, 143, 576, -96, -394, 63, 265, -39, -171, 23, 107, -12, -62, 6, 34, -2, -16, 0, 6, 1, -1, 0,
+	0, 0, 1, -3, -6, 7, 16, -15, -34, 27, 61, -46, -105, 72, 169, -110, -262, 162, 390, -236, -570, 338, 821, -489, -1186, 727, 1756, -1174, -2789, 2313, 5346, -9233, 25647, 177, -5404, 570, 2804, -448, -1763, 324, 1190, -229, -823, 159, 572, -107, -391, 71, 263, -44, -170, 26, 106, -14, -62, 7, 34, -2, -16, 1, 6, 1, -1, 0,
+	0, 0, 1, -3, -6, 7, 15, -16, -33, 28, 61, -48, -104, 75, 167, -116, -259, 171, 386, -248, -564, 356, 813, -514, -1175, 765, 1738, -1232, -2761, 2420, 5283, -9628, 25146, -71, -5354, 661, 2779, -500, -1747, 358, 1180, -252, -816, 176, 567, -119, -388, 78, 260, -49, -168, 30, 105, -16, -61, 8, 34, -3, -16, 1, 6, 1, -1, 0,
+	0, 0, 1, -3, -6, 8, 15, -17, -33, 29, 60, -50, -103, 79, 166, -121, -256, 179, 382, -260, -558, 373, 804, -540, -1162, 802, 1720, -1290, -2730, 2526, 5215, -10026, 24646, -313, -5301, 751, 2753, -552, -1730, 392, 1169, -275, -808, 192, 561, -130, -384, 86, 258, -54, -167, 33, 104, -18, -61, 9, 33, -3, -15, 1, 6, 1, -1, 0,
+	0, 0, 1, -4, -6, 8, 15, -17, -33, 30, 59, -52, -102, 82, 164, -127, -253, 187, 378, -272, -552, 391, 795, -565, -1149, 839, 1700, -1348, -2698, 2632, 5142, -10429, 24148, -550, -5245, 839, 2725, -603, -1713, 425, 1157, -298, -800, 208, 556, -141, -380, 93, 255, -59, -165, 36, 103, -20, -60, 10, 33, -4, -15, 1, 6, 1, -1, 0,
+	0, 0, 1, -4, -6, 8, 15, -18, -32, 32, 59, -54, -101, 86, 162, -132, -250, 195, 373, -284, -546, 408, 786, -590, -1135, 876, 1680, -1405, -2664, 2738, 5064, -10836, 23652, -781, -5187, 926, 2695, -653, -1694, 458, 1144, -321, -792, 223, 550, -151, -376, 101, 252, -64, -163, 39, 102, -22, -59, 11, 33, -4, -15, 2, 6, 0, -1, 0,
+	0, 0, 1, -4, -6, 9, 15, -19, -32, 33, 58, -56, -100, 89, 160, -137, -247, 203, 368, -296, -539, 425, 776, -615, -1121, 913, 1658, -1462, -2627, 2843, 4982, -11247, 23157, -1007, -5126, 1011, 2664, -703, -1675, 491, 1131, -343, -783, 239, 543, -162, -372, 108, 250, -68, -161, 42, 101, -23, -59, 12, 32, -5, -15, 2, 6, 0, -1, 0,
+	0, 0, 1, -4, -6, 9, 14, -19, -31, 34, 57, -58, -98, 93, 157, -143, -244, 211, 363, -308, -531, 442, 765, -639, -1105, 949, 1634, -1519, -2589, 2947, 4894, -11662, 22665, -1227, -5062, 1095, 2632, -752, -1655, 523, 1117, -365, -773, 254, 537, -173, -367, 115, 247, -73, -159, 45, 100, -25, -58, 13, 32, -5, -15, 2, 6, 0, -1, 0,
+	0, 0, 1, -4, -6, 9, 14, -20, -31, 35, 56, -60, -97, 96, 155, -148, -240, 219, 358, -320, -524, 459, 754, -664, -1089, 984, 1610, -1575, -2548, 3051, 4801, -12081, 22175, -1442, -4996, 1177, 2598, -800, -1633, 554, 1103, -387, -763, 269, 530, -183, -363, 122, 243, -78, -157, 48, 98, -27, -57, 14, 31, -6, -15, 2, 6, 0, -1, 0,
+	0, 0, 1, -4, -6, 9, 14, -20, -30, 36, 55, -62, -95, 99, 153, -153, -236, 227, 353, -331, -515, 476, 742, -688, -1072, 1020, 1585, -1630, -2506, 3153, 4704, -12505, 21686, -1651, -4927, 1258, 2563, -847, -1611, 585, 1088, -408, -753, 284, 523, -193, -358, 129, 240, -82, -155, 51, 97, -29, -56, 15, 31, -6, -14, 2, 6, 0, -1, 0,
+	0, 0, 1, -4, -5, 10, 14, -21, -30, 38, 54, -64, -94, 103, 150, -158, -233, 235, 347, -342, -507, 492, 730, -711, -1055, 1055, 1558, -1685, -2461, 3255, 4601, -12932, 21200, -1855, -4856, 1337, 2526, -893, -1589, 616, 1073, -429, -742, 298, 515, -203, -353, 135, 237, -86, -153, 53, 96, -30, -56, 16, 31, -7, -14, 3, 6, 0, -1, 0,
+	0, 0, 1, -4, -5, 10, 13, -22, -29, 39, 53, -66, -92, 106, 147, -163, -228, 242, 341, -354, -498, 508, 718, -735, -1036, 1089, 1530, -1739, -2415, 3356, 4494, -13363, 20716, -2053, -4782, 1415, 2489, -938, -1565, 646, 1057, -449, -731, 312, 508, -213, -348, 142, 233, -91, -151, 56, 94, -32, -55, 17, 30, -7, -14, 3, 6, 0, -1, 0,
+	0, 0, 1, -4, -5, 10, 13, -22, -29, 40, 52, -68, -90, 109, 145, -168, -224, 250, 334, -365, -489, 524, 704, -758, -1017, 1123, 1501, -1792, -2366, 3456, 4381, -13798, 20235, -2246, -4707, 1490, 2450, -983, -1540, 675, 1040, -469, -720, 326, 500, -222, -342, 149, 230, -95, -149, 59, 93, -34, -54, 18, 30, -8, -14, 3, 6, 0, -1, 0,
+	0, 0, 0, -4, -5, 11, 13, -23, -28, 41, 51, -70, -88, 112, 142, -173, -220, 257, 328, -376, -480, 540, 691, -781, -997, 1157, 1471, -1845, -2316, 3555, 4263, -14236, 19756, -2434, -4629, 1565, 2410, -1026, -1515, 704, 1023, -489, -708, 340, 492, -232, -337, 155, 226, -99, -146, 61, 91, -35, -53, 19, 29, -8, -14, 3, 6, 0, -1, 0,
+	0, 1, 0, -5, -5, 11, 13, -23, -27, 42, 50, -72, -86, 115, 139, -178, -215, 265, 321, -386, -470, 556, 676, -803, -976, 1190, 1440, -1897, -2264, 3653, 4139, -14678, 19280, -2616, -4549, 1637, 2368, -1069, -1489, 732, 1005, -508, -696, 353, 483, -241, -331, 161, 222, -103, -144, 64, 90, -37, -52, 20, 29, -9, -13, 3, 5, 0, -1, 0,
+	0, 1, 0, -5, -5, 11, 12, -24, -27, 43, 49, -74, -84, 118, 136, -183, -211, 272, 314, -397, -460, 571, 662, -825, -955, 1223, 1408, -1948, -2209, 3749, 4011, -15124, 18806, -2792, -4467, 1708, 2326, -1111, -1462, 759, 987, -527, -683, 366, 474, -250, -325, 167, 218, -107, -141, 67, 88, -38, -51, 21, 28, -9, -13, 4, 5, 0, -1, 0,
+	0, 1, 0, -5, -5, 11, 12, -25, -26, 44, 48, -76, -82, 121, 132, -188, -206, 279, 307, -407, -449, 586, 647, -847, -933, 1255, 1374, -1999, -2153, 3844, 3877, -15573, 18335, -2963, -4383, 1777, 2282, -1151, -1434, 786, 969, -545, -670, 379, 466, -259, -319, 173, 214, -111, -139, 69, 87, -40, -50, 22, 28, -10, -13, 4, 5, 0, -1, 0,
+	0, 1, 0, -5, -5, 12, 12, -25, -25, 45, 46, -78, -80, 124, 129, -192, -201, 286, 299, -418, -438, 601, 631, -868, -910, 1286, 1340, -2048, -2095, 3938, 3738, -16026, 17867, -3129, -4298, 1844, 2237, -1191, -1406, 812, 949, -563, -657, 391, 456, -267, -312, 179, 210, -115, -136, 71, 85, -41, -49, 22, 27, -10, -13, 4, 5, 0, -1, 0,
+	0, 1, 0, -5, -4, 12, 11, -26, -25, 46, 45, -80, -78, 127, 126, -197, -195, 293, 292, -428, -427, 615, 615, -889, -887, 1317, 1304, -2097, -2035, 4030, 3594, -16481, 17402, -3290, -4210, 1910, 2192, -1230, -1377, 838, 930, -581, -643, 404, 447, -276, -306, 185, 206, -119, -133, 74, 83, -42, -48, 23, 27, -10, -12, 4, 5, 0, -1, 0,
+	0, 1, 0, -5, -4, 12, 11, -26, -24, 47, 44, -82, -76, 130, 122, -201, -190, 300, 284, -437, -415, 629, 598, -910, -862, 1347, 1267, -2145, -1974, 4121, 3444, -16940, 16940, -3444, -4121, 1974, 2145, -1267, -1347, 862, 910, -598, -629, 415, 437, -284, -300, 190, 201, -122, -130, 76, 82, -44, -47, 24, 26, -11, -12, 4, 5, 0, -1, 0,
+	0, 1, 0, -5, -4, 12, 10, -27, -23, 48, 42, -83, -74, 133, 119, -206, -185, 306, 276, -447, -404, 643, 581, -930, -838, 1377, 1230, -2192, -1910, 4210, 3290, -17402, 16481, -3594, -4030, 2035, 2097, -1304, -1317, 887, 889, -615, -615, 427, 428, -292, -293, 195, 197, -126, -127, 78, 80, -45, -46, 25, 26, -11, -12, 4, 5, 0, -1, 0,
+	0, 1, 0, -5, -4, 13, 10, -27, -22, 49, 41, -85, -71, 136, 115, -210, -179, 312, 267, -456, -391, 657, 563, -949, -812, 1406, 1191, -2237, -1844, 4298, 3129, -17867, 16026, -3738, -3938, 2095, 2048, -1340, -1286, 910, 868, -631, -601, 438, 418, -299, -286, 201, 192, -129, -124, 80, 78, -46, -45, 25, 25, -12, -12, 5, 5, 0, -1, 0,
+	0, 1, 0, -5, -4, 13, 10, -28, -22, 50, 40, -87, -69, 139, 111, -214, -173, 319, 259, -466, -379, 670, 545, -969, -786, 1434, 1151, -2282, -1777, 4383, 2963, -18335, 15573, -3877, -3844, 2153, 1999, -1374, -1255, 933, 847, -647, -586, 449, 407, -307, -279, 206, 188, -132, -121, 82, 76, -48, -44, 26, 25, -12, -11, 5, 5, 0, -1, 0,
+	0, 1, 0, -5, -4, 13, 9, -28, -21, 51, 38, -88, -67, 141, 107, -218, -167, 325, 250, -474, -366, 683, 527, -987, -759, 1462, 1111, -2326, -1708, 4467, 2792, -18806, 15124, -4011, -3749, 2209, 1948, -1408, -1223, 955, 825, -662, -571, 460, 397, -314, -272, 211, 183, -136, -118, 84, 74, -49, -43, 27, 24, -12, -11, 5, 5, 0, -1, 0,
+	0, 1, 0, -5, -3, 13, 9, -29, -20, 52, 37, -90, -64, 144, 103, -222, -161, 331, 241, -483, -353, 696, 508, -1005, -732, 1489, 1069, -2368, -1637, 4549, 2616, -19280, 14678, -4139, -3653, 2264, 1897, -1440, -1190, 976, 803, -676, -556, 470, 386, -321, -265, 215, 178, -139, -115, 86, 72, -50, -42, 27, 23, -13, -11, 5, 5, 0, -1, 0,
+	0, 1, 0, -6, -3, 14, 8, -29, -19, 53, 35, -91, -61, 146, 99, -226, -155, 337, 232, -492, -340, 708, 489, -1023, -704, 1515, 1026, -2410, -1565, 4629, 2434, -19756, 14236, -4263, -3555, 2316, 1845, -1471, -1157, 997, 781, -691, -540, 480, 376, -328, -257, 220, 173, -142, -112, 88, 70, -51, -41, 28, 23, -13, -11, 5, 4, 0, 0, 0,
+	0, 1, 0, -6, -3, 14, 8, -30, -18, 54, 34, -93, -59, 149, 95, -230, -149, 342, 222, -500, -326, 720, 469, -1040, -675, 1540, 983, -2450, -1490, 4707, 2246, -20235, 13798, -4381, -3456, 2366, 1792, -1501, -1123, 1017, 758, -704, -524, 489, 365, -334, -250, 224, 168, -145, -109, 90, 68, -52, -40, 29, 22, -13, -10, 5, 4, -1, 0, 0,
+	0, 1, 0, -6, -3, 14, 7, -30, -17, 55, 32, -94, -56, 151, 91, -233, -142, 348, 213, -508, -312, 731, 449, -1057, -646, 1565, 938, -2489, -1415, 4782, 2053, -20716, 13363, -4494, -3356, 2415, 1739, -1530, -1089, 1036, 735, -718, -508, 498, 354, -341, -242, 228, 163, -147, -106, 92, 66, -53, -39, 29, 22, -13, -10, 5, 4, -1, 0, 0,
+	0, 1, 0, -6, -3, 14, 7, -31, -16, 56, 30, -96, -53, 153, 86, -237, -135, 353, 203, -515, -298, 742, 429, -1073, -616, 1589, 893, -2526, -1337, 4856, 1855, -21200, 12932, -4601, -3255, 2461, 1685, -1558, -1055, 1055, 711, -730, -492, 507, 342, -347, -235, 233, 158, -150, -103, 94, 64, -54, -38, 30, 21, -14, -10, 5, 4, -1, 0, 0,
+	0, 1, 0, -6, -2, 14, 6, -31, -15, 56, 29, -97, -51, 155, 82, -240, -129, 358, 193, -523, -284, 753, 408, -1088, -585, 1611, 847, -2563, -1258, 4927, 1651, -21686, 12505, -4704, -3153, 2506, 1630, -1585, -1020, 1072, 688, -742, -476, 515, 331, -353, -227, 236, 153, -153, -99, 95, 62, -55, -36, 30, 20, -14, -9, 6, 4, -1, 0, 0,
+	0, 1, 0, -6, -2, 15, 6, -31, -14, 57, 27, -98, -48, 157, 78, -243, -122, 363, 183, -530, -269, 763, 387, -1103, -554, 1633, 800, -2598, -1177, 4996, 1442, -22175, 12081, -4801, -3051, 2548, 1575, -1610, -984, 1089, 664, -754, -459, 524, 320, -358, -219, 240, 148, -155, -96, 97, 60, -56, -35, 31, 20, -14, -9, 6, 4, -1, 0, 0,
+	0, 1, 0, -6, -2, 15, 5, -32, -13, 58, 25, -100, -45, 159, 73, -247, -115, 367, 173, -537, -254, 773, 365, -1117, -523, 1655, 752, -2632, -1095, 5062, 1227, -22665, 11662, -4894, -2947, 2589, 1519, -1634, -949, 1105, 639, -765, -442, 531, 308, -363, -211, 244, 143, -157, -93, 98, 58, -57, -34, 31, 19, -14, -9, 6, 4, -1, 0, 0,
+	0, 1, 0, -6, -2, 15, 5, -32, -12, 59, 23, -101, -42, 161, 68, -250, -108, 372, 162, -543, -239, 783, 343, -1131, -491, 1675, 703, -2664, -1011, 5126, 1007, -23157, 11247, -4982, -2843, 2627, 1462, -1658, -913, 1121, 615, -776, -425, 539, 296, -368, -203, 247, 137, -160, -89, 100, 56, -58, -33, 32, 19, -15, -9, 6, 4, -1, 0, 0,
+	0, 1, 0, -6, -2, 15, 4, -33, -11, 59, 22, -102, -39, 163, 64, -252, -101, 376, 151, -550, -223, 792, 321, -1144, -458, 1694, 653, -2695, -926, 5187, 781, -23652, 10836, -5064, -2738, 2664, 1405, -1680, -876, 1135, 590, -786, -408, 546, 284, -373, -195, 250, 132, -162, -86, 101, 54, -59, -32, 32, 18, -15, -8, 6, 4, -1, 0, 0,
+	0, 1, -1, -6, -1, 15, 4, -33, -10, 60, 20, -103, -36, 165, 59, -255, -93, 380, 141, -556, -208, 800, 298, -1157, -425, 1713, 603, -2725, -839, 5245, 550, -24148, 10429, -5142, -2632, 2698, 1348, -1700, -839, 1149, 565, -795, -391, 552, 272, -378, -187, 253, 127, -164, -82, 102, 52, -59, -30, 33, 17, -15, -8, 6, 4, -1, 0, 0,
+	0, 1, -1, -6, -1, 15, 3, -33, -9, 61, 18, -104, -33, 167, 54, -258, -86, 384, 130, -561, -192, 808, 275, -1169, -392, 1730, 552, -2753, -751, 5301, 313, -24646, 10026, -5215, -2526, 2730, 1290, -1720, -802, 1162, 540, -804, -373, 558, 260, -382, -179, 256, 121, -166, -79, 103, 50, -60, -29, 33, 17, -15, -8, 6, 3, -1, 0, 0,
+	0, 1, -1, -6, -1, 16, 3, -34, -8, 61, 16, -105, -30, 168, 49, -260, -78, 388, 119, -567, -176, 816, 252, -1180, -358, 1747, 500, -2779, -661, 5354, 71, -25146, 9628, -5283, -2420, 2761, 1232, -1738, -765, 1175, 514, -813, -356, 564, 248, -386, -171, 259, 116, -167, -75, 104, 48, -61, -28, 33, 16, -15, -7, 6, 3, -1, 0, 0,
+	0, 1, -1, -6, -1, 16, 2, -34, -7, 62, 14, -106, -26, 170, 44, -263, -71, 391, 107, -572, -159, 823, 229, -1190, -324, 1763, 448, -2804, -570, 5404, -177, -25647, 9233, -5346, -2313, 2789, 1174, -1756, -727, 1186, 489, -821, -338, 570, 236, -390, -162, 262, 110, -169, -72, 105, 46, -61, -27, 34, 15, -16, -7, 6, 3, -1, 0, 0,
+	0, 1, -1, -6, 0, 16, 2, -34, -6, 62, 12, -107, -23, 171, 39, -265, -63, 394, 96, -576, -143, 830, 205, -1200, -289, 1777, 395, -2828, -478, 5451, -430, -26149, 8844, -5404, -2206, 2816, 1115, -1772, -690, 1197, 463, -828, -320, 575, 224, -393, -154, 264, 105, -171, -68, 106, 43, -62, -26, 34, 15, -16, -7, 6, 3, -1, 0, 0,
+	0, 1, -1, -6, 0, 16, 1, -34, -5, 63, 10, -108, -20, 172, 34, -267, -55, 397, 85, -581, -126, 837, 181, -1209, -254, 1791, 341, -2850, -385, 5495, -688, -26653, 8459, -5458, -2098, 2840, 1056, -1786, -652, 1207, 437, -835, -302, 579, 211, -397, -145, 266, 99, -172, -65, 107, 41, -62, -24, 34, 14, -16, -7, 6, 3, -1, 0, 0,
+	0, 1, -1, -6, 0, 16, 1, -35, -4, 63, 8, -108, -17, 174, 29, -269, -47, 400, 73, -585, -109, 842, 157, -1218, -219, 1804, 287, -2870, -290, 5536, -952, -27158, 8078, -5508, -1991, 2863, 997, -1800, -614, 1216, 411, -841, -284, 584, 199, -400, -137, 268, 93, -173, -61, 108, 39, -63, -23, 35, 13, -16, -6, 6, 3, -1, 0, 0,
+	0, 1, -1, -6, 0, 16, 0, -35, -3, 63, 6, -109, -13, 175, 23, -270, -40, 403, 61, -589, -92, 848, 132, -1225, -183, 1815, 232, -2889, -194, 5573, -1221, -27665, 7702, -5552, -1883, 2883, 937, -1813, -575, 1224, 385, -847, -266, 588, 186, -402, -129, 270, 88, -174, -57, 109, 37, -63, -22, 35, 13, -16, -6, 6, 3, -1, 0, 0,
+	0, 1, -1, -7, 1, 16, -1, -35, -2, 64, 4, -110, -10, 176, 18, -272, -31, 405, 49, -592, -75, 853, 107, -1233, -147, 1826, 176, -2906, -98, 5608, -1496, -28172, 7331, -5592, -1776, 2902, 878, -1824, -537, 1231, 359, -852, -248, 591, 174, -405, -120, 272, 82, -176, -54, 109, 35, -64, -21, 35, 12, -16, -6, 7, 3, -1, 0, 0,
+	0, 1, -1, -7, 1, 16, -1, -35, 0, 64, 2, -110, -7, 177, 13, -273, -23, 407, 37, -595, -58, 857, 82, -1239, -110, 1835, 120, -2921, 0, 5639, -1776, -28680, 6964, -5628, -1668, 2918, 818, -1834, -498, 1238, 333, -857, -230, 595, 161, -407, -112, 273, 76, -177, -50, 110, 32, -64, -19, 35, 11, -16, -5, 7, 3, -1, 0, 0,
+	0, 1, -1, -7, 1, 16, -2, -35, 1, 64, 0, -111, -3, 177, 7, -274, -15, 409, 25, -598, -40, 861, 57, -1245, -73, 1844, 64, -2934, 99, 5667, -2061, -29189, 6602, -5659, -1560, 2932, 758, -1843, -460, 1244, 307, -861, -212, 597, 149, -409, -103, 274, 71, -177, -47, 111, 30, -64, -18, 35, 11, -16, -5, 7, 3, -1, 0, 0,
+	0, 1, -1, -7, 1, 17, -2, -36, 2, 65, -2, -111, 0, 178, 2, -275, -7, 411, 13, -600, -23, 864, 32, -1249, -36, 1851, 7, -2946, 199, 5691, -2352, -29699, 6245, -5686, -1453, 2945, 699, -1850, -421, 1249, 280, -864, -194, 600, 136, -411, -94, 275, 65, -178, -43, 111, 28, -65, -17, 35, 10, -17, -5, 7, 2, -1, 0, 0,
+	0, 1, -1, -7, 2, 17, -3, -36, 3, 65, -4, -111, 4, 179, -4, -276, 1, 412, 1, -602, -5, 867, 6, -1254, 1, 1857, -50, -2956, 300, 5711, -2648, -30209, 5893, -5709, -1346, 2956, 639, -1857, -383, 1253, 254, -867, -175, 602, 124, -412, -86, 276, 60, -179, -39, 111, 26, -65, -15, 36, 9, -17, -5, 7, 2, -1, 0, 0,
+	0, 1, -2, -7, 2, 17, -4, -36, 4, 65, -6, -112, 7, 179, -9, -277, 10, 413, -11, -604, 13, 870, -19, -1257, 38, 1862, -108, -2964, 402, 5729, -2949, -30720, 5546, -5727, -1239, 2964, 579, -1862, -344, 1257, 228, -869, -157, 604, 111, -413, -77, 277, 54, -179, -36, 112, 24, -65, -14, 36, 9, -17, -4, 7, 2, -1, 0, 0,
+	0, 1, -2, -7, 2, 17, -4, -36, 6, 65, -8, -112, 11, 180, -15, -278, 18, 414, -23, -605, 30, 871, -45, -1260, 76, 1866, -166, -2971, 504, 5742, -3256, -31232, 5204, -5741, -1132, 2971, 520, -1866, -306, 1260, 202, -871, -139, 605, 98, -414, -69, 278, 48, -180, -32, 112, 21, -65, -13, 36, 8, -17, -4, 7, 2, -1, 0, 0,
+	0, 1, -2, -7, 2, 17, -5, -36, 7, 65, -11, -112, 14, 180, -20, -278, 26, 415, -36, -606, 48, 873, -71, -1262, 114, 1869, -224, -2976, 607, 5752, -3568, -31743, 4866, -5751, -1026, 2976, 460, -1869, -267, 1262, 175, -873, -121, 606, 86, -415, -60, 278, 43, -180, -29, 112, 19, -65, -12, 36, 7, -17, -4, 7, 2, -1, 0, 0,
+	0, 1, -2, -7, 3, 17, -6, -36, 8, 65, -13, -112, 18, 180, -26, -278, 35, 415, -48, -606, 66, 874, -97, -1263, 152, 1871, -283, -2978, 711, 5757, -3885, -32255, 4534, -5757, -921, 2978, 401, -1871, -229, 1263, 149, -874, -103, 606, 73, -415, -52, 278, 37, -180, -25, 112, 17, -65, -10, 36, 7, -17, -3, 7, 2, -1, 0, 0,
+	0, 1, -2, -7, 3, 17, -6, -36, 9, 65, -15, -112, 21, 180, -31, -279, 43, 415, -61, -607, 84, 874, -123, -1263, 190, 1871, -342, -2979, 816, 5759, -4207, -32767, 4207, -5759, -816, 2979, 342, -1871, -190, 1263, 123, -874, -84, 607, 61, -415, -43, 279, 31, -180, -21, 112, 15, -65, -9, 36, 6, -17, -3, 7, 2, -1, 0, 0
+};
+
+// blamp table: 4160 entries, times blampScale
+const float blampScale = 9.676351e-08f;
+const int16_t blamp[] = {
+	0, 0, -1, 1, -3, 2, -5, 3, -7, 6, -11, 10, -16, 15, -23, 22, -32, 31, -44, 44, -60, 63, -84, 93, -124, 148, -205, 272, -417, 679, -1370, 3842, -32767, 3842, -1370, 679, -417, 272, -205, 148, -124, 93, -84, 63, -60, 44, -44, 31, -32, 22, -23, 15, -16, 10, -11, 6, -7, 3, -5, 2, -3, 1, -1, 0,
+	0, 0, -1, 1, -3, 2, -5, 4, -9, 8, -14, 13, -21, 20, -30, 31, -43, 44, -60, 64, -83, 91, -118, 134, -174, 207, -278, 363, -535, 840, -1611, 4291, -30283, 3392, -1129, 518, -298, 180, -131, 88, -75, 52, -50, 35, -36, 25, -28, 18, -21, 13, -16, 9, -12, 6, -9, 4, -6, 2, -4, 1, -2, 1, -1, 0,
+	0, 0, -1, 1, -3, 3, -6, 5, -10, 10, -16, 16, -25, 26, -37, 39, -53, 58, -76, 83, -107, 120, -152, 175, -223, 267, -351, 455, -653, 1001, -1851, 4739, -27878, 2944, -888, 358, -180, 89, -58, 28, -26, 12, -16, 7, -13, 5, -11, 5, -10, 4, -9, 4, -8, 3, -6, 2, -5, 1, -3, 1, -2, 0, -1, 0,
+	0, 0, -1, 1, -3, 3, -7, 6, -12, 12, -19, 20, -29, 31, -44, 48, -64, 71, -92, 103, -130, 148, -186, 215, -271, 326, -424, 546, -770, 1160, -2090, 5184, -25552, 2499, -649, 198, -63, -2, 14, -31, 23, -29, 17, -21, 10, -14, 5, -8, 0, -4, -2, -2, -3, -1, -3, 0, -3, 0, -3, 0, -2, 0, -1, 0,
+	0, 0, -1, 1, -4, 3, -7, 7, -13, 14, -21, 23, -34, 37, -51, 57, -75, 84, -108, 122, -154, 176, -219, 255, -320, 385, -496, 636, -887, 1319, -2327, 5625, -23305, 2057, -412, 40, 54, -93, 87, -90, 71, -69, 51, -49, 34, -33, 21, -21, 11, -13, 5, -7, 1, -4, -1, -2, -2, -1, -2, 0, -2, 0, -1, 0,
+	0, 0, -1, 1, -4, 4, -8, 8, -14, 15, -24, 26, -38, 42, -58, 65, -85, 97, -124, 141, -177, 203, -252, 295, -368, 443, -568, 726, -1003, 1476, -2562, 6062, -21135, 1619, -177, -118, 169, -182, 158, -148, 119, -109, 84, -77, 57, -52, 36, -34, 22, -22, 12, -13, 5, -7, 2, -4, 0, -2, -1, 0, -1, 0, -1, 0,
+	0, 0, -2, 2, -4, 4, -9, 9, -16, 17, -26, 30, -42, 48, -65, 74, -96, 110, -139, 160, -199, 231, -285, 334, -415, 501, -638, 814, -1116, 1630, -2794, 6491, -19044, 1187, 56, -273, 284, -271, 229, -205, 167, -148, 117, -104, 79, -71, 52, -47, 32, -30, 19, -18, 10, -10, 4, -5, 1, -2, -1, -1, -1, 0, -1, 0,
+	0, 0, -2, 2, -4, 5, -9, 10, -17, 19, -29, 33, -46, 53, -71, 82, -106, 122, -154, 178, -222, 257, -317, 373, -462, 557, -708, 901, -1229, 1783, -3022, 6913, -17031, 762, 284, -425, 396, -358, 299, -262, 213, -187, 149, -131, 102, -90, 67, -60, 42, -38, 25, -24, 14, -14, 7, -7, 2, -3, 0, -1, -1, 0, -1, 0,
+	0, 0, -2, 2, -5, 5, -10, 11, -18, 21, -31, 36, -50, 58, -78, 90, -116, 135, -169, 197, -244, 284, -349, 411, -508, 613, -776, 987, -1339, 1932, -3245, 7325, -15094, 344, 509, -576, 506, -444, 367, -318, 259, -225, 181, -158, 124, -108, 82, -72, 53, -47, 32, -29, 18, -17, 9, -9, 4, -4, 1, -2, -1, 0, -1, 0,
+	0, 0, -2, 2, -5, 6, -11, 12, -20, 23, -34, 39, -54, 63, -84, 98, -126, 147, -184, 214, -265, 310, -380, 448, -553, 667, -843, 1070, -1447, 2079, -3463, 7726, -13235, -65, 730, -723, 615, -528, 434, -373, 304, -263, 212, -183, 145, -126, 97, -84, 62, -55, 38, -34, 22, -20, 11, -11, 5, -5, 1, -2, 0, 0, -1, 0,
+	0, 0, -2, 2, -5, 6, -11, 13, -21, 24, -36, 42, -58, 68, -90, 106, -136, 158, -199, 232, -286, 335, -410, 485, -597, 721, -908, 1152, -1552, 2222, -3676, 8115, -11452, -465, 945, -867, 721, -610, 500, -426, 348, -299, 242, -209, 166, -143, 111, -96, 72, -62, 45, -39, 26, -23, 14, -13, 6, -6, 2, -2, 0, -1, -1, 0,
+	0, 0, -2, 2, -5, 6, -12, 14, -22, 26, -38, 45, -62, 73, -97, 113, -145, 170, -213, 249, -306, 359, -440, 520, -639, 772, -972, 1231, -1654, 2360, -3883, 8490, -9744, -854, 1155, -1007, 824, -690, 564, -478, 391, -335, 272, -233, 187, -160, 126, -108, 82, -70, 51, -44, 30, -26, 16, -14, 7, -7, 3, -3, 0, -1, -1, 0,
+	0, 0, -2, 2, -6, 7, -12, 15, -23, 28, -40, 48, -66, 78, -102, 121, -154, 181, -226, 265, -326, 383, -468, 554, -681, 823, -1033, 1308, -1753, 2495, -4082, 8849, -8112, -1233, 1360, -1144, 924, -767, 626, -529, 433, -369, 301, -257, 207, -177, 139, -119, 91, -77, 57, -48, 33, -29, 18, -16, 9, -8, 3, -3, 0, -1, 0, 0,
+	0, 0, -2, 2, -6, 7, -13, 15, -24, 29, -42, 51, -69, 82, -108, 128, -163, 192, -239, 281, -345, 406, -496, 588, -721, 871, -1093, 1382, -1849, 2624, -4274, 9191, -6554, -1600, 1558, -1276, 1022, -843, 686, -578, 473, -403, 329, -281, 226, -193, 153, -130, 100, -85, 62, -53, 37, -32, 20, -17, 10, -9, 4, -4, 1, -1, 0, 0,
+	0, 0, -2, 2, -6, 7, -13, 16, -26, 31, -44, 53, -73, 87, -114, 135, -171, 202, -252, 296, -364, 428, -522, 620, -759, 918, -1150, 1454, -1941, 2748, -4457, 9515, -5069, -1955, 1749, -1404, 1116, -916, 744, -625, 512, -435, 356, -303, 245, -209, 165, -140, 108, -92, 68, -57, 40, -34, 22, -19, 11, -9, 4, -4, 1, -1, 0, 0,
+	0, 0, -2, 3, -6, 8, -14, 17, -27, 32, -46, 56, -76, 91, -119, 141, -180, 212, -264, 311, -381, 449, -548, 650, -796, 962, -1205, 1522, -2029, 2867, -4632, 9818, -3658, -2297, 1933, -1527, 1206, -986, 800, -671, 550, -466, 382, -325, 263, -223, 178, -151, 117, -98, 73, -62, 44, -37, 24, -20, 12, -10, 5, -4, 1, -1, 0, 0,
+	0, 0, -2, 3, -6, 8, -14, 18, -28, 33, -48, 58, -79, 95, -124, 147, -187, 222, -276, 325, -398, 470, -572, 679, -831, 1005, -1257, 1587, -2113, 2980, -4798, 10099, -2318, -2625, 2110, -1645, 1293, -1053, 854, -714, 586, -496, 406, -345, 280, -238, 189, -160, 124, -105, 79, -66, 47, -39, 26, -22, 13, -11, 5, -5, 1, -1, 0, 0,
+	0, 0, -2, 3, -7, 8, -15, 18, -28, 35, -50, 60, -82, 99, -129, 153, -195, 231, -286, 338, -414, 489, -595, 707, -864, 1045, -1306, 1649, -2192, 3086, -4953, 10356, -1049, -2939, 2280, -1758, 1376, -1117, 905, -756, 620, -525, 430, -365, 297, -251, 201, -169, 132, -111, 83, -70, 50, -42, 28, -23, 14, -12, 6, -5, 1, -1, 0, 0,
+	0, 0, -2, 3, -7, 9, -15, 19, -29, 36, -52, 63, -85, 102, -133, 159, -202, 239, -297, 351, -429, 507, -617, 733, -896, 1084, -1353, 1707, -2267, 3186, -5098, 10589, 150, -3239, 2441, -1865, 1455, -1178, 954, -796, 653, -552, 453, -384, 312, -264, 211, -178, 139, -117, 88, -73, 53, -44, 30, -24, 15, -12, 6, -5, 2, -1, 0, 0,
+	0, 0, -2, 3, -7, 9, -16, 19, -30, 37, -53, 65, -87, 105, -137, 164, -208, 247, -306, 362, -443, 524, -637, 758, -925, 1119, -1397, 1762, -2336, 3280, -5231, 10794, 1280, -3523, 2594, -1967, 1529, -1236, 1000, -833, 684, -577, 474, -402, 327, -277, 222, -187, 146, -122, 93, -77, 56, -46, 31, -26, 16, -13, 7, -5, 2, -1, 0, 0,
+	0, 0, -2, 3, -7, 9, -16, 20, -31, 38, -54, 66, -90, 108, -141, 169, -214, 254, -315, 373, -457, 540, -656, 780, -953, 1152, -1437, 1812, -2401, 3365, -5353, 10971, 2342, -3792, 2738, -2063, 1599, -1290, 1043, -868, 713, -601, 494, -418, 341, -288, 231, -194, 152, -127, 97, -80, 58, -48, 33, -27, 17, -14, 7, -6, 2, -2, 0, 0,
+	0, 0, -2, 3, -7, 9, -16, 20, -32, 39, -56, 68, -92, 111, -145, 174, -220, 261, -324, 383, -469, 554, -674, 801, -978, 1183, -1475, 1859, -2460, 3444, -5463, 11117, 3338, -4046, 2873, -2153, 1665, -1341, 1084, -901, 740, -624, 513, -434, 354, -299, 240, -202, 158, -132, 101, -83, 61, -50, 34, -28, 17, -14, 7, -6, 2, -2, 0, 0,
+	0, 0, -2, 3, -7, 9, -17, 21, -32, 40, -57, 70, -94, 114, -148, 178, -225, 267, -331, 392, -480, 568, -690, 821, -1001, 1211, -1509, 1901, -2513, 3514, -5560, 11231, 4267, -4283, 3000, -2236, 1726, -1388, 1121, -932, 765, -645, 530, -448, 366, -309, 248, -209, 164, -137, 104, -86, 63, -52, 36, -29, 18, -15, 8, -6, 2, -2, 0, 0,
+	0, 0, -2, 3, -7, 10, -17, 21, -33, 41, -58, 71, -96, 116, -151, 181, -229, 273, -338, 401, -490, 580, -704, 838, -1022, 1236, -1540, 1939, -2561, 3576, -5644, 11312, 5133, -4504, 3117, -2314, 1783, -1431, 1156, -960, 788, -664, 546, -462, 377, -318, 256, -215, 169, -141, 108, -89, 65, -53, 37, -30, 19, -15, 8, -6, 2, -2, 0, 0,
+	0, 0, -2, 3, -7, 10, -17, 22, -33, 41, -59, 72, -98, 118, -154, 185, -233, 278, -344, 408, -499, 590, -717, 853, -1040, 1258, -1567, 1972, -2603, 3630, -5714, 11357, 5935, -4708, 3225, -2384, 1834, -1471, 1187, -986, 809, -681, 561, -474, 387, -327, 263, -221, 174, -145, 111, -91, 67, -55, 38, -31, 19, -16, 8, -7, 2, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -17, 22, -34, 42, -60, 73, -99, 120, -156, 187, -237, 282, -350, 414, -506, 600, -728, 866, -1056, 1278, -1590, 2001, -2639, 3676, -5770, 11366, 6676, -4896, 3323, -2449, 1881, -1507, 1216, -1009, 828, -697, 574, -485, 396, -334, 269, -226, 178, -148, 113, -93, 69, -56, 39, -31, 20, -16, 9, -7, 3, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -18, 22, -34, 42, -60, 74, -100, 122, -158, 190, -240, 286, -354, 420, -513, 607, -738, 878, -1070, 1294, -1610, 2025, -2669, 3712, -5811, 11335, 7356, -5066, 3412, -2506, 1923, -1539, 1241, -1029, 845, -711, 585, -495, 404, -341, 275, -230, 182, -151, 116, -95, 70, -57, 40, -32, 21, -16, 9, -7, 3, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -18, 22, -34, 43, -61, 75, -101, 123, -159, 192, -242, 289, -358, 424, -518, 614, -745, 887, -1081, 1307, -1626, 2044, -2692, 3740, -5838, 11265, 7977, -5220, 3491, -2557, 1959, -1567, 1264, -1047, 860, -723, 596, -503, 411, -347, 280, -234, 185, -154, 118, -97, 72, -58, 41, -33, 21, -17, 9, -7, 3, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -18, 22, -35, 43, -61, 75, -102, 124, -161, 193, -244, 291, -360, 428, -522, 619, -751, 894, -1089, 1317, -1638, 2059, -2709, 3758, -5849, 11152, 8541, -5357, 3560, -2601, 1991, -1591, 1282, -1063, 873, -734, 604, -510, 417, -352, 284, -238, 188, -156, 120, -99, 73, -59, 41, -33, 21, -17, 9, -7, 3, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -18, 23, -35, 43, -62, 76, -102, 124, -161, 194, -245, 293, -362, 430, -525, 622, -755, 899, -1095, 1324, -1646, 2068, -2719, 3767, -5845, 10995, 9048, -5477, 3619, -2639, 2017, -1611, 1298, -1075, 883, -742, 611, -516, 422, -356, 287, -241, 190, -158, 121, -100, 74, -60, 42, -34, 22, -17, 10, -7, 3, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -18, 23, -35, 43, -62, 76, -102, 125, -162, 195, -246, 294, -363, 431, -527, 624, -758, 902, -1099, 1328, -1650, 2072, -2723, 3767, -5824, 10793, 9500, -5580, 3668, -2669, 2039, -1627, 1311, -1085, 891, -749, 617, -521, 426, -359, 290, -243, 192, -160, 123, -101, 75, -61, 43, -34, 22, -17, 10, -7, 3, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -18, 23, -35, 43, -62, 76, -102, 125, -162, 195, -246, 294, -364, 432, -527, 625, -758, 903, -1099, 1329, -1650, 2072, -2719, 3757, -5788, 10544, 9899, -5666, 3707, -2693, 2055, -1639, 1320, -1093, 897, -754, 621, -524, 429, -362, 292, -244, 193, -161, 124, -102, 75, -61, 43, -34, 22, -18, 10, -7, 3, -2, 0, 0,
+	0, 0, -2, 3, -8, 10, -18, 22, -35, 43, -61, 76, -102, 124, -161, 194, -246, 293, -363, 431, -526, 624, -757, 901, -1097, 1326, -1647, 2066, -2710, 3737, -5735, 10247, 10247, -5735, 3737, -2710, 2066, -1647, 1326, -1097, 901, -757, 624, -526, 431, -363, 293, -246, 194, -161, 124, -102, 76, -61, 43, -35, 22, -18, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 3, -7, 10, -18, 22, -34, 43, -61, 75, -102, 124, -161, 193, -244, 292, -362, 429, -524, 621, -754, 897, -1093, 1320, -1639, 2055, -2693, 3707, -5666, 9899, 10544, -5788, 3757, -2719, 2072, -1650, 1329, -1099, 903, -758, 625, -527, 432, -364, 294, -246, 195, -162, 125, -102, 76, -62, 43, -35, 23, -18, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 3, -7, 10, -17, 22, -34, 43, -61, 75, -101, 123, -160, 192, -243, 290, -359, 426, -521, 617, -749, 891, -1085, 1311, -1627, 2039, -2669, 3668, -5580, 9500, 10793, -5824, 3767, -2723, 2072, -1650, 1328, -1099, 902, -758, 624, -527, 431, -363, 294, -246, 195, -162, 125, -102, 76, -62, 43, -35, 23, -18, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 3, -7, 10, -17, 22, -34, 42, -60, 74, -100, 121, -158, 190, -241, 287, -356, 422, -516, 611, -742, 883, -1075, 1298, -1611, 2017, -2639, 3619, -5477, 9048, 10995, -5845, 3767, -2719, 2068, -1646, 1324, -1095, 899, -755, 622, -525, 430, -362, 293, -245, 194, -161, 124, -102, 76, -62, 43, -35, 23, -18, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 3, -7, 9, -17, 21, -33, 41, -59, 73, -99, 120, -156, 188, -238, 284, -352, 417, -510, 604, -734, 873, -1063, 1282, -1591, 1991, -2601, 3560, -5357, 8541, 11152, -5849, 3758, -2709, 2059, -1638, 1317, -1089, 894, -751, 619, -522, 428, -360, 291, -244, 193, -161, 124, -102, 75, -61, 43, -35, 22, -18, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 3, -7, 9, -17, 21, -33, 41, -58, 72, -97, 118, -154, 185, -234, 280, -347, 411, -503, 596, -723, 860, -1047, 1264, -1567, 1959, -2557, 3491, -5220, 7977, 11265, -5838, 3740, -2692, 2044, -1626, 1307, -1081, 887, -745, 614, -518, 424, -358, 289, -242, 192, -159, 123, -101, 75, -61, 43, -34, 22, -18, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 3, -7, 9, -16, 21, -32, 40, -57, 70, -95, 116, -151, 182, -230, 275, -341, 404, -495, 585, -711, 845, -1029, 1241, -1539, 1923, -2506, 3412, -5066, 7356, 11335, -5811, 3712, -2669, 2025, -1610, 1294, -1070, 878, -738, 607, -513, 420, -354, 286, -240, 190, -158, 122, -100, 74, -60, 42, -34, 22, -18, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 3, -7, 9, -16, 20, -31, 39, -56, 69, -93, 113, -148, 178, -226, 269, -334, 396, -485, 574, -697, 828, -1009, 1216, -1507, 1881, -2449, 3323, -4896, 6676, 11366, -5770, 3676, -2639, 2001, -1590, 1278, -1056, 866, -728, 600, -506, 414, -350, 282, -237, 187, -156, 120, -99, 73, -60, 42, -34, 22, -17, 10, -8, 3, -2, 0, 0,
+	0, 0, -2, 2, -7, 8, -16, 19, -31, 38, -55, 67, -91, 111, -145, 174, -221, 263, -327, 387, -474, 561, -681, 809, -986, 1187, -1471, 1834, -2384, 3225, -4708, 5935, 11357, -5714, 3630, -2603, 1972, -1567, 1258, -1040, 853, -717, 590, -499, 408, -344, 278, -233, 185, -154, 118, -98, 72, -59, 41, -33, 22, -17, 10, -7, 3, -2, 0, 0,
+	0, 0, -2, 2, -6, 8, -15, 19, -30, 37, -53, 65, -89, 108, -141, 169, -215, 256, -318, 377, -462, 546, -664, 788, -960, 1156, -1431, 1783, -2314, 3117, -4504, 5133, 11312, -5644, 3576, -2561, 1939, -1540, 1236, -1022, 838, -704, 580, -490, 401, -338, 273, -229, 181, -151, 116, -96, 71, -58, 41, -33, 21, -17, 10, -7, 3, -2, 0, 0,
+	0, 0, -2, 2, -6, 8, -15, 18, -29, 36, -52, 63, -86, 104, -137, 164, -209, 248, -309, 366, -448, 530, -645, 765, -932, 1121, -1388, 1726, -2236, 3000, -4283, 4267, 11231, -5560, 3514, -2513, 1901, -1509, 1211, -1001, 821, -690, 568, -480, 392, -331, 267, -225, 178, -148, 114, -94, 70, -57, 40, -32, 21, -17, 9, -7, 3, -2, 0, 0,
+	0, 0, -2, 2, -6, 7, -14, 17, -28, 34, -50, 61, -83, 101, -132, 158, -202, 240, -299, 354, -434, 513, -624, 740, -901, 1084, -1341, 1665, -2153, 2873, -4046, 3338, 11117, -5463, 3444, -2460, 1859, -1475, 1183, -978, 801, -674, 554, -469, 383, -324, 261, -220, 174, -145, 111, -92, 68, -56, 39, -32, 20, -16, 9, -7, 3, -2, 0, 0,
+	0, 0, -2, 2, -6, 7, -14, 17, -27, 33, -48, 58, -80, 97, -127, 152, -194, 231, -288, 341, -418, 494, -601, 713, -868, 1043, -1290, 1599, -2063, 2738, -3792, 2342, 10971, -5353, 3365, -2401, 1812, -1437, 1152, -953, 780, -656, 540, -457, 373, -315, 254, -214, 169, -141, 108, -90, 66, -54, 38, -31, 20, -16, 9, -7, 3, -2, 0, 0,
+	0, 0, -1, 2, -5, 7, -13, 16, -26, 31, -46, 56, -77, 93, -122, 146, -187, 222, -277, 327, -402, 474, -577, 684, -833, 1000, -1236, 1529, -1967, 2594, -3523, 1280, 10794, -5231, 3280, -2336, 1762, -1397, 1119, -925, 758, -637, 524, -443, 362, -306, 247, -208, 164, -137, 105, -87, 65, -53, 37, -30, 19, -16, 9, -7, 3, -2, 0, 0,
+	0, 0, -1, 2, -5, 6, -12, 15, -24, 30, -44, 53, -73, 88, -117, 139, -178, 211, -264, 312, -384, 453, -552, 653, -796, 954, -1178, 1455, -1865, 2441, -3239, 150, 10589, -5098, 3186, -2267, 1707, -1353, 1084, -896, 733, -617, 507, -429, 351, -297, 239, -202, 159, -133, 102, -85, 63, -52, 36, -29, 19, -15, 9, -7, 3, -2, 0, 0,
+	0, 0, -1, 1, -5, 6, -12, 14, -23, 28, -42, 50, -70, 83, -111, 132, -169, 201, -251, 297, -365, 430, -525, 620, -756, 905, -1117, 1376, -1758, 2280, -2939, -1049, 10356, -4953, 3086, -2192, 1649, -1306, 1045, -864, 707, -595, 489, -414, 338, -286, 231, -195, 153, -129, 99, -82, 60, -50, 35, -28, 18, -15, 8, -7, 3, -2, 0, 0,
+	0, 0, -1, 1, -5, 5, -11, 13, -22, 26, -39, 47, -66, 79, -105, 124, -160, 189, -238, 280, -345, 406, -496, 586, -714, 854, -1053, 1293, -1645, 2110, -2625, -2318, 10099, -4798, 2980, -2113, 1587, -1257, 1005, -831, 679, -572, 470, -398, 325, -276, 222, -187, 147, -124, 95, -79, 58, -48, 33, -28, 18, -14, 8, -6, 3, -2, 0, 0,
+	0, 0, -1, 1, -4, 5, -10, 12, -20, 24, -37, 44, -62, 73, -98, 117, -151, 178, -223, 263, -325, 382, -466, 550, -671, 800, -986, 1206, -1527, 1933, -2297, -3658, 9818, -4632, 2867, -2029, 1522, -1205, 962, -796, 650, -548, 449, -381, 311, -264, 212, -180, 141, -119, 91, -76, 56, -46, 32, -27, 17, -14, 8, -6, 3, -2, 0, 0,
+	0, 0, -1, 1, -4, 4, -9, 11, -19, 22, -34, 40, -57, 68, -92, 108, -140, 165, -209, 245, -303, 356, -435, 512, -625, 744, -916, 1116, -1404, 1749, -1955, -5069, 9515, -4457, 2748, -1941, 1454, -1150, 918, -759, 620, -522, 428, -364, 296, -252, 202, -171, 135, -114, 87, -73, 53, -44, 31, -26, 16, -13, 7, -6, 2, -2, 0, 0,
+	0, 0, -1, 1, -4, 4, -9, 10, -17, 20, -32, 37, -53, 62, -85, 100, -130, 153, -193, 226, -281, 329, -403, 473, -578, 686, -843, 1022, -1276, 1558, -1600, -6554, 9191, -4274, 2624, -1849, 1382, -1093, 871, -721, 588, -496, 406, -345, 281, -239, 192, -163, 128, -108, 82, -69, 51, -42, 29, -24, 15, -13, 7, -6, 2, -2, 0, 0,
+	0, 0, -1, 0, -3, 3, -8, 9, -16, 18, -29, 33, -48, 57, -77, 91, -119, 139, -177, 207, -257, 301, -369, 433, -529, 626, -767, 924, -1144, 1360, -1233, -8112, 8849, -4082, 2495, -1753, 1308, -1033, 823, -681, 554, -468, 383, -326, 265, -226, 181, -154, 121, -102, 78, -66, 48, -40, 28, -23, 15, -12, 7, -6, 2, -2, 0, 0,
+	0, -1, -1, 0, -3, 3, -7, 7, -14, 16, -26, 30, -44, 51, -70, 82, -108, 126, -160, 187, -233, 272, -335, 391, -478, 564, -690, 824, -1007, 1155, -854, -9744, 8490, -3883, 2360, -1654, 1231, -972, 772, -639, 520, -440, 359, -306, 249, -213, 170, -145, 113, -97, 73, -62, 45, -38, 26, -22, 14, -12, 6, -5, 2, -2, 0, 0,
+	0, -1, -1, 0, -2, 2, -6, 6, -13, 14, -23, 26, -39, 45, -62, 72, -96, 111, -143, 166, -209, 242, -299, 348, -426, 500, -610, 721, -867, 945, -465, -11452, 8115, -3676, 2222, -1552, 1152, -908, 721, -597, 485, -410, 335, -286, 232, -199, 158, -136, 106, -90, 68, -58, 42, -36, 24, -21, 13, -11, 6, -5, 2, -2, 0, 0,
+	0, -1, 0, 0, -2, 1, -5, 5, -11, 11, -20, 22, -34, 38, -55, 62, -84, 97, -126, 145, -183, 212, -263, 304, -373, 434, -528, 615, -723, 730, -65, -13235, 7726, -3463, 2079, -1447, 1070, -843, 667, -553, 448, -380, 310, -265, 214, -184, 147, -126, 98, -84, 63, -54, 39, -34, 23, -20, 12, -11, 6, -5, 2, -2, 0, 0,
+	0, -1, 0, -1, -2, 1, -4, 4, -9, 9, -17, 18, -29, 32, -47, 53, -72, 82, -108, 124, -158, 181, -225, 259, -318, 367, -444, 506, -576, 509, 344, -15094, 7325, -3245, 1932, -1339, 987, -776, 613, -508, 411, -349, 284, -244, 197, -169, 135, -116, 90, -78, 58, -50, 36, -31, 21, -18, 11, -10, 5, -5, 2, -2, 0, 0,
+	0, -1, 0, -1, -1, 0, -3, 2, -7, 7, -14, 14, -24, 25, -38, 42, -60, 67, -90, 102, -131, 149, -187, 213, -262, 299, -358, 396, -425, 284, 762, -17031, 6913, -3022, 1783, -1229, 901, -708, 557, -462, 373, -317, 257, -222, 178, -154, 122, -106, 82, -71, 53, -46, 33, -29, 19, -17, 10, -9, 5, -4, 2, -2, 0, 0,
+	0, -1, 0, -1, -1, -1, -2, 1, -5, 4, -10, 10, -18, 19, -30, 32, -47, 52, -71, 79, -104, 117, -148, 167, -205, 229, -271, 284, -273, 56, 1187, -19044, 6491, -2794, 1630, -1116, 814, -638, 501, -415, 334, -285, 231, -199, 160, -139, 110, -96, 74, -65, 48, -42, 30, -26, 17, -16, 9, -9, 4, -4, 2, -2, 0, 0,
+	0, -1, 0, -1, 0, -1, -2, 0, -4, 2, -7, 5, -13, 12, -22, 22, -34, 36, -52, 57, -77, 84, -109, 119, -148, 158, -182, 169, -118, -177, 1619, -21135, 6062, -2562, 1476, -1003, 726, -568, 443, -368, 295, -252, 203, -177, 141, -124, 97, -85, 65, -58, 42, -38, 26, -24, 15, -14, 8, -8, 4, -4, 1, -1, 0, 0,
+	0, -1, 0, -2, 0, -2, -1, -2, -2, -1, -4, 1, -7, 5, -13, 11, -21, 21, -33, 34, -49, 51, -69, 71, -90, 87, -93, 54, 40, -412, 2057, -23305, 5625, -2327, 1319, -887, 636, -496, 385, -320, 255, -219, 176, -154, 122, -108, 84, -75, 57, -51, 37, -34, 23, -21, 14, -13, 7, -7, 3, -4, 1, -1, 0, 0,
+	0, -1, 0, -2, 0, -3, 0, -3, 0, -3, -1, -3, -2, -2, -4, 0, -8, 5, -14, 10, -21, 17, -29, 23, -31, 14, -2, -63, 198, -649, 2499, -25552, 5184, -2090, 1160, -770, 546, -424, 326, -271, 215, -186, 148, -130, 103, -92, 71, -64, 48, -44, 31, -29, 20, -19, 12, -12, 6, -7, 3, -3, 1, -1, 0, 0,
+	0, -1, 0, -2, 1, -3, 1, -5, 2, -6, 3, -8, 4, -9, 4, -10, 5, -11, 5, -13, 7, -16, 12, -26, 28, -58, 89, -180, 358, -888, 2944, -27878, 4739, -1851, 1001, -653, 455, -351, 267, -223, 175, -152, 120, -107, 83, -76, 58, -53, 39, -37, 26, -25, 16, -16, 10, -10, 5, -6, 3, -3, 1, -1, 0, 0,
+	0, -1, 1, -2, 1, -4, 2, -6, 4, -9, 6, -12, 9, -16, 13, -21, 18, -28, 25, -36, 35, -50, 52, -75, 88, -131, 180, -298, 518, -1129, 3392, -30283, 4291, -1611, 840, -535, 363, -278, 207, -174, 134, -118, 91, -83, 64, -60, 44, -43, 31, -30, 20, -21, 13, -14, 8, -9, 4, -5, 2, -3, 1, -1, 0, 0,
+	0, -1, 1, -3, 2, -5, 3, -7, 6, -11, 10, -16, 15, -23, 22, -32, 31, -44, 44, -60, 63, -84, 93, -124, 148, -205, 272, -417, 679, -1370, 3842, -32767, 3842, -1370, 679, -417, 272, -205, 148, -124, 93, -84, 63, -60, 44, -44, 31, -32, 22, -23, 15, -16, 10, -11, 6, -7, 3, -5, 2, -3, 1, -1, 0, 0
+};
+
+// blampd2 table: 4160 entries, times blampd2Scale
+const float blampd2Scale = 1.940363e-07f;
+const int16_t blampd2[] = {
+	0, 0, 1, 1, -10, -19, 9, 31, -29, -79, 30, 122, -64, -225, 71, 331, -125, -532, 146, 754, -235, -1126, 296, 1579, -477, -2323, 726, 3419, -1451, -5553, 3893, 10148, -32767, 10148, 3893, -5553, -1451, 3419, 726, -2323, -477, 1579, 296, -1126, -235, 754, 146, -532, -125, 331, 71, -225, -64, 122, 30, -79, -29, 31, 9, -19, -10, 1, 1, 0,
+	0, 0, 2, 1, -10, -19, 10, 31, -30, -78, 32, 121, -68, -224, 78, 330, -136, -530, 162, 751, -258, -1122, 329, 1574, -525, -2315, 798, 3404, -1566, -5520, 4114, 9980, -31519, 10303, 3672, -5582, -1337, 3431, 654, -2329, -428, 1583, 262, -1129, -211, 756, 130, -533, -115, 332, 64, -226, -60, 122, 27, -79, -28, 32, 9, -19, -10, 2, 1, 0,
+	0, 0, 2, 1, -11, -18, 11, 31, -32, -78, 35, 120, -73, -223, 84, 328, -147, -528, 178, 748, -281, -1118, 363, 1567, -574, -2305, 869, 3388, -1680, -5482, 4335, 9799, -30290, 10446, 3451, -5608, -1223, 3440, 582, -2334, -380, 1586, 229, -1131, -188, 758, 114, -534, -104, 333, 57, -226, -55, 123, 25, -79, -26, 32, 8, -19, -10, 2, 1, 0,
+	0, 0, 2, 1, -11, -18, 11, 30, -33, -77, 37, 120, -77, -222, 91, 326, -157, -525, 194, 745, -305, -1113, 396, 1560, -622, -2294, 941, 3369, -1794, -5441, 4556, 9606, -29081, 10577, 3230, -5629, -1109, 3448, 510, -2338, -332, 1588, 195, -1133, -165, 759, 98, -535, -93, 334, 50, -227, -51, 123, 22, -80, -25, 32, 7, -19, -9, 2, 1, 0,
+	0, 0, 2, 1, -11, -18, 12, 30, -34, -77, 40, 119, -81, -221, 98, 324, -168, -522, 210, 741, -328, -1107, 430, 1552, -671, -2282, 1013, 3348, -1908, -5395, 4776, 9400, -27891, 10696, 3010, -5647, -995, 3453, 439, -2340, -283, 1590, 162, -1133, -142, 759, 82, -536, -83, 334, 43, -227, -47, 123, 20, -80, -23, 32, 7, -19, -9, 2, 1, 0,
+	0, 0, 2, 1, -12, -18, 13, 30, -36, -76, 42, 118, -85, -219, 105, 322, -179, -519, 226, 736, -351, -1101, 463, 1543, -719, -2268, 1084, 3324, -2022, -5346, 4995, 9180, -26722, 10804, 2790, -5660, -881, 3456, 367, -2341, -235, 1590, 129, -1134, -119, 760, 67, -536, -72, 334, 36, -227, -42, 123, 17, -80, -22, 32, 6, -19, -9, 2, 1, 0,
+	0, 0, 2, 1, -12, -18, 13, 29, -37, -76, 45, 117, -90, -218, 112, 320, -189, -516, 241, 731, -374, -1094, 496, 1532, -767, -2252, 1155, 3299, -2135, -5292, 5214, 8947, -25571, 10900, 2571, -5670, -768, 3457, 296, -2340, -187, 1589, 95, -1133, -95, 759, 51, -536, -61, 334, 29, -227, -38, 124, 15, -80, -21, 32, 6, -19, -9, 2, 1, 0,
+	0, 0, 2, 1, -12, -18, 14, 29, -38, -75, 47, 116, -94, -216, 119, 317, -200, -512, 257, 726, -397, -1086, 530, 1521, -815, -2235, 1226, 3271, -2248, -5234, 5432, 8700, -24441, 10984, 2353, -5675, -655, 3456, 225, -2338, -139, 1587, 62, -1132, -72, 759, 35, -535, -51, 334, 22, -227, -34, 124, 12, -80, -19, 32, 5, -19, -8, 2, 1, 0,
+	0, 0, 2, 1, -12, -17, 15, 29, -40, -74, 50, 114, -98, -214, 126, 314, -210, -508, 273, 720, -420, -1078, 563, 1509, -862, -2217, 1297, 3241, -2360, -5172, 5649, 8440, -23330, 11058, 2136, -5677, -542, 3452, 155, -2335, -91, 1585, 29, -1130, -50, 757, 19, -535, -40, 334, 16, -227, -30, 124, 10, -80, -18, 32, 4, -19, -8, 2, 1, 0,
+	0, 0, 2, 1, -13, -17, 15, 28, -41, -74, 52, 113, -102, -212, 132, 311, -221, -503, 288, 713, -443, -1068, 595, 1495, -910, -2197, 1367, 3208, -2472, -5106, 5864, 8165, -22238, 11121, 1920, -5675, -430, 3446, 84, -2330, -44, 1581, -4, -1127, -27, 756, 4, -533, -30, 333, 9, -227, -25, 123, 7, -80, -17, 32, 4, -19, -8, 2, 1, 0,
+	0, 0, 2, 1, -13, -17, 16, 28, -43, -73, 54, 112, -107, -210, 139, 308, -231, -499, 304, 706, -465, -1059, 628, 1481, -957, -2176, 1437, 3173, -2583, -5036, 6078, 7877, -21166, 11173, 1706, -5670, -319, 3438, 15, -2323, 3, 1576, -36, -1124, -4, 754, -12, -532, -19, 332, 2, -226, -21, 123, 5, -80, -15, 32, 3, -19, -8, 2, 1, 0,
+	0, 0, 2, 0, -13, -17, 16, 27, -44, -72, 57, 110, -111, -208, 146, 305, -242, -493, 319, 699, -488, -1048, 660, 1466, -1004, -2153, 1506, 3136, -2694, -4962, 6290, 7574, -20113, 11215, 1492, -5660, -209, 3429, -55, -2316, 50, 1571, -69, -1120, 18, 751, -27, -530, -9, 331, -5, -226, -17, 123, 2, -80, -14, 32, 2, -19, -7, 2, 1, 0,
+	0, 0, 2, 0, -13, -16, 17, 27, -45, -71, 59, 109, -115, -205, 152, 301, -252, -488, 335, 691, -510, -1037, 693, 1450, -1050, -2129, 1575, 3097, -2803, -4883, 6501, 7256, -19080, 11246, 1281, -5647, -99, 3416, -124, -2307, 97, 1564, -101, -1116, 41, 748, -42, -528, 1, 330, -11, -225, -13, 123, 0, -80, -13, 32, 2, -19, -7, 2, 1, 0,
+	0, 0, 2, 0, -14, -16, 18, 26, -46, -70, 62, 107, -119, -203, 159, 297, -262, -482, 350, 683, -532, -1025, 724, 1432, -1096, -2103, 1643, 3055, -2912, -4800, 6710, 6924, -18067, 11268, 1070, -5631, 10, 3402, -192, -2296, 143, 1557, -133, -1111, 63, 745, -58, -526, 11, 329, -18, -224, -9, 122, -3, -79, -11, 32, 1, -19, -7, 2, 1, 0,
+	0, 0, 2, 0, -14, -16, 18, 26, -48, -69, 64, 105, -123, -200, 165, 293, -272, -476, 365, 674, -554, -1012, 756, 1414, -1142, -2076, 1711, 3011, -3019, -4714, 6916, 6577, -17072, 11279, 862, -5611, 118, 3386, -260, -2284, 189, 1549, -165, -1105, 85, 741, -73, -524, 21, 327, -24, -223, -5, 122, -5, -79, -10, 32, 1, -19, -7, 2, 1, 0,
+	0, 0, 2, 0, -14, -16, 19, 25, -49, -68, 66, 104, -127, -197, 172, 288, -282, -470, 380, 665, -576, -999, 787, 1395, -1188, -2047, 1778, 2965, -3126, -4623, 7120, 6215, -16097, 11281, 656, -5587, 225, 3368, -328, -2271, 234, 1540, -196, -1098, 107, 736, -88, -521, 32, 325, -31, -222, -1, 121, -7, -79, -9, 32, 0, -19, -6, 2, 1, 0,
+	0, 0, 2, 0, -14, -15, 19, 24, -50, -67, 69, 102, -131, -194, 178, 284, -292, -463, 394, 655, -598, -985, 819, 1374, -1232, -2017, 1845, 2916, -3231, -4528, 7322, 5838, -15141, 11274, 451, -5560, 332, 3348, -395, -2257, 279, 1529, -227, -1091, 129, 732, -103, -518, 41, 323, -37, -221, 3, 120, -10, -79, -7, 32, -1, -19, -6, 2, 1, 0,
+	0, 0, 2, 0, -14, -15, 20, 24, -52, -66, 71, 100, -135, -191, 185, 279, -302, -456, 409, 645, -619, -970, 849, 1353, -1277, -1985, 1910, 2866, -3335, -4429, 7520, 5445, -14204, 11257, 248, -5530, 437, 3326, -461, -2241, 324, 1518, -258, -1084, 150, 726, -117, -514, 51, 321, -44, -220, 7, 120, -12, -78, -6, 32, -1, -19, -6, 2, 1, 0,
+	0, 0, 2, 0, -15, -15, 21, 23, -53, -65, 73, 98, -139, -188, 191, 274, -311, -449, 423, 634, -640, -955, 880, 1331, -1321, -1952, 1975, 2813, -3438, -4326, 7716, 5037, -13286, 11232, 48, -5496, 541, 3301, -526, -2224, 368, 1506, -289, -1075, 171, 721, -132, -510, 61, 319, -50, -218, 11, 119, -14, -78, -5, 32, -2, -19, -6, 2, 1, 0,
+	0, 0, 2, -1, -15, -14, 21, 22, -54, -63, 75, 96, -143, -185, 197, 269, -321, -441, 438, 623, -661, -939, 910, 1308, -1364, -1918, 2039, 2758, -3540, -4218, 7909, 4613, -12388, 11198, -150, -5458, 644, 3275, -591, -2206, 412, 1494, -319, -1066, 192, 715, -146, -506, 71, 316, -56, -217, 15, 118, -16, -77, -4, 32, -2, -19, -6, 2, 1, 0,
+	0, 0, 2, -1, -15, -14, 22, 22, -55, -62, 78, 93, -147, -181, 203, 264, -330, -433, 452, 611, -681, -922, 939, 1284, -1407, -1882, 2102, 2701, -3640, -4107, 8099, 4173, -11508, 11155, -345, -5418, 746, 3248, -655, -2187, 455, 1480, -349, -1057, 213, 708, -160, -502, 80, 314, -62, -215, 19, 117, -19, -77, -2, 31, -3, -19, -5, 2, 1, 0,
+	0, 0, 2, -1, -15, -14, 22, 21, -56, -61, 80, 91, -150, -177, 209, 258, -340, -425, 466, 599, -702, -905, 968, 1259, -1449, -1845, 2165, 2641, -3739, -3992, 8285, 3717, -10647, 11103, -538, -5374, 846, 3218, -718, -2166, 498, 1466, -378, -1047, 233, 701, -174, -498, 90, 311, -68, -213, 23, 116, -21, -76, -1, 31, -3, -19, -5, 2, 1, 0,
+	0, 0, 2, -1, -16, -13, 23, 20, -58, -59, 82, 89, -154, -174, 215, 252, -349, -416, 479, 587, -721, -887, 997, 1233, -1490, -1807, 2226, 2580, -3836, -3873, 8468, 3245, -9805, 11044, -729, -5328, 945, 3186, -780, -2144, 540, 1450, -407, -1036, 254, 694, -188, -493, 99, 308, -74, -212, 27, 115, -23, -76, 0, 31, -4, -19, -5, 2, 1, 0,
+	0, 0, 2, -1, -16, -13, 23, 19, -59, -58, 84, 86, -158, -170, 221, 246, -358, -407, 493, 574, -741, -868, 1025, 1206, -1531, -1767, 2286, 2516, -3931, -3750, 8646, 2756, -8982, 10977, -917, -5278, 1043, 3153, -842, -2121, 581, 1434, -436, -1025, 274, 687, -202, -488, 108, 304, -80, -210, 30, 114, -25, -75, 1, 31, -5, -19, -5, 2, 1, 0,
+	0, 0, 2, -1, -16, -13, 24, 18, -60, -56, 86, 84, -161, -166, 227, 240, -367, -398, 506, 561, -760, -849, 1053, 1178, -1571, -1726, 2346, 2450, -4025, -3623, 8821, 2252, -8177, 10902, -1102, -5225, 1139, 3118, -902, -2097, 622, 1418, -464, -1013, 293, 679, -215, -482, 117, 301, -86, -207, 34, 113, -27, -74, 2, 30, -5, -19, -4, 2, 1, 0,
+	0, 0, 2, -2, -16, -12, 24, 18, -61, -55, 88, 81, -165, -162, 232, 234, -375, -389, 519, 547, -779, -829, 1080, 1150, -1611, -1683, 2404, 2383, -4116, -3492, 8991, 1730, -7390, 10819, -1284, -5169, 1234, 3081, -962, -2071, 663, 1400, -492, -1001, 313, 670, -228, -477, 126, 297, -92, -205, 38, 112, -29, -74, 4, 30, -6, -18, -4, 2, 1, 0,
+	0, 0, 2, -2, -16, -12, 25, 17, -62, -53, 90, 79, -168, -157, 238, 227, -384, -379, 531, 533, -798, -809, 1107, 1120, -1649, -1640, 2461, 2313, -4206, -3358, 9157, 1192, -6623, 10729, -1463, -5111, 1327, 3042, -1020, -2045, 702, 1381, -520, -988, 332, 662, -242, -471, 135, 294, -98, -203, 41, 110, -32, -73, 5, 30, -6, -18, -4, 2, 1, 0,
+	0, 0, 2, -2, -17, -11, 25, 16, -63, -52, 92, 76, -171, -153, 243, 220, -392, -369, 544, 518, -816, -788, 1133, 1090, -1687, -1594, 2517, 2241, -4294, -3219, 9318, 637, -5873, 10632, -1639, -5049, 1419, 3002, -1078, -2017, 741, 1362, -547, -975, 350, 653, -254, -465, 143, 290, -103, -200, 45, 109, -34, -72, 6, 29, -7, -18, -4, 2, 1, 0,
+	0, 0, 2, -2, -17, -11, 26, 15, -64, -50, 94, 73, -175, -149, 248, 214, -400, -359, 556, 503, -834, -766, 1159, 1058, -1724, -1548, 2572, 2167, -4380, -3077, 9475, 65, -5142, 10529, -1813, -4985, 1509, 2960, -1135, -1989, 779, 1342, -573, -961, 369, 643, -267, -459, 152, 286, -109, -198, 48, 107, -36, -72, 7, 29, -7, -18, -4, 2, 1, 0,
+	0, 0, 2, -2, -17, -11, 26, 14, -65, -48, 96, 70, -178, -144, 253, 206, -408, -348, 568, 487, -851, -744, 1184, 1026, -1761, -1501, 2625, 2091, -4464, -2931, 9626, -525, -4429, 10418, -1982, -4918, 1597, 2917, -1190, -1959, 817, 1322, -599, -947, 387, 633, -279, -452, 160, 282, -114, -195, 51, 106, -38, -71, 8, 29, -8, -18, -3, 2, 1, 0,
+	0, 0, 2, -2, -17, -10, 27, 13, -66, -47, 98, 67, -181, -139, 259, 199, -416, -337, 580, 472, -868, -721, 1209, 993, -1796, -1452, 2677, 2014, -4546, -2782, 9773, -1132, -3734, 10301, -2149, -4848, 1684, 2872, -1245, -1928, 854, 1301, -625, -932, 404, 623, -291, -445, 168, 277, -119, -193, 55, 104, -39, -70, 9, 28, -8, -18, -3, 2, 1, 0,
+	0, 1, 2, -3, -17, -10, 27, 12, -67, -45, 99, 64, -184, -134, 263, 192, -424, -326, 591, 455, -885, -698, 1233, 960, -1831, -1402, 2728, 1934, -4625, -2629, 9913, -1756, -3057, 10178, -2313, -4776, 1769, 2825, -1298, -1897, 890, 1279, -650, -917, 422, 613, -303, -438, 176, 273, -124, -190, 58, 103, -41, -69, 10, 28, -9, -18, -3, 2, 1, 0,
+	0, 1, 2, -3, -17, -9, 28, 11, -68, -43, 101, 61, -187, -129, 268, 184, -431, -315, 602, 439, -901, -674, 1256, 925, -1864, -1351, 2777, 1852, -4702, -2472, 10049, -2397, -2397, 10049, -2472, -4702, 1852, 2777, -1351, -1864, 925, 1256, -674, -901, 439, 602, -315, -431, 184, 268, -129, -187, 61, 101, -43, -68, 11, 28, -9, -17, -3, 2, 1, 0,
+	0, 1, 2, -3, -18, -9, 28, 10, -69, -41, 103, 58, -190, -124, 273, 176, -438, -303, 613, 422, -917, -650, 1279, 890, -1897, -1298, 2825, 1769, -4776, -2313, 10178, -3057, -1756, 9913, -2629, -4625, 1934, 2728, -1402, -1831, 960, 1233, -698, -885, 455, 591, -326, -424, 192, 263, -134, -184, 64, 99, -45, -67, 12, 27, -10, -17, -3, 2, 1, 0,
+	0, 1, 2, -3, -18, -8, 28, 9, -70, -39, 104, 55, -193, -119, 277, 168, -445, -291, 623, 404, -932, -625, 1301, 854, -1928, -1245, 2872, 1684, -4848, -2149, 10301, -3734, -1132, 9773, -2782, -4546, 2014, 2677, -1452, -1796, 993, 1209, -721, -868, 472, 580, -337, -416, 199, 259, -139, -181, 67, 98, -47, -66, 13, 27, -10, -17, -2, 2, 0, 0,
+	0, 1, 2, -3, -18, -8, 29, 8, -71, -38, 106, 51, -195, -114, 282, 160, -452, -279, 633, 387, -947, -599, 1322, 817, -1959, -1190, 2917, 1597, -4918, -1982, 10418, -4429, -525, 9626, -2931, -4464, 2091, 2625, -1501, -1761, 1026, 1184, -744, -851, 487, 568, -348, -408, 206, 253, -144, -178, 70, 96, -48, -65, 14, 26, -11, -17, -2, 2, 0, 0,
+	0, 1, 2, -4, -18, -7, 29, 7, -72, -36, 107, 48, -198, -109, 286, 152, -459, -267, 643, 369, -961, -573, 1342, 779, -1989, -1135, 2960, 1509, -4985, -1813, 10529, -5142, 65, 9475, -3077, -4380, 2167, 2572, -1548, -1724, 1058, 1159, -766, -834, 503, 556, -359, -400, 214, 248, -149, -175, 73, 94, -50, -64, 15, 26, -11, -17, -2, 2, 0, 0,
+	0, 1, 2, -4, -18, -7, 29, 6, -72, -34, 109, 45, -200, -103, 290, 143, -465, -254, 653, 350, -975, -547, 1362, 741, -2017, -1078, 3002, 1419, -5049, -1639, 10632, -5873, 637, 9318, -3219, -4294, 2241, 2517, -1594, -1687, 1090, 1133, -788, -816, 518, 544, -369, -392, 220, 243, -153, -171, 76, 92, -52, -63, 16, 25, -11, -17, -2, 2, 0, 0,
+	0, 1, 2, -4, -18, -6, 30, 5, -73, -32, 110, 41, -203, -98, 294, 135, -471, -242, 662, 332, -988, -520, 1381, 702, -2045, -1020, 3042, 1327, -5111, -1463, 10729, -6623, 1192, 9157, -3358, -4206, 2313, 2461, -1640, -1649, 1120, 1107, -809, -798, 533, 531, -379, -384, 227, 238, -157, -168, 79, 90, -53, -62, 17, 25, -12, -16, -2, 2, 0, 0,
+	0, 1, 2, -4, -18, -6, 30, 4, -74, -29, 112, 38, -205, -92, 297, 126, -477, -228, 670, 313, -1001, -492, 1400, 663, -2071, -962, 3081, 1234, -5169, -1284, 10819, -7390, 1730, 8991, -3492, -4116, 2383, 2404, -1683, -1611, 1150, 1080, -829, -779, 547, 519, -389, -375, 234, 232, -162, -165, 81, 88, -55, -61, 18, 24, -12, -16, -2, 2, 0, 0,
+	0, 1, 2, -4, -19, -5, 30, 2, -74, -27, 113, 34, -207, -86, 301, 117, -482, -215, 679, 293, -1013, -464, 1418, 622, -2097, -902, 3118, 1139, -5225, -1102, 10902, -8177, 2252, 8821, -3623, -4025, 2450, 2346, -1726, -1571, 1178, 1053, -849, -760, 561, 506, -398, -367, 240, 227, -166, -161, 84, 86, -56, -60, 18, 24, -13, -16, -1, 2, 0, 0,
+	0, 1, 2, -5, -19, -5, 31, 1, -75, -25, 114, 30, -210, -80, 304, 108, -488, -202, 687, 274, -1025, -436, 1434, 581, -2121, -842, 3153, 1043, -5278, -917, 10977, -8982, 2756, 8646, -3750, -3931, 2516, 2286, -1767, -1531, 1206, 1025, -868, -741, 574, 493, -407, -358, 246, 221, -170, -158, 86, 84, -58, -59, 19, 23, -13, -16, -1, 2, 0, 0,
+	0, 1, 2, -5, -19, -4, 31, 0, -76, -23, 115, 27, -212, -74, 308, 99, -493, -188, 694, 254, -1036, -407, 1450, 540, -2144, -780, 3186, 945, -5328, -729, 11044, -9805, 3245, 8468, -3873, -3836, 2580, 2226, -1807, -1490, 1233, 997, -887, -721, 587, 479, -416, -349, 252, 215, -174, -154, 89, 82, -59, -58, 20, 23, -13, -16, -1, 2, 0, 0,
+	0, 1, 2, -5, -19, -3, 31, -1, -76, -21, 116, 23, -213, -68, 311, 90, -498, -174, 701, 233, -1047, -378, 1466, 498, -2166, -718, 3218, 846, -5374, -538, 11103, -10647, 3717, 8285, -3992, -3739, 2641, 2165, -1845, -1449, 1259, 968, -905, -702, 599, 466, -425, -340, 258, 209, -177, -150, 91, 80, -61, -56, 21, 22, -14, -15, -1, 2, 0, 0,
+	0, 1, 2, -5, -19, -3, 31, -2, -77, -19, 117, 19, -215, -62, 314, 80, -502, -160, 708, 213, -1057, -349, 1480, 455, -2187, -655, 3248, 746, -5418, -345, 11155, -11508, 4173, 8099, -4107, -3640, 2701, 2102, -1882, -1407, 1284, 939, -922, -681, 611, 452, -433, -330, 264, 203, -181, -147, 93, 78, -62, -55, 22, 22, -14, -15, -1, 2, 0, 0,
+	0, 1, 2, -6, -19, -2, 32, -4, -77, -16, 118, 15, -217, -56, 316, 71, -506, -146, 715, 192, -1066, -319, 1494, 412, -2206, -591, 3275, 644, -5458, -150, 11198, -12388, 4613, 7909, -4218, -3540, 2758, 2039, -1918, -1364, 1308, 910, -939, -661, 623, 438, -441, -321, 269, 197, -185, -143, 96, 75, -63, -54, 22, 21, -14, -15, -1, 2, 0, 0,
+	0, 1, 2, -6, -19, -2, 32, -5, -78, -14, 119, 11, -218, -50, 319, 61, -510, -132, 721, 171, -1075, -289, 1506, 368, -2224, -526, 3301, 541, -5496, 48, 11232, -13286, 5037, 7716, -4326, -3438, 2813, 1975, -1952, -1321, 1331, 880, -955, -640, 634, 423, -449, -311, 274, 191, -188, -139, 98, 73, -65, -53, 23, 21, -15, -15, 0, 2, 0, 0,
+	0, 1, 2, -6, -19, -1, 32, -6, -78, -12, 120, 7, -220, -44, 321, 51, -514, -117, 726, 150, -1084, -258, 1518, 324, -2241, -461, 3326, 437, -5530, 248, 11257, -14204, 5445, 7520, -4429, -3335, 2866, 1910, -1985, -1277, 1353, 849, -970, -619, 645, 409, -456, -302, 279, 185, -191, -135, 100, 71, -66, -52, 24, 20, -15, -14, 0, 2, 0, 0,
+	0, 1, 2, -6, -19, -1, 32, -7, -79, -10, 120, 3, -221, -37, 323, 41, -518, -103, 732, 129, -1091, -227, 1529, 279, -2257, -395, 3348, 332, -5560, 451, 11274, -15141, 5838, 7322, -4528, -3231, 2916, 1845, -2017, -1232, 1374, 819, -985, -598, 655, 394, -463, -292, 284, 178, -194, -131, 102, 69, -67, -50, 24, 19, -15, -14, 0, 2, 0, 0,
+	0, 1, 2, -6, -19, 0, 32, -9, -79, -7, 121, -1, -222, -31, 325, 32, -521, -88, 736, 107, -1098, -196, 1540, 234, -2271, -328, 3368, 225, -5587, 656, 11281, -16097, 6215, 7120, -4623, -3126, 2965, 1778, -2047, -1188, 1395, 787, -999, -576, 665, 380, -470, -282, 288, 172, -197, -127, 104, 66, -68, -49, 25, 19, -16, -14, 0, 2, 0, 0,
+	0, 1, 2, -7, -19, 1, 32, -10, -79, -5, 122, -5, -223, -24, 327, 21, -524, -73, 741, 85, -1105, -165, 1549, 189, -2284, -260, 3386, 118, -5611, 862, 11279, -17072, 6577, 6916, -4714, -3019, 3011, 1711, -2076, -1142, 1414, 756, -1012, -554, 674, 365, -476, -272, 293, 165, -200, -123, 105, 64, -69, -48, 26, 18, -16, -14, 0, 2, 0, 0,
+	0, 1, 2, -7, -19, 1, 32, -11, -79, -3, 122, -9, -224, -18, 329, 11, -526, -58, 745, 63, -1111, -133, 1557, 143, -2296, -192, 3402, 10, -5631, 1070, 11268, -18067, 6924, 6710, -4800, -2912, 3055, 1643, -2103, -1096, 1432, 724, -1025, -532, 683, 350, -482, -262, 297, 159, -203, -119, 107, 62, -70, -46, 26, 18, -16, -14, 0, 2, 0, 0,
+	0, 1, 2, -7, -19, 2, 32, -13, -80, 0, 123, -13, -225, -11, 330, 1, -528, -42, 748, 41, -1116, -101, 1564, 97, -2307, -124, 3416, -99, -5647, 1281, 11246, -19080, 7256, 6501, -4883, -2803, 3097, 1575, -2129, -1050, 1450, 693, -1037, -510, 691, 335, -488, -252, 301, 152, -205, -115, 109, 59, -71, -45, 27, 17, -16, -13, 0, 2, 0, 0,
+	0, 1, 2, -7, -19, 2, 32, -14, -80, 2, 123, -17, -226, -5, 331, -9, -530, -27, 751, 18, -1120, -69, 1571, 50, -2316, -55, 3429, -209, -5660, 1492, 11215, -20113, 7574, 6290, -4962, -2694, 3136, 1506, -2153, -1004, 1466, 660, -1048, -488, 699, 319, -493, -242, 305, 146, -208, -111, 110, 57, -72, -44, 27, 16, -17, -13, 0, 2, 0, 0,
+	0, 1, 2, -8, -19, 3, 32, -15, -80, 5, 123, -21, -226, 2, 332, -19, -532, -12, 754, -4, -1124, -36, 1576, 3, -2323, 15, 3438, -319, -5670, 1706, 11173, -21166, 7877, 6078, -5036, -2583, 3173, 1437, -2176, -957, 1481, 628, -1059, -465, 706, 304, -499, -231, 308, 139, -210, -107, 112, 54, -73, -43, 28, 16, -17, -13, 1, 2, 0, 0,
+	0, 1, 2, -8, -19, 4, 32, -17, -80, 7, 123, -25, -227, 9, 333, -30, -533, 4, 756, -27, -1127, -4, 1581, -44, -2330, 84, 3446, -430, -5675, 1920, 11121, -22238, 8165, 5864, -5106, -2472, 3208, 1367, -2197, -910, 1495, 595, -1068, -443, 713, 288, -503, -221, 311, 132, -212, -102, 113, 52, -74, -41, 28, 15, -17, -13, 1, 2, 0, 0,
+	0, 1, 2, -8, -19, 4, 32, -18, -80, 10, 124, -30, -227, 16, 334, -40, -535, 19, 757, -50, -1130, 29, 1585, -91, -2335, 155, 3452, -542, -5677, 2136, 11058, -23330, 8440, 5649, -5172, -2360, 3241, 1297, -2217, -862, 1509, 563, -1078, -420, 720, 273, -508, -210, 314, 126, -214, -98, 114, 50, -74, -40, 29, 15, -17, -12, 1, 2, 0, 0,
+	0, 1, 2, -8, -19, 5, 32, -19, -80, 12, 124, -34, -227, 22, 334, -51, -535, 35, 759, -72, -1132, 62, 1587, -139, -2338, 225, 3456, -655, -5675, 2353, 10984, -24441, 8700, 5432, -5234, -2248, 3271, 1226, -2235, -815, 1521, 530, -1086, -397, 726, 257, -512, -200, 317, 119, -216, -94, 116, 47, -75, -38, 29, 14, -18, -12, 1, 2, 0, 0,
+	0, 1, 2, -9, -19, 6, 32, -21, -80, 15, 124, -38, -227, 29, 334, -61, -536, 51, 759, -95, -1133, 95, 1589, -187, -2340, 296, 3457, -768, -5670, 2571, 10900, -25571, 8947, 5214, -5292, -2135, 3299, 1155, -2252, -767, 1532, 496, -1094, -374, 731, 241, -516, -189, 320, 112, -218, -90, 117, 45, -76, -37, 29, 13, -18, -12, 1, 2, 0, 0,
+	0, 1, 2, -9, -19, 6, 32, -22, -80, 17, 123, -42, -227, 36, 334, -72, -536, 67, 760, -119, -1134, 129, 1590, -235, -2341, 367, 3456, -881, -5660, 2790, 10804, -26722, 9180, 4995, -5346, -2022, 3324, 1084, -2268, -719, 1543, 463, -1101, -351, 736, 226, -519, -179, 322, 105, -219, -85, 118, 42, -76, -36, 30, 13, -18, -12, 1, 2, 0, 0,
+	0, 1, 2, -9, -19, 7, 32, -23, -80, 20, 123, -47, -227, 43, 334, -83, -536, 82, 759, -142, -1133, 162, 1590, -283, -2340, 439, 3453, -995, -5647, 3010, 10696, -27891, 9400, 4776, -5395, -1908, 3348, 1013, -2282, -671, 1552, 430, -1107, -328, 741, 210, -522, -168, 324, 98, -221, -81, 119, 40, -77, -34, 30, 12, -18, -11, 1, 2, 0, 0,
+	0, 1, 2, -9, -19, 7, 32, -25, -80, 22, 123, -51, -227, 50, 334, -93, -535, 98, 759, -165, -1133, 195, 1588, -332, -2338, 510, 3448, -1109, -5629, 3230, 10577, -29081, 9606, 4556, -5441, -1794, 3369, 941, -2294, -622, 1560, 396, -1113, -305, 745, 194, -525, -157, 326, 91, -222, -77, 120, 37, -77, -33, 30, 11, -18, -11, 1, 2, 0, 0,
+	0, 1, 2, -10, -19, 8, 32, -26, -79, 25, 123, -55, -226, 57, 333, -104, -534, 114, 758, -188, -1131, 229, 1586, -380, -2334, 582, 3440, -1223, -5608, 3451, 10446, -30290, 9799, 4335, -5482, -1680, 3388, 869, -2305, -574, 1567, 363, -1118, -281, 748, 178, -528, -147, 328, 84, -223, -73, 120, 35, -78, -32, 31, 11, -18, -11, 1, 2, 0, 0,
+	0, 1, 2, -10, -19, 9, 32, -28, -79, 27, 122, -60, -226, 64, 332, -115, -533, 130, 756, -211, -1129, 262, 1583, -428, -2329, 654, 3431, -1337, -5582, 3672, 10303, -31519, 9980, 4114, -5520, -1566, 3404, 798, -2315, -525, 1574, 329, -1122, -258, 751, 162, -530, -136, 330, 78, -224, -68, 121, 32, -78, -30, 31, 10, -19, -10, 1, 2, 0, 0,
+	0, 1, 1, -10, -19, 9, 31, -29, -79, 30, 122, -64, -225, 71, 331, -125, -532, 146, 754, -235, -1126, 296, 1579, -477, -2323, 726, 3419, -1451, -5553, 3893, 10148, -32767, 10148, 3893, -5553, -1451, 3419, 726, -2323, -477, 1579, 296, -1126, -235, 754, 146, -532, -125, 331, 71, -225, -64, 122, 30, -79, -29, 31, 9, -19, -10, 1, 1, 0, 0
+};
@@ -0,0 +1,4434 @@
+// BLEP and BLAMP tables for Samples = 8, generated by Utils/blepnew.c.
+// See BlepData.h.
+
+// blep table: 1040 entries
+const float blep[] = {
+	-4.226132e-36f,
+	1.168802e-04f,
+	-1.016582e-03f,
+	3.187931e-03f,
+	-8.172441e-03f,
+	1.781850e-02f,
+	-3.695894e-02f,
+	8.309616e-02f,
+	5.000000e-01f,
+	-8.309616e-02f,
+	3.695894e-02f,
+	-1.781850e-02f,
+	8.172441e-03f,
+	-3.187931e-03f,
+	1.016582e-03f,
+	-1.168802e-04f,
+
+	5.178152e-11f,
+	1.166162e-04f,
+	-1.015203e-03f,
+	3.183666e-03f,
+	-8.161936e-03f,
+	1.779567e-02f,
+	-3.691118e-02f,
+	8.297960e-02f,
+	4.843793e-01f,
+	-8.298364e-02f,
+	3.691230e-02f,
+	-1.779619e-02f,
+	8.162203e-03f,
+	-3.183796e-03f,
+	1.015258e-03f,
+	-1.166341e-04f,
+
+	5.181444e-10f,
+	1.158064e-04f,
+	-1.011012e-03f,
+	3.170747e-03f,
+	-8.130170e-03f,
+	1.772672e-02f,
+	-3.676688e-02f,
+	8.262599e-02f,
+	4.687716e-01f,
+	-8.265020e-02f,
+	3.677361e-02f,
+	-1.772985e-02f,
+	8.131779e-03f,
+	-3.171531e-03f,
+	1.011344e-03f,
+	-1.159135e-04f,
+
+	2.331967e-09f,
+	1.144152e-04f,
+	-1.003906e-03f,
+	3.148939e-03f,
+	-8.076676e-03f,
+	1.761074e-02f,
+	-3.652408e-02f,
+	8.202758e-02f,
+	4.531899e-01f,
+	-8.210418e-02f,
+	3.654535e-02f,
+	-1.762064e-02f,
+	8.081762e-03f,
+	-3.151418e-03f,
+	1.004956e-03f,
+	-1.147541e-04f,
+
+	7.045423e-09f,
+	1.124078e-04f,
+	-9.937859e-04f,
+	3.118023e-03f,
+	-8.001028e-03f,
+	1.744694e-02f,
+	-3.618100e-02f,
+	8.117680e-02f,
+	4.376472e-01f,
+	-8.135407e-02f,
+	3.623020e-02f,
+	-1.746983e-02f,
+	8.012786e-03f,
+	-3.123753e-03f,
+	9.962125e-04f,
+	-1.131913e-04f,
+
+	1.682280e-08f,
+	1.097495e-04f,
+	-9.805576e-04f,
+	3.077798e-03f,
+	-7.902848e-03f,
+	1.723462e-02f,
+	-3.573610e-02f,
+	8.006639e-02f,
+	4.221564e-01f,
+	-8.040853e-02f,
+	3.583097e-02f,
+	-1.727875e-02f,
+	7.925516e-03f,
+	-3.088845e-03f,
+	9.852358e-04f,
+	-1.112602e-04f,
+
+	3.442846e-08f,
+	1.064065e-04f,
+	-9.641339e-04f,
+	3.028085e-03f,
+	-7.781812e-03f,
+	1.697319e-02f,
+	-3.518802e-02f,
+	7.868930e-02f,
+	4.067304e-01f,
+	-7.927631e-02f,
+	3.535060e-02f,
+	-1.704880e-02f,
+	7.820648e-03f,
+	-3.047013e-03f,
+	9.721496e-04f,
+	-1.089953e-04f,
+
+	6.321005e-08f,
+	1.023459e-04f,
+	-9.444340e-04f,
+	2.968726e-03f,
+	-7.637649e-03f,
+	1.666220e-02f,
+	-3.453566e-02f,
+	7.703876e-02f,
+	3.913817e-01f,
+	-7.796629e-02f,
+	3.479218e-02f,
+	-1.678147e-02f,
+	7.698910e-03f,
+	-2.998583e-03f,
+	9.570792e-04f,
+	-1.064305e-04f,
+
+	1.070769e-07f,
+	9.753604e-05f,
+	-9.213838e-04f,
+	2.899584e-03f,
+	-7.470140e-03f,
+	1.630128e-02f,
+	-3.377812e-02f,
+	7.510831e-02f,
+	3.761231e-01f,
+	-7.648742e-02f,
+	3.415892e-02f,
+	-1.647829e-02f,
+	7.561052e-03f,
+	-2.943894e-03f,
+	9.401513e-04f,
+	-1.035990e-04f,
+
+	1.704736e-07f,
+	9.194620e-05f,
+	-8.949172e-04f,
+	2.820547e-03f,
+	-7.279127e-03f,
+	1.589021e-02f,
+	-3.291476e-02f,
+	7.289175e-02f,
+	3.609670e-01f,
+	-7.484876e-02f,
+	3.345414e-02f,
+	-1.614086e-02f,
+	7.407849e-03f,
+	-2.883287e-03f,
+	9.214931e-04f,
+	-1.005332e-04f,
+
+	2.583495e-07f,
+	8.554731e-05f,
+	-8.649755e-04f,
+	2.731528e-03f,
+	-7.064507e-03f,
+	1.542888e-02f,
+	-3.194517e-02f,
+	7.038324e-02f,
+	3.459256e-01f,
+	-7.305939e-02f,
+	3.268122e-02f,
+	-1.577081e-02f,
+	7.240096e-03f,
+	-2.817113e-03f,
+	9.012322e-04f,
+	-9.726441e-05f,
+
+	3.761228e-07f,
+	7.831188e-05f,
+	-8.315088e-04f,
+	2.632462e-03f,
+	-6.826241e-03f,
+	1.491732e-02f,
+	-3.086921e-02f,
+	6.757724e-02f,
+	3.310111e-01f,
+	-7.112846e-02f,
+	3.184370e-02f,
+	-1.536984e-02f,
+	7.058607e-03f,
+	-2.745725e-03f,
+	8.794962e-04f,
+	-9.382310e-05f,
+
+	5.296411e-07f,
+	7.021426e-05f,
+	-7.944763e-04f,
+	2.523313e-03f,
+	-6.564350e-03f,
+	1.435567e-02f,
+	-2.968698e-02f,
+	6.446857e-02f,
+	3.162355e-01f,
+	-6.906511e-02f,
+	3.094514e-02f,
+	-1.493968e-02f,
+	6.864211e-03f,
+	-2.669480e-03f,
+	8.564119e-04f,
+	-9.023849e-05f,
+
+	7.251372e-07f,
+	6.123078e-05f,
+	-7.538461e-04f,
+	2.404072e-03f,
+	-6.278921e-03f,
+	1.374421e-02f,
+	-2.839887e-02f,
+	6.105240e-02f,
+	3.016104e-01f,
+	-6.687852e-02f,
+	2.998919e-02f,
+	-1.448209e-02f,
+	6.657749e-03f,
+	-2.588740e-03f,
+	8.321054e-04f,
+	-8.653865e-05f,
+
+	9.691814e-07f,
+	5.134000e-05f,
+	-7.095963e-04f,
+	2.274757e-03f,
+	-5.970102e-03f,
+	1.308338e-02f,
+	-2.700551e-02f,
+	5.732425e-02f,
+	2.871473e-01f,
+	-6.457783e-02f,
+	2.897955e-02f,
+	-1.399887e-02f,
+	6.440073e-03f,
+	-2.503863e-03f,
+	8.067015e-04f,
+	-8.275042e-05f,
+
+	1.268629e-06f,
+	4.052283e-05f,
+	-6.617155e-04f,
+	2.135416e-03f,
+	-5.638113e-03f,
+	1.237373e-02f,
+	-2.550782e-02f,
+	5.328006e-02f,
+	2.728573e-01f,
+	-6.217219e-02f,
+	2.792000e-02f,
+	-1.349184e-02f,
+	6.212042e-03f,
+	-2.415213e-03f,
+	7.803233e-04f,
+	-7.889928e-05f,
+
+	1.630567e-06f,
+	2.876279e-05f,
+	-6.102024e-04f,
+	1.986125e-03f,
+	-5.283235e-03f,
+	1.161594e-02f,
+	-2.390701e-02f,
+	4.891613e-02f,
+	2.587515e-01f,
+	-5.967068e-02f,
+	2.681431e-02f,
+	-1.296283e-02f,
+	5.974520e-03f,
+	-2.323149e-03f,
+	7.530921e-04f,
+	-7.500938e-05f,
+
+	2.062250e-06f,
+	1.604613e-05f,
+	-5.550670e-04f,
+	1.826991e-03f,
+	-4.905823e-03f,
+	1.081087e-02f,
+	-2.220456e-02f,
+	4.422917e-02f,
+	2.448405e-01f,
+	-5.708232e-02f,
+	2.566630e-02f,
+	-1.241370e-02f,
+	5.728375e-03f,
+	-2.228031e-03f,
+	7.251266e-04f,
+	-7.110347e-05f,
+
+	2.571045e-06f,
+	2.362062e-06f,
+	-4.963305e-04f,
+	1.658150e-03f,
+	-4.506296e-03f,
+	9.959482e-03f,
+	-2.040223e-02f,
+	3.921629e-02f,
+	2.311346e-01f,
+	-5.441608e-02f,
+	2.447982e-02f,
+	-1.184631e-02f,
+	5.474472e-03f,
+	-2.130214e-03f,
+	6.965433e-04f,
+	-6.720283e-05f,
+
+	3.164362e-06f,
+	-1.229712e-05f,
+	-4.340260e-04f,
+	1.479771e-03f,
+	-4.085146e-03f,
+	9.062899e-03f,
+	-1.850209e-02f,
+	3.387503e-02f,
+	2.176440e-01f,
+	-5.168083e-02f,
+	2.325870e-02f,
+	-1.126253e-02f,
+	5.213678e-03f,
+	-2.030051e-03f,
+	6.674554e-04f,
+	-6.332732e-05f,
+
+	3.849585e-06f,
+	-2.793581e-05f,
+	-3.681982e-04f,
+	1.292053e-03f,
+	-3.642933e-03f,
+	8.122384e-03f,
+	-1.650648e-02f,
+	2.820336e-02f,
+	2.043782e-01f,
+	-4.888532e-02f,
+	2.200680e-02f,
+	-1.066421e-02f,
+	4.946853e-03f,
+	-1.927889e-03f,
+	6.379735e-04f,
+	-5.949531e-05f,
+
+	4.634010e-06f,
+	-4.455496e-05f,
+	-2.989043e-04f,
+	1.095228e-03f,
+	-3.180287e-03f,
+	7.139336e-03f,
+	-1.441805e-02f,
+	2.219969e-02f,
+	1.913467e-01f,
+	-4.603821e-02f,
+	2.072795e-02f,
+	-1.005322e-02f,
+	4.674850e-03f,
+	-1.824071e-03f,
+	6.082044e-04f,
+	-5.572365e-05f,
+
+	5.524763e-06f,
+	-6.215192e-05f,
+	-2.262140e-04f,
+	8.895592e-04f,
+	-2.697909e-03f,
+	6.115303e-03f,
+	-1.223973e-02f,
+	1.586284e-02f,
+	1.785585e-01f,
+	-4.314803e-02f,
+	1.942595e-02f,
+	-9.431402e-03f,
+	4.398515e-03f,
+	-1.718933e-03f,
+	5.782516e-04f,
+	-5.202773e-05f,
+
+	6.528735e-06f,
+	-8.072026e-05f,
+	-1.502094e-04f,
+	6.753418e-04f,
+	-2.196567e-03f,
+	5.051968e-03f,
+	-9.974752e-03f,
+	9.192127e-03f,
+	1.660223e-01f,
+	-4.022314e-02f,
+	1.810460e-02f,
+	-8.800592e-03f,
+	4.118684e-03f,
+	-1.612803e-03f,
+	5.482145e-04f,
+	-4.842145e-05f,
+
+	7.652502e-06f,
+	-1.002497e-04f,
+	-7.098592e-05f,
+	4.529034e-04f,
+	-1.677102e-03f,
+	3.951157e-03f,
+	-7.626645e-03f,
+	2.187279e-03f,
+	1.537461e-01f,
+	-3.727177e-02f,
+	1.676764e-02f,
+	-8.162603e-03f,
+	3.836176e-03f,
+	-1.506003e-03f,
+	5.181890e-04f,
+	-4.491722e-05f,
+
+	8.902253e-06f,
+	-1.207257e-04f,
+	1.134836e-05f,
+	2.226039e-04f,
+	-1.140422e-03f,
+	2.814831e-03f,
+	-5.199225e-03f,
+	-5.151497e-03f,
+	1.417380e-01f,
+	-3.430196e-02f,
+	1.541877e-02f,
+	-7.519222e-03f,
+	3.551799e-03f,
+	-1.398845e-03f,
+	4.882665e-04f,
+	-4.152601e-05f,
+
+	1.028371e-05f,
+	-1.421300e-04f,
+	9.667205e-05f,
+	-1.516473e-05f,
+	-5.875016e-04f,
+	1.645091e-03f,
+	-2.696600e-03f,
+	-1.282354e-02f,
+	1.300054e-01f,
+	-3.132157e-02f,
+	1.406164e-02f,
+	-6.872212e-03f,
+	3.266343e-03f,
+	-1.291633e-03f,
+	4.585342e-04f,
+	-3.825735e-05f,
+
+	1.180206e-05f,
+	-1.644395e-04f,
+	1.848506e-04f,
+	-2.599789e-04f,
+	-1.938468e-05f,
+	4.441687e-04f,
+	-1.231696e-04f,
+	-2.082771e-02f,
+	1.185553e-01f,
+	-2.833830e-02f,
+	1.269984e-02f,
+	-6.223302e-03f,
+	2.980581e-03f,
+	-1.184661e-03f,
+	4.290750e-04f,
+	-3.511937e-05f,
+
+	1.346187e-05f,
+	-1.876272e-04f,
+	2.757362e-04f,
+	-5.113834e-04f,
+	5.628202e-04f,
+	-7.855726e-04f,
+	2.516381e-03f,
+	-2.916243e-02f,
+	1.073943e-01f,
+	-2.535959e-02f,
+	1.133689e-02f,
+	-5.574188e-03f,
+	2.695264e-03f,
+	-1.078212e-03f,
+	3.999672e-04f,
+	-3.211884e-05f,
+
+	1.526701e-05f,
+	-2.116612e-04f,
+	3.691678e-04f,
+	-7.688919e-04f,
+	1.157940e-03f,
+	-2.041641e-03f,
+	5.217083e-03f,
+	-3.782562e-02f,
+	9.652859e-02f,
+	-2.239272e-02f,
+	9.976220e-03f,
+	-4.926525e-03f,
+	2.411124e-03f,
+	-9.725582e-04f,
+	3.712847e-04f,
+	-2.926120e-05f,
+
+	1.722059e-05f,
+	-2.365055e-04f,
+	4.649712e-04f,
+	-1.031987e-03f,
+	1.764739e-03f,
+	-3.321420e-03f,
+	7.973690e-03f,
+	-4.681477e-02f,
+	8.596393e-02f,
+	-1.944471e-02f,
+	8.621193e-03f,
+	-4.281924e-03f,
+	2.128869e-03f,
+	-8.679624e-04f,
+	3.430966e-04f,
+	-2.655062e-05f,
+
+	1.932488e-05f,
+	-2.621191e-04f,
+	5.629590e-04f,
+	-1.300123e-03f,
+	2.381921e-03f,
+	-4.622173e-03f,
+	1.078068e-02f,
+	-5.612686e-02f,
+	7.570560e-02f,
+	-1.652237e-02f,
+	7.275078e-03f,
+	-3.641952e-03f,
+	1.849182e-03f,
+	-7.646740e-04f,
+	3.154672e-04f,
+	-2.399004e-05f,
+
+	2.158124e-05f,
+	-2.884564e-04f,
+	6.629310e-04f,
+	-1.572723e-03f,
+	3.008129e-03f,
+	-5.941048e-03f,
+	1.363226e-02f,
+	-6.575845e-02f,
+	6.575845e-02f,
+	-1.363226e-02f,
+	5.941048e-03f,
+	-3.008129e-03f,
+	1.572723e-03f,
+	-6.629310e-04f,
+	2.884564e-04f,
+	-2.158124e-05f,
+
+	2.399004e-05f,
+	-3.154672e-04f,
+	7.646740e-04f,
+	-1.849182e-03f,
+	3.641952e-03f,
+	-7.275078e-03f,
+	1.652237e-02f,
+	-7.570560e-02f,
+	5.612686e-02f,
+	-1.078068e-02f,
+	4.622173e-03f,
+	-2.381921e-03f,
+	1.300123e-03f,
+	-5.629590e-04f,
+	2.621191e-04f,
+	-1.932488e-05f,
+
+	2.655062e-05f,
+	-3.430966e-04f,
+	8.679624e-04f,
+	-2.128869e-03f,
+	4.281924e-03f,
+	-8.621193e-03f,
+	1.944471e-02f,
+	-8.596393e-02f,
+	4.681477e-02f,
+	-7.973690e-03f,
+	3.321420e-03f,
+	-1.764739e-03f,
+	1.031987e-03f,
+	-4.649712e-04f,
+	2.365055e-04f,
+	-1.722059e-05f,
+
+	2.926120e-05f,
+	-3.712847e-04f,
+	9.725582e-04f,
+	-2.411124e-03f,
+	4.926525e-03f,
+	-9.976220e-03f,
+	2.239272e-02f,
+	-9.652859e-02f,
+	3.782562e-02f,
+	-5.217083e-03f,
+	2.041641e-03f,
+	-1.157940e-03f,
+	7.688919e-04f,
+	-3.691678e-04f,
+	2.116612e-04f,
+	-1.526701e-05f,
+
+	3.211884e-05f,
+	-3.999672e-04f,
+	1.078212e-03f,
+	-2.695264e-03f,
+	5.574188e-03f,
+	-1.133689e-02f,
+	2.535959e-02f,
+	-1.073943e-01f,
+	2.916243e-02f,
+	-2.516381e-03f,
+	7.855726e-04f,
+	-5.628202e-04f,
+	5.113834e-04f,
+	-2.757362e-04f,
+	1.876272e-04f,
+	-1.346187e-05f,
+
+	3.511937e-05f,
+	-4.290750e-04f,
+	1.184661e-03f,
+	-2.980581e-03f,
+	6.223302e-03f,
+	-1.269984e-02f,
+	2.833830e-02f,
+	-1.185553e-01f,
+	2.082771e-02f,
+	1.231696e-04f,
+	-4.441687e-04f,
+	1.938468e-05f,
+	2.599789e-04f,
+	-1.848506e-04f,
+	1.644395e-04f,
+	-1.180206e-05f,
+
+	3.825735e-05f,
+	-4.585342e-04f,
+	1.291633e-03f,
+	-3.266343e-03f,
+	6.872212e-03f,
+	-1.406164e-02f,
+	3.132157e-02f,
+	-1.300054e-01f,
+	1.282354e-02f,
+	2.696600e-03f,
+	-1.645091e-03f,
+	5.875016e-04f,
+	1.516473e-05f,
+	-9.667205e-05f,
+	1.421300e-04f,
+	-1.028371e-05f,
+
+	4.152601e-05f,
+	-4.882665e-04f,
+	1.398845e-03f,
+	-3.551799e-03f,
+	7.519222e-03f,
+	-1.541877e-02f,
+	3.430196e-02f,
+	-1.417380e-01f,
+	5.151497e-03f,
+	5.199225e-03f,
+	-2.814831e-03f,
+	1.140422e-03f,
+	-2.226039e-04f,
+	-1.134836e-05f,
+	1.207257e-04f,
+	-8.902253e-06f,
+
+	4.491722e-05f,
+	-5.181890e-04f,
+	1.506003e-03f,
+	-3.836176e-03f,
+	8.162603e-03f,
+	-1.676764e-02f,
+	3.727177e-02f,
+	-1.537461e-01f,
+	-2.187279e-03f,
+	7.626645e-03f,
+	-3.951157e-03f,
+	1.677102e-03f,
+	-4.529034e-04f,
+	7.098592e-05f,
+	1.002497e-04f,
+	-7.652502e-06f,
+
+	4.842145e-05f,
+	-5.482145e-04f,
+	1.612803e-03f,
+	-4.118684e-03f,
+	8.800592e-03f,
+	-1.810460e-02f,
+	4.022314e-02f,
+	-1.660223e-01f,
+	-9.192127e-03f,
+	9.974752e-03f,
+	-5.051968e-03f,
+	2.196567e-03f,
+	-6.753418e-04f,
+	1.502094e-04f,
+	8.072026e-05f,
+	-6.528735e-06f,
+
+	5.202773e-05f,
+	-5.782516e-04f,
+	1.718933e-03f,
+	-4.398515e-03f,
+	9.431402e-03f,
+	-1.942595e-02f,
+	4.314803e-02f,
+	-1.785585e-01f,
+	-1.586284e-02f,
+	1.223973e-02f,
+	-6.115303e-03f,
+	2.697909e-03f,
+	-8.895592e-04f,
+	2.262140e-04f,
+	6.215192e-05f,
+	-5.524763e-06f,
+
+	5.572365e-05f,
+	-6.082044e-04f,
+	1.824071e-03f,
+	-4.674850e-03f,
+	1.005322e-02f,
+	-2.072795e-02f,
+	4.603821e-02f,
+	-1.913467e-01f,
+	-2.219969e-02f,
+	1.441805e-02f,
+	-7.139336e-03f,
+	3.180287e-03f,
+	-1.095228e-03f,
+	2.989043e-04f,
+	4.455496e-05f,
+	-4.634010e-06f,
+
+	5.949531e-05f,
+	-6.379735e-04f,
+	1.927889e-03f,
+	-4.946853e-03f,
+	1.066421e-02f,
+	-2.200680e-02f,
+	4.888532e-02f,
+	-2.043782e-01f,
+	-2.820336e-02f,
+	1.650648e-02f,
+	-8.122384e-03f,
+	3.642933e-03f,
+	-1.292053e-03f,
+	3.681982e-04f,
+	2.793581e-05f,
+	-3.849585e-06f,
+
+	6.332732e-05f,
+	-6.674554e-04f,
+	2.030051e-03f,
+	-5.213678e-03f,
+	1.126253e-02f,
+	-2.325870e-02f,
+	5.168083e-02f,
+	-2.176440e-01f,
+	-3.387503e-02f,
+	1.850209e-02f,
+	-9.062899e-03f,
+	4.085146e-03f,
+	-1.479771e-03f,
+	4.340260e-04f,
+	1.229712e-05f,
+	-3.164362e-06f,
+
+	6.720283e-05f,
+	-6.965433e-04f,
+	2.130214e-03f,
+	-5.474472e-03f,
+	1.184631e-02f,
+	-2.447982e-02f,
+	5.441608e-02f,
+	-2.311346e-01f,
+	-3.921629e-02f,
+	2.040223e-02f,
+	-9.959482e-03f,
+	4.506296e-03f,
+	-1.658150e-03f,
+	4.963305e-04f,
+	-2.362062e-06f,
+	-2.571045e-06f,
+
+	7.110347e-05f,
+	-7.251266e-04f,
+	2.228031e-03f,
+	-5.728375e-03f,
+	1.241370e-02f,
+	-2.566630e-02f,
+	5.708232e-02f,
+	-2.448405e-01f,
+	-4.422917e-02f,
+	2.220456e-02f,
+	-1.081087e-02f,
+	4.905823e-03f,
+	-1.826991e-03f,
+	5.550670e-04f,
+	-1.604613e-05f,
+	-2.062250e-06f,
+
+	7.500938e-05f,
+	-7.530921e-04f,
+	2.323149e-03f,
+	-5.974520e-03f,
+	1.296283e-02f,
+	-2.681431e-02f,
+	5.967068e-02f,
+	-2.587515e-01f,
+	-4.891613e-02f,
+	2.390701e-02f,
+	-1.161594e-02f,
+	5.283235e-03f,
+	-1.986125e-03f,
+	6.102024e-04f,
+	-2.876279e-05f,
+	-1.630567e-06f,
+
+	7.889928e-05f,
+	-7.803233e-04f,
+	2.415213e-03f,
+	-6.212042e-03f,
+	1.349184e-02f,
+	-2.792000e-02f,
+	6.217219e-02f,
+	-2.728573e-01f,
+	-5.328006e-02f,
+	2.550782e-02f,
+	-1.237373e-02f,
+	5.638113e-03f,
+	-2.135416e-03f,
+	6.617155e-04f,
+	-4.052283e-05f,
+	-1.268629e-06f,
+
+	8.275042e-05f,
+	-8.067015e-04f,
+	2.503863e-03f,
+	-6.440073e-03f,
+	1.399887e-02f,
+	-2.897955e-02f,
+	6.457783e-02f,
+	-2.871473e-01f,
+	-5.732425e-02f,
+	2.700551e-02f,
+	-1.308338e-02f,
+	5.970102e-03f,
+	-2.274757e-03f,
+	7.095963e-04f,
+	-5.134000e-05f,
+	-9.691814e-07f,
+
+	8.653865e-05f,
+	-8.321054e-04f,
+	2.588740e-03f,
+	-6.657749e-03f,
+	1.448209e-02f,
+	-2.998919e-02f,
+	6.687852e-02f,
+	-3.016104e-01f,
+	-6.105240e-02f,
+	2.839887e-02f,
+	-1.374421e-02f,
+	6.278921e-03f,
+	-2.404072e-03f,
+	7.538461e-04f,
+	-6.123078e-05f,
+	-7.251372e-07f,
+
+	9.023849e-05f,
+	-8.564119e-04f,
+	2.669480e-03f,
+	-6.864211e-03f,
+	1.493968e-02f,
+	-3.094514e-02f,
+	6.906511e-02f,
+	-3.162355e-01f,
+	-6.446857e-02f,
+	2.968698e-02f,
+	-1.435567e-02f,
+	6.564350e-03f,
+	-2.523313e-03f,
+	7.944763e-04f,
+	-7.021426e-05f,
+	-5.296411e-07f,
+
+	9.382310e-05f,
+	-8.794962e-04f,
+	2.745725e-03f,
+	-7.058607e-03f,
+	1.536984e-02f,
+	-3.184370e-02f,
+	7.112846e-02f,
+	-3.310111e-01f,
+	-6.757724e-02f,
+	3.086921e-02f,
+	-1.491732e-02f,
+	6.826241e-03f,
+	-2.632462e-03f,
+	8.315088e-04f,
+	-7.831188e-05f,
+	-3.761228e-07f,
+
+	9.726441e-05f,
+	-9.012322e-04f,
+	2.817113e-03f,
+	-7.240096e-03f,
+	1.577081e-02f,
+	-3.268122e-02f,
+	7.305939e-02f,
+	-3.459256e-01f,
+	-7.038324e-02f,
+	3.194517e-02f,
+	-1.542888e-02f,
+	7.064507e-03f,
+	-2.731528e-03f,
+	8.649755e-04f,
+	-8.554731e-05f,
+	-2.583495e-07f,
+
+	1.005332e-04f,
+	-9.214931e-04f,
+	2.883287e-03f,
+	-7.407849e-03f,
+	1.614086e-02f,
+	-3.345414e-02f,
+	7.484876e-02f,
+	-3.609670e-01f,
+	-7.289175e-02f,
+	3.291476e-02f,
+	-1.589021e-02f,
+	7.279127e-03f,
+	-2.820547e-03f,
+	8.949172e-04f,
+	-9.194620e-05f,
+	-1.704736e-07f,
+
+	1.035990e-04f,
+	-9.401513e-04f,
+	2.943894e-03f,
+	-7.561052e-03f,
+	1.647829e-02f,
+	-3.415892e-02f,
+	7.648742e-02f,
+	-3.761231e-01f,
+	-7.510831e-02f,
+	3.377812e-02f,
+	-1.630128e-02f,
+	7.470140e-03f,
+	-2.899584e-03f,
+	9.213838e-04f,
+	-9.753604e-05f,
+	-1.070769e-07f,
+
+	1.064305e-04f,
+	-9.570792e-04f,
+	2.998583e-03f,
+	-7.698910e-03f,
+	1.678147e-02f,
+	-3.479218e-02f,
+	7.796629e-02f,
+	-3.913817e-01f,
+	-7.703876e-02f,
+	3.453566e-02f,
+	-1.666220e-02f,
+	7.637649e-03f,
+	-2.968726e-03f,
+	9.444340e-04f,
+	-1.023459e-04f,
+	-6.321005e-08f,
+
+	1.089953e-04f,
+	-9.721496e-04f,
+	3.047013e-03f,
+	-7.820648e-03f,
+	1.704880e-02f,
+	-3.535060e-02f,
+	7.927631e-02f,
+	-4.067304e-01f,
+	-7.868930e-02f,
+	3.518802e-02f,
+	-1.697319e-02f,
+	7.781812e-03f,
+	-3.028085e-03f,
+	9.641339e-04f,
+	-1.064065e-04f,
+	-3.442846e-08f,
+
+	1.112602e-04f,
+	-9.852358e-04f,
+	3.088845e-03f,
+	-7.925516e-03f,
+	1.727875e-02f,
+	-3.583097e-02f,
+	8.040853e-02f,
+	-4.221564e-01f,
+	-8.006639e-02f,
+	3.573610e-02f,
+	-1.723462e-02f,
+	7.902848e-03f,
+	-3.077798e-03f,
+	9.805576e-04f,
+	-1.097495e-04f,
+	-1.682280e-08f,
+
+	1.131913e-04f,
+	-9.962125e-04f,
+	3.123753e-03f,
+	-8.012786e-03f,
+	1.746983e-02f,
+	-3.623020e-02f,
+	8.135407e-02f,
+	-4.376472e-01f,
+	-8.117680e-02f,
+	3.618100e-02f,
+	-1.744694e-02f,
+	8.001028e-03f,
+	-3.118023e-03f,
+	9.937859e-04f,
+	-1.124078e-04f,
+	-7.045424e-09f,
+
+	1.147541e-04f,
+	-1.004956e-03f,
+	3.151418e-03f,
+	-8.081762e-03f,
+	1.762064e-02f,
+	-3.654535e-02f,
+	8.210418e-02f,
+	-4.531899e-01f,
+	-8.202758e-02f,
+	3.652408e-02f,
+	-1.761074e-02f,
+	8.076676e-03f,
+	-3.148939e-03f,
+	1.003906e-03f,
+	-1.144152e-04f,
+	-2.331968e-09f,
+
+	1.159135e-04f,
+	-1.011344e-03f,
+	3.171531e-03f,
+	-8.131779e-03f,
+	1.772985e-02f,
+	-3.677361e-02f,
+	8.265020e-02f,
+	-4.687716e-01f,
+	-8.262599e-02f,
+	3.676688e-02f,
+	-1.772672e-02f,
+	8.130170e-03f,
+	-3.170747e-03f,
+	1.011012e-03f,
+	-1.158064e-04f,
+	-5.181455e-10f,
+
+	1.166341e-04f,
+	-1.015258e-03f,
+	3.183796e-03f,
+	-8.162203e-03f,
+	1.779619e-02f,
+	-3.691230e-02f,
+	8.298364e-02f,
+	-4.843793e-01f,
+	-8.297960e-02f,
+	3.691118e-02f,
+	-1.779567e-02f,
+	8.161936e-03f,
+	-3.183666e-03f,
+	1.015203e-03f,
+	-1.166162e-04f,
+	-5.178280e-11f,
+
+	1.168802e-04f,
+	-1.016582e-03f,
+	3.187931e-03f,
+	-8.172441e-03f,
+	1.781850e-02f,
+	-3.695894e-02f,
+	8.309616e-02f,
+	-5.000000e-01f,
+	-8.309616e-02f,
+	3.695894e-02f,
+	-1.781850e-02f,
+	8.172441e-03f,
+	-3.187931e-03f,
+	1.016582e-03f,
+	-1.168802e-04f,
+	-1.332268e-15f
+};
+
+// blepd2 table: 1040 entries
+const float blepd2[] = {
+	-2.112476e-36f,
+	1.866882e-04f,
+	1.102995e-03f,
+	-3.798522e-03f,
+	-1.387084e-02f,
+	1.505360e-02f,
+	6.475049e-02f,
+	-7.185584e-02f,
+	5.000000e-01f,
+	7.185584e-02f,
+	-6.475049e-02f,
+	-1.505360e-02f,
+	1.387084e-02f,
+	3.798522e-03f,
+	-1.102995e-03f,
+	-1.866882e-04f,
+
+	2.589133e-11f,
+	1.972610e-04f,
+	1.102305e-03f,
+	-3.970957e-03f,
+	-1.386559e-02f,
+	1.597823e-02f,
+	6.472661e-02f,
+	-7.656299e-02f,
+	4.921906e-01f,
+	6.723087e-02f,
+	-6.472717e-02f,
+	-1.413961e-02f,
+	1.386572e-02f,
+	3.628749e-03f,
+	-1.102333e-03f,
+	-1.764794e-04f,
+
+	2.592654e-10f,
+	2.081990e-04f,
+	1.100209e-03f,
+	-4.145982e-03f,
+	-1.384970e-02f,
+	1.691304e-02f,
+	6.465442e-02f,
+	-8.135195e-02f,
+	4.843831e-01f,
+	6.268845e-02f,
+	-6.465778e-02f,
+	-1.323668e-02f,
+	1.385050e-02f,
+	3.461706e-03f,
+	-1.100375e-03f,
+	-1.666326e-04f,
+
+	1.168074e-09f,
+	2.195032e-04f,
+	1.096649e-03f,
+	-4.323517e-03f,
+	-1.382290e-02f,
+	1.785757e-02f,
+	6.453279e-02f,
+	-8.622229e-02f,
+	4.765792e-01f,
+	5.822890e-02f,
+	-6.454345e-02f,
+	-1.234523e-02f,
+	1.382545e-02f,
+	3.297459e-03f,
+	-1.097175e-03f,
+	-1.571452e-04f,
+
+	3.534060e-09f,
+	2.311736e-04f,
+	1.091571e-03f,
+	-4.503482e-03f,
+	-1.378494e-02f,
+	1.881133e-02f,
+	6.436063e-02f,
+	-9.117355e-02f,
+	4.687806e-01f,
+	5.385250e-02f,
+	-6.438530e-02f,
+	-1.146565e-02f,
+	1.379083e-02f,
+	3.136066e-03f,
+	-1.092787e-03f,
+	-1.480144e-04f,
+
+	8.453878e-09f,
+	2.432099e-04f,
+	1.084916e-03f,
+	-4.685790e-03f,
+	-1.373555e-02f,
+	1.977382e-02f,
+	6.413683e-02f,
+	-9.620523e-02f,
+	4.609894e-01f,
+	4.955949e-02f,
+	-6.418447e-02f,
+	-1.059834e-02f,
+	1.374693e-02f,
+	2.977583e-03f,
+	-1.087266e-03f,
+	-1.392367e-04f,
+
+	1.733968e-08f,
+	2.556109e-04f,
+	1.076629e-03f,
+	-4.870349e-03f,
+	-1.367448e-02f,
+	2.074451e-02f,
+	6.386028e-02f,
+	-1.013168e-01f,
+	4.532071e-01f,
+	4.535009e-02f,
+	-6.394210e-02f,
+	-9.743635e-03f,
+	1.369402e-02f,
+	2.822061e-03f,
+	-1.080663e-03f,
+	-1.308080e-04f,
+
+	3.191915e-08f,
+	2.683748e-04f,
+	1.066653e-03f,
+	-5.057061e-03f,
+	-1.360147e-02f,
+	2.172287e-02f,
+	6.352992e-02f,
+	-1.065077e-01f,
+	4.454357e-01f,
+	4.122448e-02f,
+	-6.365932e-02f,
+	-8.901895e-03f,
+	1.363237e-02f,
+	2.669547e-03f,
+	-1.073031e-03f,
+	-1.227239e-04f,
+
+	5.423503e-08f,
+	2.814993e-04f,
+	1.054930e-03f,
+	-5.245827e-03f,
+	-1.351628e-02f,
+	2.270834e-02f,
+	6.314465e-02f,
+	-1.117774e-01f,
+	4.376768e-01f,
+	3.718281e-02f,
+	-6.333727e-02f,
+	-8.073442e-03f,
+	1.356226e-02f,
+	2.520083e-03f,
+	-1.064423e-03f,
+	-1.149798e-04f,
+
+	8.664409e-08f,
+	2.949810e-04f,
+	1.041404e-03f,
+	-5.436540e-03f,
+	-1.341866e-02f,
+	2.370034e-02f,
+	6.270342e-02f,
+	-1.171252e-01f,
+	4.299324e-01f,
+	3.322518e-02f,
+	-6.297708e-02f,
+	-7.258586e-03f,
+	1.348397e-02f,
+	2.373709e-03f,
+	-1.054888e-03f,
+	-1.075702e-04f,
+
+	1.318155e-07f,
+	3.088160e-04f,
+	1.026017e-03f,
+	-5.629090e-03f,
+	-1.330837e-02f,
+	2.469829e-02f,
+	6.220517e-02f,
+	-1.225504e-01f,
+	4.222042e-01f,
+	2.935168e-02f,
+	-6.257991e-02f,
+	-6.457619e-03f,
+	1.339777e-02f,
+	2.230459e-03f,
+	-1.044476e-03f,
+	-1.004898e-04f,
+
+	1.927288e-07f,
+	3.229996e-04f,
+	1.008713e-03f,
+	-5.823361e-03f,
+	-1.318517e-02f,
+	2.570157e-02f,
+	6.164883e-02f,
+	-1.280524e-01f,
+	4.144939e-01f,
+	2.556235e-02f,
+	-6.214688e-02f,
+	-5.670818e-03f,
+	1.330393e-02f,
+	2.090364e-03f,
+	-1.033238e-03f,
+	-9.373249e-05f,
+
+	2.726710e-07f,
+	3.375264e-04f,
+	9.894338e-04f,
+	-6.019233e-03f,
+	-1.304884e-02f,
+	2.670955e-02f,
+	6.103338e-02f,
+	-1.336303e-01f,
+	4.068033e-01f,
+	2.185719e-02f,
+	-6.167912e-02f,
+	-4.898439e-03f,
+	1.320274e-02f,
+	1.953449e-03f,
+	-1.021222e-03f,
+	-8.729205e-05f,
+
+	3.752336e-07f,
+	3.523899e-04f,
+	9.681240e-04f,
+	-6.216581e-03f,
+	-1.289914e-02f,
+	2.772159e-02f,
+	6.035780e-02f,
+	-1.392835e-01f,
+	3.991342e-01f,
+	1.823618e-02f,
+	-6.117777e-02f,
+	-4.140725e-03f,
+	1.309446e-02f,
+	1.819740e-03f,
+	-1.008474e-03f,
+	-8.116192e-05f,
+
+	5.043086e-07f,
+	3.675831e-04f,
+	9.447268e-04f,
+	-6.415273e-03f,
+	-1.273585e-02f,
+	2.873702e-02f,
+	5.962106e-02f,
+	-1.450112e-01f,
+	3.914882e-01f,
+	1.469927e-02f,
+	-6.064396e-02f,
+	-3.397903e-03f,
+	1.297937e-02f,
+	1.689254e-03f,
+	-9.950430e-04f,
+	-7.533526e-05f,
+
+	6.640840e-07f,
+	3.830979e-04f,
+	9.191862e-04f,
+	-6.615176e-03f,
+	-1.255876e-02f,
+	2.975517e-02f,
+	5.882218e-02f,
+	-1.508124e-01f,
+	3.838672e-01f,
+	1.124635e-02f,
+	-6.007881e-02f,
+	-2.670181e-03f,
+	1.285774e-02f,
+	1.562009e-03f,
+	-9.809737e-04f,
+	-6.980496e-05f,
+
+	8.590394e-07f,
+	3.989255e-04f,
+	8.914467e-04f,
+	-6.816148e-03f,
+	-1.236767e-02f,
+	3.077534e-02f,
+	5.796016e-02f,
+	-1.566864e-01f,
+	3.762729e-01f,
+	7.877321e-03f,
+	-5.948345e-02f,
+	-1.957752e-03f,
+	1.272985e-02f,
+	1.438015e-03f,
+	-9.663113e-04f,
+	-6.456368e-05f,
+
+	1.093940e-06f,
+	4.150562e-04f,
+	8.614530e-04f,
+	-7.018046e-03f,
+	-1.216236e-02f,
+	3.179680e-02f,
+	5.703405e-02f,
+	-1.626322e-01f,
+	3.687069e-01f,
+	4.592011e-03f,
+	-5.885898e-02f,
+	-1.260793e-03f,
+	1.259596e-02f,
+	1.317282e-03f,
+	-9.510997e-04f,
+	-5.960386e-05f,
+
+	1.373830e-06f,
+	4.314792e-04f,
+	8.291507e-04f,
+	-7.220720e-03f,
+	-1.194264e-02f,
+	3.281884e-02f,
+	5.604286e-02f,
+	-1.686489e-01f,
+	3.611709e-01f,
+	1.390235e-03f,
+	-5.820652e-02f,
+	-5.794663e-04f,
+	1.245633e-02f,
+	1.199815e-03f,
+	-9.353820e-04f,
+	-5.491778e-05f,
+
+	1.704028e-06f,
+	4.481831e-04f,
+	7.944859e-04f,
+	-7.424015e-03f,
+	-1.170833e-02f,
+	3.384070e-02f,
+	5.498569e-02f,
+	-1.747356e-01f,
+	3.536667e-01f,
+	-1.728227e-03f,
+	-5.752719e-02f,
+	8.608263e-05f,
+	1.231125e-02f,
+	1.085616e-03f,
+	-9.192002e-04f,
+	-5.049751e-05f,
+
+	2.090117e-06f,
+	4.651552e-04f,
+	7.574055e-04f,
+	-7.627771e-03f,
+	-1.145924e-02f,
+	3.486161e-02f,
+	5.386160e-02f,
+	-1.808911e-01f,
+	3.461958e-01f,
+	-4.763627e-03f,
+	-5.682207e-02f,
+	7.357230e-04f,
+	1.216096e-02f,
+	9.746848e-04f,
+	-9.025954e-04f,
+	-4.633499e-05f,
+
+	2.537940e-06f,
+	4.823821e-04f,
+	7.178570e-04f,
+	-7.831825e-03f,
+	-1.119519e-02f,
+	3.588079e-02f,
+	5.266967e-02f,
+	-1.871146e-01f,
+	3.387600e-01f,
+	-7.716248e-03f,
+	-5.609225e-02f,
+	1.369339e-03f,
+	1.200574e-02f,
+	8.670165e-04f,
+	-8.856075e-04f,
+	-4.242203e-05f,
+
+	3.053586e-06f,
+	4.998494e-04f,
+	6.757889e-04f,
+	-8.036006e-03f,
+	-1.091603e-02f,
+	3.689745e-02f,
+	5.140904e-02f,
+	-1.934050e-01f,
+	3.313608e-01f,
+	-1.058640e-02f,
+	-5.533883e-02f,
+	1.986831e-03f,
+	1.184583e-02f,
+	7.626041e-04f,
+	-8.682755e-04f,
+	-3.875034e-05f,
+
+	3.643390e-06f,
+	5.175417e-04f,
+	6.311508e-04f,
+	-8.240142e-03f,
+	-1.062160e-02f,
+	3.791078e-02f,
+	5.007884e-02f,
+	-1.997611e-01f,
+	3.239999e-01f,
+	-1.337444e-02f,
+	-5.456287e-02f,
+	2.588111e-03f,
+	1.168151e-02f,
+	6.614374e-04f,
+	-8.506373e-04f,
+	-3.531152e-05f,
+
+	4.313915e-06f,
+	5.354423e-04f,
+	5.838932e-04f,
+	-8.444054e-03f,
+	-1.031174e-02f,
+	3.891993e-02f,
+	4.867819e-02f,
+	-2.061818e-01f,
+	3.166789e-01f,
+	-1.608072e-02f,
+	-5.376546e-02f,
+	3.173109e-03f,
+	1.151301e-02f,
+	5.635035e-04f,
+	-8.327298e-04f,
+	-3.209713e-05f,
+
+	5.071946e-06f,
+	5.535340e-04f,
+	5.339676e-04f,
+	-8.647558e-03f,
+	-9.986315e-03f,
+	3.992407e-02f,
+	4.720629e-02f,
+	-2.126660e-01f,
+	3.093993e-01f,
+	-1.870567e-02f,
+	-5.294764e-02f,
+	3.741767e-03f,
+	1.134059e-02f,
+	4.687869e-04f,
+	-8.145887e-04f,
+	-2.909866e-05f,
+
+	5.924479e-06f,
+	5.717982e-04f,
+	4.813269e-04f,
+	-8.850466e-03f,
+	-9.645198e-03f,
+	4.092234e-02f,
+	4.566233e-02f,
+	-2.192125e-01f,
+	3.021627e-01f,
+	-2.124970e-02f,
+	-5.211047e-02f,
+	4.294040e-03f,
+	1.116450e-02f,
+	3.772691e-04f,
+	-7.962487e-04f,
+	-2.630758e-05f,
+
+	6.878709e-06f,
+	5.902153e-04f,
+	4.259254e-04f,
+	-9.052588e-03f,
+	-9.288267e-03f,
+	4.191386e-02f,
+	4.404551e-02f,
+	-2.258201e-01f,
+	2.949706e-01f,
+	-2.371329e-02f,
+	-5.125498e-02f,
+	4.829899e-03f,
+	1.098499e-02f,
+	2.889292e-04f,
+	-7.777435e-04f,
+	-2.371536e-05f,
+
+	7.942022e-06f,
+	6.087649e-04f,
+	3.677183e-04f,
+	-9.253724e-03f,
+	-8.915409e-03f,
+	4.289773e-02f,
+	4.235507e-02f,
+	-2.324876e-01f,
+	2.878246e-01f,
+	-2.609691e-02f,
+	-5.038221e-02f,
+	5.349327e-03f,
+	1.080229e-02f,
+	2.037439e-04f,
+	-7.591055e-04f,
+	-2.131346e-05f,
+
+	9.121976e-06f,
+	6.274253e-04f,
+	3.066629e-04f,
+	-9.453674e-03f,
+	-8.526523e-03f,
+	4.387306e-02f,
+	4.059026e-02f,
+	-2.392136e-01f,
+	2.807260e-01f,
+	-2.840109e-02f,
+	-4.949318e-02f,
+	5.852321e-03f,
+	1.061664e-02f,
+	1.216874e-04f,
+	-7.403662e-04f,
+	-1.909337e-05f,
+
+	1.042630e-05f,
+	6.461737e-04f,
+	2.427176e-04f,
+	-9.652232e-03f,
+	-8.121518e-03f,
+	4.483893e-02f,
+	3.875037e-02f,
+	-2.459970e-01f,
+	2.736765e-01f,
+	-3.062638e-02f,
+	-4.858889e-02f,
+	6.338889e-03f,
+	1.042828e-02f,
+	4.273180e-05f,
+	-7.215560e-04f,
+	-1.704663e-05f,
+
+	1.186285e-05f,
+	6.649864e-04f,
+	1.758426e-04f,
+	-9.849187e-03f,
+	-7.700316e-03f,
+	4.579439e-02f,
+	3.683470e-02f,
+	-2.528363e-01f,
+	2.666774e-01f,
+	-3.277334e-02f,
+	-4.767034e-02f,
+	6.809053e-03f,
+	1.023743e-02f,
+	-3.315321e-05f,
+	-7.027040e-04f,
+	-1.516484e-05f,
+
+	1.343966e-05f,
+	6.838384e-04f,
+	1.059999e-04f,
+	-1.004433e-02f,
+	-7.262846e-03f,
+	4.673852e-02f,
+	3.484257e-02f,
+	-2.597302e-01f,
+	2.597302e-01f,
+	-3.484257e-02f,
+	-4.673852e-02f,
+	7.262846e-03f,
+	1.004433e-02f,
+	-1.059999e-04f,
+	-6.838384e-04f,
+	-1.343966e-05f,
+
+	1.516484e-05f,
+	7.027040e-04f,
+	3.315321e-05f,
+	-1.023743e-02f,
+	-6.809053e-03f,
+	4.767034e-02f,
+	3.277334e-02f,
+	-2.666774e-01f,
+	2.528363e-01f,
+	-3.683470e-02f,
+	-4.579439e-02f,
+	7.700316e-03f,
+	9.849187e-03f,
+	-1.758426e-04f,
+	-6.649864e-04f,
+	-1.186285e-05f,
+
+	1.704663e-05f,
+	7.215560e-04f,
+	-4.273180e-05f,
+	-1.042828e-02f,
+	-6.338889e-03f,
+	4.858889e-02f,
+	3.062638e-02f,
+	-2.736765e-01f,
+	2.459970e-01f,
+	-3.875037e-02f,
+	-4.483893e-02f,
+	8.121518e-03f,
+	9.652232e-03f,
+	-2.427176e-04f,
+	-6.461737e-04f,
+	-1.042630e-05f,
+
+	1.909337e-05f,
+	7.403662e-04f,
+	-1.216874e-04f,
+	-1.061664e-02f,
+	-5.852321e-03f,
+	4.949318e-02f,
+	2.840109e-02f,
+	-2.807260e-01f,
+	2.392136e-01f,
+	-4.059026e-02f,
+	-4.387306e-02f,
+	8.526523e-03f,
+	9.453674e-03f,
+	-3.066629e-04f,
+	-6.274253e-04f,
+	-9.121976e-06f,
+
+	2.131346e-05f,
+	7.591055e-04f,
+	-2.037439e-04f,
+	-1.080229e-02f,
+	-5.349327e-03f,
+	5.038221e-02f,
+	2.609691e-02f,
+	-2.878246e-01f,
+	2.324876e-01f,
+	-4.235507e-02f,
+	-4.289773e-02f,
+	8.915409e-03f,
+	9.253724e-03f,
+	-3.677183e-04f,
+	-6.087649e-04f,
+	-7.942022e-06f,
+
+	2.371536e-05f,
+	7.777435e-04f,
+	-2.889292e-04f,
+	-1.098499e-02f,
+	-4.829899e-03f,
+	5.125498e-02f,
+	2.371329e-02f,
+	-2.949706e-01f,
+	2.258201e-01f,
+	-4.404551e-02f,
+	-4.191386e-02f,
+	9.288267e-03f,
+	9.052588e-03f,
+	-4.259254e-04f,
+	-5.902153e-04f,
+	-6.878709e-06f,
+
+	2.630758e-05f,
+	7.962487e-04f,
+	-3.772691e-04f,
+	-1.116450e-02f,
+	-4.294040e-03f,
+	5.211047e-02f,
+	2.124970e-02f,
+	-3.021627e-01f,
+	2.192125e-01f,
+	-4.566233e-02f,
+	-4.092234e-02f,
+	9.645198e-03f,
+	8.850466e-03f,
+	-4.813269e-04f,
+	-5.717982e-04f,
+	-5.924479e-06f,
+
+	2.909866e-05f,
+	8.145887e-04f,
+	-4.687869e-04f,
+	-1.134059e-02f,
+	-3.741767e-03f,
+	5.294764e-02f,
+	1.870567e-02f,
+	-3.093993e-01f,
+	2.126660e-01f,
+	-4.720629e-02f,
+	-3.992407e-02f,
+	9.986315e-03f,
+	8.647558e-03f,
+	-5.339676e-04f,
+	-5.535340e-04f,
+	-5.071946e-06f,
+
+	3.209713e-05f,
+	8.327298e-04f,
+	-5.635035e-04f,
+	-1.151301e-02f,
+	-3.173109e-03f,
+	5.376546e-02f,
+	1.608072e-02f,
+	-3.166789e-01f,
+	2.061818e-01f,
+	-4.867819e-02f,
+	-3.891993e-02f,
+	1.031174e-02f,
+	8.444054e-03f,
+	-5.838932e-04f,
+	-5.354423e-04f,
+	-4.313915e-06f,
+
+	3.531152e-05f,
+	8.506373e-04f,
+	-6.614374e-04f,
+	-1.168151e-02f,
+	-2.588111e-03f,
+	5.456287e-02f,
+	1.337444e-02f,
+	-3.239999e-01f,
+	1.997611e-01f,
+	-5.007884e-02f,
+	-3.791078e-02f,
+	1.062160e-02f,
+	8.240142e-03f,
+	-6.311508e-04f,
+	-5.175417e-04f,
+	-3.643390e-06f,
+
+	3.875034e-05f,
+	8.682755e-04f,
+	-7.626041e-04f,
+	-1.184583e-02f,
+	-1.986831e-03f,
+	5.533883e-02f,
+	1.058640e-02f,
+	-3.313608e-01f,
+	1.934050e-01f,
+	-5.140904e-02f,
+	-3.689745e-02f,
+	1.091603e-02f,
+	8.036006e-03f,
+	-6.757889e-04f,
+	-4.998494e-04f,
+	-3.053586e-06f,
+
+	4.242203e-05f,
+	8.856075e-04f,
+	-8.670165e-04f,
+	-1.200574e-02f,
+	-1.369339e-03f,
+	5.609225e-02f,
+	7.716248e-03f,
+	-3.387600e-01f,
+	1.871146e-01f,
+	-5.266967e-02f,
+	-3.588079e-02f,
+	1.119519e-02f,
+	7.831825e-03f,
+	-7.178570e-04f,
+	-4.823821e-04f,
+	-2.537940e-06f,
+
+	4.633499e-05f,
+	9.025954e-04f,
+	-9.746848e-04f,
+	-1.216096e-02f,
+	-7.357230e-04f,
+	5.682207e-02f,
+	4.763627e-03f,
+	-3.461958e-01f,
+	1.808911e-01f,
+	-5.386160e-02f,
+	-3.486161e-02f,
+	1.145924e-02f,
+	7.627771e-03f,
+	-7.574055e-04f,
+	-4.651552e-04f,
+	-2.090117e-06f,
+
+	5.049751e-05f,
+	9.192002e-04f,
+	-1.085616e-03f,
+	-1.231125e-02f,
+	-8.608263e-05f,
+	5.752719e-02f,
+	1.728227e-03f,
+	-3.536667e-01f,
+	1.747356e-01f,
+	-5.498569e-02f,
+	-3.384070e-02f,
+	1.170833e-02f,
+	7.424015e-03f,
+	-7.944859e-04f,
+	-4.481831e-04f,
+	-1.704028e-06f,
+
+	5.491778e-05f,
+	9.353820e-04f,
+	-1.199815e-03f,
+	-1.245633e-02f,
+	5.794663e-04f,
+	5.820652e-02f,
+	-1.390235e-03f,
+	-3.611709e-01f,
+	1.686489e-01f,
+	-5.604286e-02f,
+	-3.281884e-02f,
+	1.194264e-02f,
+	7.220720e-03f,
+	-8.291507e-04f,
+	-4.314792e-04f,
+	-1.373830e-06f,
+
+	5.960386e-05f,
+	9.510997e-04f,
+	-1.317282e-03f,
+	-1.259596e-02f,
+	1.260793e-03f,
+	5.885898e-02f,
+	-4.592011e-03f,
+	-3.687069e-01f,
+	1.626322e-01f,
+	-5.703405e-02f,
+	-3.179680e-02f,
+	1.216236e-02f,
+	7.018046e-03f,
+	-8.614530e-04f,
+	-4.150562e-04f,
+	-1.093940e-06f,
+
+	6.456368e-05f,
+	9.663113e-04f,
+	-1.438015e-03f,
+	-1.272985e-02f,
+	1.957752e-03f,
+	5.948345e-02f,
+	-7.877321e-03f,
+	-3.762729e-01f,
+	1.566864e-01f,
+	-5.796016e-02f,
+	-3.077534e-02f,
+	1.236767e-02f,
+	6.816148e-03f,
+	-8.914467e-04f,
+	-3.989255e-04f,
+	-8.590394e-07f,
+
+	6.980496e-05f,
+	9.809737e-04f,
+	-1.562009e-03f,
+	-1.285774e-02f,
+	2.670181e-03f,
+	6.007881e-02f,
+	-1.124635e-02f,
+	-3.838672e-01f,
+	1.508124e-01f,
+	-5.882218e-02f,
+	-2.975517e-02f,
+	1.255876e-02f,
+	6.615176e-03f,
+	-9.191862e-04f,
+	-3.830979e-04f,
+	-6.640840e-07f,
+
+	7.533526e-05f,
+	9.950430e-04f,
+	-1.689254e-03f,
+	-1.297937e-02f,
+	3.397903e-03f,
+	6.064396e-02f,
+	-1.469927e-02f,
+	-3.914882e-01f,
+	1.450112e-01f,
+	-5.962106e-02f,
+	-2.873702e-02f,
+	1.273585e-02f,
+	6.415273e-03f,
+	-9.447268e-04f,
+	-3.675831e-04f,
+	-5.043086e-07f,
+
+	8.116192e-05f,
+	1.008474e-03f,
+	-1.819740e-03f,
+	-1.309446e-02f,
+	4.140725e-03f,
+	6.117777e-02f,
+	-1.823618e-02f,
+	-3.991342e-01f,
+	1.392835e-01f,
+	-6.035780e-02f,
+	-2.772159e-02f,
+	1.289914e-02f,
+	6.216581e-03f,
+	-9.681240e-04f,
+	-3.523899e-04f,
+	-3.752336e-07f,
+
+	8.729205e-05f,
+	1.021222e-03f,
+	-1.953449e-03f,
+	-1.320274e-02f,
+	4.898439e-03f,
+	6.167912e-02f,
+	-2.185719e-02f,
+	-4.068033e-01f,
+	1.336303e-01f,
+	-6.103338e-02f,
+	-2.670955e-02f,
+	1.304884e-02f,
+	6.019233e-03f,
+	-9.894338e-04f,
+	-3.375264e-04f,
+	-2.726710e-07f,
+
+	9.373249e-05f,
+	1.033238e-03f,
+	-2.090364e-03f,
+	-1.330393e-02f,
+	5.670818e-03f,
+	6.214688e-02f,
+	-2.556235e-02f,
+	-4.144939e-01f,
+	1.280524e-01f,
+	-6.164883e-02f,
+	-2.570157e-02f,
+	1.318517e-02f,
+	5.823361e-03f,
+	-1.008713e-03f,
+	-3.229996e-04f,
+	-1.927288e-07f,
+
+	1.004898e-04f,
+	1.044476e-03f,
+	-2.230459e-03f,
+	-1.339777e-02f,
+	6.457619e-03f,
+	6.257991e-02f,
+	-2.935168e-02f,
+	-4.222042e-01f,
+	1.225504e-01f,
+	-6.220517e-02f,
+	-2.469829e-02f,
+	1.330837e-02f,
+	5.629090e-03f,
+	-1.026017e-03f,
+	-3.088160e-04f,
+	-1.318155e-07f,
+
+	1.075702e-04f,
+	1.054888e-03f,
+	-2.373709e-03f,
+	-1.348397e-02f,
+	7.258586e-03f,
+	6.297708e-02f,
+	-3.322518e-02f,
+	-4.299324e-01f,
+	1.171252e-01f,
+	-6.270342e-02f,
+	-2.370034e-02f,
+	1.341866e-02f,
+	5.436540e-03f,
+	-1.041404e-03f,
+	-2.949810e-04f,
+	-8.664409e-08f,
+
+	1.149798e-04f,
+	1.064423e-03f,
+	-2.520083e-03f,
+	-1.356226e-02f,
+	8.073442e-03f,
+	6.333727e-02f,
+	-3.718281e-02f,
+	-4.376768e-01f,
+	1.117774e-01f,
+	-6.314465e-02f,
+	-2.270834e-02f,
+	1.351628e-02f,
+	5.245827e-03f,
+	-1.054930e-03f,
+	-2.814993e-04f,
+	-5.423503e-08f,
+
+	1.227239e-04f,
+	1.073031e-03f,
+	-2.669547e-03f,
+	-1.363237e-02f,
+	8.901895e-03f,
+	6.365932e-02f,
+	-4.122448e-02f,
+	-4.454357e-01f,
+	1.065077e-01f,
+	-6.352992e-02f,
+	-2.172287e-02f,
+	1.360147e-02f,
+	5.057061e-03f,
+	-1.066653e-03f,
+	-2.683748e-04f,
+	-3.191915e-08f,
+
+	1.308080e-04f,
+	1.080663e-03f,
+	-2.822061e-03f,
+	-1.369402e-02f,
+	9.743635e-03f,
+	6.394210e-02f,
+	-4.535009e-02f,
+	-4.532071e-01f,
+	1.013168e-01f,
+	-6.386028e-02f,
+	-2.074451e-02f,
+	1.367448e-02f,
+	4.870349e-03f,
+	-1.076629e-03f,
+	-2.556109e-04f,
+	-1.733968e-08f,
+
+	1.392367e-04f,
+	1.087266e-03f,
+	-2.977583e-03f,
+	-1.374693e-02f,
+	1.059834e-02f,
+	6.418447e-02f,
+	-4.955949e-02f,
+	-4.609894e-01f,
+	9.620523e-02f,
+	-6.413683e-02f,
+	-1.977382e-02f,
+	1.373555e-02f,
+	4.685790e-03f,
+	-1.084916e-03f,
+	-2.432099e-04f,
+	-8.453879e-09f,
+
+	1.480144e-04f,
+	1.092787e-03f,
+	-3.136066e-03f,
+	-1.379083e-02f,
+	1.146565e-02f,
+	6.438530e-02f,
+	-5.385250e-02f,
+	-4.687806e-01f,
+	9.117355e-02f,
+	-6.436063e-02f,
+	-1.881133e-02f,
+	1.378494e-02f,
+	4.503482e-03f,
+	-1.091571e-03f,
+	-2.311736e-04f,
+	-3.534061e-09f,
+
+	1.571452e-04f,
+	1.097175e-03f,
+	-3.297459e-03f,
+	-1.382545e-02f,
+	1.234523e-02f,
+	6.454345e-02f,
+	-5.822890e-02f,
+	-4.765792e-01f,
+	8.622229e-02f,
+	-6.453279e-02f,
+	-1.785757e-02f,
+	1.382290e-02f,
+	4.323517e-03f,
+	-1.096649e-03f,
+	-2.195032e-04f,
+	-1.168075e-09f,
+
+	1.666326e-04f,
+	1.100375e-03f,
+	-3.461706e-03f,
+	-1.385050e-02f,
+	1.323668e-02f,
+	6.465778e-02f,
+	-6.268845e-02f,
+	-4.843831e-01f,
+	8.135195e-02f,
+	-6.465442e-02f,
+	-1.691304e-02f,
+	1.384970e-02f,
+	4.145982e-03f,
+	-1.100209e-03f,
+	-2.081990e-04f,
+	-2.592666e-10f,
+
+	1.764794e-04f,
+	1.102333e-03f,
+	-3.628749e-03f,
+	-1.386572e-02f,
+	1.413961e-02f,
+	6.472717e-02f,
+	-6.723087e-02f,
+	-4.921906e-01f,
+	7.656299e-02f,
+	-6.472661e-02f,
+	-1.597823e-02f,
+	1.386559e-02f,
+	3.970957e-03f,
+	-1.102305e-03f,
+	-1.972610e-04f,
+	-2.589262e-11f,
+
+	1.866882e-04f,
+	1.102995e-03f,
+	-3.798522e-03f,
+	-1.387084e-02f,
+	1.505360e-02f,
+	6.475049e-02f,
+	-7.185584e-02f,
+	-5.000000e-01f,
+	7.185584e-02f,
+	-6.475049e-02f,
+	-1.505360e-02f,
+	1.387084e-02f,
+	3.798522e-03f,
+	-1.102995e-03f,
+	-1.866882e-04f,
+	-1.332268e-15f
+};
+
+// blamp table: 1040 entries
+const float blamp[] = {
+	-4.127082e-39f,
+	4.889273e-06f,
+	-4.079188e-05f,
+	6.731489e-05f,
+	-1.842099e-04f,
+	3.002176e-04f,
+	-6.588696e-04f,
+	1.603821e-03f,
+	-1.287043e-02f,
+	1.603821e-03f,
+	-6.588696e-04f,
+	3.002176e-04f,
+	-1.842099e-04f,
+	6.731489e-05f,
+	-4.079188e-05f,
+	4.889273e-06f,
+
+	5.056789e-14f,
+	5.117297e-06f,
+	-4.277604e-05f,
+	7.353715e-05f,
+	-2.001614e-04f,
+	3.349971e-04f,
+	-7.310084e-04f,
+	1.766004e-03f,
+	-1.190913e-02f,
+	1.441633e-03f,
+	-5.867297e-04f,
+	2.654376e-04f,
+	-1.682581e-04f,
+	6.109250e-05f,
+	-3.880766e-05f,
+	4.661232e-06f,
+
+	6.071361e-13f,
+	5.344272e-06f,
+	-4.475477e-05f,
+	7.974263e-05f,
+	-2.160717e-04f,
+	3.696869e-04f,
+	-8.029597e-04f,
+	1.927728e-03f,
+	-1.097831e-02f,
+	1.279881e-03f,
+	-5.147709e-04f,
+	2.307442e-04f,
+	-1.523460e-04f,
+	5.488613e-05f,
+	-3.682855e-05f,
+	4.434135e-06f,
+
+	3.390447e-12f,
+	5.569098e-06f,
+	-4.672246e-05f,
+	8.591420e-05f,
+	-2.318987e-04f,
+	4.041961e-04f,
+	-8.745329e-04f,
+	2.088523e-03f,
+	-1.007796e-02f,
+	1.118988e-03f,
+	-4.431703e-04f,
+	1.962223e-04f,
+	-1.365125e-04f,
+	4.871137e-05f,
+	-3.485951e-05f,
+	4.208874e-06f,
+
+	1.254805e-11f,
+	5.790605e-06f,
+	-4.867333e-05f,
+	9.203429e-05f,
+	-2.475996e-04f,
+	4.384321e-04f,
+	-9.455339e-04f,
+	2.247902e-03f,
+	-9.208003e-03f,
+	9.593613e-04f,
+	-3.721004e-04f,
+	1.619542e-04f,
+	-1.207951e-04f,
+	4.258328e-05f,
+	-3.290525e-05f,
+	3.986270e-06f,
+
+	3.585686e-11f,
+	6.007555e-06f,
+	-5.060140e-05f,
+	9.808489e-05f,
+	-2.631307e-04f,
+	4.723008e-04f,
+	-1.015765e-03f,
+	2.405366e-03f,
+	-8.368351e-03f,
+	8.013900e-04f,
+	-3.017282e-04f,
+	1.280201e-04f,
+	-1.052304e-04f,
+	3.651629e-05f,
+	-3.097024e-05f,
+	3.767080e-06f,
+
+	8.590691e-11f,
+	6.218645e-06f,
+	-5.250052e-05f,
+	1.040477e-04f,
+	-2.784478e-04f,
+	5.057069e-04f,
+	-1.085027e-03f,
+	2.560401e-03f,
+	-7.558891e-03f,
+	6.454478e-04f,
+	-2.322149e-04f,
+	9.449707e-05f,
+	-8.985326e-05f,
+	3.052424e-05f,
+	-2.905873e-05f,
+	3.551986e-06f,
+
+	1.812570e-10f,
+	6.422505e-06f,
+	-5.436435e-05f,
+	1.099039e-04f,
+	-2.935058e-04f,
+	5.385540e-04f,
+	-1.153117e-03f,
+	2.712479e-03f,
+	-6.779484e-03f,
+	4.918905e-04f,
+	-1.637161e-04f,
+	6.145970e-05f,
+	-7.469744e-05f,
+	2.462033e-05f,
+	-2.717472e-05f,
+	3.341609e-06f,
+
+	3.475528e-10f,
+	6.617702e-06f,
+	-5.618644e-05f,
+	1.156347e-04f,
+	-3.082595e-04f,
+	5.707449e-04f,
+	-1.219829e-03f,
+	2.861060e-03f,
+	-6.029968e-03f,
+	3.410568e-04f,
+	-9.638106e-05f,
+	2.897946e-05f,
+	-5.979514e-05f,
+	1.881713e-05f,
+	-2.532195e-05f,
+	3.136503e-06f,
+
+	6.185983e-10f,
+	6.802743e-06f,
+	-5.796017e-05f,
+	1.212208e-04f,
+	-3.226631e-04f,
+	6.021819e-04f,
+	-1.284959e-03f,
+	3.005591e-03f,
+	-5.310154e-03f,
+	1.932676e-04f,
+	-3.035268e-05f,
+	-2.875175e-06f,
+	-4.517707e-05f,
+	1.312653e-05f,
+	-2.350394e-05f,
+	2.937155e-06f,
+
+	1.037371e-09f,
+	6.976077e-06f,
+	-5.967882e-05f,
+	1.266427e-04f,
+	-3.366705e-04f,
+	6.327669e-04f,
+	-1.348299e-03f,
+	3.145508e-03f,
+	-4.619829e-03f,
+	4.882603e-05f,
+	3.423263e-05f,
+	-3.403891e-05f,
+	-3.087244e-05f,
+	7.559730e-06f,
+	-2.172393e-05f,
+	2.743993e-06f,
+
+	1.656973e-09f,
+	7.136096e-06f,
+	-6.133554e-05f,
+	1.318810e-04f,
+	-3.502357e-04f,
+	6.624019e-04f,
+	-1.409641e-03f,
+	3.280235e-03f,
+	-3.958758e-03f,
+	-9.198242e-05f,
+	9.724525e-05f,
+	-6.444970e-05f,
+	-1.690886e-05f,
+	2.127271e-06f,
+	-1.998494e-05f,
+	2.557384e-06f,
+
+	2.541508e-09f,
+	7.281141e-06f,
+	-6.292341e-05f,
+	1.369159e-04f,
+	-3.633125e-04f,
+	6.909888e-04f,
+	-1.468778e-03f,
+	3.409186e-03f,
+	-3.326681e-03f,
+	-2.288902e-04f,
+	1.585625e-04f,
+	-9.404884e-05f,
+	-3.312357e-06f,
+	-3.161016e-06f,
+	-1.828972e-05f,
+	2.377637e-06f,
+
+	3.766877e-09f,
+	7.409505e-06f,
+	-6.443545e-05f,
+	1.417278e-04f,
+	-3.758548e-04f,
+	7.184301e-04f,
+	-1.525503e-03f,
+	3.531765e-03f,
+	-2.723316e-03f,
+	-3.616477e-04f,
+	2.180686e-04f,
+	-1.227810e-04f,
+	9.892682e-06f,
+	-8.295996e-06f,
+	-1.664078e-05f,
+	2.205003e-06f,
+
+	5.421485e-09f,
+	7.519438e-06f,
+	-6.586459e-05f,
+	1.462970e-04f,
+	-3.878167e-04f,
+	7.446289e-04f,
+	-1.579608e-03f,
+	3.647368e-03f,
+	-2.148357e-03f,
+	-4.900230e-04f,
+	2.756553e-04f,
+	-1.505945e-04f,
+	2.268352e-05f,
+	-1.326924e-05f,
+	-1.504038e-05f,
+	2.039681e-06f,
+
+	7.606848e-09f,
+	7.609147e-06f,
+	-6.720376e-05f,
+	1.506038e-04f,
+	-3.991528e-04f,
+	7.694894e-04f,
+	-1.630891e-03f,
+	3.755380e-03f,
+	-1.601478e-03f,
+	-6.138023e-04f,
+	3.312213e-04f,
+	-1.774409e-04f,
+	3.503911e-05f,
+	-1.807303e-05f,
+	-1.349055e-05f,
+	1.881820e-06f,
+
+	1.043809e-08f,
+	7.676809e-06f,
+	-6.844587e-05f,
+	1.546287e-04f,
+	-4.098182e-04f,
+	7.929168e-04f,
+	-1.679148e-03f,
+	3.855181e-03f,
+	-1.082329e-03f,
+	-7.327895e-04f,
+	3.846727e-04f,
+	-2.032755e-04f,
+	4.694005e-05f,
+	-2.270033e-05f,
+	-1.199307e-05f,
+	1.731519e-06f,
+
+	1.404436e-08f,
+	7.720568e-06f,
+	-6.958383e-05f,
+	1.583525e-04f,
+	-4.197684e-04f,
+	8.148180e-04f,
+	-1.724178e-03f,
+	3.946143e-03f,
+	-5.905397e-04f,
+	-8.468061e-04f,
+	4.359233e-04f,
+	-2.280573e-04f,
+	5.836865e-05f,
+	-2.714484e-05f,
+	-1.054950e-05f,
+	1.588830e-06f,
+
+	1.856906e-08f,
+	7.738545e-06f,
+	-7.061059e-05f,
+	1.617559e-04f,
+	-4.289600e-04f,
+	8.351015e-04f,
+	-1.765787e-03f,
+	4.027633e-03f,
+	-1.257203e-04f,
+	-9.556913e-04f,
+	4.848942e-04f,
+	-2.517487e-04f,
+	6.930893e-05f,
+	-3.140094e-05f,
+	-9.161152e-06f,
+	1.453766e-06f,
+
+	2.417005e-08f,
+	7.728842e-06f,
+	-7.151913e-05f,
+	1.648203e-04f,
+	-4.373501e-04f,
+	8.536780e-04f,
+	-1.803779e-03f,
+	4.099011e-03f,
+	3.125401e-04f,
+	-1.059302e-03f,
+	5.315138e-04f,
+	-2.743159e-04f,
+	7.974658e-05f,
+	-3.546370e-05f,
+	-7.829121e-06f,
+	1.326295e-06f,
+
+	3.101961e-08f,
+	7.689552e-06f,
+	-7.230256e-05f,
+	1.675272e-04f,
+	-4.448970e-04f,
+	8.704605e-04f,
+	-1.837967e-03f,
+	4.159634e-03f,
+	7.246711e-04f,
+	-1.157511e-03f,
+	5.757184e-04f,
+	-2.957287e-04f,
+	8.966897e-05f,
+	-3.932888e-05f,
+	-6.554289e-06f,
+	1.206351e-06f,
+
+	3.930436e-08f,
+	7.618761e-06f,
+	-7.295403e-05f,
+	1.698585e-04f,
+	-4.515603e-04f,
+	8.853646e-04f,
+	-1.868167e-03f,
+	4.208856e-03f,
+	1.111121e-03f,
+	-1.250209e-03f,
+	6.174516e-04f,
+	-3.159606e-04f,
+	9.906517e-05f,
+	-4.299290e-05f,
+	-5.337318e-06f,
+	1.093832e-06f,
+
+	4.922504e-08f,
+	7.514555e-06f,
+	-7.346684e-05f,
+	1.717968e-04f,
+	-4.573007e-04f,
+	8.983086e-04f,
+	-1.894200e-03f,
+	4.246026e-03f,
+	1.472357e-03f,
+	-1.337305e-03f,
+	6.566644e-04f,
+	-3.349886e-04f,
+	1.079259e-04f,
+	-4.645287e-05f,
+	-4.178670e-06f,
+	9.886063e-07f,
+
+	6.099604e-08f,
+	7.375031e-06f,
+	-7.383444e-05f,
+	1.733250e-04f,
+	-4.620805e-04f,
+	9.092141e-04f,
+	-1.915894e-03f,
+	4.270494e-03f,
+	1.808862e-03f,
+	-1.418723e-03f,
+	6.933153e-04f,
+	-3.527932e-04f,
+	1.162434e-04f,
+	-4.970652e-05f,
+	-3.078605e-06f,
+	8.905114e-07f,
+
+	7.484490e-08f,
+	7.198303e-06f,
+	-7.405045e-05f,
+	1.744268e-04f,
+	-4.658634e-04f,
+	9.180062e-04f,
+	-1.933083e-03f,
+	4.281607e-03f,
+	2.121135e-03f,
+	-1.494401e-03f,
+	7.273702e-04f,
+	-3.693589e-04f,
+	1.240119e-04f,
+	-5.275222e-05f,
+	-2.037196e-06f,
+	7.993604e-07f,
+
+	9.101165e-08f,
+	6.982506e-06f,
+	-7.410868e-05f,
+	1.750865e-04f,
+	-4.686149e-04f,
+	9.246136e-04f,
+	-1.945608e-03f,
+	4.278712e-03f,
+	2.409694e-03f,
+	-1.564297e-03f,
+	7.588022e-04f,
+	-3.846731e-04f,
+	1.312267e-04f,
+	-5.558899e-05f,
+	-1.054329e-06f,
+	7.149432e-07f,
+
+	1.097479e-07f,
+	6.725812e-06f,
+	-7.400320e-05f,
+	1.752891e-04f,
+	-4.703023e-04f,
+	9.289690e-04f,
+	-1.953318e-03f,
+	4.261158e-03f,
+	2.675069e-03f,
+	-1.628383e-03f,
+	7.875917e-04f,
+	-3.987273e-04f,
+	1.378850e-04f,
+	-5.821641e-05f,
+	-1.297190e-07f,
+	6.370298e-07f,
+
+	1.313161e-07f,
+	6.426427e-06f,
+	-7.372828e-05f,
+	1.750204e-04f,
+	-4.708950e-04f,
+	9.310093e-04f,
+	-1.956072e-03f,
+	4.228296e-03f,
+	2.917804e-03f,
+	-1.686644e-03f,
+	8.137260e-04f,
+	-4.115159e-04f,
+	1.439855e-04f,
+	-6.063467e-05f,
+	7.370868e-07f,
+	5.653728e-07f,
+
+	1.559879e-07f,
+	6.082612e-06f,
+	-7.327848e-05f,
+	1.742671e-04f,
+	-4.703643e-04f,
+	9.306759e-04f,
+	-1.953735e-03f,
+	4.179477e-03f,
+	3.138457e-03f,
+	-1.739084e-03f,
+	8.371993e-04f,
+	-4.230368e-04f,
+	1.495284e-04f,
+	-6.284451e-05f,
+	1.546698e-06f,
+	4.997104e-07f,
+
+	1.840435e-07f,
+	5.692682e-06f,
+	-7.264869e-05f,
+	1.730168e-04f,
+	-4.686838e-04f,
+	9.279150e-04f,
+	-1.946183e-03f,
+	4.114059e-03f,
+	3.337601e-03f,
+	-1.785717e-03f,
+	8.580129e-04f,
+	-4.332915e-04f,
+	1.545151e-04f,
+	-6.484721e-05f,
+	2.299874e-06f,
+	4.397690e-07f,
+
+	2.157696e-07f,
+	5.255019e-06f,
+	-7.183410e-05f,
+	1.712581e-04f,
+	-4.658297e-04f,
+	9.226776e-04f,
+	-1.933301e-03f,
+	4.031403e-03f,
+	3.515816e-03f,
+	-1.826574e-03f,
+	8.761745e-04f,
+	-4.422841e-04f,
+	1.589486e-04f,
+	-6.664459e-05f,
+	2.997512e-06f,
+	3.852653e-07f,
+
+	2.514586e-07f,
+	4.768081e-06f,
+	-7.083027e-05f,
+	1.689807e-04f,
+	-4.617802e-04f,
+	9.149202e-04f,
+	-1.914987e-03f,
+	3.930874e-03f,
+	3.673697e-03f,
+	-1.861698e-03f,
+	8.916982e-04f,
+	-4.500222e-04f,
+	1.628335e-04f,
+	-6.823897e-05f,
+	3.640641e-06f,
+	3.359092e-07f,
+
+	2.914060e-07f,
+	4.230410e-06f,
+	-6.963311e-05f,
+	1.661752e-04f,
+	-4.565165e-04f,
+	9.046046e-04f,
+	-1.891146e-03f,
+	3.811845e-03f,
+	3.811845e-03f,
+	-1.891146e-03f,
+	9.046046e-04f,
+	-4.565165e-04f,
+	1.661752e-04f,
+	-6.963311e-05f,
+	4.230410e-06f,
+	2.914060e-07f,
+
+	3.359092e-07f,
+	3.640641e-06f,
+	-6.823897e-05f,
+	1.628335e-04f,
+	-4.500222e-04f,
+	8.916982e-04f,
+	-1.861698e-03f,
+	3.673697e-03f,
+	3.930874e-03f,
+	-1.914987e-03f,
+	9.149202e-04f,
+	-4.617802e-04f,
+	1.689807e-04f,
+	-7.083027e-05f,
+	4.768081e-06f,
+	2.514586e-07f,
+
+	3.852653e-07f,
+	2.997512e-06f,
+	-6.664459e-05f,
+	1.589486e-04f,
+	-4.422841e-04f,
+	8.761745e-04f,
+	-1.826574e-03f,
+	3.515816e-03f,
+	4.031403e-03f,
+	-1.933301e-03f,
+	9.226776e-04f,
+	-4.658297e-04f,
+	1.712581e-04f,
+	-7.183410e-05f,
+	5.255019e-06f,
+	2.157696e-07f,
+
+	4.397690e-07f,
+	2.299874e-06f,
+	-6.484721e-05f,
+	1.545151e-04f,
+	-4.332915e-04f,
+	8.580129e-04f,
+	-1.785717e-03f,
+	3.337601e-03f,
+	4.114059e-03f,
+	-1.946183e-03f,
+	9.279150e-04f,
+	-4.686838e-04f,
+	1.730168e-04f,
+	-7.264869e-05f,
+	5.692682e-06f,
+	1.840435e-07f,
+
+	4.997104e-07f,
+	1.546698e-06f,
+	-6.284451e-05f,
+	1.495284e-04f,
+	-4.230368e-04f,
+	8.371993e-04f,
+	-1.739084e-03f,
+	3.138457e-03f,
+	4.179477e-03f,
+	-1.953735e-03f,
+	9.306759e-04f,
+	-4.703643e-04f,
+	1.742671e-04f,
+	-7.327848e-05f,
+	6.082612e-06f,
+	1.559879e-07f,
+
+	5.653728e-07f,
+	7.370868e-07f,
+	-6.063467e-05f,
+	1.439855e-04f,
+	-4.115159e-04f,
+	8.137260e-04f,
+	-1.686644e-03f,
+	2.917804e-03f,
+	4.228296e-03f,
+	-1.956072e-03f,
+	9.310093e-04f,
+	-4.708950e-04f,
+	1.750204e-04f,
+	-7.372828e-05f,
+	6.426427e-06f,
+	1.313161e-07f,
+
+	6.370298e-07f,
+	-1.297190e-07f,
+	-5.821641e-05f,
+	1.378850e-04f,
+	-3.987273e-04f,
+	7.875917e-04f,
+	-1.628383e-03f,
+	2.675069e-03f,
+	4.261158e-03f,
+	-1.953318e-03f,
+	9.289690e-04f,
+	-4.703023e-04f,
+	1.752891e-04f,
+	-7.400320e-05f,
+	6.725812e-06f,
+	1.097479e-07f,
+
+	7.149432e-07f,
+	-1.054329e-06f,
+	-5.558899e-05f,
+	1.312267e-04f,
+	-3.846731e-04f,
+	7.588022e-04f,
+	-1.564297e-03f,
+	2.409694e-03f,
+	4.278712e-03f,
+	-1.945608e-03f,
+	9.246136e-04f,
+	-4.686149e-04f,
+	1.750865e-04f,
+	-7.410868e-05f,
+	6.982506e-06f,
+	9.101165e-08f,
+
+	7.993604e-07f,
+	-2.037196e-06f,
+	-5.275222e-05f,
+	1.240119e-04f,
+	-3.693589e-04f,
+	7.273702e-04f,
+	-1.494401e-03f,
+	2.121135e-03f,
+	4.281607e-03f,
+	-1.933083e-03f,
+	9.180062e-04f,
+	-4.658634e-04f,
+	1.744268e-04f,
+	-7.405045e-05f,
+	7.198303e-06f,
+	7.484490e-08f,
+
+	8.905114e-07f,
+	-3.078605e-06f,
+	-4.970652e-05f,
+	1.162434e-04f,
+	-3.527932e-04f,
+	6.933153e-04f,
+	-1.418723e-03f,
+	1.808862e-03f,
+	4.270494e-03f,
+	-1.915894e-03f,
+	9.092141e-04f,
+	-4.620805e-04f,
+	1.733250e-04f,
+	-7.383444e-05f,
+	7.375031e-06f,
+	6.099604e-08f,
+
+	9.886063e-07f,
+	-4.178670e-06f,
+	-4.645287e-05f,
+	1.079259e-04f,
+	-3.349886e-04f,
+	6.566644e-04f,
+	-1.337305e-03f,
+	1.472357e-03f,
+	4.246026e-03f,
+	-1.894200e-03f,
+	8.983086e-04f,
+	-4.573007e-04f,
+	1.717968e-04f,
+	-7.346684e-05f,
+	7.514555e-06f,
+	4.922504e-08f,
+
+	1.093832e-06f,
+	-5.337318e-06f,
+	-4.299290e-05f,
+	9.906517e-05f,
+	-3.159606e-04f,
+	6.174516e-04f,
+	-1.250209e-03f,
+	1.111121e-03f,
+	4.208856e-03f,
+	-1.868167e-03f,
+	8.853646e-04f,
+	-4.515603e-04f,
+	1.698585e-04f,
+	-7.295403e-05f,
+	7.618761e-06f,
+	3.930436e-08f,
+
+	1.206351e-06f,
+	-6.554289e-06f,
+	-3.932888e-05f,
+	8.966897e-05f,
+	-2.957287e-04f,
+	5.757184e-04f,
+	-1.157511e-03f,
+	7.246711e-04f,
+	4.159634e-03f,
+	-1.837967e-03f,
+	8.704605e-04f,
+	-4.448970e-04f,
+	1.675272e-04f,
+	-7.230256e-05f,
+	7.689552e-06f,
+	3.101961e-08f,
+
+	1.326295e-06f,
+	-7.829121e-06f,
+	-3.546370e-05f,
+	7.974658e-05f,
+	-2.743159e-04f,
+	5.315138e-04f,
+	-1.059302e-03f,
+	3.125401e-04f,
+	4.099011e-03f,
+	-1.803779e-03f,
+	8.536780e-04f,
+	-4.373501e-04f,
+	1.648203e-04f,
+	-7.151913e-05f,
+	7.728842e-06f,
+	2.417005e-08f,
+
+	1.453766e-06f,
+	-9.161152e-06f,
+	-3.140094e-05f,
+	6.930893e-05f,
+	-2.517487e-04f,
+	4.848942e-04f,
+	-9.556913e-04f,
+	-1.257203e-04f,
+	4.027633e-03f,
+	-1.765787e-03f,
+	8.351015e-04f,
+	-4.289600e-04f,
+	1.617559e-04f,
+	-7.061059e-05f,
+	7.738545e-06f,
+	1.856906e-08f,
+
+	1.588830e-06f,
+	-1.054950e-05f,
+	-2.714484e-05f,
+	5.836865e-05f,
+	-2.280573e-04f,
+	4.359233e-04f,
+	-8.468061e-04f,
+	-5.905397e-04f,
+	3.946143e-03f,
+	-1.724178e-03f,
+	8.148180e-04f,
+	-4.197684e-04f,
+	1.583525e-04f,
+	-6.958383e-05f,
+	7.720568e-06f,
+	1.404436e-08f,
+
+	1.731519e-06f,
+	-1.199307e-05f,
+	-2.270033e-05f,
+	4.694005e-05f,
+	-2.032755e-04f,
+	3.846727e-04f,
+	-7.327895e-04f,
+	-1.082329e-03f,
+	3.855181e-03f,
+	-1.679148e-03f,
+	7.929168e-04f,
+	-4.098182e-04f,
+	1.546287e-04f,
+	-6.844587e-05f,
+	7.676809e-06f,
+	1.043809e-08f,
+
+	1.881820e-06f,
+	-1.349055e-05f,
+	-1.807303e-05f,
+	3.503911e-05f,
+	-1.774409e-04f,
+	3.312213e-04f,
+	-6.138023e-04f,
+	-1.601478e-03f,
+	3.755380e-03f,
+	-1.630891e-03f,
+	7.694894e-04f,
+	-3.991528e-04f,
+	1.506038e-04f,
+	-6.720376e-05f,
+	7.609147e-06f,
+	7.606848e-09f,
+
+	2.039681e-06f,
+	-1.504038e-05f,
+	-1.326924e-05f,
+	2.268352e-05f,
+	-1.505945e-04f,
+	2.756553e-04f,
+	-4.900230e-04f,
+	-2.148357e-03f,
+	3.647368e-03f,
+	-1.579608e-03f,
+	7.446289e-04f,
+	-3.878167e-04f,
+	1.462970e-04f,
+	-6.586459e-05f,
+	7.519438e-06f,
+	5.421485e-09f,
+
+	2.205003e-06f,
+	-1.664078e-05f,
+	-8.295996e-06f,
+	9.892682e-06f,
+	-1.227810e-04f,
+	2.180686e-04f,
+	-3.616477e-04f,
+	-2.723316e-03f,
+	3.531765e-03f,
+	-1.525503e-03f,
+	7.184301e-04f,
+	-3.758548e-04f,
+	1.417278e-04f,
+	-6.443545e-05f,
+	7.409505e-06f,
+	3.766877e-09f,
+
+	2.377637e-06f,
+	-1.828972e-05f,
+	-3.161016e-06f,
+	-3.312357e-06f,
+	-9.404884e-05f,
+	1.585625e-04f,
+	-2.288902e-04f,
+	-3.326681e-03f,
+	3.409186e-03f,
+	-1.468778e-03f,
+	6.909888e-04f,
+	-3.633125e-04f,
+	1.369159e-04f,
+	-6.292341e-05f,
+	7.281141e-06f,
+	2.541508e-09f,
+
+	2.557384e-06f,
+	-1.998494e-05f,
+	2.127271e-06f,
+	-1.690886e-05f,
+	-6.444970e-05f,
+	9.724525e-05f,
+	-9.198242e-05f,
+	-3.958758e-03f,
+	3.280235e-03f,
+	-1.409641e-03f,
+	6.624019e-04f,
+	-3.502357e-04f,
+	1.318810e-04f,
+	-6.133554e-05f,
+	7.136096e-06f,
+	1.656973e-09f,
+
+	2.743993e-06f,
+	-2.172393e-05f,
+	7.559730e-06f,
+	-3.087244e-05f,
+	-3.403891e-05f,
+	3.423263e-05f,
+	4.882603e-05f,
+	-4.619829e-03f,
+	3.145508e-03f,
+	-1.348299e-03f,
+	6.327669e-04f,
+	-3.366705e-04f,
+	1.266427e-04f,
+	-5.967882e-05f,
+	6.976077e-06f,
+	1.037371e-09f,
+
+	2.937155e-06f,
+	-2.350394e-05f,
+	1.312653e-05f,
+	-4.517707e-05f,
+	-2.875175e-06f,
+	-3.035268e-05f,
+	1.932676e-04f,
+	-5.310154e-03f,
+	3.005591e-03f,
+	-1.284959e-03f,
+	6.021819e-04f,
+	-3.226631e-04f,
+	1.212208e-04f,
+	-5.796017e-05f,
+	6.802743e-06f,
+	6.185983e-10f,
+
+	3.136503e-06f,
+	-2.532195e-05f,
+	1.881713e-05f,
+	-5.979514e-05f,
+	2.897946e-05f,
+	-9.638106e-05f,
+	3.410568e-04f,
+	-6.029968e-03f,
+	2.861060e-03f,
+	-1.219829e-03f,
+	5.707449e-04f,
+	-3.082595e-04f,
+	1.156347e-04f,
+	-5.618644e-05f,
+	6.617702e-06f,
+	3.475528e-10f,
+
+	3.341609e-06f,
+	-2.717472e-05f,
+	2.462033e-05f,
+	-7.469744e-05f,
+	6.145970e-05f,
+	-1.637161e-04f,
+	4.918905e-04f,
+	-6.779484e-03f,
+	2.712479e-03f,
+	-1.153117e-03f,
+	5.385540e-04f,
+	-2.935058e-04f,
+	1.099039e-04f,
+	-5.436435e-05f,
+	6.422505e-06f,
+	1.812570e-10f,
+
+	3.551986e-06f,
+	-2.905873e-05f,
+	3.052424e-05f,
+	-8.985326e-05f,
+	9.449707e-05f,
+	-2.322149e-04f,
+	6.454478e-04f,
+	-7.558891e-03f,
+	2.560401e-03f,
+	-1.085027e-03f,
+	5.057069e-04f,
+	-2.784478e-04f,
+	1.040477e-04f,
+	-5.250052e-05f,
+	6.218645e-06f,
+	8.590691e-11f,
+
+	3.767080e-06f,
+	-3.097024e-05f,
+	3.651629e-05f,
+	-1.052304e-04f,
+	1.280201e-04f,
+	-3.017282e-04f,
+	8.013900e-04f,
+	-8.368351e-03f,
+	2.405366e-03f,
+	-1.015765e-03f,
+	4.723008e-04f,
+	-2.631307e-04f,
+	9.808489e-05f,
+	-5.060140e-05f,
+	6.007555e-06f,
+	3.585686e-11f,
+
+	3.986270e-06f,
+	-3.290525e-05f,
+	4.258328e-05f,
+	-1.207951e-04f,
+	1.619542e-04f,
+	-3.721004e-04f,
+	9.593613e-04f,
+	-9.208003e-03f,
+	2.247902e-03f,
+	-9.455339e-04f,
+	4.384321e-04f,
+	-2.475996e-04f,
+	9.203429e-05f,
+	-4.867333e-05f,
+	5.790605e-06f,
+	1.254805e-11f,
+
+	4.208874e-06f,
+	-3.485951e-05f,
+	4.871137e-05f,
+	-1.365125e-04f,
+	1.962223e-04f,
+	-4.431703e-04f,
+	1.118988e-03f,
+	-1.007796e-02f,
+	2.088523e-03f,
+	-8.745329e-04f,
+	4.041961e-04f,
+	-2.318987e-04f,
+	8.591420e-05f,
+	-4.672246e-05f,
+	5.569098e-06f,
+	3.390447e-12f,
+
+	4.434135e-06f,
+	-3.682855e-05f,
+	5.488613e-05f,
+	-1.523460e-04f,
+	2.307442e-04f,
+	-5.147709e-04f,
+	1.279881e-03f,
+	-1.097831e-02f,
+	1.927728e-03f,
+	-8.029597e-04f,
+	3.696869e-04f,
+	-2.160717e-04f,
+	7.974263e-05f,
+	-4.475477e-05f,
+	5.344272e-06f,
+	6.071361e-13f,
+
+	4.661232e-06f,
+	-3.880766e-05f,
+	6.109250e-05f,
+	-1.682581e-04f,
+	2.654376e-04f,
+	-5.867297e-04f,
+	1.441633e-03f,
+	-1.190913e-02f,
+	1.766004e-03f,
+	-7.310084e-04f,
+	3.349971e-04f,
+	-2.001614e-04f,
+	7.353715e-05f,
+	-4.277604e-05f,
+	5.117297e-06f,
+	5.056789e-14f,
+
+	4.889273e-06f,
+	-4.079188e-05f,
+	6.731489e-05f,
+	-1.842099e-04f,
+	3.002176e-04f,
+	-6.588696e-04f,
+	1.603821e-03f,
+	-1.287043e-02f,
+	1.603821e-03f,
+	-6.588696e-04f,
+	3.002176e-04f,
+	-1.842099e-04f,
+	6.731489e-05f,
+	-4.079188e-05f,
+	4.889273e-06f,
+	-4.127082e-39f
+};
+
+// blampd2 table: 1040 entries
+const float blampd2[] = {
+	-2.062965e-39f,
+	4.950531e-06f,
+	8.955666e-05f,
+	4.079550e-05f,
+	-1.167053e-03f,
+	-1.739130e-03f,
+	3.827015e-03f,
+	6.563838e-03f,
+	-2.701223e-02f,
+	6.563838e-03f,
+	3.827015e-03f,
+	-1.739130e-03f,
+	-1.167053e-03f,
+	4.079550e-05f,
+	8.955666e-05f,
+	4.950531e-06f,
+
+	2.528450e-14f,
+	5.325481e-06f,
+	9.171027e-05f,
+	3.320813e-05f,
+	-1.194140e-03f,
+	-1.708825e-03f,
+	3.953457e-03f,
+	6.418897e-03f,
+	-2.604330e-02f,
+	6.699665e-03f,
+	3.700572e-03f,
+	-1.767639e-03f,
+	-1.139967e-03f,
+	4.804870e-05f,
+	8.740302e-05f,
+	4.595875e-06f,
+
+	3.037579e-13f,
+	5.721438e-06f,
+	9.386116e-05f,
+	2.528143e-05f,
+	-1.221205e-03f,
+	-1.676705e-03f,
+	4.079806e-03f,
+	6.264683e-03f,
+	-2.508961e-02f,
+	6.826539e-03f,
+	3.574219e-03f,
+	-1.794374e-03f,
+	-1.112900e-03f,
+	5.497297e-05f,
+	8.525194e-05f,
+	4.260804e-06f,
+
+	1.697644e-12f,
+	6.139116e-06f,
+	9.600653e-05f,
+	1.701043e-05f,
+	-1.248229e-03f,
+	-1.642749e-03f,
+	4.205965e-03f,
+	6.101036e-03f,
+	-2.415117e-02f,
+	6.944622e-03f,
+	3.448046e-03f,
+	-1.819356e-03f,
+	-1.085873e-03f,
+	6.157372e-05f,
+	8.310589e-05f,
+	3.944615e-06f,
+
+	6.289571e-12f,
+	6.579230e-06f,
+	9.814346e-05f,
+	8.390313e-06f,
+	-1.275190e-03f,
+	-1.606940e-03f,
+	4.331838e-03f,
+	5.927798e-03f,
+	-2.322797e-02f,
+	7.054077e-03f,
+	3.322139e-03f,
+	-1.842609e-03f,
+	-1.058904e-03f,
+	6.785645e-05f,
+	8.096726e-05f,
+	3.646608e-06f,
+
+	1.799654e-11f,
+	7.042495e-06f,
+	1.002689e-04f,
+	-5.835859e-07f,
+	-1.302066e-03f,
+	-1.569259e-03f,
+	4.457324e-03f,
+	5.744812e-03f,
+	-2.231999e-02f,
+	7.155065e-03f,
+	3.196583e-03f,
+	-1.864156e-03f,
+	-1.032012e-03f,
+	7.382682e-05f,
+	7.883830e-05f,
+	3.366089e-06f,
+
+	4.318556e-11f,
+	7.529624e-06f,
+	1.023798e-04f,
+	-9.915752e-06f,
+	-1.328833e-03f,
+	-1.529690e-03f,
+	4.582321e-03f,
+	5.551919e-03f,
+	-2.142722e-02f,
+	7.247750e-03f,
+	3.071459e-03f,
+	-1.884021e-03f,
+	-1.005214e-03f,
+	7.949053e-05f,
+	7.672118e-05f,
+	3.102374e-06f,
+
+	9.128988e-11f,
+	8.041329e-06f,
+	1.044729e-04f,
+	-1.961049e-05f,
+	-1.355470e-03f,
+	-1.488218e-03f,
+	4.706725e-03f,
+	5.348965e-03f,
+	-2.054964e-02f,
+	7.332296e-03f,
+	2.946849e-03f,
+	-1.902229e-03f,
+	-9.785278e-04f,
+	8.485343e-05f,
+	7.461796e-05f,
+	2.854784e-06f,
+
+	1.754248e-10f,
+	8.578316e-06f,
+	1.065447e-04f,
+	-2.967190e-05f,
+	-1.381952e-03f,
+	-1.444829e-03f,
+	4.830431e-03f,
+	5.135796e-03f,
+	-1.968722e-02f,
+	7.408865e-03f,
+	2.822828e-03f,
+	-1.918807e-03f,
+	-9.519706e-04f,
+	8.992143e-05f,
+	7.253060e-05f,
+	2.622651e-06f,
+
+	3.130021e-10f,
+	9.141285e-06f,
+	1.085919e-04f,
+	-4.010390e-05f,
+	-1.408256e-03f,
+	-1.399508e-03f,
+	4.953329e-03f,
+	4.912258e-03f,
+	-1.883995e-02f,
+	7.477623e-03f,
+	2.699475e-03f,
+	-1.933780e-03f,
+	-9.255582e-04f,
+	9.470052e-05f,
+	7.046096e-05f,
+	2.405317e-06f,
+
+	5.263415e-10f,
+	9.730930e-06f,
+	1.106109e-04f,
+	-5.091018e-05f,
+	-1.434356e-03f,
+	-1.352243e-03f,
+	5.075310e-03f,
+	4.678200e-03f,
+	-1.800778e-02f,
+	7.538733e-03f,
+	2.576860e-03f,
+	-1.947174e-03f,
+	-8.993066e-04f,
+	9.919678e-05f,
+	6.841080e-05f,
+	2.202134e-06f,
+
+	8.432793e-10f,
+	1.034794e-05f,
+	1.125979e-04f,
+	-6.209422e-05f,
+	-1.460229e-03f,
+	-1.303025e-03f,
+	5.196262e-03f,
+	4.433471e-03f,
+	-1.719070e-02f,
+	7.592360e-03f,
+	2.455057e-03f,
+	-1.959018e-03f,
+	-8.732306e-04f,
+	1.034163e-04f,
+	6.638178e-05f,
+	2.012463e-06f,
+
+	1.297771e-09f,
+	1.099298e-05f,
+	1.145493e-04f,
+	-7.365925e-05f,
+	-1.485848e-03f,
+	-1.251842e-03f,
+	5.316068e-03f,
+	4.177921e-03f,
+	-1.638865e-02f,
+	7.638668e-03f,
+	2.334133e-03f,
+	-1.969340e-03f,
+	-8.473452e-04f,
+	1.073654e-04f,
+	6.437548e-05f,
+	1.835682e-06f,
+
+	1.930491e-09f,
+	1.166673e-05f,
+	1.164609e-04f,
+	-8.560828e-05f,
+	-1.511188e-03f,
+	-1.198687e-03f,
+	5.434615e-03f,
+	3.911404e-03f,
+	-1.560160e-02f,
+	7.677822e-03f,
+	2.214155e-03f,
+	-1.978167e-03f,
+	-8.216643e-04f,
+	1.110501e-04f,
+	6.239335e-05f,
+	1.671176e-06f,
+
+	2.789418e-09f,
+	1.236983e-05f,
+	1.183289e-04f,
+	-9.794408e-05f,
+	-1.536222e-03f,
+	-1.143551e-03f,
+	5.551782e-03f,
+	3.633772e-03f,
+	-1.482951e-02f,
+	7.709986e-03f,
+	2.095189e-03f,
+	-1.985529e-03f,
+	-7.962016e-04f,
+	1.144769e-04f,
+	6.043679e-05f,
+	1.518347e-06f,
+
+	3.930427e-09f,
+	1.310291e-05f,
+	1.201492e-04f,
+	-1.106691e-04f,
+	-1.560924e-03f,
+	-1.086430e-03f,
+	5.667449e-03f,
+	3.344882e-03f,
+	-1.407232e-02f,
+	7.735323e-03f,
+	1.977296e-03f,
+	-1.991455e-03f,
+	-7.709701e-04f,
+	1.176519e-04f,
+	5.850709e-05f,
+	1.376608e-06f,
+
+	5.417852e-09f,
+	1.386661e-05f,
+	1.219174e-04f,
+	-1.237857e-04f,
+	-1.585266e-03f,
+	-1.027318e-03f,
+	5.781494e-03f,
+	3.044590e-03f,
+	-1.333000e-02f,
+	7.753999e-03f,
+	1.860536e-03f,
+	-1.995975e-03f,
+	-7.459822e-04f,
+	1.205817e-04f,
+	5.660544e-05f,
+	1.245389e-06f,
+
+	7.325058e-09f,
+	1.466151e-05f,
+	1.236292e-04f,
+	-1.372956e-04f,
+	-1.609221e-03f,
+	-9.662125e-04f,
+	5.893793e-03f,
+	2.732756e-03f,
+	-1.260248e-02f,
+	7.766176e-03f,
+	1.744967e-03f,
+	-1.999118e-03f,
+	-7.212500e-04f,
+	1.232724e-04f,
+	5.473297e-05f,
+	1.124131e-06f,
+
+	9.734990e-09f,
+	1.548821e-05f,
+	1.252802e-04f,
+	-1.512007e-04f,
+	-1.632761e-03f,
+	-9.031112e-04f,
+	6.004219e-03f,
+	2.409239e-03f,
+	-1.188971e-02f,
+	7.772017e-03f,
+	1.630645e-03f,
+	-2.000915e-03f,
+	-6.967849e-04f,
+	1.257305e-04f,
+	5.289071e-05f,
+	1.012294e-06f,
+
+	1.274071e-08f,
+	1.634725e-05f,
+	1.268658e-04f,
+	-1.655022e-04f,
+	-1.655858e-03f,
+	-8.380141e-04f,
+	6.112646e-03f,
+	2.073903e-03f,
+	-1.119163e-02f,
+	7.771688e-03f,
+	1.517624e-03f,
+	-2.001397e-03f,
+	-6.725978e-04f,
+	1.279623e-04f,
+	5.107959e-05f,
+	9.093492e-07f,
+
+	1.644593e-08f,
+	1.723918e-05f,
+	1.283813e-04f,
+	-1.802012e-04f,
+	-1.678483e-03f,
+	-7.709220e-04f,
+	6.218942e-03f,
+	1.726611e-03f,
+	-1.050817e-02f,
+	7.765348e-03f,
+	1.405955e-03f,
+	-2.000594e-03f,
+	-6.486991e-04f,
+	1.299743e-04f,
+	4.930049e-05f,
+	8.147862e-07f,
+
+	2.096552e-08f,
+	1.816451e-05f,
+	1.298220e-04f,
+	-1.952984e-04f,
+	-1.700606e-03f,
+	-7.018376e-04f,
+	6.322977e-03f,
+	1.367230e-03f,
+	-9.839265e-03f,
+	7.753160e-03f,
+	1.295687e-03f,
+	-1.998538e-03f,
+	-6.250988e-04f,
+	1.317729e-04f,
+	4.755420e-05f,
+	7.281095e-07f,
+
+	2.642599e-08f,
+	1.912372e-05f,
+	1.311829e-04f,
+	-2.107944e-04f,
+	-1.722199e-03f,
+	-6.307651e-04f,
+	6.424616e-03f,
+	9.956290e-04f,
+	-9.184849e-03f,
+	7.735287e-03f,
+	1.186867e-03f,
+	-1.995261e-03f,
+	-6.018063e-04f,
+	1.333643e-04f,
+	4.584143e-05f,
+	6.488395e-07f,
+
+	3.296601e-08f,
+	2.011727e-05f,
+	1.324592e-04f,
+	-2.266890e-04f,
+	-1.743232e-03f,
+	-5.577102e-04f,
+	6.523725e-03f,
+	6.116778e-04f,
+	-8.544848e-03f,
+	7.711887e-03f,
+	1.079541e-03f,
+	-1.990793e-03f,
+	-5.788304e-04f,
+	1.347550e-04f,
+	4.416280e-05f,
+	5.765135e-07f,
+
+	4.073681e-08f,
+	2.114558e-05f,
+	1.336458e-04f,
+	-2.429822e-04f,
+	-1.763675e-03f,
+	-4.826802e-04f,
+	6.620168e-03f,
+	2.152493e-04f,
+	-7.919186e-03f,
+	7.683123e-03f,
+	9.737521e-04f,
+	-1.985167e-03f,
+	-5.561795e-04f,
+	1.359512e-04f,
+	4.251888e-05f,
+	5.106847e-07f,
+
+	4.990270e-08f,
+	2.220903e-05f,
+	1.347375e-04f,
+	-2.596732e-04f,
+	-1.783497e-03f,
+	-4.056841e-04f,
+	6.713805e-03f,
+	-1.937817e-04f,
+	-7.307781e-03f,
+	7.649152e-03f,
+	8.695400e-04f,
+	-1.978414e-03f,
+	-5.338615e-04f,
+	1.369593e-04f,
+	4.091018e-05f,
+	4.509232e-07f,
+
+	6.064139e-08f,
+	2.330799e-05f,
+	1.357290e-04f,
+	-2.767611e-04f,
+	-1.802668e-03f,
+	-3.267325e-04f,
+	6.804497e-03f,
+	-6.155380e-04f,
+	-6.710553e-03f,
+	7.610132e-03f,
+	7.669443e-04f,
+	-1.970567e-03f,
+	-5.118839e-04f,
+	1.377855e-04f,
+	3.933709e-05f,
+	3.968156e-07f,
+
+	7.314451e-08f,
+	2.444276e-05f,
+	1.366150e-04f,
+	-2.942446e-04f,
+	-1.821158e-03f,
+	-2.458378e-04f,
+	6.892102e-03f,
+	-1.050140e-03f,
+	-6.127415e-03f,
+	7.566223e-03f,
+	6.660014e-04f,
+	-1.961657e-03f,
+	-4.902535e-04f,
+	1.384361e-04f,
+	3.779999e-05f,
+	3.479651e-07f,
+
+	8.761787e-08f,
+	2.561364e-05f,
+	1.373900e-04f,
+	-3.121218e-04f,
+	-1.838935e-03f,
+	-1.630140e-04f,
+	6.976478e-03f,
+	-1.497706e-03f,
+	-5.558279e-03f,
+	7.517580e-03f,
+	5.667463e-04f,
+	-1.951716e-03f,
+	-4.689769e-04f,
+	1.389172e-04f,
+	3.629916e-05f,
+	3.039916e-07f,
+
+	1.042819e-07f,
+	2.682086e-05f,
+	1.380486e-04f,
+	-3.303908e-04f,
+	-1.855968e-03f,
+	-7.827688e-05f,
+	7.057479e-03f,
+	-1.958352e-03f,
+	-5.003054e-03f,
+	7.464360e-03f,
+	4.692118e-04f,
+	-1.940777e-03f,
+	-4.480600e-04f,
+	1.392351e-04f,
+	3.483483e-05f,
+	2.645318e-07f,
+
+	1.233720e-07f,
+	2.806461e-05f,
+	1.385851e-04f,
+	-3.490489e-04f,
+	-1.872226e-03f,
+	8.355925e-06f,
+	7.134960e-03f,
+	-2.432190e-03f,
+	-4.461645e-03f,
+	7.406716e-03f,
+	3.734285e-04f,
+	-1.928871e-03f,
+	-4.275083e-04f,
+	1.393956e-04f,
+	3.340718e-05f,
+	2.292389e-07f,
+
+	1.451388e-07f,
+	2.934504e-05f,
+	1.389938e-04f,
+	-3.680933e-04f,
+	-1.887677e-03f,
+	9.686503e-05f,
+	7.208773e-03f,
+	-2.919332e-03f,
+	-3.933955e-03f,
+	7.344802e-03f,
+	2.794254e-04f,
+	-1.916032e-03f,
+	-4.073269e-04f,
+	1.394050e-04f,
+	3.201630e-05f,
+	1.977823e-07f,
+
+	1.698483e-07f,
+	3.066225e-05f,
+	1.392691e-04f,
+	-3.875205e-04f,
+	-1.902289e-03f,
+	1.872292e-04f,
+	7.278771e-03f,
+	-3.419885e-03f,
+	-3.419885e-03f,
+	7.278771e-03f,
+	1.872292e-04f,
+	-1.902289e-03f,
+	-3.875205e-04f,
+	1.392691e-04f,
+	3.066225e-05f,
+	1.698483e-07f,
+
+	1.977823e-07f,
+	3.201630e-05f,
+	1.394050e-04f,
+	-4.073269e-04f,
+	-1.916032e-03f,
+	2.794254e-04f,
+	7.344802e-03f,
+	-3.933955e-03f,
+	-2.919332e-03f,
+	7.208773e-03f,
+	9.686503e-05f,
+	-1.887677e-03f,
+	-3.680933e-04f,
+	1.389938e-04f,
+	2.934504e-05f,
+	1.451388e-07f,
+
+	2.292389e-07f,
+	3.340718e-05f,
+	1.393956e-04f,
+	-4.275083e-04f,
+	-1.928871e-03f,
+	3.734285e-04f,
+	7.406716e-03f,
+	-4.461645e-03f,
+	-2.432190e-03f,
+	7.134960e-03f,
+	8.355925e-06f,
+	-1.872226e-03f,
+	-3.490489e-04f,
+	1.385851e-04f,
+	2.806461e-05f,
+	1.233720e-07f,
+
+	2.645318e-07f,
+	3.483483e-05f,
+	1.392351e-04f,
+	-4.480600e-04f,
+	-1.940777e-03f,
+	4.692118e-04f,
+	7.464360e-03f,
+	-5.003054e-03f,
+	-1.958352e-03f,
+	7.057479e-03f,
+	-7.827688e-05f,
+	-1.855968e-03f,
+	-3.303908e-04f,
+	1.380486e-04f,
+	2.682086e-05f,
+	1.042819e-07f,
+
+	3.039916e-07f,
+	3.629916e-05f,
+	1.389172e-04f,
+	-4.689769e-04f,
+	-1.951716e-03f,
+	5.667463e-04f,
+	7.517580e-03f,
+	-5.558279e-03f,
+	-1.497706e-03f,
+	6.976478e-03f,
+	-1.630140e-04f,
+	-1.838935e-03f,
+	-3.121218e-04f,
+	1.373900e-04f,
+	2.561364e-05f,
+	8.761787e-08f,
+
+	3.479651e-07f,
+	3.779999e-05f,
+	1.384361e-04f,
+	-4.902535e-04f,
+	-1.961657e-03f,
+	6.660014e-04f,
+	7.566223e-03f,
+	-6.127415e-03f,
+	-1.050140e-03f,
+	6.892102e-03f,
+	-2.458378e-04f,
+	-1.821158e-03f,
+	-2.942446e-04f,
+	1.366150e-04f,
+	2.444276e-05f,
+	7.314451e-08f,
+
+	3.968156e-07f,
+	3.933709e-05f,
+	1.377855e-04f,
+	-5.118839e-04f,
+	-1.970567e-03f,
+	7.669443e-04f,
+	7.610132e-03f,
+	-6.710553e-03f,
+	-6.155380e-04f,
+	6.804497e-03f,
+	-3.267325e-04f,
+	-1.802668e-03f,
+	-2.767611e-04f,
+	1.357290e-04f,
+	2.330799e-05f,
+	6.064139e-08f,
+
+	4.509232e-07f,
+	4.091018e-05f,
+	1.369593e-04f,
+	-5.338615e-04f,
+	-1.978414e-03f,
+	8.695400e-04f,
+	7.649152e-03f,
+	-7.307781e-03f,
+	-1.937817e-04f,
+	6.713805e-03f,
+	-4.056841e-04f,
+	-1.783497e-03f,
+	-2.596732e-04f,
+	1.347375e-04f,
+	2.220903e-05f,
+	4.990270e-08f,
+
+	5.106847e-07f,
+	4.251888e-05f,
+	1.359512e-04f,
+	-5.561795e-04f,
+	-1.985167e-03f,
+	9.737521e-04f,
+	7.683123e-03f,
+	-7.919186e-03f,
+	2.152493e-04f,
+	6.620168e-03f,
+	-4.826802e-04f,
+	-1.763675e-03f,
+	-2.429822e-04f,
+	1.336458e-04f,
+	2.114558e-05f,
+	4.073681e-08f,
+
+	5.765135e-07f,
+	4.416280e-05f,
+	1.347550e-04f,
+	-5.788304e-04f,
+	-1.990793e-03f,
+	1.079541e-03f,
+	7.711887e-03f,
+	-8.544848e-03f,
+	6.116778e-04f,
+	6.523725e-03f,
+	-5.577102e-04f,
+	-1.743232e-03f,
+	-2.266890e-04f,
+	1.324592e-04f,
+	2.011727e-05f,
+	3.296601e-08f,
+
+	6.488395e-07f,
+	4.584143e-05f,
+	1.333643e-04f,
+	-6.018063e-04f,
+	-1.995261e-03f,
+	1.186867e-03f,
+	7.735287e-03f,
+	-9.184849e-03f,
+	9.956290e-04f,
+	6.424616e-03f,
+	-6.307651e-04f,
+	-1.722199e-03f,
+	-2.107944e-04f,
+	1.311829e-04f,
+	1.912372e-05f,
+	2.642599e-08f,
+
+	7.281095e-07f,
+	4.755420e-05f,
+	1.317729e-04f,
+	-6.250988e-04f,
+	-1.998538e-03f,
+	1.295687e-03f,
+	7.753160e-03f,
+	-9.839265e-03f,
+	1.367230e-03f,
+	6.322977e-03f,
+	-7.018376e-04f,
+	-1.700606e-03f,
+	-1.952984e-04f,
+	1.298220e-04f,
+	1.816451e-05f,
+	2.096552e-08f,
+
+	8.147862e-07f,
+	4.930049e-05f,
+	1.299743e-04f,
+	-6.486991e-04f,
+	-2.000594e-03f,
+	1.405955e-03f,
+	7.765348e-03f,
+	-1.050817e-02f,
+	1.726611e-03f,
+	6.218942e-03f,
+	-7.709220e-04f,
+	-1.678483e-03f,
+	-1.802012e-04f,
+	1.283813e-04f,
+	1.723918e-05f,
+	1.644593e-08f,
+
+	9.093492e-07f,
+	5.107959e-05f,
+	1.279623e-04f,
+	-6.725978e-04f,
+	-2.001397e-03f,
+	1.517624e-03f,
+	7.771688e-03f,
+	-1.119163e-02f,
+	2.073903e-03f,
+	6.112646e-03f,
+	-8.380141e-04f,
+	-1.655858e-03f,
+	-1.655022e-04f,
+	1.268658e-04f,
+	1.634725e-05f,
+	1.274071e-08f,
+
+	1.012294e-06f,
+	5.289071e-05f,
+	1.257305e-04f,
+	-6.967849e-04f,
+	-2.000915e-03f,
+	1.630645e-03f,
+	7.772017e-03f,
+	-1.188971e-02f,
+	2.409239e-03f,
+	6.004219e-03f,
+	-9.031112e-04f,
+	-1.632761e-03f,
+	-1.512007e-04f,
+	1.252802e-04f,
+	1.548821e-05f,
+	9.734990e-09f,
+
+	1.124131e-06f,
+	5.473297e-05f,
+	1.232724e-04f,
+	-7.212500e-04f,
+	-1.999118e-03f,
+	1.744967e-03f,
+	7.766176e-03f,
+	-1.260248e-02f,
+	2.732756e-03f,
+	5.893793e-03f,
+	-9.662125e-04f,
+	-1.609221e-03f,
+	-1.372956e-04f,
+	1.236292e-04f,
+	1.466151e-05f,
+	7.325058e-09f,
+
+	1.245389e-06f,
+	5.660544e-05f,
+	1.205817e-04f,
+	-7.459822e-04f,
+	-1.995975e-03f,
+	1.860536e-03f,
+	7.753999e-03f,
+	-1.333000e-02f,
+	3.044590e-03f,
+	5.781494e-03f,
+	-1.027318e-03f,
+	-1.585266e-03f,
+	-1.237857e-04f,
+	1.219174e-04f,
+	1.386661e-05f,
+	5.417852e-09f,
+
+	1.376608e-06f,
+	5.850709e-05f,
+	1.176519e-04f,
+	-7.709701e-04f,
+	-1.991455e-03f,
+	1.977296e-03f,
+	7.735323e-03f,
+	-1.407232e-02f,
+	3.344882e-03f,
+	5.667449e-03f,
+	-1.086430e-03f,
+	-1.560924e-03f,
+	-1.106691e-04f,
+	1.201492e-04f,
+	1.310291e-05f,
+	3.930427e-09f,
+
+	1.518347e-06f,
+	6.043679e-05f,
+	1.144769e-04f,
+	-7.962016e-04f,
+	-1.985529e-03f,
+	2.095189e-03f,
+	7.709986e-03f,
+	-1.482951e-02f,
+	3.633772e-03f,
+	5.551782e-03f,
+	-1.143551e-03f,
+	-1.536222e-03f,
+	-9.794408e-05f,
+	1.183289e-04f,
+	1.236983e-05f,
+	2.789418e-09f,
+
+	1.671176e-06f,
+	6.239335e-05f,
+	1.110501e-04f,
+	-8.216643e-04f,
+	-1.978167e-03f,
+	2.214155e-03f,
+	7.677822e-03f,
+	-1.560160e-02f,
+	3.911404e-03f,
+	5.434615e-03f,
+	-1.198687e-03f,
+	-1.511188e-03f,
+	-8.560828e-05f,
+	1.164609e-04f,
+	1.166673e-05f,
+	1.930491e-09f,
+
+	1.835682e-06f,
+	6.437548e-05f,
+	1.073654e-04f,
+	-8.473452e-04f,
+	-1.969340e-03f,
+	2.334133e-03f,
+	7.638668e-03f,
+	-1.638865e-02f,
+	4.177921e-03f,
+	5.316068e-03f,
+	-1.251842e-03f,
+	-1.485848e-03f,
+	-7.365925e-05f,
+	1.145493e-04f,
+	1.099298e-05f,
+	1.297771e-09f,
+
+	2.012463e-06f,
+	6.638178e-05f,
+	1.034163e-04f,
+	-8.732306e-04f,
+	-1.959018e-03f,
+	2.455057e-03f,
+	7.592360e-03f,
+	-1.719070e-02f,
+	4.433471e-03f,
+	5.196262e-03f,
+	-1.303025e-03f,
+	-1.460229e-03f,
+	-6.209422e-05f,
+	1.125979e-04f,
+	1.034794e-05f,
+	8.432793e-10f,
+
+	2.202134e-06f,
+	6.841080e-05f,
+	9.919678e-05f,
+	-8.993066e-04f,
+	-1.947174e-03f,
+	2.576860e-03f,
+	7.538733e-03f,
+	-1.800778e-02f,
+	4.678200e-03f,
+	5.075310e-03f,
+	-1.352243e-03f,
+	-1.434356e-03f,
+	-5.091018e-05f,
+	1.106109e-04f,
+	9.730930e-06f,
+	5.263415e-10f,
+
+	2.405317e-06f,
+	7.046096e-05f,
+	9.470052e-05f,
+	-9.255582e-04f,
+	-1.933780e-03f,
+	2.699475e-03f,
+	7.477623e-03f,
+	-1.883995e-02f,
+	4.912258e-03f,
+	4.953329e-03f,
+	-1.399508e-03f,
+	-1.408256e-03f,
+	-4.010390e-05f,
+	1.085919e-04f,
+	9.141285e-06f,
+	3.130021e-10f,
+
+	2.622651e-06f,
+	7.253060e-05f,
+	8.992143e-05f,
+	-9.519706e-04f,
+	-1.918807e-03f,
+	2.822828e-03f,
+	7.408865e-03f,
+	-1.968722e-02f,
+	5.135796e-03f,
+	4.830431e-03f,
+	-1.444829e-03f,
+	-1.381952e-03f,
+	-2.967190e-05f,
+	1.065447e-04f,
+	8.578316e-06f,
+	1.754248e-10f,
+
+	2.854784e-06f,
+	7.461796e-05f,
+	8.485343e-05f,
+	-9.785278e-04f,
+	-1.902229e-03f,
+	2.946849e-03f,
+	7.332296e-03f,
+	-2.054964e-02f,
+	5.348965e-03f,
+	4.706725e-03f,
+	-1.488218e-03f,
+	-1.355470e-03f,
+	-1.961049e-05f,
+	1.044729e-04f,
+	8.041329e-06f,
+	9.128988e-11f,
+
+	3.102374e-06f,
+	7.672118e-05f,
+	7.949053e-05f,
+	-1.005214e-03f,
+	-1.884021e-03f,
+	3.071459e-03f,
+	7.247750e-03f,
+	-2.142722e-02f,
+	5.551919e-03f,
+	4.582321e-03f,
+	-1.529690e-03f,
+	-1.328833e-03f,
+	-9.915752e-06f,
+	1.023798e-04f,
+	7.529624e-06f,
+	4.318556e-11f,
+
+	3.366089e-06f,
+	7.883830e-05f,
+	7.382682e-05f,
+	-1.032012e-03f,
+	-1.864156e-03f,
+	3.196583e-03f,
+	7.155065e-03f,
+	-2.231999e-02f,
+	5.744812e-03f,
+	4.457324e-03f,
+	-1.569259e-03f,
+	-1.302066e-03f,
+	-5.835859e-07f,
+	1.002689e-04f,
+	7.042495e-06f,
+	1.799654e-11f,
+
+	3.646608e-06f,
+	8.096726e-05f,
+	6.785645e-05f,
+	-1.058904e-03f,
+	-1.842609e-03f,
+	3.322139e-03f,
+	7.054077e-03f,
+	-2.322797e-02f,
+	5.927798e-03f,
+	4.331838e-03f,
+	-1.606940e-03f,
+	-1.275190e-03f,
+	8.390313e-06f,
+	9.814346e-05f,
+	6.579230e-06f,
+	6.289571e-12f,
+
+	3.944615e-06f,
+	8.310589e-05f,
+	6.157372e-05f,
+	-1.085873e-03f,
+	-1.819356e-03f,
+	3.448046e-03f,
+	6.944622e-03f,
+	-2.415117e-02f,
+	6.101036e-03f,
+	4.205965e-03f,
+	-1.642749e-03f,
+	-1.248229e-03f,
+	1.701043e-05f,
+	9.600653e-05f,
+	6.139116e-06f,
+	1.697644e-12f,
+
+	4.260804e-06f,
+	8.525194e-05f,
+	5.497297e-05f,
+	-1.112900e-03f,
+	-1.794374e-03f,
+	3.574219e-03f,
+	6.826539e-03f,
+	-2.508961e-02f,
+	6.264683e-03f,
+	4.079806e-03f,
+	-1.676705e-03f,
+	-1.221205e-03f,
+	2.528143e-05f,
+	9.386116e-05f,
+	5.721438e-06f,
+	3.037579e-13f,
+
+	4.595875e-06f,
+	8.740302e-05f,
+	4.804870e-05f,
+	-1.139967e-03f,
+	-1.767639e-03f,
+	3.700572e-03f,
+	6.699665e-03f,
+	-2.604330e-02f,
+	6.418897e-03f,
+	3.953457e-03f,
+	-1.708825e-03f,
+	-1.194140e-03f,
+	3.320813e-05f,
+	9.171027e-05f,
+	5.325481e-06f,
+	2.528450e-14f,
+
+	4.950531e-06f,
+	8.955666e-05f,
+	4.079550e-05f,
+	-1.167053e-03f,
+	-1.739130e-03f,
+	3.827015e-03f,
+	6.563838e-03f,
+	-2.701223e-02f,
+	6.563838e-03f,
+	3.827015e-03f,
+	-1.739130e-03f,
+	-1.167053e-03f,
+	4.079550e-05f,
+	8.955666e-05f,
+	4.950531e-06f,
+	-2.062965e-39f
+};
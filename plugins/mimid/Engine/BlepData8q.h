@@ -0,0 +1,282 @@
+// BLEP and BLAMP tables for Samples = 8, quantized to 16 bits, generated by Utils/blepnew.c.
+// See BlepData.h.
+
+// blep table: 1040 entries, times blepScale
+const float blepScale = 1.525925e-05f;
+const int16_t blep[] = {
+	0, 8, -67, 209, -536, 1168, -2422, 5446, 32767, -5446, 2422, -1168, 536, -209, 67, -8,
+	0, 8, -67, 209, -535, 1166, -2419, 5438, 31743, -5438, 2419, -1166, 535, -209, 67, -8,
+	0, 8, -66, 208, -533, 1162, -2409, 5415, 30720, -5416, 2410, -1162, 533, -208, 66, -8,
+	0, 7, -66, 206, -529, 1154, -2394, 5376, 29699, -5381, 2395, -1155, 530, -207, 66, -8,
+	0, 7, -65, 204, -524, 1143, -2371, 5320, 28681, -5331, 2374, -1145, 525, -205, 65, -7,
+	0, 7, -64, 202, -518, 1129, -2342, 5247, 27666, -5269, 2348, -1132, 519, -202, 65, -7,
+	0, 7, -63, 198, -510, 1112, -2306, 5157, 26655, -5195, 2317, -1117, 513, -200, 64, -7,
+	0, 7, -62, 195, -501, 1092, -2263, 5049, 25649, -5109, 2280, -1100, 505, -197, 63, -7,
+	0, 6, -60, 190, -490, 1068, -2214, 4922, 24649, -5013, 2239, -1080, 496, -193, 62, -7,
+	0, 6, -59, 185, -477, 1041, -2157, 4777, 23656, -4905, 2192, -1058, 485, -189, 60, -7,
+	0, 6, -57, 179, -463, 1011, -2093, 4612, 22670, -4788, 2142, -1034, 474, -185, 59, -6,
+	0, 5, -54, 173, -447, 978, -2023, 4429, 21692, -4661, 2087, -1007, 463, -180, 58, -6,
+	0, 5, -52, 165, -430, 941, -1946, 4225, 20724, -4526, 2028, -979, 450, -175, 56, -6,
+	0, 4, -49, 158, -411, 901, -1861, 4001, 19766, -4383, 1965, -949, 436, -170, 55, -6,
+	0, 3, -47, 149, -391, 857, -1770, 3757, 18818, -4232, 1899, -917, 422, -164, 53, -5,
+	0, 3, -43, 140, -369, 811, -1672, 3492, 17881, -4074, 1830, -884, 407, -158, 51, -5,
+	0, 2, -40, 130, -346, 761, -1567, 3206, 16957, -3910, 1757, -850, 392, -152, 49, -5,
+	0, 1, -36, 120, -321, 708, -1455, 2899, 16045, -3741, 1682, -814, 375, -146, 48, -5,
+	0, 0, -33, 109, -295, 653, -1337, 2570, 15147, -3566, 1604, -776, 359, -140, 46, -4,
+	0, -1, -28, 97, -268, 594, -1213, 2220, 14263, -3387, 1524, -738, 342, -133, 44, -4,
+	0, -2, -24, 85, -239, 532, -1082, 1848, 13394, -3204, 1442, -699, 324, -126, 42, -4,
+	0, -3, -20, 72, -208, 468, -945, 1455, 12540, -3017, 1358, -659, 306, -120, 40, -4,
+	0, -4, -15, 58, -177, 401, -802, 1040, 11702, -2828, 1273, -618, 288, -113, 38, -3,
+	0, -5, -10, 44, -144, 331, -654, 602, 10880, -2636, 1186, -577, 270, -106, 36, -3,
+	1, -7, -5, 30, -110, 259, -500, 143, 10076, -2443, 1099, -535, 251, -99, 34, -3,
+	1, -8, 1, 15, -75, 184, -341, -338, 9289, -2248, 1010, -493, 233, -92, 32, -3,
+	1, -9, 6, -1, -39, 108, -177, -840, 8520, -2053, 922, -450, 214, -85, 30, -3,
+	1, -11, 12, -17, -1, 29, -8, -1365, 7769, -1857, 832, -408, 195, -78, 28, -2,
+	1, -12, 18, -34, 37, -51, 165, -1911, 7038, -1662, 743, -365, 177, -71, 26, -2,
+	1, -14, 24, -50, 76, -134, 342, -2479, 6326, -1467, 654, -323, 158, -64, 24, -2,
+	1, -15, 30, -68, 116, -218, 523, -3068, 5634, -1274, 565, -281, 140, -57, 22, -2,
+	1, -17, 37, -85, 156, -303, 707, -3678, 4961, -1083, 477, -239, 121, -50, 21, -2,
+	1, -19, 43, -103, 197, -389, 893, -4309, 4309, -893, 389, -197, 103, -43, 19, -1,
+	2, -21, 50, -121, 239, -477, 1083, -4961, 3678, -707, 303, -156, 85, -37, 17, -1,
+	2, -22, 57, -140, 281, -565, 1274, -5634, 3068, -523, 218, -116, 68, -30, 15, -1,
+	2, -24, 64, -158, 323, -654, 1467, -6326, 2479, -342, 134, -76, 50, -24, 14, -1,
+	2, -26, 71, -177, 365, -743, 1662, -7038, 1911, -165, 51, -37, 34, -18, 12, -1,
+	2, -28, 78, -195, 408, -832, 1857, -7769, 1365, 8, -29, 1, 17, -12, 11, -1,
+	3, -30, 85, -214, 450, -922, 2053, -8520, 840, 177, -108, 39, 1, -6, 9, -1,
+	3, -32, 92, -233, 493, -1010, 2248, -9289, 338, 341, -184, 75, -15, -1, 8, -1,
+	3, -34, 99, -251, 535, -1099, 2443, -10076, -143, 500, -259, 110, -30, 5, 7, -1,
+	3, -36, 106, -270, 577, -1186, 2636, -10880, -602, 654, -331, 144, -44, 10, 5, 0,
+	3, -38, 113, -288, 618, -1273, 2828, -11702, -1040, 802, -401, 177, -58, 15, 4, 0,
+	4, -40, 120, -306, 659, -1358, 3017, -12540, -1455, 945, -468, 208, -72, 20, 3, 0,
+	4, -42, 126, -324, 699, -1442, 3204, -13394, -1848, 1082, -532, 239, -85, 24, 2, 0,
+	4, -44, 133, -342, 738, -1524, 3387, -14263, -2220, 1213, -594, 268, -97, 28, 1, 0,
+	4, -46, 140, -359, 776, -1604, 3566, -15147, -2570, 1337, -653, 295, -109, 33, 0, 0,
+	5, -48, 146, -375, 814, -1682, 3741, -16045, -2899, 1455, -708, 321, -120, 36, -1, 0,
+	5, -49, 152, -392, 850, -1757, 3910, -16957, -3206, 1567, -761, 346, -130, 40, -2, 0,
+	5, -51, 158, -407, 884, -1830, 4074, -17881, -3492, 1672, -811, 369, -140, 43, -3, 0,
+	5, -53, 164, -422, 917, -1899, 4232, -18818, -3757, 1770, -857, 391, -149, 47, -3, 0,
+	6, -55, 170, -436, 949, -1965, 4383, -19766, -4001, 1861, -901, 411, -158, 49, -4, 0,
+	6, -56, 175, -450, 979, -2028, 4526, -20724, -4225, 1946, -941, 430, -165, 52, -5, 0,
+	6, -58, 180, -463, 1007, -2087, 4661, -21692, -4429, 2023, -978, 447, -173, 54, -5, 0,
+	6, -59, 185, -474, 1034, -2142, 4788, -22670, -4612, 2093, -1011, 463, -179, 57, -6, 0,
+	7, -60, 189, -485, 1058, -2192, 4905, -23656, -4777, 2157, -1041, 477, -185, 59, -6, 0,
+	7, -62, 193, -496, 1080, -2239, 5013, -24649, -4922, 2214, -1068, 490, -190, 60, -6, 0,
+	7, -63, 197, -505, 1100, -2280, 5109, -25649, -5049, 2263, -1092, 501, -195, 62, -7, 0,
+	7, -64, 200, -513, 1117, -2317, 5195, -26655, -5157, 2306, -1112, 510, -198, 63, -7, 0,
+	7, -65, 202, -519, 1132, -2348, 5269, -27666, -5247, 2342, -1129, 518, -202, 64, -7, 0,
+	7, -65, 205, -525, 1145, -2374, 5331, -28681, -5320, 2371, -1143, 524, -204, 65, -7, 0,
+	8, -66, 207, -530, 1155, -2395, 5381, -29699, -5376, 2394, -1154, 529, -206, 66, -7, 0,
+	8, -66, 208, -533, 1162, -2410, 5416, -30720, -5415, 2409, -1162, 533, -208, 66, -8, 0,
+	8, -67, 209, -535, 1166, -2419, 5438, -31743, -5438, 2419, -1166, 535, -209, 67, -8, 0,
+	8, -67, 209, -536, 1168, -2422, 5446, -32767, -5446, 2422, -1168, 536, -209, 67, -8, 0
+};
+
+// blepd2 table: 1040 entries, times blepd2Scale
+const float blepd2Scale = 1.525925e-05f;
+const int16_t blepd2[] = {
+	0, 12, 72, -249, -909, 987, 4243, -4709, 32767, 4709, -4243, -987, 909, 249, -72, -12,
+	0, 13, 72, -260, -909, 1047, 4242, -5017, 32255, 4406, -4242, -927, 909, 238, -72, -12,
+	0, 14, 72, -272, -908, 1108, 4237, -5331, 31744, 4108, -4237, -867, 908, 227, -72, -11,
+	0, 14, 72, -283, -906, 1170, 4229, -5650, 31232, 3816, -4230, -809, 906, 216, -72, -10,
+	0, 15, 72, -295, -903, 1233, 4218, -5975, 30721, 3529, -4219, -751, 904, 206, -72, -10,
+	0, 16, 71, -307, -900, 1296, 4203, -6305, 30210, 3248, -4206, -695, 901, 195, -71, -9,
+	0, 17, 71, -319, -896, 1359, 4185, -6640, 29700, 2972, -4190, -639, 897, 185, -71, -9,
+	0, 18, 70, -331, -891, 1424, 4163, -6980, 29191, 2702, -4172, -583, 893, 175, -70, -8,
+	0, 18, 69, -344, -886, 1488, 4138, -7325, 28683, 2437, -4151, -529, 889, 165, -70, -8,
+	0, 19, 68, -356, -879, 1553, 4109, -7676, 28175, 2177, -4127, -476, 884, 156, -69, -7,
+	0, 20, 67, -369, -872, 1619, 4077, -8031, 27669, 1924, -4101, -423, 878, 146, -68, -7,
+	0, 21, 66, -382, -864, 1684, 4040, -8392, 27163, 1675, -4073, -372, 872, 137, -68, -6,
+	0, 22, 65, -394, -855, 1750, 4000, -8757, 26659, 1432, -4042, -321, 865, 128, -67, -6,
+	0, 23, 63, -407, -845, 1817, 3955, -9128, 26157, 1195, -4009, -271, 858, 119, -66, -5,
+	0, 24, 62, -420, -835, 1883, 3907, -9503, 25656, 963, -3974, -223, 851, 111, -65, -5,
+	0, 25, 60, -434, -823, 1950, 3855, -9883, 25156, 737, -3937, -175, 843, 102, -64, -5,
+	0, 26, 58, -447, -811, 2017, 3798, -10268, 24659, 516, -3898, -128, 834, 94, -63, -4,
+	0, 27, 56, -460, -797, 2084, 3738, -10658, 24163, 301, -3857, -83, 825, 86, -62, -4,
+	0, 28, 54, -473, -783, 2151, 3673, -11052, 23669, 91, -3815, -38, 816, 79, -61, -4,
+	0, 29, 52, -487, -767, 2218, 3603, -11451, 23177, -113, -3770, 6, 807, 71, -60, -3,
+	0, 30, 50, -500, -751, 2285, 3530, -11855, 22688, -312, -3724, 48, 797, 64, -59, -3,
+	0, 32, 47, -513, -734, 2351, 3452, -12262, 22200, -506, -3676, 90, 787, 57, -58, -3,
+	0, 33, 44, -527, -715, 2418, 3369, -12675, 21715, -694, -3627, 130, 776, 50, -57, -3,
+	0, 34, 41, -540, -696, 2484, 3282, -13091, 21233, -876, -3576, 170, 766, 43, -56, -2,
+	0, 35, 38, -553, -676, 2551, 3190, -13512, 20753, -1054, -3523, 208, 754, 37, -55, -2,
+	0, 36, 35, -567, -654, 2616, 3094, -13937, 20276, -1226, -3470, 245, 743, 31, -53, -2,
+	0, 37, 32, -580, -632, 2682, 2992, -14366, 19802, -1393, -3415, 281, 732, 25, -52, -2,
+	0, 39, 28, -593, -609, 2747, 2886, -14799, 19331, -1554, -3359, 317, 720, 19, -51, -2,
+	1, 40, 24, -606, -584, 2811, 2776, -15236, 18862, -1710, -3302, 351, 708, 13, -50, -1,
+	1, 41, 20, -620, -559, 2875, 2660, -15677, 18397, -1861, -3243, 384, 696, 8, -49, -1,
+	1, 42, 16, -633, -532, 2938, 2539, -16121, 17935, -2007, -3184, 415, 683, 3, -47, -1,
+	1, 44, 12, -645, -505, 3001, 2414, -16569, 17476, -2148, -3124, 446, 671, -2, -46, -1,
+	1, 45, 7, -658, -476, 3063, 2283, -17021, 17021, -2283, -3063, 476, 658, -7, -45, -1,
+	1, 46, 2, -671, -446, 3124, 2148, -17476, 16569, -2414, -3001, 505, 645, -12, -44, -1,
+	1, 47, -3, -683, -415, 3184, 2007, -17935, 16121, -2539, -2938, 532, 633, -16, -42, -1,
+	1, 49, -8, -696, -384, 3243, 1861, -18397, 15677, -2660, -2875, 559, 620, -20, -41, -1,
+	1, 50, -13, -708, -351, 3302, 1710, -18862, 15236, -2776, -2811, 584, 606, -24, -40, -1,
+	2, 51, -19, -720, -317, 3359, 1554, -19331, 14799, -2886, -2747, 609, 593, -28, -39, 0,
+	2, 52, -25, -732, -281, 3415, 1393, -19802, 14366, -2992, -2682, 632, 580, -32, -37, 0,
+	2, 53, -31, -743, -245, 3470, 1226, -20276, 13937, -3094, -2616, 654, 567, -35, -36, 0,
+	2, 55, -37, -754, -208, 3523, 1054, -20753, 13512, -3190, -2551, 676, 553, -38, -35, 0,
+	2, 56, -43, -766, -170, 3576, 876, -21233, 13091, -3282, -2484, 696, 540, -41, -34, 0,
+	3, 57, -50, -776, -130, 3627, 694, -21715, 12675, -3369, -2418, 715, 527, -44, -33, 0,
+	3, 58, -57, -787, -90, 3676, 506, -22200, 12262, -3452, -2351, 734, 513, -47, -32, 0,
+	3, 59, -64, -797, -48, 3724, 312, -22688, 11855, -3530, -2285, 751, 500, -50, -30, 0,
+	3, 60, -71, -807, -6, 3770, 113, -23177, 11451, -3603, -2218, 767, 487, -52, -29, 0,
+	4, 61, -79, -816, 38, 3815, -91, -23669, 11052, -3673, -2151, 783, 473, -54, -28, 0,
+	4, 62, -86, -825, 83, 3857, -301, -24163, 10658, -3738, -2084, 797, 460, -56, -27, 0,
+	4, 63, -94, -834, 128, 3898, -516, -24659, 10268, -3798, -2017, 811, 447, -58, -26, 0,
+	5, 64, -102, -843, 175, 3937, -737, -25156, 9883, -3855, -1950, 823, 434, -60, -25, 0,
+	5, 65, -111, -851, 223, 3974, -963, -25656, 9503, -3907, -1883, 835, 420, -62, -24, 0,
+	5, 66, -119, -858, 271, 4009, -1195, -26157, 9128, -3955, -1817, 845, 407, -63, -23, 0,
+	6, 67, -128, -865, 321, 4042, -1432, -26659, 8757, -4000, -1750, 855, 394, -65, -22, 0,
+	6, 68, -137, -872, 372, 4073, -1675, -27163, 8392, -4040, -1684, 864, 382, -66, -21, 0,
+	7, 68, -146, -878, 423, 4101, -1924, -27669, 8031, -4077, -1619, 872, 369, -67, -20, 0,
+	7, 69, -156, -884, 476, 4127, -2177, -28175, 7676, -4109, -1553, 879, 356, -68, -19, 0,
+	8, 70, -165, -889, 529, 4151, -2437, -28683, 7325, -4138, -1488, 886, 344, -69, -18, 0,
+	8, 70, -175, -893, 583, 4172, -2702, -29191, 6980, -4163, -1424, 891, 331, -70, -18, 0,
+	9, 71, -185, -897, 639, 4190, -2972, -29700, 6640, -4185, -1359, 896, 319, -71, -17, 0,
+	9, 71, -195, -901, 695, 4206, -3248, -30210, 6305, -4203, -1296, 900, 307, -71, -16, 0,
+	10, 72, -206, -904, 751, 4219, -3529, -30721, 5975, -4218, -1233, 903, 295, -72, -15, 0,
+	10, 72, -216, -906, 809, 4230, -3816, -31232, 5650, -4229, -1170, 906, 283, -72, -14, 0,
+	11, 72, -227, -908, 867, 4237, -4108, -31744, 5331, -4237, -1108, 908, 272, -72, -14, 0,
+	12, 72, -238, -909, 927, 4242, -4406, -32255, 5017, -4242, -1047, 909, 260, -72, -13, 0,
+	12, 72, -249, -909, 987, 4243, -4709, -32767, 4709, -4243, -987, 909, 249, -72, -12, 0
+};
+
+// blamp table: 1040 entries, times blampScale
+const float blampScale = 3.927864e-07f;
+const int16_t blamp[] = {
+	0, 12, -104, 171, -469, 764, -1677, 4083, -32767, 4083, -1677, 764, -469, 171, -104, 12,
+	0, 13, -109, 187, -510, 853, -1861, 4496, -30320, 3670, -1494, 676, -428, 156, -99, 12,
+	0, 14, -114, 203, -550, 941, -2044, 4908, -27950, 3258, -1311, 587, -388, 140, -94, 11,
+	0, 14, -119, 219, -590, 1029, -2226, 5317, -25658, 2849, -1128, 500, -348, 124, -89, 11,
+	0, 15, -124, 234, -630, 1116, -2407, 5723, -23443, 2442, -947, 412, -308, 108, -84, 10,
+	0, 15, -129, 250, -670, 1202, -2586, 6124, -21305, 2040, -768, 326, -268, 93, -79, 10,
+	0, 16, -134, 265, -709, 1287, -2762, 6519, -19244, 1643, -591, 241, -229, 78, -74, 9,
+	0, 16, -138, 280, -747, 1371, -2936, 6906, -17260, 1252, -417, 156, -190, 63, -69, 9,
+	0, 17, -143, 294, -785, 1453, -3106, 7284, -15352, 868, -245, 74, -152, 48, -64, 8,
+	0, 17, -148, 309, -821, 1533, -3271, 7652, -13519, 492, -77, -7, -115, 33, -60, 7,
+	0, 18, -152, 322, -857, 1611, -3433, 8008, -11762, 124, 87, -87, -79, 19, -55, 7,
+	0, 18, -156, 336, -892, 1686, -3589, 8351, -10079, -234, 248, -164, -43, 5, -51, 7,
+	0, 19, -160, 349, -925, 1759, -3739, 8679, -8469, -583, 404, -239, -8, -8, -47, 6,
+	0, 19, -164, 361, -957, 1829, -3884, 8992, -6933, -921, 555, -313, 25, -21, -42, 6,
+	0, 19, -168, 372, -987, 1896, -4022, 9286, -5470, -1248, 702, -383, 58, -34, -38, 5,
+	0, 19, -171, 383, -1016, 1959, -4152, 9561, -4077, -1563, 843, -452, 89, -46, -34, 5,
+	0, 20, -174, 394, -1043, 2019, -4275, 9815, -2756, -1866, 979, -518, 120, -58, -31, 4,
+	0, 20, -177, 403, -1069, 2074, -4390, 10047, -1503, -2156, 1110, -581, 149, -69, -27, 4,
+	0, 20, -180, 412, -1092, 2126, -4496, 10254, -320, -2433, 1234, -641, 176, -80, -23, 4,
+	0, 20, -182, 420, -1113, 2173, -4592, 10436, 796, -2697, 1353, -698, 203, -90, -20, 3,
+	0, 20, -184, 427, -1133, 2216, -4679, 10590, 1845, -2947, 1466, -753, 228, -100, -17, 3,
+	0, 19, -186, 432, -1150, 2254, -4756, 10715, 2829, -3183, 1572, -804, 252, -109, -14, 3,
+	0, 19, -187, 437, -1164, 2287, -4822, 10810, 3748, -3405, 1672, -853, 275, -118, -11, 3,
+	0, 19, -188, 441, -1176, 2315, -4878, 10872, 4605, -3612, 1765, -898, 296, -127, -8, 2,
+	0, 18, -189, 444, -1186, 2337, -4921, 10901, 5400, -3805, 1852, -940, 316, -134, -5, 2,
+	0, 18, -189, 446, -1193, 2354, -4953, 10893, 6135, -3983, 1932, -979, 334, -142, -3, 2,
+	0, 17, -188, 446, -1197, 2365, -4973, 10849, 6810, -4146, 2005, -1015, 351, -148, 0, 2,
+	0, 16, -188, 446, -1199, 2370, -4980, 10765, 7428, -4294, 2072, -1048, 367, -154, 2, 1,
+	0, 15, -187, 444, -1198, 2369, -4974, 10641, 7990, -4428, 2131, -1077, 381, -160, 4, 1,
+	0, 14, -185, 440, -1193, 2362, -4955, 10474, 8497, -4546, 2184, -1103, 393, -165, 6, 1,
+	1, 13, -183, 436, -1186, 2349, -4922, 10264, 8951, -4650, 2231, -1126, 405, -170, 8, 1,
+	1, 12, -180, 430, -1176, 2329, -4875, 10008, 9353, -4740, 2270, -1146, 415, -174, 9, 1,
+	1, 11, -177, 423, -1162, 2303, -4815, 9705, 9705, -4815, 2303, -1162, 423, -177, 11, 1,
+	1, 9, -174, 415, -1146, 2270, -4740, 9353, 10008, -4875, 2329, -1176, 430, -180, 12, 1,
+	1, 8, -170, 405, -1126, 2231, -4650, 8951, 10264, -4922, 2349, -1186, 436, -183, 13, 1,
+	1, 6, -165, 393, -1103, 2184, -4546, 8497, 10474, -4955, 2362, -1193, 440, -185, 14, 0,
+	1, 4, -160, 381, -1077, 2131, -4428, 7990, 10641, -4974, 2369, -1198, 444, -187, 15, 0,
+	1, 2, -154, 367, -1048, 2072, -4294, 7428, 10765, -4980, 2370, -1199, 446, -188, 16, 0,
+	2, 0, -148, 351, -1015, 2005, -4146, 6810, 10849, -4973, 2365, -1197, 446, -188, 17, 0,
+	2, -3, -142, 334, -979, 1932, -3983, 6135, 10893, -4953, 2354, -1193, 446, -189, 18, 0,
+	2, -5, -134, 316, -940, 1852, -3805, 5400, 10901, -4921, 2337, -1186, 444, -189, 18, 0,
+	2, -8, -127, 296, -898, 1765, -3612, 4605, 10872, -4878, 2315, -1176, 441, -188, 19, 0,
+	3, -11, -118, 275, -853, 1672, -3405, 3748, 10810, -4822, 2287, -1164, 437, -187, 19, 0,
+	3, -14, -109, 252, -804, 1572, -3183, 2829, 10715, -4756, 2254, -1150, 432, -186, 19, 0,
+	3, -17, -100, 228, -753, 1466, -2947, 1845, 10590, -4679, 2216, -1133, 427, -184, 20, 0,
+	3, -20, -90, 203, -698, 1353, -2697, 796, 10436, -4592, 2173, -1113, 420, -182, 20, 0,
+	4, -23, -80, 176, -641, 1234, -2433, -320, 10254, -4496, 2126, -1092, 412, -180, 20, 0,
+	4, -27, -69, 149, -581, 1110, -2156, -1503, 10047, -4390, 2074, -1069, 403, -177, 20, 0,
+	4, -31, -58, 120, -518, 979, -1866, -2756, 9815, -4275, 2019, -1043, 394, -174, 20, 0,
+	5, -34, -46, 89, -452, 843, -1563, -4077, 9561, -4152, 1959, -1016, 383, -171, 19, 0,
+	5, -38, -34, 58, -383, 702, -1248, -5470, 9286, -4022, 1896, -987, 372, -168, 19, 0,
+	6, -42, -21, 25, -313, 555, -921, -6933, 8992, -3884, 1829, -957, 361, -164, 19, 0,
+	6, -47, -8, -8, -239, 404, -583, -8469, 8679, -3739, 1759, -925, 349, -160, 19, 0,
+	7, -51, 5, -43, -164, 248, -234, -10079, 8351, -3589, 1686, -892, 336, -156, 18, 0,
+	7, -55, 19, -79, -87, 87, 124, -11762, 8008, -3433, 1611, -857, 322, -152, 18, 0,
+	7, -60, 33, -115, -7, -77, 492, -13519, 7652, -3271, 1533, -821, 309, -148, 17, 0,
+	8, -64, 48, -152, 74, -245, 868, -15352, 7284, -3106, 1453, -785, 294, -143, 17, 0,
+	9, -69, 63, -190, 156, -417, 1252, -17260, 6906, -2936, 1371, -747, 280, -138, 16, 0,
+	9, -74, 78, -229, 241, -591, 1643, -19244, 6519, -2762, 1287, -709, 265, -134, 16, 0,
+	10, -79, 93, -268, 326, -768, 2040, -21305, 6124, -2586, 1202, -670, 250, -129, 15, 0,
+	10, -84, 108, -308, 412, -947, 2442, -23443, 5723, -2407, 1116, -630, 234, -124, 15, 0,
+	11, -89, 124, -348, 500, -1128, 2849, -25658, 5317, -2226, 1029, -590, 219, -119, 14, 0,
+	11, -94, 140, -388, 587, -1311, 3258, -27950, 4908, -2044, 941, -550, 203, -114, 14, 0,
+	12, -99, 156, -428, 676, -1494, 3670, -30320, 4496, -1861, 853, -510, 187, -109, 13, 0,
+	12, -104, 171, -469, 764, -1677, 4083, -32767, 4083, -1677, 764, -469, 171, -104, 12, 0
+};
+
+// blampd2 table: 1040 entries, times blampd2Scale
+const float blampd2Scale = 8.243730e-07f;
+const int16_t blampd2[] = {
+	0, 6, 109, 49, -1416, -2110, 4642, 7962, -32767, 7962, 4642, -2110, -1416, 49, 109, 6,
+	0, 6, 111, 40, -1449, -2073, 4796, 7786, -31592, 8127, 4489, -2144, -1383, 58, 106, 6,
+	0, 7, 114, 31, -1481, -2034, 4949, 7599, -30435, 8281, 4336, -2177, -1350, 67, 103, 5,
+	0, 7, 116, 21, -1514, -1993, 5102, 7401, -29296, 8424, 4183, -2207, -1317, 75, 101, 5,
+	0, 8, 119, 10, -1547, -1949, 5255, 7191, -28177, 8557, 4030, -2235, -1284, 82, 98, 4,
+	0, 9, 122, -1, -1579, -1904, 5407, 6969, -27075, 8679, 3878, -2261, -1252, 90, 96, 4,
+	0, 9, 124, -12, -1612, -1856, 5559, 6735, -25992, 8792, 3726, -2285, -1219, 96, 93, 4,
+	0, 10, 127, -24, -1644, -1805, 5709, 6489, -24928, 8894, 3575, -2307, -1187, 103, 91, 3,
+	0, 10, 129, -36, -1676, -1753, 5860, 6230, -23881, 8987, 3424, -2328, -1155, 109, 88, 3,
+	0, 11, 132, -49, -1708, -1698, 6009, 5959, -22854, 9071, 3275, -2346, -1123, 115, 85, 3,
+	0, 12, 134, -62, -1740, -1640, 6157, 5675, -21844, 9145, 3126, -2362, -1091, 120, 83, 3,
+	0, 13, 137, -75, -1771, -1581, 6303, 5378, -20853, 9210, 2978, -2376, -1059, 125, 81, 2,
+	0, 13, 139, -89, -1802, -1519, 6449, 5068, -19880, 9266, 2831, -2389, -1028, 130, 78, 2,
+	0, 14, 141, -104, -1833, -1454, 6592, 4745, -18925, 9314, 2686, -2400, -997, 135, 76, 2,
+	0, 15, 144, -119, -1864, -1387, 6735, 4408, -17989, 9353, 2542, -2409, -966, 139, 73, 2,
+	0, 16, 146, -134, -1893, -1318, 6875, 4057, -17070, 9383, 2399, -2416, -935, 143, 71, 2,
+	0, 17, 148, -150, -1923, -1246, 7013, 3693, -16170, 9406, 2257, -2421, -905, 146, 69, 2,
+	0, 18, 150, -167, -1952, -1172, 7149, 3315, -15287, 9421, 2117, -2425, -875, 150, 66, 1,
+	0, 19, 152, -183, -1981, -1096, 7283, 2923, -14423, 9428, 1978, -2427, -845, 153, 64, 1,
+	0, 20, 154, -201, -2009, -1017, 7415, 2516, -13576, 9427, 1841, -2428, -816, 155, 62, 1,
+	0, 21, 156, -219, -2036, -935, 7544, 2094, -12747, 9420, 1705, -2427, -787, 158, 60, 1,
+	0, 22, 157, -237, -2063, -851, 7670, 1659, -11935, 9405, 1572, -2424, -758, 160, 58, 1,
+	0, 23, 159, -256, -2089, -765, 7793, 1208, -11142, 9383, 1440, -2420, -730, 162, 56, 1,
+	0, 24, 161, -275, -2115, -677, 7914, 742, -10365, 9355, 1310, -2415, -702, 163, 54, 1,
+	0, 26, 162, -295, -2139, -586, 8031, 261, -9606, 9320, 1181, -2408, -675, 165, 52, 1,
+	0, 27, 163, -315, -2163, -492, 8144, -235, -8865, 9279, 1055, -2400, -648, 166, 50, 1,
+	0, 28, 165, -336, -2187, -396, 8254, -747, -8140, 9231, 930, -2390, -621, 167, 48, 0,
+	0, 30, 166, -357, -2209, -298, 8360, -1274, -7433, 9178, 808, -2380, -595, 168, 46, 0,
+	0, 31, 167, -379, -2231, -198, 8463, -1817, -6742, 9119, 687, -2368, -569, 169, 44, 0,
+	0, 33, 167, -401, -2251, -95, 8561, -2376, -6069, 9055, 569, -2354, -544, 169, 42, 0,
+	0, 34, 168, -423, -2271, 10, 8655, -2950, -5412, 8985, 453, -2340, -519, 169, 41, 0,
+	0, 36, 169, -447, -2290, 118, 8745, -3541, -4772, 8910, 339, -2324, -494, 169, 39, 0,
+	0, 37, 169, -470, -2308, 227, 8829, -4148, -4148, 8829, 227, -2308, -470, 169, 37, 0,
+	0, 39, 169, -494, -2324, 339, 8910, -4772, -3541, 8745, 118, -2290, -447, 169, 36, 0,
+	0, 41, 169, -519, -2340, 453, 8985, -5412, -2950, 8655, 10, -2271, -423, 168, 34, 0,
+	0, 42, 169, -544, -2354, 569, 9055, -6069, -2376, 8561, -95, -2251, -401, 167, 33, 0,
+	0, 44, 169, -569, -2368, 687, 9119, -6742, -1817, 8463, -198, -2231, -379, 167, 31, 0,
+	0, 46, 168, -595, -2380, 808, 9178, -7433, -1274, 8360, -298, -2209, -357, 166, 30, 0,
+	0, 48, 167, -621, -2390, 930, 9231, -8140, -747, 8254, -396, -2187, -336, 165, 28, 0,
+	1, 50, 166, -648, -2400, 1055, 9279, -8865, -235, 8144, -492, -2163, -315, 163, 27, 0,
+	1, 52, 165, -675, -2408, 1181, 9320, -9606, 261, 8031, -586, -2139, -295, 162, 26, 0,
+	1, 54, 163, -702, -2415, 1310, 9355, -10365, 742, 7914, -677, -2115, -275, 161, 24, 0,
+	1, 56, 162, -730, -2420, 1440, 9383, -11142, 1208, 7793, -765, -2089, -256, 159, 23, 0,
+	1, 58, 160, -758, -2424, 1572, 9405, -11935, 1659, 7670, -851, -2063, -237, 157, 22, 0,
+	1, 60, 158, -787, -2427, 1705, 9420, -12747, 2094, 7544, -935, -2036, -219, 156, 21, 0,
+	1, 62, 155, -816, -2428, 1841, 9427, -13576, 2516, 7415, -1017, -2009, -201, 154, 20, 0,
+	1, 64, 153, -845, -2427, 1978, 9428, -14423, 2923, 7283, -1096, -1981, -183, 152, 19, 0,
+	1, 66, 150, -875, -2425, 2117, 9421, -15287, 3315, 7149, -1172, -1952, -167, 150, 18, 0,
+	2, 69, 146, -905, -2421, 2257, 9406, -16170, 3693, 7013, -1246, -1923, -150, 148, 17, 0,
+	2, 71, 143, -935, -2416, 2399, 9383, -17070, 4057, 6875, -1318, -1893, -134, 146, 16, 0,
+	2, 73, 139, -966, -2409, 2542, 9353, -17989, 4408, 6735, -1387, -1864, -119, 144, 15, 0,
+	2, 76, 135, -997, -2400, 2686, 9314, -18925, 4745, 6592, -1454, -1833, -104, 141, 14, 0,
+	2, 78, 130, -1028, -2389, 2831, 9266, -19880, 5068, 6449, -1519, -1802, -89, 139, 13, 0,
+	2, 81, 125, -1059, -2376, 2978, 9210, -20853, 5378, 6303, -1581, -1771, -75, 137, 13, 0,
+	3, 83, 120, -1091, -2362, 3126, 9145, -21844, 5675, 6157, -1640, -1740, -62, 134, 12, 0,
+	3, 85, 115, -1123, -2346, 3275, 9071, -22854, 5959, 6009, -1698, -1708, -49, 132, 11, 0,
+	3, 88, 109, -1155, -2328, 3424, 8987, -23881, 6230, 5860, -1753, -1676, -36, 129, 10, 0,
+	3, 91, 103, -1187, -2307, 3575, 8894, -24928, 6489, 5709, -1805, -1644, -24, 127, 10, 0,
+	4, 93, 96, -1219, -2285, 3726, 8792, -25992, 6735, 5559, -1856, -1612, -12, 124, 9, 0,
+	4, 96, 90, -1252, -2261, 3878, 8679, -27075, 6969, 5407, -1904, -1579, -1, 122, 9, 0,
+	4, 98, 82, -1284, -2235, 4030, 8557, -28177, 7191, 5255, -1949, -1547, 10, 119, 8, 0,
+	5, 101, 75, -1317, -2207, 4183, 8424, -29296, 7401, 5102, -1993, -1514, 21, 116, 7, 0,
+	5, 103, 67, -1350, -2177, 4336, 8281, -30435, 7599, 4949, -2034, -1481, 31, 114, 7, 0,
+	6, 106, 58, -1383, -2144, 4489, 8127, -31592, 7786, 4796, -2073, -1449, 40, 111, 6, 0,
+	6, 109, 49, -1416, -2110, 4642, 7962, -32767, 7962, 4642, -2110, -1416, 49, 109, 6, 0
+};
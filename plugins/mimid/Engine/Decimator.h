@@ -8,6 +8,8 @@ private:
 	const float h0,h1,h3,h5,h7,h9,h11,h13,h15,h17;
 	float R1,R2,R3,R4,R5,R6,R7,R8,R9,R10,R11,R12,R13,R14,R15,R16,R17;
 public:
+	// Group delay, in input samples
+	static const int GroupDelay = 17;
 	Decimator17()
 		: h0(0.5)
 		, h1(0.314356238)
@@ -84,3 +86,61 @@ public:
 		return R10;
 	}
 };
+// Upsampling counterpart of Decimator17, using the same halfband filter
+class Interpolator17
+{
+private:
+	const float h1,h3,h5,h7,h9,h11,h13,h15,h17;
+	// Input history, stored twice so that the last 18 samples are
+	// always available in order from x + pos, most recent first.
+	float x[36];
+	int pos;
+public:
+	// Group delay, in output samples
+	static const int GroupDelay = 17;
+	Interpolator17()
+		: h1(0.314356238 * 2)
+		, h3(-0.0947515890 * 2)
+		, h5(0.0463142134 * 2)
+		, h7(-0.0240881704 * 2)
+		, h9(0.0120250406 * 2)
+		, h11(-0.00543170841 * 2)
+		, h13(0.00207426259 * 2)
+		, h15(-0.000572688237 * 2)
+		, h17(5.18944944e-005 * 2)
+	{
+		for (int i = 0; i < 36; i++)
+			x[i] = 0;
+		pos = 0;
+	}
+	// Upsample samples input samples, with a stride of inStride,
+	// to twice as many output samples, with a stride of outStride,
+	// delayed by GroupDelay. For each input sample, the first output
+	// sample is halfway between it and the previous one, and the
+	// second corresponds to it. May be done in place, as long as
+	// inStride is 2 * outStride.
+	void process(const float *in, int inStride, float *out, int outStride, int samples)
+	{
+		// Local copy, as the compiler can't tell that out doesn't
+		// overlap it.
+		float h[36];
+		for (int i = 0; i < 36; i++)
+			h[i] = x[i];
+		int p = pos;
+
+		for (int i = 0; i < samples; i++) {
+			p = p ? p - 1 : 17;
+			h[p] = h[p + 18] = in[i * inStride];
+			const float *r = h + p;
+			float y0 = h1 * (r[8] + r[9]) + h3 * (r[7] + r[10]) + h5 * (r[6] + r[11]) +
+				   h7 * (r[5] + r[12]) + h9 * (r[4] + r[13]) + h11 * (r[3] + r[14]) +
+				   h13 * (r[2] + r[15]) + h15 * (r[1] + r[16]) + h17 * (r[0] + r[17]);
+			out[2 * i * outStride] = y0;
+			out[(2 * i + 1) * outStride] = r[8];
+		}
+
+		for (int i = 0; i < 36; i++)
+			x[i] = h[i];
+		pos = p;
+	}
+};
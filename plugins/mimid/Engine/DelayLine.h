@@ -50,6 +50,12 @@ public:
 		iidx = iidx & mask;
 		return dl[iidx];
 	}
+	// Sample that the delay'th next feedReturn() will return,
+	// for delay = 1 .. length - 1.
+	inline float peek(int delay)
+	{
+		return dl[(iidx - delay) & mask];
+	}
 	inline void fillZeroes()
 	{
 		zeromem(dl, DM * sizeof(float));
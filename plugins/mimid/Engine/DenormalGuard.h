@@ -0,0 +1,105 @@
+/*
+	==============================================================================
+	This file is part of the MiMi-d synthesizer.
+
+	Copyright 2026 Ricard Wanderlof
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+#pragma once
+
+#include <stdint.h>
+#if defined(__SSE__) || defined(__x86_64__)
+#include <xmmintrin.h>
+#endif
+
+// Flush denormals to zero for as long as the guard object exists.
+//
+// Filter and envelope states decay exponentially towards zero during
+// release tails, and when they reach the denormal range, arithmetic on
+// them can become many times slower on some CPUs. With the guard in
+// place, denormal results are flushed to zero (FTZ) and denormal
+// inputs are treated as zero (DAZ, x86 only; on ARM the FZ bit covers
+// both).
+//
+// The previous floating point mode is restored when the guard goes
+// out of scope, as the thread we're running in belongs to the host.
+
+class DenormalGuard
+{
+private:
+	uintptr_t savedMode;
+
+#if defined(__SSE__) || defined(__x86_64__)
+	static const uintptr_t FLUSH_BITS = 0x8040; // FTZ | DAZ
+	static inline uintptr_t getMode()
+	{
+		return _mm_getcsr();
+	}
+	static inline void setMode(uintptr_t mode)
+	{
+		_mm_setcsr(mode);
+	}
+#elif defined(__aarch64__)
+	static const uintptr_t FLUSH_BITS = 1 << 24; // FPCR.FZ
+	static inline uintptr_t getMode()
+	{
+		uint64_t fpcr;
+		asm volatile("mrs %0, fpcr" : "=r"(fpcr));
+		return fpcr;
+	}
+	static inline void setMode(uintptr_t mode)
+	{
+		uint64_t fpcr = mode;
+		asm volatile("msr fpcr, %0" : : "r"(fpcr));
+	}
+#elif defined(__arm__) && defined(__ARM_FP)
+	static const uintptr_t FLUSH_BITS = 1 << 24; // FPSCR.FZ
+	static inline uintptr_t getMode()
+	{
+		uint32_t fpscr;
+		asm volatile("vmrs %0, fpscr" : "=r"(fpscr));
+		return fpscr;
+	}
+	static inline void setMode(uintptr_t mode)
+	{
+		uint32_t fpscr = mode;
+		asm volatile("vmsr fpscr, %0" : : "r"(fpscr));
+	}
+#else
+	// Unknown architecture, leave mode alone
+	static const uintptr_t FLUSH_BITS = 0;
+	static inline uintptr_t getMode()
+	{
+		return 0;
+	}
+	static inline void setMode(uintptr_t)
+	{
+	}
+#endif
+
+public:
+	DenormalGuard()
+	{
+		savedMode = getMode();
+		if ((savedMode & FLUSH_BITS) != FLUSH_BITS)
+			setMode(savedMode | FLUSH_BITS);
+	}
+	~DenormalGuard()
+	{
+		if ((savedMode & FLUSH_BITS) != FLUSH_BITS)
+			setMode(savedMode);
+	}
+};
@@ -19,12 +19,18 @@
 	==============================================================================
  */
 #pragma once
+#include <math.h>
 
 class Dist
 {
 private:
 	const float distTarget = 1.5;
 
+	// Antialiased version state: previous input and its residual
+	// integral
+	float prevSample;
+	double prevIntegral;
+
 	//JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Dist)
 public:
 	float distAmount, distLimit, distPeak, distGainComp;
@@ -35,6 +41,8 @@ public:
 		distLimit=10;
 		distPeak=10;
 		distGainComp=1;
+		prevSample = 0;
+		prevIntegral = 0;
 	}
 	~Dist()
 	{
@@ -54,6 +62,46 @@ private:
 		return sample * (sample >= 0 ? (1 - distAmount * sample) :
 					       (1 + distAmount * sample));
 	}
+	// The nonlinear parts of the (uncompensated) distortions, i.e.
+	// minus the input, and their antiderivatives, which are even.
+	inline float clippedResidual(float sample, float dist)
+	{
+		if (sample > distLimit) return distPeak - sample;
+		if (sample < -distLimit) return -distPeak - sample;
+		return dist - sample;
+	}
+	// Beyond distLimit, given the integral up to distLimit
+	inline double clippedIntegral(double x, double limitIntegral)
+	{
+		return limitIntegral + distPeak * (x - distLimit) -
+		       0.5 * (x * x - distLimit * distLimit);
+	}
+	inline double cubeDistIntegral(double sample)
+	{
+		double x = fabs(sample);
+		if (x <= distLimit)
+			return -distAmount * x * x * x * x * 0.25;
+		return clippedIntegral(x, distLimit * distLimit * (-1.0 / 12));
+	}
+	inline double squareDistIntegral(double sample)
+	{
+		double x = fabs(sample);
+		if (x <= distLimit)
+			return -distAmount * x * x * x * (1.0 / 3);
+		return clippedIntegral(x, distLimit * distLimit * (-1.0 / 6));
+	}
+	// First order antiderivative antialiasing of the nonlinear
+	// part, given its integral at sample and, when ill conditioned,
+	// the value at the midpoint.
+	inline float antialias(float sample, double integral, float midResidual)
+	{
+		double delta = (double)sample - prevSample;
+		float res = fabs(delta) > 1e-5 ?
+			    (integral - prevIntegral) / delta : midResidual;
+		prevSample = sample;
+		prevIntegral = integral;
+		return (sample + res) * distGainComp;
+	}
 public:
 	void setSquareDistAmt(float val)
 	{
@@ -66,6 +114,7 @@ public:
 			distGainComp = distTarget/squareDist(distTarget);
 		else
 			distGainComp = distTarget/squareDist(distLimit);
+		prevIntegral = squareDistIntegral(prevSample);
 	}
 	void setCubeDistAmt(float val)
 	{
@@ -78,6 +127,7 @@ public:
 			distGainComp = distTarget/cubeDist(distTarget);
 		else
 			distGainComp = distTarget/cubeDist(distLimit);
+		prevIntegral = cubeDistIntegral(prevSample);
 	}
 	inline float applyCubeDist(float sample)
 	{
@@ -95,4 +145,18 @@ public:
 		sample *= distGainComp; // compensate for amplitude drop
 		return sample;
 	}
+	// Same as above, with first order antiderivative antialiasing
+	// of the nonlinear part, for use without oversampling.
+	inline float applyCubeDistAntialiased(float sample)
+	{
+		float mid = 0.5f * (sample + prevSample);
+		return antialias(sample, cubeDistIntegral(sample),
+				 clippedResidual(mid, cubeDist(mid)));
+	}
+	inline float applySquareDistAntialiased(float sample)
+	{
+		float mid = 0.5f * (sample + prevSample);
+		return antialias(sample, squareDistIntegral(sample),
+				 clippedResidual(mid, squareDist(mid)));
+	}
 };
@@ -0,0 +1,278 @@
+/*
+	==============================================================================
+	This file is part of the MiMi-d synthesizer.
+
+	Copyright 2026 Ricard Wanderlof
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+#pragma once
+#include <climits>
+#include "Filter.h"
+#include "Simd.h"
+
+// Runs the filters of SIMD_LANES voices at the same time, one voice
+// per vector lane, as the four pole ladder filter, or the cheaper two
+// pole filter when they all use that.
+//
+// The filter state stays in each voice's Filter object. It is loaded
+// into vectors at the start of process(), and stored back at the end,
+// so the voices making up a bank can change from one block to the
+// next.
+//
+// Sample buffers are interleaved: sample k of lane l is at index
+// k * LANES + l.
+
+class FilterBank
+{
+public:
+	static const int LANES = SIMD_LANES;
+
+private:
+	vfloat s1, s2, s3, s4;
+	vfloat srInv;
+	// Weights for each of the four stage outputs in the final mix,
+	// fading between adjacent cutoff slopes (24 - 18 - 12 - 6 dB/oct)
+	// according to the pole count.
+	vfloat w1, w2, w3, w4;
+	// Two pole filter: weight of the band pass output in the mix.
+	vfloat w2p;
+	bool twoPole;
+
+	void load(Filter *const filters[LANES])
+	{
+		twoPole = true;
+		for (int l = 0; l < LANES; l++)
+			if (filters[l])
+				twoPole &= filters[l]->isTwoPole();
+		for (int l = 0; l < LANES; l++) {
+			Filter *f = filters[l];
+			if (!f) {
+				// Unused lane: all zeroes, which keeps
+				// the lane quiet and its arithmetic
+				// cheap.
+				s1[l] = s2[l] = s3[l] = s4[l] = 0;
+				srInv[l] = 0;
+				w1[l] = w2[l] = w3[l] = w4[l] = 0;
+				w2p[l] = 0;
+				continue;
+			}
+			f->convertState(twoPole);
+			w2p[l] = f->mm > 2 ? f->mm - 2 : 0;
+			s1[l] = f->s1;
+			s2[l] = f->s2;
+			s3[l] = f->s3;
+			s4[l] = f->s4;
+			srInv[l] = f->sampleRateInv;
+			w1[l] = w2[l] = w3[l] = w4[l] = 0;
+			switch (f->mmch) {
+			case 0:
+				w4[l] = 1.0f - f->mmt;
+				w3[l] = f->mmt;
+				break;
+			case 1:
+				w3[l] = 1.0f - f->mmt;
+				w2[l] = f->mmt;
+				break;
+			case 2:
+				w2[l] = 1.0f - f->mmt;
+				w1[l] = f->mmt;
+				break;
+			case 3:
+				w1[l] = 1.0f;
+				break;
+			default:
+				break;
+			}
+		}
+	}
+	void store(Filter *const filters[LANES])
+	{
+		for (int l = 0; l < LANES; l++) {
+			Filter *f = filters[l];
+			if (!f)
+				continue;
+			f->s1 = s1[l];
+			f->s2 = s2[l];
+			f->s3 = s3[l];
+			f->s4 = s4[l];
+		}
+	}
+	// One sample of the four pole filter for all lanes.
+	inline vfloat tick(vfloat sample, vfloat g, vfloat r,
+			   vfloat &t1, vfloat &t2, vfloat &t3, vfloat &t4)
+	{
+		vfloat R24 = 4.2f * r;
+		// Prewarp, with tan() approximated by a truncated Taylor
+		// series: x + 1/3 * x^3
+		g = g * srInv * pi;
+		g = g * (1.0f + 1.0f/3.0f * g * g);
+
+		// Gain compensation for varying resonance values
+		sample *= 1.0f + R24 * 0.45f;
+
+		// Resolve the zero delay feedback
+		vfloat ml = 1.0f / (1.0f + g);
+		vfloat lpc = ml * g;
+
+		vfloat S = (lpc*(lpc*(lpc*t1 + t2) + t3) + t4) * ml;
+		// Alternate position for soft clip to avoid oscillation blowup.
+		// By clipping S, we only clip the feedback loop, i.e. no
+		// distortion when resonance is at 0. The amount of clipping is
+		// so small that it has negligible impact on the signal through
+		// the filter though, and clipping S gives a slight pitch
+		// offset (< 1 cent) when filter is oscillating.
+		// S *= 1 - S * S * 0.017784f;
+		vfloat G = lpc * lpc * lpc * lpc;
+		vfloat y0 = (sample - R24 * S) / (1.0f + R24 * G);
+
+		// Subtle amplitude limiting to avoid filter blowing up
+		// when resonating, using Taylor approximation truncated
+		// after third degree term, with appropriate scaling.
+		// The resulting distortion is so subtle that it hardly
+		// qualifies as distortion for the signal through the filter.
+		// The constant in the squared term sets the amplitude of
+		// the filter oscillation, and also limits the amount of
+		// resonance that can be achieved. The amplitude scales
+		// linearly with the inverse of the square of the constant,
+		// e.g. to tripple the oscillation amplitude, divide the
+		// constant by 3**2. 0.001010 gives an oscillation amplitude
+		// of approximately the same level as the ordinary signal
+		// through the filter (amplitude 3 for a single oscillator).
+		// Derivation:
+		// Soft clipping by multiplying sample value by scale,
+		// taking atan, and then dividing by scale to keep
+		// unclipped amplitude constant.
+		// y0 = atan(y0 * scale) / scale
+		// Truncated Taylor around x=0: atan(x) = x - (1/3)*x^3, so
+		// y0 = (y0 * scale - (1/3)*(y0 * scale)^3) / scale
+		// y0 = y0 - (1/3)*y0^3*scale^2
+		// y0 = y0 * (1 - (1/3)*y0^2 * scale^2)
+		// y0 *= 1 - (1/3)*y0^2 * scale^2
+		// Calculate (1/3) * scale^2 as a single constant scale':
+		// y0 *= 1 - y0^2 * scale'
+		y0 *= 1.0f - y0 * y0 * 0.001010f;
+
+		// Four single pole filter stages, as tptlpc()
+		vfloat v, y1, y2, y3, y4;
+		v = (y0 - t1) * lpc; y1 = v + t1; t1 = y1 + v;
+		v = (y1 - t2) * lpc; y2 = v + t2; t2 = y2 + v;
+		v = (y2 - t3) * lpc; y3 = v + t3; t3 = y3 + v;
+		v = (y3 - t4) * lpc; y4 = v + t4; t4 = y4 + v;
+
+		//return y0 - 4.0f*y1 + 6.0f*y2 - 4.0f*y3 + y4; // HPF output
+
+		return w4 * y4 + w3 * y3 + w2 * y2 + w1 * y1;
+	}
+	// One sample of the two pole filter for all lanes, which is
+	// cheaper than the four pole one, but only has 12 dB/oct slope,
+	// fading towards 6 dB/oct for pole counts below 2. Only uses t1
+	// and t2.
+	inline vfloat tick2(vfloat sample, vfloat g, vfloat r,
+			    vfloat &t1, vfloat &t2)
+	{
+		vfloat R = 1.0f - r;
+		g = g * srInv * pi;
+		g = g * (1.0f + 1.0f/3.0f * g * g);
+
+		// Resolve the zero delay feedback.
+		// Feedback non-linear transconductance, using a Taylor
+		// approximation of a slightly mismatched diode pair, and
+		// compensated for R (-1). 1.035 rather than 1.0 boosts the
+		// non-linearity; 1.0 avoids self oscillation.
+		vfloat x = t1 * 0.0876f;
+		vfloat tCfb = ((((0.0103592f)*x + 0.00920833f)*x + 0.185f)*x + 0.05f )*x + 1.0f - 1.035f;
+		vfloat v = (sample - 2.0f*(t1*(R+tCfb)) - g*t1  - t2) / (1.0f + g*(2.0f*(R+tCfb) + g));
+
+		vfloat y1 = v*g + t1;
+		t1 = v*g + y1;
+
+		vfloat y2 = y1*g + t2;
+		t2 = y1*g + y2;
+
+		// Mixing in the band pass output makes the slope fall
+		// off towards 6 dB/oct at pole count 1.
+		return y2 + w2p * 2.0f * R * y1;
+	}
+	template<bool TwoPole>
+	forceinline vfloat tick(vfloat sample, vfloat g, vfloat r,
+				vfloat &t1, vfloat &t2, vfloat &t3, vfloat &t4)
+	{
+		if (TwoPole)
+			return tick2(sample, g, r, t1, t2);
+		return tick(sample, g, r, t1, t2, t3, t4);
+	}
+	template<bool TwoPole>
+	void run(const int lengths[LANES], int minLength, int maxLength,
+		 const float *in, const float *cutoff, const float *res,
+		 float *out)
+	{
+		// All lanes running
+		int k = 0;
+		for (; k < minLength; k++) {
+			int i = k * LANES;
+			vstore(out + i, tick<TwoPole>(vload(in + i), vload(cutoff + i),
+						      vload(res + i), s1, s2, s3, s4));
+		}
+
+		// Some lanes have stopped (or were never started), so only
+		// update the state of those still running.
+		if (k < maxLength) {
+			vint len;
+			for (int l = 0; l < LANES; l++)
+				len[l] = lengths[l];
+			for (; k < maxLength; k++) {
+				int i = k * LANES;
+				vint running = vint{} + k < len;
+				vfloat t1 = s1, t2 = s2, t3 = s3, t4 = s4;
+				vstore(out + i, tick<TwoPole>(vload(in + i), vload(cutoff + i),
+							      vload(res + i), t1, t2, t3, t4));
+				s1 = vselect(running, t1, s1);
+				s2 = vselect(running, t2, s2);
+				s3 = vselect(running, t3, s3);
+				s4 = vselect(running, t4, s4);
+			}
+		}
+	}
+
+public:
+	// Process lane l of the input for lengths[l] samples, with the
+	// filter cutoff (in Hz) and resonance for each sample in the
+	// cutoff and res buffers. Lanes with no filter, and samples
+	// beyond the length of each lane, are ignored (and their output
+	// undefined). out may be the same buffer as in.
+	void process(Filter *const filters[LANES], const int lengths[LANES],
+		     const float *in, const float *cutoff, const float *res,
+		     float *out)
+	{
+		int minLength = INT_MAX, maxLength = 0;
+		for (int l = 0; l < LANES; l++) {
+			if (!filters[l])
+				continue;
+			if (lengths[l] < minLength) minLength = lengths[l];
+			if (lengths[l] > maxLength) maxLength = lengths[l];
+		}
+
+		if (!maxLength)
+			return;
+
+		load(filters);
+		if (twoPole)
+			run<true>(lengths, minLength, maxLength, in, cutoff, res, out);
+		else
+			run<false>(lengths, minLength, maxLength, in, cutoff, res, out);
+		store(filters);
+	}
+};
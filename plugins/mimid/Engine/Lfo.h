@@ -25,10 +25,22 @@
  */
 #pragma once
 #include "SynthEngine.h"
+
+// With FIXED_PHASE, the LFO phase is a 32 bit fixed point number,
+// 0..1 mapping to 0..2^32, so it wraps by itself and doesn't lose
+// precision as it gets larger, keeping clock synced LFOs in step
+// with the host in the long run.
+#ifdef FIXED_PHASE
+typedef uint32_t LfoPhase;
+#else
+typedef float LfoPhase;
+#endif
+
 class Lfo
 {
+	friend class LfoBank;
 private:
-	float phase; // 0 -> 1
+	LfoPhase phase; // 0 -> 1
 	float sh; // peak +1/-1
 	bool newCycle;
 	float lpstate;
@@ -48,6 +60,9 @@ private:
 	float symmetryRevInv;
 
 	float phaseInc;
+#ifdef FIXED_PHASE
+	LfoPhase phaseStep; // phaseInc / SampleRate
+#endif
 	float frequency; // frequency value without sync
 	float rawFrequency;
 	float bpm;
@@ -94,10 +109,51 @@ private:
 		8,		// 10
 	};
 
+#ifdef FIXED_PHASE
+	static const LfoPhase PhaseOne = 0xffffffff;
+	static LfoPhase toPhase(double val) // 0 <= val < 1
+	{
+		return val * 4294967296.0 + 0.5;
+	}
+	// Rounded to 24 bits, so that PhaseOne gives 1.
+	static float phaseValue(LfoPhase val)
+	{
+		return (int32_t)(((val >> 7) + 1) >> 1) * (1.0f / 16777216);
+	}
+#else
+	static constexpr LfoPhase PhaseOne = 1;
+	static LfoPhase toPhase(double val)
+	{
+		return val;
+	}
+	static float phaseValue(LfoPhase val)
+	{
+		return val;
+	}
+#endif
+	void setPhaseInc(float inc)
+	{
+		phaseInc = inc;
+#ifdef FIXED_PHASE
+		phaseStep = toPhase((double)phaseInc / SampleRate);
+#endif
+	}
+	// Phase increment per sample
+	LfoPhase getPhaseStep()
+	{
+#ifdef FIXED_PHASE
+		return phaseStep;
+#else
+		return phaseInc * SampleRateInv;
+#endif
+	}
+
 public:
 	Lfo(enum WaveType default_wavetype = OFF)
 	{
-		phaseInc = 0;
+		SampleRate = 44100;
+		SampleRateInv = 1 / SampleRate;
+		setPhaseInc(0);
 		frequency = 0;
 		bpm = 0;
 		syncRatio = 1;
@@ -121,9 +177,9 @@ public:
 		clockSynced = enable;
 		if (clockSynced) {
 			recalcRate(rawFrequency);
-			phaseInc = (bpm / 60.0) * syncRatio;
+			setPhaseInc((bpm / 60.0) * syncRatio);
 		} else
-			phaseInc = frequency * spread;
+			setPhaseInc(frequency * spread);
 	}
 	void setKeySync(bool enable)
 	{
@@ -131,7 +187,7 @@ public:
 		// When turning key sync off, reset phase, so that all
 		// voices run at the same phase.
 		if (!keySynced)
-			phase = 1;
+			phase = PhaseOne;
 	}
 	void setSymmetryOffset()
 	{
@@ -171,28 +227,28 @@ public:
 	{
 		bpm = newbpm;
 		if(clockSynced)
-			phaseInc = (bpm / 60.0) * syncRatio;
+			setPhaseInc((bpm / 60.0) * syncRatio);
 	}
 	void hostSyncRetrigger(float beatpos)
 	{
 		if(clockSynced)
 		{
-			phase = syncRatio * beatpos;
-			float phaseOld = phase;
-			phase = fmod(phase, 1);
+			float phaseOld = syncRatio * beatpos;
+			double phaseNew = fmod(phaseOld, 1);
+			phase = toPhase(phaseNew);
 			// It's unlikely that the beat sync will cause the
 			// phase to reset (or rather, it's much more likely
 			// to happen during an ordinary sample update), but
 			// if it does, trigger the S/H so we don't skip
 			// a cycle.
-			if (phase < phaseOld) // phase has wrapped
+			if (phaseNew < phaseOld) // phase has wrapped
 				newCycle = true;
 		}
 	}
 	inline float getVal()
 	{
 		float Res = 0;
-		float tmpPh = phase;
+		float tmpPh = phaseValue(phase);
 		switch (wavetype)
 		{
 			case OFF:
@@ -236,9 +292,18 @@ public:
 	{
 		SampleRate=sr;
 		SampleRateInv = 1 / SampleRate;
+		setPhaseInc(phaseInc);
 	}
 	inline void update()
 	{
+#ifdef FIXED_PHASE
+		LfoPhase p = phase + phaseStep;
+		bool wrap = p < phase;
+		// Oneshot mode - stop at the end
+		// Normal LFO mode - wrap, start new cycle
+		phase = wrap && oneShot ? PhaseOne : p;
+		newCycle |= wrap && !oneShot;
+#else
 		phase += phaseInc * SampleRateInv;
 		if (oneShot) {
 			// Oneshot mode - stop when phase reaches 1
@@ -251,6 +316,39 @@ public:
 				newCycle = true;
 			}
 		}
+#endif
+	}
+	// Update for a number of samples in one go (when the voice is
+	// not playing, and we just need to keep the phase going).
+	inline void update(int samples)
+	{
+		for (int i = 0; i < samples; i++)
+			update();
+	}
+	// Advance phase a number of samples in one go, without
+	// iterating. The end result may differ from calling update()
+	// the same number of times by rounding errors only (and not
+	// at all with FIXED_PHASE).
+	inline void advance(int samples)
+	{
+#ifdef FIXED_PHASE
+		uint64_t p = phase + (uint64_t)phaseStep * samples;
+		if (p >> 32) {
+			phase = oneShot ? PhaseOne : p;
+			newCycle |= !oneShot;
+		} else
+			phase = p;
+#else
+		phase += phaseInc * SampleRateInv * samples;
+		if (oneShot) {
+			if (phase > 1)
+				phase = 1;
+		} else if (phase > 1) {
+			// Keep within (0..1], as update() does
+			phase -= ceilf(phase) - 1;
+			newCycle = true;
+		}
+#endif
 	}
 	void setSpread(float val)
 	{
@@ -261,7 +359,7 @@ public:
 	{
 		frequency = val;
 		if (!clockSynced)
-			phaseInc = frequency * spread;
+			setPhaseInc(frequency * spread);
 	}
 	void setRawFrequency(float param) // for clock synced rate changes
 	{
@@ -269,7 +367,7 @@ public:
 		if (clockSynced)
 		{
 			recalcRate(param);
-			phaseInc = (bpm / 60.0) * syncRatio;
+			setPhaseInc((bpm / 60.0) * syncRatio);
 		}
 	}
 	void setSymmetry(float symm)
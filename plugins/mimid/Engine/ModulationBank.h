@@ -0,0 +1,239 @@
+/*
+	==============================================================================
+	This file is part of the MiMi-d synthesizer.
+
+	Copyright 2026 Ricard Wanderlof
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+#pragma once
+#include <limits>
+#include "Voice.h"
+#include "Simd.h"
+
+// Modulation sources (LFOs and envelopes) of SIMD_LANES voices, run
+// for a whole block at a time.
+//
+// The LFOs run together in vector lanes, one voice per lane. As with
+// FilterBank, their state stays in each voice's Lfo objects, and is
+// loaded into vectors at the start of a block and stored back at the
+// end. Instead of switching on the waveform, all waveforms in use are
+// calculated for all lanes and the right one selected for each lane.
+// The calculations are written the same way as in the scalar code, so
+// each lane gets exactly the same result as Lfo would give.
+//
+// The envelopes are run a segment at a time by
+// AdssrEnvelope::processBlock().
+
+// LFOs, doing what Lfo::update() and Lfo::getVal() do.
+class LfoBank
+{
+private:
+	Lfo *lfos[SIMD_LANES];
+#ifdef FIXED_PHASE
+	vuint phase;
+#else
+	vfloat phase;
+#endif
+	vfloat sh, lpstate;
+	vint newCycle;
+	vuint rnd;
+	// Parameters, which only change between blocks
+#ifdef FIXED_PHASE
+	vuint phaseStep;
+#else
+	vfloat phaseStep; // phaseInc * SampleRateInv
+#endif
+	vfloat symmetry, symmetryOffset, symmetryInv, symmetryRevInv;
+	vfloat polarityFactor, polarityOffset;
+	vfloat lpCutoff, lpCutoff1; // output smoothing filter cutoff, and 1 + that
+	vint oneShot;
+	vint triangle, pulse, sampleHold;
+	// Whether any lane uses each waveform
+	bool anyTriangle, anyPulse, anySampleHold;
+
+public:
+	void load(Lfo *const lanes[SIMD_LANES])
+	{
+		anyTriangle = anyPulse = anySampleHold = false;
+		for (int l = 0; l < SIMD_LANES; l++) {
+			Lfo *lfo = lfos[l] = lanes[l];
+			if (!lfo) {
+				// Unused lane: all zeroes, LFO off
+				phase[l] = sh[l] = lpstate[l] = 0;
+				newCycle[l] = oneShot[l] = 0;
+				rnd[l] = 0;
+				phaseStep[l] = lpCutoff[l] = 0;
+				lpCutoff1[l] = 1;
+				symmetry[l] = symmetryOffset[l] = 0;
+				symmetryInv[l] = symmetryRevInv[l] = 0;
+				polarityFactor[l] = polarityOffset[l] = 0;
+				triangle[l] = pulse[l] = sampleHold[l] = 0;
+				continue;
+			}
+			phase[l] = lfo->phase;
+			sh[l] = lfo->sh;
+			lpstate[l] = lfo->lpstate;
+			newCycle[l] = lfo->newCycle ? -1 : 0;
+			rnd[l] = lfo->rg.r;
+			phaseStep[l] = lfo->getPhaseStep();
+			symmetry[l] = lfo->symmetry;
+			symmetryOffset[l] = lfo->symmetryOffset;
+			symmetryInv[l] = lfo->symmetryInv;
+			symmetryRevInv[l] = lfo->symmetryRevInv;
+			polarityFactor[l] = lfo->polarity_factor;
+			polarityOffset[l] = lfo->polarity_offset;
+			lpCutoff[l] = (3000.0f * lfo->SampleRateInv) * pi;
+			lpCutoff1[l] = 1.0f + lpCutoff[l];
+			oneShot[l] = lfo->oneShot ? -1 : 0;
+			triangle[l] = lfo->wavetype == Lfo::TRIANGLE ? -1 : 0;
+			pulse[l] = lfo->wavetype == Lfo::PULSE ? -1 : 0;
+			sampleHold[l] = lfo->wavetype == Lfo::S_H ? -1 : 0;
+			anyTriangle |= lfo->wavetype == Lfo::TRIANGLE;
+			anyPulse |= lfo->wavetype == Lfo::PULSE;
+			anySampleHold |= lfo->wavetype == Lfo::S_H;
+		}
+	}
+	void store()
+	{
+		for (int l = 0; l < SIMD_LANES; l++) {
+			Lfo *lfo = lfos[l];
+			if (!lfo)
+				continue;
+			lfo->phase = phase[l];
+			lfo->sh = sh[l];
+			lfo->lpstate = lpstate[l];
+			lfo->newCycle = newCycle[l];
+			lfo->rg.r = rnd[l];
+		}
+	}
+	// Lfo::update() for all lanes
+	forceinline void update()
+	{
+#ifdef FIXED_PHASE
+		vuint p = phase + phaseStep;
+		vint wrap = p < phase;
+		phase = vselect(oneShot & wrap, vuint{} + Lfo::PhaseOne, p);
+		newCycle |= wrap & ~oneShot;
+#else
+		vfloat p = phase + phaseStep;
+		vint wrap = p > 1.0f;
+		// Oneshot mode stops at 1, normal mode starts a new cycle
+		phase = vselect(wrap, vselect(oneShot, vset(1.0f), p - 1.0f), p);
+		newCycle |= wrap & ~oneShot;
+#endif
+	}
+	// Lfo::getVal() for the running lanes
+	forceinline vfloat getVal(vint running)
+	{
+		static const float m =  1.0f / (std::numeric_limits<uint32_t>::max() + 1.0f);
+		// Only waveforms in use by some lane are calculated
+		vfloat res = {};
+#ifdef FIXED_PHASE
+		// Lfo::phaseValue()
+		vfloat phase = __builtin_convertvector((vint)(((this->phase >> 7) + 1) >> 1), vfloat) * (1.0f / 16777216);
+#endif
+		if (anySampleHold) {
+			vint draw = newCycle & sampleHold & running;
+			vuint r = rnd * 0xdeece66du + 11u;
+			rnd = vselect(draw, r, rnd);
+			sh = vselect(draw, __builtin_convertvector(r, vfloat) * m, sh);
+			res = vselect(sampleHold, sh, res);
+		}
+		if (anyPulse) {
+			vfloat pul = vselect(phase < symmetry, vset(1.0f), vfloat{});
+			res = vselect(pulse, pul, res);
+		}
+		if (anyTriangle) {
+			vfloat tri = phase + symmetryOffset;
+			tri -= vselect(tri > 1.0f, vset(1.0f), vfloat{}); // Handle wrap
+			tri = vselect(tri <= symmetry, tri * symmetryInv,
+				      (1.0f - tri) * symmetryRevInv);
+			res = vselect(triangle, tri, res);
+		}
+		res = res * polarityFactor + polarityOffset;
+		newCycle &= ~running;
+
+		// tptlpupw(lpstate, res, 3000, SampleRateInv)
+		vfloat v = (res - lpstate) * lpCutoff / lpCutoff1;
+		vfloat out = v + lpstate;
+		lpstate = vselect(running, out + v, lpstate);
+		return out;
+	}
+};
+
+// The three LFOs and two envelopes of SIMD_LANES voices.
+class ModulationBank
+{
+public:
+	static const int LANES = SIMD_LANES;
+	// Outputs for each voice, in the order stored by process(), for
+	// use by Voice::processModulation()
+	enum { LFO1, LFO2, LFO3, FENV, ENV, OUTPUTS };
+
+private:
+	LfoBank lfo1, lfo2, lfo3;
+
+public:
+	// Run the modulation sources of the voices in lanes (NULL for
+	// unused lanes) for ticks modulation ticks. Output k of lane l
+	// for tick t is stored at out[(l * OUTPUTS + k) * stride + t].
+	// The number of ticks for which the loudness envelope of each
+	// voice was active is stored to envTicks. In economy mode, the
+	// voice stops playing at that point, so its other modulation
+	// sources stop as well, apart from LFO phase, which is always
+	// updated to keep LFOs in phase.
+	void process(Voice *const lanes[LANES], int ticks, bool economyMode,
+		     float *out, int stride, int envTicks[LANES])
+	{
+		vint runTicks;
+		Lfo *lfos[3][LANES];
+		for (int l = 0; l < LANES; l++) {
+			Voice *voice = lanes[l];
+			lfos[0][l] = voice ? &voice->lfo1 : NULL;
+			lfos[1][l] = voice ? &voice->lfo2 : NULL;
+			lfos[2][l] = voice ? &voice->lfo3 : NULL;
+			runTicks[l] = envTicks[l] = 0;
+			if (!voice)
+				continue;
+			float *o = out + l * OUTPUTS * stride;
+			envTicks[l] = voice->env.processBlock(o + ENV * stride, ticks);
+			runTicks[l] = economyMode ? envTicks[l] : ticks;
+			voice->fenv.processBlock(o + FENV * stride, runTicks[l]);
+		}
+
+		lfo1.load(lfos[0]);
+		lfo2.load(lfos[1]);
+		lfo3.load(lfos[2]);
+		for (int t = 0; t < ticks; t++) {
+			lfo1.update();
+			lfo2.update();
+			lfo3.update();
+			vint running = vint{} + t < runTicks;
+			vfloat v1 = lfo1.getVal(running);
+			vfloat v2 = lfo2.getVal(running);
+			vfloat v3 = lfo3.getVal(running);
+			for (int l = 0; l < LANES; l++) {
+				float *o = out + l * OUTPUTS * stride + t;
+				o[LFO1 * stride] = v1[l];
+				o[LFO2 * stride] = v2[l];
+				o[LFO3 * stride] = v3[l];
+			}
+		}
+		lfo1.store();
+		lfo2.store();
+		lfo3.store();
+	}
+};
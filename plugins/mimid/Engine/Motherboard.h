@@ -29,15 +29,51 @@
 #include "SynthEngine.h"
 #include "Panning.h"
 #include "Lfo.h"
+#include "AlignedBuffer.h"
+#include "WorkerPool.h"
+#include "FilterBank.h"
+#include "ModulationBank.h"
 
 class Motherboard
 {
 public:
 	const static int MAX_VOICES = 32;
-	const static int modRatio = 1;
+	const static int MAX_MOD_RATIO = 32;
+	const static int DEFAULT_BLOCK_SIZE = 512;
+	// Frames of silent output needed after the last voice has
+	// stopped before we go to sleep; enough to flush the decimator.
+	const static int SLEEP_DELAY = 32;
+	// Voices are rendered in groups, one voice per lane of a
+	// FilterBank and a ModulationBank.
+	const static int GROUP_SIZE = FilterBank::LANES;
+	const static int MAX_GROUPS = (MAX_VOICES + GROUP_SIZE - 1) / GROUP_SIZE;
 private:
 	int totalvc;
 	Decimator17 leftDecim, rightDecim;
+	// Scratch buffers for block rendering, sized for maxBlockSize
+	// frames (times two, to allow for oversampling where applicable).
+	int maxBlockSize;
+	int voiceBufferStride;
+	AlignedBuffer voiceBuffers; // one stride per voice
+	// Filter input (then output), cutoff, resonance and VCA gain
+	// for each group, interleaved as FilterBank wants them.
+	int groupBufferStride;
+	AlignedBuffer groupBuffers; // four strides per group
+	// Modulation source outputs for each modulation tick for each
+	// group, as stored by ModulationBank::process(), with a stride
+	// of maxBlockSize.
+	int modBufferStride;
+	AlignedBuffer modBuffers; // one stride per group
+	AlignedBuffer mixBufferL, mixBufferR;
+	// Dense lists of voice numbers of voices which need to be fully
+	// processed, and those which only need housekeeping, respectively.
+	int activeVoices[MAX_VOICES], idleVoices[MAX_VOICES];
+	int activeCount, idleCount;
+	// Threads for rendering voices in parallel
+	WorkerPool workerPool;
+	int renderFrames; // block size for renderActiveGroup()
+	// Number of frames since a voice was last playing
+	int silentFrames;
 
 public:
 	float volume;
@@ -45,16 +81,32 @@ public:
 	Voice voices[MAX_VOICES];
 	VoiceAllocator<MAX_VOICES> voiceAlloc;
 	float sampleRate;
-	bool oversample;
+	// Oversampling modes: everything, or only the filter onwards,
+	// with the oscillators at the base rate and their output
+	// upsampled.
+	enum { OVERSAMPLE_OFF, OVERSAMPLE_ON, OVERSAMPLE_FILTER };
+	bool oversample; // voice output at twice the sample rate
+	bool upsample; // oscillators at the sample rate nevertheless
+	int modRatio; // audio samples per modulation tick
 	int modCount;
 	bool economyMode;
+	int threadCount;
+	// Per-sample values of the smoothed global controllers for the
+	// current block, filled in by the SynthEngine before processBlock().
+	AlignedBuffer cutoffBuffer, pitchWheelBuffer, modWheelBuffer;
 	Motherboard(): leftDecim(), rightDecim(), pannings(), voiceAlloc(voices, pannings)
 	{
+		setMaxBlockSize(DEFAULT_BLOCK_SIZE);
 		economyMode = true;
-		oversample = false;
+		threadCount = 1;
+		renderFrames = 0;
+		silentFrames = 0;
+		oversample = upsample = false;
+		modRatio = 1;
 		modCount = 0;
 		volume = 0;
 		totalvc = MAX_VOICES;
+		activeCount = idleCount = 0;
 		for (int i = 0; i < MAX_VOICES;++i) {
 			voices[i].voiceNumber = i;
 			voices[i].buddy = NULL;
@@ -87,10 +139,12 @@ public:
 	}
 	void setSampleRate()
 	{
-		int oversampleRatio = oversample ? 2 : 1;
+		bool oscOversample = oversample && !upsample;
+		int oscRatio = oscOversample ? 2 : 1;
+		int filterRatio = oversample ? 2 : 1;
 		for (int i = 0; i < MAX_VOICES; i++) {
-			voices[i].setHQ(oversample);
-			voices[i].setSampleRate(sampleRate, oversampleRatio, modRatio);
+			voices[i].setHQ(oscOversample);
+			voices[i].setSampleRate(sampleRate, oscRatio, filterRatio, modRatio);
 		}
 	}
 	void setSampleRate(float sr)
@@ -98,11 +152,72 @@ public:
 		sampleRate = sr;
 		setSampleRate();
 	}
-	void setOversample(bool over)
+	void setOversample(int mode)
 	{
-		oversample = over;
+		oversample = mode != OVERSAMPLE_OFF;
+		upsample = mode == OVERSAMPLE_FILTER;
 		setSampleRate();
 	}
+	// Render voices on up to count threads. The worker threads are
+	// started here rather than when rendering, so that processBlock()
+	// never creates any threads.
+	void setThreadCount(int count)
+	{
+		threadCount = count;
+		if (count > 1)
+			workerPool.start();
+	}
+	// Run modulation (LFOs, envelopes, etc) once every ratio samples,
+	// with control values interpolated in between.
+	void setModRatio(int ratio)
+	{
+		if (ratio < 1) ratio = 1;
+		if (ratio > MAX_MOD_RATIO) ratio = MAX_MOD_RATIO;
+		if (ratio == modRatio)
+			return;
+		modRatio = ratio;
+		modCount = 0;
+		setSampleRate();
+	}
+	// Allocate scratch buffers for the maximum block size the host
+	// will use. Must not be called from the audio thread.
+	void setMaxBlockSize(int frames)
+	{
+		if (frames < 1) frames = 1;
+		maxBlockSize = frames;
+		// Round stride up to a whole number of cache lines
+		voiceBufferStride = (2 * frames + 15) & ~15;
+		voiceBuffers.resize(voiceBufferStride * MAX_VOICES);
+		groupBufferStride = voiceBufferStride * GROUP_SIZE;
+		groupBuffers.resize(groupBufferStride * 4 * MAX_GROUPS);
+		modBufferStride = frames * ModulationBank::OUTPUTS * GROUP_SIZE;
+		modBuffers.resize(modBufferStride * MAX_GROUPS);
+		mixBufferL.resize(2 * frames);
+		mixBufferR.resize(2 * frames);
+		cutoffBuffer.resize(frames);
+		pitchWheelBuffer.resize(frames);
+		modWheelBuffer.resize(frames);
+	}
+	inline int getMaxBlockSize()
+	{
+		return maxBlockSize;
+	}
+	// Delay from a note event to the corresponding output, in samples.
+	// The oscillators delay their output by just under 2 * Samples
+	// samples at the oscillator rate (the pitch delay line plus the
+	// BLEP buffer), and the envelope delay line matches that. When
+	// oversampling, the decimator adds its group delay on top, as
+	// does the interpolator when only the filter is oversampled.
+	int getLatency()
+	{
+		int oscDelay = 2 * Samples - 1;
+		if (upsample)
+			return oscDelay + (Interpolator17::GroupDelay +
+					   Decimator17::GroupDelay + 1) / 2;
+		if (oversample)
+			return (oscDelay + Decimator17::GroupDelay + 1) / 2;
+		return oscDelay;
+	}
 	void sustainOn()
 	{
 		for (int i = 0; i < MAX_VOICES; i++)
@@ -123,51 +238,318 @@ public:
 		pannings.params.unisonSpreadAmt = val; // 0..1
 		pannings.updatePannings();
 	}
-	inline float processSynthVoice(Voice& voice, bool processMod)
+	// Keep LFOs and aftertouch of a voice which is not playing going
+	// for a number of modulation ticks, the same way as
+	// renderGroupModulation() and renderVoicePreFilter() would do.
+	inline void processIdleVoice(Voice &voice, int ticks)
 	{
-		if (processMod) {
-			voice.checkAdssrState();
-			// Always update LFOs to keep them in phase even if
-			// voice is not playing, as well as updating
-			// aftertouch in case it continues to change
-			// after voice has stopped playing, to avoid an
-			// unexpected aftertouch value next time it triggers.
-			voice.lfo1.update();
-			voice.lfo2.update();
-			voice.lfo3.update();
+		voice.lfo1.update(ticks);
+		voice.lfo2.update(ticks);
+		voice.lfo3.update(ticks);
+		for (int i = 0; i < ticks; i++)
 			voice.aftert = voice.afterTouchSmoother.smoothStep();
+	}
+	// Rebuild the active and idle voice lists.
+	// Voices are only triggered by note on events, which always
+	// occur between blocks, so we catch all newly triggered voices by
+	// doing this at the start of each block. Voices which stop
+	// playing during a block (when their loudness envelope reaches
+	// OFF) remain in the active list until the end of the block.
+	inline void updateVoiceLists()
+	{
+		activeCount = idleCount = 0;
+		for (int i = 0; i < totalvc; i++) {
+			if (voices[i].shouldProcess || !economyMode)
+				activeVoices[activeCount++] = i;
+			else
+				idleVoices[idleCount++] = i;
 		}
-		if (voice.shouldProcess || !economyMode) {
+	}
+	// Run the modulation sources of a group of voices (NULL for
+	// unused lanes) for a whole block, writing their outputs for each
+	// modulation tick to mod, and the frame at which each voice stops
+	// playing (or frames if it doesn't) to stopFrames.
+	// All voices in the group are playing at the start of the block,
+	// as in economy mode only those which should be processed are
+	// rendered.
+	void renderGroupModulation(Voice *const lanes[GROUP_SIZE], int frames,
+				   float *mod, int stopFrames[GROUP_SIZE])
+	{
+		// Modulation ticks occur every modRatio frames, the
+		// first one at frame firstTick.
+		int firstTick = modRatio - 1 - modCount;
+		int ticks = (modCount + frames) / modRatio;
+		int envTicks[GROUP_SIZE];
+
+		ModulationBank modBank;
+		modBank.process(lanes, ticks, economyMode, mod, maxBlockSize, envTicks);
+
+		for (int l = 0; l < GROUP_SIZE; l++) {
+			Voice *voice = lanes[l];
+			stopFrames[l] = 0;
+			if (!voice)
+				continue;
+			// A voice stops at the first tick at which its
+			// loudness envelope isn't active.
+			bool stopped = envTicks[l] < ticks;
+			if (stopped && economyMode)
+				stopFrames[l] = firstTick + envTicks[l] * modRatio;
+			else
+				stopFrames[l] = frames;
+			// Voice::checkAdssrState(), as of the last tick
+			if (ticks)
+				voice->shouldProcess = !stopped;
+		}
+	}
+	// Run a voice up to its filter for a whole block, writing filter
+	// input, cutoff, resonance and VCA gain for each sample to the
+	// respective buffers, with a stride of GROUP_SIZE.
+	// When oversampling, the two samples for each output sample are
+	// stored consecutively. When only oversampling the filter, the
+	// voice is run at the base rate, storing every other sample, and
+	// then upsampled.
+	// Modulation source outputs are taken from mod, as written by
+	// renderGroupModulation() for the voice, and the voice stops at
+	// stopFrame.
+	// Returns the number of samples actually processed, which is
+	// less than the block length if the voice stops during the block.
+	int renderVoicePreFilter(Voice &voice, const float *mod, int stopFrame,
+				 float *in, float *cutoff, float *res, float *gain,
+				 int frames)
+	{
+		const int stride = GROUP_SIZE;
+		const float *cutoffs = cutoffBuffer.get();
+		const float *pitchWheels = pitchWheelBuffer.get();
+		const float *modWheels = modWheelBuffer.get();
+		const int modStride = maxBlockSize;
+		int modPhase = modCount;
+		int tick = 0;
+		int n = 0;
+		int done = 0; // samples returned by getPreFilterSamples()
+		int samplesPerFrame = oversample && !upsample ? 2 : 1;
+		// Stride of the samples as output by the voice
+		const int voiceStride = upsample ? 2 * stride : stride;
+
+		for (int i = 0; i < frames; i++) {
+			voice.cutoff = cutoffs[i];
+			voice.pitchWheel = pitchWheels[i];
+			voice.modw = modWheels[i];
+
+			// Run modulation at fraction of sample rate, up to 1:1
+			if (++modPhase >= modRatio) modPhase = 0;
+			bool processMod = (modPhase == 0);
+
+			// Update aftertouch in case it continues to change
+			// after voice has stopped playing, to avoid an
+			// unexpected aftertouch value next time it triggers.
 			if (processMod)
-				voice.processModulation();
-			return voice.processAudioSample();
+				voice.aftert = voice.afterTouchSmoother.smoothStep();
+			if (i >= stopFrame)
+				continue;
+			if (processMod) {
+				const float *m = mod + tick++;
+				voice.processModulation(m[ModulationBank::LFO1 * modStride],
+							m[ModulationBank::LFO2 * modStride],
+							m[ModulationBank::LFO3 * modStride],
+							m[ModulationBank::FENV * modStride],
+							m[ModulationBank::ENV * modStride]);
+			}
+
+			for (int j = 0; j < samplesPerFrame; j++) {
+				int k = n * voiceStride;
+				voice.processPreFilter(res[k], gain[k]);
+				n++;
+				if (voice.preFilterBatchFull()) {
+					voice.getPreFilterSamples(in + done * voiceStride,
+								  cutoff + done * voiceStride,
+								  voiceStride);
+					done = n;
+				}
+			}
+		}
+		voice.getPreFilterSamples(in + done * voiceStride,
+					  cutoff + done * voiceStride, voiceStride);
+		if (upsample) {
+			voice.upsamplePreFilter(in, cutoff, res, gain, stride, n);
+			n *= 2;
 		}
-		return 0;
+
+		// Keep the filter bank lane quiet for the rest of the block
+		int len = oversample ? frames * 2 : frames;
+		for (int j = n; j < len; j++) {
+			int k = j * stride;
+			in[k] = cutoff[k] = res[k] = 0;
+		}
+		return n;
+	}
+	// Run a voice from its filter output to its scratch buffer, for
+	// the number of samples returned by renderVoicePreFilter().
+	void renderVoicePostFilter(Voice &voice, const float *in, const float *gain,
+				   int samples, float *out, int len)
+	{
+		voice.processPostFilter(in, gain, GROUP_SIZE, samples, out);
+		for (int j = samples; j < len; j++)
+			out[j] = 0;
+
+		// A filter which has blown up would otherwise continue to
+		// output garbage (and burn cycles on NaN arithmetic)
+		// forever; reset it, and drop what it output this block
+		// so it doesn't get into the decimator.
+		if (voice.resetIfUnstable())
+			zeromem(out, len * sizeof(float));
 	}
-	void processSample(float* sm1, float* sm2)
+	// Render a group of up to GROUP_SIZE voices from the active list
+	// for a whole block into their scratch buffers.
+	void renderVoiceGroup(int group, int frames)
 	{
-		float vl = 0, vr = 0;
-		float vlo = 0, vro = 0;
+		const int stride = GROUP_SIZE;
+		float *in = groupBuffers.get() + group * 4 * groupBufferStride;
+		float *cutoff = in + groupBufferStride;
+		float *res = cutoff + groupBufferStride;
+		float *gain = res + groupBufferStride;
+		float *mod = modBuffers.get() + group * modBufferStride;
+		int len = oversample ? frames * 2 : frames;
+		Voice *lanes[GROUP_SIZE];
+		Filter *filters[GROUP_SIZE];
+		int lengths[GROUP_SIZE], stopFrames[GROUP_SIZE];
 
-		// Run modulation at fraction of sample rate, up to 1:1
-		if (++modCount >= modRatio) modCount = 0;
-		bool processMod = (modCount == 0);
+		for (int l = 0; l < GROUP_SIZE; l++) {
+			int item = group * GROUP_SIZE + l;
+			lanes[l] = item < activeCount ? &voices[activeVoices[item]] : NULL;
+		}
+		renderGroupModulation(lanes, frames, mod, stopFrames);
 
-		for (int i = 0; i < totalvc; i++) {
-			float x1 = processSynthVoice(voices[i], processMod);
-			if (oversample) {
-				float x2 = processSynthVoice(voices[i], false);
-				vlo += x2 * pannings[i].lPanning;
-				vro += x2 * pannings[i].rPanning;
+		for (int l = 0; l < GROUP_SIZE; l++) {
+			if (!lanes[l]) {
+				// Unused lane in last group
+				filters[l] = NULL;
+				lengths[l] = 0;
+				for (int j = 0; j < len; j++) {
+					int k = j * stride + l;
+					in[k] = cutoff[k] = res[k] = 0;
+				}
+				continue;
+			}
+			Voice &voice = *lanes[l];
+			filters[l] = &voice.flt;
+			lengths[l] = renderVoicePreFilter(voice, mod + l * ModulationBank::OUTPUTS * maxBlockSize,
+							  stopFrames[l],
+							  in + l, cutoff + l, res + l,
+							  gain + l, frames);
+		}
+
+		FilterBank filterBank;
+		filterBank.process(filters, lengths, in, cutoff, res, in);
+
+		for (int l = 0; l < GROUP_SIZE && filters[l]; l++) {
+			int i = activeVoices[group * GROUP_SIZE + l];
+			renderVoicePostFilter(voices[i], in + l, gain + l, lengths[l],
+					      voiceBuffers.get() + i * voiceBufferStride, len);
+		}
+	}
+	// Render one of the voice groups, for renderFrames.
+	// This is called by the worker pool for each group, in any
+	// order and possibly from several threads at the same time,
+	// so it must not touch anything but the voices in the group and
+	// their scratch buffers.
+	static void renderActiveGroup(void *context, int group)
+	{
+		Motherboard *mb = (Motherboard *)context;
+		mb->renderVoiceGroup(group, mb->renderFrames);
+	}
+	// With economy mode on, once no voices have been playing for
+	// long enough for the output to have died out, there is no
+	// audio processing to be done until the next note on.
+	inline bool isAsleep()
+	{
+		if (!economyMode || silentFrames < SLEEP_DELAY)
+			return false;
+		for (int i = 0; i < totalvc; i++)
+			if (voices[i].shouldProcess)
+				return false;
+		return true;
+	}
+	// Output a block of silence when isAsleep(), only keeping
+	// the LFOs and aftertouch going, so that they have the values
+	// they would otherwise have had when the next note starts.
+	void processSleepBlock(float *left, float *right, int frames)
+	{
+		zeromem(left, frames * sizeof(float));
+		zeromem(right, frames * sizeof(float));
+
+		int modTicks = (modCount + frames) / modRatio;
+		if (modTicks) {
+			for (int i = 0; i < totalvc; i++) {
+				Voice &voice = voices[i];
+				voice.lfo1.advance(modTicks);
+				voice.lfo2.advance(modTicks);
+				voice.lfo3.advance(modTicks);
+				voice.aftert = voice.afterTouchSmoother.advance(modTicks);
+			}
+		}
+		modCount = (modCount + frames) % modRatio;
+	}
+	// Render a block of at most maxBlockSize frames.
+	// Rather than running through all voices for each sample, we run
+	// each voice for the whole block, keeping its state in the cache
+	// while it is being processed, and then mix down the resulting
+	// voice buffers.
+	void processBlock(float *left, float *right, int frames)
+	{
+		int len = oversample ? frames * 2 : frames;
+		float *mixL = mixBufferL.get();
+		float *mixR = mixBufferR.get();
+
+		updateVoiceLists();
+
+		// With more than one thread, the voice groups are shared
+		// out between the threads. Since each voice is rendered to
+		// its own buffer and the buffers are mixed down in voice
+		// order below, the result is the same regardless of the
+		// number of threads.
+		renderFrames = frames;
+		int groupCount = (activeCount + GROUP_SIZE - 1) / GROUP_SIZE;
+		workerPool.run(renderActiveGroup, this, groupCount, threadCount);
+
+		// Voices which are not playing only need to have their
+		// LFOs and aftertouch updated, which we do in one go for
+		// all the modulation ticks in the block.
+		int modTicks = (modCount + frames) / modRatio;
+		for (int j = 0; j < idleCount; j++)
+			processIdleVoice(voices[idleVoices[j]], modTicks);
+
+		modCount = (modCount + frames) % modRatio;
+
+		if (activeCount)
+			silentFrames = 0;
+		else if (silentFrames < SLEEP_DELAY)
+			silentFrames += frames;
+
+		// Pan and sum voices in voice order, so we get exactly
+		// the same result as when summing per sample.
+		for (int k = 0; k < len; k++)
+			mixL[k] = mixR[k] = 0;
+		for (int j = 0; j < activeCount; j++) {
+			int i = activeVoices[j];
+			const float *buf = voiceBuffers.get() + i * voiceBufferStride;
+			float lPanning = pannings[i].lPanning;
+			float rPanning = pannings[i].rPanning;
+			for (int k = 0; k < len; k++) {
+				mixL[k] += buf[k] * lPanning;
+				mixR[k] += buf[k] * rPanning;
 			}
-			vl += x1 * pannings[i].lPanning;
-			vr += x1 * pannings[i].rPanning;
 		}
+
 		if (oversample) {
-			vl = leftDecim.Calc(vl, vlo);
-			vr = rightDecim.Calc(vr, vro);
+			for (int k = 0; k < frames; k++) {
+				left[k] = leftDecim.Calc(mixL[2 * k], mixL[2 * k + 1]) * volume;
+				right[k] = rightDecim.Calc(mixR[2 * k], mixR[2 * k + 1]) * volume;
+			}
+		} else {
+			for (int k = 0; k < frames; k++) {
+				left[k] = mixL[k] * volume;
+				right[k] = mixR[k] * volume;
+			}
 		}
-		*sm1 = vl * volume;
-		*sm2 = vr * volume;
 	}
 };
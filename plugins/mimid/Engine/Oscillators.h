@@ -82,6 +82,8 @@ public:
 
 class Oscillators
 {
+public:
+	static const int MaxBatch = Antialias::MaxBatch;
 private:
 	float SampleRate;
 	float sampleRateInv;
@@ -93,6 +95,16 @@ private:
 
 	float x1, x2;
 
+	// Samples generated in the current batch, and the noise used for
+	// each of them, which the mix needs later on.
+	int batchCount;
+	float batchNoise[MaxBatch];
+	// With xmod, the osc 1 pitch without the osc 2 part, for each
+	// sample in the batch, which getSamples() completes and feeds
+	// to cvd once the osc 2 output is available.
+	bool batchXmod;
+	float batchOsc1Note[MaxBatch];
+
 	float osc1Factor;
 	float osc2Factor;
 	float osc1Random;
@@ -105,6 +117,16 @@ private:
 	DelayLine<Samples> cvd;
 	SRandom wn;
 	Antialias o1aa, o2aa, subaa;
+	// All oscillators mixed, when merged
+	Antialias mixaa;
+	bool merged;
+	// Oscillators whose output is used, and whether they have just
+	// come into use, needing their waveform state resynced.
+	bool osc1Active, osc2Active, subActive;
+	bool osc1Resync, osc2Resync;
+	// Sample generation, specialized for the current waveforms
+	typedef void (Oscillators::*SampleKernel)();
+	SampleKernel sampleKernel;
 	SawOsc o1s, o2s;
 	PulseOsc o1p, o2p;
 	//TriangleOsc o1t, o2t;
@@ -140,10 +162,13 @@ public:
 
 	bool keyReset;
 
+	// Osc 2 output used for filter modulation
+	bool osc2FltModActive;
+
 	float unused1, unused2; //TODO remove
 
 	Oscillators(OscillatorParams &oscpars, OscillatorModulation &oscmod) :
-		o1aa(), o2aa(), subaa(),
+		o1aa(), o2aa(), subaa(), mixaa(),
 		o1s(o1aa), o2s(o2aa),
 		o1p(o1aa), o2p(o2aa),
 		//o1t(o1aa), o2t(o2aa),
@@ -166,11 +191,19 @@ public:
 		xmod = 0;
 		syncLevel = 1.0f;
 		notePlaying = 30;
-		o1mx = o2mx = 0;
+		o1mx = o2mx = o2submx = 0;
 		x1 = wn.nextFloat();
 		x2 = wn.nextFloat(); // osc2 and 3 start in phase
 		SawMaxGrad = 1.0f;
 		keyReset = false;
+		batchCount = 0;
+		batchXmod = false;
+		merged = false;
+		// Start out as if all had been running, as they used to
+		osc1Active = osc2Active = subActive = true;
+		osc1Resync = osc2Resync = false;
+		sampleKernel = &Oscillators::processSample<0, 0, false>;
+		osc2FltModActive = false;
 	}
 	~Oscillators()
 	{
@@ -200,18 +233,21 @@ public:
 		osc1Factor = osc1Random * totalSpread;
 		osc2Factor = osc2Random * totalSpread;
 	}
-	inline void ProcessSample(float &audioOutput, float &modOutput)
+	// Osc 2 pitch, in notes (relative to 440 Hz).
+	forceinline float osc2Note(float noiseGen)
+	{
+		return dirt * noiseGen + notePlaying + oscparams.osc2Det + oscparams.osc2p + oscmodulation.pto2 + oct_tune + osc2Factor;
+	}
+	// Osc 2 waveform Wave generation, after its phase x2 has been advanced
+	// by fs. Sets hsr and hsfrac if osc 2 has reset, which is the hard
+	// sync signal for osc 1.
+	template<int Wave>
+	forceinline void processOsc2(float &x2, float fs, int &hsr, float &hsfrac)
 	{
-		// osc 2 = master oscillator
-		float noiseGen = wn.nextFloat() - 0.5f;
-		float pitch2 = getPitch(dirt * noiseGen + notePlaying + oscparams.osc2Det + oscparams.osc2p + oscmodulation.pto2 + oct_tune + osc2Factor);
 		// hard sync is subject to sync level parameter
 		// osc key sync results in unconditional hard sync
-		int hsr = 0; // 1 => hard sync, -1 => unconditional hard sync
-		float hsfrac = 0.0f;
-		float fs = minf(pitch2 * sampleRateInv, 0.45f);
-		x2 += fs;
-		float osc2mix = 0.0f;
+		hsr = 0; // 1 => hard sync, -1 => unconditional hard sync
+		hsfrac = 0.0f;
 
 #define PhaseResetMaster(x2, fs, hsr, hsfrac, keyReset) \
 		if (keyReset) { \
@@ -224,11 +260,13 @@ public:
 			hsr = 1; /* hard sync governed by sync level */ \
 		}
 
-		switch (oscparams.osc2Wave) {
+		switch (Wave) {
 		case 2: // Pulse
+			if (osc2Resync)
+				o2p.resyncState(x2 - fs, pw2calc);
 			o2p.processMaster(x2, fs, pw2calc, keyReset);
 			PhaseResetMaster(x2, fs, hsr, hsfrac, keyReset);
-			osc2mix = o2p.getValue(x2, pw2calc);
+			o2p.putValue(x2, pw2calc);
 			break;
 		case 3:	{ // Triangle / Trapezoid
 			float symmetry = limitf(symmetry2, MinTraSymmetry * fs, 1 - MinTraSymmetry * fs);
@@ -236,9 +274,11 @@ public:
 			float riseGradient = 1.0f / symmetry;
 			float fallGradient = 1.0f / (symmetry - 1.0f);
 
+			if (osc2Resync)
+				o2z.resyncState(x2 - fs, symmetry);
 			o2z.processMaster(x2, fs, symmetry, riseGradient, fallGradient, keyReset);
 			PhaseResetMaster(x2, fs, hsr, hsfrac, keyReset);
-			osc2mix = o2z.getValue(x2, symmetry, riseGradient, fallGradient);
+			o2z.putValue(x2, symmetry, riseGradient, fallGradient);
 			}
 			break;
 		case 1:	// Saw / variable slope saw
@@ -268,9 +308,11 @@ public:
 			// that it is no worse for the more unusual case.
 			float dividend = sgrad > 1.0f ? 1.0f : sgrad;
 			float sbreakpoint = dividend / sgrad;
+			if (osc2Resync)
+				o2v.resyncState(x2 - fs, sbreakpoint);
 			o2v.processMaster(x2, fs, sbreakpoint, sgrad, keyReset);
 			PhaseResetMaster(x2, fs, hsr, hsfrac, keyReset);
-			osc2mix = o2v.getValue(x2, sbreakpoint, sgrad);
+			o2v.putValue(x2, sbreakpoint, sgrad);
 			break;
 			}
 			// (Simple) Saw
@@ -280,56 +322,58 @@ public:
 			o2v.resetState();
 			o2s.processMaster(x2, fs, keyReset);
 			PhaseResetMaster(x2, fs, hsr, hsfrac, keyReset);
-			osc2mix = o2s.getValue(x2);
+			o2s.putValue(x2);
 			break;
-		case 0: // Off
+		case 0: // Off, or output not used
 		default:
 			PhaseResetMaster(x2, fs, hsr, hsfrac, keyReset);
 			break;
 		}
-
+		osc2Resync = false;
+	}
+	// Osc 2 sub oscillator. Also delays the hard sync signal from
+	// osc 2 in hsr and hsfrac.
+	// The noise waveform doesn't need any antialiasing, so it is
+	// generated in getSamples().
+	forceinline void processSub(int &hsr, float &hsfrac)
+	{
 		// Delaying our hard sync gate signal and frac
 		hsr = syncd.feedReturn(hsr);
 		hsfrac = syncFracd.feedReturn(hsfrac);
 
-		// osc2sub: osc2 sub oscillator
-		float osc2submix = 0.0f;
-
-		noiseGen = wn.nextFloat()-0.5; // for noise + osc1 dirt + mix dither
-
 		// Send hard sync reset as trigger for sub osc counter
 		// Because they're delayed above, we don't need to
 		// delay the output of sub osc further down.
-		o2sub.processMaster(hsr, hsfrac, oscparams.osc2SubWaveform);
-
-		if (oscparams.osc2SubWaveform) {
-			if (oscparams.osc2SubWaveform == 4) { // noise
-				// MiMi-a uses a digital noise generator,
-				// so we do too. It has the minimum crest
-				// factor and thus gives the highest RMS level
-				// for a given peak level.
-				// TODO: Use separate noise gen here?
-				osc2submix = (noiseGen > 0) - 0.5;
-				// osc2submix = noiseGen * 1.3; // analog
-			} else // 1..3 are sub osc waveforms/octaves
-				osc2submix = o2sub.getValue(oscparams.osc2SubWaveform);
-		}
-
-		// osc1 = slave oscillator
-
+		if (subActive) {
+			o2sub.processMaster(hsr, hsfrac, oscparams.osc2SubWaveform);
+			o2sub.putValue(oscparams.osc2SubWaveform);
+		} else
+			o2sub.advanceMaster(hsr, oscparams.osc2SubWaveform);
+	}
+	// Osc 1 pitch, in notes, including xmod from osc 2.
+	// With xmod, the osc 2 output for the current sample isn't
+	// available until the end of the batch, so the complete pitch is
+	// fed to cvd by getSamples(), and we just read it back here.
+	template<bool Xmod>
+	forceinline float osc1Note(float noiseGen)
+	{
 		// Pitch control needs additional delay buffer to compensate
 		// This will give us less aliasing on xmod
 		// Hard sync gate signal delayed too
 		// Offset on osc2mix * xmod is to get zero pitch shift at
 		// max xmod
-		float pitch1 = getPitch(cvd.feedReturn(dirt *noiseGen + notePlaying + oscparams.osc1Det + oscparams.osc1p + oscmodulation.pto1 + (osc2modout?osc2mix-0.0569:0)*xmod + oct_tune + osc1Factor));
-
-		fs = minf(pitch1 * sampleRateInv, 0.45f);
-
-		float osc1mix = 0.0f;
-
-		x1 += fs;
-
+		float note = dirt *noiseGen + notePlaying + oscparams.osc1Det + oscparams.osc1p + oscmodulation.pto1;
+		if (Xmod) {
+			batchOsc1Note[batchCount] = note;
+			return cvd.peek(batchCount + 1);
+		}
+		return cvd.feedReturn((double)note + oct_tune + osc1Factor);
+	}
+	// Osc 1 waveform Wave generation, after its phase x1 has been advanced
+	// by fs, and hard synced to osc 2 according to hsr and hsfrac.
+	template<int Wave>
+	forceinline void processOsc1(float &x1, float fs, int hsr, float hsfrac)
+	{
 		// Sync level: we check if x1 is above the sync level when
 		// the reset from the master oscillator occurs.
 		// If the sync level is high enough, disable completely,
@@ -347,20 +391,24 @@ public:
 		} else if (x1 >= 1.0f) \
 			x1 -= 1.0f; \
 
-		switch (oscparams.osc1Wave) {
+		switch (Wave) {
 		case 2: // Pulse
+			if (osc1Resync)
+				o1p.resyncState(x1 - fs, pw1calc);
 			o1p.processSlave(x1, fs, hsr, hsfrac, pw1calc);
 			PhaseResetSlave(x1, fs, hsr, hsfrac);
-			osc1mix = o1p.getValue(x1, pw1calc);
+			o1p.putValue(x1, pw1calc);
 			break;
 		case 3:	{ // Triangle / Trapezoid
 			float symmetry = limitf(symmetry1, MinTraSymmetry * fs, 1 - MinTraSymmetry * fs);
 			// With limitation above, don't need 0 check here
 			float riseGradient = 1.0f / symmetry;
 			float fallGradient = 1.0f / (symmetry - 1.0f);
+			if (osc1Resync)
+				o1z.resyncState(x1 - fs, symmetry);
 			o1z.processSlave(x1, fs, hsr, hsfrac, symmetry, riseGradient, fallGradient);
 			PhaseResetSlave(x1, fs, hsr, hsfrac);
-			osc1mix = o1z.getValue(x1, symmetry, riseGradient, fallGradient);
+			o1z.putValue(x1, symmetry, riseGradient, fallGradient);
 			}
 			break;
 		case 1:	// Saw / variable slope saw
@@ -369,9 +417,11 @@ public:
 			float sgrad = sgradient1 > grad_limit ? grad_limit : sgradient1;
 			float dividend = sgrad > 1.0f ? 1.0f : sgrad;
 			float sbreakpoint = dividend / sgrad;
+			if (osc1Resync)
+				o1v.resyncState(x1 - fs, sbreakpoint);
 			o1v.processSlave(x1, fs, hsr, hsfrac, sbreakpoint, sgrad);
 			PhaseResetSlave(x1, fs, hsr, hsfrac);
-			osc1mix = o1v.getValue(x1, sbreakpoint, sgrad);
+			o1v.putValue(x1, sbreakpoint, sgrad);
 			break;
 			}
 			// (Simple) Saw
@@ -381,27 +431,175 @@ public:
 			o1v.resetState();
 			o1s.processSlave(x1, fs, hsr, hsfrac);
 			PhaseResetSlave(x1, fs, hsr, hsfrac);
-			osc1mix = o1s.getValue(x1);
+			o1s.putValue(x1);
 			break;
-		case 0: // Off
+		case 0: // Off, or output not used
 		default:
 			PhaseResetSlave(x1, fs, hsr, hsfrac);
 			break;
 		}
+		osc1Resync = false;
+	}
+	// Only the oscillators whose output is used somewhere get their
+	// waveforms generated. The others just keep their phase running,
+	// osc 2 being the hard sync master and sub osc clock regardless,
+	// and the sub osc its counter, so they can come back in phase.
+	inline void updateActive()
+	{
+		bool active = oscparams.osc1Wave && o1mx != 0;
+		osc1Resync = active && !osc1Active;
+		osc1Active = active;
+		active = oscparams.osc2Wave &&
+			 (o2mx != 0 || xmod != 0 || osc2FltModActive);
+		osc2Resync = active && !osc2Active;
+		osc2Active = active;
+		// 1..3 are sub osc waveforms/octaves, 4 is noise which
+		// is generated in getSamples().
+		subActive = o2submx != 0 &&
+			    oscparams.osc2SubWaveform && oscparams.osc2SubWaveform != 4;
+	}
+	// When the osc 2 output isn't needed on its own, for xmod or
+	// filter modulation, all oscillators are mixed in one Antialias
+	// buffer, scaled by their mix levels. Osc 2 is delayed by the same
+	// amount as osc2d does.
+	inline void updateMerge()
+	{
+		merged = !(osc2modout && xmod != 0) && !osc2FltModActive;
+		if (merged) {
+			o1aa.mergeInto(&mixaa, o1mx, 0);
+			o2aa.mergeInto(&mixaa, o2mx, Antialias::MaxDelay);
+			subaa.mergeInto(&mixaa, o2submx, 0);
+		} else {
+			o1aa.mergeInto(NULL, 1, 0);
+			o2aa.mergeInto(NULL, 1, 0);
+			subaa.mergeInto(NULL, 1, 0);
+		}
+	}
+	// Generate one sample, in stages: osc 2 (master), sub osc,
+	// osc 1 (slave), using the kernel for the current waveforms,
+	// selected at the start of each batch. Only the phase wraps and
+	// waveform generation are done here, leaving the antialiasing and
+	// the final mix to getSamples(), which must be called once
+	// batchFull().
+	inline void ProcessSample()
+	{
+		if (!batchCount) {
+			updateActive();
+			updateMerge();
+			batchXmod = osc2modout && xmod != 0;
+			sampleKernel = selectKernel(osc1Active ? oscparams.osc1Wave : 0,
+						    osc2Active ? oscparams.osc2Wave : 0,
+						    batchXmod);
+		}
+		(this->*sampleKernel)();
+	}
+	// Kernel for osc 1 waveform Wave1 and osc 2 waveform Wave2, 0 for
+	// those which are off or not used, with or without xmod.
+	template<int Wave1, int Wave2, bool Xmod>
+	void processSample()
+	{
+		int hsr;
+		float hsfrac;
 
-		// Delay osc2 to get in phase with osc1 which is
-		// in itself delayed due to delay after pitch calc.
-		// TOOD: Review this: Should the xmod really be delayed
-		// in the osc1 pitch calc, it would seem to be one delay
-		// too many in the xmod path.
-		osc2mix = osc2d.feedReturn(osc2mix);
+		// osc 2 = master oscillator
+		float noiseGen = wn.nextFloat() - 0.5f;
+		float pitch2 = getPitch(osc2Note(noiseGen));
+		float fs = minf(pitch2 * sampleRateInv, 0.45f);
+		x2 += fs;
+		processOsc2<Wave2>(x2, fs, hsr, hsfrac);
+
+		noiseGen = wn.nextFloat()-0.5; // for noise + osc1 dirt + mix dither
+		processSub(hsr, hsfrac);
 
-		//mixing
-		// TODO: have separate noise generator for the dither noise?
-		float res = o1mx*osc1mix + o2mx*osc2mix + o2submx*osc2submix + noiseGen*0.0006;
-		audioOutput = res * 3.0f;
-		modOutput = osc2mix;
+		// osc1 = slave oscillator
+		float pitch1 = getPitch(osc1Note<Xmod>(noiseGen));
+		fs = minf(pitch1 * sampleRateInv, 0.45f);
+		x1 += fs;
+		processOsc1<Wave1>(x1, fs, hsr, hsfrac);
 
+		if (merged)
+			mixaa.nextSample();
+		batchNoise[batchCount++] = noiseGen;
 		keyReset = false;
 	}
+	template<int Wave1, int Wave2>
+	static SampleKernel selectKernel(bool xmod)
+	{
+		if (xmod)
+			return &Oscillators::processSample<Wave1, Wave2, true>;
+		return &Oscillators::processSample<Wave1, Wave2, false>;
+	}
+	template<int Wave1>
+	static SampleKernel selectKernel(int wave2, bool xmod)
+	{
+		switch (wave2) {
+		case 1: return selectKernel<Wave1, 1>(xmod);
+		case 2: return selectKernel<Wave1, 2>(xmod);
+		case 3: return selectKernel<Wave1, 3>(xmod);
+		default: return selectKernel<Wave1, 0>(xmod);
+		}
+	}
+	static SampleKernel selectKernel(int wave1, int wave2, bool xmod)
+	{
+		switch (wave1) {
+		case 1: return selectKernel<1>(wave2, xmod);
+		case 2: return selectKernel<2>(wave2, xmod);
+		case 3: return selectKernel<3>(wave2, xmod);
+		default: return selectKernel<0>(wave2, xmod);
+		}
+	}
+	inline int batchSamples()
+	{
+		return batchCount;
+	}
+	// With xmod, the osc 1 pitch is read back from cvd, Samples - 1
+	// samples after getSamples() has fed it, so the batches can't be
+	// longer than that, in order for it to come from a previous batch.
+	inline bool batchFull()
+	{
+		return batchCount == (batchXmod ? Samples - 1 : MaxBatch);
+	}
+	// Antialias and mix the samples generated since the last call,
+	// writing the audio and modulation outputs for each.
+	inline void getSamples(float *audioOutput, float *modOutput)
+	{
+		float subnoise[MaxBatch];
+		int count = batchCount;
+
+		const float *osc1mix = o1aa.getSamples(count);
+		const float *osc2mix = o2aa.getSamples(count);
+		const float *osc2submix = subaa.getSamples(count);
+		const float *mergedmix = mixaa.getSamples(count);
+		if (oscparams.osc2SubWaveform == 4) { // noise
+			// MiMi-a uses a digital noise generator,
+			// so we do too. It has the minimum crest
+			// factor and thus gives the highest RMS level
+			// for a given peak level.
+			// TODO: Use separate noise gen here?
+			for (int i = 0; i < count; i++)
+				subnoise[i] = (batchNoise[i] > 0) - 0.5;
+				// osc2submix = noiseGen * 1.3; // analog
+			osc2submix = subnoise;
+		}
+
+		if (batchXmod)
+			for (int i = 0; i < count; i++)
+				cvd.feedReturn(batchOsc1Note[i] + (osc2mix[i] - 0.0569) * xmod + oct_tune + osc1Factor);
+
+		for (int i = 0; i < count; i++) {
+			// Delay osc2 to get in phase with osc1 which is
+			// in itself delayed due to delay after pitch calc.
+			// TOOD: Review this: Should the xmod really be delayed
+			// in the osc1 pitch calc, it would seem to be one delay
+			// too many in the xmod path.
+			float osc2 = osc2d.feedReturn(osc2mix[i]);
+
+			//mixing
+			// TODO: have separate noise generator for the dither noise?
+			float res = o1mx*osc1mix[i] + o2mx*osc2 + o2submx*osc2submix[i] + mergedmix[i] + batchNoise[i]*0.0006;
+			audioOutput[i] = res * 3.0f;
+			modOutput[i] = osc2;
+		}
+		batchCount = 0;
+	}
 };
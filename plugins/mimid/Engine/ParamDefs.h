@@ -88,6 +88,9 @@
 	PARAMPOINTS(SP_KEYSYNC, 0, "FreeRun", "KeySync")
 	PARAMPOINTS(SP_OSC3WAVE, 0, " Off ", "-1 Squ", "-2 Squ", "-2 Pul", "Noise")
 	PARAMPOINTS(SP_ENVMODE, 0, "Exp/Lin ", "Lin/Lin", "Lin/Exp")
+	PARAMPOINTS(SP_MODRATIO, 0, " 1:1 ", " 1:2 ", " 1:4 ", " 1:8 ", " 1:16 ", " 1:32 ")
+	PARAMPOINTS(SP_FILTERMODEL, 0, "Ladder", " Auto ", "Economy")
+	PARAMPOINTS(SP_OVERSAMPLE, 0, "Off", "On", "Filter")
 
 	PARAMHINTS(SP_INTS, kParameterIsInteger)
 
@@ -241,8 +244,11 @@
 	PARAM(LFOSPREAD, PG_SPREAD, SP_NONE, "LfoSpread", "lfospread", 0, 10, 0, setLfoSpread)
 
 	// DSP control
-	PARAM(OVERSAMPLE, PG_DSP, SP_ONOFF, "Oversample", "oversample", SP_MIN, SP_MAX, 1, setOversampling)
+	PARAM(OVERSAMPLE, PG_DSP, SP_OVERSAMPLE, "Oversample", "oversample", SP_MIN, SP_MAX, 1, setOversampling)
 	PARAM(ECONOMY_MODE, PG_DSP, SP_ONOFF, "Economy Mode", "economymode", SP_MIN, SP_MAX, 1, setEconomyMode)
+	PARAM(THREAD_COUNT, PG_DSP, SP_INTS, "Threads", "threads", 1, 4, 1, setThreadCount)
+	PARAM(MOD_RATIO, PG_DSP, SP_MODRATIO, "Modulation Rate", "modratio", SP_MIN, SP_MAX, 0, setModRatio)
+	PARAM(FILTER_MODEL, PG_DSP, SP_FILTERMODEL, "Filter Model", "filtermodel", SP_MIN, SP_MAX, 0, setFilterModel)
 
 	// Misc/Debug
 	PARAM(UNUSED_1, PG_MISC, SP_HIDDEN, "Debug 1", "unused_1", 0, 1.0, 0, procUnused1)
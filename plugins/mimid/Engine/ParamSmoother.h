@@ -42,6 +42,16 @@ class ParamSmoother
 		integralValue = integralValue + ( steepValue - integralValue)*PSSC*srCor + dc;
 		return integralValue;
 	}
+	// Advance a number of steps in one go, using the closed form
+	// solution of the recursion in smoothStep().
+	float advance(int steps)
+	{
+		float coeff = PSSC * srCor;
+		float target = steepValue + dc / coeff;
+		integralValue = target + (integralValue - target) *
+				powf(1 - coeff, steps);
+		return integralValue;
+	}
 	void setSteep(float value)
 	{
 		steepValue = value;
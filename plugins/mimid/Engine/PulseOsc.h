@@ -39,6 +39,13 @@ public:
 	~PulseOsc()
 	{
 	}
+	// Set the state according to the phase x, when the waveform has
+	// not been generated for a while.
+	inline void resyncState(float x, float pulseWidth)
+	{
+		pw1t = x >= pulseWidth;
+		prevPulseWidth = pulseWidth;
+	}
 	inline void processMaster(float x, float delta, float pulseWidth, bool waveformReset)
 	{
 		if (waveformReset) {
@@ -65,7 +72,7 @@ public:
 		}
 		prevPulseWidth = pulseWidth;
 	}
-	inline float getValue(float x, float pulseWidth)
+	inline void putValue(float x, float pulseWidth)
 	{
 		float oscmix;
 
@@ -74,7 +81,6 @@ public:
 		else
 			oscmix = -(0.5f - pulseWidth) - 0.5f;
 		antialias.putSample(oscmix);
-                return antialias.getNextSample();
 	}
 	inline void processSlave(float x, float delta, bool hardSyncReset, float hardSyncFrac, float pulseWidth)
 	{
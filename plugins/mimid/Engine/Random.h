@@ -33,6 +33,7 @@
 
 class SRandom
 {
+	friend class LfoBank;
 
 private:
 	int32_t r;
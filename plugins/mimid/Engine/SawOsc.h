@@ -49,10 +49,9 @@ public:
 			antialias.mixInImpulseCenter(x / delta, 1.0f);
 		}
 	}
-	inline float getValue(float x)
+	inline void putValue(float x)
 	{
 		antialias.putSample(x - 0.5f);
-		return antialias.getNextSample(); // (also bumps buffer pointer)
 	}
 	inline void processSlave(float x, float delta, bool hardSyncReset, float hardSyncFrac)
 	{
@@ -0,0 +1,103 @@
+/*
+	==============================================================================
+	This file is part of the MiMi-d synthesizer.
+
+	Copyright 2026 Ricard Wanderlof
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// Vector types for processing several voices at once, one voice per
+// lane, using the GCC (and clang) vector extensions. This gives us
+// SSE on x86 and NEON on ARM without any intrinsics; with AVX
+// enabled we get eight lanes instead of four.
+//
+// Arithmetic on the vector types is element by element, and is done
+// in exactly the same way as for the corresponding scalar code, so
+// as long as the operations are written in the same order, the
+// result for each lane is the same as the scalar result.
+
+#ifdef __AVX__
+const int SIMD_LANES = 8;
+#else
+const int SIMD_LANES = 4;
+#endif
+
+typedef float vfloat __attribute__((vector_size(SIMD_LANES * sizeof(float))));
+typedef int32_t vint __attribute__((vector_size(SIMD_LANES * sizeof(int32_t))));
+typedef uint32_t vuint __attribute__((vector_size(SIMD_LANES * sizeof(uint32_t))));
+
+inline vfloat vload(const float *src)
+{
+	vfloat v;
+	memcpy(&v, src, sizeof(v));
+	return v;
+}
+
+#ifdef BLEP_INT16
+// Load SIMD_LANES 16 bit integers, converted to float.
+// Only the 16 bit BLEP tables need this.
+inline vfloat vload(const int16_t *src)
+{
+#ifdef __AVX__
+	typedef int16_t vshort __attribute__((vector_size(SIMD_LANES * sizeof(int16_t))));
+	vshort v;
+	memcpy(&v, src, sizeof(v));
+	return __builtin_convertvector(__builtin_convertvector(v, vint), vfloat);
+#else
+	// Duplicate each value into both halves of a 32 bit lane, then
+	// shift it down, sign extending it. Plain SSE2 has no sign
+	// extending load, and this is much shorter than what the
+	// compiler makes of the conversion above.
+	typedef int16_t vshort __attribute__((vector_size(2 * SIMD_LANES * sizeof(int16_t))));
+	typedef int64_t vlong __attribute__((vector_size(SIMD_LANES * sizeof(int32_t))));
+	int64_t bits;
+	memcpy(&bits, src, sizeof(bits));
+	vshort v = (vshort)(vlong){bits, 0};
+#ifdef __clang__
+	v = __builtin_shufflevector(v, v, 0, 0, 1, 1, 2, 2, 3, 3);
+#else
+	v = __builtin_shuffle(v, (vshort){0, 0, 1, 1, 2, 2, 3, 3});
+#endif
+	return __builtin_convertvector((vint)v >> 16, vfloat);
+#endif
+}
+#endif
+
+inline void vstore(float *dst, vfloat v)
+{
+	memcpy(dst, &v, sizeof(v));
+}
+
+inline vfloat vset(float val)
+{
+	return vfloat{} + val;
+}
+
+// Lane by lane mask ? a : b, where mask lanes are all ones or zero,
+// as returned by vector comparisons.
+inline vfloat vselect(vint mask, vfloat a, vfloat b)
+{
+	return (vfloat)(((vint)a & mask) | ((vint)b & ~mask));
+}
+
+inline vuint vselect(vint mask, vuint a, vuint b)
+{
+	return (a & (vuint)mask) | (b & ~(vuint)mask);
+}
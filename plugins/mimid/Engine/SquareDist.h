@@ -19,11 +19,17 @@
 	==============================================================================
  */
 #pragma once
+#include <math.h>
 
 class SquareDist
 {
 private:
-	const float distTarget = 1.5;
+	static constexpr float distTarget = 1.5;
+
+	// Antialiased version state: previous input and its
+	// residualIntegral()
+	float prevSample;
+	double prevIntegral;
 
 	//JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SquareDist)
 public:
@@ -35,6 +41,7 @@ public:
 		distLimit=10;
 		distPeak=10;
 		distGainComp=1;
+		reset();
 	}
 	~SquareDist()
 	{
@@ -48,7 +55,29 @@ private:
 		return sample * (sample >= 0 ? (1 - distAmount * sample) :
 					       (1 + distAmount * sample));
 	}
+	// The nonlinear part of the (uncompensated) distortion, i.e.
+	// minus the input, and its antiderivative, which is even.
+	inline float residual(float sample)
+	{
+		if (sample > distLimit) return distPeak - sample;
+		if (sample < -distLimit) return -distPeak - sample;
+		return distfunc(sample) - sample;
+	}
+	inline double residualIntegral(double sample)
+	{
+		double x = fabs(sample);
+		if (x <= distLimit)
+			return -distAmount * x * x * x * (1.0 / 3);
+		// Integral up to distLimit is distLimit^2 / 3 - distLimit^2 / 2
+		return distPeak * (x - distLimit) - distLimit * distLimit * (1.0 / 6) -
+		       0.5 * (x * x - distLimit * distLimit);
+	}
 public:
+	void reset()
+	{
+		prevSample = 0;
+		prevIntegral = 0;
+	}
 	void setAmount(float val)
 	{
 		// Add a small amount to avoid division by zero and get
@@ -62,6 +91,7 @@ public:
 		distGainComp = distTarget/distfunc(distLimit > distTarget ?
 						   distTarget :
 						   distLimit);
+		prevIntegral = residualIntegral(prevSample);
 	}
 	inline float Apply(float sample)
 	{
@@ -71,4 +101,21 @@ public:
 		sample *= distGainComp; // compensate for amplitude drop
 		return sample;
 	}
+	// Same, with first order antiderivative antialiasing, for use
+	// without oversampling. Only the nonlinear part is antialiased,
+	// so the signal itself isn't delayed or lowpass filtered, just
+	// the distortion products (by half a sample).
+	inline float ApplyAntialiased(float sample)
+	{
+		double integral = residualIntegral(sample);
+		double delta = (double)sample - prevSample;
+		float res;
+		if (fabs(delta) > 1e-5)
+			res = (integral - prevIntegral) / delta;
+		else // ill conditioned, use the midpoint instead
+			res = residual(0.5f * (sample + prevSample));
+		prevSample = sample;
+		prevIntegral = integral;
+		return (sample + res) * distGainComp;
+	}
 };
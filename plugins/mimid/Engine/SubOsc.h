@@ -64,7 +64,17 @@ public:
 
 		antialias.mixInImpulseCenter(hsfrac, state ? -1 : 1);
 	}
-	inline float getValue(int waveformMask)
+	// Keep track of the state without generating any output, when
+	// the sub osc isn't mixed in.
+	inline void advanceMaster(bool hsr, int waveformMask)
+	{
+		if (!hsr)
+			return;
+		counter++;
+		counter &= 3;
+		state = prevState = (counter & waveformMask) != 0;
+	}
+	inline void putValue(int waveformMask)
 	{
 		float oscmix = 0;
 		if (waveformMask & 3) {
@@ -73,6 +83,5 @@ public:
 				oscmix += 0.25; // DC offset compensation
 		}
 		antialias.putSample(oscmix);
-		return antialias.getNextSample();
 	}
 };
@@ -89,13 +89,56 @@ public:
 		modWheelSmoother.setSampleRate(sr);
 		synth.setSampleRate(sr);
 	}
-	void processSample(float *left,float *right)
+	void setMaxBlockSize(uint32_t frames)
 	{
-		processCutoffSmoothed(cutoffSmoother.smoothStep());
-		procPitchWheelSmoothed(pitchWheelSmoother.smoothStep());
-		procModWheelSmoothed(modWheelSmoother.smoothStep());
+		synth.setMaxBlockSize(frames);
+	}
+	uint32_t getLatency()
+	{
+		return synth.getLatency();
+	}
+	// Render a block of samples with no intervening MIDI events
+	void processBlock(float *left, float *right, uint32_t frames)
+	{
+		uint32_t maxBlockSize = synth.getMaxBlockSize();
+
+		while (frames) {
+			uint32_t len = frames < maxBlockSize ? frames : maxBlockSize;
+
+			if (synth.isAsleep()) {
+				// Nothing playing, just keep smoothers going
+				synth.processSleepBlock(left, right, len);
+				processCutoffSmoothed(cutoffSmoother.advance(len));
+				procPitchWheelSmoothed(pitchWheelSmoother.advance(len));
+				procModWheelSmoothed(modWheelSmoother.advance(len));
+
+				left += len;
+				right += len;
+				frames -= len;
+				continue;
+			}
+
+			// Smoothed controllers are calculated for the whole
+			// block, and picked up by each voice as it is
+			// rendered.
+			for (uint32_t i = 0; i < len; i++) {
+				synth.cutoffBuffer[i] = cutoffSmoother.smoothStep();
+				synth.pitchWheelBuffer[i] = pitchWheelSmoother.smoothStep();
+				synth.modWheelBuffer[i] = modWheelSmoother.smoothStep();
+			}
+
+			synth.processBlock(left, right, len);
 
-		synth.processSample(left, right);
+			// Set final values for all voices, including
+			// those not currently in use.
+			processCutoffSmoothed(synth.cutoffBuffer[len - 1]);
+			procPitchWheelSmoothed(synth.pitchWheelBuffer[len - 1]);
+			procModWheelSmoothed(synth.modWheelBuffer[len - 1]);
+
+			left += len;
+			right += len;
+			frames -= len;
+		}
 	}
 	void allNotesOff()
 	{
@@ -197,6 +240,15 @@ public:
 	{
 		synth.economyMode = roundToInt(val);
 	}
+	void setThreadCount(float val)
+	{
+		synth.setThreadCount(roundToInt(val));
+	}
+	void setModRatio(float val)
+	{
+		// 1:1, 1:2, 1:4 ... 1:32
+		synth.setModRatio(1 << roundToInt(val));
+	}
 
 	// TODO: Remove
 	void procUnused1(float val)
@@ -514,7 +566,7 @@ public:
 		// Exp env / Lin VCA - Lin env / Lin VCA - Lin env / Exp VCA
 		int intparam = roundToInt(param);
 		ForEachVoice(env.setLinear(intparam >= 1));
-		ForEachVoice(expvca = (intparam >= 2));
+		ForEachVoice(setExpVCA(intparam >= 2));
 	}
 	void setOsc2Xmod(float param)
 	{
@@ -546,7 +598,7 @@ public:
 	}
 	void setVCADrive(float param)
 	{
-		ForEachVoice(sqdist.setAmount(param * 0.0435f));
+		ForEachVoice(setVCADrive(param * 0.0435f));
 	}
 	void setOsc2FltMod(float param)
 	{
@@ -606,6 +658,11 @@ public:
 		// Pole count 1 .. 4 (continuous)
 		ForEachVoice(flt.setResponse(4 - param));
 	}
+	void setFilterModel(float param)
+	{
+		// Ladder, Auto (two pole when Pole Count <= 2), Economy
+		ForEachVoice(flt.setModel(roundToInt(param)));
+	}
 	void setOversampling(float param)
 	{
 		synth.setOversample(roundToInt(param));
@@ -41,6 +41,13 @@ public:
 	~TrapezoidOsc()
 	{
 	}
+	// Set the state according to the phase x, when the waveform has
+	// not been generated for a while.
+	inline void resyncState(float x, float symm)
+	{
+		falling = x >= symm;
+		prevSymm = symm;
+	}
 	inline void processMaster(float x, float delta, float symm, float riseGrad, float fallGrad, bool waveformReset)
 	{
 		if (waveformReset) {
@@ -70,12 +77,11 @@ public:
 		}
 		prevSymm = symm;
 	}
-	inline float getValue(float x, float symm, float riseGrad, float fallGrad)
+	inline void putValue(float x, float symm, float riseGrad, float fallGrad)
 	{
 		float mix = x <= symm ? x * riseGrad : (x - 1.0f) * fallGrad;
 		mix -= 0.5f; // DC level is always same regardless of symmetry
 		antialias.putSample(mix);
-		return antialias.getNextSample();
 	}
 	inline void processSlave(float x, float delta, bool hardSyncReset, float hardSyncFrac, float symm, float riseGrad, float fallGrad)
 	{
@@ -61,11 +61,10 @@ public:
 			antialias.mixInBlampCenter(x / delta, -4.0f * Samples * delta);
 		}
 	}
-	inline float getValue(float x)
+	inline void putValue(float x)
 	{
 		float mix = x < 0.5f ? 2.0f * x - 0.5f : 1.5f - 2.0f * x;
 		antialias.putSample(mix);
-		return antialias.getNextSample();
 	}
 	inline void processSlave(float x, float delta, bool hardSyncReset, float hardSyncFrac)
 	{
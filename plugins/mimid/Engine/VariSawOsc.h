@@ -49,6 +49,13 @@ public:
 		pastBp = false;
 		prevBp = 1;
 	}
+	// Set the state according to the phase x, when the waveform has
+	// not been generated for a while.
+	inline void resyncState(float x, float bp)
+	{
+		pastBp = x >= bp;
+		prevBp = bp;
+	}
 	// breakpoint is 0..1 (spikey sawtooth .. standard sawtooth)
 	// (Sawtooth is actually inverted when spikey)
 	// gradient is normally 1/breakpoint, so
@@ -96,7 +103,7 @@ public:
 		}
 		prevBp = bp;
 	}
-	inline float getValue(float x, float bp, float grad)
+	inline void putValue(float x, float bp, float grad)
 	{
 		float mix = x > bp ? 1.0f : x * grad;
 		// DC level: gradient <= 1: half of end of sawtooth peak,
@@ -107,7 +114,6 @@ public:
 		// all in all: gradient <= 1 ? 0.5 * grad : 1 - 0.5 * bp;
 		mix -= grad <= 1.0f ? 0.5f * grad : 1.0f - 0.5f * bp;
 		antialias.putSample(mix);
-		return antialias.getNextSample();
 	}
 	inline void processSlave(float x, float delta, bool hardSyncReset, float hardSyncFrac, float bp, float grad)
 	{
@@ -35,19 +35,21 @@
 #include "FastExp.h"
 #include "ParamSmoother.h"
 
-float dummyfloat;
-
 class ModRoute
 {
 private:
 	float *dest1, *dest2;
 	float scale;
+	// Dummy destination; not shared between voices, since voices
+	// may be rendered in parallel.
+	float dummy;
 
 public:
 	ModRoute()
 	{
 		// Set a dummy route
-		dest1 = &dummyfloat;
+		dummy = 0;
+		dest1 = &dummy;
 		dest2 = NULL;
 		scale = 0;
 	}
@@ -66,6 +68,55 @@ public:
 		dest2 = destination2;
 		scale = scalefactor;
 	}
+
+	bool routesTo(const float *destination)
+	{
+		return dest1 == destination || dest2 == destination;
+	}
+};
+
+// Linear ramp of a control value calculated at the modulation rate,
+// so that it changes smoothly over the audio samples between two
+// modulation ticks rather than in steps.
+class ControlRamp
+{
+private:
+	float *dest;
+	float value, target, step;
+
+public:
+	ControlRamp()
+	{
+		dest = &value;
+		value = target = step = 0;
+	}
+	void setDestination(float *destination)
+	{
+		dest = destination;
+		value = target = *dest;
+	}
+	// Called after the destination has been set to a new value:
+	// start ramping from the current value to the new one.
+	inline void start(float stepFactor, bool jump)
+	{
+		target = *dest;
+		if (jump)
+			value = target;
+		step = (target - value) * stepFactor;
+		*dest = value;
+	}
+	inline void tick()
+	{
+		value += step;
+		*dest = value;
+	}
+	// Set exact target value at end of ramp, to avoid accumulating
+	// rounding errors.
+	inline void finish()
+	{
+		value = target;
+		*dest = value;
+	}
 };
 
 class Voice
@@ -95,6 +146,30 @@ private:
 
 	float zero = 0;
 
+	// Interpolation of control values between modulation ticks,
+	// when modulation is run at a lower rate than the audio.
+	static const int RAMP_COUNT = 13;
+	ControlRamp ramps[RAMP_COUNT];
+	int rampLength; // audio samples per modulation tick; 0 = no ramps
+	int rampPos;
+	float rampStepFactor;
+	bool rampJump;
+
+	// Filter cutoff control values for the samples in the current
+	// oscillator batch.
+	float batchCutoffNote[Oscillators::MaxBatch];
+	float batchFltMod[Oscillators::MaxBatch];
+
+	// When only the filter onwards is oversampled: interpolator for
+	// the filter input, and the last few cutoff, resonance and VCA
+	// gain values, so they can be delayed by the same amount.
+	Interpolator17 upsampler;
+	static const int UpsampleDelay = Interpolator17::GroupDelay / 2;
+	float upsampleCutoff[UpsampleDelay];
+	float upsampleRes[UpsampleDelay];
+	float upsampleGain[UpsampleDelay];
+	int upsamplePos;
+
 public:
 	AdssrEnvelope env;
 	AdssrEnvelope fenv;
@@ -147,7 +222,7 @@ public:
 
 	float osc2FltMod;
 
-	float hpffreq, hpfcutoff;
+	float hpffreq, hpflpc; // HPF frequency and tptlpc() coefficient
 
 	int midiIndx;
 
@@ -186,6 +261,14 @@ public:
 	bool oscmodEnable; // Oscillator modulation output enabled
 
 	bool expvca;
+	bool vcaDrive; // SquareDist in use
+	bool oversampled; // Antialiased SquareDist not needed
+
+	// Post filter chain, with only the stages in use, selected by
+	// selectPostFilter().
+	typedef void (Voice::*PostFilterRun)(const float *in, const float *gain,
+					     int stride, int samples, float *out);
+	PostFilterRun postFilterRun;
 
 	int voiceNumber; // Handy to have in the voice itself
 
@@ -206,7 +289,7 @@ public:
 		oscKeySync = false;
 		envRst = false;
 		hpffreq = 4;
-		hpfcutoff = 0;
+		hpflpc = 0;
 		osc2FltMod = 0;
 		pitchWheel = pitchWheelAmt = 0;
 		PortaSpreadAmt = 1;
@@ -233,23 +316,41 @@ public:
 		PortaSpread = SRandom::globalRandom().nextFloat()-0.5;
 		oscmodEnable = false;
 		expvca = false;
+		vcaDrive = false;
+		oversampled = false;
+		selectPostFilter();
 		voiceNumber = 0; // Until someone else says something else
 		unused1 = unused2 = 0; // TODO: Remove
 		cutoffnote = 0;
 		rescalc = 0;
 		osc2FltModCalc = 0;
 		lfo1controller = lfo2controller = lfo3controller = &zero;
+		envVal = 0;
+		rampLength = rampPos = 0;
+		for (int i = 0; i < UpsampleDelay; i++)
+			upsampleCutoff[i] = upsampleRes[i] = upsampleGain[i] = 0;
+		upsamplePos = 0;
+		rampStepFactor = 1;
+		rampJump = true;
+		float *rampDests[RAMP_COUNT] = {
+			&envVal, &cutoffnote, &rescalc, &osc2FltModCalc,
+			&osc.notePlaying,
+			&osc.oscmodulation.pto1, &osc.oscmodulation.pto2,
+			&osc.pw1calc, &osc.pw2calc,
+			&osc.symmetry1, &osc.symmetry2,
+			&osc.sgradient1, &osc.sgradient2
+		};
+		for (int i = 0; i < RAMP_COUNT; i++)
+			ramps[i].setDestination(rampDests[i]);
 	}
 	~Voice()
 	{
 	}
-	inline void processModulation()
+	// Modulation tick, given the outputs of the LFOs and envelopes,
+	// which are run separately by ModulationBank.
+	inline void processModulation(float lfo1In, float lfo2In, float lfo3In,
+				      float fenvIn, float envIn)
 	{
-		// LFOs
-		float lfo1In = lfo1.getVal();
-		float lfo2In = lfo2.getVal();
-		float lfo3In = lfo3.getVal();
-
 		// Multiplying modamt with (1-lfoamt) scales
 		// the modulation so that the total value never goes above 1.0
 		// no matter what combination of amount and modwheel/aftertouch
@@ -263,13 +364,13 @@ public:
 
 		// Both envelopes and filter cv need a delay equal to osc internal delay
 		// Bipolar filter envelope
-		float envm = fenv.processSample() * (1 - (1-2*velocityValue)*vflt);
+		float envm = fenvIn * (1 - (1-2*velocityValue)*vflt);
 		envm = 2 * envm - 1; // make bipolar
 		if (invertFenv)
 			envm = -envm;
 
 		// Loudness envelope, with delay (same reason as for cutoff)
-		envVal = lenvd.feedReturn(env.processSample() * (1 - (1-velocityValue)*vamp));
+		envVal = lenvd.feedReturn(envIn * (1 - (1-velocityValue)*vamp));
 
 		// PW modulation
 		osc.oscmodulation.sh1 = 0;
@@ -386,54 +487,204 @@ public:
 		default:
 			break;
 		}
+		// When running modulation at a lower rate than the audio,
+		// ramp from the previous values to the newly calculated ones
+		// over the following audio samples.
+		if (rampLength) {
+			for (int i = 0; i < RAMP_COUNT; i++)
+				ramps[i].start(rampStepFactor, rampJump);
+			rampJump = false;
+			rampPos = 0;
+		}
 	}
-	inline float processAudioSample()
-	{
-		float oscps, oscmod;
+	// Audio processing up to the filter, in two steps:
+	// processPreFilter() generates a sample, returning the filter
+	// resonance and VCA gain for it. Once preFilterBatchFull(), and
+	// at the end of the block, getPreFilterSamples() does the
+	// antialiasing, DC blocking and filter cutoff calculation for the
+	// samples generated so far, returning the filter input and cutoff
+	// for each, with a stride of stride.
+	inline void processPreFilter(float &resonance, float &gain)
+	{
+		// Interpolated control values
+		if (rampLength) {
+			if (++rampPos < rampLength)
+				for (int i = 0; i < RAMP_COUNT; i++)
+					ramps[i].tick();
+			else
+				for (int i = 0; i < RAMP_COUNT; i++)
+					ramps[i].finish();
+		}
 
 		// Audio sample generation
 
 		// Oscillators
-		osc.ProcessSample(oscps, oscmod);
-
-		oscps *= levelSpreadAmt;
-
-		// HPF on oscillator output to get rid of any DC,
-		// simulating a fairly large coupling capacitor.
-		// TODO: filter oscmod as well to reduce aliasing?
-		oscps = oscps - tptlpupw(oschpfst, oscps, 12, audioRateInv);
-
-		// Filter exp cutoff calculation
-		// Needs to be done after we've gotten oscmod
-		//
-		float cutoffcalc = minf(
-			getPitch(cutoffnote +
-				 (oscmod-oscmod_offset) * osc2FltModCalc)
-			// noisy filter cutoff
-			+ (ng.nextFloat()-0.5f)*3.5f, maxfiltercutoff);
-
-		float x1 = flt.Apply4Pole(oscps, cutoffcalc, rescalc);
-
-		// HPF
-		x1 -= tptpc(hpfst, x1, hpfcutoff);
-
-		// Distortion/overdrive
-		x1 = sqdist.Apply(x1);
-
-		// VCA
-		if (expvca) {
-			// Approximate exponential curve with x**5:
-			// - Faster to calculate yet reasonable approximation
-			// - Actually goes down to zero when envelope goes t0 0
-			// Empirically, MiMi-a exponential VCA would be:
-			// envVal = expf(7.5*(envVal-1)); // 1..0 -> 0..-65 dB
-			float envValSquared = envVal * envVal;
-			envVal *= envValSquared * envValSquared;
+		int i = osc.batchSamples();
+		if (!i)
+			osc.osc2FltModActive = usesOsc2FltMod();
+		osc.ProcessSample();
+
+		// Filter cutoff calculation needs oscmod, which we get
+		// in getPreFilterSamples()
+		batchCutoffNote[i] = cutoffnote;
+		batchFltMod[i] = osc2FltModCalc;
+		resonance = rescalc;
+
+		// VCA (exponential curve applied in runPostFilter())
+		gain = envVal;
+	}
+	// Whether the osc 2 output can modulate the filter cutoff
+	inline bool usesOsc2FltMod()
+	{
+		const float *dest = &osc2FltModCalc;
+		return oscmodEnable &&
+		       (osc2FltMod != 0 ||
+			lfo1route.routesTo(dest) || lfo2route.routesTo(dest) ||
+			lfo3route.routesTo(dest) || pwroute.routesTo(dest) ||
+			modroute.routesTo(dest) || atroute.routesTo(dest));
+	}
+	inline bool preFilterBatchFull()
+	{
+		return osc.batchFull();
+	}
+	inline void getPreFilterSamples(float *in, float *cutoffcalc, int stride)
+	{
+		float oscps[Oscillators::MaxBatch], oscmod[Oscillators::MaxBatch];
+		int count = osc.batchSamples();
+
+		// Local copies, as the compiler can't tell that the
+		// outputs don't overlap them.
+		float hpfState = oschpfst;
+		float spread = levelSpreadAmt;
+		// tptlpupw() coefficient for 12 Hz
+		float hpfCutoff = (12 * audioRateInv) * pi;
+		float hpfLpc = hpfCutoff / (1 + hpfCutoff);
+		float maxCutoff = maxfiltercutoff;
+
+		osc.getSamples(oscps, oscmod);
+		for (int i = 0; i < count; i++) {
+			float x = oscps[i] * spread;
+
+			// HPF on oscillator output to get rid of any DC,
+			// simulating a fairly large coupling capacitor.
+			// TODO: filter oscmod as well to reduce aliasing?
+			in[i * stride] = x - tptlpc(hpfState, x, hpfLpc);
+
+			// Filter exp cutoff calculation
+			cutoffcalc[i * stride] = minf(
+				getPitch(batchCutoffNote[i] +
+					 (oscmod[i]-oscmod_offset) * batchFltMod[i])
+				// noisy filter cutoff
+				+ (ng.nextFloat()-0.5f)*3.5f, maxCutoff);
+		}
+		oschpfst = hpfState;
+	}
+	// Upsample the output of samples getPreFilterSamples() and
+	// processPreFilter() calls, stored with a stride of 2 * stride,
+	// to 2 * samples samples with a stride of stride. The filter
+	// input is interpolated, and the control values are repeated
+	// and delayed to line up with it.
+	inline void upsamplePreFilter(float *in, float *cutoffcalc, float *resonance,
+				      float *gain, int stride, int samples)
+	{
+		upsampler.process(in, 2 * stride, in, stride, samples);
+
+		// Local copies, as for getPreFilterSamples()
+		float c[UpsampleDelay], r[UpsampleDelay], g[UpsampleDelay];
+		for (int i = 0; i < UpsampleDelay; i++) {
+			c[i] = upsampleCutoff[i];
+			r[i] = upsampleRes[i];
+			g[i] = upsampleGain[i];
+		}
+		int pos = upsamplePos;
+		for (int i = 0; i < samples; i++) {
+			int k0 = 2 * i * stride, k1 = k0 + stride;
+			float cn = cutoffcalc[k0], rn = resonance[k0], gn = gain[k0];
+			cutoffcalc[k0] = cutoffcalc[k1] = c[pos];
+			resonance[k0] = resonance[k1] = r[pos];
+			gain[k0] = gain[k1] = g[pos];
+			c[pos] = cn;
+			r[pos] = rn;
+			g[pos] = gn;
+			if (++pos == UpsampleDelay) pos = 0;
+		}
+		for (int i = 0; i < UpsampleDelay; i++) {
+			upsampleCutoff[i] = c[i];
+			upsampleRes[i] = r[i];
+			upsampleGain[i] = g[i];
 		}
-		x1 *= envVal;
-		return x1;
+		upsamplePos = pos;
+	}
+	// Audio processing after the filter: HPF, distortion and VCA,
+	// for samples samples of filter output and VCA gain with a
+	// stride of stride.
+	inline void processPostFilter(const float *in, const float *gain,
+				      int stride, int samples, float *out)
+	{
+		(this->*postFilterRun)(in, gain, stride, samples, out);
 	}
 private:
+	enum { DRIVE_OFF, DRIVE_ON, DRIVE_ANTIALIASED };
+	template<int Drive, bool ExpVca>
+	void runPostFilter(const float *in, const float *gain,
+			   int stride, int samples, float *out)
+	{
+		// Local copies, as the compiler can't tell that out
+		// doesn't overlap them.
+		float state = hpfst;
+		float lpc = hpflpc;
+		SquareDist dist = sqdist;
+
+		for (int j = 0; j < samples; j++) {
+			float x1 = in[j * stride];
+
+			// HPF. Always run, even at its lowest frequency,
+			// as it is what blocks any DC from the filter.
+			x1 -= tptlpc(state, x1, lpc);
+
+			// Distortion/overdrive. Without it, still apply its
+			// gain compensation, so the level doesn't change.
+			if (Drive == DRIVE_ON)
+				x1 = dist.Apply(x1);
+			else if (Drive == DRIVE_ANTIALIASED)
+				x1 = dist.ApplyAntialiased(x1);
+			else
+				x1 *= dist.distGainComp;
+
+			// VCA
+			float envVal = gain[j * stride];
+			if (ExpVca) {
+				// Approximate exponential curve with x**5:
+				// - Faster to calculate yet reasonable approximation
+				// - Actually goes down to zero when envelope goes t0 0
+				// Empirically, MiMi-a exponential VCA would be:
+				// envVal = expf(7.5*(envVal-1)); // 1..0 -> 0..-65 dB
+				float envValSquared = envVal * envVal;
+				envVal *= envValSquared * envValSquared;
+			}
+			out[j] = x1 * envVal;
+		}
+		hpfst = state;
+		if (Drive != DRIVE_OFF)
+			sqdist = dist;
+	}
+	void selectPostFilter()
+	{
+		if (!vcaDrive)
+			postFilterRun = expvca ? &Voice::runPostFilter<DRIVE_OFF, true> :
+						 &Voice::runPostFilter<DRIVE_OFF, false>;
+		else if (oversampled)
+			postFilterRun = expvca ? &Voice::runPostFilter<DRIVE_ON, true> :
+						 &Voice::runPostFilter<DRIVE_ON, false>;
+		else
+			postFilterRun = expvca ? &Voice::runPostFilter<DRIVE_ANTIALIASED, true> :
+						 &Voice::runPostFilter<DRIVE_ANTIALIASED, false>;
+	}
+	void updateHPF()
+	{
+		float hpfcutoff = tanf(hpffreq * flt.sampleRateInv * pi);
+		hpflpc = hpfcutoff / (1 + hpfcutoff);
+	}
 	void updateTune()
 	{
 		float tune = oct_tune + unisonDetune * detunePosition;
@@ -459,7 +710,20 @@ public:
 	void setHPFfreq(float val)
 	{
 		hpffreq = val;
-		hpfcutoff = tanf(hpffreq * audioRateInv * pi);
+		updateHPF();
+	}
+	void setVCADrive(float amount)
+	{
+		sqdist.setAmount(amount);
+		// At zero, SquareDist is within 0.1% of linear, so skip it,
+		// apart from its gain
+		vcaDrive = amount > 0;
+		selectPostFilter();
+	}
+	void setExpVCA(bool exp)
+	{
+		expvca = exp;
+		selectPostFilter();
 	}
 	void setEnvSpreadAmt(float d)
 	{
@@ -567,7 +831,10 @@ public:
 		if (portaEnable)
 			porta = portaSaved;
 	}
-	void setSampleRate(float sr, int oversamplingRatio, int modulationRatio)
+	// The filter and what follows it run at filterRatio times the
+	// sample rate, everything before at oversamplingRatio times.
+	void setSampleRate(float sr, int oversamplingRatio, int filterRatio,
+			   int modulationRatio)
 	{
 		modulationRatio += (modulationRatio == 0); // avoid div by 0
 		modRate = sr / modulationRatio;
@@ -575,7 +842,7 @@ public:
 		audioRate = sr * oversamplingRatio;
 		audioRateInv = 1 / audioRate;
 
-		flt.setSampleRate(audioRate);
+		flt.setSampleRate(sr * filterRatio);
 		osc.setSampleRate(audioRate);
 		env.setSampleRate(modRate);
 		fenv.setSampleRate(modRate);
@@ -583,7 +850,7 @@ public:
 		lfo2.setSampleRate(modRate);
 		lfo3.setSampleRate(modRate);
 		afterTouchSmoother.setSampleRate(modRate);
-		hpfcutoff = tanf(hpffreq * audioRateInv * pi);
+		updateHPF();
 		// Limit filter freq to nyquist frequency minus a small
 		// margin (for numerical stability reasons), or 22 kHz,
 		// whichever is smaller.
@@ -592,12 +859,19 @@ public:
 		// this frequency , and at around 28 kHz or so there is
 		// a small range where there are 'birdies' evident in the
 		// output for some reason).
-		maxfiltercutoff = minf(audioRate*0.5f - 120.0f, 22000.0f);
+		maxfiltercutoff = minf(flt.SampleRate*0.5f - 120.0f, 22000.0f);
 
 		// Delay lines compensate for the delay added in
 		// oscillator class, so we need to adjust the length
 		// depending on the oversampling ratio so the delay
 		// lines have the same length in units of time.
+		// With a modulation ratio above 1, control values are ramped
+		// over the audio samples of each modulation period.
+		rampLength = modulationRatio > 1 ?
+			     modulationRatio * oversamplingRatio : 0;
+		rampStepFactor = rampLength ? 1.0f / rampLength : 1;
+		rampJump = true;
+
 		int delayLineLength = 2 * Samples / oversamplingRatio  / modulationRatio;
 		// If length is 1 we get no delay at all, so minimize at 2
 		if (delayLineLength < 2) delayLineLength = 2;
@@ -605,6 +879,20 @@ public:
 		cutoffd.setLength(delayLineLength);
 		resd.setLength(delayLineLength);
 		bmodd.setLength(delayLineLength);
+
+		oversampled = filterRatio > 1;
+		selectPostFilter();
+	}
+	// Reset filter states if they have blown up to Inf or NaN.
+	// Returns true if that was the case.
+	bool resetIfUnstable()
+	{
+		if (flt.isStable() && isfinitef(oschpfst + hpfst))
+			return false;
+		flt.reset();
+		sqdist.reset();
+		oschpfst = hpfst = 0;
+		return true;
 	}
 	void checkAdssrState()
 	{
@@ -627,6 +915,8 @@ public:
 			bmodd.fillZeroes();
 			resd.fillZeroes();
 			ResetEnvelopes();
+			// Don't ramp from the stale values of the last note
+			rampJump = true;
 		}
 		shouldProcess = true;
 		if (velocity != -0.5)
@@ -0,0 +1,269 @@
+/*
+	==============================================================================
+	This file is part of the MiMi-d synthesizer.
+
+	Copyright 2026 Ricard Wanderlof
+
+	This file may be licensed under the terms of of the
+	GNU General Public License Version 2 (the ``GPL'').
+
+	Software distributed under the License is distributed
+	on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+	express or implied. See the GPL for the specific language
+	governing rights and limitations.
+
+	You should have received a copy of the GPL along with this
+	program. If not, go to http://www.gnu.org/licenses/gpl.html
+	or write to the Free Software Foundation, Inc.,
+	51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+	==============================================================================
+ */
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <system_error>
+#include "DenormalGuard.h"
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <pthread.h>
+#endif
+
+// Pool of worker threads, which are started with start() the first
+// time more than one thread is asked for, and then parked until there
+// is work for them to do.
+//
+// The audio thread hands out a number of work items (in practice:
+// voices to render) with run(), which are picked up one at a time by
+// the audio thread itself and the workers, until all have been done.
+// run() never starts any threads or allocates memory. Apart from
+// setting the workers' priority on the first job, and a futex wake
+// call when a worker needs waking up, nothing is done in run() that
+// could block the audio thread.
+//
+// Workers spin for a short while after each job, in case another one
+// comes along soon, and then go to sleep on a futex (or, on systems
+// where we don't have one, keep yielding).
+
+class WorkerPool
+{
+public:
+	static const int MAX_WORKERS = 3; // Not counting the audio thread
+	typedef void (*WorkFunc)(void *context, int item);
+
+private:
+	static const int SPIN_COUNT = 2000;
+
+	struct Worker
+	{
+		std::thread thread;
+		std::atomic<uint32_t> go; // bumped for each new job
+		std::atomic<bool> sleeping;
+	};
+	Worker workers[MAX_WORKERS];
+	int workerCount; // workers we may start, or have started
+	std::atomic<bool> started; // workers started (or failed to)
+	bool prioritySet; // workers' priority copied from the audio thread
+	bool usable; // false if workers can't run at audio priority
+
+	// Current job
+	WorkFunc func;
+	void *context;
+	// Items handed out: the item count in the upper 16 bits and the
+	// next item in the lower, so that a worker which wakes up late
+	// can't take an item from the previous job against the count of
+	// the next one, or the other way around.
+	std::atomic<uint32_t> nextItem;
+	std::atomic<int> done; // items finished
+	std::atomic<bool> quit;
+
+	static inline void cpuRelax()
+	{
+#if defined(__i386__) || defined(__x86_64__)
+		__builtin_ia32_pause();
+#elif defined(__arm__) || defined(__aarch64__)
+		asm volatile("yield");
+#endif
+	}
+	static inline void sleepOn(std::atomic<uint32_t> &word, uint32_t value)
+	{
+#ifdef __linux__
+		syscall(SYS_futex, (uint32_t *)&word, FUTEX_WAIT_PRIVATE,
+			value, NULL, NULL, 0);
+#else
+		(void) word;
+		(void) value;
+		std::this_thread::yield();
+#endif
+	}
+	static inline void wake(std::atomic<uint32_t> &word)
+	{
+#ifdef __linux__
+		syscall(SYS_futex, (uint32_t *)&word, FUTEX_WAKE_PRIVATE,
+			1, NULL, NULL, 0);
+#else
+		(void) word;
+#endif
+	}
+	// Pick up items until there are none left.
+	// The job can't change while we hold an item, as run() waits
+	// for all of them to be done.
+	inline void doWork()
+	{
+		for (;;) {
+			uint32_t n = nextItem.fetch_add(1, std::memory_order_acquire);
+			int item = n & 0xffff;
+			if (item >= (int)(n >> 16))
+				return;
+			func(context, item);
+			done.fetch_add(1, std::memory_order_release);
+		}
+	}
+	void workerLoop(Worker &worker)
+	{
+		// Same floating point mode as the audio thread
+		DenormalGuard denormalGuard;
+		uint32_t seen = worker.go.load(std::memory_order_acquire);
+		for (;;) {
+			int spin = 0;
+			while (worker.go.load(std::memory_order_acquire) == seen) {
+				if (spin < SPIN_COUNT) {
+					spin++;
+					cpuRelax();
+					continue;
+				}
+				// The seq_cst store/load pairs here and in
+				// run() ensure that either we see the bumped
+				// go value, or run() sees us sleeping and
+				// wakes us up.
+				worker.sleeping.store(true);
+				if (worker.go.load() == seen)
+					sleepOn(worker.go, seen);
+				worker.sleeping.store(false);
+			}
+			seen = worker.go.load(std::memory_order_acquire);
+			if (quit.load(std::memory_order_acquire))
+				return;
+			doWork();
+		}
+	}
+	// Give the workers the same scheduling policy and priority as
+	// the audio thread, which is the one calling us. If they can't
+	// get that, e.g. when the audio thread is real time and we're not
+	// allowed to make other threads so, the audio thread would end up
+	// waiting for lower priority threads, so we don't use them.
+	void setPriority()
+	{
+		prioritySet = true;
+#ifdef __linux__
+		int policy;
+		sched_param param;
+		if (pthread_getschedparam(pthread_self(), &policy, &param)) {
+			usable = false;
+			return;
+		}
+		for (int i = 0; i < workerCount; i++)
+			if (pthread_setschedparam(workers[i].thread.native_handle(),
+						  policy, &param))
+				usable = false;
+#endif
+	}
+
+public:
+	WorkerPool()
+	{
+		func = NULL;
+		context = NULL;
+		nextItem = 0;
+		done = 0;
+		quit = false;
+		started = false;
+		prioritySet = false;
+		usable = true;
+		// No point in having more threads than cores
+		int cores = std::thread::hardware_concurrency();
+		workerCount = cores > 1 ? cores - 1 : 0;
+		if (workerCount > MAX_WORKERS)
+			workerCount = MAX_WORKERS;
+		for (int i = 0; i < workerCount; i++) {
+			workers[i].go = 0;
+			workers[i].sleeping = false;
+		}
+	}
+	~WorkerPool()
+	{
+		if (!started.load(std::memory_order_acquire))
+			return;
+		quit.store(true, std::memory_order_release);
+		for (int i = 0; i < workerCount; i++) {
+			workers[i].go.fetch_add(1);
+			wake(workers[i].go);
+			workers[i].thread.join();
+		}
+	}
+	// Start the workers. Called outside run(), the first time more
+	// than one thread is asked for, as it creates threads. If not
+	// all of them can be created, we make do with the ones that were.
+	void start()
+	{
+		if (started.load(std::memory_order_acquire))
+			return;
+		for (int i = 0; i < workerCount; i++) {
+			try {
+				workers[i].thread = std::thread(&WorkerPool::workerLoop,
+								this, std::ref(workers[i]));
+			} catch (const std::system_error &) {
+				workerCount = i;
+				break;
+			}
+		}
+		started.store(true, std::memory_order_release);
+	}
+	// Maximum number of threads including the calling one
+	inline int maxThreads()
+	{
+		return usable ? workerCount + 1 : 1;
+	}
+	// Call func(context, item) for items 0 .. items - 1, using up
+	// to threads threads (including the calling one).
+	// Returns when all items have been processed. The order in
+	// which the items are processed is not defined.
+	void run(WorkFunc workFunc, void *workContext, int items, int threads)
+	{
+		int helpers = threads - 1;
+		if (!started.load(std::memory_order_acquire))
+			helpers = 0; // render on our own until start()ed
+		else if (helpers > workerCount)
+			helpers = workerCount;
+		if (helpers > items - 1) helpers = items - 1;
+		if (helpers > 0 && !prioritySet)
+			setPriority();
+
+		if (helpers <= 0 || !usable) {
+			for (int i = 0; i < items; i++)
+				workFunc(workContext, i);
+			return;
+		}
+
+		func = workFunc;
+		context = workContext;
+		done.store(0, std::memory_order_relaxed);
+		nextItem.store(items << 16, std::memory_order_release);
+		for (int i = 0; i < helpers; i++) {
+			workers[i].go.fetch_add(1);
+			if (workers[i].sleeping.load())
+				wake(workers[i].go);
+		}
+
+		doWork();
+
+		// Only the items taken by workers that have got going can
+		// still be in progress; the others have all been done by
+		// now, so we don't wait for workers which are still waking
+		// up.
+		while (done.load(std::memory_order_acquire) < items)
+			cpuRelax();
+	}
+};
@@ -23,6 +23,7 @@
 
 #include "Engine/SynthEngine.h"
 #include "Engine/Params.h"
+#include "Engine/DenormalGuard.h"
 
 START_NAMESPACE_DISTRHO
 
@@ -101,6 +102,7 @@ public:
 	MiMid() : Plugin(PARAM_COUNT, 0, 0)
 	{
 		synth.setSampleRate(getSampleRate());
+		synth.setMaxBlockSize(getBufferSize());
 
 		// Set up setfuncs array
 
@@ -143,6 +145,7 @@ public:
 #include "Engine/ParamDefs.h"
 
 		initAllParams();
+		setLatency(synth.getLatency());
 	}
 
 protected:
@@ -310,12 +313,19 @@ private:
 #undef atval
 	}
 
-	inline void processMidiPerSample(const MidiEvent *midiEvents, uint32_t &midiEventIndex, const uint32_t midiEventCount, const uint32_t &samplePos)
+	// Process all MIDI events up to and including samplePos, and
+	// return the frame of the next unprocessed event (or frames if
+	// there are no more events in this block).
+	inline uint32_t processMidiUpTo(const MidiEvent *midiEvents, uint32_t &midiEventIndex, const uint32_t midiEventCount, const uint32_t samplePos, const uint32_t frames)
 	{
 		while (midiEventIndex < midiEventCount && midiEvents[midiEventIndex].frame <= samplePos) {
 			processMidiEvent(&midiEvents[midiEventIndex]);
 			midiEventIndex++;
 		}
+		if (midiEventIndex < midiEventCount &&
+		    midiEvents[midiEventIndex].frame < frames)
+			return midiEvents[midiEventIndex].frame;
+		return frames;
 	}
 
 protected:
@@ -325,12 +335,18 @@ protected:
 		 const MidiEvent *midiEvents,
 		 uint32_t midiEventCount) override
 	{
+		// Avoid slow denormal arithmetic in decaying filters etc.
+		DenormalGuard denormalGuard;
 		float *outL = outputs[0];
 		float *outR = outputs[1];
 		uint32_t samplePos = 0;
 		uint32_t midiEventIndex = 0;
 		const TimePosition& timePos(getTimePosition());
 
+		// The latency depends on the oversampling setting, which
+		// may have changed since the last run.
+		setLatency(synth.getLatency());
+
 		if (timePos.bbt.valid) {
 			synth.setBpm(timePos.bbt.beatsPerMinute);
 			if (timePos.playing) {
@@ -352,13 +368,17 @@ protected:
 			}
 		}
 
+		// Split the host block into sub-blocks at the MIDI event
+		// frames, so that the synth engine can render each sub-block
+		// in one go without having to check for MIDI events for
+		// every sample.
 		while (samplePos < frames)
 		{
-			processMidiPerSample(midiEvents, midiEventIndex, midiEventCount, samplePos);
+			uint32_t nextPos = processMidiUpTo(midiEvents, midiEventIndex, midiEventCount, samplePos, frames);
 
-			synth.processSample(outL + samplePos, outR + samplePos);
+			synth.processBlock(outL + samplePos, outR + samplePos, nextPos - samplePos);
 
-			samplePos++;
+			samplePos = nextPos;
 		}
 	}
 
@@ -367,6 +387,11 @@ protected:
 		synth.setSampleRate(newSampleRate);
 	}
 
+	void bufferSizeChanged(uint32_t newBufferSize) override
+	{
+		synth.setMaxBlockSize(newBufferSize);
+	}
+
 	DISTRHO_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MiMid);
 };
 
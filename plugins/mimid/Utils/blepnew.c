@@ -1,6 +1,16 @@
-// C program to convert the original BLEP and BLAMP data (which are
-// B_OVERSAMPLED times oversampled BLEP/BLAMPs) to be more
-// localized given the usage, stressing the cache less.
+// C program to generate the BLEP and BLAMP tables used by the Antialias
+// class, for a given BLEP half-length (Samples).
+//
+// The BLEPs are the step responses of a Blackman windowed sinc
+// spanning 2 * Samples samples, B_OVERSAMPLING times oversampled, with
+// the cutoff at the Nyquist frequency (blep) and half of that (blepd2,
+// used when the oscillators are oversampled 2x). The BLAMPs are the
+// corresponding integrals, divided by Samples; the oscillators scale
+// them up again by Samples when mixing them in. With Samples = 16 this
+// reproduces the original OB-Xd tables to within float precision.
+//
+// The oversampled data is then converted to be more localized given
+// the usage, stressing the cache less.
 //
 // We also take the opportunity to change the sign of selected
 // parts of that data, so that it only requires simple addition
@@ -13,7 +23,14 @@
 // For the BLAMP tables, the sign of the whole table is changed. There
 // is already a single loop to add in the BLAMP.
 //
-// Usage: ./blepnew > BlepDataNew.h
+// With -q, the tables are instead quantized to 16 bit integers, each
+// table with its own scale factor so that its largest entry is at
+// full scale, halving their size. They are written one subsampled
+// blep per line to keep the file size down. The largest quantization
+// error for each table is printed on stderr.
+//
+// Usage: ./blepnew [-q] <samples> > BlepData<samples>[q].h
+// where <samples> is 8, 16 or 32.
 //
 // Copyright 2024 Ricard Wanderlof
 //
@@ -31,23 +48,113 @@
 // 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
 
-// Note: This is the _old_ version of BlepData.h, _before_ conversion!
-#include "../Engine/BlepData.h"
+#define B_OVERSAMPLING 64
+#define MAXSAMPLES 32
 
-#define BLEPLEN (2 * Samples)
-#define TABLESIZE (BLEPLEN * (64 + 1)) // BLEPLEN * (B_OVERSAMPLING + 1)
+// Oversampled tables in their original form, symmetric around the
+// discontinuity, plus one extra entry at the end.
+#define MAXLEN (2 * MAXSAMPLES * B_OVERSAMPLING + 1)
 
-void reformat(const char *name, const float *buf, int size, FILE *outfile, int blep)
+// Generate the oversampled BLEP and BLAMP for a windowed sinc with
+// cutoff fc (relative to the sample rate). As in the original tables,
+// the BLEP is stored as the magnitude of the difference from the
+// trivial step, i.e. the sign of the second half is flipped, and the
+// BLAMP is the integral of the first half, mirrored.
+void generate(int samples, double fc, double *blep, double *blamp)
 {
-  printf("// %s table: %d entries\n", name, size);
-  printf("const float %s[] = {\n", name);
+  int m = 2 * samples * B_OVERSAMPLING;
+  static double h[MAXLEN], residual[MAXLEN];
+  double sum = 0;
+
+  for (int n = 0; n <= m; n++) {
+    double x = (double)(n - m / 2) / B_OVERSAMPLING;
+    double w = 0.42 - 0.5 * cos(2 * M_PI * n / m) + 0.08 * cos(4 * M_PI * n / m);
+    double arg = 2 * M_PI * fc * x;
+    h[n] = w * (arg == 0 ? 1 : sin(arg) / arg);
+    sum += h[n];
+  }
+
+  // Step response (midpoint rule), minus the trivial step
+  double acc = 0;
+  for (int n = 0; n <= m; n++) {
+    acc += h[n] / sum;
+    double step = acc - h[n] / sum / 2;
+    residual[n] = n < m / 2 ? step : step - 1;
+  }
+
+  for (int n = 0; n <= m; n++)
+    blep[n] = n < m / 2 ? residual[n] : -residual[n];
+  blep[m / 2] = 0.5;
+
+  // Integrate up to the center, approaching it from below.
+  acc = 0;
+  for (int n = 0; n <= m / 2; n++) {
+    double r = n < m / 2 ? residual[n] : 0.5;
+    acc += r;
+    blamp[n] = (acc - r / 2) / B_OVERSAMPLING / samples;
+  }
+  for (int n = m / 2 + 1; n <= m; n++)
+    blamp[n] = blamp[m - n];
+}
+
+// Entry i of the reformatted table, see reformat() below.
+double entry(const double *buf, int samples, int i, int blep)
+{
+  int bleplen = 2 * samples;
+  int row = i / bleplen, j = i % bleplen;
+  int sign = blep ? ((j < bleplen / 2) ? -1 : 1) : -1;
+  if (row < B_OVERSAMPLING)
+    return sign * buf[row + j * B_OVERSAMPLING];
+  return sign * buf[(j + 1) * B_OVERSAMPLING];
+}
+
+// Same layout as reformat(), quantized to 16 bits.
+void quantize(const char *name, const double *buf, int samples, FILE *outfile, int blep)
+{
+  int bleplen = 2 * samples;
+  int size = bleplen * (B_OVERSAMPLING + 1);
+  double max = 0, maxerr = 0;
+
+  for (int i = 0; i < size; i++)
+    if (fabs(entry(buf, samples, i, blep)) > max)
+      max = fabs(entry(buf, samples, i, blep));
+  float scale = max / 32767;
+
+  fprintf(outfile, "// %s table: %d entries, times %sScale\n", name, size, name);
+  fprintf(outfile, "const float %sScale = %ef;\n", name, scale);
+  fprintf(outfile, "const int16_t %s[] = {\n", name);
+  for (int i = 0; i < size; i++) {
+    double value = entry(buf, samples, i, blep);
+    long q = lrint(value / scale);
+    double err = fabs(q * (double)scale - (float)value);
+    if (err > maxerr)
+      maxerr = err;
+    if (i % bleplen == 0)
+      fprintf(outfile, "\t");
+    fprintf(outfile, "%ld%s", q, i == size - 1 ? "\n" : (i % bleplen == bleplen - 1 ? ",\n" : ", "));
+  }
+  fprintf(outfile, "};\n");
+  fprintf(stderr, "%s: max %e, max error %e (%.1f dB re max)\n",
+          name, max, maxerr, 20 * log10(maxerr / max));
+}
+
+void reformat(const char *name, const double *buf, int samples, FILE *outfile, int blep)
+{
+  int bleplen = 2 * samples;
+  int size = bleplen * (B_OVERSAMPLING + 1);
+
+  fprintf(outfile, "// %s table: %d entries\n", name, size);
+  fprintf(outfile, "const float %s[] = {\n", name);
   for (int i = 0; i < B_OVERSAMPLING; i++) {
-    for (int j = 0; j < BLEPLEN; j++) {
+    for (int j = 0; j < bleplen; j++) {
       // For BLEPs the sign is changed for the first half of the table
       // For BLAMPs the sign of the whole table is changed
-      int sign = blep ? ((j < BLEPLEN / 2) ? -1 : 1) : -1;
-      fprintf(outfile, "\t%ef,\n", sign * buf[i + j  * B_OVERSAMPLING]);
+      int sign = blep ? ((j < bleplen / 2) ? -1 : 1) : -1;
+      fprintf(outfile, "\t%ef,\n", (float)(sign * buf[i + j  * B_OVERSAMPLING]));
     }
     fprintf(outfile, "\n");
   }
@@ -56,51 +163,48 @@ void reformat(const char *name, const float *buf, int size, FILE *outfile, int b
   // Here due to the reformatting we need to have a whole BLEPLEN of entries,
   // which is actually a repeat of the first subsampled blep, but shifted
   // one step up, skipping the first entry and bringing in the final
-  // entry from the original table.
-  for (int i = 0; i < BLEPLEN; i++) {
-    int sign = blep ? (((i + 1) < BLEPLEN / 2) ? -1 : 1) : -1;
-    fprintf(outfile, "\t%ef", sign * buf[(i + 1) * B_OVERSAMPLING]);
-    if (i != BLEPLEN - 1) fprintf(outfile, ",");
+  // entry from the original table. The sign follows the position in
+  // the shifted table, so that the center entry continues on from the
+  // last subsampled blep.
+  for (int i = 0; i < bleplen; i++) {
+    int sign = blep ? ((i < bleplen / 2) ? -1 : 1) : -1;
+    fprintf(outfile, "\t%ef", (float)(sign * buf[(i + 1) * B_OVERSAMPLING]));
+    if (i != bleplen - 1) fprintf(outfile, ",");
     fprintf(outfile, "\n");
   }
-  printf("};\n");
+  fprintf(outfile, "};\n");
 }
 
 int main(int argc, char **argv)
 {
-  printf("// Rather than simply store the bleps and blamps directly in their\n"
-         "// oversampled form, we note that when in use they are subsampled\n"
-         "// by B_OVERSAMPLING, thus when reading out the waveform, we read\n"
-         "// every B_OVERSAMPLING:th sample, linearly interpolated with the\n"
-         "// adjacent sample. This essentially needs the whole table in\n"
-         "// the cache every time. To optimize this, instead store the waveform\n"
-         "// so that each subsampled waveform is linearly accessible, with the\n"
-         "// adjacent subsampled waveform to be used for interpolation being\n"
-         "// a mere 2 * Samples entries away. Thus, every time the table is\n"
-         "// used, we need roughly 2 * 2 * Samples = 64 entries in the cache\n"
-         "// rather than the whole table of 2048 entries.\n"
-         "// A small downside is that instead of an extra entry to act as an\n"
-         "// interpolation neighbor for the final waveform point, we need\n"
-         "// a whole 2 * Samples worth of them.\n//\n"
-         "// Additionally, we store the data in a form that will require\n"
-         "// simple addition when mixing with the trivial waveform, rather\n"
-         "// than requiring a mixture of additions and subtractions\n");
- 
-  printf("// Sizeof blep: %d = %d floats\n\n", sizeof blep, sizeof blep / sizeof(float));
-  reformat("blep", blep, TABLESIZE, stdout, 1);
-  fprintf(stdout, "\n");
+  static double blep[MAXLEN], blepd2[MAXLEN], blamp[MAXLEN], blampd2[MAXLEN];
+  int quantized = argc > 2 && !strcmp(argv[1], "-q");
+  int samples = argc > 1 ? atoi(argv[argc - 1]) : 16;
+  void (*output)(const char *, const double *, int, FILE *, int) =
+    quantized ? quantize : reformat;
+
+  if (samples != 8 && samples != 16 && samples != 32) {
+    fprintf(stderr, "Usage: %s [-q] <8|16|32>\n", argv[0]);
+    return 1;
+  }
 
-  printf("// Sizeof blepd2: %d = %d floats\n\n", sizeof blepd2, sizeof blepd2 / sizeof(float));
-  reformat("blepd2", blepd2, TABLESIZE, stdout, 1);
+  generate(samples, 0.5, blep, blamp);
+  generate(samples, 0.25, blepd2, blampd2);
+
+  printf("// BLEP and BLAMP tables for Samples = %d%s, generated by "
+         "Utils/blepnew.c.\n// See BlepData.h.\n\n", samples,
+         quantized ? ", quantized to 16 bits" : "");
+
+  output("blep", blep, samples, stdout, 1);
   fprintf(stdout, "\n");
 
+  output("blepd2", blepd2, samples, stdout, 1);
+  fprintf(stdout, "\n");
 
-  printf("// Sizeof blamp: %d = %d floats\n\n", sizeof blamp, sizeof blamp / sizeof(float));
-  reformat("blamp", blamp, TABLESIZE, stdout, 0);
+  output("blamp", blamp, samples, stdout, 0);
   fprintf(stdout, "\n");
 
-  printf("// Sizeof blampd2: %d = %d floats\n\n", sizeof blampd2, sizeof blampd2 / sizeof(float));
-  reformat("blampd2", blampd2, TABLESIZE, stdout, 0);
+  output("blampd2", blampd2, samples, stdout, 0);
 
   return 0;
 }
@@ -0,0 +1,216 @@
+// Soak test for the synth engine: renders hours of release tails
+// offline, to show that decaying filter and envelope states don't slow
+// down the audio thread as they reach the denormal range, and that
+// nothing blows up to NaN or Inf along the way.
+//
+// Every minute of audio, a chord of as many notes as there are voices
+// is played for one second and then released, and the rest of the
+// minute is release tail. For each minute, the mean and worst CPU time
+// per block are printed, along with the output peak level and the
+// number of denormal and non-finite output samples. The exit status is
+// 1 if any non-finite samples were seen.
+//
+// The engine is run directly, as MiMi-d.cpp does, with denormals
+// flushed to zero, unless -n is given, for comparison.
+//
+// Build (from this directory):
+// g++ -O2 -pthread -DBLEP_SAMPLES=16 -I.. -I../../../dpf/distrho -o soak soak.cpp
+//
+// Usage: ./soak [-n] [-r rate] [-b frames] [-m minutes] [preset.ttl]
+//               [symbol=value ...]
+// Presets are read from their .ttl files; symbol=value sets individual
+// parameters afterwards, e.g. voicecount=32 release=5 .
+//
+// Copyright 2025 Ricard Wanderlof
+//
+// This file may be licensed under the terms of of the
+// GNU General Public License Version 2 (the ``GPL'').
+//
+// Software distributed under the License is distributed
+// on an ``AS IS'' basis, WITHOUT WARRANTY OF ANY KIND, either
+// express or implied. See the GPL for the specific language
+// governing rights and limitations.
+//
+// You should have received a copy of the GPL along with this
+// program. If not, go to http://www.gnu.org/licenses/gpl.html
+// or write to the Free Software Foundation, Inc.,
+// 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <chrono>
+#include <vector>
+
+#include "extra/String.hpp"
+USE_NAMESPACE_DISTRHO
+
+#include "Engine/SynthEngine.h"
+#include "Engine/Params.h"
+#include "Engine/DenormalGuard.h"
+
+typedef void (SynthEngine::*SetFuncType)(float);
+
+struct ParamInfo {
+	const char *symbol;
+	float def;
+	SetFuncType setfunc;
+};
+
+static const ParamInfo params[] = {
+#define PARAM(PARAMNO, PG, SP, NAME, SYMBOL, MIN, MAX, DEFAULT, SETFUNC) \
+	{ SYMBOL, DEFAULT, &SynthEngine::SETFUNC },
+#include "Engine/ParamDefs.h"
+};
+static const int paramCount = sizeof(params) / sizeof(params[0]);
+
+static float values[paramCount];
+
+static int findParam(const char *symbol, size_t len)
+{
+	for (int i = 0; i < paramCount; i++)
+		if (strlen(params[i].symbol) == len &&
+		    !strncmp(params[i].symbol, symbol, len))
+			return i;
+	return -1;
+}
+
+// Pick up the lv2:symbol / pset:value pairs from a preset file.
+static bool readPreset(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	if (!f)
+		return false;
+	char line[256];
+	int param = -1;
+	while (fgets(line, sizeof(line), f)) {
+		char *p = strstr(line, "lv2:symbol \"");
+		if (p) {
+			p += 12;
+			char *end = strchr(p, '"');
+			param = end ? findParam(p, end - p) : -1;
+		}
+		p = strstr(line, "pset:value ");
+		if (p && param >= 0) {
+			values[param] = atof(p + 11);
+			param = -1;
+		}
+	}
+	fclose(f);
+	return true;
+}
+
+static void usage(const char *name)
+{
+	fprintf(stderr, "Usage: %s [-n] [-r rate] [-b frames] [-m minutes] [preset.ttl] [symbol=value ...]\n", name);
+	exit(2);
+}
+
+int main(int argc, char **argv)
+{
+	bool flush = true;
+	float rate = 48000;
+	int blockSize = 256;
+	int minutes = 60;
+	int arg;
+
+	for (arg = 1; arg < argc && argv[arg][0] == '-'; arg++) {
+		if (!strcmp(argv[arg], "-n"))
+			flush = false;
+		else if (arg + 1 < argc && !strcmp(argv[arg], "-r"))
+			rate = atof(argv[++arg]);
+		else if (arg + 1 < argc && !strcmp(argv[arg], "-b"))
+			blockSize = atoi(argv[++arg]);
+		else if (arg + 1 < argc && !strcmp(argv[arg], "-m"))
+			minutes = atoi(argv[++arg]);
+		else
+			usage(argv[0]);
+	}
+	if (rate <= 0 || blockSize <= 0 || minutes <= 0)
+		usage(argv[0]);
+
+	for (int i = 0; i < paramCount; i++)
+		values[i] = params[i].def;
+	for (; arg < argc; arg++) {
+		const char *eq = strchr(argv[arg], '=');
+		if (!eq) {
+			if (!readPreset(argv[arg])) {
+				fprintf(stderr, "Can't read %s\n", argv[arg]);
+				return 2;
+			}
+			continue;
+		}
+		int param = findParam(argv[arg], eq - argv[arg]);
+		if (param < 0) {
+			fprintf(stderr, "Unknown parameter: %s\n", argv[arg]);
+			return 2;
+		}
+		values[param] = atof(eq + 1);
+	}
+
+	SynthEngine *synth = new SynthEngine();
+	synth->setSampleRate(rate);
+	synth->setMaxBlockSize(blockSize);
+	int voices = 1;
+	for (int i = 0; i < paramCount; i++) {
+		(synth->*params[i].setfunc)(values[i]);
+		if (!strcmp(params[i].symbol, "voicecount"))
+			voices = (int)values[i];
+	}
+
+	std::vector<float> left(blockSize), right(blockSize);
+	const int minuteFrames = (int)(rate * 60);
+	const int chordFrames = (int)rate;
+	long nonFiniteTotal = 0;
+
+	printf("minute  mean us/block  worst us/block   cpu %%   peak dB  denormals  non-finite\n");
+	for (int minute = 1; minute <= minutes; minute++) {
+		double total = 0, worst = 0;
+		int blocks = 0;
+		long denormals = 0, nonFinite = 0;
+		float peak = 0;
+
+		for (int i = 0; i < voices; i++)
+			synth->procNoteOn(36 + i * 2, 0.8f);
+		for (int pos = 0; pos < minuteFrames; pos += blockSize) {
+			int frames = blockSize;
+			if (frames > minuteFrames - pos)
+				frames = minuteFrames - pos;
+			if (pos <= chordFrames && pos + frames > chordFrames)
+				for (int i = 0; i < voices; i++)
+					synth->procNoteOff(36 + i * 2);
+
+			auto start = std::chrono::steady_clock::now();
+			if (flush) {
+				DenormalGuard denormalGuard;
+				synth->processBlock(left.data(), right.data(), frames);
+			} else
+				synth->processBlock(left.data(), right.data(), frames);
+			double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			total += t;
+			if (t > worst)
+				worst = t;
+			blocks++;
+
+			for (int i = 0; i < frames; i++)
+				for (float s : { left[i], right[i] }) {
+					if (!isfinite(s))
+						nonFinite++;
+					else if (s != 0 && fabsf(s) < FLT_MIN)
+						denormals++;
+					else if (fabsf(s) > peak)
+						peak = fabsf(s);
+				}
+		}
+		printf("%6d  %13.2f  %14.2f  %6.2f  %8.1f  %9ld  %10ld\n",
+		       minute, 1e6 * total / blocks, 1e6 * worst,
+		       100 * total / 60, peak > 0 ? 20 * log10f(peak) : -INFINITY,
+		       denormals, nonFinite);
+		fflush(stdout);
+		nonFiniteTotal += nonFinite;
+	}
+	delete synth;
+	return nonFiniteTotal ? 1 : 0;
+}